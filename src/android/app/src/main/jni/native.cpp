@@ -659,19 +659,19 @@ void Java_org_yuzu_yuzu_1emu_NativeLibrary_submitInlineKeyboardInput(JNIEnv* env
 
 void Java_org_yuzu_yuzu_1emu_NativeLibrary_initializeEmptyUserDirectory(JNIEnv* env,
                                                                         jobject instance) {
-    const auto nand_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::NANDDir);
-    auto vfs_nand_dir = EmulationSession::GetInstance().System().GetFilesystem()->OpenDirectory(
-        Common::FS::PathToUTF8String(nand_dir), FileSys::OpenMode::Read);
+    const auto save_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::SaveDir);
+    auto vfs_save_dir = EmulationSession::GetInstance().System().GetFilesystem()->OpenDirectory(
+        Common::FS::PathToUTF8String(save_dir), FileSys::OpenMode::Read);
 
     const auto user_id = EmulationSession::GetInstance().System().GetProfileManager().GetUser(
         static_cast<std::size_t>(0));
     ASSERT(user_id);
 
     const auto user_save_data_path = FileSys::SaveDataFactory::GetFullPath(
-        {}, vfs_nand_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account, 1,
+        {}, vfs_save_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account, 1,
         user_id->AsU128(), 0);
 
-    const auto full_path = Common::FS::ConcatPathSafe(nand_dir, user_save_data_path);
+    const auto full_path = Common::FS::ConcatPathSafe(save_dir, user_save_data_path);
     if (!Common::FS::CreateParentDirs(full_path)) {
         LOG_WARNING(Frontend, "Failed to create full path of the default user's save directory");
     }
@@ -831,12 +831,12 @@ jstring Java_org_yuzu_yuzu_1emu_NativeLibrary_getSavePath(JNIEnv* env, jobject j
     const auto user_id = manager.GetUser(static_cast<std::size_t>(0));
     ASSERT(user_id);
 
-    const auto nandDir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::NANDDir);
-    auto vfsNandDir = system.GetFilesystem()->OpenDirectory(Common::FS::PathToUTF8String(nandDir),
+    const auto saveDir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::SaveDir);
+    auto vfsSaveDir = system.GetFilesystem()->OpenDirectory(Common::FS::PathToUTF8String(saveDir),
                                                             FileSys::OpenMode::Read);
 
     const auto user_save_data_path = FileSys::SaveDataFactory::GetFullPath(
-        {}, vfsNandDir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account, program_id,
+        {}, vfsSaveDir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account, program_id,
         user_id->AsU128(), 0);
     return Common::Android::ToJString(env, user_save_data_path);
 }
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 
@@ -11,6 +12,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -57,6 +59,8 @@ void AudioRenderer::Stop() {
     for (auto& stream : streams) {
         if (stream) {
             stream->Stop();
+            std::scoped_lock lk{stats_mutex};
+            stats.sink_underruns += stream->GetUnderrunCount();
             sink.CloseStream(stream);
             stream = nullptr;
         }
@@ -119,7 +123,37 @@ u64 AudioRenderer::GetRenderingStartTick(s32 session_id) const noexcept {
     return (1000 * command_buffers[session_id].render_time_taken_us) + signalled_tick;
 }
 
+RenderStats AudioRenderer::GetRenderStats() const {
+    std::scoped_lock lk{stats_mutex};
+    RenderStats current{stats};
+    for (const auto* stream : streams) {
+        if (stream) {
+            current.sink_underruns += stream->GetUnderrunCount();
+        }
+    }
+    return current;
+}
+
+void AudioRenderer::AddDroppedVoices(u32 count) {
+    std::scoped_lock lk{stats_mutex};
+    stats.voices_dropped += count;
+}
+
+void AudioRenderer::RecordCommandList(const CommandListProcessor& processor, u64 time_ns) {
+    std::scoped_lock lk{stats_mutex};
+    for (size_t type = 0; type < Renderer::CommandIdCount; type++) {
+        auto& command{stats.commands[type]};
+        command.count += processor.command_counts[type];
+        command.total_ns += processor.command_times[type];
+        command.last_list_ns = processor.command_times[type];
+    }
+    stats.command_lists++;
+    stats.last_list_ns = time_ns;
+    stats.max_list_ns = std::max(stats.max_list_ns, time_ns);
+}
+
 void AudioRenderer::CreateSinkStreams() {
+    std::scoped_lock lk{stats_mutex};
     u32 channels{sink.GetDeviceChannels()};
     for (u32 i = 0; i < MaxRendererSessions; i++) {
         std::string name{fmt::format("ADSP_RenderStream-{}", i)};
@@ -133,6 +167,7 @@ void AudioRenderer::Main(std::stop_token stop_token) {
     static constexpr char name[]{"DSP_AudioRenderer_Main"};
     MicroProfileOnThreadCreate(name);
     Common::SetCurrentThreadName(name);
+    Common::Trace::SetThreadName(name);
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
     // TODO: Create buffer map/unmap thread + mailbox
@@ -198,14 +233,21 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     command_list_processor.SetProcessTimeMax(max_time);
 
                     if (index == 0) {
+                        TRACE_SCOPE(Audio, "WaitFreeSpace");
                         streams[index]->WaitFreeSpace(stop_token);
                     }
 
                     // Process the command list
                     {
                         MICROPROFILE_SCOPE(Audio_Renderer);
+                        TRACE_SCOPE(Audio, "ProcessCommandList");
+                        const auto host_start{std::chrono::steady_clock::now()};
                         render_times_taken[index] =
                             command_list_processor.Process(index) - start_time;
+                        const auto host_time{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - host_start)};
+                        RecordCommandList(command_list_processor,
+                                          static_cast<u64>(host_time.count()));
                     }
 
                     const auto end_time{system.CoreTiming().GetGlobalTimeUs().count()};
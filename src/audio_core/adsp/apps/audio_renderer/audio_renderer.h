@@ -5,10 +5,12 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "audio_core/adsp/apps/audio_renderer/command_buffer.h"
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/adsp/apps/audio_renderer/render_stats.h"
 #include "audio_core/adsp/mailbox.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -79,6 +81,20 @@ public:
     void ClearRemainCommandCount(s32 session_id) noexcept;
     u64 GetRenderingStartTick(s32 session_id) const noexcept;
 
+    /**
+     * Get the host-side measurements of the rendering so far.
+     *
+     * @return A copy of the current measurements.
+     */
+    RenderStats GetRenderStats() const;
+
+    /**
+     * Add voices dropped by the renderer to the measurements.
+     *
+     * @param count - Number of voices dropped.
+     */
+    void AddDroppedVoices(u32 count);
+
 private:
     /**
      * Main AudioRenderer thread, responsible for processing the command lists.
@@ -92,6 +108,14 @@ private:
 
     void PostDSPClearCommandBuffer() noexcept;
 
+    /**
+     * Add the host time a command list took to the measurements.
+     *
+     * @param processor - The processor which processed the command list.
+     * @param time_ns   - Host time spent processing it, in nanoseconds.
+     */
+    void RecordCommandList(const CommandListProcessor& processor, u64 time_ns);
+
     /// Core system
     Core::System& system;
     /// The output sink the AudioRenderer will send samples to
@@ -110,6 +134,10 @@ private:
     std::array<Sink::SinkStream*, MaxRendererSessions> streams{};
     /// CPU Tick when the DSP was signalled to process, uses time rather than tick
     u64 signalled_tick{0};
+    /// Locks access to the render stats and the streams outside of the main thread
+    mutable std::mutex stats_mutex;
+    /// Host-side measurements of the rendering
+    RenderStats stats{};
 };
 
 } // namespace ADSP::AudioRenderer
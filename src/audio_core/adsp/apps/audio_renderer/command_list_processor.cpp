@@ -1,19 +1,255 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <latch>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/commands.h"
+#include "common/microprofile.h"
 #include "common/settings.h"
+#include "common/task_scheduler.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/memory.h"
 
+MICROPROFILE_DEFINE(Audio_VoiceGroups, "Audio", "DSP_VoiceGroups", MP_RGB(92, 41, 140));
+
 namespace AudioCore::ADSP::AudioRenderer {
 
+namespace {
+using Renderer::CommandId;
+
+using CommandTimes = std::array<u64, Renderer::CommandIdCount>;
+using CommandCounts = std::array<u32, Renderer::CommandIdCount>;
+
+/// Voice groups are only processed in parallel when there are at least this many of them.
+constexpr size_t MinParallelVoiceGroups = 4;
+
+/// Result of checking a command before it is processed
+enum class CommandStatus {
+    Valid,
+    InvalidMagic,
+    OutOfBounds,
+    VerifyFailed,
+};
+
+/**
+ * Check whether the command list can go on with a command. Both the voice group scan and the
+ * sequential pass use this, so they stop at the same command.
+ *
+ * @param processor - The CommandListProcessor processing the command list.
+ * @param command   - The command to check.
+ * @param offset    - Offset of the command from the start of the remaining commands.
+ * @return Valid if the command can be processed, otherwise why the list stops at it.
+ */
+CommandStatus CheckCommand(CommandListProcessor& processor, Renderer::ICommand& command,
+                           u64 offset) {
+    if (command.magic != Renderer::CommandMagic) {
+        return CommandStatus::InvalidMagic;
+    }
+    if (command.size <= 0 || offset + command.size > processor.commands_buffer_size) {
+        return CommandStatus::OutOfBounds;
+    }
+    if (!command.Verify(processor)) {
+        return CommandStatus::VerifyFailed;
+    }
+    return CommandStatus::Valid;
+}
+
+size_t NumVoiceWorkers() {
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 3);
+}
+
+Common::TaskGroup& GetVoiceWorkers() {
+    static Common::TaskGroup workers{Common::TaskPriority::LatencyCritical, NumVoiceWorkers()};
+    return workers;
+}
+
+/**
+ * Process a command, adding the host time it took to its command type.
+ *
+ * @param command   - The command to process.
+ * @param processor - The CommandListProcessor to process it with.
+ * @param times     - Host time spent per command type, in nanoseconds.
+ * @param counts    - Number of commands processed per command type.
+ */
+void ProcessTimed(Renderer::ICommand& command, CommandListProcessor& processor,
+                  CommandTimes& times, CommandCounts& counts) {
+    const auto start{std::chrono::steady_clock::now()};
+    command.Process(processor);
+    const auto elapsed{std::chrono::steady_clock::now() - start};
+
+    const auto type{static_cast<size_t>(command.type)};
+    if (type < Renderer::CommandIdCount) {
+        times[type] += static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        counts[type]++;
+    }
+}
+
+bool IsDataSourceCommand(CommandId type) {
+    switch (type) {
+    case CommandId::DataSourcePcmInt16Version1:
+    case CommandId::DataSourcePcmInt16Version2:
+    case CommandId::DataSourcePcmFloatVersion1:
+    case CommandId::DataSourcePcmFloatVersion2:
+    case CommandId::DataSourceAdpcmVersion1:
+    case CommandId::DataSourceAdpcmVersion2:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Get the mix buffer a voice-local command processes in place.
+ *
+ * @param command - The command to check.
+ * @return The mix buffer index, or -1 if the command may touch anything else.
+ */
+s16 GetVoiceBuffer(const Renderer::ICommand& command) {
+    const auto in_place = [](s16 input, s16 output) -> s16 { return input == output ? input : -1; };
+
+    switch (command.type) {
+    case CommandId::DataSourcePcmInt16Version1:
+        return static_cast<const Renderer::PcmInt16DataSourceVersion1Command&>(command)
+            .output_index;
+    case CommandId::DataSourcePcmInt16Version2:
+        return static_cast<const Renderer::PcmInt16DataSourceVersion2Command&>(command)
+            .output_index;
+    case CommandId::DataSourcePcmFloatVersion1:
+        return static_cast<const Renderer::PcmFloatDataSourceVersion1Command&>(command)
+            .output_index;
+    case CommandId::DataSourcePcmFloatVersion2:
+        return static_cast<const Renderer::PcmFloatDataSourceVersion2Command&>(command)
+            .output_index;
+    case CommandId::DataSourceAdpcmVersion1:
+        return static_cast<const Renderer::AdpcmDataSourceVersion1Command&>(command).output_index;
+    case CommandId::DataSourceAdpcmVersion2:
+        return static_cast<const Renderer::AdpcmDataSourceVersion2Command&>(command).output_index;
+    case CommandId::BiquadFilter: {
+        const auto& cmd{static_cast<const Renderer::BiquadFilterCommand&>(command)};
+        return in_place(cmd.input, cmd.output);
+    }
+    case CommandId::MultiTapBiquadFilter: {
+        const auto& cmd{static_cast<const Renderer::MultiTapBiquadFilterCommand&>(command)};
+        return in_place(cmd.input, cmd.output);
+    }
+    case CommandId::VolumeRamp: {
+        const auto& cmd{static_cast<const Renderer::VolumeRampCommand&>(command)};
+        return in_place(cmd.input_index, cmd.output_index);
+    }
+    default:
+        return -1;
+    }
+}
+
+} // Anonymous namespace
+
+std::vector<CommandListProcessor::VoiceGroup> CommandListProcessor::ProcessVoiceGroups(
+    std::vector<s32>& results) {
+    std::vector<VoiceGroup> groups;
+
+    // Groups past the command the list stops at are never reached, so they must not be processed
+    auto* command_ptr{commands};
+    for (u32 index = 0; index < command_count; index++) {
+        auto& command{*reinterpret_cast<Renderer::ICommand*>(command_ptr)};
+        const auto offset{CpuAddr(command_ptr) - CpuAddr(commands)};
+        if (CheckCommand(*this, command, offset) != CommandStatus::Valid) {
+            break;
+        }
+
+        const auto buffer{GetVoiceBuffer(command)};
+        if (IsDataSourceCommand(command.type) && buffer >= 0 &&
+            static_cast<u32>(buffer) < buffer_count) {
+            groups.push_back({index, 1, command_ptr, buffer});
+        } else if (!groups.empty()) {
+            auto& group{groups.back()};
+            const auto& data_source{*reinterpret_cast<Renderer::ICommand*>(group.commands)};
+            if (group.first + group.count == index && group.buffer == buffer &&
+                data_source.node_id == command.node_id) {
+                group.count++;
+            }
+        }
+        command_ptr += command.size;
+    }
+
+    if (groups.size() < MinParallelVoiceGroups) {
+        return {};
+    }
+
+    MICROPROFILE_SCOPE(Audio_VoiceGroups);
+
+    results.resize(groups.size() * sample_count);
+    std::atomic<size_t> next_group{0};
+    std::mutex times_mutex;
+    CommandTimes group_times{};
+    CommandCounts group_counts{};
+
+    const auto process_groups = [&] {
+        CommandTimes times{};
+        CommandCounts counts{};
+
+        // Every group starts from a silent voice mix buffer of its own
+        thread_local std::vector<s32> buffers;
+        buffers.resize(static_cast<size_t>(buffer_count) * sample_count);
+        CommandListProcessor view{*this};
+        view.mix_buffers = buffers;
+
+        for (size_t i = next_group++; i < groups.size(); i = next_group++) {
+            const auto& group{groups[i]};
+            const auto voice_buffer{
+                view.mix_buffers.subspan(group.buffer * sample_count, sample_count)};
+            std::ranges::fill(voice_buffer, 0);
+
+            auto* group_ptr{group.commands};
+            for (u32 j = 0; j < group.count; j++) {
+                auto& command{*reinterpret_cast<Renderer::ICommand*>(group_ptr)};
+                if (command.enabled) {
+                    ProcessTimed(command, view, times, counts);
+                }
+                group_ptr += command.size;
+            }
+            std::ranges::copy(voice_buffer, results.begin() + i * sample_count);
+        }
+
+        std::scoped_lock lk{times_mutex};
+        for (size_t type = 0; type < Renderer::CommandIdCount; type++) {
+            group_times[type] += times[type];
+            group_counts[type] += counts[type];
+        }
+    };
+
+    const auto num_tasks{std::min(NumVoiceWorkers(), groups.size() - 1)};
+    std::latch remaining{static_cast<std::ptrdiff_t>(num_tasks)};
+    for (size_t i = 0; i < num_tasks; i++) {
+        GetVoiceWorkers().QueueWork([&] {
+            process_groups();
+            remaining.count_down();
+        });
+    }
+    process_groups();
+    remaining.wait();
+
+    // Workers copy the processor while running, so it is only updated once they are done
+    for (size_t type = 0; type < Renderer::CommandIdCount; type++) {
+        command_times[type] += group_times[type];
+        command_counts[type] += group_counts[type];
+    }
+
+    return groups;
+}
+
 void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& process,
                                       CpuAddr buffer, u64 size, Sink::SinkStream* stream_) {
     system = &system_;
@@ -55,18 +291,25 @@ u64 CommandListProcessor::Process(u32 session_id) {
 
     std::string dump{fmt::format("\nSession {}\n", session_id)};
 
+    command_times = {};
+    command_counts = {};
+
+    thread_local std::vector<s32> voice_results;
+    const auto voice_groups{ProcessVoiceGroups(voice_results)};
+    size_t group_index{0};
+
     for (u32 index = 0; index < command_count; index++) {
         auto& command{*reinterpret_cast<Renderer::ICommand*>(commands)};
 
-        if (command.magic != 0xCAFEBABE) {
+        const auto status{CheckCommand(*this, command, CpuAddr(commands) - command_base)};
+
+        if (status == CommandStatus::InvalidMagic) {
             LOG_ERROR(Service_Audio, "Command has invalid magic! Expected 0xCAFEBABE, got {:08X}",
                       command.magic);
             return system->CoreTiming().GetGlobalTimeUs().count() - start_time_;
         }
 
-        auto current_offset{CpuAddr(commands) - command_base};
-
-        if (current_offset + command.size > commands_buffer_size) {
+        if (status == CommandStatus::OutOfBounds) {
             LOG_ERROR(Service_Audio,
                       "Command exceeded command buffer, buffer size {:08X}, command ends at {:08X}",
                       commands_buffer_size,
@@ -78,14 +321,28 @@ u64 CommandListProcessor::Process(u32 session_id) {
             command.Dump(*this, dump);
         }
 
-        if (!command.Verify(*this)) {
+        if (status == CommandStatus::VerifyFailed) {
             break;
         }
 
-        if (command.enabled) {
-            command.Process(*this);
-        } else {
+        // Commands of voice groups were processed up front, the scan stopped at the same command
+        const bool in_group{group_index < voice_groups.size() &&
+                            index >= voice_groups[group_index].first};
+
+        if (!command.enabled) {
             dump += fmt::format("\tDisabled!\n");
+        } else if (!in_group) {
+            ProcessTimed(command, *this, command_times, command_counts);
+        }
+
+        if (in_group) {
+            const auto& group{voice_groups[group_index]};
+            if (index == group.first + group.count - 1) {
+                std::memcpy(&mix_buffers[group.buffer * sample_count],
+                            &voice_results[group_index * sample_count],
+                            sample_count * sizeof(s32));
+                group_index++;
+            }
         }
 
         processed_command_count++;
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <span>
+#include <string>
+#include <vector>
 
 #include "audio_core/common/common.h"
 #include "audio_core/renderer/command/command_list_header.h"
+#include "audio_core/renderer/command/icommand.h"
 #include "common/common_types.h"
 
 namespace Core {
@@ -77,6 +81,33 @@ public:
      */
     u64 Process(u32 session_id);
 
+    /**
+     * The commands generated for a voice channel before it is mixed, which only touch the
+     * channel's state and its voice mix buffer. The group starts with the data source command,
+     * which fills the voice mix buffer, so groups do not depend on each other and can be processed
+     * in any order.
+     */
+    struct VoiceGroup {
+        /// Index of the data source command in the remaining command list
+        u32 first;
+        /// Number of commands in the group
+        u32 count;
+        /// Address of the data source command
+        u8* commands;
+        /// Voice mix buffer the group processes
+        s16 buffer;
+    };
+
+    /**
+     * Process the voice groups of the remaining command list in parallel. Only groups before the
+     * first command the list stops at are taken. Process copies each result into its voice mix
+     * buffer once it reaches the end of the group.
+     *
+     * @param results - Receives the voice mix buffer of every group, one after another.
+     * @return The processed groups, empty if there were too few to be worth it.
+     */
+    std::vector<VoiceGroup> ProcessVoiceGroups(std::vector<s32>& results);
+
     /// Core system
     Core::System* system{};
     /// Core memory
@@ -109,6 +140,10 @@ public:
     u64 current_processing_time{};
     /// The end processing time for this list
     u64 end_time{};
+    /// Host time spent per command type during the last Process call, in nanoseconds
+    std::array<u64, Renderer::CommandIdCount> command_times{};
+    /// Number of commands processed per command type during the last Process call
+    std::array<u32, Renderer::CommandIdCount> command_counts{};
     /// Last command list string generated, used for dumping audio commands to console
     std::string last_dump{};
 };
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "audio_core/renderer/command/icommand.h"
+#include "common/common_types.h"
+
+namespace AudioCore::ADSP::AudioRenderer {
+
+/**
+ * Host time spent processing one type of command.
+ */
+struct CommandTimeStats {
+    /// Number of commands of this type processed
+    u64 count{};
+    /// Total host time spent processing them, in nanoseconds
+    u64 total_ns{};
+    /// Host time spent processing them in the last command list, in nanoseconds
+    u64 last_list_ns{};
+};
+
+/**
+ * Host-side measurements of the AudioRenderer, used to find out why rendered audio crackles or
+ * falls behind. Times are measured on the host and are unrelated to the estimated DSP times the
+ * guest sees through the performance manager.
+ */
+struct RenderStats {
+    /// Time spent per command type, indexed by Renderer::CommandId
+    std::array<CommandTimeStats, Renderer::CommandIdCount> commands{};
+    /// Number of command lists processed
+    u64 command_lists{};
+    /// Host time spent processing the last command list, in nanoseconds
+    u64 last_list_ns{};
+    /// Longest host time spent processing a command list, in nanoseconds
+    u64 max_list_ns{};
+    /// Number of voices the renderer dropped to fit the command lists in the DSP time limit
+    u64 voices_dropped{};
+    /// Number of times the render streams ran out of samples to play
+    u64 sink_underruns{};
+};
+
+} // namespace AudioCore::ADSP::AudioRenderer
@@ -17,6 +17,19 @@ namespace AudioCore::Renderer {
 constexpr u32 TempBufferSize = 0x3F00;
 constexpr std::array<u8, 3> PitchBySrcQuality = {4, 8, 4};
 
+/**
+ * Get a reusable buffer for copying guest samples which are not contiguous in host memory.
+ * Contiguous samples are read in place and never touch this.
+ *
+ * @tparam T - Type of the samples.
+ * @return The calling thread's scratch buffer for T.
+ */
+template <typename T>
+static Common::ScratchBuffer<T>& GetReadBuffer() {
+    thread_local Common::ScratchBuffer<T> buffer;
+    return buffer;
+}
+
 /**
  * Decode PCM data. Only s16 or f32 is supported.
  *
@@ -51,7 +64,7 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
         const u64 size{channel_count * samples_to_decode};
 
         Core::Memory::CpuGuestMemory<T, Core::Memory::GuestMemoryFlags::UnsafeRead> samples(
-            memory, source, size);
+            memory, source, size, &GetReadBuffer<T>());
         if constexpr (std::is_floating_point_v<T>) {
             for (u32 i = 0; i < samples_to_decode; i++) {
                 auto sample{static_cast<s32>(samples[i * channel_count + req.target_channel] *
@@ -74,7 +87,7 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
 
         const VAddr source{req.buffer + ((req.start_offset + req.offset) * sizeof(T))};
         Core::Memory::CpuGuestMemory<T, Core::Memory::GuestMemoryFlags::UnsafeRead> samples(
-            memory, source, samples_to_decode);
+            memory, source, samples_to_decode, &GetReadBuffer<T>());
 
         if constexpr (std::is_floating_point_v<T>) {
             for (u32 i = 0; i < samples_to_decode; i++) {
@@ -141,7 +154,7 @@ static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
 
     const auto size{std::max((samples_to_process / 8U) * SamplesPerFrame, 8U)};
     Core::Memory::CpuGuestMemory<u8, Core::Memory::GuestMemoryFlags::UnsafeRead> wavebuffer(
-        memory, req.buffer + position_in_frame / 2, size);
+        memory, req.buffer + position_in_frame / 2, size, &GetReadBuffer<u8>());
 
     auto context{req.adpcm_context};
     auto header{context->header};
@@ -182,14 +195,26 @@ static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
 
             // Can we consume all of this frame's samples?
             if (samples_to_read >= SamplesPerFrame) {
-                // Can grab all samples until the next header
+                // Can grab all samples until the next header. Expand and scale every nibble of
+                // the frame first, only the prediction has to be done sample by sample.
+                std::array<s32, SamplesPerFrame> scaled_codes;
                 for (u32 i = 0; i < SamplesPerFrame / 2; i++) {
-                    auto code0{Steps[(wavebuffer[read_index] >> 4) & 0xF]};
-                    auto code1{Steps[wavebuffer[read_index] & 0xF]};
-                    read_index++;
-
-                    out_buffer[write_index++] = decode_sample(code0);
-                    out_buffer[write_index++] = decode_sample(code1);
+                    const auto byte{static_cast<u32>(wavebuffer[read_index + i])};
+                    // Sign extend each nibble, matching the Steps table
+                    const auto code0{static_cast<s32>(byte << 24) >> 28};
+                    const auto code1{static_cast<s32>(byte << 28) >> 28};
+                    scaled_codes[i * 2 + 0] = ((code0 * (1 << scale)) << 11) + 0x400;
+                    scaled_codes[i * 2 + 1] = ((code1 * (1 << scale)) << 11) + 0x400;
+                }
+                read_index += SamplesPerFrame / 2;
+
+                for (const auto scaled_code : scaled_codes) {
+                    const auto prediction{coeff0 * yn0 + coeff1 * yn1};
+                    const auto sample{std::clamp<s32>((scaled_code + prediction) >> 11, -0x8000,
+                                                      0x7FFF)};
+                    yn1 = yn0;
+                    yn0 = static_cast<s16>(sample);
+                    out_buffer[write_index++] = yn0;
                 }
 
                 position_in_frame += SamplesPerFrame;
@@ -270,7 +295,9 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
     u32 offset{voice_state.offset};
 
     auto output_buffer{args.output};
-    std::array<s16, TempBufferSize> temp_buffer{};
+    // Only the part written below is ever read, it is not worth clearing the whole buffer for
+    // every voice channel
+    std::array<s16, TempBufferSize> temp_buffer;
 
     while (remaining_sample_count > 0) {
         const auto samples_to_write{std::min(remaining_sample_count, max_remaining_sample_count)};
@@ -400,8 +427,11 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
                 output_buffer[i] = temp_buffer[i];
             }
         } else {
+            // Silence the samples the wavebuffers could not provide, and the history the
+            // resampler may read past them
+            const auto clear_end{std::min<u32>(samples_to_read + pitch * 2, TempBufferSize)};
             std::memset(&temp_buffer[temp_buffer_pos], 0,
-                        (samples_to_read - samples_read) * sizeof(s16));
+                        (clear_end - temp_buffer_pos) * sizeof(s16));
 
             Resample(output_buffer, temp_buffer, sample_rate_ratio, fraction, samples_to_write,
                      args.src_quality);
@@ -217,13 +217,16 @@ static Common::FixedPoint<50, 14> Axfx2AllPassTick(I3dl2ReverbInfo::I3dl2DelayLi
                                                    I3dl2ReverbInfo::I3dl2DelayLine& decay1,
                                                    I3dl2ReverbInfo::I3dl2DelayLine& fdn,
                                                    const Common::FixedPoint<50, 14> mix) {
+    const Common::FixedPoint<50, 14> gain0{decay0.wet_gain};
+    const Common::FixedPoint<50, 14> gain1{decay1.wet_gain};
+
     auto val{decay0.Read()};
-    auto mixed{mix - (val * decay0.wet_gain)};
-    auto out{decay0.Tick(mixed) + (mixed * decay0.wet_gain)};
+    auto mixed{mix - (val * gain0)};
+    auto out{decay0.Tick(mixed) + (mixed * gain0)};
 
     val = decay1.Read();
-    mixed = out - (val * decay1.wet_gain);
-    out = decay1.Tick(mixed) + (mixed * decay1.wet_gain);
+    mixed = out - (val * gain1);
+    out = decay1.Tick(mixed) + (mixed * gain1);
 
     fdn.Tick(out);
     return out;
@@ -268,19 +271,34 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    // The gains do not change while processing, convert them to fixed point once rather than for
+    // every sample. The conversion is the same one the per-sample operators would perform.
+    std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayTaps> early_gains{};
+    for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
+        early_gains[early_tap] = EarlyGains[early_tap];
+    }
+    std::array<std::array<Common::FixedPoint<50, 14>, 3>, I3dl2ReverbInfo::MaxDelayLines>
+        lowpass_coeff{};
+    for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+        for (u32 i = 0; i < 3; i++) {
+            lowpass_coeff[delay_line][i] = state.lowpass_coeff[delay_line][i];
+        }
+    }
+    const Common::FixedPoint<50, 14> lowpass_2{state.lowpass_2};
+    const Common::FixedPoint<50, 14> early_gain{state.early_gain};
+    const Common::FixedPoint<50, 14> late_gain{state.late_gain};
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         Common::FixedPoint<50, 14> early_to_late_tap{
             state.early_delay_line.TapOut(state.early_to_late_taps)};
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
         for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
-            output_samples[tap_indexes[early_tap]] +=
-                state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                EarlyGains[early_tap];
+            const auto sample{state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
+                              early_gains[early_tap]};
+            output_samples[tap_indexes[early_tap]] += sample;
             if constexpr (NumChannels == 6) {
-                output_samples[static_cast<u32>(Channels::LFE)] +=
-                    state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                    EarlyGains[early_tap];
+                output_samples[static_cast<u32>(Channels::LFE)] += sample;
             }
         }
 
@@ -290,29 +308,30 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         }
 
         state.lowpass_0 =
-            (current_sample * state.lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
+            (current_sample * lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
         state.early_delay_line.Tick(state.lowpass_0);
 
         for (u32 channel = 0; channel < NumChannels; channel++) {
-            output_samples[channel] *= state.early_gain;
+            output_samples[channel] *= early_gain;
         }
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> filtered_samples{};
         for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+            const auto fdn_sample{state.fdn_delay_lines[delay_line].Read()};
             filtered_samples[delay_line] =
-                state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][0] +
-                state.shelf_filter[delay_line];
+                fdn_sample * lowpass_coeff[delay_line][0] + state.shelf_filter[delay_line];
             state.shelf_filter[delay_line] =
-                (filtered_samples[delay_line] * state.lowpass_coeff[delay_line][2] +
-                 state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][1])
+                (filtered_samples[delay_line] * lowpass_coeff[delay_line][2] +
+                 fdn_sample * lowpass_coeff[delay_line][1])
                     .to_float();
         }
 
+        const auto late_sample{early_to_late_tap * late_gain};
         const std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> mix_matrix{
-            filtered_samples[1] + filtered_samples[2] + early_to_late_tap * state.late_gain,
-            -filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[1] - filtered_samples[2] + early_to_late_tap * state.late_gain,
+            filtered_samples[1] + filtered_samples[2] + late_sample,
+            -filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[1] - filtered_samples[2] + late_sample,
         };
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> allpass_samples{};
@@ -276,6 +276,11 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    const auto base_gain{Common::FixedPoint<50, 14>::from_base(params.base_gain)};
+    const auto late_gain{Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+    const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
+    const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
@@ -298,7 +303,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         input_sample *= 64;
-        input_sample *= Common::FixedPoint<50, 14>::from_base(params.base_gain);
+        input_sample *= base_gain;
         state.pre_delay_line.Write(input_sample);
 
         for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
@@ -308,8 +313,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         Common::FixedPoint<50, 14> pre_delay_sample{
-            state.pre_delay_line.TapOut(state.pre_delay_time) *
-            Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+            state.pre_delay_line.TapOut(state.pre_delay_time) * late_gain};
 
         std::array<Common::FixedPoint<50, 14>, ReverbInfo::MaxDelayLines> mix_matrix{
             state.prev_feedback_output[2] + state.prev_feedback_output[1] + pre_delay_sample,
@@ -324,9 +328,6 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
                                                   state.fdn_delay_lines[i], mix_matrix[i]);
         }
 
-        const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
-        const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
-
         if constexpr (NumChannels == 6) {
             const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
                 allpass_samples[0], allpass_samples[1], allpass_samples[2] - allpass_samples[3],
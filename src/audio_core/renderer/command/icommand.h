@@ -49,6 +49,9 @@ enum class CommandId : u8 {
     /* 0x1E */ Compressor,
 };
 
+/// Number of command types.
+constexpr size_t CommandIdCount{static_cast<size_t>(CommandId::Compressor) + 1};
+
 constexpr u32 CommandMagic{0xCAFEBABE};
 
 /**
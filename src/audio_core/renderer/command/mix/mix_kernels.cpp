@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/assert.h"
+#include "common/fixed_point.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(__GNUC__) && defined(ARCHITECTURE_x86_64)
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SSE41_TARGET
+#define AVX2_TARGET
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+
+template <size_t Q>
+using Fixed = Common::FixedPoint<64 - Q, Q>;
+
+template <size_t Q>
+constexpr s64 FractionalMask = (s64{1} << Q) - 1;
+
+/**
+ * Round a gained sample to an integer the same way FixedPoint::to_int does.
+ *
+ * @tparam Q     - Number of bits for fixed point operations.
+ * @param sample - Raw fixed point sample.
+ * @return The rounded sample.
+ */
+template <size_t Q>
+constexpr s32 RoundToInt(s64 sample) {
+    sample += (sample & FractionalMask<Q>) >> 1;
+    return static_cast<s32>(sample >> Q);
+}
+
+/// Gain of the given sample truncated to 32 bits, exact when the gain fits.
+s32 GainAt(s64 volume, s64 ramp, u32 index) {
+    return static_cast<s32>(volume + ramp * index);
+}
+
+/// Step to add to 32-bit gain lanes to advance them by the given number of samples.
+s32 GainStep(s64 ramp, u32 lanes) {
+    return static_cast<s32>(static_cast<u32>(ramp * lanes));
+}
+
+/**
+ * Check if every gain applied over the buffer fits in 32 bits. The vector kernels multiply
+ * 32-bit samples by 32-bit gains, which only matches the 64-bit scalar math in that case.
+ * That covers every volume below 65536 at 15-bit precision and below 256 at 23-bit precision.
+ */
+bool GainsFit(s64 volume, s64 ramp, u32 sample_count) {
+    constexpr s64 Min{std::numeric_limits<s32>::min()};
+    constexpr s64 Max{std::numeric_limits<s32>::max()};
+    constexpr s64 MaxRamp{s64{1} << 32};
+    if (volume < Min || volume > Max) {
+        return false;
+    }
+    if (ramp < -MaxRamp || ramp > MaxRamp || sample_count > (1U << 30)) {
+        return false;
+    }
+    const s64 last{volume + ramp * static_cast<s64>(sample_count > 0 ? sample_count - 1 : 0)};
+    return last >= Min && last <= Max;
+}
+
+template <size_t Q, bool Accumulate>
+s32 ProcessScalar(std::span<s32> output, std::span<const s32> input, s64 volume_, s64 ramp_,
+                  u32 sample_count) {
+    auto volume{Fixed<Q>::from_base(volume_)};
+    const auto ramp{Fixed<Q>::from_base(ramp_)};
+    auto sample{Fixed<Q>::from_base(0)};
+    for (u32 i = 0; i < sample_count; i++) {
+        sample = input[i] * volume;
+        if constexpr (Accumulate) {
+            output[i] = (output[i] + sample).to_int();
+        } else {
+            output[i] = Fixed<Q>{sample}.to_int();
+        }
+        volume += ramp;
+    }
+    return sample.to_int();
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+template <size_t Q, bool Accumulate>
+SSE41_TARGET u32 ProcessSSE41(s32* output, const s32* input, s64 volume, s64 ramp,
+                              u32 sample_count) {
+    const __m128i frac_mask{_mm_set1_epi64x(FractionalMask<Q>)};
+    const __m128i step{_mm_set1_epi32(GainStep(ramp, 4))};
+    __m128i gain{_mm_setr_epi32(GainAt(volume, ramp, 0), GainAt(volume, ramp, 1),
+                                GainAt(volume, ramp, 2), GainAt(volume, ramp, 3))};
+
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128i in{_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))};
+        __m128i even{_mm_mul_epi32(in, gain)};
+        __m128i odd{_mm_mul_epi32(_mm_srli_epi64(in, 32), _mm_srli_epi64(gain, 32))};
+        even = _mm_add_epi64(even, _mm_srli_epi64(_mm_and_si128(even, frac_mask), 1));
+        odd = _mm_add_epi64(odd, _mm_srli_epi64(_mm_and_si128(odd, frac_mask), 1));
+
+        // Only the low 32 bits of each shifted product are kept, so a logical shift will do.
+        even = _mm_srli_epi64(even, Q);
+        odd = _mm_slli_epi64(_mm_srli_epi64(odd, Q), 32);
+        __m128i result{_mm_blend_epi16(even, odd, 0xCC)};
+        if constexpr (Accumulate) {
+            const __m128i out{_mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i))};
+            result = _mm_add_epi32(result, out);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        gain = _mm_add_epi32(gain, step);
+    }
+    return i;
+}
+
+template <size_t Q, bool Accumulate>
+AVX2_TARGET u32 ProcessAVX2(s32* output, const s32* input, s64 volume, s64 ramp,
+                            u32 sample_count) {
+    const __m256i frac_mask{_mm256_set1_epi64x(FractionalMask<Q>)};
+    const __m256i step{_mm256_set1_epi32(GainStep(ramp, 8))};
+    __m256i gain{_mm256_setr_epi32(GainAt(volume, ramp, 0), GainAt(volume, ramp, 1),
+                                   GainAt(volume, ramp, 2), GainAt(volume, ramp, 3),
+                                   GainAt(volume, ramp, 4), GainAt(volume, ramp, 5),
+                                   GainAt(volume, ramp, 6), GainAt(volume, ramp, 7))};
+
+    u32 i = 0;
+    for (; i + 8 <= sample_count; i += 8) {
+        const __m256i in{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i))};
+        __m256i even{_mm256_mul_epi32(in, gain)};
+        __m256i odd{_mm256_mul_epi32(_mm256_srli_epi64(in, 32), _mm256_srli_epi64(gain, 32))};
+        even = _mm256_add_epi64(even, _mm256_srli_epi64(_mm256_and_si256(even, frac_mask), 1));
+        odd = _mm256_add_epi64(odd, _mm256_srli_epi64(_mm256_and_si256(odd, frac_mask), 1));
+
+        even = _mm256_srli_epi64(even, Q);
+        odd = _mm256_slli_epi64(_mm256_srli_epi64(odd, Q), 32);
+        __m256i result{_mm256_blend_epi16(even, odd, 0xCC)};
+        if constexpr (Accumulate) {
+            const __m256i out{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i))};
+            result = _mm256_add_epi32(result, out);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+        gain = _mm256_add_epi32(gain, step);
+    }
+    return i;
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+template <size_t Q, bool Accumulate>
+u32 ProcessNEON(s32* output, const s32* input, s64 volume, s64 ramp, u32 sample_count) {
+    const int64x2_t frac_mask{vdupq_n_s64(FractionalMask<Q>)};
+    const int32x4_t step{vdupq_n_s32(GainStep(ramp, 4))};
+    const std::array<s32, 4> gains{GainAt(volume, ramp, 0), GainAt(volume, ramp, 1),
+                                   GainAt(volume, ramp, 2), GainAt(volume, ramp, 3)};
+    int32x4_t gain{vld1q_s32(gains.data())};
+
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const int32x4_t in{vld1q_s32(input + i)};
+        int64x2_t low{vmull_s32(vget_low_s32(in), vget_low_s32(gain))};
+        int64x2_t high{vmull_high_s32(in, gain)};
+        low = vaddq_s64(low, vshrq_n_s64(vandq_s64(low, frac_mask), 1));
+        high = vaddq_s64(high, vshrq_n_s64(vandq_s64(high, frac_mask), 1));
+
+        int32x4_t result{vcombine_s32(vshrn_n_s64(low, Q), vshrn_n_s64(high, Q))};
+        if constexpr (Accumulate) {
+            result = vaddq_s32(result, vld1q_s32(output + i));
+        }
+        vst1q_s32(output + i, result);
+        gain = vaddq_s32(gain, step);
+    }
+    return i;
+}
+
+#endif
+
+template <size_t Q, bool Accumulate>
+s32 Process(MixKernelBackend backend, std::span<s32> output, std::span<const s32> input,
+            f32 volume_, f32 ramp_, u32 sample_count) {
+    // Every sample only depends on the samples at its own index, so the same buffer may be passed
+    // as both, but a partial overlap would feed already processed samples back in.
+    ASSERT_MSG(input.data() == output.data() || input.data() + sample_count <= output.data() ||
+                   output.data() + sample_count <= input.data(),
+               "Mix kernel input and output partially overlap");
+
+    const s64 volume{Fixed<Q>{volume_}.to_raw()};
+    const s64 ramp{Fixed<Q>{ramp_}.to_raw()};
+    if (backend == MixKernelBackend::Scalar || sample_count == 0 ||
+        !GainsFit(volume, ramp, sample_count)) {
+        return ProcessScalar<Q, Accumulate>(output, input, volume, ramp, sample_count);
+    }
+
+    // Output may be the input, take the last sample before it is overwritten
+    const u32 last{sample_count - 1};
+    const s32 last_input{input[last]};
+
+    u32 processed{};
+    switch (backend) {
+#if defined(ARCHITECTURE_x86_64)
+    case MixKernelBackend::SSE41:
+        processed = ProcessSSE41<Q, Accumulate>(output.data(), input.data(), volume, ramp,
+                                                sample_count);
+        break;
+    case MixKernelBackend::AVX2:
+        processed = ProcessAVX2<Q, Accumulate>(output.data(), input.data(), volume, ramp,
+                                               sample_count);
+        break;
+#elif defined(ARCHITECTURE_arm64)
+    case MixKernelBackend::NEON:
+        processed =
+            ProcessNEON<Q, Accumulate>(output.data(), input.data(), volume, ramp, sample_count);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    // Finish the samples left over from the vectors with the scalar path
+    ProcessScalar<Q, Accumulate>(output.subspan(processed), input.subspan(processed),
+                                 volume + ramp * processed, ramp, sample_count - processed);
+
+    return RoundToInt<Q>(static_cast<s64>(last_input) * GainAt(volume, ramp, last));
+}
+
+} // Anonymous namespace
+
+std::vector<MixKernelBackend> GetSupportedMixKernelBackends() {
+    std::vector<MixKernelBackend> backends;
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps = Common::GetCPUCaps();
+    if (caps.avx2) {
+        backends.push_back(MixKernelBackend::AVX2);
+    }
+    if (caps.sse4_1) {
+        backends.push_back(MixKernelBackend::SSE41);
+    }
+#elif defined(ARCHITECTURE_arm64)
+    backends.push_back(MixKernelBackend::NEON);
+#endif
+    backends.push_back(MixKernelBackend::Scalar);
+    return backends;
+}
+
+MixKernelBackend GetMixKernelBackend() {
+    static const MixKernelBackend backend{GetSupportedMixKernelBackends().front()};
+    return backend;
+}
+
+template <size_t Q>
+s32 MixKernel(MixKernelBackend backend, std::span<s32> output, std::span<const s32> input,
+              f32 volume, f32 ramp, u32 sample_count) {
+    return Process<Q, true>(backend, output, input, volume, ramp, sample_count);
+}
+
+template <size_t Q>
+void GainKernel(MixKernelBackend backend, std::span<s32> output, std::span<const s32> input,
+                f32 volume, f32 ramp, u32 sample_count) {
+    Process<Q, false>(backend, output, input, volume, ramp, sample_count);
+}
+
+template s32 MixKernel<15>(MixKernelBackend, std::span<s32>, std::span<const s32>, f32, f32, u32);
+template s32 MixKernel<23>(MixKernelBackend, std::span<s32>, std::span<const s32>, f32, f32, u32);
+template void GainKernel<15>(MixKernelBackend, std::span<s32>, std::span<const s32>, f32, f32,
+                             u32);
+template void GainKernel<23>(MixKernelBackend, std::span<s32>, std::span<const s32>, f32, f32,
+                             u32);
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/// Instruction sets the mix kernels can be run with.
+enum class MixKernelBackend {
+    Scalar,
+    SSE41,
+    AVX2,
+    NEON,
+};
+
+/**
+ * Get the backends the host can run the mix kernels with, fastest first.
+ * Scalar is always supported, and every backend produces bit-identical results.
+ *
+ * @return The supported backends.
+ */
+std::vector<MixKernelBackend> GetSupportedMixKernelBackends();
+
+/**
+ * Get the fastest backend the host can run the mix kernels with.
+ *
+ * @return The fastest supported backend.
+ */
+MixKernelBackend GetMixKernelBackend();
+
+/**
+ * Mix input mix buffer into output mix buffer, with a ramped volume applied to the input.
+ * Input and output may be the same buffer, but must not partially overlap.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param backend      - Backend to process the samples with.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Volume applied to the first input sample.
+ * @param ramp         - Ramp applied to volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @return The final gained input sample.
+ */
+template <size_t Q>
+s32 MixKernel(MixKernelBackend backend, std::span<s32> output, std::span<const s32> input,
+              f32 volume, f32 ramp, u32 sample_count);
+
+/**
+ * Apply a ramped volume to the input mix buffer, saving to the output mix buffer.
+ * Input and output may be the same buffer, but must not partially overlap.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param backend      - Backend to process the samples with.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Volume applied to the first input sample.
+ * @param ramp         - Ramp applied to volume every sample.
+ * @param sample_count - Number of samples to process.
+ */
+template <size_t Q>
+void GainKernel(MixKernelBackend backend, std::span<s32> output, std::span<const s32> input,
+                f32 volume, f32 ramp, u32 sample_count);
+
+} // namespace AudioCore::Renderer
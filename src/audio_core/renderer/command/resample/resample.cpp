@@ -1,10 +1,183 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
 #include "audio_core/renderer/command/resample/resample.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(__GNUC__) && defined(ARCHITECTURE_x86_64)
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SSE41_TARGET
+#define AVX2_TARGET
+#endif
+
 namespace AudioCore::Renderer {
 
+/**
+ * Filter taps of the next output samples, taken from the fraction the same way the scalar loops
+ * step it.
+ */
+template <u32 Taps, size_t Count>
+struct TapPositions {
+    TapPositions(const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                 Common::FixedPoint<49, 15>& fraction, u32& read_index) {
+        for (size_t i = 0; i < Count; i++) {
+            reads[i] = read_index;
+            phases[i] = static_cast<u32>(fraction.get_frac() >> 8) * Taps;
+            fraction += sample_rate_ratio;
+            read_index += static_cast<u32>(fraction.to_int_floor());
+            fraction.clear_int();
+        }
+    }
+
+    std::array<u32, Count> reads;
+    std::array<u32, Count> phases;
+};
+
+// The vector paths below compute every tap as the scalar loops do, converting
+// f32(sample * coefficient) * 256 to the 8-bit fixed point tap with truncation. The taps are
+// then summed as integers, so the results are bit-identical to the scalar paths.
+
+#if defined(ARCHITECTURE_x86_64)
+
+template <u32 Taps>
+SSE41_TARGET static __m128i FilterTapsSSE41(const s16* input, const f32* lut) {
+    const __m128 scale{_mm_set1_ps(256.0f)};
+    __m128i sum{_mm_setzero_si128()};
+    for (u32 tap = 0; tap < Taps; tap += 4) {
+        const __m128i samples{
+            _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + tap)))};
+        const __m128 weighted{_mm_mul_ps(_mm_cvtepi32_ps(samples), _mm_loadu_ps(lut + tap))};
+        sum = _mm_add_epi32(sum, _mm_cvttps_epi32(_mm_mul_ps(weighted, scale)));
+    }
+    return sum;
+}
+
+template <u32 Taps>
+SSE41_TARGET static u32 ResampleSSE41(s32* output, const s16* input, const f32* lut,
+                                      const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                                      Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                                      const u32 samples_to_write) {
+    u32 i{0};
+    for (; i + 4 <= samples_to_write; i += 4) {
+        const TapPositions<Taps, 4> pos(sample_rate_ratio, fraction, read_index);
+        const __m128i taps0{FilterTapsSSE41<Taps>(input + pos.reads[0], lut + pos.phases[0])};
+        const __m128i taps1{FilterTapsSSE41<Taps>(input + pos.reads[1], lut + pos.phases[1])};
+        const __m128i taps2{FilterTapsSSE41<Taps>(input + pos.reads[2], lut + pos.phases[2])};
+        const __m128i taps3{FilterTapsSSE41<Taps>(input + pos.reads[3], lut + pos.phases[3])};
+        const __m128i sums{
+            _mm_hadd_epi32(_mm_hadd_epi32(taps0, taps1), _mm_hadd_epi32(taps2, taps3))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_srai_epi32(sums, 8));
+    }
+    return i;
+}
+
+AVX2_TARGET static __m256i FilterTapsAVX2(const s16* input, const f32* lut) {
+    const __m256i samples{
+        _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)))};
+    const __m256 weighted{_mm256_mul_ps(_mm256_cvtepi32_ps(samples), _mm256_loadu_ps(lut))};
+    return _mm256_cvttps_epi32(_mm256_mul_ps(weighted, _mm256_set1_ps(256.0f)));
+}
+
+AVX2_TARGET static u32 ResampleAVX2(s32* output, const s16* input, const f32* lut,
+                                    const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                                    Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                                    const u32 samples_to_write) {
+    u32 i{0};
+    for (; i + 4 <= samples_to_write; i += 4) {
+        const TapPositions<8, 4> pos(sample_rate_ratio, fraction, read_index);
+        const __m256i taps0{FilterTapsAVX2(input + pos.reads[0], lut + pos.phases[0])};
+        const __m256i taps1{FilterTapsAVX2(input + pos.reads[1], lut + pos.phases[1])};
+        const __m256i taps2{FilterTapsAVX2(input + pos.reads[2], lut + pos.phases[2])};
+        const __m256i taps3{FilterTapsAVX2(input + pos.reads[3], lut + pos.phases[3])};
+
+        // Each 128-bit half holds the sums of four taps of every output sample
+        const __m256i halves{
+            _mm256_hadd_epi32(_mm256_hadd_epi32(taps0, taps1), _mm256_hadd_epi32(taps2, taps3))};
+        const __m128i sums{_mm_add_epi32(_mm256_castsi256_si128(halves),
+                                         _mm256_extracti128_si256(halves, 1))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_srai_epi32(sums, 8));
+    }
+    return i;
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+template <u32 Taps>
+static int32x4_t FilterTapsNEON(const s16* input, const f32* lut) {
+    int32x4_t sum{vdupq_n_s32(0)};
+    for (u32 tap = 0; tap < Taps; tap += 4) {
+        const float32x4_t samples{vcvtq_f32_s32(vmovl_s16(vld1_s16(input + tap)))};
+        const float32x4_t weighted{vmulq_f32(samples, vld1q_f32(lut + tap))};
+        sum = vaddq_s32(sum, vcvtq_s32_f32(vmulq_n_f32(weighted, 256.0f)));
+    }
+    return sum;
+}
+
+template <u32 Taps>
+static u32 ResampleNEON(s32* output, const s16* input, const f32* lut,
+                        const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                        Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                        const u32 samples_to_write) {
+    u32 i{0};
+    for (; i + 4 <= samples_to_write; i += 4) {
+        const TapPositions<Taps, 4> pos(sample_rate_ratio, fraction, read_index);
+        const int32x4_t taps0{FilterTapsNEON<Taps>(input + pos.reads[0], lut + pos.phases[0])};
+        const int32x4_t taps1{FilterTapsNEON<Taps>(input + pos.reads[1], lut + pos.phases[1])};
+        const int32x4_t taps2{FilterTapsNEON<Taps>(input + pos.reads[2], lut + pos.phases[2])};
+        const int32x4_t taps3{FilterTapsNEON<Taps>(input + pos.reads[3], lut + pos.phases[3])};
+        const int32x4_t sums{vpaddq_s32(vpaddq_s32(taps0, taps1), vpaddq_s32(taps2, taps3))};
+        vst1q_s32(output + i, vshrq_n_s32(sums, 8));
+    }
+    return i;
+}
+
+#endif
+
+/**
+ * Resample as many output samples as the host vector instructions can, in groups of 4.
+ *
+ * @return Number of output samples written, the rest are left to the scalar path.
+ */
+template <u32 Taps>
+static u32 ResampleVectorized(MixKernelBackend backend, std::span<s32> output,
+                              std::span<const s16> input, std::span<const f32> lut,
+                              const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                              Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                              const u32 samples_to_write) {
+    switch (backend) {
+#if defined(ARCHITECTURE_x86_64)
+    case MixKernelBackend::AVX2:
+        if constexpr (Taps == 8) {
+            return ResampleAVX2(output.data(), input.data(), lut.data(), sample_rate_ratio,
+                                fraction, read_index, samples_to_write);
+        }
+        [[fallthrough]];
+    case MixKernelBackend::SSE41:
+        return ResampleSSE41<Taps>(output.data(), input.data(), lut.data(), sample_rate_ratio,
+                                   fraction, read_index, samples_to_write);
+#elif defined(ARCHITECTURE_arm64)
+    case MixKernelBackend::NEON:
+        return ResampleNEON<Taps>(output.data(), input.data(), lut.data(), sample_rate_ratio,
+                                  fraction, read_index, samples_to_write);
+#endif
+    default:
+        return 0;
+    }
+}
+
 static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input,
                                const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
@@ -23,7 +196,8 @@ static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input
     }
 }
 
-static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> input,
+static void ResampleNormalQuality(MixKernelBackend backend, std::span<s32> output,
+                                  std::span<const s16> input,
                                   const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                   Common::FixedPoint<49, 15>& fraction,
                                   const u32 samples_to_write) {
@@ -294,7 +468,9 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
 
     auto lut{get_lut()};
     u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
+    u32 i{ResampleVectorized<4>(backend, output, input, lut, sample_rate_ratio, fraction,
+                                read_index, samples_to_write)};
+    for (; i < samples_to_write; i++) {
         const auto lut_index{(fraction.get_frac() >> 8) * 4};
         const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
         const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
@@ -307,7 +483,8 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
     }
 }
 
-static void ResampleHighQuality(std::span<s32> output, std::span<const s16> input,
+static void ResampleHighQuality(MixKernelBackend backend, std::span<s32> output,
+                                std::span<const s16> input,
                                 const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                 Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
     static constexpr std::array<f32, 1024> lut0 = {
@@ -844,7 +1021,9 @@ static void ResampleHighQuality(std::span<s32> output, std::span<const s16> inpu
 
     auto lut{get_lut()};
     u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
+    u32 i{ResampleVectorized<8>(backend, output, input, lut, sample_rate_ratio, fraction,
+                                read_index, samples_to_write)};
+    for (; i < samples_to_write; i++) {
         const auto lut_index{(fraction.get_frac() >> 8) * 8};
         const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
         const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
@@ -866,16 +1045,26 @@ void Resample(std::span<s32> output, std::span<const s16> input,
               const Common::FixedPoint<49, 15>& sample_rate_ratio,
               Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
               const SrcQuality src_quality) {
+    Resample(GetMixKernelBackend(), output, input, sample_rate_ratio, fraction, samples_to_write,
+             src_quality);
+}
+
+void Resample(const MixKernelBackend backend, std::span<s32> output, std::span<const s16> input,
+              const Common::FixedPoint<49, 15>& sample_rate_ratio,
+              Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+              const SrcQuality src_quality) {
 
     switch (src_quality) {
     case SrcQuality::Low:
         ResampleLowQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
         break;
     case SrcQuality::Medium:
-        ResampleNormalQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleNormalQuality(backend, output, input, sample_rate_ratio, fraction,
+                              samples_to_write);
         break;
     case SrcQuality::High:
-        ResampleHighQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleHighQuality(backend, output, input, sample_rate_ratio, fraction,
+                            samples_to_write);
         break;
     }
 }
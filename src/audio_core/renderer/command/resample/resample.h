@@ -6,6 +6,7 @@
 #include <span>
 
 #include "audio_core/common/common.h"
+#include "audio_core/renderer/command/mix/mix_kernels.h"
 #include "common/common_types.h"
 #include "common/fixed_point.h"
 
@@ -26,4 +27,21 @@ void Resample(std::span<s32> output, std::span<const s16> input,
               const Common::FixedPoint<49, 15>& sample_rate_ratio,
               Common::FixedPoint<49, 15>& fraction, u32 samples_to_write, SrcQuality src_quality);
 
+/**
+ * Resample an input buffer into an output buffer with the given backend.
+ * Every backend produces bit-identical results.
+ *
+ * @param backend           - Backend to process the samples with.
+ * @param output            - Output buffer.
+ * @param input             - Input buffer.
+ * @param sample_rate_ratio - Ratio for resampling.
+ * @param fraction          - Current read fraction, written to and should be passed back in for
+ *                            multiple calls.
+ * @param samples_to_write  - Number of samples to write.
+ * @param src_quality       - Resampling quality.
+ */
+void Resample(MixKernelBackend backend, std::span<s32> output, std::span<const s16> input,
+              const Common::FixedPoint<49, 15>& sample_rate_ratio,
+              Common::FixedPoint<49, 15>& fraction, u32 samples_to_write, SrcQuality src_quality);
+
 } // namespace AudioCore::Renderer
@@ -33,8 +33,10 @@ void DeviceSinkCommand::Process(const AudioRenderer::CommandListProcessor& proce
         .consumed{false},
     };
 
+    // A muted stream only plays silence, so the mixed samples don't need converting.
     std::array<s16, TargetSampleCount * MaxChannels> samples{};
-    for (u32 channel = 0; channel < input_count; channel++) {
+    const auto channel_count{stream->IsMuted() ? 0U : input_count};
+    for (u32 channel = 0; channel < channel_count; channel++) {
         const auto offset{inputs[channel] * out_buffer.frames};
 
         for (u32 index = 0; index < out_buffer.frames; index++) {
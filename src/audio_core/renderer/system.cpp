@@ -138,6 +138,7 @@ Result System::Initialize(const AudioRendererParameterInternal& params,
     // Allocate the memory normally instead and hope the game doesn't try to read anything back
     workbuffer = std::make_unique<u8[]>(transfer_memory_size);
     workbuffer_size = transfer_memory_size;
+    workbuffer_memory.Set(workbuffer_size);
 
     PoolMapper pool_mapper(process_handle, false);
     pool_mapper.InitializeSystemPool(memory_pool_info, workbuffer.get(), workbuffer_size);
@@ -721,6 +722,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
         const auto time_limit{static_cast<u32>(std::max(dsp_time_limit + estimated_time, 0.0f))};
         num_voices_dropped =
             DropVoices(command_buffer, static_cast<u32>(start_estimated_time), time_limit);
+        audio_renderer.AddDroppedVoices(num_voices_dropped);
     }
 
     command_list_header->buffer_size = command_buffer.size;
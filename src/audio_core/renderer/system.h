@@ -17,6 +17,7 @@
 #include "audio_core/renderer/splitter/splitter_context.h"
 #include "audio_core/renderer/upsampler/upsampler_manager.h"
 #include "audio_core/renderer/voice/voice_context.h"
+#include "common/memory_accounting.h"
 #include "common/thread.h"
 #include "core/hle/service/audio/errors.h"
 
@@ -289,6 +290,8 @@ private:
     std::unique_ptr<u8[]> workbuffer{};
     /// Size of the main workbuffer
     u64 workbuffer_size{};
+    /// Accounts the main workbuffer in the host memory usage
+    Common::MemoryAccount workbuffer_memory{Common::MemoryCategory::AudioRenderer};
     /// Unknown buffer/marker
     std::span<u8> unk_2A8{};
     /// Size of the above unknown buffer/marker
@@ -8,6 +8,7 @@
 #include "audio_core/renderer/system_manager.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -82,12 +83,14 @@ void SystemManager::ThreadFunc(std::stop_token stop_token) {
     static constexpr char name[]{"AudioRenderSystemManager"};
     MicroProfileOnThreadCreate(name);
     Common::SetCurrentThreadName(name);
+    Common::Trace::SetThreadName(name);
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
     while (active && !stop_token.stop_requested()) {
         {
             std::scoped_lock l{mutex1};
 
             MICROPROFILE_SCOPE(Audio_RenderSystemManager);
+            TRACE_SCOPE(Audio, "SendCommandToDsp");
 
             for (auto system : systems) {
                 system->SendCommandToDsp();
@@ -9,6 +9,7 @@
 #include "audio_core/sink/sink_stream.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "core/core.h"
 
 #ifdef _WIN32
@@ -70,7 +71,10 @@ public:
             minimum_latency = TargetSampleCount * 2;
         }
 
-        minimum_latency = std::max(minimum_latency, TargetSampleCount * 2);
+        // Low latency mode asks for a single buffer per period when the device can do it
+        const u32 min_period{Settings::values.audio_low_latency ? TargetSampleCount
+                                                                : TargetSampleCount * 2};
+        minimum_latency = std::max(minimum_latency, min_period);
 
         LOG_INFO(Service_Audio,
                  "Opening cubeb stream {} type {} with: rate {} channels {} (system channels {}) "
@@ -94,6 +98,8 @@ public:
             LOG_CRITICAL(Audio_Sink, "Error initializing cubeb stream, error: {}", init_error);
             return;
         }
+
+        SetDevicePeriod(minimum_latency);
     }
 
     /**
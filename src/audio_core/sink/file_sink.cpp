@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "audio_core/sink/file_sink.h"
+#include "audio_core/sink/sink_stream.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+
+namespace AudioCore::Sink {
+namespace {
+constexpr u64 FnvOffsetBasis = 0xCBF29CE484222325ULL;
+constexpr u64 FnvPrime = 0x100000001B3ULL;
+
+/**
+ * File sink stream, hands its output to the sink's summary and writes it to a file without
+ * pacing or volume changes.
+ */
+class FileSinkStream final : public SinkStream {
+public:
+    /**
+     * Create a new sink stream.
+     *
+     * @param sink_            - Sink summarizing this stream.
+     * @param system_          - Core system.
+     * @param system_channels_ - Number of channels the audio system expects.
+     * @param name_            - Name of this stream.
+     * @param path             - File to write the stream to, empty to not write it.
+     * @param append           - Append to the file instead of replacing it.
+     * @param type_            - Type of this stream, render/in/out.
+     */
+    FileSinkStream(FileSink& sink_, Core::System& system_, u32 system_channels_, std::string name_,
+                   const std::filesystem::path& path, bool append, StreamType type_)
+        : SinkStream{system_, type_}, sink{sink_}, name{std::move(name_)} {
+        system_channels = system_channels_;
+        device_channels = system_channels_;
+
+        if (type == StreamType::In || path.empty()) {
+            return;
+        }
+        file.Open(path, append ? Common::FS::FileAccessMode::Append
+                               : Common::FS::FileAccessMode::Write);
+        if (!file.IsOpen()) {
+            LOG_ERROR(Audio_Sink, "Failed to open {} to write stream {} to",
+                      Common::FS::PathToUTF8String(path), name);
+        }
+    }
+
+    ~FileSinkStream() override = default;
+
+    void AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) override {
+        if (type == StreamType::In) {
+            return;
+        }
+
+        sink.Capture(name, samples, buffer.frames);
+        if (file.IsOpen() && file.WriteSpan<s16>(samples) != samples.size()) {
+            LOG_ERROR(Audio_Sink, "Failed to write stream {}, no longer writing it", name);
+            file.Close();
+        }
+    }
+
+    std::vector<s16> ReleaseBuffer(u64 num_samples) override {
+        return std::vector<s16>(num_samples);
+    }
+
+    bool IsMuted() const override {
+        // The file receives the rendered samples whatever the volume is.
+        return false;
+    }
+
+private:
+    /// Sink summarizing this stream
+    FileSink& sink;
+    /// Name of this stream
+    std::string name;
+    /// File the stream is written to
+    Common::FS::IOFile file;
+};
+} // Anonymous namespace
+
+FileSink::FileSink(std::string_view device_id) {
+    if (device_id == checksum_device_name) {
+        return;
+    }
+
+    directory = device_id.empty() || device_id == auto_device_name
+                    ? Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir) / "audio"
+                    : std::filesystem::path{device_id};
+    if (!Common::FS::CreateDirs(directory)) {
+        LOG_ERROR(Audio_Sink, "Failed to create {}, only checksumming the audio output",
+                  Common::FS::PathToUTF8String(directory));
+        directory.clear();
+    }
+}
+
+FileSink::~FileSink() = default;
+
+SinkStream* FileSink::AcquireSinkStream(Core::System& system, u32 system_channels_,
+                                        const std::string& name, StreamType type) {
+    system_channels = system_channels_;
+
+    bool append{};
+    if (type != StreamType::In) {
+        std::scoped_lock lk{capture_mutex};
+        const auto [it, inserted] = captures.try_emplace(name);
+        if (inserted) {
+            it->second.name = name;
+            it->second.checksum = FnvOffsetBasis;
+        }
+        append = !inserted;
+    }
+
+    const auto path{directory.empty() ? std::filesystem::path{} : directory / (name + ".pcm")};
+    SinkStreamPtr& stream = sink_streams.emplace_back(std::make_unique<FileSinkStream>(
+        *this, system, system_channels, name, path, append, type));
+
+    return stream.get();
+}
+
+void FileSink::CloseStream(SinkStream* stream) {
+    for (size_t i = 0; i < sink_streams.size(); i++) {
+        if (sink_streams[i].get() == stream) {
+            sink_streams[i].reset();
+            sink_streams.erase(sink_streams.begin() + i);
+            break;
+        }
+    }
+}
+
+void FileSink::CloseStreams() {
+    sink_streams.clear();
+}
+
+f32 FileSink::GetDeviceVolume() const {
+    if (sink_streams.empty()) {
+        return 1.0f;
+    }
+
+    return sink_streams[0]->GetDeviceVolume();
+}
+
+void FileSink::SetDeviceVolume(f32 volume) {
+    for (auto& stream : sink_streams) {
+        stream->SetDeviceVolume(volume);
+    }
+}
+
+void FileSink::SetSystemVolume(f32 volume) {
+    for (auto& stream : sink_streams) {
+        stream->SetSystemVolume(volume);
+    }
+}
+
+std::vector<FileSinkCapture> FileSink::GetCaptures() const {
+    std::scoped_lock lk{capture_mutex};
+    std::vector<FileSinkCapture> out;
+    out.reserve(captures.size());
+    for (const auto& [name, capture] : captures) {
+        out.push_back(capture);
+    }
+    return out;
+}
+
+void FileSink::Capture(const std::string& name, std::span<const s16> samples, u64 frames) {
+    std::scoped_lock lk{capture_mutex};
+    auto& capture{captures.at(name)};
+
+    // Hash the samples as little-endian bytes so the checksum is the same on every host
+    auto hash{capture.checksum};
+    for (const auto sample : samples) {
+        const auto value{static_cast<u16>(sample)};
+        hash = (hash ^ (value & 0xFF)) * FnvPrime;
+        hash = (hash ^ (value >> 8)) * FnvPrime;
+    }
+    capture.checksum = hash;
+    capture.frames += frames;
+}
+
+} // namespace AudioCore::Sink
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "audio_core/sink/sink.h"
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace AudioCore::Sink {
+class SinkStream;
+
+/// Device ID for the file sink that only checksums the output instead of writing it to files
+constexpr char checksum_device_name[] = "checksum";
+
+/**
+ * Summary of everything a file sink stream was given to play.
+ */
+struct FileSinkCapture {
+    /// Name of the stream
+    std::string name;
+    /// Number of frames written
+    u64 frames{};
+    /// FNV-1a hash of the written samples, in the order they were written
+    u64 checksum{};
+};
+
+/**
+ * File backend sink, writes the output of every stream to a raw interleaved s16 PCM file named
+ * after the stream, as fast as it is rendered. Nothing paces the streams, so this is meant for
+ * headless runs measuring and verifying the audio pipeline rather than for listening.
+ * Audio In streams record silence.
+ */
+class FileSink final : public Sink {
+public:
+    /**
+     * Create a new file sink.
+     *
+     * @param device_id - Directory to write the streams to. "auto" writes them to the dump
+     *                    directory, and "checksum" only checksums them.
+     */
+    explicit FileSink(std::string_view device_id);
+    ~FileSink() override;
+
+    /**
+     * Create a new sink stream.
+     *
+     * @param system          - Core system.
+     * @param system_channels - Number of channels the audio system expects.
+     * @param name            - Name of this stream.
+     * @param type            - Type of this stream, render/in/out.
+     *
+     * @return A pointer to the created SinkStream
+     */
+    SinkStream* AcquireSinkStream(Core::System& system, u32 system_channels,
+                                  const std::string& name, StreamType type) override;
+
+    /**
+     * Close a given stream.
+     *
+     * @param stream - The stream to close.
+     */
+    void CloseStream(SinkStream* stream) override;
+
+    /**
+     * Close all streams.
+     */
+    void CloseStreams() override;
+
+    /**
+     * Get the device volume. Set from calls to the IAudioDevice service.
+     *
+     * @return Volume of the device.
+     */
+    f32 GetDeviceVolume() const override;
+
+    /**
+     * Set the device volume. Set from calls to the IAudioDevice service.
+     *
+     * @param volume - New volume of the device.
+     */
+    void SetDeviceVolume(f32 volume) override;
+
+    /**
+     * Set the system volume. Comes from the audio system using this stream.
+     *
+     * @param volume - New volume of the system.
+     */
+    void SetSystemVolume(f32 volume) override;
+
+    /**
+     * Get the summaries of every output stream opened on this sink, including closed ones.
+     * A stream that is opened again under the same name continues its summary.
+     *
+     * @return The stream summaries, sorted by stream name.
+     */
+    std::vector<FileSinkCapture> GetCaptures() const;
+
+    /**
+     * Add the samples of an output stream to its summary.
+     *
+     * @param name    - Name of the stream.
+     * @param samples - Interleaved samples given to the stream.
+     * @param frames  - Number of frames in the samples.
+     */
+    void Capture(const std::string& name, std::span<const s16> samples, u64 frames);
+
+private:
+    /// Directory the streams are written to, empty to only checksum them
+    std::filesystem::path directory;
+    /// Protects captures, the streams are written from the renderer and audio out threads
+    mutable std::mutex capture_mutex;
+    /// Summary of every output stream, by name
+    std::map<std::string, FileSinkCapture> captures;
+    /// List of streams managed by this sink
+    std::vector<SinkStreamPtr> sink_streams{};
+};
+
+} // namespace AudioCore::Sink
@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
+#include "audio_core/common/common.h"
 #include "audio_core/sink/sink.h"
 #include "audio_core/sink/sink_stream.h"
+#include "common/settings.h"
 
 namespace Core {
 class System;
@@ -24,6 +29,26 @@ public:
     std::vector<s16> ReleaseBuffer(u64) override {
         return {};
     }
+    bool IsMuted() const override {
+        return true;
+    }
+    void WaitFreeSpace(std::stop_token) override {
+        if (!Settings::values.audio_render_on_demand) {
+            return;
+        }
+        // Nothing plays the buffers, so pace the renderer to the rate a device would play them at
+        // rather than rendering as fast as possible.
+        const auto now{std::chrono::steady_clock::now()};
+        next_buffer_time = std::max(next_buffer_time, now);
+        std::this_thread::sleep_until(next_buffer_time);
+        next_buffer_time += BufferPeriod;
+    }
+
+private:
+    static constexpr std::chrono::microseconds BufferPeriod{
+        std::chrono::microseconds{std::chrono::seconds{1}} * TargetSampleCount / TargetSampleRate};
+
+    std::chrono::steady_clock::time_point next_buffer_time{};
 };
 
 /**
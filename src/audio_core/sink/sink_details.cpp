@@ -16,6 +16,7 @@
 #ifdef HAVE_SDL2
 #include "audio_core/sink/sdl2_sink.h"
 #endif
+#include "audio_core/sink/file_sink.h"
 #include "audio_core/sink/null_sink.h"
 #include "common/logging/log.h"
 #include "common/settings_enums.h"
@@ -77,6 +78,16 @@ constexpr SinkDetails sink_details[] = {
         [](bool capture) { return std::vector<std::string>{"null"}; },
         []() { return true; },
     },
+    SinkDetails{
+        Settings::AudioEngine::File,
+        [](std::string_view device_id) -> std::unique_ptr<Sink> {
+            return std::make_unique<FileSink>(device_id);
+        },
+        [](bool capture) {
+            return std::vector<std::string>{auto_device_name, checksum_device_name};
+        },
+        []() { return true; },
+    },
 };
 
 const SinkDetails& GetOutputSinkDetails(Settings::AudioEngine sink_id) {
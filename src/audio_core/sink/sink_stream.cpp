@@ -1,8 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <cmath>
 #include <memory>
 #include <span>
 #include <vector>
@@ -11,6 +13,7 @@
 #include "audio_core/common/common.h"
 #include "audio_core/sink/sink_stream.h"
 #include "common/common_types.h"
+#include "common/div_ceil.h"
 #include "common/fixed_point.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -19,6 +22,14 @@
 
 namespace AudioCore::Sink {
 
+namespace {
+/// Time-stretching changes the playback speed by at most 1 / MaxStretchDivisor, 5%
+constexpr size_t MaxStretchDivisor = 20;
+
+/// How long a low latency stream plays without underruns before its queue shrinks, 5 seconds
+constexpr size_t QueueShrinkFrames = TargetSampleRate * 5;
+} // Anonymous namespace
+
 void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     SCOPE_EXIT {
         queue.enqueue(buffer);
@@ -38,6 +49,19 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     }
     auto volume{system_volume * device_volume * yuzu_volume};
 
+    if (volume == 0.0f) {
+        // Nothing will be heard, skip mixing and queue silence of the right length.
+        const auto silence_size{samples.size() / system_channels * device_channels};
+        if (silence_size <= samples.size()) {
+            std::ranges::fill(samples, s16{0});
+            samples_buffer.Push(samples.subspan(0, silence_size));
+        } else {
+            std::vector<s16> silence(silence_size);
+            samples_buffer.Push(silence);
+        }
+        return;
+    }
+
     if (system_channels == 6 && device_channels == 2) {
         // We're given 6 channels, but our device only outputs 2, so downmix.
         // Front = 1.0
@@ -204,8 +228,6 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
     const std::size_t num_channels = GetDeviceChannels();
     const std::size_t frame_size = num_channels;
     const std::size_t frame_size_bytes = frame_size * sizeof(s16);
-    size_t frames_written{0};
-    size_t actual_frames_written{0};
 
     // If we're paused or going to shut down, we don't want to consume buffers as coretiming is
     // paused and we'll desync, so just play silence.
@@ -219,18 +241,75 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         }
 
         static constexpr std::array<s16, 6> silence{};
-        for (size_t i = frames_written; i < num_frames; i++) {
+        for (size_t i = 0; i < num_frames; i++) {
             std::memcpy(&output_buffer[i * frame_size], &silence[0], frame_size_bytes);
         }
         return;
     }
 
+    const bool low_latency{type == StreamType::Render && Settings::values.audio_low_latency};
+
+    // When time-stretching, play slightly faster while the queue is above its target and slightly
+    // slower when it is about to run dry, rather than letting the renderer stall or underrun.
+    size_t input_frames{num_frames};
+    if (low_latency && Settings::values.audio_time_stretch && num_frames >= MaxStretchDivisor) {
+        const auto queued{queued_buffers.load()};
+        if (queued > target_queue_size) {
+            input_frames += num_frames / MaxStretchDivisor;
+        } else if (queued == 0) {
+            input_frames -= num_frames / MaxStretchDivisor;
+        }
+    }
+
+    size_t actual_frames_written{0};
+    if (input_frames == num_frames) {
+        actual_frames_written = PopFrames(output_buffer, num_frames);
+    } else {
+        stretch_buffer.resize(input_frames * frame_size);
+        actual_frames_written = PopFrames(stretch_buffer, input_frames);
+
+        // Linearly interpolate the popped frames to the number of frames the device requested
+        const auto step{static_cast<f64>(input_frames - 1) / static_cast<f64>(num_frames - 1)};
+        for (size_t i = 0; i < num_frames; i++) {
+            const auto position{static_cast<f64>(i) * step};
+            const auto index{std::min(static_cast<size_t>(position), input_frames - 2)};
+            const auto fraction{position - static_cast<f64>(index)};
+            for (size_t channel = 0; channel < frame_size; channel++) {
+                const auto a{static_cast<f64>(stretch_buffer[index * frame_size + channel])};
+                const auto b{static_cast<f64>(stretch_buffer[(index + 1) * frame_size + channel])};
+                output_buffer[i * frame_size + channel] =
+                    static_cast<s16>(std::lround(a + (b - a) * fraction));
+            }
+        }
+    }
+
+    if (low_latency) {
+        AdaptQueueSize(actual_frames_written < input_frames, num_frames);
+    }
+
+    std::memcpy(&last_frame[0], &output_buffer[(num_frames - 1) * frame_size], frame_size_bytes);
+
+    {
+        std::scoped_lock lk{sample_count_lock};
+        last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
+        min_played_sample_count = max_played_sample_count;
+        max_played_sample_count += actual_frames_written;
+    }
+}
+
+size_t SinkStream::PopFrames(std::span<s16> output_buffer, size_t num_frames) {
+    const std::size_t frame_size = GetDeviceChannels();
+    const std::size_t frame_size_bytes = frame_size * sizeof(s16);
+    size_t frames_written{0};
+    size_t actual_frames_written{0};
+
     while (frames_written < num_frames) {
         // If the playing buffer has been consumed or has no frames, we need a new one
         if (playing_buffer.consumed || playing_buffer.frames == 0) {
             if (!queue.try_dequeue(playing_buffer)) {
                 // If no buffer was available we've underrun, fill the remaining buffer with
                 // the last written frame and continue.
+                ++underrun_count;
                 for (size_t i = frames_written; i < num_frames; i++) {
                     std::memcpy(&output_buffer[i * frame_size], &last_frame[0], frame_size_bytes);
                 }
@@ -264,15 +343,28 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         }
     }
 
-    std::memcpy(&last_frame[0], &output_buffer[(frames_written - 1) * frame_size],
-                frame_size_bytes);
+    return actual_frames_written;
+}
 
-    {
-        std::scoped_lock lk{sample_count_lock};
-        last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
-        min_played_sample_count = max_played_sample_count;
-        max_played_sample_count += actual_frames_written;
+void SinkStream::AdaptQueueSize(bool underrun, size_t num_frames) {
+    // Grow the queue by a buffer on every underrun, and shrink it again after a while without any
+    const auto target{target_queue_size.load()};
+    const auto min_target{std::min(min_queue_size, max_queue_size)};
+    if (underrun) {
+        target_queue_size = std::min(target + 1, max_queue_size);
+        frames_since_adapt = 0;
+        return;
     }
+
+    frames_since_adapt += num_frames;
+    if (frames_since_adapt >= QueueShrinkFrames) {
+        target_queue_size = std::max(target, min_target + 1) - 1;
+        frames_since_adapt = 0;
+    }
+}
+
+void SinkStream::SetDevicePeriod(u32 frames) {
+    min_queue_size = std::max(Common::DivCeil(frames, TargetSampleCount), 1U);
 }
 
 u64 SinkStream::GetExpectedPlayedSampleCount() {
@@ -286,10 +378,28 @@ u64 SinkStream::GetExpectedPlayedSampleCount() {
     return std::min<u64>(exp_played_sample_count, max_played_sample_count) + TargetSampleCount * 3;
 }
 
+bool SinkStream::IsMuted() const {
+    return system_volume * device_volume * Settings::Volume() == 0.0f;
+}
+
 void SinkStream::WaitFreeSpace(std::stop_token stop_token) {
+    // In low latency mode the renderer is paced to the adaptive target instead of the full ring.
+    // Time-stretching drains a queue above its target, so it is given one buffer of headroom.
+    u32 queue_size{max_queue_size};
+    if (Settings::values.audio_low_latency) {
+        queue_size = target_queue_size + (Settings::values.audio_time_stretch ? 1 : 0);
+    }
+
     std::unique_lock lk{release_mutex};
+    if (Settings::values.audio_render_on_demand) {
+        // Render only once the device has played enough to make room, however long that takes.
+        Common::CondvarWait(release_cv, lk, stop_token,
+                            [&] { return paused || queued_buffers < queue_size; });
+        return;
+    }
+
     release_cv.wait_for(lk, std::chrono::milliseconds(5),
-                        [this]() { return paused || queued_buffers < max_queue_size; });
+                        [&]() { return paused || queued_buffers < queue_size; });
     if (queued_buffers > max_queue_size + 3) {
         Common::CondvarWait(release_cv, lk, stop_token,
                             [this] { return paused || queued_buffers < max_queue_size; });
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
@@ -85,6 +86,14 @@ public:
         return paused;
     }
 
+    /**
+     * Check if everything appended to this stream is played as silence, either because a volume
+     * is zero or because nothing plays the stream.
+     *
+     * @return True if the stream is muted, otherwise false.
+     */
+    virtual bool IsMuted() const;
+
     /**
      * Get the number of system channels in this stream.
      *
@@ -157,13 +166,31 @@ public:
         return queued_buffers.load();
     }
 
+    /**
+     * Get the number of times the stream ran out of queued samples to play.
+     *
+     * @return The number of underruns since the stream was created.
+     */
+    u64 GetUnderrunCount() const {
+        return underrun_count.load();
+    }
+
     /**
      * Set the maximum buffer queue size.
      */
     void SetRingSize(u32 ring_size) {
         max_queue_size = ring_size;
+        target_queue_size = std::min(min_queue_size, ring_size);
     }
 
+    /**
+     * Set the number of frames the backend requests in each callback. In low latency mode this
+     * is the smallest amount of queued audio the stream aims to keep.
+     *
+     * @param frames - Frames per device period.
+     */
+    void SetDevicePeriod(u32 frames);
+
     /**
      * Append a new buffer and its samples to a waiting queue to play.
      *
@@ -211,7 +238,25 @@ public:
     /**
      * Waits for free space in the sample ring buffer
      */
-    void WaitFreeSpace(std::stop_token stop_token);
+    virtual void WaitFreeSpace(std::stop_token stop_token);
+
+private:
+    /**
+     * Pop queued frames into the output buffer, repeating the last frame when the queue underruns.
+     *
+     * @param output_buffer - Output buffer to be filled with frames.
+     * @param num_frames    - Number of frames to be filled.
+     * @return The number of frames popped from the queue.
+     */
+    size_t PopFrames(std::span<s16> output_buffer, size_t num_frames);
+
+    /**
+     * Adapt the target queue size of a low latency stream after a callback.
+     *
+     * @param underrun   - Whether the callback ran out of queued frames.
+     * @param num_frames - Number of frames the callback played.
+     */
+    void AdaptQueueSize(bool underrun, size_t num_frames);
 
 protected:
     /**
@@ -244,8 +289,18 @@ private:
     std::array<s16, MaxChannels> last_frame{};
     /// Number of buffers waiting to be played
     std::atomic<u32> queued_buffers{};
+    /// Number of times the callback ran out of queued samples to play
+    std::atomic<u64> underrun_count{};
     /// The ring size for audio out buffers (usually 4, rarely 2 or 8)
     u32 max_queue_size{};
+    /// Queue size the renderer is paced to, below max_queue_size in low latency mode
+    std::atomic<u32> target_queue_size{};
+    /// Smallest target queue size, enough buffers to cover one device period
+    u32 min_queue_size{1};
+    /// Frames played since the target queue size last changed
+    size_t frames_since_adapt{};
+    /// Frames popped from the queue before a callback stretches them to the device rate
+    std::vector<s16> stretch_buffer;
     /// Locks access to sample count tracking info
     std::mutex sample_count_lock;
     /// Minimum number of total samples that have been played since the last callback
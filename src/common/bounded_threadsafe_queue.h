@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -82,9 +83,11 @@ private:
         } else if constexpr (Mode == PushMode::Wait) {
             // Wait until we have free slots to write to.
             std::unique_lock lock{producer_cv_mutex};
+            m_producer_waiting.store(true);
             producer_cv.wait(lock, [this, write_index] {
-                return (write_index - m_read_index.load(std::memory_order::acquire)) < Capacity;
+                return (write_index - m_read_index.load()) < Capacity;
             });
+            m_producer_waiting.store(false, std::memory_order::relaxed);
         } else {
             static_assert(Mode < PushMode::Count, "Invalid PushMode.");
         }
@@ -98,9 +101,12 @@ private:
         // Increment the write index.
         ++m_write_index;
 
-        // Notify the consumer that we have pushed into the queue.
-        std::scoped_lock lock{consumer_cv_mutex};
-        consumer_cv.notify_one();
+        // Notify the consumer that we have pushed into the queue, only when it is asleep.
+        // Taking the lock on every push is a significant cost for busy queues.
+        if (m_consumer_waiting.load()) {
+            std::scoped_lock lock{consumer_cv_mutex};
+            consumer_cv.notify_one();
+        }
 
         return true;
     }
@@ -117,15 +123,19 @@ private:
         } else if constexpr (Mode == PopMode::Wait) {
             // Wait until the queue is not empty.
             std::unique_lock lock{consumer_cv_mutex};
+            m_consumer_waiting.store(true);
             consumer_cv.wait(lock, [this, read_index] {
-                return read_index != m_write_index.load(std::memory_order::acquire);
+                return read_index != m_write_index.load();
             });
+            m_consumer_waiting.store(false, std::memory_order::relaxed);
         } else if constexpr (Mode == PopMode::WaitWithStopToken) {
             // Wait until the queue is not empty.
             std::unique_lock lock{consumer_cv_mutex};
+            m_consumer_waiting.store(true);
             Common::CondvarWait(consumer_cv, lock, stop_token, [this, read_index] {
-                return read_index != m_write_index.load(std::memory_order::acquire);
+                return read_index != m_write_index.load();
             });
+            m_consumer_waiting.store(false, std::memory_order::relaxed);
             if (stop_token.stop_requested()) {
                 return false;
             }
@@ -142,17 +152,23 @@ private:
         // Increment the read index.
         ++m_read_index;
 
-        // Notify the producer that we have popped off the queue.
-        std::scoped_lock lock{producer_cv_mutex};
-        producer_cv.notify_one();
+        // Notify the producer that we have popped off the queue, only when it is asleep.
+        if (m_producer_waiting.load()) {
+            std::scoped_lock lock{producer_cv_mutex};
+            producer_cv.notify_one();
+        }
 
         return true;
     }
 
+    // The waiting flags and the indices are accessed with sequentially consistent ordering, so
+    // either the sleeping side observes the new index or the waking side observes the flag.
     alignas(128) std::atomic_size_t m_read_index{0};
+    std::atomic_bool m_consumer_waiting{false};
     alignas(128) std::atomic_size_t m_write_index{0};
+    std::atomic_bool m_producer_waiting{false};
 
-    std::array<T, Capacity> m_data;
+    alignas(128) std::array<T, Capacity> m_data;
 
     std::condition_variable_any producer_cv;
     std::mutex producer_cv_mutex;
@@ -160,90 +176,165 @@ private:
     std::mutex consumer_cv_mutex;
 };
 
+/**
+ * Lock-free bounded queue for any number of producers and consumers, after Dmitry Vyukov's bounded
+ * MPMC queue. Every slot holds a sequence number telling whether it is ready to be written or read
+ * in the current lap around the ring, so producers only contend on the write index and consumers
+ * on the read index. Blocking operations sleep on std::atomic::wait.
+ */
 template <typename T, size_t Capacity = detail::DefaultCapacity>
-class MPSCQueue {
+class MPMCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
 public:
+    MPMCQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order::relaxed);
+        }
+    }
+
     template <typename... Args>
     bool TryEmplace(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        return spsc_queue.TryEmplace(std::forward<Args>(args)...);
+        Slot* const slot = AcquireSlot<true>();
+        if (!slot) {
+            return false;
+        }
+        slot->value = T(std::forward<Args>(args)...);
+        ReleaseSlot<true>(*slot);
+        return true;
     }
 
     template <typename... Args>
     void EmplaceWait(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        spsc_queue.EmplaceWait(std::forward<Args>(args)...);
+        Slot* const slot = WaitSlot<true>({});
+        slot->value = T(std::forward<Args>(args)...);
+        ReleaseSlot<true>(*slot);
     }
 
     bool TryPop(T& t) {
-        return spsc_queue.TryPop(t);
+        Slot* const slot = AcquireSlot<false>();
+        if (!slot) {
+            return false;
+        }
+        t = std::move(slot->value);
+        ReleaseSlot<false>(*slot);
+        return true;
     }
 
     void PopWait(T& t) {
-        spsc_queue.PopWait(t);
+        PopWait(t, {});
     }
 
     void PopWait(T& t, std::stop_token stop_token) {
-        spsc_queue.PopWait(t, stop_token);
+        Slot* const slot = WaitSlot<false>(stop_token);
+        if (!slot) {
+            return;
+        }
+        t = std::move(slot->value);
+        ReleaseSlot<false>(*slot);
     }
 
     T PopWait() {
-        return spsc_queue.PopWait();
+        T t{};
+        PopWait(t);
+        return t;
     }
 
     T PopWait(std::stop_token stop_token) {
-        return spsc_queue.PopWait(stop_token);
+        T t{};
+        PopWait(t, stop_token);
+        return t;
     }
 
 private:
-    SPSCQueue<T, Capacity> spsc_queue;
-    std::mutex write_mutex;
-};
-
-template <typename T, size_t Capacity = detail::DefaultCapacity>
-class MPMCQueue {
-public:
-    template <typename... Args>
-    bool TryEmplace(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        return spsc_queue.TryEmplace(std::forward<Args>(args)...);
-    }
-
-    template <typename... Args>
-    void EmplaceWait(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        spsc_queue.EmplaceWait(std::forward<Args>(args)...);
-    }
-
-    bool TryPop(T& t) {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.TryPop(t);
-    }
+    struct alignas(64) Slot {
+        /// Position the slot can be written at, or the position plus one once it can be read
+        std::atomic_size_t sequence;
+        T value{};
+    };
 
-    void PopWait(T& t) {
-        std::scoped_lock lock{read_mutex};
-        spsc_queue.PopWait(t);
-    }
+    /// Side of the queue producers or consumers work on
+    struct alignas(128) Side {
+        std::atomic_size_t index{0};
+        /// Bumped when the other side frees or fills a slot while this side has waiters
+        std::atomic_uint32_t signal{0};
+        std::atomic_size_t num_waiting{0};
+    };
 
-    void PopWait(T& t, std::stop_token stop_token) {
-        std::scoped_lock lock{read_mutex};
-        spsc_queue.PopWait(t, stop_token);
+    /// Claims the next slot to write or read, returns null when the queue is full or empty
+    template <bool IsProducer>
+    Slot* AcquireSlot() {
+        Side& side = IsProducer ? m_producers : m_consumers;
+        size_t pos = side.index.load(std::memory_order::relaxed);
+        while (true) {
+            Slot& slot = m_slots[pos % Capacity];
+            const size_t sequence = slot.sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(IsProducer ? pos : pos + 1);
+            if (diff == 0) {
+                if (side.index.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed)) {
+                    return &slot;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = side.index.load(std::memory_order::relaxed);
+            }
+        }
     }
 
-    T PopWait() {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.PopWait();
+    /// Publishes a written or read slot to the other side, waking one of its waiters
+    template <bool IsProducer>
+    void ReleaseSlot(Slot& slot) {
+        const size_t sequence = slot.sequence.load(std::memory_order::relaxed);
+        slot.sequence.store(IsProducer ? sequence + 1 : sequence + Capacity - 1,
+                            std::memory_order::release);
+
+        // Pairs with the fence of a waiter, either it sees the slot or this sees it waiting
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        Side& other = IsProducer ? m_consumers : m_producers;
+        if (other.num_waiting.load() != 0) {
+            ++other.signal;
+            other.signal.notify_one();
+        }
     }
 
-    T PopWait(std::stop_token stop_token) {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.PopWait(stop_token);
+    /// Claims the next slot to write or read, sleeping until there is one or a stop is requested
+    template <bool IsProducer>
+    Slot* WaitSlot(std::stop_token stop_token) {
+        Side& side = IsProducer ? m_producers : m_consumers;
+        std::stop_callback callback(stop_token, [&side] {
+            ++side.signal;
+            side.signal.notify_all();
+        });
+        while (true) {
+            if (Slot* const slot = AcquireSlot<IsProducer>()) {
+                return slot;
+            }
+            const auto signal = side.signal.load();
+            ++side.num_waiting;
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            Slot* const slot = AcquireSlot<IsProducer>();
+            if (!slot && !stop_token.stop_requested()) {
+                side.signal.wait(signal);
+            }
+            --side.num_waiting;
+            if (slot) {
+                return slot;
+            }
+            if (stop_token.stop_requested()) {
+                return nullptr;
+            }
+        }
     }
 
-private:
-    SPSCQueue<T, Capacity> spsc_queue;
-    std::mutex write_mutex;
-    std::mutex read_mutex;
+    Side m_producers;
+    Side m_consumers;
+    std::array<Slot, Capacity> m_slots;
 };
 
+/// Producers of the MPMC queue do not hold a lock, so a single consumer costs nothing more
+template <typename T, size_t Capacity = detail::DefaultCapacity>
+using MPSCQueue = MPMCQueue<T, Capacity>;
+
 } // namespace Common
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/cpu_topology.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/thread.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+// Placements are always built for the four cores of the emulated system.
+constexpr size_t NumGuestCores = 4;
+
+struct LogicalCpu {
+    u32 id;
+    u64 physical_core;
+    u64 cache_domain;
+    u64 capacity;
+};
+
+#ifdef __linux__
+std::optional<u64> ReadSysfsValue(const std::string& path) {
+    std::ifstream file(path);
+    u64 value{};
+    if (!(file >> value)) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::vector<LogicalCpu> ReadTopology() {
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return {};
+    }
+    std::vector<LogicalCpu> cpus;
+    for (u32 id = 0; id < CPU_SETSIZE; id++) {
+        if (!CPU_ISSET(id, &allowed)) {
+            continue;
+        }
+        const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(id) + "/";
+        const auto core_id = ReadSysfsValue(base + "topology/core_id");
+        const auto package_id = ReadSysfsValue(base + "topology/physical_package_id");
+        if (!core_id || !package_id) {
+            return {};
+        }
+        // Big.LITTLE hosts report a normalized capacity, hybrid x86 parts only differ in their
+        // maximum frequency.
+        auto capacity = ReadSysfsValue(base + "cpu_capacity");
+        if (!capacity) {
+            capacity = ReadSysfsValue(base + "cpufreq/cpuinfo_max_freq");
+        }
+        const auto l3_id = ReadSysfsValue(base + "cache/index3/id");
+        cpus.push_back(LogicalCpu{
+            .id = id,
+            .physical_core = (*package_id << 32) | *core_id,
+            .cache_domain = l3_id ? *l3_id : *package_id,
+            .capacity = capacity.value_or(0),
+        });
+    }
+    return cpus;
+}
+#else
+std::vector<LogicalCpu> ReadTopology() {
+    return {};
+}
+#endif
+
+CpuPlacement BuildPlacement(const std::vector<LogicalCpu>& cpus, size_t num_guest_cores) {
+    struct PhysicalCore {
+        u32 first_cpu;
+        u64 cache_domain;
+        u64 capacity;
+    };
+    std::map<u64, PhysicalCore> physical_cores;
+    u64 max_capacity = 0;
+    for (const LogicalCpu& cpu : cpus) {
+        const auto [it, is_new] = physical_cores.try_emplace(
+            cpu.physical_core, PhysicalCore{cpu.id, cpu.cache_domain, cpu.capacity});
+        it->second.first_cpu = std::min(it->second.first_cpu, cpu.id);
+        max_capacity = std::max(max_capacity, cpu.capacity);
+    }
+    // Leave at least one physical core for the GPU thread and the rest of the host.
+    if (physical_cores.size() <= num_guest_cores) {
+        return {};
+    }
+
+    // Prefer the cache domain holding the most cores of the highest capacity.
+    std::map<u64, size_t> fast_cores_per_domain;
+    for (const auto& [key, core] : physical_cores) {
+        if (core.capacity == max_capacity) {
+            fast_cores_per_domain[core.cache_domain]++;
+        }
+    }
+    const u64 best_domain =
+        std::max_element(fast_cores_per_domain.begin(), fast_cores_per_domain.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })
+            ->first;
+
+    std::vector<PhysicalCore> sorted;
+    for (const auto& [key, core] : physical_cores) {
+        sorted.push_back(core);
+    }
+    std::ranges::stable_sort(sorted, [best_domain](const PhysicalCore& lhs,
+                                                   const PhysicalCore& rhs) {
+        if (lhs.capacity != rhs.capacity) {
+            return lhs.capacity > rhs.capacity;
+        }
+        return (lhs.cache_domain == best_domain) > (rhs.cache_domain == best_domain);
+    });
+
+    CpuPlacement placement;
+    for (size_t i = 0; i < num_guest_cores; i++) {
+        placement.guest_cores.push_back(sorted[i].first_cpu);
+    }
+
+    // Workers never share a physical core with an emulated core, SMT siblings included. They go
+    // to the remaining efficiency cores if there are any, otherwise to every remaining CPU.
+    std::vector<u64> guest_physical_cores;
+    for (const LogicalCpu& cpu : cpus) {
+        if (std::ranges::find(placement.guest_cores, cpu.id) != placement.guest_cores.end()) {
+            guest_physical_cores.push_back(cpu.physical_core);
+        }
+    }
+    const auto is_free = [&guest_physical_cores](const LogicalCpu& cpu) {
+        return std::ranges::find(guest_physical_cores, cpu.physical_core) ==
+               guest_physical_cores.end();
+    };
+    const bool has_free_efficiency_cores =
+        std::ranges::any_of(cpus, [&](const LogicalCpu& cpu) {
+            return is_free(cpu) && cpu.capacity < max_capacity;
+        });
+    for (const LogicalCpu& cpu : cpus) {
+        if (is_free(cpu) && (!has_free_efficiency_cores || cpu.capacity < max_capacity)) {
+            placement.workers.push_back(cpu.id);
+        }
+    }
+    return placement;
+}
+
+} // namespace
+
+const CpuPlacement& GetCpuPlacement() {
+    static const CpuPlacement placement = [] {
+        CpuPlacement result = BuildPlacement(ReadTopology(), NumGuestCores);
+        if (!result.guest_cores.empty()) {
+            LOG_INFO(Common, "Emulated cores placed on CPUs {}, workers on {} CPUs",
+                     fmt::join(result.guest_cores, ","), result.workers.size());
+        }
+        return result;
+    }();
+    return placement;
+}
+
+void PinCurrentThreadToGuestCore(size_t core_index) {
+    if (!Settings::values.pin_host_threads.GetValue()) {
+        return;
+    }
+    const CpuPlacement& placement = GetCpuPlacement();
+    if (core_index < placement.guest_cores.size()) {
+        SetCurrentThreadAffinity(std::span(&placement.guest_cores[core_index], 1));
+    }
+}
+
+void PinCurrentThreadToWorkers() {
+    if (!Settings::values.pin_host_threads.GetValue()) {
+        return;
+    }
+    SetCurrentThreadAffinity(GetCpuPlacement().workers);
+}
+
+} // namespace Common
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Placement of the host threads that matter for emulation performance.
+struct CpuPlacement {
+    /// One logical CPU per emulated core, each on a distinct physical core.
+    std::vector<u32> guest_cores;
+    /// Logical CPUs background workers such as shader builders are allowed to run on.
+    std::vector<u32> workers;
+};
+
+/**
+ * Builds a placement from the host topology.
+ *
+ * Emulated cores are put on the fastest physical cores, preferring a single last level cache
+ * domain, one SMT sibling each. Workers are kept on efficiency cores when the host has them,
+ * and on the CPUs left over otherwise. Lists are empty when the topology is unknown or too
+ * small for pinning to be worth it.
+ */
+[[nodiscard]] const CpuPlacement& GetCpuPlacement();
+
+/// Pins the current thread to the CPU of an emulated core when host thread pinning is enabled.
+void PinCurrentThreadToGuestCore(size_t core_index);
+
+/// Pins the current thread to the worker CPUs when host thread pinning is enabled.
+void PinCurrentThreadToWorkers();
+
+} // namespace Common
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include "common/fast_hash.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(__GNUC__) && defined(ARCHITECTURE_x86_64)
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+namespace Common::Detail {
+namespace {
+
+constexpr size_t LANES = 8;
+constexpr size_t STRIPE_SIZE = LANES * sizeof(u64);
+constexpr size_t STRIPES_PER_BLOCK = 16;
+constexpr size_t BLOCK_SIZE = STRIPE_SIZE * STRIPES_PER_BLOCK;
+
+constexpr u32 SCRAMBLE_PRIME = 0x9E3779B1U;
+
+/// Key words of the stripes, each stripe of a block uses the words starting one further along
+constexpr std::array<u64, STRIPES_PER_BLOCK + LANES> SECRET = [] {
+    std::array<u64, STRIPES_PER_BLOCK + LANES> secret{};
+    u64 state = FAST_HASH_PRIME0;
+    for (u64& word : secret) {
+        // SplitMix64
+        state += 0x9E3779B97F4A7C15ULL;
+        u64 value = state;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        word = value ^ (value >> 31);
+    }
+    return secret;
+}();
+
+/// Key words of the scramble between blocks
+constexpr const u64* SCRAMBLE_KEY = SECRET.data() + STRIPES_PER_BLOCK;
+
+/// Key words of the last stripe, misaligned from the key words of the full stripes
+constexpr const u64* LAST_STRIPE_KEY = SECRET.data() + 7;
+
+/*
+ * Every backend computes the same result: for each stripe, every lane accumulates the product of
+ * the halves of its data word mixed with its key word, plus the data word of its neighbour lane.
+ * After each block the accumulators are scrambled so the bits of the products do not stay in
+ * place.
+ */
+
+struct ScalarBackend {
+    static void Accumulate(u64* acc, const u8* data, size_t num_stripes, const u64* key) {
+        for (size_t stripe = 0; stripe < num_stripes; ++stripe) {
+            const u8* const stripe_data = data + stripe * STRIPE_SIZE;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                const u64 value = FastHashRead64(stripe_data + lane * sizeof(u64));
+                const u64 keyed = value ^ key[stripe + lane];
+                acc[lane ^ 1] += value;
+                acc[lane] += (keyed & 0xFFFFFFFFU) * (keyed >> 32);
+            }
+        }
+    }
+
+    static void Scramble(u64* acc) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            u64 value = acc[lane];
+            value ^= value >> 47;
+            value ^= SCRAMBLE_KEY[lane];
+            acc[lane] = value * SCRAMBLE_PRIME;
+        }
+    }
+};
+
+#if defined(ARCHITECTURE_x86_64)
+struct SSE2Backend {
+    static void Accumulate(u64* acc, const u8* data, size_t num_stripes, const u64* key) {
+        __m128i vacc[LANES / 2];
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            vacc[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc) + i);
+        }
+        for (size_t stripe = 0; stripe < num_stripes; ++stripe) {
+            const auto* const stripe_data =
+                reinterpret_cast<const __m128i*>(data + stripe * STRIPE_SIZE);
+            const auto* const stripe_key = reinterpret_cast<const __m128i*>(key + stripe);
+            for (size_t i = 0; i < std::size(vacc); ++i) {
+                const __m128i value = _mm_loadu_si128(stripe_data + i);
+                const __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128(stripe_key + i));
+                const __m128i high = _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+                const __m128i product = _mm_mul_epu32(keyed, high);
+                const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                vacc[i] = _mm_add_epi64(vacc[i], _mm_add_epi64(product, swapped));
+            }
+        }
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc) + i, vacc[i]);
+        }
+    }
+
+    static void Scramble(u64* acc) {
+        const __m128i prime = _mm_set1_epi32(static_cast<int>(SCRAMBLE_PRIME));
+        for (size_t i = 0; i < LANES / 2; ++i) {
+            auto* const lane = reinterpret_cast<__m128i*>(acc) + i;
+            __m128i value = _mm_loadu_si128(lane);
+            value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+            value = _mm_xor_si128(
+                value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(SCRAMBLE_KEY) + i));
+            const __m128i low = _mm_mul_epu32(value, prime);
+            const __m128i high = _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+            _mm_storeu_si128(lane, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+        }
+    }
+};
+
+struct AVX2Backend {
+    AVX2_TARGET static void Accumulate(u64* acc, const u8* data, size_t num_stripes,
+                                       const u64* key) {
+        __m256i vacc[LANES / 4];
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            vacc[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc) + i);
+        }
+        for (size_t stripe = 0; stripe < num_stripes; ++stripe) {
+            const auto* const stripe_data =
+                reinterpret_cast<const __m256i*>(data + stripe * STRIPE_SIZE);
+            const auto* const stripe_key = reinterpret_cast<const __m256i*>(key + stripe);
+            for (size_t i = 0; i < std::size(vacc); ++i) {
+                const __m256i value = _mm256_loadu_si256(stripe_data + i);
+                const __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256(stripe_key + i));
+                const __m256i high = _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+                const __m256i product = _mm256_mul_epu32(keyed, high);
+                const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                vacc[i] = _mm256_add_epi64(vacc[i], _mm256_add_epi64(product, swapped));
+            }
+        }
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc) + i, vacc[i]);
+        }
+    }
+
+    AVX2_TARGET static void Scramble(u64* acc) {
+        const __m256i prime = _mm256_set1_epi32(static_cast<int>(SCRAMBLE_PRIME));
+        for (size_t i = 0; i < LANES / 4; ++i) {
+            auto* const lane = reinterpret_cast<__m256i*>(acc) + i;
+            __m256i value = _mm256_loadu_si256(lane);
+            value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+            value = _mm256_xor_si256(
+                value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SCRAMBLE_KEY) + i));
+            const __m256i low = _mm256_mul_epu32(value, prime);
+            const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+            _mm256_storeu_si256(lane, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+        }
+    }
+};
+#elif defined(ARCHITECTURE_arm64)
+struct NEONBackend {
+    static void Accumulate(u64* acc, const u8* data, size_t num_stripes, const u64* key) {
+        uint64x2_t vacc[LANES / 2];
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            vacc[i] = vld1q_u64(acc + i * 2);
+        }
+        for (size_t stripe = 0; stripe < num_stripes; ++stripe) {
+            const u8* const stripe_data = data + stripe * STRIPE_SIZE;
+            for (size_t i = 0; i < std::size(vacc); ++i) {
+                const uint64x2_t value = vreinterpretq_u64_u8(vld1q_u8(stripe_data + i * 16));
+                const uint64x2_t keyed = veorq_u64(value, vld1q_u64(key + stripe + i * 2));
+                const uint64x2_t product = vmull_u32(vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+                const uint64x2_t swapped = vextq_u64(value, value, 1);
+                vacc[i] = vaddq_u64(vacc[i], vaddq_u64(product, swapped));
+            }
+        }
+        for (size_t i = 0; i < std::size(vacc); ++i) {
+            vst1q_u64(acc + i * 2, vacc[i]);
+        }
+    }
+
+    static void Scramble(u64* acc) {
+        const uint32x2_t prime = vdup_n_u32(SCRAMBLE_PRIME);
+        for (size_t i = 0; i < LANES / 2; ++i) {
+            uint64x2_t value = vld1q_u64(acc + i * 2);
+            value = veorq_u64(value, vshrq_n_u64(value, 47));
+            value = veorq_u64(value, vld1q_u64(SCRAMBLE_KEY + i * 2));
+            const uint64x2_t low = vmull_u32(vmovn_u64(value), prime);
+            const uint64x2_t high = vmull_u32(vshrn_n_u64(value, 32), prime);
+            vst1q_u64(acc + i * 2, vaddq_u64(low, vshlq_n_u64(high, 32)));
+        }
+    }
+};
+#endif
+
+template <typename Backend>
+u64 HashLong(const u8* data, size_t size) {
+    std::array<u64, LANES> acc{
+        0xC2B2AE3DU,      FAST_HASH_PRIME0, FAST_HASH_PRIME1, FAST_HASH_PRIME2,
+        FAST_HASH_PRIME3, 0x85EBCA77U,      FAST_HASH_PRIME4, 0x9E3779B1U,
+    };
+    // The last stripe is always hashed on its own, even when it ends a block
+    const size_t num_blocks = (size - 1) / BLOCK_SIZE;
+    for (size_t block = 0; block < num_blocks; ++block) {
+        Backend::Accumulate(acc.data(), data + block * BLOCK_SIZE, STRIPES_PER_BLOCK,
+                            SECRET.data());
+        Backend::Scramble(acc.data());
+    }
+    const size_t num_stripes = ((size - 1) - num_blocks * BLOCK_SIZE) / STRIPE_SIZE;
+    Backend::Accumulate(acc.data(), data + num_blocks * BLOCK_SIZE, num_stripes, SECRET.data());
+    Backend::Accumulate(acc.data(), data + size - STRIPE_SIZE, 1, LAST_STRIPE_KEY);
+
+    u64 result = size * FAST_HASH_PRIME0;
+    for (size_t lane = 0; lane < LANES; lane += 2) {
+        result += FastHashMix(acc[lane] ^ SECRET[lane + 3], acc[lane + 1] ^ SECRET[lane + 4]);
+    }
+    result ^= result >> 37;
+    result *= 0x165667919E3779F9ULL;
+    return result ^ (result >> 32);
+}
+
+using HashLongFunc = u64 (*)(const u8*, size_t);
+
+HashLongFunc SelectHashLong() {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().avx2) {
+        return HashLong<AVX2Backend>;
+    }
+    return HashLong<SSE2Backend>;
+#elif defined(ARCHITECTURE_arm64)
+    return HashLong<NEONBackend>;
+#else
+    return HashLong<ScalarBackend>;
+#endif
+}
+
+} // Anonymous namespace
+
+u64 FastHashLong(const u8* data, size_t size) {
+    static const HashLongFunc hash_long = SelectHashLong();
+    return hash_long(data, size);
+}
+
+} // namespace Common::Detail
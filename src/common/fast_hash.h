@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "common/common_types.h"
+#include "common/uint128.h"
+
+namespace Common {
+
+/**
+ * Hashes used for cache keys and shader identities. Short inputs go through a multiply-mix hash
+ * inlined into the callers, long blobs through a striped hash with SIMD accumulators.
+ *
+ * The results are the same on every host. They are not compatible with CityHash, and anything
+ * persisting them must version its format so a change of algorithm invalidates the old files.
+ * None of these hashes are suitable for cryptography.
+ */
+
+namespace Detail {
+
+/// Largest input hashed by the short path, longer inputs use the striped path
+constexpr size_t FAST_HASH_SHORT_MAX = 256;
+
+constexpr u64 FAST_HASH_PRIME0 = 0x9E3779B185EBCA87ULL;
+constexpr u64 FAST_HASH_PRIME1 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 FAST_HASH_PRIME2 = 0x165667B19E3779F9ULL;
+constexpr u64 FAST_HASH_PRIME3 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 FAST_HASH_PRIME4 = 0x27D4EB2F165667C5ULL;
+
+[[nodiscard]] inline u64 FastHashRead64(const u8* data) {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+[[nodiscard]] inline u64 FastHashRead32(const u8* data) {
+    u32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/// Folds the 128-bit product of two words into 64 bits
+[[nodiscard]] inline u64 FastHashMix(u64 a, u64 b) {
+    const u128 product = Multiply64Into128(a, b);
+    return product[0] ^ product[1];
+}
+
+[[nodiscard]] inline u64 FastHashShort(const u8* data, size_t size) {
+    u64 seed = FAST_HASH_PRIME4;
+    u64 a;
+    u64 b;
+    if (size <= 16) {
+        if (size >= 8) {
+            a = FastHashRead64(data);
+            b = FastHashRead64(data + size - 8);
+        } else if (size >= 4) {
+            a = FastHashRead32(data);
+            b = FastHashRead32(data + size - 4);
+        } else if (size > 0) {
+            a = (u64{data[0]} << 16) | (u64{data[size >> 1]} << 8) | u64{data[size - 1]};
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t remaining = size;
+        if (remaining > 48) {
+            // Three independent chains keep the multipliers busy
+            u64 seed1 = seed;
+            u64 seed2 = seed;
+            do {
+                seed = FastHashMix(FastHashRead64(data) ^ FAST_HASH_PRIME1,
+                                   FastHashRead64(data + 8) ^ seed);
+                seed1 = FastHashMix(FastHashRead64(data + 16) ^ FAST_HASH_PRIME2,
+                                    FastHashRead64(data + 24) ^ seed1);
+                seed2 = FastHashMix(FastHashRead64(data + 32) ^ FAST_HASH_PRIME3,
+                                    FastHashRead64(data + 40) ^ seed2);
+                data += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = FastHashMix(FastHashRead64(data) ^ FAST_HASH_PRIME1,
+                               FastHashRead64(data + 8) ^ seed);
+            data += 16;
+            remaining -= 16;
+        }
+        // The last 16 bytes, overlapping the previous chunk when the size is not a multiple
+        a = FastHashRead64(data + remaining - 16);
+        b = FastHashRead64(data + remaining - 8);
+    }
+    const u128 product = Multiply64Into128(a ^ FAST_HASH_PRIME1, b ^ seed);
+    return FastHashMix(product[0] ^ FAST_HASH_PRIME0 ^ size, product[1] ^ FAST_HASH_PRIME1);
+}
+
+/// Hashes inputs longer than FAST_HASH_SHORT_MAX
+[[nodiscard]] u64 FastHashLong(const u8* data, size_t size);
+
+} // namespace Detail
+
+/// Hashes a blob of bytes of any size
+[[nodiscard]] inline u64 FastHash64(const void* data, size_t size) {
+    const auto* const bytes = static_cast<const u8*>(data);
+    if (size <= Detail::FAST_HASH_SHORT_MAX) {
+        return Detail::FastHashShort(bytes, size);
+    }
+    return Detail::FastHashLong(bytes, size);
+}
+
+/// Hashes the bytes of a fixed size key, the size checks of small keys fold away when inlined
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+[[nodiscard]] inline u64 FastHash64(const T& key) {
+    const auto* const bytes = reinterpret_cast<const u8*>(&key);
+    if constexpr (sizeof(T) <= Detail::FAST_HASH_SHORT_MAX) {
+        return Detail::FastHashShort(bytes, sizeof(T));
+    } else {
+        return Detail::FastHashLong(bytes, sizeof(T));
+    }
+}
+
+} // namespace Common
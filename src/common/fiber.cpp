@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <mutex>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/fiber.h"
@@ -13,9 +14,60 @@ namespace Common {
 
 constexpr std::size_t default_stack_size = 512 * 1024;
 
+// Large enough to cover a host page on every supported platform (up to 64 KiB on some ARM64
+// kernels). Stacks grow downwards, so the guard sits below the usable region.
+constexpr std::size_t stack_guard_size = 64 * 1024;
+
+namespace {
+/// Recycles fiber stacks, as guest thread creation would otherwise map and unmap two stacks
+/// every time a host context is created.
+class FiberStackPool {
+public:
+    VirtualBuffer<u8> Acquire() {
+        {
+            std::scoped_lock lk{mutex};
+            if (!free_stacks.empty()) {
+                VirtualBuffer<u8> stack{std::move(free_stacks.back())};
+                free_stacks.pop_back();
+                return stack;
+            }
+        }
+        VirtualBuffer<u8> stack(stack_guard_size + default_stack_size);
+        ProtectGuardPages(stack.data(), stack_guard_size);
+        return stack;
+    }
+
+    void Release(VirtualBuffer<u8>&& stack) {
+        if (stack.data() == nullptr) {
+            return;
+        }
+        std::scoped_lock lk{mutex};
+        if (free_stacks.size() < max_free_stacks) {
+            free_stacks.push_back(std::move(stack));
+        }
+    }
+
+private:
+    static constexpr std::size_t max_free_stacks = 64;
+
+    std::mutex mutex;
+    std::vector<VirtualBuffer<u8>> free_stacks;
+};
+
+FiberStackPool& GetStackPool() {
+    static FiberStackPool pool;
+    return pool;
+}
+} // Anonymous namespace
+
 struct Fiber::FiberImpl {
-    FiberImpl() : stack{default_stack_size}, rewind_stack{default_stack_size} {}
+    ~FiberImpl() {
+        GetStackPool().Release(std::move(stack));
+        GetStackPool().Release(std::move(rewind_stack));
+    }
 
+    // Thread fibers run on their host thread's stack and never allocate these. The rewind stack
+    // is only allocated once a rewind point is set.
     VirtualBuffer<u8> stack;
     VirtualBuffer<u8> rewind_stack;
 
@@ -33,6 +85,10 @@ struct Fiber::FiberImpl {
 };
 
 void Fiber::SetRewindPoint(std::function<void()>&& rewind_func) {
+    if (impl->rewind_stack.data() == nullptr) {
+        impl->rewind_stack = GetStackPool().Acquire();
+        impl->rewind_stack_limit = impl->rewind_stack.data() + stack_guard_size;
+    }
     impl->rewind_point = std::move(rewind_func);
 }
 
@@ -68,11 +124,11 @@ void Fiber::RewindStartFunc(boost::context::detail::transfer_t transfer) {
 
 Fiber::Fiber(std::function<void()>&& entry_point_func) : impl{std::make_unique<FiberImpl>()} {
     impl->entry_point = std::move(entry_point_func);
-    impl->stack_limit = impl->stack.data();
-    impl->rewind_stack_limit = impl->rewind_stack.data();
+    impl->stack = GetStackPool().Acquire();
+    impl->stack_limit = impl->stack.data() + stack_guard_size;
     u8* stack_base = impl->stack_limit + default_stack_size;
     impl->context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), FiberStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, FiberStartFunc);
 }
 
 Fiber::Fiber() : impl{std::make_unique<FiberImpl>()} {}
@@ -103,7 +159,7 @@ void Fiber::Rewind() {
     ASSERT(impl->rewind_context == nullptr);
     u8* stack_base = impl->rewind_stack_limit + default_stack_size;
     impl->rewind_context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), RewindStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, RewindStartFunc);
     boost::context::detail::jump_fcontext(impl->rewind_context, this);
 }
 
@@ -557,8 +557,15 @@ constexpr FixedPoint<I, F> operator*(FixedPoint<I, F> lhs, Number rhs) {
 }
 template <size_t I, size_t F, IsArithmetic Number>
 constexpr FixedPoint<I, F> operator/(FixedPoint<I, F> lhs, Number rhs) {
-    lhs /= FixedPoint<I, F>(rhs);
-    return lhs;
+    if constexpr (std::is_integral_v<Number>) {
+        // the fractional scaling of both sides cancels out, so divide the raw value directly
+        // rather than going through the double width (or bitwise) division
+        using base_type = typename FixedPoint<I, F>::base_type;
+        return FixedPoint<I, F>::from_base(lhs.to_raw() / static_cast<base_type>(rhs));
+    } else {
+        lhs /= FixedPoint<I, F>(rhs);
+        return lhs;
+    }
 }
 
 template <size_t I, size_t F, IsArithmetic Number>
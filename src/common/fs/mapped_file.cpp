@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "common/fs/fs_util.h"
+#include "common/fs/mapped_file.h"
+#ifdef ANDROID
+#include "common/fs/fs_android.h"
+#endif
+#include "common/logging/log.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Common::FS {
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    // Other handles may have the file open for writing (e.g. caches that are mapped while they
+    // are being filled in), so do not deny write sharing.
+    const HANDLE file =
+        CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={}, error={}",
+                  PathToUTF8String(path), GetLastError());
+        return;
+    }
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to create a mapping of path={}, error={}",
+                  PathToUTF8String(path), GetLastError());
+        return;
+    }
+
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to map a view of path={}, error={}",
+                  PathToUTF8String(path), GetLastError());
+        return;
+    }
+
+    data = static_cast<const u8*>(view);
+    size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+#ifdef ANDROID
+    const auto path_string = PathToUTF8String(path);
+    const int fd = Android::IsContentUri(path_string)
+                       ? Android::OpenContentUri(path_string, Android::OpenMode::Read)
+                       : open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+    if (fd == -1) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={}, error={}",
+                  PathToUTF8String(path), strerror(errno));
+        return;
+    }
+
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+
+    const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+    void* const view = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const auto error_num = errno;
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to map path={}, error={}", PathToUTF8String(path),
+                  strerror(error_num));
+        return;
+    }
+
+    data = static_cast<const u8*>(view);
+    size = file_size;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)} {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+    }
+    return *this;
+}
+
+void MappedFile::Close() {
+    if (!IsOpen()) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<u8*>(data), size);
+#endif
+
+    data = nullptr;
+    size = 0;
+}
+
+} // namespace Common::FS
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * A read-only view of an entire file mapped into the address space of the process.
+ * The file handle is released once the mapping has been established, so a MappedFile does not
+ * count against any open file limits.
+ */
+class MappedFile final {
+public:
+    MappedFile();
+
+    /**
+     * Maps the file at path for reading.
+     * On failure (including zero-sized files), IsOpen() returns false.
+     *
+     * @param path Filesystem path
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Unmaps the file, if mapped.
+     */
+    void Close();
+
+    /**
+     * Checks whether the file is mapped.
+     *
+     * @returns True if the file is mapped, false otherwise.
+     */
+    [[nodiscard]] bool IsOpen() const {
+        return data != nullptr;
+    }
+
+    /**
+     * Gets the mapped contents of the file.
+     *
+     * @returns A span over the mapped file, empty if the file is not mapped.
+     */
+    [[nodiscard]] std::span<const u8> Data() const {
+        return {data, size};
+    }
+
+    /**
+     * Gets the size of the mapped file.
+     *
+     * @returns The size of the mapped file in bytes.
+     */
+    [[nodiscard]] std::size_t Size() const {
+        return size;
+    }
+
+private:
+    const u8* data{};
+    std::size_t size{};
+};
+
+} // namespace Common::FS
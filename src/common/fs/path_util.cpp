@@ -80,6 +80,11 @@ public:
     }
 
     void SetYuzuPathImpl(YuzuPath yuzu_path, const fs::path& new_path) {
+        // Save data moves along with the NAND unless it was given its own directory
+        if (yuzu_path == YuzuPath::NANDDir &&
+            yuzu_paths[YuzuPath::SaveDir] == yuzu_paths[YuzuPath::NANDDir]) {
+            yuzu_paths.insert_or_assign(YuzuPath::SaveDir, new_path);
+        }
         yuzu_paths.insert_or_assign(yuzu_path, new_path);
     }
 
@@ -125,6 +130,7 @@ public:
         GenerateYuzuPath(YuzuPath::LoadDir, yuzu_path / LOAD_DIR);
         GenerateYuzuPath(YuzuPath::LogDir, yuzu_path / LOG_DIR);
         GenerateYuzuPath(YuzuPath::NANDDir, yuzu_path / NAND_DIR);
+        GenerateYuzuPath(YuzuPath::SaveDir, yuzu_path / NAND_DIR);
         GenerateYuzuPath(YuzuPath::PlayTimeDir, yuzu_path / PLAY_TIME_DIR);
         GenerateYuzuPath(YuzuPath::ScreenshotsDir, yuzu_path / SCREENSHOTS_DIR);
         GenerateYuzuPath(YuzuPath::SDMCDir, yuzu_path / SDMC_DIR);
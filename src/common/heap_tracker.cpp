@@ -11,6 +11,12 @@ namespace Common {
 
 namespace {
 
+// Mappings that were faulted back in after an eviction survive this many rebuilds.
+constexpr u8 MaxFrequency = 3;
+
+// Upper bound on the number of adjacent non-resident mappings mapped together on a fault.
+constexpr size_t MaxBatchedMappings = 16;
+
 s64 GetMaxPermissibleResidentMapCount() {
     // Default value.
     s64 value = 65530;
@@ -159,7 +165,11 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
 
 bool HeapTracker::DeferredMapSeparateHeap(u8* fault_address) {
     if (m_buffer.IsInVirtualRange(fault_address)) {
-        return this->DeferredMapSeparateHeap(fault_address - m_buffer.VirtualBasePointer());
+        if (!this->DeferredMapSeparateHeap(fault_address - m_buffer.VirtualBasePointer())) {
+            return false;
+        }
+        m_fault_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
     }
 
     return false;
@@ -177,21 +187,43 @@ bool HeapTracker::DeferredMapSeparateHeap(size_t virtual_offset) {
             return false;
         }
 
-        // Update tick before possible rebuild.
-        it->tick = m_tick++;
-
         // Check if we need to rebuild.
         if (m_resident_map_count > m_max_resident_map_count) {
             rebuild_required = true;
         }
 
+        // Gather the following non-resident mappings that are contiguous in both address
+        // spaces. The host merges them into a single mapping, so they are mapped together.
+        auto last = it;
+        size_t length = it->size;
+        for (size_t i = 1; i < MaxBatchedMappings; i++) {
+            const auto next = std::next(last);
+            if (next == m_mappings.end() || next->is_resident || next->perm != it->perm ||
+                next->vaddr != it->vaddr + length || next->paddr != it->paddr + length) {
+                break;
+            }
+            length += next->size;
+            last = next;
+        }
+
         // Map the area.
-        m_buffer.Map(it->vaddr, it->paddr, it->size, it->perm, false);
+        m_buffer.Map(it->vaddr, it->paddr, length, it->perm, false);
 
-        // This map is now resident.
-        it->is_resident = true;
-        m_resident_map_count++;
-        m_resident_mappings.insert(*it);
+        // These maps are now resident.
+        for (auto cur = it;; ++cur) {
+            // Mappings that keep coming back after being evicted are given a second chance.
+            if (cur->is_evicted && cur->frequency < MaxFrequency) {
+                cur->frequency++;
+            }
+            cur->is_evicted = false;
+            cur->tick = m_tick++;
+            cur->is_resident = true;
+            m_resident_map_count++;
+            m_resident_mappings.insert(*cur);
+            if (cur == last) {
+                break;
+            }
+        }
     }
 
     if (rebuild_required) {
@@ -214,17 +246,56 @@ void HeapTracker::RebuildSeparateHeapAddressSpace() {
     // lock contention.
     const size_t desired_count = std::min(m_resident_map_count, m_max_resident_map_count) / 2;
     const size_t evict_count = m_resident_map_count - desired_count;
-    auto it = m_resident_mappings.begin();
+    size_t evicted = 0;
+
+    // Evict the least recently used mappings first, skipping over the ones that were faulted
+    // back in recently after an eviction. Skipped mappings lose some of their credit, and if
+    // not enough mappings were evicted the second pass ignores the credit entirely.
+    for (int pass = 0; pass < 2 && evicted < evict_count; pass++) {
+        auto it = m_resident_mappings.begin();
+        while (evicted < evict_count && it != m_resident_mappings.end()) {
+            auto& map = *it;
+            ++it;
+            if (pass == 0 && map.frequency > 0) {
+                map.frequency--;
+                continue;
+            }
+            this->EvictLocked(map);
+            evicted++;
+        }
+    }
 
-    for (size_t i = 0; i < evict_count && it != m_resident_mappings.end(); i++) {
-        // Unmark and unmap.
-        it->is_resident = false;
-        m_buffer.Unmap(it->vaddr, it->size, false);
+    m_eviction_count += evicted;
 
-        // Advance.
-        ASSERT(--m_resident_map_count >= 0);
-        it = m_resident_mappings.erase(it);
-    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double>(now - m_last_rebuild).count();
+    m_last_rebuild = now;
+    LOG_DEBUG(HW_Memory,
+              "Evicted {} separate heap mappings ({:.1f}/s), {} of {} mappings resident, "
+              "{} faults handled",
+              evicted, static_cast<double>(evicted) / std::max(elapsed, 1e-3),
+              m_resident_map_count, m_map_count, m_fault_count.load(std::memory_order_relaxed));
+}
+
+void HeapTracker::EvictLocked(SeparateHeapMap& map) {
+    // Unmark and unmap.
+    map.is_resident = false;
+    map.is_evicted = true;
+    m_buffer.Unmap(map.vaddr, map.size, false);
+
+    ASSERT(--m_resident_map_count >= 0);
+    m_resident_mappings.erase(m_resident_mappings.iterator_to(map));
+}
+
+HeapTrackerStats HeapTracker::GetStats() {
+    std::scoped_lock lk{m_lock};
+
+    return HeapTrackerStats{
+        .map_count = m_map_count,
+        .resident_map_count = m_resident_map_count,
+        .evictions = m_eviction_count,
+        .faults_handled = m_fault_count.load(std::memory_order_relaxed),
+    };
 }
 
 void HeapTracker::SplitHeapMap(VAddr offset, size_t size) {
@@ -256,7 +327,9 @@ void HeapTracker::SplitHeapMapLocked(VAddr offset) {
         .size = orig_size - left_size,
         .tick = left->tick,
         .perm = left->perm,
+        .frequency = left->frequency,
         .is_resident = left->is_resident,
+        .is_evicted = left->is_evicted,
     };
 
     // Insert the new right map.
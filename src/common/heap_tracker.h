@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
@@ -21,7 +22,9 @@ struct SeparateHeapMap {
     size_t size{};
     size_t tick{};
     MemoryPermission perm{};
+    u8 frequency{};
     bool is_resident{};
+    bool is_evicted{};
 };
 
 struct SeparateHeapMapAddrComparator {
@@ -48,6 +51,13 @@ struct SeparateHeapMapTickComparator {
     }
 };
 
+struct HeapTrackerStats {
+    s64 map_count{};
+    s64 resident_map_count{};
+    u64 evictions{};
+    u64 faults_handled{};
+};
+
 class HeapTracker {
 public:
     explicit HeapTracker(Common::HostMemory& buffer);
@@ -64,6 +74,9 @@ public:
     bool DeferredMapSeparateHeap(u8* fault_address);
     bool DeferredMapSeparateHeap(size_t virtual_offset);
 
+    /// Returns a snapshot of the mapping counters, evictions and faults are cumulative.
+    HeapTrackerStats GetStats();
+
 private:
     using AddrTreeTraits =
         Common::IntrusiveRedBlackTreeMemberTraitsDeferredAssert<&SeparateHeapMap::addr_node>;
@@ -83,6 +96,7 @@ private:
     AddrTree::iterator GetNearestHeapMapLocked(VAddr offset);
 
     void RebuildSeparateHeapAddressSpace();
+    void EvictLocked(SeparateHeapMap& map);
 
 private:
     Common::HostMemory& m_buffer;
@@ -93,6 +107,9 @@ private:
     s64 m_map_count{};
     s64 m_resident_map_count{};
     size_t m_tick{};
+    u64 m_eviction_count{};
+    std::atomic<u64> m_fault_count{};
+    std::chrono::steady_clock::time_point m_last_rebuild{};
 };
 
 } // namespace Common
@@ -14,6 +14,9 @@
 #ifndef _GNU_SOURCE
 #define _GNU_SOURCE
 #endif
+#include <cstdlib>
+#include <fstream>
+#include <string>
 #include <boost/icl/interval_set.hpp>
 #include <fcntl.h>
 #include <sys/mman.h>
@@ -199,6 +202,16 @@ public:
         UNREACHABLE();
     }
 
+    bool EnableHugePages() {
+        // Large page sections can't be split into the 4K placeholder views used by guest
+        // mappings
+        return false;
+    }
+
+    size_t HugePageMappedSize() const {
+        return 0;
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -511,6 +524,10 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+        if (use_huge_pages) {
+            AdviseHugePages(virtual_base + virtual_offset, host_offset, length);
+        }
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -566,6 +583,48 @@ public:
         virtual_base = nullptr;
     }
 
+    bool EnableHugePages() {
+#ifdef __linux__
+        // Memory file mappings only get transparent huge pages when shmem THP is enabled
+        std::ifstream shmem_enabled("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+        std::string policy;
+        std::getline(shmem_enabled, policy);
+        if (policy.find("[never]") != std::string::npos ||
+            policy.find("[deny]") != std::string::npos || policy.empty()) {
+            LOG_WARNING(HW_Memory, "Transparent huge pages are disabled for shared memory, "
+                                   "guest memory will use 4K pages");
+            return false;
+        }
+        if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+            LOG_WARNING(HW_Memory, "madvise(MADV_HUGEPAGE) failed: {}", strerror(errno));
+            return false;
+        }
+        use_huge_pages = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    size_t HugePageMappedSize() const {
+#ifdef __linux__
+        // Shared memory mapped with huge page table entries, this covers the whole process
+        std::ifstream smaps("/proc/self/smaps_rollup");
+        std::string line;
+        while (std::getline(smaps, line)) {
+            if (!line.starts_with("ShmemPmdMapped:")) {
+                continue;
+            }
+            const size_t digits = line.find_first_of("0123456789");
+            if (digits == std::string::npos) {
+                return 0;
+            }
+            return std::strtoull(line.c_str() + digits, nullptr, 10) * 1024;
+        }
+#endif
+        return 0;
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -613,7 +672,24 @@ private:
         }
     }
 
+    /// Advises huge pages on the 2 MiB blocks of a mapping that share the alignment of the backing
+    void AdviseHugePages(u8* pointer, size_t host_offset, size_t length) {
+#ifdef __linux__
+        const uintptr_t base = reinterpret_cast<uintptr_t>(pointer);
+        if ((base - host_offset) % HugePageSize != 0) {
+            // Virtual and backing offsets are not congruent, the kernel can't use huge pages
+            return;
+        }
+        const uintptr_t begin = Common::AlignUp(base, HugePageSize);
+        const uintptr_t end = Common::AlignDown(base + length, HugePageSize);
+        if (begin < end) {
+            madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
+    bool use_huge_pages{};
     FreeRegionManager free_manager{};
 };
 
@@ -639,13 +715,21 @@ public:
 
     void EnableDirectMappedAddress() {}
 
+    bool EnableHugePages() {
+        return false;
+    }
+
+    size_t HugePageMappedSize() const {
+        return 0;
+    }
+
     u8* backing_base{nullptr};
     u8* virtual_base{nullptr};
 };
 
 #endif // ^^^ Generic ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
@@ -663,6 +747,12 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
             virtual_base_offset = virtual_base - impl->virtual_base;
         }
 
+        if (use_huge_pages) {
+            huge_pages = impl->EnableHugePages();
+            LOG_INFO(HW_Memory, "Huge page backing for guest memory {}",
+                     huge_pages ? "enabled" : "unavailable, falling back to 4K pages");
+        }
+
     } catch (const std::bad_alloc&) {
         LOG_CRITICAL(HW_Memory,
                      "Fastmem unavailable, falling back to VirtualBuffer for memory allocation");
@@ -672,7 +762,12 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
     }
 }
 
-HostMemory::~HostMemory() = default;
+HostMemory::~HostMemory() {
+    if (huge_pages && impl) {
+        LOG_INFO(HW_Memory, "Guest memory mapped with huge pages: {} MiB",
+                 impl->HugePageMappedSize() >> 20);
+    }
+}
 
 HostMemory::HostMemory(HostMemory&&) noexcept = default;
 
@@ -720,6 +815,10 @@ void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 f
     }
 }
 
+size_t HostMemory::HugePageMappedSize() const {
+    return huge_pages && impl ? impl->HugePageMappedSize() : 0;
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
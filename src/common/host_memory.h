@@ -24,7 +24,13 @@ DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    /**
+     * Allocates the backing memory and reserves the virtual range used for fastmem.
+     *
+     * @param use_huge_pages Back guest memory with 2 MiB pages where the mappings allow it,
+     *                       falls back to 4K pages when the host doesn't support it.
+     */
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages = false);
     ~HostMemory();
 
     /**
@@ -51,6 +57,14 @@ public:
 
     void ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value);
 
+    /// Returns true when guest memory is backed by huge pages
+    [[nodiscard]] bool IsHugePageBacked() const noexcept {
+        return huge_pages;
+    }
+
+    /// Returns the amount of memory the host currently maps with huge pages
+    [[nodiscard]] size_t HugePageMappedSize() const;
+
     [[nodiscard]] u8* BackingBasePointer() noexcept {
         return backing_base;
     }
@@ -79,6 +93,7 @@ private:
     u8* backing_base{};
     u8* virtual_base{};
     size_t virtual_base_offset{};
+    bool huge_pages{};
 
     // Fallback if fastmem is not supported on this platform
     std::unique_ptr<Common::VirtualBuffer<u8>> fallback_buffer;
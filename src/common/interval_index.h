@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <map>
+#include <type_traits>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Index of half-open intervals answering overlap queries.
+ *
+ * Intervals are bucketed by the power of two class of their length, each class being sorted by
+ * start address. An interval of class N is shorter than 2^(N+1), so a query only has to look at
+ * starts in [begin - 2^(N+1), end) on each non-empty class, instead of every interval or every
+ * page covered by the query.
+ */
+template <typename AddrT, typename IdT>
+class IntervalIndex {
+    static_assert(std::is_unsigned_v<AddrT>);
+
+public:
+    /// Adds [begin, end) with the given id, empty intervals are ignored
+    void Insert(AddrT begin, AddrT end, IdT id) {
+        if (begin >= end) {
+            return;
+        }
+        const size_t length_class = LengthClass(begin, end);
+        buckets[length_class].emplace(begin, Entry{end, id});
+        non_empty_mask |= u64{1} << length_class;
+        ++num_intervals;
+    }
+
+    /// Removes an interval previously added with the same arguments
+    void Erase(AddrT begin, AddrT end, IdT id) {
+        if (begin >= end) {
+            return;
+        }
+        const size_t length_class = LengthClass(begin, end);
+        auto& bucket = buckets[length_class];
+        auto [it, it_end] = bucket.equal_range(begin);
+        for (; it != it_end; ++it) {
+            if (it->second.end == end && it->second.id == id) {
+                break;
+            }
+        }
+        if (it == it_end) {
+            ASSERT_MSG(false, "Erasing unregistered interval 0x{:x}-0x{:x}", begin, end);
+            return;
+        }
+        bucket.erase(it);
+        if (bucket.empty()) {
+            non_empty_mask &= ~(u64{1} << length_class);
+        }
+        --num_intervals;
+    }
+
+    /// Calls func(begin, end, id) for each interval overlapping [begin, end).
+    /// Intervals are visited grouped by length class, not in address order.
+    template <typename Func>
+    void ForEachOverlapping(AddrT begin, AddrT end, Func&& func) const {
+        if (begin >= end) {
+            return;
+        }
+        u64 mask = non_empty_mask;
+        while (mask != 0) {
+            const size_t length_class = static_cast<size_t>(std::countr_zero(mask));
+            mask &= mask - 1;
+
+            // Intervals starting at or before begin - max_length end before begin
+            const AddrT max_length = MaxLength(length_class);
+            const AddrT first_start = begin > max_length ? begin - max_length + 1 : 0;
+            const auto& bucket = buckets[length_class];
+            for (auto it = bucket.lower_bound(first_start); it != bucket.end(); ++it) {
+                if (it->first >= end) {
+                    break;
+                }
+                if (it->second.end > begin) {
+                    func(it->first, it->second.end, it->second.id);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return num_intervals == 0;
+    }
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return num_intervals;
+    }
+
+private:
+    static constexpr size_t NUM_CLASSES = std::numeric_limits<AddrT>::digits;
+    static_assert(NUM_CLASSES <= 64);
+
+    struct Entry {
+        AddrT end;
+        IdT id;
+    };
+
+    static size_t LengthClass(AddrT begin, AddrT end) {
+        return static_cast<size_t>(std::bit_width(static_cast<AddrT>(end - begin))) - 1;
+    }
+
+    /// Longest length of an interval in the class
+    static AddrT MaxLength(size_t length_class) {
+        if (length_class + 1 >= NUM_CLASSES) {
+            return std::numeric_limits<AddrT>::max();
+        }
+        return static_cast<AddrT>((AddrT{1} << (length_class + 1)) - 1);
+    }
+
+    std::array<std::multimap<AddrT, Entry>, NUM_CLASSES> buckets;
+    u64 non_empty_mask = 0;
+    size_t num_intervals = 0;
+};
+
+} // namespace Common
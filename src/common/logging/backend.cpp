@@ -12,6 +12,7 @@
 #include <windows.h> // For OutputDebugStringW
 #endif
 
+#include "common/common_types.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/fs_paths.h"
@@ -23,6 +24,7 @@
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
 #include "common/logging/log_entry.h"
+#include "common/logging/rate_limiter.h"
 #include "common/logging/text_formatter.h"
 #include "common/settings.h"
 #ifdef _WIN32
@@ -220,24 +222,51 @@ public:
 
     void SetGlobalFilter(const Filter& f) {
         filter = f;
+        rate_limit = !filter.IsDebug();
     }
 
     void SetColorConsoleBackendEnabled(bool enabled) {
         color_console_backend.SetEnabled(enabled);
     }
 
+    bool CheckMessage(Class log_class, Level log_level) const {
+        return filter.CheckMessage(log_class, log_level);
+    }
+
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
-                   const char* function, std::string&& message) {
-        if (!filter.CheckMessage(log_class, log_level)) {
-            return;
+                   const char* function, const char* format, const fmt::format_args& args) {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        using std::chrono::seconds;
+        using std::chrono::steady_clock;
+
+        const auto timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin);
+        u32 suppressed = 0;
+        // Developers filtering for debug messages get every message
+        if (rate_limit && log_level < Level::Critical) {
+            const auto second = static_cast<u32>(duration_cast<seconds>(timestamp).count());
+            if (!rate_limiter.Check(filename, line_num, second, suppressed)) {
+                return;
+            }
+        }
+        std::string message = fmt::vformat(format, args);
+        if (suppressed != 0) {
+            message += fmt::format(" ({} similar messages suppressed)", suppressed);
         }
-        message_queue.EmplaceWait(
-            CreateEntry(log_class, log_level, filename, line_num, function, std::move(message)));
+        message_queue.EmplaceWait(Entry{
+            .timestamp = timestamp,
+            .log_class = log_class,
+            .log_level = log_level,
+            .filename = filename,
+            .line_num = line_num,
+            .function = function,
+            .message = std::move(message),
+        });
     }
 
 private:
     Impl(const std::filesystem::path& file_backend_filename, const Filter& filter_)
-        : filter{filter_}, file_backend{file_backend_filename} {}
+        : filter{filter_}, rate_limit{!filter_.IsDebug()}, file_backend{file_backend_filename} {}
 
     ~Impl() = default;
 
@@ -272,23 +301,6 @@ private:
         ForEachBackend([](Backend& backend) { backend.Flush(); });
     }
 
-    Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsigned int line_nr,
-                      const char* function, std::string&& message) const {
-        using std::chrono::duration_cast;
-        using std::chrono::microseconds;
-        using std::chrono::steady_clock;
-
-        return {
-            .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
-            .log_class = log_class,
-            .log_level = log_level,
-            .filename = filename,
-            .line_num = line_nr,
-            .function = function,
-            .message = std::move(message),
-        };
-    }
-
     void ForEachBackend(auto lambda) {
         lambda(static_cast<Backend&>(debugger_backend));
         lambda(static_cast<Backend&>(color_console_backend));
@@ -305,6 +317,8 @@ private:
     static inline std::unique_ptr<Impl, decltype(&Deleter)> instance{nullptr, Deleter};
 
     Filter filter;
+    bool rate_limit;
+    RateLimiter rate_limiter;
     DebuggerBackend debugger_backend{};
     ColorConsoleBackend color_console_backend{};
     FileBackend file_backend;
@@ -345,9 +359,13 @@ void SetColorConsoleBackendEnabled(bool enabled) {
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args) {
-    if (!initialization_in_progress_suppress_logging) {
-        Impl::Instance().PushEntry(log_class, log_level, filename, line_num, function,
-                                   fmt::vformat(format, args));
+    if (initialization_in_progress_suppress_logging) {
+        return;
+    }
+    // Check the filter before formatting, most debug messages are filtered out
+    Impl& instance = Impl::Instance();
+    if (instance.CheckMessage(log_class, log_level)) {
+        instance.PushEntry(log_class, log_level, filename, line_num, function, format, args);
     }
 }
 } // namespace Common::Log
@@ -19,7 +19,7 @@ struct Entry {
     Level log_level{};
     const char* filename = nullptr;
     unsigned int line_num = 0;
-    std::string function;
+    const char* function = nullptr;
     std::string message;
 };
 
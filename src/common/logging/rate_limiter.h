@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "common/common_types.h"
+
+namespace Common::Log {
+
+/**
+ * Limits how many messages each call site logs per second, so a stub hit every frame doesn't
+ * flood the backends. Call sites are hashed into a fixed table of counters, sites sharing a slot
+ * share their limit.
+ */
+class RateLimiter {
+public:
+    static constexpr u32 MAX_MESSAGES_PER_SECOND = 64;
+
+    /**
+     * Counts a message from a call site.
+     *
+     * @param filename   - File of the call site.
+     * @param line_num   - Line of the call site.
+     * @param second     - Current time in seconds.
+     * @param suppressed - Set to the number of messages the site dropped in its previous window.
+     *
+     * @return True if the message should be logged.
+     */
+    bool Check(const char* filename, unsigned int line_num, u32 second, u32& suppressed) {
+        const size_t hash = reinterpret_cast<uintptr_t>(filename) * 31 + line_num;
+        std::atomic<u64>& slot = slots[hash % slots.size()];
+        u64 value = slot.load(std::memory_order_relaxed);
+        while (true) {
+            const u32 slot_second = static_cast<u32>(value >> 32);
+            const u32 count = static_cast<u32>(value);
+            const bool same_window = slot_second == second;
+            const u64 next = same_window ? value + 1 : (u64{second} << 32) | 1;
+            if (slot.compare_exchange_weak(value, next, std::memory_order_relaxed)) {
+                suppressed = !same_window && count > MAX_MESSAGES_PER_SECOND
+                                 ? count - MAX_MESSAGES_PER_SECOND
+                                 : 0;
+                return !same_window || count < MAX_MESSAGES_PER_SECOND;
+            }
+        }
+    }
+
+private:
+    std::array<std::atomic<u64>, 1024> slots{};
+};
+
+} // namespace Common::Log
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/memory_accounting.h"
+
+namespace Common {
+
+namespace {
+std::array<std::atomic<u64>, NUM_MEMORY_CATEGORIES> memory_usage{};
+} // Anonymous namespace
+
+void AddMemoryUsage(MemoryCategory category, u64 bytes) noexcept {
+    memory_usage[static_cast<size_t>(category)].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void RemoveMemoryUsage(MemoryCategory category, u64 bytes) noexcept {
+    memory_usage[static_cast<size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+MemoryUsage GetMemoryUsage() noexcept {
+    MemoryUsage usage{};
+    for (size_t category = 0; category < NUM_MEMORY_CATEGORIES; ++category) {
+        usage[category] = memory_usage[category].load(std::memory_order_relaxed);
+    }
+    return usage;
+}
+
+std::string_view GetMemoryCategoryName(MemoryCategory category) noexcept {
+    switch (category) {
+    case MemoryCategory::GuestMemory:
+        return "Guest memory";
+    case MemoryCategory::JitCodeCache:
+        return "JIT code caches";
+    case MemoryCategory::TextureCache:
+        return "Texture cache";
+    case MemoryCategory::BufferCache:
+        return "Buffer cache";
+    case MemoryCategory::StagingBuffers:
+        return "Staging buffers";
+    case MemoryCategory::PipelineCache:
+        return "Pipeline cache";
+    case MemoryCategory::AudioRenderer:
+        return "Audio renderer";
+    case MemoryCategory::VfsCache:
+        return "Filesystem caches";
+    case MemoryCategory::Count:
+        break;
+    }
+    return "Unknown";
+}
+
+} // namespace Common
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Subsystems host memory usage is accounted to
+enum class MemoryCategory : u32 {
+    GuestMemory,    ///< Backing memory of the emulated DRAM
+    JitCodeCache,   ///< Code caches of the CPU recompilers
+    TextureCache,   ///< Images of the texture cache, mostly in VRAM
+    BufferCache,    ///< Buffers of the buffer cache, mostly in VRAM
+    StagingBuffers, ///< Host visible staging and stream buffers
+    PipelineCache,  ///< Code of the live shader modules
+    AudioRenderer,  ///< Work buffers of the audio renderers
+    VfsCache,       ///< Data queued to be written to the filesystem caches
+    Count,
+};
+
+constexpr size_t NUM_MEMORY_CATEGORIES = static_cast<size_t>(MemoryCategory::Count);
+
+/// Bytes in use by each category, indexed by MemoryCategory
+using MemoryUsage = std::array<u64, NUM_MEMORY_CATEGORIES>;
+
+/// Accounts bytes allocated by a category. Counters are relaxed atomics, cheap enough for hot paths.
+void AddMemoryUsage(MemoryCategory category, u64 bytes) noexcept;
+
+/// Accounts bytes released by a category, must match previously added bytes
+void RemoveMemoryUsage(MemoryCategory category, u64 bytes) noexcept;
+
+/// Returns the bytes currently in use by each category
+[[nodiscard]] MemoryUsage GetMemoryUsage() noexcept;
+
+/// Returns a short display name of a category
+[[nodiscard]] std::string_view GetMemoryCategoryName(MemoryCategory category) noexcept;
+
+/**
+ * Usage of a single owner, for owners that already track their own totals. Setting the account
+ * moves the difference into the category, destroying it removes what is left.
+ */
+class MemoryAccount {
+public:
+    explicit MemoryAccount(MemoryCategory category_) noexcept : category{category_} {}
+
+    ~MemoryAccount() {
+        Set(0);
+    }
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    void Add(u64 bytes) noexcept {
+        this->bytes.fetch_add(bytes, std::memory_order_relaxed);
+        AddMemoryUsage(category, bytes);
+    }
+
+    void Remove(u64 bytes) noexcept {
+        this->bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        RemoveMemoryUsage(category, bytes);
+    }
+
+    void Set(u64 new_bytes) noexcept {
+        const u64 old_bytes = bytes.exchange(new_bytes, std::memory_order_relaxed);
+        if (new_bytes > old_bytes) {
+            AddMemoryUsage(category, new_bytes - old_bytes);
+        } else {
+            RemoveMemoryUsage(category, old_bytes - new_bytes);
+        }
+    }
+
+    [[nodiscard]] u64 Bytes() const noexcept {
+        return bytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    MemoryCategory category;
+    std::atomic<u64> bytes{};
+};
+
+} // namespace Common
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+namespace Common {
+
+/**
+ * Latest value of a small trivially copyable type, read without locking by any number of readers.
+ * Readers retry when they race with a store, so stores should be short and infrequent compared
+ * to a reader's spin. Stores must be serialized by the caller.
+ */
+template <typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+class SeqLock {
+public:
+    SeqLock() {
+        Store(T{});
+    }
+
+    /// Publishes a new value, calls must not overlap
+    void Store(const T& value) noexcept {
+        std::array<u64, NUM_WORDS> buffer{};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+
+        const u32 current = sequence.load(std::memory_order_relaxed);
+        sequence.store(current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < NUM_WORDS; ++i) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    /// Returns the last published value, never a mix of two stores
+    [[nodiscard]] T Load() const noexcept {
+        std::array<u64, NUM_WORDS> buffer;
+        u32 begin;
+        do {
+            begin = sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < NUM_WORDS; ++i) {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((begin & 1) != 0 || sequence.load(std::memory_order_relaxed) != begin);
+
+        T value;
+        std::memcpy(static_cast<void*>(&value), buffer.data(), sizeof(T));
+        return value;
+    }
+
+private:
+    static constexpr size_t NUM_WORDS = DivCeil(sizeof(T), sizeof(u64));
+
+    /// Odd while a store is in progress
+    std::atomic<u32> sequence{};
+    std::array<std::atomic<u64>, NUM_WORDS> words{};
+};
+
+} // namespace Common
@@ -10,8 +10,10 @@
 #endif
 #include <compare>
 #include <cstddef>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <mutex>
 #include <string_view>
 #include <type_traits>
 #include <fmt/core.h>
@@ -32,6 +34,7 @@ namespace Settings {
 
 SETTING(AppletMode, false);
 SETTING(AudioEngine, false);
+SETTING(IntegrityVerificationMode, false);
 SETTING(bool, false);
 SETTING(int, false);
 SETTING(std::string, false);
@@ -137,17 +140,40 @@ void LogSettings() {
     log_path("DataStorage_SDMCDir", Common::FS::GetYuzuPath(Common::FS::YuzuPath::SDMCDir));
 }
 
-void UpdateGPUAccuracy() {
-    values.current_gpu_accuracy = values.gpu_accuracy.GetValue();
+namespace {
+constinit const HotValues default_hot_values{};
+
+std::mutex hot_values_mutex;
+/// Every published snapshot, readers may still hold references to the old ones
+std::deque<HotValues> published_hot_values;
+
+void PublishHotValues(GpuAccuracy gpu_accuracy) {
+    std::scoped_lock lock{hot_values_mutex};
+    const HotValues next{
+        .gpu_accuracy = gpu_accuracy,
+        .use_fast_gpu_time = values.use_fast_gpu_time.GetValue(),
+        .use_reactive_flushing = values.use_reactive_flushing.GetValue(),
+        .barrier_feedback_loops = values.barrier_feedback_loops.GetValue(),
+        .resolution_info = values.resolution_info,
+    };
+    // This runs after every command list, only changes allocate a new snapshot
+    if (next == *Detail::hot_values.load(std::memory_order_relaxed)) {
+        return;
+    }
+    Detail::hot_values.store(&published_hot_values.emplace_back(next), std::memory_order_release);
 }
+} // Anonymous namespace
 
-bool IsGPULevelExtreme() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme;
+namespace Detail {
+constinit std::atomic<const HotValues*> hot_values{&default_hot_values};
 }
 
-bool IsGPULevelHigh() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme ||
-           values.current_gpu_accuracy == GpuAccuracy::High;
+void UpdateHotValues() {
+    PublishHotValues(GetHotValues().gpu_accuracy);
+}
+
+void UpdateGPUAccuracy() {
+    PublishHotValues(values.gpu_accuracy.GetValue());
 }
 
 bool IsFastmemEnabled() {
@@ -319,6 +345,7 @@ void UpdateRescalingInfo() {
     const auto setup = values.resolution_setup.GetValue();
     auto& info = values.resolution_info;
     TranslateResolutionInfo(setup, info);
+    UpdateHotValues();
 }
 
 void RestoreGlobalState(bool is_powered_on) {
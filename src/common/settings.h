@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -43,6 +44,8 @@ struct ResolutionScalingInfo {
         }
         return std::max((value * up_scale) >> down_shift, 1U);
     }
+
+    bool operator==(const ResolutionScalingInfo&) const = default;
 };
 
 #ifndef CANNOT_EXPLICITLY_INSTANTIATE
@@ -185,6 +188,12 @@ struct Values {
                                        Specialization::Scalar | Specialization::Percentage,
                                        true,
                                        true};
+    SwitchableSetting<bool> audio_low_latency{linkage, false, "audio_low_latency",
+                                              Category::Audio};
+    SwitchableSetting<bool> audio_time_stretch{linkage, false, "audio_time_stretch",
+                                               Category::Audio};
+    SwitchableSetting<bool> audio_render_on_demand{linkage, false, "audio_render_on_demand",
+                                                   Category::Audio};
     Setting<bool, false> audio_muted{
         linkage, false, "audio_muted", Category::Audio, Specialization::Default, true, true};
     Setting<bool, false> dump_audio_commands{
@@ -210,6 +219,16 @@ struct Values {
                                              true,
                                              true,
                                              &use_speed_limit};
+    SwitchableSetting<u8, true> fast_forward_frame_skip{linkage,
+                                                        0,
+                                                        0,
+                                                        9,
+                                                        "fast_forward_frame_skip",
+                                                        Category::Core,
+                                                        Specialization::Countable,
+                                                        true,
+                                                        true};
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
 
     // Cpu
     SwitchableSetting<CpuBackend, true> cpu_backend{linkage,
@@ -230,6 +249,7 @@ struct Values {
                                                       CpuAccuracy::Auto, CpuAccuracy::Paranoid,
                                                       "cpu_accuracy",    Category::Cpu};
     SwitchableSetting<bool> cpu_debug_mode{linkage, false, "cpu_debug_mode", Category::CpuDebug};
+    SwitchableSetting<bool> pin_host_threads{linkage, false, "pin_host_threads", Category::Cpu};
 
     Setting<bool> cpuopt_page_tables{linkage, true, "cpuopt_page_tables", Category::CpuDebug};
     Setting<bool> cpuopt_block_linking{linkage, true, "cpuopt_block_linking", Category::CpuDebug};
@@ -322,6 +342,23 @@ struct Values {
     ResolutionScalingInfo resolution_info{};
     SwitchableSetting<ResolutionSetup> resolution_setup{linkage, ResolutionSetup::Res1X,
                                                         "resolution_setup", Category::Renderer};
+    SwitchableSetting<bool> dynamic_resolution{linkage,
+                                               false,
+                                               "dynamic_resolution",
+                                               Category::Renderer,
+                                               Specialization::Paired,
+                                               true,
+                                               true};
+    SwitchableSetting<u16, true> dynamic_resolution_fps{linkage,
+                                                        60,
+                                                        20,
+                                                        240,
+                                                        "dynamic_resolution_fps",
+                                                        Category::Renderer,
+                                                        Specialization::Countable,
+                                                        true,
+                                                        true,
+                                                        &dynamic_resolution};
     SwitchableSetting<ScalingFilter> scaling_filter{linkage,
                                                     ScalingFilter::Bilinear,
                                                     "scaling_filter",
@@ -367,7 +404,6 @@ struct Values {
                                                       Specialization::Default,
                                                       true,
                                                       true};
-    GpuAccuracy current_gpu_accuracy{GpuAccuracy::High};
     SwitchableSetting<AnisotropyMode, true> max_anisotropy{linkage,
 #ifdef ANDROID
                                                            AnisotropyMode::Default,
@@ -397,6 +433,14 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> low_latency_presentation{linkage, false, "low_latency_presentation",
+                                                     Category::RendererAdvanced};
+    SwitchableSetting<bool> frame_generation{linkage, false, "frame_generation",
+                                             Category::RendererAdvanced};
+    SwitchableSetting<bool> parallel_command_recording{linkage, false, "parallel_command_recording",
+                                                       Category::RendererAdvanced};
+    SwitchableSetting<bool> use_async_compute_queue{linkage, false, "use_async_compute_queue",
+                                                    Category::RendererAdvanced};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
@@ -419,12 +463,28 @@ struct Values {
                                                              Specialization::Default,
                                                              true,
                                                              true};
+    SwitchableSetting<bool> use_pipeline_library{linkage, false, "use_pipeline_library",
+                                                 Category::RendererAdvanced};
+    SwitchableSetting<bool> optimize_spirv{linkage, false, "optimize_spirv",
+                                           Category::RendererAdvanced};
+    SwitchableSetting<bool> use_disk_texture_cache{linkage, false, "use_disk_texture_cache",
+                                                   Category::RendererAdvanced};
+    SwitchableSetting<u8, true> disk_pipeline_hot_set{linkage,
+                                                      100,
+                                                      1,
+                                                      100,
+                                                      "disk_pipeline_hot_set",
+                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> enable_compute_pipelines{linkage, false, "enable_compute_pipelines",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_video_framerate{linkage, false, "use_video_framerate",
                                                 Category::RendererAdvanced};
     SwitchableSetting<bool> barrier_feedback_loops{linkage, true, "barrier_feedback_loops",
                                                    Category::RendererAdvanced};
+    SwitchableSetting<bool> use_host_memory_import{linkage, false, "use_host_memory_import",
+                                                   Category::RendererAdvanced};
+    SwitchableSetting<u8, true> conditional_rendering_speculation{
+        linkage, 0, 0, 16, "conditional_rendering_speculation", Category::RendererAdvanced};
 
     Setting<bool> renderer_debug{linkage, false, "debug", Category::RendererDebug};
     Setting<bool> renderer_shader_feedback{linkage, false, "shader_feedback",
@@ -437,6 +497,7 @@ struct Values {
                                           Category::RendererDebug};
     Setting<bool> disable_buffer_reorder{linkage, false, "disable_buffer_reorder",
                                          Category::RendererDebug};
+    Setting<bool> gpu_profiling{linkage, false, "gpu_profiling", Category::RendererDebug};
 
     // System
     SwitchableSetting<Language, true> language_index{linkage,
@@ -570,6 +631,14 @@ struct Values {
                                         Category::DataStorage};
     Setting<std::string> gamecard_path{linkage, std::string(), "gamecard_path",
                                        Category::DataStorage};
+    Setting<bool> use_nca_section_cache{linkage, false, "use_nca_section_cache",
+                                        Category::DataStorage};
+    // In MiB
+    Setting<u32> nca_section_cache_size{linkage, 16384, "nca_section_cache_size",
+                                        Category::DataStorage};
+    Setting<IntegrityVerificationMode> integrity_verification_mode{
+        linkage, IntegrityVerificationMode::Off, "integrity_verification_mode",
+        Category::DataStorage};
 
     // Debugging
     bool record_frame_times;
@@ -583,6 +652,28 @@ struct Values {
         false};
     Setting<bool> dump_macros{
         linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
+    Setting<bool> profile_macros{linkage,
+                                 false,
+                                 "profile_macros",
+                                 Category::DebuggingGraphics,
+                                 Specialization::Default,
+                                 false};
+    Setting<bool> profile_shader_passes{linkage,
+                                        false,
+                                        "profile_shader_passes",
+                                        Category::DebuggingGraphics,
+                                        Specialization::Default,
+                                        false};
+    Setting<bool> record_gpu_command_trace{linkage,
+                                           false,
+                                           "record_gpu_command_trace",
+                                           Category::DebuggingGraphics,
+                                           Specialization::Default,
+                                           false};
+    Setting<bool> profile_svcs{
+        linkage, false, "profile_svcs", Category::Debugging, Specialization::Default, false};
+    Setting<bool> profile_services{
+        linkage, false, "profile_services", Category::Debugging, Specialization::Default, false};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
@@ -599,6 +690,7 @@ struct Values {
     Setting<bool> enable_all_controllers{linkage, false, "enable_all_controllers",
                                          Category::Debugging};
     Setting<bool> perform_vulkan_check{linkage, true, "perform_vulkan_check", Category::Debugging};
+    Setting<bool> enable_tracing{linkage, false, "enable_tracing", Category::Debugging};
 
     // Miscellaneous
     Setting<std::string> log_filter{linkage, "*:Info", "log_filter", Category::Miscellaneous};
@@ -622,9 +714,44 @@ struct Values {
 
 extern Values values;
 
+/**
+ * Settings read in hot paths, copied out of their Setting objects when the configuration is
+ * applied. Reading them skips the virtual call and the global/custom selection of GetValue.
+ * A published snapshot is never modified, new values are published as a new snapshot.
+ */
+struct HotValues {
+    GpuAccuracy gpu_accuracy{GpuAccuracy::High};
+    bool use_fast_gpu_time{true};
+    bool use_reactive_flushing{true};
+    bool barrier_feedback_loops{true};
+    ResolutionScalingInfo resolution_info{};
+
+    bool operator==(const HotValues&) const = default;
+};
+
+namespace Detail {
+extern std::atomic<const HotValues*> hot_values;
+}
+
+/// Returns the last published snapshot of the hot settings
+[[nodiscard]] inline const HotValues& GetHotValues() {
+    return *Detail::hot_values.load(std::memory_order_acquire);
+}
+
+/// Publishes the current hot settings, the GPU accuracy is only updated by UpdateGPUAccuracy
+void UpdateHotValues();
+
+/// Publishes the current GPU accuracy, called between command lists so it never changes mid-list
 void UpdateGPUAccuracy();
-bool IsGPULevelExtreme();
-bool IsGPULevelHigh();
+
+[[nodiscard]] inline bool IsGPULevelExtreme() {
+    return GetHotValues().gpu_accuracy == GpuAccuracy::Extreme;
+}
+
+[[nodiscard]] inline bool IsGPULevelHigh() {
+    const GpuAccuracy gpu_accuracy = GetHotValues().gpu_accuracy;
+    return gpu_accuracy == GpuAccuracy::Extreme || gpu_accuracy == GpuAccuracy::High;
+}
 
 bool IsFastmemEnabled();
 void SetNceEnabled(bool is_64bit);
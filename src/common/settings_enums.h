@@ -83,6 +83,7 @@ enum class AudioEngine : u32 {
     Sdl2,
     Null,
     Oboe,
+    File,
 };
 
 template <>
@@ -90,7 +91,7 @@ inline std::vector<std::pair<std::string, AudioEngine>>
 EnumMetadata<AudioEngine>::Canonicalizations() {
     return {
         {"auto", AudioEngine::Auto}, {"cubeb", AudioEngine::Cubeb}, {"sdl2", AudioEngine::Sdl2},
-        {"null", AudioEngine::Null}, {"oboe", AudioEngine::Oboe},
+        {"null", AudioEngine::Null}, {"oboe", AudioEngine::Oboe}, {"file", AudioEngine::File},
     };
 }
 
@@ -155,6 +156,8 @@ ENUM(ConsoleMode, Handheld, Docked);
 
 ENUM(AppletMode, HLE, LLE);
 
+ENUM(IntegrityVerificationMode, Off, Once, Asynchronous);
+
 template <typename Type>
 inline std::string CanonicalizeEnum(Type id) {
     const auto group = EnumMetadata<Type>::Canonicalizations();
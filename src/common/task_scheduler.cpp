@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/cpu_topology.h"
+#include "common/task_scheduler.h"
+#include "common/thread.h"
+#include "common/trace.h"
+
+namespace Common {
+
+namespace {
+/// Scheduler and index of the worker running on this thread
+thread_local const TaskScheduler* current_scheduler{};
+thread_local size_t current_worker{};
+} // Anonymous namespace
+
+TaskScheduler::TaskScheduler(size_t num_workers) {
+    num_workers = std::max<size_t>(num_workers, 1);
+    // Latency critical work can use every worker. Frame work leaves one of them to it, so a
+    // burst of shader builds does not delay audio, and background work leaves half of them.
+    limits = {num_workers, std::max<size_t>(num_workers - 1, 1),
+              std::max<size_t>(num_workers / 2, 1)};
+
+    workers.reserve(num_workers);
+    for (size_t index = 0; index < num_workers; ++index) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t index = 0; index < num_workers; ++index) {
+        workers[index]->thread = std::jthread(
+            [this, index](std::stop_token stop_token) { WorkerLoop(stop_token, index); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    for (auto& worker : workers) {
+        worker->thread.request_stop();
+    }
+    {
+        std::scoped_lock lk{sleep_mutex};
+    }
+    sleep_cv.notify_all();
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+TaskScheduler& TaskScheduler::Instance() {
+    static TaskScheduler scheduler{
+        std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 2) - 1};
+    return scheduler;
+}
+
+void TaskScheduler::Submit(TaskPriority priority, Task task) {
+    const size_t index = current_scheduler == this
+                             ? current_worker
+                             : next_worker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    const auto queue_index = static_cast<size_t>(priority);
+    {
+        Worker& worker = *workers[index];
+        std::scoped_lock lk{worker.mutex};
+        worker.queues[queue_index].push_back(std::move(task));
+    }
+    ++num_queued[queue_index];
+    WakeWorker();
+}
+
+void TaskScheduler::WorkerLoop(std::stop_token stop_token, size_t index) {
+    const std::string name = fmt::format("TaskWorker_{}", index);
+    Common::SetCurrentThreadName(name.c_str());
+    Common::Trace::SetThreadName(name.c_str());
+    Common::PinCurrentThreadToWorkers();
+    current_scheduler = this;
+    current_worker = index;
+
+    while (!stop_token.stop_requested()) {
+        if (TryRunTask(index)) {
+            continue;
+        }
+        std::unique_lock lk{sleep_mutex};
+        ++num_sleeping;
+        Common::CondvarWait(sleep_cv, lk, stop_token, [this] { return HasRunnableTask(); });
+        --num_sleeping;
+    }
+}
+
+bool TaskScheduler::TryRunTask(size_t index) {
+    thread_local TaskPriority thread_priority{TaskPriority::FrameCritical};
+    for (size_t priority = 0; priority < NUM_PRIORITIES; ++priority) {
+        if (num_queued[priority] == 0) {
+            continue;
+        }
+        if (num_running[priority]++ >= limits[priority]) {
+            --num_running[priority];
+            continue;
+        }
+        Task task;
+        if (!TryPopTask(index, priority, task)) {
+            --num_running[priority];
+            continue;
+        }
+        --num_queued[priority];
+
+        // Changing the priority of the thread is a system call, only do it between classes
+        const auto task_priority = static_cast<TaskPriority>(priority);
+        if ((task_priority == TaskPriority::Background) !=
+            (thread_priority == TaskPriority::Background)) {
+            Common::SetCurrentThreadPriority(task_priority == TaskPriority::Background
+                                                 ? Common::ThreadPriority::Low
+                                                 : Common::ThreadPriority::Normal);
+        }
+        thread_priority = task_priority;
+        task();
+
+        --num_running[priority];
+        if (num_queued[priority] != 0) {
+            // A worker may be sleeping on the limit of the class that was just released
+            WakeWorker();
+        }
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::TryPopTask(size_t index, size_t priority, Task& task) {
+    for (size_t offset = 0; offset < workers.size(); ++offset) {
+        Worker& worker = *workers[(index + offset) % workers.size()];
+        std::scoped_lock lk{worker.mutex};
+        auto& queue = worker.queues[priority];
+        if (queue.empty()) {
+            continue;
+        }
+        // Workers take their oldest task, thieves take the newest one
+        if (offset == 0) {
+            task = std::move(queue.front());
+            queue.pop_front();
+        } else {
+            task = std::move(queue.back());
+            queue.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::HasRunnableTask() const {
+    for (size_t priority = 0; priority < NUM_PRIORITIES; ++priority) {
+        if (num_queued[priority] != 0 && num_running[priority] < limits[priority]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::WakeWorker() {
+    if (num_sleeping == 0) {
+        return;
+    }
+    // Taking the lock orders the notification after the check of a worker about to sleep
+    {
+        std::scoped_lock lk{sleep_mutex};
+    }
+    sleep_cv.notify_one();
+}
+
+TaskGroup::TaskGroup(TaskPriority priority_, size_t max_concurrency_)
+    : scheduler{TaskScheduler::Instance()}, priority{priority_},
+      max_concurrency{std::max<size_t>(max_concurrency_, 1)} {}
+
+TaskGroup::~TaskGroup() {
+    Cancel();
+    std::unique_lock lk{mutex};
+    wait_condition.wait(lk, [this] { return num_runners == 0; });
+}
+
+void TaskGroup::QueueWork(UniqueFunction<void> work) {
+    {
+        std::scoped_lock lk{mutex};
+        if (is_cancelled) {
+            return;
+        }
+        requests.push(std::move(work));
+        ++work_scheduled;
+        if (num_runners >= max_concurrency) {
+            return;
+        }
+        ++num_runners;
+    }
+    scheduler.Submit(priority, [this] { RunTask(); });
+}
+
+void TaskGroup::WaitForRequests(std::stop_token stop_token) {
+    std::stop_callback callback(stop_token, [this] { Cancel(); });
+    std::unique_lock lk{mutex};
+    wait_condition.wait(lk, [this] { return work_done >= work_scheduled; });
+}
+
+void TaskGroup::RunTask() {
+    UniqueFunction<void> work;
+    {
+        std::scoped_lock lk{mutex};
+        if (requests.empty()) {
+            --num_runners;
+            wait_condition.notify_all();
+            return;
+        }
+        work = std::move(requests.front());
+        requests.pop();
+    }
+    work();
+    {
+        std::scoped_lock lk{mutex};
+        ++work_done;
+        if (requests.empty()) {
+            --num_runners;
+            wait_condition.notify_all();
+            return;
+        }
+    }
+    // Go back through the scheduler between tasks, so a long group does not hold a worker more
+    // urgent classes could use
+    scheduler.Submit(priority, [this] { RunTask(); });
+}
+
+void TaskGroup::Cancel() {
+    std::scoped_lock lk{mutex};
+    is_cancelled = true;
+    work_done += requests.size();
+    requests = {};
+    wait_condition.notify_all();
+}
+
+} // namespace Common
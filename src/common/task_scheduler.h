@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/unique_function.h"
+
+namespace Common {
+
+/// Priority classes of the tasks run by the shared task scheduler, most urgent first
+enum class TaskPriority : u32 {
+    /// Work a real time thread is waiting on, like audio rendering
+    LatencyCritical,
+    /// Work the emulated frame is waiting on, like texture decoding and shader builds
+    FrameCritical,
+    /// Work nothing is waiting on, like pipelines prebuilt ahead of their use
+    Background,
+};
+
+/**
+ * Pool of worker threads shared by the subsystems offloading work, so they do not oversubscribe
+ * the host with a pool each. Every worker has a queue per priority class and steals from the
+ * queues of the other workers when its own are empty. Tasks run by priority class, and each class
+ * can only occupy a limited number of workers at once. Frame work leaves a worker to latency
+ * critical work, and background work never fills the pool.
+ */
+class TaskScheduler {
+public:
+    using Task = UniqueFunction<void>;
+
+    static constexpr size_t NUM_PRIORITIES = 3;
+
+    explicit TaskScheduler(size_t num_workers);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    TaskScheduler(TaskScheduler&&) = delete;
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /// Returns the scheduler shared by the whole process
+    [[nodiscard]] static TaskScheduler& Instance();
+
+    /// Queues a task, on the queue of the calling worker when called from one
+    void Submit(TaskPriority priority, Task task);
+
+    /// Returns the number of workers
+    [[nodiscard]] size_t NumWorkers() const noexcept {
+        return workers.size();
+    }
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::array<std::deque<Task>, NUM_PRIORITIES> queues;
+        std::jthread thread;
+    };
+
+    void WorkerLoop(std::stop_token stop_token, size_t index);
+
+    /// Runs the most urgent task a class limit allows, returns false when there is none
+    bool TryRunTask(size_t index);
+
+    /// Pops a task of the class, from the queues of the worker first and then from the others
+    bool TryPopTask(size_t index, size_t priority, Task& task);
+
+    [[nodiscard]] bool HasRunnableTask() const;
+
+    void WakeWorker();
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::array<size_t, NUM_PRIORITIES> limits{};
+    std::array<std::atomic<size_t>, NUM_PRIORITIES> num_queued{};
+    std::array<std::atomic<size_t>, NUM_PRIORITIES> num_running{};
+    std::atomic<size_t> num_sleeping{};
+    std::atomic<size_t> next_worker{};
+    std::mutex sleep_mutex;
+    std::condition_variable_any sleep_cv;
+};
+
+/**
+ * Tasks of a subsystem run on the shared task scheduler under one priority class, and waited
+ * for together. Tasks start in the order they were queued, on at most max_concurrency workers
+ * at once.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskPriority priority,
+                       size_t max_concurrency = std::numeric_limits<size_t>::max());
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    void QueueWork(UniqueFunction<void> work);
+
+    /// Waits for the queued work, a stop request drops the work that has not started yet
+    void WaitForRequests(std::stop_token stop_token = {});
+
+private:
+    void RunTask();
+
+    /// Drops the work that has not started yet, no work is accepted afterwards
+    void Cancel();
+
+    TaskScheduler& scheduler;
+    const TaskPriority priority;
+    const size_t max_concurrency;
+
+    std::mutex mutex;
+    std::condition_variable wait_condition;
+    std::queue<UniqueFunction<void>> requests;
+    /// Tasks handed to the scheduler that have not returned yet
+    size_t num_runners{};
+    size_t work_scheduled{};
+    size_t work_done{};
+    bool is_cancelled{};
+};
+
+} // namespace Common
@@ -2,6 +2,8 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cerrno>
 #include <string>
 
 #include "common/error.h"
@@ -21,6 +23,7 @@
 #include <sched.h>
 #endif
 #ifndef _WIN32
+#include <time.h>
 #include <unistd.h>
 #endif
 
@@ -28,8 +31,86 @@
 #define cpu_set_t cpuset_t
 #endif
 
+#if defined(_WIN32) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 namespace Common {
 
+namespace {
+
+/// Time before a deadline spent spinning instead of sleeping, covers how late the timers wake up
+#ifdef _WIN32
+constexpr auto SpinThreshold = std::chrono::microseconds{1000};
+#else
+constexpr auto SpinThreshold = std::chrono::microseconds{200};
+#endif
+
+#ifdef _WIN32
+class WaitableTimer {
+public:
+    WaitableTimer() {
+        handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                        TIMER_ALL_ACCESS);
+        if (!handle) {
+            // High resolution timers are only available since Windows 10 1803
+            handle = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+        }
+    }
+
+    ~WaitableTimer() {
+        if (handle) {
+            CloseHandle(handle);
+        }
+    }
+
+    bool SleepFor(std::chrono::nanoseconds duration) {
+        if (!handle) {
+            return false;
+        }
+        // Negative due times are relative, in units of 100 nanoseconds
+        const LARGE_INTEGER due_time{
+            .QuadPart = -std::max<LONGLONG>(duration.count() / 100, 1),
+        };
+        if (!SetWaitableTimer(handle, &due_time, 0, nullptr, nullptr, FALSE)) {
+            return false;
+        }
+        return WaitForSingleObject(handle, INFINITE) == WAIT_OBJECT_0;
+    }
+
+private:
+    HANDLE handle{};
+};
+#endif
+
+/// Sleeps until a deadline, possibly waking up a bit late
+void SleepUntil(std::chrono::steady_clock::time_point deadline) {
+#ifdef _WIN32
+    thread_local WaitableTimer timer;
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+        return;
+    }
+    if (!timer.SleepFor(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining))) {
+        std::this_thread::sleep_until(deadline);
+    }
+#elif defined(__linux__)
+    // The steady clock is CLOCK_MONOTONIC on Linux
+    const auto ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    const timespec time{
+        .tv_sec = static_cast<time_t>(ns / 1'000'000'000),
+        .tv_nsec = static_cast<long>(ns % 1'000'000'000),
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+} // Anonymous namespace
+
 #ifdef _WIN32
 
 void SetCurrentThreadPriority(ThreadPriority new_priority) {
@@ -120,4 +201,50 @@ void SetCurrentThreadName(const char* name) {
 
 #endif
 
+void SetCurrentThreadAffinity(std::span<const u32> cpus) {
+    if (cpus.empty()) {
+        return;
+    }
+#if defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (const u32 cpu : cpus) {
+        if (cpu < sizeof(DWORD_PTR) * 8) {
+            mask |= DWORD_PTR{1} << cpu;
+        }
+    }
+    if (mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) == 0) {
+        LOG_ERROR(Common, "Failed to set thread affinity: {}", GetLastErrorMsg());
+    }
+#elif defined(__linux__) || defined(__FreeBSD__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const u32 cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+#ifdef __linux__
+    // Bionic has no pthread_setaffinity_np, a zero pid selects the calling thread
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        LOG_ERROR(Common, "Failed to set thread affinity: {}", GetLastErrorMsg());
+    }
+#else
+    if (int e = pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+        errno = e;
+        LOG_ERROR(Common, "Failed to set thread affinity: {}", GetLastErrorMsg());
+    }
+#endif
+#endif
+}
+
+void PreciseSleepUntil(std::chrono::steady_clock::time_point deadline) {
+    const auto sleep_deadline = deadline - SpinThreshold;
+    if (std::chrono::steady_clock::now() < sleep_deadline) {
+        SleepUntil(sleep_deadline);
+    }
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
 } // namespace Common
@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
+#include <span>
 #include <thread>
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -106,4 +107,13 @@ void SetCurrentThreadPriority(ThreadPriority new_priority);
 
 void SetCurrentThreadName(const char* name);
 
+/// Restricts the current thread to the given logical CPUs, an empty list is ignored.
+void SetCurrentThreadAffinity(std::span<const u32> cpus);
+
+/**
+ * Sleeps until the given point in time with high resolution timers where available, spinning for
+ * the last moments before it as the timers can still wake up late.
+ */
+void PreciseSleepUntil(std::chrono::steady_clock::time_point deadline);
+
 } // namespace Common
@@ -13,8 +13,10 @@
 #include <vector>
 #include <queue>
 
+#include "common/cpu_topology.h"
 #include "common/polyfill_thread.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "common/unique_function.h"
 
 namespace Common {
@@ -38,6 +40,8 @@ public:
         : workers_queued{num_workers}, thread_name{std::move(name)} {
         const auto lambda = [this, func](std::stop_token stop_token) {
             Common::SetCurrentThreadName(thread_name.c_str());
+            Common::Trace::SetThreadName(thread_name.c_str());
+            Common::PinCurrentThreadToWorkers();
             {
                 [[maybe_unused]] std::conditional_t<with_state, StateType, int> state{func()};
                 while (!stop_token.stop_requested()) {
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/steady_clock.h"
+#include "common/trace.h"
+
+namespace Common::Trace {
+
+std::atomic_bool Detail::enabled{false};
+
+namespace {
+
+/// Number of events kept per thread, a few seconds of the busiest threads
+constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+
+struct Event {
+    const char* name;
+    u64 begin;
+    u64 end;
+    Category category;
+};
+
+/// Event in a ring buffer, atomic so it can be copied while its thread overwrites it
+struct Slot {
+    std::atomic<const char*> name;
+    std::atomic<u64> begin;
+    std::atomic<u64> end;
+    std::atomic<Category> category;
+};
+
+/// Ring buffer of the events of a thread, only written by its thread
+struct ThreadBuffer {
+    /// Name of the thread, protected by the registry mutex
+    std::string name;
+    u32 id{};
+    /// Count of events ever recorded, released after writing an event
+    std::atomic<u64> num_events{0};
+    /// Allocated on the first recorded event, before num_events becomes non-zero
+    std::unique_ptr<Slot[]> slots;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    u32 next_id{};
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& GetThreadBuffer() {
+    // The registry shares the buffer so events of exited threads can still be exported
+    thread_local std::shared_ptr<ThreadBuffer> thread_buffer = [] {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        Registry& registry = GetRegistry();
+        std::scoped_lock lk{registry.mutex};
+        buffer->id = registry.next_id++;
+        buffer->name = fmt::format("Thread {}", buffer->id);
+        registry.buffers.push_back(buffer);
+        return buffer;
+    }();
+    return *thread_buffer;
+}
+
+const char* CategoryName(Category category) {
+    switch (category) {
+    case Category::Cpu:
+        return "cpu";
+    case Category::Gpu:
+        return "gpu";
+    case Category::Vulkan:
+        return "vulkan";
+    case Category::Shader:
+        return "shader";
+    case Category::Audio:
+        return "audio";
+    case Category::Service:
+        return "service";
+    case Category::Boot:
+        return "boot";
+    }
+    return "unknown";
+}
+
+/// Copies the events of a buffer still in it, oldest first
+std::vector<Event> CopyEvents(const ThreadBuffer& buffer) {
+    const u64 end = buffer.num_events.load(std::memory_order_acquire);
+    if (end == 0) {
+        return {};
+    }
+    const u64 begin = end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0;
+    std::vector<Event> events;
+    events.reserve(end - begin);
+    for (u64 index = begin; index < end; ++index) {
+        const Slot& slot = buffer.slots[index % EVENTS_PER_THREAD];
+        events.push_back(Event{
+            .name = slot.name.load(std::memory_order_relaxed),
+            .begin = slot.begin.load(std::memory_order_relaxed),
+            .end = slot.end.load(std::memory_order_relaxed),
+            .category = slot.category.load(std::memory_order_relaxed),
+        });
+    }
+    // The thread keeps recording while the events are copied, drop the ones it may have
+    // overwritten in the meantime, including the one it may be writing. The fence pairs with
+    // the one in Record, reading part of a new event means the count before it is seen here.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const u64 written = buffer.num_events.load(std::memory_order_relaxed);
+    const u64 first_valid = written >= EVENTS_PER_THREAD ? written - EVENTS_PER_THREAD + 1 : 0;
+    if (first_valid > begin) {
+        events.erase(events.begin(),
+                     events.begin() + static_cast<ptrdiff_t>(
+                                          std::min<u64>(first_valid - begin, events.size())));
+    }
+    return events;
+}
+
+} // Anonymous namespace
+
+void SetEnabled(bool enabled) {
+    Detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void SetThreadName(const char* name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::scoped_lock lk{GetRegistry().mutex};
+    buffer.name = name;
+}
+
+u64 Now() {
+    return static_cast<u64>(SteadyClock::Now().time_since_epoch().count());
+}
+
+void Record(Category category, const char* name, u64 begin, u64 end) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    if (!buffer.slots) {
+        buffer.slots = std::make_unique<Slot[]>(EVENTS_PER_THREAD);
+    }
+    const u64 index = buffer.num_events.load(std::memory_order_relaxed);
+    // Exporters that copy any part of the new event also see that its slot is being overwritten
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot& slot = buffer.slots[index % EVENTS_PER_THREAD];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    slot.category.store(category, std::memory_order_relaxed);
+    buffer.num_events.store(index + 1, std::memory_order_release);
+}
+
+bool Export() {
+    struct ThreadEvents {
+        std::string name;
+        u32 id;
+        std::vector<Event> events;
+    };
+    std::vector<ThreadEvents> threads;
+    {
+        Registry& registry = GetRegistry();
+        std::scoped_lock lk{registry.mutex};
+        for (const auto& buffer : registry.buffers) {
+            threads.push_back({buffer->name, buffer->id, CopyEvents(*buffer)});
+        }
+    }
+    // Events are recorded when they end, an event enclosing others is recorded after them
+    u64 base_time = std::numeric_limits<u64>::max();
+    for (const ThreadEvents& thread : threads) {
+        for (const Event& event : thread.events) {
+            base_time = std::min(base_time, event.begin);
+        }
+    }
+
+    const auto log_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir);
+    const auto path = log_dir / "trace.json";
+    Common::FS::IOFile file;
+    if (Common::FS::CreateDirs(log_dir)) {
+        file.Open(path, Common::FS::FileAccessMode::Write, Common::FS::FileType::TextFile);
+    }
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common, "Failed to open {} to export the trace to",
+                  Common::FS::PathToUTF8String(path));
+        return false;
+    }
+
+    std::string out = "{\"traceEvents\":[\n";
+    size_t num_events = 0;
+    for (const ThreadEvents& thread : threads) {
+        if (thread.events.empty()) {
+            continue;
+        }
+        out += fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                           "\"args\":{{\"name\":\"{}\"}}}},\n",
+                           thread.id, thread.name);
+        for (const Event& event : thread.events) {
+            out += fmt::format("{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                               "\"dur\":{:.3f},\"pid\":1,\"tid\":{}}},\n",
+                               event.name, CategoryName(event.category),
+                               static_cast<f64>(event.begin - base_time) / 1000.0,
+                               static_cast<f64>(event.end - event.begin) / 1000.0, thread.id);
+        }
+        num_events += thread.events.size();
+    }
+    // JSON does not allow a trailing comma after the last event
+    if (num_events != 0) {
+        out.erase(out.size() - 2, 1);
+    }
+    out += "]}\n";
+    if (file.WriteString(out) != out.size()) {
+        LOG_ERROR(Common, "Failed to write the trace to {}", Common::FS::PathToUTF8String(path));
+        return false;
+    }
+    LOG_INFO(Common, "Exported {} trace events to {}", num_events,
+             Common::FS::PathToUTF8String(path));
+    return true;
+}
+
+void Clear() {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lk{registry.mutex};
+    std::erase_if(registry.buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+}
+
+} // namespace Common::Trace
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+/// Mask of the trace categories compiled in, categories outside of it cost nothing
+#ifndef YUZU_TRACE_CATEGORIES
+#define YUZU_TRACE_CATEGORIES 0xFFFFFFFFU
+#endif
+
+namespace Common::Trace {
+
+enum class Category : u32 {
+    Cpu = 1U << 0,
+    Gpu = 1U << 1,
+    Vulkan = 1U << 2,
+    Shader = 1U << 3,
+    Audio = 1U << 4,
+    Service = 1U << 5,
+    Boot = 1U << 6,
+};
+
+/// Returns true when the events of the category are compiled in
+[[nodiscard]] constexpr bool IsCompiledIn(Category category) {
+    return (YUZU_TRACE_CATEGORIES & static_cast<u32>(category)) != 0;
+}
+
+namespace Detail {
+extern std::atomic_bool enabled;
+} // namespace Detail
+
+/// Returns true when events are being recorded
+[[nodiscard]] inline bool IsEnabled() {
+    return Detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// Starts or stops recording events
+void SetEnabled(bool enabled);
+
+/// Names the calling thread in exported traces
+void SetThreadName(const char* name);
+
+/// Returns the current time in nanoseconds on the clock events are recorded with
+[[nodiscard]] u64 Now();
+
+/**
+ * Records an event in the ring buffer of the calling thread, overwriting its oldest event when
+ * the buffer is full.
+ *
+ * @param category - Category of the event.
+ * @param name     - Name of the event, it must outlive the recorded events.
+ * @param begin    - Time the event began at, from Now().
+ * @param end      - Time the event ended at, from Now().
+ */
+void Record(Category category, const char* name, u64 begin, u64 end);
+
+/**
+ * Writes the events in the ring buffers to trace.json in the log directory, in the Chrome trace
+ * format understood by chrome://tracing and Perfetto.
+ *
+ * @return True on success, false otherwise.
+ */
+bool Export();
+
+/// Drops the ring buffers of the threads that have exited
+void Clear();
+
+/// Records the lifetime of the scope as an event
+template <Category category>
+class Scope {
+public:
+    explicit Scope(const char* name_) : name{name_} {
+        if constexpr (IsCompiledIn(category)) {
+            if (IsEnabled()) {
+                begin = Now();
+            }
+        }
+    }
+
+    ~Scope() {
+        if constexpr (IsCompiledIn(category)) {
+            if (begin != 0) {
+                Record(category, name, begin, Now());
+            }
+        }
+    }
+
+    YUZU_NON_COPYABLE(Scope);
+    YUZU_NON_MOVEABLE(Scope);
+
+private:
+    const char* name;
+    u64 begin{};
+};
+
+} // namespace Common::Trace
+
+/// Records the rest of the enclosing scope as an event named by a string literal
+#define TRACE_SCOPE(category, name)                                                                \
+    const ::Common::Trace::Scope<::Common::Trace::Category::category> CONCAT2(trace_scope_,        \
+                                                                              __LINE__){name}
@@ -39,4 +39,13 @@ void FreeMemoryPages(void* base, [[maybe_unused]] std::size_t size) noexcept {
 #endif
 }
 
+void ProtectGuardPages(void* base, std::size_t size) noexcept {
+#ifdef _WIN32
+    DWORD old_protect{};
+    ASSERT(VirtualProtect(base, size, PAGE_NOACCESS, &old_protect));
+#else
+    ASSERT(mprotect(base, size, PROT_NONE) == 0);
+#endif
+}
+
 } // namespace Common
@@ -10,6 +10,9 @@ namespace Common {
 void* AllocateMemoryPages(std::size_t size) noexcept;
 void FreeMemoryPages(void* base, std::size_t size) noexcept;
 
+/// Removes all access to the given page-aligned range, so that any touch of it faults
+void ProtectGuardPages(void* base, std::size_t size) noexcept;
+
 template <typename T>
 class VirtualBuffer final {
 public:
@@ -33,10 +36,11 @@ public:
     VirtualBuffer& operator=(const VirtualBuffer&) = delete;
 
     VirtualBuffer(VirtualBuffer&& other) noexcept
-        : alloc_size{std::exchange(other.alloc_size, 0)}, base_ptr{std::exchange(other.base_ptr),
-                                                                   nullptr} {}
+        : alloc_size{std::exchange(other.alloc_size, 0)},
+          base_ptr{std::exchange(other.base_ptr, nullptr)} {}
 
     VirtualBuffer& operator=(VirtualBuffer&& other) noexcept {
+        FreeMemoryPages(base_ptr, alloc_size);
         alloc_size = std::exchange(other.alloc_size, 0);
         base_ptr = std::exchange(other.base_ptr, nullptr);
         return *this;
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <ios>
+
+#include <zdict.h>
 #include <zstd.h>
 
 #include "common/zstd_compression.h"
@@ -34,6 +37,10 @@ std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_siz
 std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     const std::size_t decompressed_size =
         ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+    if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+        return {};
+    }
     std::vector<u8> decompressed(decompressed_size);
 
     const std::size_t uncompressed_result_size = ZSTD_decompress(
@@ -46,4 +53,214 @@ std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     return decompressed;
 }
 
+struct ZSTDDictionary::Impl {
+    ~Impl() {
+        ZSTD_freeCDict(cdict);
+        ZSTD_freeDDict(ddict);
+    }
+
+    std::vector<u8> data;
+    ZSTD_CDict* cdict{};
+    ZSTD_DDict* ddict{};
+};
+
+ZSTDDictionary::ZSTDDictionary(std::vector<u8> data, s32 compression_level)
+    : impl{std::make_unique<Impl>()} {
+    impl->data = std::move(data);
+    impl->cdict = ZSTD_createCDict(impl->data.data(), impl->data.size(),
+                                   std::clamp(compression_level, 1, ZSTD_maxCLevel()));
+    impl->ddict = ZSTD_createDDict(impl->data.data(), impl->data.size());
+}
+
+ZSTDDictionary::~ZSTDDictionary() = default;
+
+std::span<const u8> ZSTDDictionary::Data() const noexcept {
+    return impl->data;
+}
+
+std::vector<u8> TrainDictionaryZSTD(std::span<const u8> samples,
+                                    std::span<const size_t> sample_sizes, size_t max_size) {
+    std::vector<u8> dictionary(max_size);
+    const size_t dictionary_size =
+        ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(),
+                              sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(dictionary_size)) {
+        return {};
+    }
+    dictionary.resize(dictionary_size);
+    return dictionary;
+}
+
+std::vector<u8> CompressDataZSTD(const u8* source, std::size_t source_size,
+                                 const ZSTDDictionary& dictionary) {
+    ZSTD_CCtx* const context = ZSTD_createCCtx();
+    std::vector<u8> compressed(ZSTD_compressBound(source_size));
+    const std::size_t compressed_size =
+        ZSTD_compress_usingCDict(context, compressed.data(), compressed.size(), source,
+                                 source_size, dictionary.impl->cdict);
+    ZSTD_freeCCtx(context);
+    if (ZSTD_isError(compressed_size)) {
+        return {};
+    }
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
+std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed,
+                                   const ZSTDDictionary& dictionary) {
+    const std::size_t decompressed_size =
+        ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+    if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+        return {};
+    }
+    std::vector<u8> decompressed(decompressed_size);
+    ZSTD_DCtx* const context = ZSTD_createDCtx();
+    const std::size_t result =
+        ZSTD_decompress_usingDDict(context, decompressed.data(), decompressed.size(),
+                                   compressed.data(), compressed.size(), dictionary.impl->ddict);
+    ZSTD_freeDCtx(context);
+    if (ZSTD_isError(result) || result != decompressed_size) {
+        return {};
+    }
+    return decompressed;
+}
+
+struct ZSTDCompressBuffer::Impl {
+    explicit Impl(std::ostream& sink_) : sink{sink_}, context{ZSTD_createCCtx()} {}
+
+    ~Impl() {
+        ZSTD_freeCCtx(context);
+    }
+
+    std::ostream& sink;
+    ZSTD_CCtx* context;
+    std::vector<char> input;
+    std::vector<char> output;
+};
+
+ZSTDCompressBuffer::ZSTDCompressBuffer(std::ostream& sink, s32 compression_level,
+                                       const ZSTDDictionary* dictionary)
+    : impl{std::make_unique<Impl>(sink)} {
+    if (dictionary) {
+        ZSTD_CCtx_refCDict(impl->context, dictionary->impl->cdict);
+    } else {
+        ZSTD_CCtx_setParameter(impl->context, ZSTD_c_compressionLevel,
+                               std::clamp(compression_level, 1, ZSTD_maxCLevel()));
+    }
+    impl->input.resize(ZSTD_CStreamInSize());
+    impl->output.resize(ZSTD_CStreamOutSize());
+    setp(impl->input.data(), impl->input.data() + impl->input.size());
+}
+
+ZSTDCompressBuffer::~ZSTDCompressBuffer() = default;
+
+void ZSTDCompressBuffer::EndFrame() {
+    Compress(true);
+}
+
+ZSTDCompressBuffer::int_type ZSTDCompressBuffer::overflow(int_type ch) {
+    Compress(false);
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int ZSTDCompressBuffer::sync() {
+    Compress(false);
+    return 0;
+}
+
+void ZSTDCompressBuffer::Compress(bool end_frame) {
+    ZSTD_inBuffer input{pbase(), static_cast<size_t>(pptr() - pbase()), 0};
+    const ZSTD_EndDirective mode = end_frame ? ZSTD_e_end : ZSTD_e_continue;
+    while (true) {
+        ZSTD_outBuffer output{impl->output.data(), impl->output.size(), 0};
+        const size_t remaining = ZSTD_compressStream2(impl->context, &output, &input, mode);
+        if (ZSTD_isError(remaining)) {
+            throw std::ios_base::failure(ZSTD_getErrorName(remaining));
+        }
+        impl->sink.write(impl->output.data(), static_cast<std::streamsize>(output.pos));
+        // Without ending the frame, the context buffers what it does not have to output yet
+        if (end_frame ? remaining == 0 : input.pos == input.size) {
+            break;
+        }
+    }
+    setp(impl->input.data(), impl->input.data() + impl->input.size());
+}
+
+struct ZSTDDecompressBuffer::Impl {
+    explicit Impl(std::istream& source_) : source{source_}, context{ZSTD_createDCtx()} {}
+
+    ~Impl() {
+        ZSTD_freeDCtx(context);
+    }
+
+    std::istream& source;
+    ZSTD_DCtx* context;
+    std::vector<char> input;
+    std::vector<char> output;
+    ZSTD_inBuffer input_buffer{};
+    /// Zero when the last frame was decoded entirely
+    size_t frame_remaining{};
+    /// Bytes decompressed before the current contents of the output buffer
+    u64 position{};
+};
+
+ZSTDDecompressBuffer::ZSTDDecompressBuffer(std::istream& source, const ZSTDDictionary* dictionary)
+    : impl{std::make_unique<Impl>(source)} {
+    if (dictionary) {
+        ZSTD_DCtx_refDDict(impl->context, dictionary->impl->ddict);
+    }
+    impl->input.resize(ZSTD_DStreamInSize());
+    impl->output.resize(ZSTD_DStreamOutSize());
+    impl->input_buffer = ZSTD_inBuffer{impl->input.data(), 0, 0};
+}
+
+ZSTDDecompressBuffer::~ZSTDDecompressBuffer() = default;
+
+ZSTDDecompressBuffer::int_type ZSTDDecompressBuffer::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    impl->position += static_cast<u64>(egptr() - eback());
+    setg(impl->output.data(), impl->output.data(), impl->output.data());
+    while (true) {
+        ZSTD_inBuffer& input = impl->input_buffer;
+        if (input.pos == input.size) {
+            // Read from the stream buffer directly, so the end of the source does not fail it
+            const std::streamsize read = impl->source.rdbuf()->sgetn(
+                impl->input.data(), static_cast<std::streamsize>(impl->input.size()));
+            if (read <= 0) {
+                if (impl->frame_remaining != 0) {
+                    throw std::ios_base::failure("Truncated Zstandard frame");
+                }
+                return traits_type::eof();
+            }
+            input = ZSTD_inBuffer{impl->input.data(), static_cast<size_t>(read), 0};
+        }
+        ZSTD_outBuffer output{impl->output.data(), impl->output.size(), 0};
+        impl->frame_remaining = ZSTD_decompressStream(impl->context, &output, &input);
+        if (ZSTD_isError(impl->frame_remaining)) {
+            throw std::ios_base::failure(ZSTD_getErrorName(impl->frame_remaining));
+        }
+        if (output.pos != 0) {
+            setg(impl->output.data(), impl->output.data(), impl->output.data() + output.pos);
+            return traits_type::to_int_type(*gptr());
+        }
+    }
+}
+
+ZSTDDecompressBuffer::pos_type ZSTDDecompressBuffer::seekoff(off_type off,
+                                                             std::ios_base::seekdir dir,
+                                                             std::ios_base::openmode which) {
+    // Only telling the position is supported
+    if (off != 0 || dir != std::ios_base::cur || (which & std::ios_base::in) == 0) {
+        return pos_type(off_type(-1));
+    }
+    return pos_type(static_cast<off_type>(impl->position) + (gptr() - eback()));
+}
+
 } // namespace Common::Compression
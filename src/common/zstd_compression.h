@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <istream>
+#include <memory>
+#include <ostream>
 #include <span>
+#include <streambuf>
 #include <vector>
 
 #include "common/common_types.h"
@@ -42,4 +46,125 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed);
 
+/**
+ * Zstandard dictionary, prepared once for both compression and decompression. Dictionaries make
+ * small inputs sharing a structure, like the entries of a cache, compress much better.
+ *
+ * Sharing a dictionary between threads is safe.
+ */
+class ZSTDDictionary {
+public:
+    /**
+     * @param data              The dictionary, usually from TrainDictionaryZSTD.
+     * @param compression_level The level data is compressed at with the dictionary.
+     */
+    explicit ZSTDDictionary(std::vector<u8> data, s32 compression_level);
+    ~ZSTDDictionary();
+
+    ZSTDDictionary(const ZSTDDictionary&) = delete;
+    ZSTDDictionary& operator=(const ZSTDDictionary&) = delete;
+
+    /// Returns the raw dictionary, as it has to be stored next to the data compressed with it
+    [[nodiscard]] std::span<const u8> Data() const noexcept;
+
+private:
+    friend class ZSTDCompressBuffer;
+    friend class ZSTDDecompressBuffer;
+    friend std::vector<u8> CompressDataZSTD(const u8*, std::size_t, const ZSTDDictionary&);
+    friend std::vector<u8> DecompressDataZSTD(std::span<const u8>, const ZSTDDictionary&);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * Trains a Zstandard dictionary over samples of the data it will compress.
+ *
+ * @param samples      The samples, one after another.
+ * @param sample_sizes The size of each sample in samples.
+ * @param max_size     The maximum size of the dictionary.
+ *
+ * @return the dictionary, or an empty vector when there are not enough samples to train one.
+ */
+[[nodiscard]] std::vector<u8> TrainDictionaryZSTD(std::span<const u8> samples,
+                                                  std::span<const size_t> sample_sizes,
+                                                  size_t max_size);
+
+/**
+ * Compresses a source memory region with Zstandard and a dictionary.
+ *
+ * @param source      The uncompressed source memory region.
+ * @param source_size The size of the uncompressed source memory region.
+ * @param dictionary  The dictionary, at its compression level.
+ *
+ * @return the compressed data.
+ */
+[[nodiscard]] std::vector<u8> CompressDataZSTD(const u8* source, std::size_t source_size,
+                                               const ZSTDDictionary& dictionary);
+
+/**
+ * Decompresses a source memory region compressed with Zstandard and a dictionary.
+ *
+ * @param compressed the compressed source memory region.
+ * @param dictionary the dictionary it was compressed with.
+ *
+ * @return the decompressed data.
+ */
+[[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed,
+                                                 const ZSTDDictionary& dictionary);
+
+/**
+ * Stream buffer compressing what is written to it into Zstandard frames on a sink stream.
+ * Wrap it in a std::ostream to write through it, and call EndFrame to finish each frame.
+ * Errors throw std::ios_base::failure.
+ */
+class ZSTDCompressBuffer final : public std::streambuf {
+public:
+    /**
+     * @param sink              The stream compressed frames are written to.
+     * @param compression_level The used compression level, ignored with a dictionary.
+     * @param dictionary        The dictionary to compress with, when not null.
+     */
+    explicit ZSTDCompressBuffer(std::ostream& sink, s32 compression_level,
+                                const ZSTDDictionary* dictionary = nullptr);
+    ~ZSTDCompressBuffer() override;
+
+    /// Writes the rest of the current frame to the sink, the next writes start a new frame
+    void EndFrame();
+
+protected:
+    int_type overflow(int_type ch) override;
+    int sync() override;
+
+private:
+    void Compress(bool end_frame);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * Stream buffer decompressing the Zstandard frames read from a source stream, as they are read.
+ * Concatenated frames read as a single stream. Wrap it in a std::istream to read through it.
+ * Corrupted or truncated frames throw std::ios_base::failure.
+ */
+class ZSTDDecompressBuffer final : public std::streambuf {
+public:
+    /**
+     * @param source     The stream compressed frames are read from, up to its end.
+     * @param dictionary The dictionary the frames were compressed with, when not null.
+     */
+    explicit ZSTDDecompressBuffer(std::istream& source, const ZSTDDictionary* dictionary = nullptr);
+    ~ZSTDDecompressBuffer() override;
+
+protected:
+    int_type underflow() override;
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
 } // namespace Common::Compression
@@ -175,7 +175,7 @@ public:
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
-std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* page_table) const {
+std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* page_table) {
     Dynarmic::A32::UserConfig config;
     config.callbacks = m_cb.get();
     config.coprocessors[15] = m_cp15;
@@ -300,6 +300,7 @@ std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* pa
         }
     }
 
+    m_code_cache_memory.Set(config.code_cache_size);
     return std::make_unique<Dynarmic::A32::Jit>(config);
 }
 
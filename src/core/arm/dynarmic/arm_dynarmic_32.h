@@ -5,6 +5,7 @@
 
 #include <dynarmic/interface/A32/a32.h>
 
+#include "common/memory_accounting.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 
@@ -57,13 +58,14 @@ private:
     friend class DynarmicCallbacks32;
     friend class DynarmicCP15;
 
-    std::shared_ptr<Dynarmic::A32::Jit> MakeJit(Common::PageTable* page_table) const;
+    std::shared_ptr<Dynarmic::A32::Jit> MakeJit(Common::PageTable* page_table);
 
     std::unique_ptr<DynarmicCallbacks32> m_cb{};
     std::shared_ptr<DynarmicCP15> m_cp15{};
     std::size_t m_core_index{};
 
     std::shared_ptr<Dynarmic::A32::Jit> m_jit{};
+    Common::MemoryAccount m_code_cache_memory{Common::MemoryCategory::JitCodeCache};
 
     // SVC callback
     u32 m_svc_swi{};
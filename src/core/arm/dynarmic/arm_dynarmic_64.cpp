@@ -223,7 +223,7 @@ public:
 };
 
 std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* page_table,
-                                                           std::size_t address_space_bits) const {
+                                                           std::size_t address_space_bits) {
     Dynarmic::A64::UserConfig config;
 
     // Callbacks
@@ -358,6 +358,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
         }
     }
 
+    m_code_cache_memory.Set(config.code_cache_size);
     return std::make_shared<Dynarmic::A64::Jit>(config);
 }
 
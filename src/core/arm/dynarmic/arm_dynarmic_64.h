@@ -10,6 +10,7 @@
 #include <dynarmic/interface/A64/a64.h>
 #include "common/common_types.h"
 #include "common/hash.h"
+#include "common/memory_accounting.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 
@@ -60,11 +61,12 @@ private:
     friend class DynarmicCallbacks64;
 
     std::shared_ptr<Dynarmic::A64::Jit> MakeJit(Common::PageTable* page_table,
-                                                std::size_t address_space_bits) const;
+                                                std::size_t address_space_bits);
     std::unique_ptr<DynarmicCallbacks64> m_cb{};
     std::size_t m_core_index{};
 
     std::shared_ptr<Dynarmic::A64::Jit> m_jit{};
+    Common::MemoryAccount m_code_cache_memory{Common::MemoryCategory::JitCodeCache};
 
     // SVC callback
     u32 m_svc{};
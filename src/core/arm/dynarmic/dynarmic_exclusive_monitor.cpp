@@ -1,72 +1,106 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <type_traits>
+
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #include "core/memory.h"
 
 namespace Core {
 
 DynarmicExclusiveMonitor::DynarmicExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count_)
-    : monitor{core_count_}, memory{memory_} {}
+    : monitor{core_count_}, kernel_reservations(core_count_), memory{memory_} {}
 
 DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() = default;
 
+// The kernel only uses these for compare and swap loops on a single address. Instead of going
+// through the global monitor, which serializes every core behind one lock, each core keeps its own
+// reservation and the store is a host compare and swap against the value that was read. Guest
+// exclusive stores compare against memory the same way, so they fail when the kernel got there
+// first.
+
+template <typename T>
+T DynarmicExclusiveMonitor::ReadAndReserve(std::size_t core_index, VAddr addr, T value) {
+    auto& reservation = kernel_reservations[core_index];
+    reservation.address = addr;
+    if constexpr (std::is_same_v<T, u128>) {
+        reservation.value = value;
+    } else {
+        reservation.value = {value, 0};
+    }
+    reservation.valid = true;
+    return value;
+}
+
+template <typename T>
+bool DynarmicExclusiveMonitor::WriteReserved(std::size_t core_index, VAddr addr, T value,
+                                             auto&& write_exclusive) {
+    auto& reservation = kernel_reservations[core_index];
+    if (!reservation.valid || reservation.address != addr) {
+        return false;
+    }
+    reservation.valid = false;
+    if constexpr (std::is_same_v<T, u128>) {
+        return write_exclusive(value, reservation.value);
+    } else {
+        return write_exclusive(value, static_cast<T>(reservation.value[0]));
+    }
+}
+
 u8 DynarmicExclusiveMonitor::ExclusiveRead8(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u8>(core_index, addr, [&]() -> u8 { return memory.Read8(addr); });
+    return ReadAndReserve<u8>(core_index, addr, memory.Read8(addr));
 }
 
 u16 DynarmicExclusiveMonitor::ExclusiveRead16(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u16>(core_index, addr, [&]() -> u16 { return memory.Read16(addr); });
+    return ReadAndReserve<u16>(core_index, addr, memory.Read16(addr));
 }
 
 u32 DynarmicExclusiveMonitor::ExclusiveRead32(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u32>(core_index, addr, [&]() -> u32 { return memory.Read32(addr); });
+    return ReadAndReserve<u32>(core_index, addr, memory.Read32(addr));
 }
 
 u64 DynarmicExclusiveMonitor::ExclusiveRead64(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u64>(core_index, addr, [&]() -> u64 { return memory.Read64(addr); });
+    return ReadAndReserve<u64>(core_index, addr, memory.Read64(addr));
 }
 
 u128 DynarmicExclusiveMonitor::ExclusiveRead128(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u128>(core_index, addr, [&]() -> u128 {
-        u128 result;
-        result[0] = memory.Read64(addr);
-        result[1] = memory.Read64(addr + 8);
-        return result;
-    });
+    u128 result;
+    result[0] = memory.Read64(addr);
+    result[1] = memory.Read64(addr + 8);
+    return ReadAndReserve<u128>(core_index, addr, result);
 }
 
 void DynarmicExclusiveMonitor::ClearExclusive(std::size_t core_index) {
-    monitor.ClearProcessor(core_index);
+    kernel_reservations[core_index].valid = false;
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
-    return monitor.DoExclusiveOperation<u8>(core_index, vaddr, [&](u8 expected) -> bool {
-        return memory.WriteExclusive8(vaddr, value, expected);
+    return WriteReserved<u8>(core_index, vaddr, value, [&](u8 new_value, u8 expected) {
+        return memory.WriteExclusive8(vaddr, new_value, expected);
     });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) {
-    return monitor.DoExclusiveOperation<u16>(core_index, vaddr, [&](u16 expected) -> bool {
-        return memory.WriteExclusive16(vaddr, value, expected);
+    return WriteReserved<u16>(core_index, vaddr, value, [&](u16 new_value, u16 expected) {
+        return memory.WriteExclusive16(vaddr, new_value, expected);
     });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) {
-    return monitor.DoExclusiveOperation<u32>(core_index, vaddr, [&](u32 expected) -> bool {
-        return memory.WriteExclusive32(vaddr, value, expected);
+    return WriteReserved<u32>(core_index, vaddr, value, [&](u32 new_value, u32 expected) {
+        return memory.WriteExclusive32(vaddr, new_value, expected);
     });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) {
-    return monitor.DoExclusiveOperation<u64>(core_index, vaddr, [&](u64 expected) -> bool {
-        return memory.WriteExclusive64(vaddr, value, expected);
+    return WriteReserved<u64>(core_index, vaddr, value, [&](u64 new_value, u64 expected) {
+        return memory.WriteExclusive64(vaddr, new_value, expected);
     });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) {
-    return monitor.DoExclusiveOperation<u128>(core_index, vaddr, [&](u128 expected) -> bool {
-        return memory.WriteExclusive128(vaddr, value, expected);
+    return WriteReserved<u128>(core_index, vaddr, value, [&](u128 new_value, u128 expected) {
+        return memory.WriteExclusive128(vaddr, new_value, expected);
     });
 }
 
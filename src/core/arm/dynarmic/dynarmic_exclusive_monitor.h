@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <dynarmic/interface/exclusive_monitor.h>
 
 #include "common/common_types.h"
@@ -38,7 +40,22 @@ public:
 private:
     friend class ArmDynarmic32;
     friend class ArmDynarmic64;
+
+    /// Reservation taken by the kernel on behalf of a core, validated by value on write.
+    struct Reservation {
+        VAddr address;
+        u128 value;
+        bool valid;
+    };
+
+    template <typename T>
+    T ReadAndReserve(std::size_t core_index, VAddr addr, T value);
+
+    template <typename T>
+    bool WriteReserved(std::size_t core_index, VAddr addr, T value, auto&& write_exclusive);
+
     Dynarmic::ExclusiveMonitor monitor;
+    std::vector<Reservation> kernel_reservations;
     Core::Memory::Memory& memory;
 };
 
@@ -4,6 +4,7 @@
 #include <cinttypes>
 #include <memory>
 
+#include "common/logging/log.h"
 #include "common/signal_chain.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/interpreter_visitor.h"
@@ -41,6 +42,21 @@ fpsimd_context* GetFloatingPointState(mcontext_t& host_ctx) {
 using namespace Common::Literals;
 constexpr u32 StackSize = 128_KiB;
 
+// Number of trapping sites reported when a core is destroyed.
+constexpr size_t NumReportedTrapSites = 16;
+
+const char* GetTrapKindName(NCE::TrapKind kind) {
+    switch (kind) {
+    case NCE::TrapKind::Alignment:
+        return "alignment";
+    case NCE::TrapKind::Access:
+        return "access";
+    case NCE::TrapKind::Failed:
+        return "failed";
+    }
+    return "unknown";
+}
+
 } // namespace
 
 void* ArmNce::RestoreGuestContext(void* raw_context) {
@@ -112,6 +128,8 @@ bool ArmNce::HandleFailedGuestFault(GuestContext* guest_ctx, void* raw_info, voi
     auto& host_ctx = static_cast<ucontext_t*>(raw_context)->uc_mcontext;
     auto* info = static_cast<siginfo_t*>(raw_info);
 
+    guest_ctx->parent->m_trap_counters.Record(host_ctx.pc, NCE::TrapKind::Failed);
+
     // We can't handle the access, so determine why we crashed.
     const bool is_prefetch_abort = host_ctx.pc == reinterpret_cast<u64>(info->si_addr);
 
@@ -144,8 +162,10 @@ bool ArmNce::HandleGuestAlignmentFault(GuestContext* guest_ctx, void* raw_info,
     auto& memory = guest_ctx->system->ApplicationMemory();
 
     // Match and execute an instruction.
+    const u64 pc = host_ctx.pc;
     auto next_pc = MatchAndExecuteOneInstruction(memory, &host_ctx, fpctx);
     if (next_pc) {
+        guest_ctx->parent->m_trap_counters.Record(pc, NCE::TrapKind::Alignment);
         host_ctx.pc = *next_pc;
         return true;
     }
@@ -163,6 +183,8 @@ bool ArmNce::HandleGuestAccessFault(GuestContext* guest_ctx, void* raw_info, voi
         (reinterpret_cast<u64>(info->si_addr) & ~Memory::YUZU_PAGEMASK);
     if (guest_ctx->system->ApplicationMemory().InvalidateNCE(addr, Memory::YUZU_PAGESIZE)) {
         // We handled the access successfully and are returning to guest code.
+        auto& host_ctx = static_cast<ucontext_t*>(raw_context)->uc_mcontext;
+        guest_ctx->parent->m_trap_counters.Record(host_ctx.pc, NCE::TrapKind::Access);
         return true;
     }
 
@@ -253,7 +275,20 @@ ArmNce::ArmNce(System& system, bool uses_wall_clock, std::size_t core_index)
     m_guest_ctx.system = &m_system;
 }
 
-ArmNce::~ArmNce() = default;
+ArmNce::~ArmNce() {
+    const u64 alignment_traps = m_trap_counters.GetTotal(NCE::TrapKind::Alignment);
+    const u64 access_traps = m_trap_counters.GetTotal(NCE::TrapKind::Access);
+    const u64 failed_traps = m_trap_counters.GetTotal(NCE::TrapKind::Failed);
+    if (alignment_traps + access_traps + failed_traps == 0) {
+        return;
+    }
+    LOG_INFO(Core_ARM, "Core {} traps: {} alignment, {} access, {} failed", m_core_index,
+             alignment_traps, access_traps, failed_traps);
+    for (const auto& site : m_trap_counters.GetTopSites(NumReportedTrapSites)) {
+        LOG_INFO(Core_ARM, "  pc={:#018x} {} x{}", site.pc, GetTrapKindName(site.kind),
+                 site.count);
+    }
+}
 
 void ArmNce::Initialize() {
     if (m_thread_id == -1) {
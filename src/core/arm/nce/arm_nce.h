@@ -7,6 +7,7 @@
 
 #include "core/arm/arm_interface.h"
 #include "core/arm/nce/guest_context.h"
+#include "core/arm/nce/trap_counters.h"
 
 namespace Core::Memory {
 class Memory;
@@ -90,6 +91,9 @@ public:
 
     // Stack for signal processing.
     std::unique_ptr<u8[]> m_stack{};
+
+    // Traps taken by guest code running on this core.
+    NCE::TrapCounters m_trap_counters{};
 };
 
 } // namespace Core
@@ -76,7 +76,13 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
 
         // SVC
         if (auto svc = SVC{inst}; svc.Verify()) {
-            WriteSvcTrampoline(AddRelocations(), svc.GetValue());
+            // svcGetSystemTick only returns CNTPCT_EL0 in X0, read it in place instead of
+            // leaving the guest for the kernel
+            if (svc.GetValue() == static_cast<u32>(Kernel::Svc::SvcId::GetSystemTick)) {
+                WriteCntpctHandler(AddRelocations(), X0);
+            } else {
+                WriteSvcTrampoline(AddRelocations(), svc.GetValue());
+            }
             continue;
         }
 
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "core/arm/nce/trap_counters.h"
+
+namespace Core::NCE {
+
+std::vector<TrapCounters::Site> TrapCounters::GetTopSites(size_t max_sites) const {
+    std::vector<Site> sites;
+    for (const Entry& entry : entries) {
+        const u64 key = entry.key.load(std::memory_order_relaxed);
+        if (key == 0) {
+            continue;
+        }
+        sites.push_back(Site{
+            .pc = key & ~u64{3},
+            .kind = static_cast<TrapKind>((key & 3) - 1),
+            .count = entry.count.load(std::memory_order_relaxed),
+        });
+    }
+    const size_t num_sites = std::min(max_sites, sites.size());
+    std::partial_sort(sites.begin(), sites.begin() + num_sites, sites.end(),
+                      [](const Site& lhs, const Site& rhs) { return lhs.count > rhs.count; });
+    sites.resize(num_sites);
+    return sites;
+}
+
+} // namespace Core::NCE
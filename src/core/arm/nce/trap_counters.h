@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core::NCE {
+
+enum class TrapKind : u32 {
+    Alignment, ///< Alignment fault emulated by the interpreter
+    Access,    ///< Access fault resolved by the memory subsystem
+    Failed,    ///< Fault that could not be handled and was skipped
+};
+
+/**
+ * Counts the traps taken by guest code per instruction address.
+ *
+ * Recording is lock-free and safe to do from a signal handler. Sites are kept in a fixed size
+ * open addressing table, traps that don't fit in it only count towards the totals.
+ */
+class TrapCounters {
+public:
+    struct Site {
+        u64 pc;
+        TrapKind kind;
+        u64 count;
+    };
+
+    void Record(u64 pc, TrapKind kind) {
+        totals[static_cast<size_t>(kind)].fetch_add(1, std::memory_order_relaxed);
+
+        // Instructions are word aligned, so the kind fits in the low bits and the key is never 0.
+        const u64 key = (pc & ~u64{3}) | (static_cast<u64>(kind) + 1);
+        const size_t hash = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32);
+        for (size_t probe = 0; probe < MaxProbes; probe++) {
+            Entry& entry = entries[(hash + probe) % NumEntries];
+            u64 current = entry.key.load(std::memory_order_relaxed);
+            if (current == 0 &&
+                entry.key.compare_exchange_strong(current, key, std::memory_order_relaxed)) {
+                current = key;
+            }
+            if (current == key) {
+                entry.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] u64 GetTotal(TrapKind kind) const {
+        return totals[static_cast<size_t>(kind)].load(std::memory_order_relaxed);
+    }
+
+    /// Returns up to max_sites sites sorted by descending trap count.
+    [[nodiscard]] std::vector<Site> GetTopSites(size_t max_sites) const;
+
+private:
+    static constexpr size_t NumEntries = 1024;
+    static constexpr size_t MaxProbes = 16;
+
+    struct Entry {
+        std::atomic<u64> key{};
+        std::atomic<u64> count{};
+    };
+
+    std::array<Entry, NumEntries> entries{};
+    std::array<std::atomic<u64>, 3> totals{};
+};
+
+} // namespace Core::NCE
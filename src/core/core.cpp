@@ -1,11 +1,16 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <exception>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "audio_core/audio_core.h"
 #include "common/fs/fs.h"
@@ -14,6 +19,7 @@
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
+#include "common/trace.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -94,6 +100,60 @@ FileSys::StorageId GetStorageIdForFrontendSlot(
     }
 }
 
+/// Wall time spent in each phase of loading an application
+class LoadPhaseTimes {
+public:
+    /// Times a phase for the lifetime of the scope, phases may run on any thread
+    class Phase {
+    public:
+        explicit Phase(LoadPhaseTimes& times_, const char* name_)
+            : times{times_}, name{name_}, begin{Common::Trace::Now()} {}
+
+        ~Phase() {
+            times.Add(name, begin, Common::Trace::Now());
+        }
+
+        YUZU_NON_COPYABLE(Phase);
+        YUZU_NON_MOVEABLE(Phase);
+
+    private:
+        LoadPhaseTimes& times;
+        const char* name;
+        u64 begin;
+    };
+
+    /// Logs the phases on one line of name=milliseconds pairs and adds them to the telemetry
+    void Report(Core::TelemetrySession& telemetry_session) {
+        constexpr auto performance = Common::Telemetry::FieldType::Performance;
+        Add("Total", begin, Common::Trace::Now());
+
+        std::scoped_lock lock{mutex};
+        std::string line;
+        for (const auto& [name, nanoseconds] : phases) {
+            const double milliseconds = static_cast<double>(nanoseconds) / 1'000'000.0;
+            line += fmt::format(" {}={:.1f}", name, milliseconds);
+            telemetry_session.AddField(performance, fmt::format("Load_{}_MS", name).c_str(),
+                                       milliseconds);
+        }
+        LOG_INFO(Core, "Load phases (ms):{}", line);
+    }
+
+private:
+    void Add(const char* name, u64 phase_begin, u64 phase_end) {
+        if constexpr (Common::Trace::IsCompiledIn(Common::Trace::Category::Boot)) {
+            if (Common::Trace::IsEnabled()) {
+                Common::Trace::Record(Common::Trace::Category::Boot, name, phase_begin, phase_end);
+            }
+        }
+        std::scoped_lock lock{mutex};
+        phases.emplace_back(name, phase_end - phase_begin);
+    }
+
+    const u64 begin{Common::Trace::Now()};
+    std::mutex mutex;
+    std::vector<std::pair<const char*, u64>> phases;
+};
+
 } // Anonymous namespace
 
 FileSys::VirtualFile GetGameFileFromPath(const FileSys::VirtualFilesystem& vfs,
@@ -296,23 +356,31 @@ struct System::Impl {
         cpu_manager.Initialize();
     }
 
-    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window) {
+    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window,
+                                                  LoadPhaseTimes& load_times) {
         /// Reset all glue registrations
         arp_manager.ResetAll();
 
         telemetry_session = std::make_unique<Core::TelemetrySession>();
 
-        host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
-        gpu_core = VideoCore::CreateGPU(emu_window, system);
-        if (!gpu_core) {
-            return SystemResultStatus::ErrorVideoCore;
+        {
+            const LoadPhaseTimes::Phase phase{load_times, "GPU"};
+            host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
+            gpu_core = VideoCore::CreateGPU(emu_window, system);
+            if (!gpu_core) {
+                return SystemResultStatus::ErrorVideoCore;
+            }
+        }
+        {
+            const LoadPhaseTimes::Phase phase{load_times, "Audio"};
+            audio_core = std::make_unique<AudioCore::AudioCore>(system);
+        }
+        {
+            const LoadPhaseTimes::Phase phase{load_times, "Services"};
+            service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
+            services = std::make_unique<Service::Services>(service_manager, system,
+                                                           stop_event.get_token());
         }
-
-        audio_core = std::make_unique<AudioCore::AudioCore>(system);
-
-        service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
-        services =
-            std::make_unique<Service::Services>(service_manager, system, stop_event.get_token());
 
         is_powered_on = true;
         exit_locked = false;
@@ -335,11 +403,26 @@ struct System::Impl {
     SystemResultStatus Load(System& system, Frontend::EmuWindow& emu_window,
                             const std::string& filepath,
                             Service::AM::FrontendAppletParameters& params) {
-        app_loader = Loader::GetLoader(system, GetGameFileFromPath(virtual_filesystem, filepath),
-                                       params.program_id, params.program_index);
+        Common::Trace::SetEnabled(Settings::values.enable_tracing.GetValue());
+
+        LoadPhaseTimes load_times;
+
+        // Parsing the containers of the application does not depend on the kernel, overlap it
+        // with initializing the kernel as both take a while.
+        auto loader_future = std::async(std::launch::async, [&] {
+            const LoadPhaseTimes::Phase phase{load_times, "Loader"};
+            return Loader::GetLoader(system, GetGameFileFromPath(virtual_filesystem, filepath),
+                                     params.program_id, params.program_index);
+        });
+        {
+            const LoadPhaseTimes::Phase phase{load_times, "Kernel"};
+            InitializeKernel(system);
+        }
+        app_loader = loader_future.get();
 
         if (!app_loader) {
             LOG_CRITICAL(Core, "Failed to obtain loader for {}!", filepath);
+            ShutdownMainProcess();
             return SystemResultStatus::ErrorGetLoader;
         }
 
@@ -354,14 +437,17 @@ struct System::Impl {
 
         LOG_INFO(Core, "Loading {} ({})", name, params.program_id);
 
-        InitializeKernel(system);
-
         // Create the application process.
         auto main_process = Kernel::KProcess::Create(system.Kernel());
         Kernel::KProcess::Register(system.Kernel(), main_process);
         kernel.AppendNewProcess(main_process);
         kernel.MakeApplicationProcess(main_process);
-        const auto [load_result, load_parameters] = app_loader->Load(*main_process, system);
+        Loader::AppLoader::LoadResult process_load;
+        {
+            const LoadPhaseTimes::Phase phase{load_times, "Process"};
+            process_load = app_loader->Load(*main_process, system);
+        }
+        const auto& [load_result, load_parameters] = process_load;
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
             ShutdownMainProcess();
@@ -371,7 +457,8 @@ struct System::Impl {
         }
 
         // Set up the rest of the system.
-        SystemResultStatus init_result{SetupForApplicationProcess(system, emu_window)};
+        SystemResultStatus init_result{
+            SetupForApplicationProcess(system, emu_window, load_times)};
         if (init_result != SystemResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
                          static_cast<int>(init_result));
@@ -425,6 +512,8 @@ struct System::Impl {
             room_member->SendGameInfo(game_info);
         }
 
+        load_times.Report(*telemetry_session);
+
         status = SystemResultStatus::Success;
         return status;
     }
@@ -432,6 +521,10 @@ struct System::Impl {
     void ShutdownMainProcess() {
         SetShuttingDown(true);
 
+        if (Common::Trace::IsEnabled()) {
+            Common::Trace::Export();
+        }
+
         // Log last frame performance stats if game was loaded
         if (perf_stats) {
             const auto perf_results = GetAndResetPerfStats();
@@ -478,6 +571,8 @@ struct System::Impl {
         kernel.Shutdown();
         stop_event = {};
         Network::RestartSocketOperations();
+        Common::Trace::SetEnabled(false);
+        Common::Trace::Clear();
 
         if (auto room_member = room_network.GetRoomMember().lock()) {
             Network::GameInfo game_info{};
@@ -707,9 +802,27 @@ std::span<GPUDirtyMemoryManager> System::GetGPUDirtyMemoryManager() {
     return impl->gpu_dirty_memory_managers;
 }
 
-void System::GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback) {
+void System::GatherGPUDirtyMemory(std::vector<std::pair<PAddr, size_t>>& ranges) {
+    const size_t first = ranges.size();
     for (auto& manager : impl->gpu_dirty_memory_managers) {
-        manager.Gather(callback);
+        manager.Gather(ranges);
+    }
+    // Coalesce ranges written by different cores and adjacent write bitmaps
+    const auto begin = ranges.begin() + first;
+    std::sort(begin, ranges.end());
+    auto last = begin;
+    for (auto it = begin; it != ranges.end(); ++it) {
+        if (it != begin && it->first <= last->first + last->second) {
+            last->second = std::max(last->second, it->first + it->second - last->first);
+            continue;
+        }
+        if (it != begin) {
+            ++last;
+        }
+        *last = *it;
+    }
+    if (begin != ranges.end()) {
+        ranges.erase(last + 1, ranges.end());
     }
 }
 
@@ -1071,6 +1184,7 @@ void System::Exit() {
 
 void System::ApplySettings() {
     impl->RefreshTime(*this);
+    Settings::UpdateHotValues();
 
     if (IsPoweredOn()) {
         Renderer().RefreshBaseSettings();
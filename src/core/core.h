@@ -10,6 +10,7 @@
 #include <mutex>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
@@ -229,7 +230,8 @@ public:
 
     std::span<GPUDirtyMemoryManager> GetGPUDirtyMemoryManager();
 
-    void GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback);
+    /// Appends the GPU cached memory written by the CPU since the last call, sorted and merged
+    void GatherGPUDirtyMemory(std::vector<std::pair<PAddr, size_t>>& ranges);
 
     [[nodiscard]] size_t GetCurrentHostThreadID() const;
 
@@ -74,6 +74,7 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
     event_queue.clear();
+    event_handles.clear();
     event.Set();
 }
 
@@ -123,6 +124,7 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
 
         auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
         (*h).handle = h;
+        event_handles.emplace(event_type.get(), h);
     }
 
     event.Set();
@@ -139,6 +141,7 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         auto h{event_queue.emplace(
             Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
         (*h).handle = h;
+        event_handles.emplace(event_type.get(), h);
     }
 
     event.Set();
@@ -149,17 +152,11 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
+        const auto [begin, end] = event_handles.equal_range(event_type.get());
+        for (auto it = begin; it != end; ++it) {
+            event_queue.erase(it->second);
         }
+        event_handles.erase(begin, end);
 
         event_type->sequence_number++;
     }
@@ -179,8 +176,8 @@ void CoreTiming::Idle() {
     cpu_ticks += 1000U;
 }
 
-void CoreTiming::ResetTicks() {
-    downcount = MAX_SLICE_LENGTH;
+void CoreTiming::ResetTicks(s64 slice_scale) {
+    downcount = MAX_SLICE_LENGTH * slice_scale;
 }
 
 u64 CoreTiming::GetClockTicks() const {
@@ -209,6 +206,13 @@ std::optional<s64> CoreTiming::Advance() {
             const auto evt_sequence_num = event_type->sequence_number;
 
             if (evt.reschedule_time == 0) {
+                const auto [begin, end] = event_handles.equal_range(event_type.get());
+                const auto it = std::find_if(begin, end, [&evt](const auto& entry) {
+                    return &*entry.second == &evt;
+                });
+                if (it != end) {
+                    event_handles.erase(it);
+                }
                 event_queue.pop();
 
                 basic_lock.unlock();
@@ -11,6 +11,7 @@
 #include <optional>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #include <boost/heap/fibonacci_heap.hpp>
 
@@ -111,7 +112,8 @@ public:
 
     void AddTicks(u64 ticks_to_add);
 
-    void ResetTicks();
+    /// Starts a new slice, slice_scale times as long as the default one
+    void ResetTicks(s64 slice_scale = 1);
 
     void Idle();
 
@@ -159,6 +161,8 @@ private:
 
     heap_t event_queue;
     u64 event_fifo_id = 0;
+    /// Queued events of each type, so they can be unscheduled without scanning the whole queue.
+    std::unordered_multimap<const EventType*, heap_t::handle_type> event_handles;
 
     Common::Event event{};
     Common::Event pause_event{};
@@ -1,10 +1,14 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#include "common/cpu_topology.h"
 #include "common/fiber.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -98,6 +102,7 @@ void CpuManager::MultiCoreRunIdleThread() {
     while (true) {
         auto& physical_core = kernel.CurrentPhysicalCore();
         if (!physical_core.IsInterrupted()) {
+            TRACE_SCOPE(Cpu, "Idle");
             physical_core.Idle();
         }
 
@@ -121,9 +126,18 @@ void CpuManager::SingleCoreRunGuestThread() {
             physical_core = &kernel.CurrentPhysicalCore();
         }
 
-        kernel.SetIsPhantomModeForSingleCore(true);
-        system.CoreTiming().Advance();
-        kernel.SetIsPhantomModeForSingleCore(false);
+        {
+            TRACE_SCOPE(Cpu, "CoreTiming");
+            kernel.SetIsPhantomModeForSingleCore(true);
+            system.CoreTiming().Advance();
+            kernel.SetIsPhantomModeForSingleCore(false);
+        }
+
+        // A thread that stopped for a supervisor call runs the rest of its slice, instead of
+        // switching to the next core right away.
+        if (system.CoreTiming().GetDowncount() > 0 && !physical_core->IsInterrupted()) {
+            continue;
+        }
 
         PreemptSingleCore();
         HandleInterrupt();
@@ -154,9 +168,28 @@ void CpuManager::PreemptSingleCore(bool from_running_environment) {
         system.CoreTiming().Advance();
         kernel.SetIsPhantomModeForSingleCore(false);
     }
-    current_core.store((current_core + 1) % Core::Hardware::NUM_CPU_CORES);
-    system.CoreTiming().ResetTicks();
-    kernel.Scheduler(current_core).PreemptSingleCore();
+
+    const std::size_t previous_core = current_core;
+    const std::size_t next_core = NextSingleCore();
+    const bool slice_expired = system.CoreTiming().GetDowncount() <= 0;
+    // A core running alone gets longer slices while it keeps using all of them, which saves
+    // the exits from the JIT. They go back to normal as soon as another core has work.
+    if (from_running_environment && next_core == previous_core && slice_expired) {
+        slice_scale = std::min(slice_scale * 2, max_slice_scale);
+    } else {
+        slice_scale = 1;
+    }
+    current_core.store(next_core);
+    system.CoreTiming().ResetTicks(static_cast<s64>(slice_scale));
+
+    auto& scheduler = kernel.Scheduler(current_core);
+    if (from_running_environment && next_core == previous_core &&
+        scheduler.GetHighestPriorityThread() == scheduler.GetSchedulerCurrentThread()) {
+        // The running thread would be scheduled again, skip the switch.
+        idle_count = 0;
+        return;
+    }
+    scheduler.PreemptSingleCore();
 
     // We've now been scheduled again, and we may have exchanged schedulers.
     // Reload the scheduler in case it's different.
@@ -165,6 +198,22 @@ void CpuManager::PreemptSingleCore(bool from_running_environment) {
     }
 }
 
+std::size_t CpuManager::NextSingleCore() const {
+    auto& kernel = system.Kernel();
+    // Skip the cores that would only run their idle thread, unless they have to be interrupted.
+    for (std::size_t offset = 1; offset <= Core::Hardware::NUM_CPU_CORES; ++offset) {
+        const std::size_t core = (current_core + offset) % Core::Hardware::NUM_CPU_CORES;
+        const auto& scheduler = kernel.Scheduler(core);
+        const auto* const thread = scheduler.GetHighestPriorityThread();
+        if ((thread != nullptr && thread != scheduler.GetIdleThread()) ||
+            kernel.PhysicalCore(core).IsInterrupted()) {
+            return core;
+        }
+    }
+    // Every core is idle, keep rotating so that they all advance their idle time.
+    return (current_core + 1) % Core::Hardware::NUM_CPU_CORES;
+}
+
 void CpuManager::GuestActivate() {
     // Similar to the HorizonKernelMain callback in HOS
     auto& kernel = system.Kernel();
@@ -194,7 +243,9 @@ void CpuManager::RunThread(std::stop_token token, std::size_t core) {
     }
     MicroProfileOnThreadCreate(name.c_str());
     Common::SetCurrentThreadName(name.c_str());
+    Common::Trace::SetThreadName(name.c_str());
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
+    Common::PinCurrentThreadToGuestCore(core);
     auto& data = core_data[core];
     data.host_context = Common::Fiber::ThreadToFiber();
 
@@ -81,6 +81,9 @@ private:
     void SingleCoreRunGuestThread();
     void SingleCoreRunIdleThread();
 
+    /// Returns the core to run after the current one in single core mode
+    std::size_t NextSingleCore() const;
+
     void GuestActivate();
     void HandleInterrupt();
     void ShutdownThread();
@@ -98,8 +101,10 @@ private:
     bool is_multicore{};
     std::atomic<std::size_t> current_core{};
     std::size_t idle_count{};
+    std::size_t slice_scale{1};
     std::size_t num_cores{};
     static constexpr std::size_t max_cycle_runs = 5;
+    static constexpr std::size_t max_slice_scale = 8;
 
     System& system;
 };
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <latch>
+#include <thread>
+#include "common/alignment.h"
+#include "common/div_ceil.h"
+#include "common/literals.h"
+#include "common/swap.h"
+#include "common/thread_worker.h"
+#include "core/crypto/aes_accel.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#include <windows.h>
+#else
+#include <arm_neon.h>
+#endif
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+#if defined(__GNUC__) && defined(ARCHITECTURE_x86_64)
+#define AES_TARGET __attribute__((target("aes")))
+#elif defined(__clang__) && defined(ARCHITECTURE_arm64)
+#define AES_TARGET __attribute__((target("aes")))
+#elif defined(__GNUC__) && defined(ARCHITECTURE_arm64)
+#define AES_TARGET __attribute__((target("+crypto")))
+#else
+#define AES_TARGET
+#endif
+
+namespace Core::Crypto {
+namespace {
+
+using namespace Common::Literals;
+
+constexpr std::size_t BlockSize = 0x10;
+
+// Transforms at least this large are split across the crypto worker threads.
+constexpr std::size_t ParallelThreshold = 1_MiB;
+
+// Smallest amount of data handed to a single worker thread.
+constexpr std::size_t MinParallelChunkSize = 256_KiB;
+
+// Number of blocks encrypted at once, enough to hide the latency of the AES round instructions.
+constexpr std::size_t Interleave = 8;
+
+constexpr std::array<u8, 256> SBox{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+constexpr std::array<u8, 10> RoundConstants{0x01, 0x02, 0x04, 0x08, 0x10,
+                                            0x20, 0x40, 0x80, 0x1b, 0x36};
+
+bool DetectAesSupport() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps = Common::GetCPUCaps();
+    return caps.aes;
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    return true;
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#elif defined(ARCHITECTURE_arm64) && defined(_WIN32)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+#else
+    return false;
+#endif
+}
+
+/// Big-endian 128-bit CTR counter, kept as host-endian halves.
+struct Counter {
+    explicit Counter(const std::array<u8, 0x10>& bytes) {
+        std::memcpy(&high, bytes.data(), sizeof(high));
+        std::memcpy(&low, bytes.data() + sizeof(high), sizeof(low));
+        high = Common::swap64(high);
+        low = Common::swap64(low);
+    }
+
+    void Store(std::array<u8, 0x10>& bytes) const {
+        const u64 high_be = Common::swap64(high);
+        const u64 low_be = Common::swap64(low);
+        std::memcpy(bytes.data(), &high_be, sizeof(high_be));
+        std::memcpy(bytes.data() + sizeof(high_be), &low_be, sizeof(low_be));
+    }
+
+    void Generate(u8* out, std::size_t num_blocks) {
+        for (std::size_t i = 0; i < num_blocks; ++i) {
+            const u64 high_be = Common::swap64(high);
+            const u64 low_be = Common::swap64(low);
+            std::memcpy(out + i * BlockSize, &high_be, sizeof(high_be));
+            std::memcpy(out + i * BlockSize + sizeof(high_be), &low_be, sizeof(low_be));
+            high += ++low == 0 ? 1 : 0;
+        }
+    }
+
+    void Advance(u64 num_blocks) {
+        low += num_blocks;
+        high += low < num_blocks ? 1 : 0;
+    }
+
+    u64 high;
+    u64 low;
+};
+
+#if defined(ARCHITECTURE_x86_64)
+
+AES_TARGET void EncryptBlocks(const Aes128RoundKeys& round_keys, u8* blocks,
+                              std::size_t num_blocks) {
+    __m128i keys[11];
+    for (std::size_t i = 0; i < round_keys.size(); ++i) {
+        keys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_keys[i].data()));
+    }
+
+    __m128i state[Interleave];
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        state[i] = _mm_xor_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + i * BlockSize)), keys[0]);
+    }
+    for (std::size_t round = 1; round < 10; ++round) {
+        for (std::size_t i = 0; i < num_blocks; ++i) {
+            state[i] = _mm_aesenc_si128(state[i], keys[round]);
+        }
+    }
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        state[i] = _mm_aesenclast_si128(state[i], keys[10]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(blocks + i * BlockSize), state[i]);
+    }
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+AES_TARGET void EncryptBlocks(const Aes128RoundKeys& round_keys, u8* blocks,
+                              std::size_t num_blocks) {
+    uint8x16_t keys[11];
+    for (std::size_t i = 0; i < round_keys.size(); ++i) {
+        keys[i] = vld1q_u8(round_keys[i].data());
+    }
+
+    uint8x16_t state[Interleave];
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        state[i] = vld1q_u8(blocks + i * BlockSize);
+    }
+    for (std::size_t round = 0; round < 9; ++round) {
+        for (std::size_t i = 0; i < num_blocks; ++i) {
+            state[i] = vaesmcq_u8(vaeseq_u8(state[i], keys[round]));
+        }
+    }
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        state[i] = veorq_u8(vaeseq_u8(state[i], keys[9]), keys[10]);
+        vst1q_u8(blocks + i * BlockSize, state[i]);
+    }
+}
+
+#else
+
+void EncryptBlocks(const Aes128RoundKeys& round_keys, u8* blocks, std::size_t num_blocks) {}
+
+#endif
+
+void CtrTransformSerial(const Aes128RoundKeys& round_keys, Counter ctr, const u8* src, u8* dest,
+                        std::size_t size) {
+    alignas(16) std::array<u8, Interleave * BlockSize> keystream;
+
+    while (size > 0) {
+        const std::size_t chunk_size = std::min(size, keystream.size());
+        const std::size_t num_blocks = Common::DivCeil(chunk_size, BlockSize);
+
+        ctr.Generate(keystream.data(), num_blocks);
+        EncryptBlocks(round_keys, keystream.data(), num_blocks);
+        for (std::size_t i = 0; i < chunk_size; ++i) {
+            dest[i] = src[i] ^ keystream[i];
+        }
+
+        src += chunk_size;
+        dest += chunk_size;
+        size -= chunk_size;
+    }
+}
+
+std::size_t NumWorkers() {
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+}
+
+Common::ThreadWorker& GetWorkers() {
+    static Common::ThreadWorker workers{NumWorkers(), "AesCtr"};
+    return workers;
+}
+
+} // Anonymous namespace
+
+bool IsAesAccelerated() {
+    static const bool is_supported = DetectAesSupport();
+    return is_supported;
+}
+
+Aes128RoundKeys ExpandAes128Key(std::span<const u8, 0x10> key) {
+    Aes128RoundKeys round_keys{};
+    std::memcpy(round_keys[0].data(), key.data(), key.size());
+
+    for (std::size_t round = 1; round < round_keys.size(); ++round) {
+        const auto& prev = round_keys[round - 1];
+        auto& next = round_keys[round];
+
+        // RotWord, SubWord and the round constant applied to the last word of the previous key.
+        const std::array<u8, 4> temp{
+            static_cast<u8>(SBox[prev[13]] ^ RoundConstants[round - 1]),
+            SBox[prev[14]],
+            SBox[prev[15]],
+            SBox[prev[12]],
+        };
+        for (std::size_t i = 0; i < 4; ++i) {
+            next[i] = prev[i] ^ temp[i];
+        }
+        for (std::size_t i = 4; i < BlockSize; ++i) {
+            next[i] = prev[i] ^ next[i - 4];
+        }
+    }
+
+    return round_keys;
+}
+
+void Aes128CtrTransform(const Aes128RoundKeys& round_keys, std::array<u8, 0x10>& counter,
+                        const u8* src, u8* dest, std::size_t size) {
+    Counter ctr{counter};
+
+    if (size < ParallelThreshold) {
+        CtrTransformSerial(round_keys, ctr, src, dest, size);
+    } else {
+        // CTR blocks are independent, so the input can be split at any block boundary. The
+        // calling thread processes the first chunk itself.
+        const std::size_t num_chunks =
+            std::min(NumWorkers() + 1, Common::DivCeil(size, MinParallelChunkSize));
+        const std::size_t chunk_size = Common::AlignUp(Common::DivCeil(size, num_chunks), BlockSize);
+        const std::size_t num_tasks = Common::DivCeil(size, chunk_size) - 1;
+
+        std::latch remaining{static_cast<std::ptrdiff_t>(num_tasks)};
+        for (std::size_t offset = chunk_size; offset < size; offset += chunk_size) {
+            Counter chunk_ctr{ctr};
+            chunk_ctr.Advance(offset / BlockSize);
+            GetWorkers().QueueWork([&, chunk_ctr, offset] {
+                CtrTransformSerial(round_keys, chunk_ctr, src + offset, dest + offset,
+                                   std::min(chunk_size, size - offset));
+                remaining.count_down();
+            });
+        }
+        CtrTransformSerial(round_keys, ctr, src, dest, chunk_size);
+        remaining.wait();
+    }
+
+    ctr.Advance(Common::DivCeil(size, BlockSize));
+    ctr.Store(counter);
+}
+
+} // namespace Core::Crypto
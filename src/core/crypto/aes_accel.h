@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include "common/common_types.h"
+
+namespace Core::Crypto {
+
+/// Expanded AES-128 encryption key schedule used by the hardware accelerated paths.
+using Aes128RoundKeys = std::array<std::array<u8, 0x10>, 11>;
+
+/// Returns whether the host CPU supports the AES instructions used by this file.
+bool IsAesAccelerated();
+
+/// Expands an AES-128 key into its encryption round keys (FIPS-197 byte order).
+Aes128RoundKeys ExpandAes128Key(std::span<const u8, 0x10> key);
+
+/**
+ * Applies the AES-128-CTR keystream to size bytes of src, writing the result to dest.
+ * The 128-bit big-endian counter is advanced by the number of blocks consumed, with a trailing
+ * partial block counting as a whole block. src and dest may alias.
+ * Must only be called when IsAesAccelerated() returns true.
+ */
+void Aes128CtrTransform(const Aes128RoundKeys& round_keys, std::array<u8, 0x10>& counter,
+                        const u8* src, u8* dest, std::size_t size);
+
+} // namespace Core::Crypto
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <optional>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "core/crypto/aes_accel.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
@@ -36,6 +38,10 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+    // AES-128-CTR is handled without mbedtls when the host has AES instructions.
+    std::optional<Aes128RoundKeys> accelerated_keys;
+    std::array<u8, 0x10> counter{};
 };
 
 template <typename Key, std::size_t KeySize>
@@ -57,6 +63,12 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+    if constexpr (KeySize == 0x10) {
+        if (mode == Mode::CTR && IsAesAccelerated()) {
+            ctx->accelerated_keys = ExpandAes128Key(key);
+        }
+    }
 }
 
 template <typename Key, std::size_t KeySize>
@@ -67,6 +79,11 @@ AESCipher<Key, KeySize>::~AESCipher() {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
+    if (ctx->accelerated_keys) {
+        Aes128CtrTransform(*ctx->accelerated_keys, ctx->counter, src, dest, size);
+        return;
+    }
+
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
     mbedtls_cipher_reset(context);
@@ -122,6 +139,11 @@ void AESCipher<Key, KeySize>::SetIV(std::span<const u8> data) {
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data.data(), data.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, data.data(), data.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
+
+    if (ctx->accelerated_keys) {
+        ASSERT(data.size() == ctx->counter.size());
+        std::memcpy(ctx->counter.data(), data.data(), data.size());
+    }
 }
 
 template class AESCipher<Key128>;
@@ -5,10 +5,11 @@
 #include <array>
 #include <bitset>
 #include <cctype>
-#include <fstream>
+#include <iterator>
 #include <locale>
 #include <map>
-#include <sstream>
+#include <mutex>
+#include <string_view>
 #include <tuple>
 #include <vector>
 #include <mbedtls/bignum.h>
@@ -639,6 +640,8 @@ KeyManager::KeyManager() {
 }
 
 void KeyManager::ReloadKeys() {
+    std::scoped_lock lk{key_lock};
+
     // Initialize keys
     const auto yuzu_keys_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::KeysDir);
 
@@ -671,32 +674,36 @@ static bool ValidCryptoRevisionString(std::string_view base, size_t begin, size_
 }
 
 void KeyManager::LoadFromFile(const std::filesystem::path& file_path, bool is_title_keys) {
+    std::scoped_lock lk{key_lock};
+
     if (!Common::FS::Exists(file_path)) {
         return;
     }
 
-    std::ifstream file;
-    Common::FS::OpenFileStream(file, file_path, std::ios_base::in);
-
-    if (!file.is_open()) {
-        return;
-    }
+    const std::string contents =
+        Common::FS::ReadStringFromFile(file_path, Common::FS::FileType::TextFile);
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::vector<std::string> out;
-        std::stringstream stream(line);
-        std::string item;
-        while (std::getline(stream, item, '=')) {
-            out.push_back(std::move(item));
-        }
+    const auto strip_spaces = [](std::string_view in, std::string& stripped) {
+        stripped.clear();
+        std::ranges::copy_if(in, std::back_inserter(stripped), [](char c) { return c != ' '; });
+    };
 
-        if (out.size() != 2) {
+    // Name and value of the current line, reused as title key files can have thousands of lines
+    std::array<std::string, 2> out;
+    std::string_view remaining{contents};
+    while (!remaining.empty()) {
+        const size_t line_end = std::min(remaining.find('\n'), remaining.size());
+        const std::string_view line = remaining.substr(0, line_end);
+        remaining.remove_prefix(std::min(line_end + 1, remaining.size()));
+
+        const size_t separator = line.find('=');
+        if (separator == std::string_view::npos || separator + 1 == line.size() ||
+            line.find('=', separator + 1) != std::string_view::npos) {
             continue;
         }
 
-        out[0].erase(std::remove(out[0].begin(), out[0].end(), ' '), out[0].end());
-        out[1].erase(std::remove(out[1].begin(), out[1].end(), ' '), out[1].end());
+        strip_spaces(line.substr(0, separator), out[0]);
+        strip_spaces(line.substr(separator + 1), out[1]);
 
         if (out[0].compare(0, 1, "#") == 0) {
             continue;
@@ -781,6 +788,7 @@ void KeyManager::LoadFromFile(const std::filesystem::path& file_path, bool is_ti
 }
 
 bool KeyManager::AreKeysLoaded() const {
+    std::scoped_lock lk{key_lock};
     return !s128_keys.empty() && !s256_keys.empty();
 }
 
@@ -808,14 +816,18 @@ bool KeyManager::BaseDeriveNecessary() const {
 }
 
 bool KeyManager::HasKey(S128KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lk{key_lock};
     return s128_keys.find({id, field1, field2}) != s128_keys.end();
 }
 
 bool KeyManager::HasKey(S256KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lk{key_lock};
     return s256_keys.find({id, field1, field2}) != s256_keys.end();
 }
 
 Key128 KeyManager::GetKey(S128KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lk{key_lock};
+
     if (!HasKey(id, field1, field2)) {
         return {};
     }
@@ -823,6 +835,8 @@ Key128 KeyManager::GetKey(S128KeyType id, u64 field1, u64 field2) const {
 }
 
 Key256 KeyManager::GetKey(S256KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lk{key_lock};
+
     if (!HasKey(id, field1, field2)) {
         return {};
     }
@@ -830,6 +844,8 @@ Key256 KeyManager::GetKey(S256KeyType id, u64 field1, u64 field2) const {
 }
 
 Key256 KeyManager::GetBISKey(u8 partition_id) const {
+    std::scoped_lock lk{key_lock};
+
     Key256 out{};
 
     for (const auto& bis_type : {BISKeyType::Crypto, BISKeyType::Tweak}) {
@@ -879,6 +895,8 @@ void KeyManager::WriteKeyToFile(KeyCategory category, std::string_view keyname,
 }
 
 void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
+    std::scoped_lock lk{key_lock};
+
     if (s128_keys.find({id, field1, field2}) != s128_keys.end() || key == Key128{}) {
         return;
     }
@@ -932,6 +950,8 @@ void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
 }
 
 void KeyManager::SetKey(S256KeyType id, Key256 key, u64 field1, u64 field2) {
+    std::scoped_lock lk{key_lock};
+
     if (s256_keys.find({id, field1, field2}) != s256_keys.end() || key == Key256{}) {
         return;
     }
@@ -961,6 +981,8 @@ bool KeyManager::KeyFileExists(bool title) {
 }
 
 void KeyManager::DeriveSDSeedLazy() {
+    std::scoped_lock lk{key_lock};
+
     if (HasKey(S128KeyType::SDSeed)) {
         return;
     }
@@ -980,6 +1002,8 @@ static Key128 CalculateCMAC(const u8* source, size_t size, const Key128& key) {
 }
 
 void KeyManager::DeriveBase() {
+    std::scoped_lock lk{key_lock};
+
     if (!BaseDeriveNecessary()) {
         return;
     }
@@ -1110,6 +1134,8 @@ void KeyManager::DeriveBase() {
 
 void KeyManager::DeriveETicket(PartitionDataManager& data,
                                const FileSys::ContentProvider& provider) {
+    std::scoped_lock lk{key_lock};
+
     // ETicket keys
     const auto es = provider.GetEntry(0x0100000000000033, FileSys::ContentRecordType::Program);
 
@@ -1189,6 +1215,8 @@ void KeyManager::DeriveETicket(PartitionDataManager& data,
 }
 
 void KeyManager::PopulateTickets() {
+    std::scoped_lock lk{key_lock};
+
     if (ticket_databases_loaded) {
         return;
     }
@@ -1220,6 +1248,8 @@ void KeyManager::PopulateTickets() {
 }
 
 void KeyManager::SynthesizeTickets() {
+    std::scoped_lock lk{key_lock};
+
     for (const auto& key : s128_keys) {
         if (key.first.type != S128KeyType::Titlekey) {
             continue;
@@ -1248,6 +1278,8 @@ void KeyManager::SetKeyWrapped(S256KeyType id, Key256 key, u64 field1, u64 field
 }
 
 void KeyManager::PopulateFromPartitionData(PartitionDataManager& data) {
+    std::scoped_lock lk{key_lock};
+
     if (!BaseDeriveNecessary()) {
         return;
     }
@@ -1339,11 +1371,13 @@ void KeyManager::PopulateFromPartitionData(PartitionDataManager& data) {
     DeriveBase();
 }
 
-const std::map<u128, Ticket>& KeyManager::GetCommonTickets() const {
+std::map<u128, Ticket> KeyManager::GetCommonTickets() const {
+    std::scoped_lock lk{key_lock};
     return common_tickets;
 }
 
-const std::map<u128, Ticket>& KeyManager::GetPersonalizedTickets() const {
+std::map<u128, Ticket> KeyManager::GetPersonalizedTickets() const {
+    std::scoped_lock lk{key_lock};
     return personal_tickets;
 }
 
@@ -1353,6 +1387,8 @@ bool KeyManager::AddTicket(const Ticket& ticket) {
         return false;
     }
 
+    std::scoped_lock lk{key_lock};
+
     const auto& rid = ticket.GetData().rights_id;
     u128 rights_id;
     std::memcpy(rights_id.data(), rid.data(), rid.size());
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common/host_memory.h"
+#include "common/memory_accounting.h"
 #include "common/typed_address.h"
 
 namespace Core {
@@ -60,6 +61,9 @@ public:
     }
 
     Common::HostMemory buffer;
+
+private:
+    Common::MemoryAccount memory_account{Common::MemoryCategory::GuestMemory};
 };
 
 } // namespace Core
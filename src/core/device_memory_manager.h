@@ -49,16 +49,10 @@ public:
     void AllocateFixed(DAddr start, size_t size);
     void Free(DAddr start, size_t size);
 
-    void Map(DAddr address, VAddr virtual_address, size_t size, Asid asid, bool track = false);
+    void Map(DAddr address, VAddr virtual_address, size_t size, Asid asid);
 
     void Unmap(DAddr address, size_t size);
 
-    void TrackContinuityImpl(DAddr address, VAddr virtual_address, size_t size, Asid asid);
-    void TrackContinuity(DAddr address, VAddr virtual_address, size_t size, Asid asid) {
-        std::scoped_lock lk(mapping_guard);
-        TrackContinuityImpl(address, virtual_address, size, asid);
-    }
-
     // Write / Read
     template <typename T>
     T* GetPointer(DAddr address);
@@ -126,6 +120,8 @@ private:
     static constexpr size_t page_size = 1ULL << page_bits;
     static constexpr size_t page_mask = page_size - 1ULL;
     static constexpr u32 physical_address_base = 1U << page_bits;
+    /// Longest contiguous run recorded by the continuity tracker, 16 MiB
+    static constexpr u32 max_continuity_pages = 1U << 12;
     static constexpr u32 MULTI_FLAG_BITS = 31;
     static constexpr u32 MULTI_FLAG = 1U << MULTI_FLAG_BITS;
     static constexpr u32 MULTI_MASK = ~MULTI_FLAG;
@@ -150,6 +146,8 @@ private:
 
     void InnerGatherDeviceAddresses(Common::ScratchBuffer<u32>& buffer, PAddr address);
 
+    void UpdateContinuityLocked(size_t start_page, size_t num_pages);
+
     std::unique_ptr<DeviceMemoryManagerAllocator<Traits>> impl;
 
     const uintptr_t physical_base;
@@ -6,12 +6,14 @@
 #include <optional>
 #include <utility>
 
+#include "common/cityhash.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/ctr_encryption_layer.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/content_archive.h"
+#include "core/file_sys/nca_section_cache.h"
 #include "core/file_sys/partition_filesystem.h"
 #include "core/file_sys/vfs/vfs_offset.h"
 #include "core/loader/loader.h"
@@ -53,6 +55,7 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
     }
 
     RightsId rights_id{};
+    u128 titlekey_hash{};
     reader->GetRightsId(rights_id.data(), rights_id.size());
     if (rights_id != RightsId{}) {
         // External decryption key required; provide it here.
@@ -77,6 +80,21 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
                          Core::Crypto::Op::Decrypt);
 
         reader->SetExternalDecryptionKey(titlekey.data(), titlekey.size());
+        titlekey_hash = Common::CityHash128(reinterpret_cast<const char*>(titlekey.data()),
+                                            titlekey.size());
+    }
+
+    // Identifies the decrypted sections in the section cache. The title key is part of it, so
+    // contents decrypted with a wrong key are not served once the right key is installed.
+    // Sections of a patch NCA depend on its base NCA as well.
+    NcaHeader header{};
+    reader->GetRawData(std::addressof(header), sizeof(header));
+    section_cache_key = Common::CityHash128WithSeed(reinterpret_cast<const char*>(&header),
+                                                    sizeof(header), titlekey_hash);
+    if (base_nca != nullptr) {
+        section_cache_key = Common::CityHash128WithSeed(
+            reinterpret_cast<const char*>(base_nca->section_cache_key.data()),
+            sizeof(base_nca->section_cache_key), section_cache_key);
     }
 
     const s32 fs_count = reader->GetFsCount();
@@ -93,7 +111,7 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
         }
 
         if (header_reader.GetFsType() == NcaFsHeader::FsType::RomFs) {
-            files.push_back(filesystems[i]);
+            files.push_back(CreateCachedNcaSection(filesystems[i], section_cache_key, i));
             romfs = files.back();
         }
 
@@ -103,6 +103,9 @@ private:
 
     Core::Crypto::KeyManager& keys;
     std::shared_ptr<NcaReader> reader;
+
+    /// Identifies the decrypted sections of this NCA in the section cache
+    u128 section_cache_key{};
 };
 
 } // namespace FileSys
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <thread>
+
+#include "common/alignment.h"
+#include "common/logging/log.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/fssystem/fssystem_block_verification_state.h"
+
+namespace FileSys {
+
+namespace {
+
+constexpr s64 BitsPerWord = 64;
+
+Common::ThreadWorker& GetWorkers() {
+    static Common::ThreadWorker workers{
+        std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 1, 2), "IntegrityVerify"};
+    return workers;
+}
+
+} // Anonymous namespace
+
+BlockVerificationState::BlockVerificationState(VerificationMode mode, s64 block_count)
+    : m_mode(mode), m_bitmap(static_cast<size_t>(Common::DivideUp(block_count, BitsPerWord))) {}
+
+bool BlockVerificationState::IsVerified(s64 block_index) const {
+    const u64 bit = u64{1} << (block_index % BitsPerWord);
+    return (m_bitmap[block_index / BitsPerWord].load(std::memory_order_acquire) & bit) != 0;
+}
+
+void BlockVerificationState::SetVerified(s64 block_index) {
+    const u64 bit = u64{1} << (block_index % BitsPerWord);
+    m_bitmap[block_index / BitsPerWord].fetch_or(bit, std::memory_order_release);
+}
+
+bool BlockVerificationState::TrySetVerified(s64 block_index) {
+    const u64 bit = u64{1} << (block_index % BitsPerWord);
+    return (m_bitmap[block_index / BitsPerWord].fetch_or(bit, std::memory_order_acq_rel) & bit) ==
+           0;
+}
+
+void BlockVerificationState::SetFailed(s64 block_index) {
+    if (!m_failed.exchange(true)) {
+        LOG_CRITICAL(Common_Filesystem,
+                     "Hash mismatch in block {}, failing all further reads of the storage",
+                     block_index);
+    }
+}
+
+void BlockVerificationState::QueueVerification(std::function<void()> work) {
+    GetWorkers().QueueWork(std::move(work));
+}
+
+void BlockVerificationState::WaitForVerification() {
+    GetWorkers().WaitForRequests();
+}
+
+} // namespace FileSys
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/settings_enums.h"
+
+namespace FileSys {
+
+using VerificationMode = Settings::IntegrityVerificationMode;
+
+// Tracks which blocks of a hashed storage have been verified in this session. Shared with any
+// verification still queued on the worker threads, so it may outlive its storage.
+class BlockVerificationState {
+public:
+    explicit BlockVerificationState(VerificationMode mode, s64 block_count);
+
+    VerificationMode GetMode() const {
+        return m_mode;
+    }
+
+    bool IsVerified(s64 block_index) const;
+    void SetVerified(s64 block_index);
+
+    // Marks the block as verified, returning whether it was not marked before.
+    bool TrySetVerified(s64 block_index);
+
+    bool HasFailed() const {
+        return m_failed.load(std::memory_order_relaxed);
+    }
+
+    // Fails all further reads of the storage.
+    void SetFailed(s64 block_index);
+
+    // Runs verification work on the shared verification threads.
+    static void QueueVerification(std::function<void()> work);
+
+    // Waits for all the queued verification work to finish.
+    static void WaitForVerification();
+
+private:
+    VerificationMode m_mode;
+    std::vector<std::atomic<u64>> m_bitmap;
+    std::atomic<bool> m_failed{};
+};
+
+} // namespace FileSys
@@ -257,6 +257,8 @@ void BucketTree::Finalize() {
         m_offset_cache.offsets.start_offset = 0;
         m_offset_cache.offsets.end_offset = 0;
         m_offset_cache.is_initialized = false;
+
+        m_node_cache.Clear();
     }
 }
 
@@ -279,6 +281,9 @@ Result BucketTree::InvalidateCache() {
     // Reset our offsets.
     m_offset_cache.is_initialized = false;
 
+    // Drop any cached nodes, they may have changed as well.
+    m_node_cache.Clear();
+
     R_SUCCEED();
 }
 
@@ -318,6 +323,77 @@ Result BucketTree::EnsureOffsetCache() {
     R_SUCCEED();
 }
 
+BucketTree::NodeBlock BucketTree::NodeCache::Find(u64 key) {
+    std::scoped_lock lk(m_mutex);
+
+    const auto it = m_map.find(key);
+    if (it == m_map.end()) {
+        return nullptr;
+    }
+
+    // Mark the block as most recently used.
+    m_list.splice(m_list.begin(), m_list, it->second);
+    return it->second->second;
+}
+
+void BucketTree::NodeCache::Insert(u64 key, NodeBlock block, size_t max_blocks) {
+    std::scoped_lock lk(m_mutex);
+
+    // Another visitor may have read the same block in the meantime.
+    if (m_map.contains(key)) {
+        return;
+    }
+
+    m_list.emplace_front(key, std::move(block));
+    m_map.emplace(key, m_list.begin());
+
+    // Evict the least recently used blocks.
+    while (m_list.size() > max_blocks) {
+        m_map.erase(m_list.back().first);
+        m_list.pop_back();
+    }
+}
+
+void BucketTree::NodeCache::Clear() {
+    std::scoped_lock lk(m_mutex);
+
+    m_map.clear();
+    m_list.clear();
+}
+
+BucketTree::NodeBlock BucketTree::GetL2NodeBlock(s32 node_index) const {
+    const auto node_offset = (node_index + 1) * static_cast<s64>(m_node_size);
+    return this->GetBlock(m_node_storage, static_cast<u32>(node_index), node_offset);
+}
+
+BucketTree::NodeBlock BucketTree::GetEntrySetBlock(s32 entry_set_index) const {
+    const auto entry_set_offset = entry_set_index * static_cast<s64>(m_node_size);
+    const u64 key = (u64{1} << 32) | static_cast<u32>(entry_set_index);
+    return this->GetBlock(m_entry_storage, key, entry_set_offset);
+}
+
+BucketTree::NodeBlock BucketTree::GetBlock(VirtualFile& storage, u64 key, s64 offset) const {
+    // Check that caching is enabled for nodes of our size.
+    const size_t max_blocks = NodeCacheSize / m_node_size;
+    if (max_blocks == 0) {
+        return nullptr;
+    }
+
+    // Check if we already have the block.
+    if (auto block = m_node_cache.Find(key); block != nullptr) {
+        return block;
+    }
+
+    // Read the block. Blocks that cannot be read in full are left to the uncached paths.
+    auto block = std::make_shared<std::vector<char>>(m_node_size);
+    if (storage->Read(reinterpret_cast<u8*>(block->data()), m_node_size, offset) != m_node_size) {
+        return nullptr;
+    }
+
+    m_node_cache.Insert(key, block, max_blocks);
+    return block;
+}
+
 Result BucketTree::Visitor::Initialize(const BucketTree* tree, const BucketTree::Offsets& offsets) {
     ASSERT(tree != nullptr);
     ASSERT(m_tree == nullptr || m_tree == tree);
@@ -347,9 +423,8 @@ Result BucketTree::Visitor::MoveNext() {
         const auto end = m_entry_set.info.end;
 
         const auto entry_set_size = m_tree->m_node_size;
-        const auto entry_set_offset = entry_set_index * static_cast<s64>(entry_set_size);
 
-        m_tree->m_entry_storage->ReadObject(std::addressof(m_entry_set), entry_set_offset);
+        this->ReadEntrySet(entry_set_index);
         R_TRY(m_entry_set.header.Verify(entry_set_index, entry_set_size, m_tree->m_entry_size));
 
         R_UNLESS(m_entry_set.info.start == end && m_entry_set.info.start < m_entry_set.info.end,
@@ -361,10 +436,7 @@ Result BucketTree::Visitor::MoveNext() {
     }
 
     // Read the new entry.
-    const auto entry_size = m_tree->m_entry_size;
-    const auto entry_offset = impl::GetBucketTreeEntryOffset(
-        m_entry_set.info.index, m_tree->m_node_size, entry_size, entry_index);
-    m_tree->m_entry_storage->Read(reinterpret_cast<u8*>(m_entry), entry_size, entry_offset);
+    this->ReadEntry(entry_index);
 
     // Note that we changed index.
     m_entry_index = entry_index;
@@ -385,9 +457,8 @@ Result BucketTree::Visitor::MovePrevious() {
 
         const auto entry_set_size = m_tree->m_node_size;
         const auto entry_set_index = m_entry_set.info.index - 1;
-        const auto entry_set_offset = entry_set_index * static_cast<s64>(entry_set_size);
 
-        m_tree->m_entry_storage->ReadObject(std::addressof(m_entry_set), entry_set_offset);
+        this->ReadEntrySet(entry_set_index);
         R_TRY(m_entry_set.header.Verify(entry_set_index, entry_set_size, m_tree->m_entry_size));
 
         R_UNLESS(m_entry_set.info.end == start && m_entry_set.info.start < m_entry_set.info.end,
@@ -401,10 +472,7 @@ Result BucketTree::Visitor::MovePrevious() {
     --entry_index;
 
     // Read the new entry.
-    const auto entry_size = m_tree->m_entry_size;
-    const auto entry_offset = impl::GetBucketTreeEntryOffset(
-        m_entry_set.info.index, m_tree->m_node_size, entry_size, entry_index);
-    m_tree->m_entry_storage->Read(reinterpret_cast<u8*>(m_entry), entry_size, entry_offset);
+    this->ReadEntry(entry_index);
 
     // Note that we changed index.
     m_entry_index = entry_index;
@@ -461,6 +529,11 @@ Result BucketTree::Visitor::Find(s64 virtual_address) {
 }
 
 Result BucketTree::Visitor::FindEntrySet(s32* out_index, s64 virtual_address, s32 node_index) {
+    // Use the cached node, if we can.
+    if (const auto block = m_tree->GetL2NodeBlock(node_index); block != nullptr) {
+        R_RETURN(this->FindEntrySetInNode(out_index, virtual_address, node_index, block->data()));
+    }
+
     const auto node_size = m_tree->m_node_size;
 
     PooledBuffer pool(node_size, 1);
@@ -483,6 +556,13 @@ Result BucketTree::Visitor::FindEntrySetWithBuffer(s32* out_index, s64 virtual_a
     // Read the node.
     storage->Read(reinterpret_cast<u8*>(buffer), node_size, node_offset);
 
+    R_RETURN(this->FindEntrySetInNode(out_index, virtual_address, node_index, buffer));
+}
+
+Result BucketTree::Visitor::FindEntrySetInNode(s32* out_index, s64 virtual_address,
+                                               s32 node_index, const char* buffer) {
+    const auto node_size = m_tree->m_node_size;
+
     // Validate the header.
     NodeHeader header;
     std::memcpy(std::addressof(header), buffer, NodeHeaderSize);
@@ -521,6 +601,14 @@ Result BucketTree::Visitor::FindEntrySetWithoutBuffer(s32* out_index, s64 virtua
 }
 
 Result BucketTree::Visitor::FindEntry(s64 virtual_address, s32 entry_set_index) {
+    // Use the cached entry set, if we can, and keep it for moving between its entries.
+    if (auto block = m_tree->GetEntrySetBlock(entry_set_index); block != nullptr) {
+        R_TRY(this->FindEntryInEntrySet(virtual_address, entry_set_index, block->data()));
+        m_entry_set_block = std::move(block);
+        R_SUCCEED();
+    }
+    m_entry_set_block.reset();
+
     const auto entry_set_size = m_tree->m_node_size;
 
     PooledBuffer pool(entry_set_size, 1);
@@ -535,7 +623,6 @@ Result BucketTree::Visitor::FindEntry(s64 virtual_address, s32 entry_set_index)
 Result BucketTree::Visitor::FindEntryWithBuffer(s64 virtual_address, s32 entry_set_index,
                                                 char* buffer) {
     // Calculate entry set extents.
-    const auto entry_size = m_tree->m_entry_size;
     const auto entry_set_size = m_tree->m_node_size;
     const auto entry_set_offset = entry_set_index * static_cast<s64>(entry_set_size);
     VirtualFile storage = m_tree->m_entry_storage;
@@ -543,6 +630,14 @@ Result BucketTree::Visitor::FindEntryWithBuffer(s64 virtual_address, s32 entry_s
     // Read the entry set.
     storage->Read(reinterpret_cast<u8*>(buffer), entry_set_size, entry_set_offset);
 
+    R_RETURN(this->FindEntryInEntrySet(virtual_address, entry_set_index, buffer));
+}
+
+Result BucketTree::Visitor::FindEntryInEntrySet(s64 virtual_address, s32 entry_set_index,
+                                                const char* buffer) {
+    const auto entry_size = m_tree->m_entry_size;
+    const auto entry_set_size = m_tree->m_node_size;
+
     // Validate the entry_set.
     EntrySetHeader entry_set;
     std::memcpy(std::addressof(entry_set), buffer, sizeof(EntrySetHeader));
@@ -595,4 +690,29 @@ Result BucketTree::Visitor::FindEntryWithoutBuffer(s64 virtual_address, s32 entr
     R_SUCCEED();
 }
 
+void BucketTree::Visitor::ReadEntrySet(s32 entry_set_index) {
+    if (auto block = m_tree->GetEntrySetBlock(entry_set_index); block != nullptr) {
+        std::memcpy(std::addressof(m_entry_set), block->data(), sizeof(EntrySetHeader));
+        m_entry_set_block = std::move(block);
+        return;
+    }
+    m_entry_set_block.reset();
+
+    const auto entry_set_offset = entry_set_index * static_cast<s64>(m_tree->m_node_size);
+    m_tree->m_entry_storage->ReadObject(std::addressof(m_entry_set), entry_set_offset);
+}
+
+void BucketTree::Visitor::ReadEntry(s32 entry_index) {
+    const auto entry_size = m_tree->m_entry_size;
+    if (m_entry_set_block != nullptr) {
+        const auto entry_offset = impl::GetBucketTreeEntryOffset(0, entry_size, entry_index);
+        std::memcpy(m_entry, m_entry_set_block->data() + entry_offset, entry_size);
+        return;
+    }
+
+    const auto entry_offset = impl::GetBucketTreeEntryOffset(
+        m_entry_set.info.index, m_tree->m_node_size, entry_size, entry_index);
+    m_tree->m_entry_storage->Read(reinterpret_cast<u8*>(m_entry), entry_size, entry_offset);
+}
+
 } // namespace FileSys
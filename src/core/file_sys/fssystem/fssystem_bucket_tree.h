@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <list>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_funcs.h"
@@ -28,6 +32,9 @@ public:
     static constexpr size_t NodeSizeMin = 1_KiB;
     static constexpr size_t NodeSizeMax = 512_KiB;
 
+    /// Memory used to cache node and entry set blocks of a tree
+    static constexpr size_t NodeCacheSize = 512_KiB;
+
 public:
     class Visitor;
 
@@ -189,6 +196,29 @@ private:
         void* m_header;
     };
 
+    using NodeBlock = std::shared_ptr<const std::vector<char>>;
+
+    // Least recently used L2 node and entry set blocks, shared by all visitors of a tree so that
+    // lookups do not have to read and copy them out of the node and entry storages every time.
+    class NodeCache {
+        YUZU_NON_COPYABLE(NodeCache);
+        YUZU_NON_MOVEABLE(NodeCache);
+
+    public:
+        NodeCache() = default;
+
+        NodeBlock Find(u64 key);
+        void Insert(u64 key, NodeBlock block, size_t max_blocks);
+        void Clear();
+
+    private:
+        using List = std::list<std::pair<u64, NodeBlock>>;
+
+        std::mutex m_mutex;
+        List m_list;
+        std::unordered_map<u64, List::iterator> m_map;
+    };
+
 private:
     static constexpr s32 GetEntryCount(size_t node_size, size_t entry_size) {
         return static_cast<s32>((node_size - sizeof(NodeHeader)) / entry_size);
@@ -221,7 +251,8 @@ private:
 public:
     BucketTree()
         : m_node_storage(), m_entry_storage(), m_node_l1(), m_node_size(), m_entry_size(),
-          m_entry_count(), m_offset_count(), m_entry_set_count(), m_offset_cache() {}
+          m_entry_count(), m_offset_count(), m_entry_set_count(), m_offset_cache(),
+          m_node_cache() {}
     ~BucketTree() {
         this->Finalize();
     }
@@ -317,6 +348,10 @@ private:
 
     Result EnsureOffsetCache();
 
+    NodeBlock GetL2NodeBlock(s32 node_index) const;
+    NodeBlock GetEntrySetBlock(s32 entry_set_index) const;
+    NodeBlock GetBlock(VirtualFile& storage, u64 key, s64 offset) const;
+
 private:
     mutable VirtualFile m_node_storage;
     mutable VirtualFile m_entry_storage;
@@ -327,6 +362,7 @@ private:
     s32 m_offset_count;
     s32 m_entry_set_count;
     OffsetCache m_offset_cache;
+    mutable NodeCache m_node_cache;
 };
 
 class BucketTree::Visitor {
@@ -335,7 +371,8 @@ class BucketTree::Visitor {
 
 public:
     constexpr Visitor()
-        : m_tree(), m_entry(), m_entry_index(-1), m_entry_set_count(), m_entry_set{} {}
+        : m_tree(), m_entry(), m_entry_index(-1), m_entry_set_count(), m_entry_set{},
+          m_entry_set_block() {}
     ~Visitor() {
         if (m_entry != nullptr) {
             ::operator delete(m_entry, m_tree->m_entry_size);
@@ -385,10 +422,16 @@ private:
     Result FindEntrySetWithBuffer(s32* out_index, s64 virtual_address, s32 node_index,
                                   char* buffer);
     Result FindEntrySetWithoutBuffer(s32* out_index, s64 virtual_address, s32 node_index);
+    Result FindEntrySetInNode(s32* out_index, s64 virtual_address, s32 node_index,
+                              const char* node);
 
     Result FindEntry(s64 virtual_address, s32 entry_set_index);
     Result FindEntryWithBuffer(s64 virtual_address, s32 entry_set_index, char* buffer);
     Result FindEntryWithoutBuffer(s64 virtual_address, s32 entry_set_index);
+    Result FindEntryInEntrySet(s64 virtual_address, s32 entry_set_index, const char* entry_set);
+
+    void ReadEntrySet(s32 entry_set_index);
+    void ReadEntry(s32 entry_index);
 
 private:
     friend class BucketTree;
@@ -411,6 +454,7 @@ private:
     s32 m_entry_index;
     s32 m_entry_set_count;
     EntrySetHeader m_entry_set;
+    NodeBlock m_entry_set_block;
 };
 
 } // namespace FileSys
@@ -34,20 +34,27 @@ Result BucketTree::ScanContinuousReading(ContinuousReadingInfo* out_info,
     auto cur_offset = param.offset;
     R_UNLESS(entry.GetVirtualOffset() <= cur_offset, ResultOutOfRange);
 
-    // Create a pooled buffer for our scan.
-    PooledBuffer pool(m_node_size, 1);
-    char* buffer = nullptr;
-
-    s64 entry_storage_size = m_entry_storage->GetSize();
-
-    // Read the node.
-    if (m_node_size <= pool.GetSize()) {
-        buffer = pool.GetBuffer();
-        const auto ofs = param.entry_set.index * static_cast<s64>(m_node_size);
-        R_UNLESS(m_node_size + ofs <= static_cast<size_t>(entry_storage_size),
-                 ResultInvalidBucketTreeNodeEntryCount);
-
-        m_entry_storage->Read(reinterpret_cast<u8*>(buffer), m_node_size, ofs);
+    // Use the cached entry set if we can, otherwise create a pooled buffer for our scan.
+    const NodeBlock block = this->GetEntrySetBlock(param.entry_set.index);
+    PooledBuffer pool;
+    const char* buffer = nullptr;
+
+    if (block != nullptr) {
+        buffer = block->data();
+    } else {
+        pool.Allocate(m_node_size, 1);
+
+        s64 entry_storage_size = m_entry_storage->GetSize();
+
+        // Read the node.
+        if (m_node_size <= pool.GetSize()) {
+            buffer = pool.GetBuffer();
+            const auto ofs = param.entry_set.index * static_cast<s64>(m_node_size);
+            R_UNLESS(m_node_size + ofs <= static_cast<size_t>(entry_storage_size),
+                     ResultInvalidBucketTreeNodeEntryCount);
+
+            m_entry_storage->Read(reinterpret_cast<u8*>(pool.GetBuffer()), m_node_size, ofs);
+        }
     }
 
     // Calculate extents.
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <latch>
+#include <thread>
+
+#include "common/div_ceil.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/fssystem/fssystem_compressed_storage.h"
+
+namespace FileSys {
+
+namespace {
+
+// Batches that decompress to less than this are not worth handing to other threads.
+constexpr size_t ParallelDecompressionThreshold = 256_KiB;
+
+size_t NumWorkers() {
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+}
+
+Common::ThreadWorker& GetWorkers() {
+    static Common::ThreadWorker workers{NumWorkers(), "Decompression"};
+    return workers;
+}
+
+} // Anonymous namespace
+
+CompressedStorage::DecompressedBlock CompressedStorage::DecompressedBlockCache::Find(
+    s64 virtual_offset) {
+    std::scoped_lock lk(m_mutex);
+
+    const auto it = m_map.find(virtual_offset);
+    if (it == m_map.end()) {
+        return nullptr;
+    }
+
+    // Mark the block as most recently used.
+    m_list.splice(m_list.begin(), m_list, it->second);
+    return it->second->second;
+}
+
+void CompressedStorage::DecompressedBlockCache::Insert(s64 virtual_offset,
+                                                       DecompressedBlock block) {
+    std::scoped_lock lk(m_mutex);
+
+    // Another reader may have decompressed the same block in the meantime.
+    if (m_map.contains(virtual_offset) || block->size() > DecompressedBlockCacheSize) {
+        return;
+    }
+
+    m_size += block->size();
+    m_list.emplace_front(virtual_offset, std::move(block));
+    m_map.emplace(virtual_offset, m_list.begin());
+
+    // Evict the least recently used blocks.
+    while (m_size > DecompressedBlockCacheSize) {
+        m_size -= m_list.back().second->size();
+        m_map.erase(m_list.back().first);
+        m_list.pop_back();
+    }
+}
+
+void CompressedStorage::DecompressedBlockCache::Clear() {
+    std::scoped_lock lk(m_mutex);
+
+    m_map.clear();
+    m_list.clear();
+    m_size = 0;
+}
+
+Result CompressedStorage::DecompressBlocks(std::span<DecompressionTask> tasks) {
+    const auto run = [](std::span<DecompressionTask> chunk) {
+        for (auto& task : chunk) {
+            task.result = task.decompressor(task.dst, task.dst_size, task.src, task.src_size);
+        }
+    };
+
+    size_t total_size = 0;
+    for (const auto& task : tasks) {
+        total_size += task.dst_size;
+    }
+
+    if (tasks.size() < 2 || total_size < ParallelDecompressionThreshold) {
+        run(tasks);
+    } else {
+        // Blocks are independent, so split them into consecutive runs. The calling thread
+        // decompresses the first run itself.
+        const size_t num_chunks = std::min(NumWorkers() + 1, tasks.size());
+        const size_t chunk_size = Common::DivCeil(tasks.size(), num_chunks);
+        const size_t num_tasks = Common::DivCeil(tasks.size(), chunk_size) - 1;
+
+        std::latch remaining{static_cast<std::ptrdiff_t>(num_tasks)};
+        for (size_t offset = chunk_size; offset < tasks.size(); offset += chunk_size) {
+            GetWorkers().QueueWork([&, offset] {
+                run(tasks.subspan(offset, std::min(chunk_size, tasks.size() - offset)));
+                remaining.count_down();
+            });
+        }
+        run(tasks.first(chunk_size));
+        remaining.wait();
+    }
+
+    // Report the first failure.
+    for (const auto& task : tasks) {
+        R_TRY(task.result);
+    }
+
+    R_SUCCEED();
+}
+
+} // namespace FileSys
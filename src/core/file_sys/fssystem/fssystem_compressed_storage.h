@@ -3,6 +3,13 @@
 
 #pragma once
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
 #include "common/literals.h"
 
 #include "core/file_sys/errors.h"
@@ -46,6 +53,38 @@ public:
     }
 
 private:
+    using DecompressedBlock = std::shared_ptr<const std::vector<u8>>;
+
+    // Decompressed blocks kept per storage, so hot assets are not decompressed on every read.
+    static constexpr size_t DecompressedBlockCacheSize = 4_MiB;
+
+    class DecompressedBlockCache {
+    public:
+        DecompressedBlock Find(s64 virtual_offset);
+        void Insert(s64 virtual_offset, DecompressedBlock block);
+        void Clear();
+
+    private:
+        using BlockList = std::list<std::pair<s64, DecompressedBlock>>;
+
+        std::mutex m_mutex;
+        BlockList m_list;
+        std::unordered_map<s64, BlockList::iterator> m_map;
+        size_t m_size{};
+    };
+
+    struct DecompressionTask {
+        DecompressorFunction decompressor;
+        void* dst;
+        size_t dst_size;
+        const void* src;
+        size_t src_size;
+        Result result;
+    };
+
+    // Runs the tasks, spreading large batches of blocks across worker threads.
+    static Result DecompressBlocks(std::span<DecompressionTask> tasks);
+
     class CompressedStorageCore {
         YUZU_NON_COPYABLE(CompressedStorageCore);
         YUZU_NON_MOVEABLE(CompressedStorageCore);
@@ -84,6 +123,7 @@ private:
             if (this->IsInitialized()) {
                 m_table.Finalize();
                 m_data_storage = VirtualFile();
+                m_block_cache.Clear();
             }
         }
 
@@ -295,6 +335,7 @@ private:
             // Declare read lambda.
             constexpr int EntriesCountMax = 0x80;
             struct Entries {
+                s64 virtual_offset;
                 CompressionType compression_type;
                 u32 gap_from_prev;
                 u32 physical_size;
@@ -380,6 +421,59 @@ private:
                             m_data_storage->Read(reinterpret_cast<u8*>(buffer), cur_read_size,
                                                  required_access_physical_offset);
 
+                            // Decompress all compressed entries in the buffer up front, so that
+                            // consecutive blocks are decompressed together and can be cached.
+                            std::array<DecompressedBlock, EntriesCountMax> blocks{};
+                            {
+                                std::array<DecompressionTask, EntriesCountMax> tasks;
+                                size_t task_count = 0;
+                                size_t task_offset = 0;
+                                for (auto n = entry_idx;
+                                     n < entry_count &&
+                                     ((static_cast<size_t>(entries[n].physical_size) +
+                                       static_cast<size_t>(entries[n].gap_from_prev)) == 0 ||
+                                      task_offset < cur_read_size);
+                                     task_offset += entries[n++].physical_size) {
+                                    task_offset += entries[n].gap_from_prev;
+
+                                    const auto compression_type = entries[n].compression_type;
+                                    if (compression_type == CompressionType::None ||
+                                        compression_type == CompressionType::Zeros) {
+                                        continue;
+                                    }
+
+                                    // Check that we can remain within bounds.
+                                    ASSERT(task_offset + entries[n].physical_size <=
+                                           cur_read_size);
+
+                                    // Get the decompressor.
+                                    const auto decompressor =
+                                        this->GetDecompressor(compression_type);
+                                    R_UNLESS(decompressor != nullptr,
+                                             ResultUnexpectedInCompressedStorageB);
+
+                                    auto block =
+                                        std::make_shared<std::vector<u8>>(entries[n].virtual_size);
+                                    tasks[task_count++] = {
+                                        .decompressor = decompressor,
+                                        .dst = block->data(),
+                                        .dst_size = block->size(),
+                                        .src = buffer + task_offset,
+                                        .src_size = entries[n].physical_size,
+                                        .result = ResultSuccess,
+                                    };
+                                    blocks[n] = std::move(block);
+                                }
+
+                                R_TRY(DecompressBlocks(std::span(tasks.data(), task_count)));
+
+                                for (auto n = entry_idx; n < entry_count; ++n) {
+                                    if (blocks[n] != nullptr) {
+                                        m_block_cache.Insert(entries[n].virtual_offset, blocks[n]);
+                                    }
+                                }
+                            }
+
                             // Decompress the data.
                             size_t buffer_offset;
                             for (buffer_offset = 0;
@@ -433,29 +527,20 @@ private:
                                     break;
                                 }
                                 default: {
-                                    // Check that we can remain within bounds.
-                                    ASSERT(buffer_offset + entries[entry_idx].physical_size <=
-                                           cur_read_size);
+                                    // The entry was decompressed above.
+                                    const auto& block = blocks[entry_idx];
+                                    ASSERT(block != nullptr);
 
-                                    // Get the decompressor.
-                                    const auto decompressor =
-                                        this->GetDecompressor(compression_type);
-                                    R_UNLESS(decompressor != nullptr,
-                                             ResultUnexpectedInCompressedStorageB);
-
-                                    // Decompress the data.
-                                    R_TRY(read_func(entries[entry_idx].virtual_size,
-                                                    [&](void* dst, size_t dst_size) -> Result {
-                                                        // Check that the size is valid.
-                                                        ASSERT(dst_size ==
-                                                               entries[entry_idx].virtual_size);
+                                    // Copy out the decompressed data.
+                                    R_TRY(read_func(
+                                        entries[entry_idx].virtual_size,
+                                        [&](void* dst, size_t dst_size) -> Result {
+                                            // Check that the size is valid.
+                                            ASSERT(dst_size == entries[entry_idx].virtual_size);
 
-                                                        // Perform the decompression.
-                                                        R_RETURN(decompressor(
-                                                            dst, entries[entry_idx].virtual_size,
-                                                            buffer + buffer_offset,
-                                                            entries[entry_idx].physical_size));
-                                                    }));
+                                            std::memcpy(dst, block->data(), block->size());
+                                            R_SUCCEED();
+                                        }));
 
                                     break;
                                 }
@@ -510,10 +595,47 @@ private:
                 R_SUCCEED();
             };
 
+            auto FlushRequiredRead = [&]() -> Result {
+                // Perform the required read.
+                R_TRY(PerformRequiredRead());
+
+                // Reset our requirements.
+                prev_entry.virt_offset = -1;
+                required_access_physical_size = 0;
+                entry_count = 0;
+                will_allocate_pooled_buffer = false;
+
+                R_SUCCEED();
+            };
+
             R_TRY(this->OperatePerEntry(
                 offset, size,
                 [&](bool* out_continuous, const Entry& entry, s64 virtual_data_size,
                     s64 data_offset, s64 read_size) -> Result {
+                    // If we recently decompressed this whole block, serve it from the cache.
+                    if (entry.compression_type != CompressionType::None &&
+                        CompressionTypeUtility::IsDataStorageAccessRequired(
+                            entry.compression_type) &&
+                        data_offset == 0 && virtual_data_size == read_size) {
+                        if (const auto block = m_block_cache.Find(entry.virt_offset);
+                            block != nullptr && static_cast<s64>(block->size()) == read_size) {
+                            // Complete any pending access first, to keep the output in order.
+                            R_TRY(FlushRequiredRead());
+
+                            R_TRY(read_func(static_cast<size_t>(read_size),
+                                            [&](void* dst, size_t dst_size) -> Result {
+                                                // Check that the size is valid.
+                                                ASSERT(dst_size == block->size());
+
+                                                std::memcpy(dst, block->data(), block->size());
+                                                R_SUCCEED();
+                                            }));
+
+                            *out_continuous = true;
+                            R_SUCCEED();
+                        }
+                    }
+
                     // Determine the physical extents.
                     s64 physical_offset, physical_size;
                     if (CompressionTypeUtility::IsRandomAccessible(entry.compression_type)) {
@@ -544,17 +666,8 @@ private:
                                    required_access_physical_size <=
                                        static_cast<s64>(m_continuous_reading_size_max));
 
-                            // Perform the required read.
-                            const Result rc = PerformRequiredRead();
-                            if (R_FAILED(rc)) {
-                                R_THROW(rc);
-                            }
-
-                            // Reset our requirements.
-                            prev_entry.virt_offset = -1;
-                            required_access_physical_size = 0;
-                            entry_count = 0;
-                            will_allocate_pooled_buffer = false;
+                            // Perform the required read and reset our requirements.
+                            R_TRY(FlushRequiredRead());
                         }
                     }
 
@@ -592,6 +705,7 @@ private:
 
                         // Create an entry to access the data storage.
                         entries[entry_count++] = {
+                            .virtual_offset = entry.virt_offset,
                             .compression_type = entry.compression_type,
                             .gap_from_prev = static_cast<u32>(gap_from_prev),
                             .physical_size = static_cast<u32>(physical_size),
@@ -611,6 +725,7 @@ private:
 
                             // Create a fake entry.
                             entries[entry_count++] = {
+                                .virtual_offset = entry.virt_offset,
                                 .compression_type = CompressionType::Zeros,
                                 .gap_from_prev = 0,
                                 .physical_size = 0,
@@ -671,6 +786,7 @@ private:
         BucketTree m_table;
         VirtualFile m_data_storage;
         GetDecompressorFunction m_get_decompressor_function;
+        DecompressedBlockCache m_block_cache;
     };
 
     class CacheManager {
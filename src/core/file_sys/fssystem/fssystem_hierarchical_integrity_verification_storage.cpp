@@ -16,7 +16,7 @@ HierarchicalIntegrityVerificationStorage::HierarchicalIntegrityVerificationStora
 Result HierarchicalIntegrityVerificationStorage::Initialize(
     const HierarchicalIntegrityVerificationInformation& info,
     HierarchicalStorageInformation storage, int max_data_cache_entries, int max_hash_cache_entries,
-    s8 buffer_level) {
+    s8 buffer_level, VerificationMode verification_mode) {
     // Validate preconditions.
     ASSERT(IntegrityMinLayerCount <= info.max_layers && info.max_layers <= IntegrityMaxLayerCount);
 
@@ -27,7 +27,7 @@ Result HierarchicalIntegrityVerificationStorage::Initialize(
     m_verify_storages[0]->Initialize(storage[HierarchicalStorageInformation::MasterStorage],
                                      storage[HierarchicalStorageInformation::Layer1Storage],
                                      static_cast<s64>(1) << info.info[0].block_order, HashSize,
-                                     false);
+                                     false, verification_mode);
 
     // Ensure we don't leak state if further initialization goes wrong.
     ON_RESULT_FAILURE {
@@ -59,7 +59,7 @@ Result HierarchicalIntegrityVerificationStorage::Initialize(
         m_verify_storages[level + 1]->Initialize(
             std::move(buffer_storage), storage[level + 2],
             static_cast<s64>(1) << info.info[level + 1].block_order,
-            static_cast<s64>(1) << info.info[level].block_order, false);
+            static_cast<s64>(1) << info.info[level].block_order, false, verification_mode);
 
         // Initialize the buffer storage.
         m_buffer_storages[level + 1] = m_verify_storages[level + 1];
@@ -75,7 +75,7 @@ Result HierarchicalIntegrityVerificationStorage::Initialize(
         m_verify_storages[level + 1]->Initialize(
             std::move(buffer_storage), storage[level + 2],
             static_cast<s64>(1) << info.info[level + 1].block_order,
-            static_cast<s64>(1) << info.info[level].block_order, true);
+            static_cast<s64>(1) << info.info[level].block_order, true, verification_mode);
 
         // Initialize the buffer storage.
         m_buffer_storages[level + 1] = m_verify_storages[level + 1];
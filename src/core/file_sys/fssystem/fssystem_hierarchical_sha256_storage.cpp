@@ -1,7 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+#include <vector>
+
+#include <mbedtls/sha256.h>
+
 #include "common/alignment.h"
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
 
@@ -23,7 +29,8 @@ s32 Log2(s32 value) {
 } // namespace
 
 Result HierarchicalSha256Storage::Initialize(VirtualFile* base_storages, s32 layer_count,
-                                             size_t htbs, void* hash_buf, size_t hash_buf_size) {
+                                             size_t htbs, void* hash_buf, size_t hash_buf_size,
+                                             VerificationMode verification_mode) {
     // Validate preconditions.
     ASSERT(layer_count == LayerCount);
     ASSERT(Common::IsPowerOfTwo(htbs));
@@ -63,6 +70,21 @@ Result HierarchicalSha256Storage::Initialize(VirtualFile* base_storages, s32 lay
     base_storages[1]->Read(reinterpret_cast<u8*>(m_hash_buffer),
                            static_cast<size_t>(hash_storage_size), 0);
 
+    // If we verify our data, check the hashes against the master hash and set up tracking of
+    // the verified blocks.
+    m_verification_state.reset();
+    if (verification_mode != VerificationMode::Off) {
+        std::array<u8, HashSize> hash{};
+        mbedtls_sha256_ret(reinterpret_cast<const u8*>(m_hash_buffer),
+                           static_cast<size_t>(hash_storage_size), hash.data(), 0);
+        R_UNLESS(hash == master_hash, ResultHierarchicalSha256HashVerificationFailed);
+
+        const s64 block_count = Common::DivideUp(m_base_storage_size,
+                                                 static_cast<s64>(m_hash_target_block_size));
+        m_verification_state =
+            std::make_shared<BlockVerificationState>(verification_mode, block_count);
+    }
+
     R_SUCCEED();
 }
 
@@ -75,8 +97,110 @@ size_t HierarchicalSha256Storage::Read(u8* buffer, size_t size, size_t offset) c
     // Validate that we have a buffer to read into.
     ASSERT(buffer != nullptr);
 
+    // Fail if asynchronous verification found corrupted data.
+    if (m_verification_state != nullptr && m_verification_state->HasFailed()) {
+        return 0;
+    }
+
     // Read the data.
-    return m_base_storage->Read(buffer, size, offset);
+    const size_t read_size = m_base_storage->Read(buffer, size, offset);
+
+    // Verify the blocks we read, if we should.
+    if (m_verification_state != nullptr && read_size > 0 &&
+        !this->VerifyRead(buffer, read_size, offset)) {
+        return 0;
+    }
+
+    return read_size;
+}
+
+bool HierarchicalSha256Storage::VerifyRead(const u8* buffer, size_t size, size_t offset) const {
+    const s64 block_size = m_hash_target_block_size;
+    const s64 read_offset = static_cast<s64>(offset);
+    const s64 read_end = read_offset + static_cast<s64>(size);
+
+    for (s64 block_index = read_offset / block_size; block_index * block_size < read_end;
+         ++block_index) {
+        // The last block only covers the remainder of the storage.
+        const s64 block_offset = block_index * block_size;
+        const auto cur_size =
+            static_cast<size_t>(std::min(block_size, m_base_storage_size - block_offset));
+
+        // Blocks entirely within the read can be hashed from the caller's buffer.
+        const u8* block_data = nullptr;
+        if (read_offset <= block_offset && block_offset + static_cast<s64>(cur_size) <= read_end) {
+            block_data = buffer + (block_offset - read_offset);
+        }
+
+        BlockHash expected_hash;
+        std::memcpy(expected_hash.data(), m_hash_buffer + (block_offset >> m_log_size_ratio),
+                    HashSize);
+
+        if (m_verification_state->GetMode() == VerificationMode::Once) {
+            // Each block only needs to be verified once per session.
+            if (m_verification_state->IsVerified(block_index)) {
+                continue;
+            }
+
+            if (!VerifyBlock(m_base_storage, block_offset, cur_size, block_data, expected_hash)) {
+                LOG_ERROR(Common_Filesystem, "Hash mismatch in block {}", block_index);
+                return false;
+            }
+
+            m_verification_state->SetVerified(block_index);
+        } else {
+            // Queue the block for verification off the read path, unless it has been already.
+            if (!m_verification_state->TrySetVerified(block_index)) {
+                continue;
+            }
+
+            // The base storage is not thread-safe, read the block here and only hash it on the
+            // worker threads.
+            std::vector<u8> block;
+            if (block_data != nullptr) {
+                block.assign(block_data, block_data + cur_size);
+            } else {
+                block.resize(cur_size);
+                if (m_base_storage->Read(block.data(), cur_size, block_offset) != cur_size) {
+                    m_verification_state->SetFailed(block_index);
+                    continue;
+                }
+            }
+
+            BlockVerificationState::QueueVerification(
+                [state = m_verification_state, block_index, expected_hash,
+                 block = std::move(block)] {
+                    if (!CheckHash(block.data(), block.size(), expected_hash)) {
+                        state->SetFailed(block_index);
+                    }
+                });
+        }
+    }
+
+    return true;
+}
+
+bool HierarchicalSha256Storage::VerifyBlock(const VirtualFile& base_storage, s64 block_offset,
+                                            size_t block_size, const u8* block_data,
+                                            const BlockHash& expected_hash) {
+    // Read the block ourselves if we weren't given it.
+    std::vector<u8> block;
+    if (block_data == nullptr) {
+        block.resize(block_size);
+        if (base_storage->Read(block.data(), block_size, block_offset) != block_size) {
+            return false;
+        }
+        block_data = block.data();
+    }
+
+    return CheckHash(block_data, block_size, expected_hash);
+}
+
+bool HierarchicalSha256Storage::CheckHash(const u8* block_data, size_t block_size,
+                                          const BlockHash& expected_hash) {
+    BlockHash hash{};
+    mbedtls_sha256_ret(block_data, block_size, hash.data(), 0);
+    return hash == expected_hash;
 }
 
 } // namespace FileSys
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
 #include <mutex>
 
 #include "core/file_sys/errors.h"
 #include "core/file_sys/fssystem/fs_i_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_verification_state.h"
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
@@ -23,7 +26,7 @@ public:
     HierarchicalSha256Storage() : m_mutex() {}
 
     Result Initialize(VirtualFile* base_storages, s32 layer_count, size_t htbs, void* hash_buf,
-                      size_t hash_buf_size);
+                      size_t hash_buf_size, VerificationMode verification_mode);
 
     virtual size_t GetSize() const override {
         return m_base_storage->GetSize();
@@ -31,6 +34,18 @@ public:
 
     virtual size_t Read(u8* buffer, size_t length, size_t offset) const override;
 
+private:
+    using BlockHash = std::array<u8, HashSize>;
+
+    // Checks the blocks touched by a read that has already been performed into buffer.
+    bool VerifyRead(const u8* buffer, size_t size, size_t offset) const;
+
+    static bool VerifyBlock(const VirtualFile& base_storage, s64 block_offset, size_t block_size,
+                            const u8* block_data, const BlockHash& expected_hash);
+
+    // Only touches its arguments, so it may run on the verification threads.
+    static bool CheckHash(const u8* block_data, size_t block_size, const BlockHash& expected_hash);
+
 private:
     VirtualFile m_base_storage;
     s64 m_base_storage_size;
@@ -39,6 +54,7 @@ private:
     s32 m_hash_target_block_size;
     s32 m_log_size_ratio;
     std::mutex m_mutex;
+    std::shared_ptr<BlockVerificationState> m_verification_state;
 };
 
 } // namespace FileSys
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mbedtls/sha256.h>
+
 #include "common/alignment.h"
+#include "common/logging/log.h"
 #include "core/file_sys/fssystem/fssystem_integrity_verification_storage.h"
 
 namespace FileSys {
@@ -12,7 +15,8 @@ constexpr inline u32 ILog2(u32 val) {
 }
 
 void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s64 verif_block_size,
-                                              s64 upper_layer_verif_block_size, bool is_real_data) {
+                                              s64 upper_layer_verif_block_size, bool is_real_data,
+                                              VerificationMode verification_mode) {
     // Validate preconditions.
     ASSERT(verif_block_size >= HashSize);
 
@@ -40,11 +44,21 @@ void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s6
 
     // Set data.
     m_is_real_data = is_real_data;
+
+    // Set up tracking of the verified blocks, if we verify at all.
+    m_verification_state.reset();
+    if (verification_mode != VerificationMode::Off) {
+        const s64 data_size = m_data_storage->GetSize();
+        const s64 block_count = Common::DivideUp(data_size, m_verification_block_size);
+        m_verification_state =
+            std::make_shared<BlockVerificationState>(verification_mode, block_count);
+    }
 }
 
 void IntegrityVerificationStorage::Finalize() {
     m_hash_storage = VirtualFile();
     m_data_storage = VirtualFile();
+    m_verification_state.reset();
 }
 
 size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset) const {
@@ -56,6 +70,11 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
     // Validate arguments.
     ASSERT(buffer != nullptr);
 
+    // Fail if asynchronous verification found corrupted data.
+    if (m_verification_state != nullptr && m_verification_state->HasFailed()) {
+        return 0;
+    }
+
     // Validate the offset.
     s64 data_size = m_data_storage->GetSize();
     ASSERT(offset <= static_cast<size_t>(data_size));
@@ -81,7 +100,115 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
     }
 
     // Perform the read.
-    return m_data_storage->Read(buffer, read_size, offset);
+    const size_t result = m_data_storage->Read(buffer, read_size, offset);
+
+    // Verify the blocks we read, if we should.
+    if (m_verification_state != nullptr && !this->VerifyRead(buffer, size, offset)) {
+        return 0;
+    }
+
+    return result;
+}
+
+bool IntegrityVerificationStorage::VerifyRead(const u8* buffer, size_t size,
+                                              size_t offset) const {
+    const s64 block_size = m_verification_block_size;
+    const s64 read_offset = static_cast<s64>(offset);
+    const s64 read_end = read_offset + static_cast<s64>(size);
+    const s64 first_block = read_offset >> m_verification_block_order;
+    const s64 last_block = (read_end - 1) >> m_verification_block_order;
+
+    for (s64 block_index = first_block; block_index <= last_block; ++block_index) {
+        // Blocks entirely within the read can be hashed from the caller's buffer.
+        const s64 block_offset = block_index << m_verification_block_order;
+        const u8* block_data = nullptr;
+        if (read_offset <= block_offset && block_offset + block_size <= read_end) {
+            block_data = buffer + (block_offset - read_offset);
+        }
+
+        if (m_verification_state->GetMode() == VerificationMode::Once) {
+            // Each block only needs to be verified once per session.
+            if (m_verification_state->IsVerified(block_index)) {
+                continue;
+            }
+
+            if (!VerifyBlock(m_hash_storage, m_data_storage, block_size, block_index,
+                             block_data)) {
+                LOG_ERROR(Common_Filesystem, "Hash mismatch in block {}", block_index);
+                return false;
+            }
+
+            m_verification_state->SetVerified(block_index);
+        } else {
+            // Queue the block for verification off the read path, unless it has been already.
+            if (!m_verification_state->TrySetVerified(block_index)) {
+                continue;
+            }
+
+            // The storages are not thread-safe, read the block and its hash here and only hash it
+            // on the worker threads.
+            BlockHash expected_hash{};
+            if (!ReadExpectedHash(m_hash_storage, block_index, expected_hash)) {
+                m_verification_state->SetFailed(block_index);
+                continue;
+            }
+            std::vector<u8> block;
+            if (block_data != nullptr) {
+                block.assign(block_data, block_data + block_size);
+            } else {
+                ReadBlock(m_data_storage, block_size, block_index, block);
+            }
+
+            BlockVerificationState::QueueVerification(
+                [state = m_verification_state, block_index, expected_hash,
+                 block = std::move(block)] {
+                    if (!CheckHash(block.data(), block.size(), expected_hash)) {
+                        state->SetFailed(block_index);
+                    }
+                });
+        }
+    }
+
+    return true;
+}
+
+bool IntegrityVerificationStorage::VerifyBlock(const VirtualFile& hash_storage,
+                                               const VirtualFile& data_storage, s64 block_size,
+                                               s64 block_index, const u8* block_data) {
+    // Read the block ourselves if we weren't given it.
+    std::vector<u8> block;
+    if (block_data == nullptr) {
+        ReadBlock(data_storage, block_size, block_index, block);
+        block_data = block.data();
+    }
+
+    // Get the expected hash.
+    BlockHash expected_hash{};
+    if (!ReadExpectedHash(hash_storage, block_index, expected_hash)) {
+        return false;
+    }
+
+    return CheckHash(block_data, static_cast<size_t>(block_size), expected_hash);
+}
+
+void IntegrityVerificationStorage::ReadBlock(const VirtualFile& data_storage, s64 block_size,
+                                             s64 block_index, std::vector<u8>& block) {
+    // Pad the block with zeroes past the end of the data, as reads do.
+    block.assign(static_cast<size_t>(block_size), 0);
+    data_storage->Read(block.data(), block.size(), block_index * block_size);
+}
+
+bool IntegrityVerificationStorage::ReadExpectedHash(const VirtualFile& hash_storage,
+                                                    s64 block_index, BlockHash& expected_hash) {
+    return hash_storage->Read(expected_hash.hash.data(), HashSize, block_index * HashSize) ==
+           HashSize;
+}
+
+bool IntegrityVerificationStorage::CheckHash(const u8* block_data, size_t block_size,
+                                             const BlockHash& expected_hash) {
+    BlockHash hash{};
+    mbedtls_sha256_ret(block_data, block_size, hash.hash.data(), 0);
+    return hash.hash == expected_hash.hash;
 }
 
 size_t IntegrityVerificationStorage::GetSize() const {
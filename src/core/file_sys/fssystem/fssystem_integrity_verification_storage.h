@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fs_types.h"
+#include "core/file_sys/fssystem/fssystem_block_verification_state.h"
 
 namespace FileSys {
 
@@ -31,7 +33,8 @@ public:
     }
 
     void Initialize(VirtualFile hs, VirtualFile ds, s64 verif_block_size,
-                    s64 upper_layer_verif_block_size, bool is_real_data);
+                    s64 upper_layer_verif_block_size, bool is_real_data,
+                    VerificationMode verification_mode);
     void Finalize();
 
     virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
@@ -42,6 +45,20 @@ public:
     }
 
 private:
+    // Checks the blocks touched by a read that has already been performed into buffer.
+    bool VerifyRead(const u8* buffer, size_t size, size_t offset) const;
+
+    static bool VerifyBlock(const VirtualFile& hash_storage, const VirtualFile& data_storage,
+                            s64 block_size, s64 block_index, const u8* block_data);
+
+    static void ReadBlock(const VirtualFile& data_storage, s64 block_size, s64 block_index,
+                          std::vector<u8>& block);
+    static bool ReadExpectedHash(const VirtualFile& hash_storage, s64 block_index,
+                                 BlockHash& expected_hash);
+
+    // Only touches its arguments, so it may run on the verification threads.
+    static bool CheckHash(const u8* block_data, size_t block_size, const BlockHash& expected_hash);
+
     static void SetValidationBit(BlockHash* hash) {
         ASSERT(hash != nullptr);
         hash->hash[HashSize - 1] |= 0x80;
@@ -60,6 +77,7 @@ private:
     s64 m_upper_layer_verification_block_size;
     s64 m_upper_layer_verification_block_order;
     bool m_is_real_data;
+    std::shared_ptr<BlockVerificationState> m_verification_state;
 };
 
 } // namespace FileSys
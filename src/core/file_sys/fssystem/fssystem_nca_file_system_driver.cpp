@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "core/file_sys/fssystem/fssystem_aes_ctr_counter_extended_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
@@ -1148,9 +1149,10 @@ Result NcaFileSystemDriver::CreateSha256Storage(
     };
 
     // Initialize the verification storage.
-    R_TRY(verification_storage->Initialize(layer_storages.data(), VerificationStorage::LayerCount,
-                                           hash_data.hash_block_size,
-                                           buffer_hold_storage->GetBuffer(), hash_buffer_size));
+    R_TRY(verification_storage->Initialize(
+        layer_storages.data(), VerificationStorage::LayerCount, hash_data.hash_block_size,
+        buffer_hold_storage->GetBuffer(), hash_buffer_size,
+        Settings::values.integrity_verification_mode.GetValue()));
 
     // Set the output.
     *out = std::move(verification_storage);
@@ -1261,7 +1263,8 @@ Result NcaFileSystemDriver::CreateIntegrityVerificationStorageImpl(
     // Initialize the integrity storage.
     R_TRY(integrity_storage->Initialize(level_hash_info, meta_info.master_hash, storage_info,
                                         max_data_cache_entries, max_hash_cache_entries,
-                                        buffer_level));
+                                        buffer_level,
+                                        Settings::values.integrity_verification_mode.GetValue()));
 
     // Set the output.
     *out = std::move(integrity_storage);
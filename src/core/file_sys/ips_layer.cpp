@@ -64,18 +64,15 @@ static bool IsEOF(IPSFileType type, const std::vector<u8>& data) {
     return type == IPSFileType::IPS32 && std::equal(data.begin(), data.end(), eeof.begin());
 }
 
-VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
-    if (in == nullptr || ips == nullptr)
-        return nullptr;
+std::optional<CompiledPatch> CompileIPS(const VirtualFile& ips) {
+    if (ips == nullptr)
+        return std::nullopt;
 
     const auto type = IdentifyMagic(ips->ReadBytes(0x5));
     if (type == IPSFileType::Error)
-        return nullptr;
+        return std::nullopt;
 
-    auto in_data = in->ReadAllBytes();
-    if (in_data.size() == 0) {
-        return nullptr;
-    }
+    CompiledPatch out{.strict = true};
 
     std::vector<u8> temp(type == IPSFileType::IPS ? 3 : 4);
     u64 offset = 5; // After header
@@ -91,41 +88,80 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
         else
             real_offset = (temp[0] << 16) | (temp[1] << 8) | temp[2];
 
-        if (real_offset > in_data.size()) {
-            return nullptr;
-        }
-
         u16 data_size{};
         if (ips->ReadObject(&data_size, offset) != sizeof(u16))
-            return nullptr;
+            return std::nullopt;
         data_size = Common::swap16(data_size);
         offset += sizeof(u16);
 
         if (data_size == 0) { // RLE
             u16 rle_size{};
             if (ips->ReadObject(&rle_size, offset) != sizeof(u16))
-                return nullptr;
+                return std::nullopt;
             rle_size = Common::swap16(rle_size);
             offset += sizeof(u16);
 
             const auto data = ips->ReadByte(offset++);
             if (!data)
-                return nullptr;
+                return std::nullopt;
 
-            if (real_offset + rle_size > in_data.size())
-                rle_size = static_cast<u16>(in_data.size() - real_offset);
-            std::memset(in_data.data() + real_offset, *data, rle_size);
+            out.runs.push_back({real_offset, std::vector<u8>(rle_size, *data), true});
         } else { // Standard Patch
-            auto read = data_size;
-            if (real_offset + read > in_data.size())
-                read = static_cast<u16>(in_data.size() - real_offset);
-            if (ips->Read(in_data.data() + real_offset, read, offset) != data_size)
-                return nullptr;
+            auto data = ips->ReadBytes(data_size, offset);
+            if (data.size() != data_size)
+                return std::nullopt;
             offset += data_size;
+
+            out.runs.push_back({real_offset, std::move(data), false});
         }
     }
 
     if (!IsEOF(type, temp)) {
+        return std::nullopt;
+    }
+
+    return out;
+}
+
+bool ApplyCompiledPatch(std::span<u8> data, const CompiledPatch& patch, std::size_t image_offset) {
+    const auto image_size = image_offset + data.size();
+
+    if (patch.strict) {
+        const auto fits = [image_size](const CompiledPatch::Run& run) {
+            return run.offset <= image_size &&
+                   (run.clip || run.offset + run.data.size() <= image_size);
+        };
+        if (!std::all_of(patch.runs.begin(), patch.runs.end(), fits)) {
+            return false;
+        }
+    }
+
+    for (const auto& run : patch.runs) {
+        const auto begin = std::max<std::size_t>(run.offset, image_offset);
+        const auto end = std::min<std::size_t>(run.offset + run.data.size(), image_size);
+        if (begin >= end)
+            continue;
+        std::memcpy(data.data() + (begin - image_offset), run.data.data() + (begin - run.offset),
+                    end - begin);
+    }
+
+    return true;
+}
+
+VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
+    if (in == nullptr)
+        return nullptr;
+
+    const auto patch = CompileIPS(ips);
+    if (!patch)
+        return nullptr;
+
+    auto in_data = in->ReadAllBytes();
+    if (in_data.size() == 0) {
+        return nullptr;
+    }
+
+    if (!ApplyCompiledPatch(in_data, *patch)) {
         return nullptr;
     }
 
@@ -316,27 +352,30 @@ void IPSwitchCompiler::Parse() {
     valid = true;
 }
 
-VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
-    if (in == nullptr || !valid)
-        return nullptr;
-
-    auto in_data = in->ReadAllBytes();
+CompiledPatch IPSwitchCompiler::Compile() const {
+    CompiledPatch out;
+    if (!valid)
+        return out;
 
     for (const auto& patch : patches) {
         if (!patch.enabled)
             continue;
 
         for (const auto& record : patch.records) {
-            if (record.first >= in_data.size())
-                continue;
-            auto replace_size = record.second.size();
-            if (record.first + replace_size > in_data.size())
-                replace_size = in_data.size() - record.first;
-            for (std::size_t i = 0; i < replace_size; ++i)
-                in_data[i + record.first] = record.second[i];
+            out.runs.push_back({record.first, record.second, false});
         }
     }
 
+    return out;
+}
+
+VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
+    if (in == nullptr || !valid)
+        return nullptr;
+
+    auto in_data = in->ReadAllBytes();
+    ApplyCompiledPatch(in_data, Compile());
+
     return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
                                            in->GetContainingDirectory());
 }
@@ -5,6 +5,8 @@
 
 #include <array>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "common/common_types.h"
@@ -12,6 +14,28 @@
 
 namespace FileSys {
 
+// A patch reduced to the byte runs it writes, in the order they are applied.
+struct CompiledPatch {
+    struct Run {
+        u32 offset;
+        std::vector<u8> data;
+        // Set for IPS RLE records, which are clipped at the end of the image instead of
+        // rejecting the patch.
+        bool clip;
+    };
+
+    std::vector<Run> runs;
+    // IPS patches are rejected as a whole if a record does not fit the image.
+    bool strict = false;
+};
+
+std::optional<CompiledPatch> CompileIPS(const VirtualFile& ips);
+
+// Applies the runs of a compiled patch in place. data holds the image starting at image_offset,
+// bytes before it are left alone. Returns false if a strict patch did not fit the image.
+bool ApplyCompiledPatch(std::span<u8> data, const CompiledPatch& patch,
+                        std::size_t image_offset = 0);
+
 VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips);
 
 class IPSwitchCompiler {
@@ -21,6 +45,7 @@ public:
 
     std::array<u8, 0x20> GetBuildID() const;
     bool IsValid() const;
+    CompiledPatch Compile() const;
     VirtualFile Apply(const VirtualFile& in) const;
 
 private:
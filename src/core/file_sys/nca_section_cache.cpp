@@ -0,0 +1,460 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/memory_accounting.h"
+#include "common/settings.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/nca_section_cache.h"
+#include "core/file_sys/vfs/vfs.h"
+
+namespace FileSys {
+namespace {
+
+using namespace Common::Literals;
+
+constexpr u32 CacheMagic = 0x43534E59; // "YNSC"
+constexpr u32 CacheVersion = 1;
+
+/// Granularity at which sections are cached, a multiple of the page size of all supported hosts.
+constexpr size_t ChunkSize = 64_KiB;
+
+/// Sections smaller than this are cheap to decrypt and are not worth an entry.
+constexpr size_t MinimumSectionSize = 16_MiB;
+
+/// Chunk data waiting to be written is dropped past this, so bulk reads do not pile up memory.
+constexpr size_t MaxPendingStoreSize = 64_MiB;
+
+/// Number of chunks stored between rewrites of the chunk map, so a crash loses at most this many.
+constexpr size_t PersistInterval = 256;
+
+struct MapHeader {
+    u32 magic;
+    u32 version;
+    u64 section_size;
+    u64 chunk_size;
+};
+static_assert(std::is_trivially_copyable_v<MapHeader>);
+
+enum class ChunkState : u8 {
+    Missing,
+    Pending,
+    Stored,
+};
+
+Common::ThreadWorker& GetStoreWorker() {
+    static Common::ThreadWorker worker{1, "NcaSectionCache"};
+    return worker;
+}
+
+std::atomic<size_t> pending_store_size{};
+
+/// Backing files of a single cached section, shared by all NCA instances of that section.
+class CacheEntry {
+public:
+    explicit CacheEntry(std::filesystem::path data_path_, std::filesystem::path map_path_,
+                        u64 section_size_)
+        : data_path{std::move(data_path_)}, map_path{std::move(map_path_)},
+          section_size{section_size_}, num_chunks{(section_size_ + ChunkSize - 1) / ChunkSize} {
+        std::vector<u8> stored = LoadChunkMap();
+        if (stored.empty()) {
+            // Start over with an empty data file of the section size.
+            Common::FS::RemoveFile(map_path);
+            Common::FS::RemoveFile(data_path);
+            if (!Common::FS::NewFile(data_path)) {
+                return;
+            }
+            stored.resize(num_chunks);
+        }
+
+        data_file.Open(data_path, Common::FS::FileAccessMode::ReadWrite);
+        if (!data_file.IsOpen() || !data_file.SetSize(section_size)) {
+            data_file.Close();
+            return;
+        }
+
+        mapping = Common::FS::MappedFile{data_path};
+        if (!mapping.IsOpen() || mapping.Size() != section_size) {
+            mapping.Close();
+            data_file.Close();
+            return;
+        }
+
+        durable.assign(stored.begin(), stored.end());
+        states.resize(num_chunks);
+        for (size_t i = 0; i < num_chunks; ++i) {
+            states[i] = durable[i] ? ChunkState::Stored : ChunkState::Missing;
+        }
+    }
+
+    ~CacheEntry() {
+        if (!IsValid()) {
+            return;
+        }
+        mapping.Close();
+        if (unsaved_chunks != 0) {
+            PersistChunkMapLocked();
+        }
+        data_file.Close();
+    }
+
+    CacheEntry(const CacheEntry&) = delete;
+    CacheEntry& operator=(const CacheEntry&) = delete;
+
+    [[nodiscard]] bool IsValid() const {
+        return mapping.IsOpen();
+    }
+
+    [[nodiscard]] u64 GetSize() const {
+        return section_size;
+    }
+
+    /// Copies data stored in a previous session, served from the mapping without locking.
+    [[nodiscard]] bool ReadDurable(u8* data, size_t length, size_t offset) const {
+        if (!durable[offset / ChunkSize]) {
+            return false;
+        }
+        std::memcpy(data, mapping.Data().data() + offset, length);
+        return true;
+    }
+
+    /// Copies data stored this session, which is not covered by the mapping.
+    [[nodiscard]] bool ReadStored(u8* data, size_t length, size_t offset) {
+        std::scoped_lock lk{mutex};
+        if (states[offset / ChunkSize] != ChunkState::Stored) {
+            return false;
+        }
+        return data_file.Seek(static_cast<s64>(offset)) &&
+               data_file.ReadSpan(std::span<u8>(data, length)) == length;
+    }
+
+    /// Marks a missing chunk as about to be stored, returns false if it is not missing.
+    [[nodiscard]] bool ClaimChunk(size_t chunk) {
+        std::scoped_lock lk{mutex};
+        if (states[chunk] != ChunkState::Missing) {
+            return false;
+        }
+        states[chunk] = ChunkState::Pending;
+        return true;
+    }
+
+    /// Writes claimed chunks starting at offset, making them available to ReadStored.
+    void Store(size_t offset, std::span<const u8> data) {
+        std::scoped_lock lk{mutex};
+        const bool written = data_file.Seek(static_cast<s64>(offset)) &&
+                             data_file.WriteSpan(data) == data.size();
+        const size_t first_chunk = offset / ChunkSize;
+        const size_t end_chunk = (offset + data.size() + ChunkSize - 1) / ChunkSize;
+        for (size_t i = first_chunk; i < end_chunk; ++i) {
+            states[i] = written ? ChunkState::Stored : ChunkState::Missing;
+        }
+        if (written) {
+            unsaved_chunks += end_chunk - first_chunk;
+        }
+        if (unsaved_chunks >= PersistInterval) {
+            PersistChunkMapLocked();
+        }
+    }
+
+    /// Releases claimed chunks that could not be stored.
+    void ReleaseChunks(size_t first_chunk, size_t end_chunk) {
+        std::scoped_lock lk{mutex};
+        for (size_t i = first_chunk; i < end_chunk; ++i) {
+            states[i] = ChunkState::Missing;
+        }
+    }
+
+private:
+    /// Records the stored chunks in the map file, once their contents have been written out.
+    void PersistChunkMapLocked() {
+        if (!data_file.Flush()) {
+            return;
+        }
+        unsaved_chunks = 0;
+
+        std::vector<u8> stored(num_chunks);
+        for (size_t i = 0; i < num_chunks; ++i) {
+            stored[i] = states[i] == ChunkState::Stored ? 1 : 0;
+        }
+        const MapHeader header{
+            .magic = CacheMagic,
+            .version = CacheVersion,
+            .section_size = section_size,
+            .chunk_size = ChunkSize,
+        };
+        Common::FS::IOFile map_file(map_path, Common::FS::FileAccessMode::Write,
+                                    Common::FS::FileType::BinaryFile);
+        if (!map_file.IsOpen() || !map_file.WriteObject(header) ||
+            map_file.WriteSpan(std::span<const u8>(stored)) != stored.size()) {
+            map_file.Close();
+            Common::FS::RemoveFile(map_path);
+        }
+    }
+
+    [[nodiscard]] std::vector<u8> LoadChunkMap() const {
+        Common::FS::IOFile map_file(map_path, Common::FS::FileAccessMode::Read,
+                                    Common::FS::FileType::BinaryFile);
+        if (!map_file.IsOpen() || Common::FS::GetSize(data_path) != section_size) {
+            return {};
+        }
+        MapHeader header{};
+        if (!map_file.ReadObject(header) || header.magic != CacheMagic ||
+            header.version != CacheVersion || header.section_size != section_size ||
+            header.chunk_size != ChunkSize) {
+            return {};
+        }
+        std::vector<u8> stored(num_chunks);
+        if (map_file.ReadSpan(std::span<u8>(stored)) != stored.size()) {
+            return {};
+        }
+        return stored;
+    }
+
+    std::filesystem::path data_path;
+    std::filesystem::path map_path;
+    u64 section_size;
+    size_t num_chunks;
+
+    Common::FS::MappedFile mapping;
+    std::vector<u8> durable;
+
+    std::mutex mutex;
+    Common::FS::IOFile data_file;
+    std::vector<ChunkState> states;
+    size_t unsaved_chunks{};
+};
+
+/// Removes the least recently used entries until needed_size more bytes fit in the cache.
+bool MakeRoom(const std::filesystem::path& cache_dir, const std::filesystem::path& data_path,
+              u64 needed_size) {
+    const u64 limit = u64{Settings::values.nca_section_cache_size.GetValue()} * 1_MiB;
+    if (needed_size > limit) {
+        return false;
+    }
+
+    std::vector<std::filesystem::directory_entry> entries;
+    u64 total_size = 0;
+    const Common::FS::DirEntryCallable callback =
+        [&](const std::filesystem::directory_entry& entry) {
+            if (entry.path().extension() == ".bin" && entry.path() != data_path) {
+                total_size += entry.file_size();
+                entries.push_back(entry);
+            }
+            return true;
+        };
+    Common::FS::IterateDirEntries(cache_dir, callback, Common::FS::DirEntryFilter::File);
+
+    std::ranges::sort(entries, {}, [](const std::filesystem::directory_entry& entry) {
+        return entry.last_write_time();
+    });
+    for (const auto& entry : entries) {
+        if (total_size + needed_size <= limit) {
+            break;
+        }
+        auto map_path = entry.path();
+        map_path.replace_extension(".map");
+        if (Common::FS::RemoveFile(entry.path())) {
+            Common::FS::RemoveFile(map_path);
+            total_size -= entry.file_size();
+        }
+    }
+    return total_size + needed_size <= limit;
+}
+
+std::shared_ptr<CacheEntry> OpenEntry(const u128& nca_key, s32 section_index,
+                                      u64 section_size) {
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<CacheEntry>, std::less<>> registry;
+
+    const auto name = fmt::format("{:016x}{:016x}_{}", nca_key[1], nca_key[0], section_index);
+    std::scoped_lock lk{registry_mutex};
+    if (const auto it = registry.find(name); it != registry.end()) {
+        if (auto entry = it->second.lock()) {
+            return entry;
+        }
+    }
+
+    const auto cache_dir =
+        Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "nca_sections";
+    if (!Common::FS::CreateDirs(cache_dir)) {
+        LOG_ERROR(Loader, "Failed to create NCA section cache directory");
+        return nullptr;
+    }
+
+    const auto data_path = cache_dir / (name + ".bin");
+    const auto map_path = cache_dir / (name + ".map");
+    if (!MakeRoom(cache_dir, data_path, section_size)) {
+        return nullptr;
+    }
+
+    auto entry = std::make_shared<CacheEntry>(data_path, map_path, section_size);
+    if (!entry->IsValid()) {
+        LOG_WARNING(Loader, "Failed to open NCA section cache entry {}", name);
+        return nullptr;
+    }
+
+    // Keep recently used entries from being evicted first.
+    std::error_code ec;
+    std::filesystem::last_write_time(data_path, std::filesystem::file_time_type::clock::now(),
+                                     ec);
+
+    registry[name] = entry;
+    return entry;
+}
+
+class CachedNcaSection final : public VfsFile {
+public:
+    explicit CachedNcaSection(VirtualFile section_, const u128& nca_key_, s32 section_index_)
+        : section{std::move(section_)}, nca_key{nca_key_}, section_index{section_index_} {}
+
+    std::string GetName() const override {
+        return section->GetName();
+    }
+
+    std::size_t GetSize() const override {
+        return section->GetSize();
+    }
+
+    bool Resize(std::size_t new_size) override {
+        return false;
+    }
+
+    VirtualDir GetContainingDirectory() const override {
+        return section->GetContainingDirectory();
+    }
+
+    bool IsWritable() const override {
+        return false;
+    }
+
+    bool IsReadable() const override {
+        return true;
+    }
+
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override {
+        const auto entry = GetEntry();
+        if (!entry) {
+            return section->Read(data, length, offset);
+        }
+
+        const size_t size = entry->GetSize();
+        if (offset >= size) {
+            return 0;
+        }
+        length = std::min(length, size - offset);
+
+        size_t done = 0;
+        while (done < length) {
+            const size_t cur_offset = offset + done;
+            const size_t chunk = cur_offset / ChunkSize;
+            const size_t cur_size = std::min(length - done, (chunk + 1) * ChunkSize - cur_offset);
+
+            if (entry->ReadDurable(data + done, cur_size, cur_offset) ||
+                entry->ReadStored(data + done, cur_size, cur_offset)) {
+                done += cur_size;
+                continue;
+            }
+
+            if (!entry->ClaimChunk(chunk)) {
+                // Being stored by another read, or the store failed: read it directly.
+                const size_t read = section->Read(data + done, cur_size, cur_offset);
+                done += read;
+                if (read != cur_size) {
+                    break;
+                }
+                continue;
+            }
+
+            // Read the whole chunk so that it can be stored.
+            const size_t chunk_offset = chunk * ChunkSize;
+            std::vector<u8> chunk_data(std::min<size_t>(ChunkSize, size - chunk_offset));
+            if (section->Read(chunk_data.data(), chunk_data.size(), chunk_offset) !=
+                chunk_data.size()) {
+                entry->ReleaseChunks(chunk, chunk + 1);
+                const size_t read = section->Read(data + done, cur_size, cur_offset);
+                done += read;
+                if (read != cur_size) {
+                    break;
+                }
+                continue;
+            }
+            std::memcpy(data + done, chunk_data.data() + (cur_offset - chunk_offset), cur_size);
+            done += cur_size;
+
+            QueueStore(entry, chunk_offset, std::move(chunk_data));
+        }
+        return done;
+    }
+
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override {
+        return 0;
+    }
+
+    bool Rename(std::string_view name) override {
+        return false;
+    }
+
+private:
+    std::shared_ptr<CacheEntry> GetEntry() const {
+        // Entries are only created on first read, so NCAs that are opened but never read from
+        // (e.g. while populating the game list) do not take up cache space.
+        std::call_once(entry_flag, [this] {
+            entry = OpenEntry(nca_key, section_index, section->GetSize());
+        });
+        return entry;
+    }
+
+    static void QueueStore(std::shared_ptr<CacheEntry> entry, size_t offset,
+                           std::vector<u8>&& chunk_data) {
+        const size_t chunk_size = chunk_data.size();
+        if (pending_store_size.fetch_add(chunk_size) + chunk_size > MaxPendingStoreSize) {
+            pending_store_size -= chunk_size;
+            const size_t chunk = offset / ChunkSize;
+            entry->ReleaseChunks(chunk, chunk + 1);
+            return;
+        }
+        Common::AddMemoryUsage(Common::MemoryCategory::VfsCache, chunk_size);
+        GetStoreWorker().QueueWork(
+            [entry = std::move(entry), offset, chunk_data = std::move(chunk_data)] {
+                entry->Store(offset, chunk_data);
+                pending_store_size -= chunk_data.size();
+                Common::RemoveMemoryUsage(Common::MemoryCategory::VfsCache, chunk_data.size());
+            });
+    }
+
+    VirtualFile section;
+    u128 nca_key;
+    s32 section_index;
+
+    mutable std::once_flag entry_flag;
+    mutable std::shared_ptr<CacheEntry> entry;
+};
+
+} // Anonymous namespace
+
+VirtualFile CreateCachedNcaSection(VirtualFile section, const u128& nca_key, s32 section_index) {
+    if (!Settings::values.use_nca_section_cache.GetValue() || section == nullptr ||
+        section->GetSize() < MinimumSectionSize) {
+        return section;
+    }
+    return std::make_shared<CachedNcaSection>(std::move(section), nca_key, section_index);
+}
+
+} // namespace FileSys
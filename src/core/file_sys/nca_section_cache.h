@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace FileSys {
+
+/**
+ * Wraps the decrypted (and decompressed) storage of an NCA section so that its contents are kept
+ * in the on-disk section cache, and served from a memory mapping of it in later sessions.
+ *
+ * The cache is opt-in (Settings::values.use_nca_section_cache) and bounded in size. Entries are
+ * keyed by a hash of the NCA header and title key plus the section index, and are filled in
+ * sparsely, one chunk at a time, as the section is read. The map of stored chunks is rewritten
+ * every few stored chunks, so an unclean exit only loses the most recent ones.
+ *
+ * @param section Decrypted section storage
+ * @param nca_key Key identifying the NCA (and any base NCA it patches)
+ * @param section_index Index of the section within the NCA
+ *
+ * @returns A file serving reads through the cache, or section if it is not cached.
+ */
+VirtualFile CreateCachedNcaSection(VirtualFile section, const u128& nca_key, s32 section_index);
+
+} // namespace FileSys
@@ -5,7 +5,10 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
+#include <unordered_map>
 
+#include "common/cityhash.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
@@ -114,6 +117,49 @@ void AppendCommaIfNotEmpty(std::string& to, std::string_view with) {
 bool IsDirValidAndNonEmpty(const VirtualDir& dir) {
     return dir != nullptr && (!dir->GetFiles().empty() || !dir->GetSubdirectories().empty());
 }
+
+struct CachedPatch {
+    u64 hash;
+    PatchManager::BuildID build_id;
+    // nullptr if the file is not a valid patch.
+    std::shared_ptr<const CompiledPatch> patch;
+};
+
+// Compiles an IPS or IPSwitch patch file once per process. Entries are keyed by path and
+// revalidated against a hash of the file contents, so edited patches are picked up.
+std::shared_ptr<const CachedPatch> GetCompiledPatch(const VirtualFile& file) {
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const CachedPatch>> cache;
+
+    auto bytes = file->ReadAllBytes();
+    const auto hash = Common::CityHash64(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    const auto path = file->GetFullPath();
+    {
+        std::scoped_lock lk{cache_mutex};
+        const auto it = cache.find(path);
+        if (it != cache.end() && it->second->hash == hash) {
+            return it->second;
+        }
+    }
+
+    auto entry = std::make_shared<CachedPatch>(CachedPatch{hash, {}, nullptr});
+    const auto contents = std::make_shared<VectorVfsFile>(std::move(bytes), file->GetName());
+    if (file->GetExtension() == "ips") {
+        if (auto patch = CompileIPS(contents)) {
+            entry->patch = std::make_shared<const CompiledPatch>(std::move(*patch));
+        }
+    } else if (file->GetExtension() == "pchtxt") {
+        const IPSwitchCompiler compiler{contents};
+        if (compiler.IsValid()) {
+            entry->build_id = compiler.GetBuildID();
+            entry->patch = std::make_shared<const CompiledPatch>(compiler.Compile());
+        }
+    }
+
+    std::scoped_lock lk{cache_mutex};
+    cache.insert_or_assign(path, entry);
+    return entry;
+}
 } // Anonymous namespace
 
 PatchManager::PatchManager(u64 title_id_,
@@ -212,11 +258,11 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
+                    const auto compiled = GetCompiledPatch(file);
+                    if (compiled->patch == nullptr)
                         continue;
 
-                    const auto this_build_id = Common::HexToString(compiler.GetBuildID());
+                    const auto this_build_id = Common::HexToString(compiled->build_id);
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 }
@@ -227,16 +273,10 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
     return out;
 }
 
-std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::string& name) const {
-    if (nso.size() < sizeof(Loader::NSOHeader)) {
-        return nso;
-    }
-
-    Loader::NSOHeader header;
-    std::memcpy(&header, nso.data(), sizeof(header));
-
+void PatchManager::PatchNSO(const Loader::NSOHeader& header, std::span<u8> image,
+                            const std::string& name) const {
     if (header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
-        return nso;
+        return;
     }
 
     const auto build_id_raw = Common::HexToString(header.build_id);
@@ -250,8 +290,9 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
             const auto nso_dir = GetOrCreateDirectoryRelative(dump_dir, "/nso");
             const auto file = nso_dir->CreateFile(fmt::format("{}-{}.nso", name, build_id));
 
-            file->Resize(nso.size());
-            file->WriteBytes(nso);
+            file->Resize(sizeof(header) + image.size());
+            file->WriteObject(header);
+            file->WriteBytes(image.data(), image.size(), sizeof(header));
         }
     }
 
@@ -260,7 +301,7 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
     const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
     if (load_dir == nullptr) {
         LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
-        return nso;
+        return;
     }
 
     auto patch_dirs = load_dir->GetSubdirectories();
@@ -268,30 +309,16 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
               [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
     const auto patches = CollectPatches(patch_dirs, build_id);
 
-    auto out = nso;
+    // Patch offsets are relative to the start of the NSO header, which itself is never patched.
     for (const auto& patch_file : patches) {
-        if (patch_file->GetExtension() == "ips") {
-            LOG_INFO(Loader, "    - Applying IPS patch from mod \"{}\"",
-                     patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const auto patched = PatchIPS(std::make_shared<VectorVfsFile>(out), patch_file);
-            if (patched != nullptr)
-                out = patched->ReadAllBytes();
-        } else if (patch_file->GetExtension() == "pchtxt") {
-            LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"",
-                     patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const IPSwitchCompiler compiler{patch_file};
-            const auto patched = compiler.Apply(std::make_shared<VectorVfsFile>(out));
-            if (patched != nullptr)
-                out = patched->ReadAllBytes();
+        LOG_INFO(Loader, "    - Applying {} patch from mod \"{}\"",
+                 patch_file->GetExtension() == "ips" ? "IPS" : "IPSwitch",
+                 patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
+        const auto compiled = GetCompiledPatch(patch_file);
+        if (compiled->patch != nullptr) {
+            ApplyCompiledPatch(image, *compiled->patch, sizeof(header));
         }
     }
-
-    if (out.size() < sizeof(Loader::NSOHeader)) {
-        return nso;
-    }
-
-    std::memcpy(out.data(), &header, sizeof(header));
-    return out;
 }
 
 bool PatchManager::HasNSOPatch(const BuildID& build_id_, std::string_view name) const {
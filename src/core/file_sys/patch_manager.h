@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include "common/common_types.h"
 #include "core/file_sys/nca_metadata.h"
@@ -16,6 +17,10 @@ namespace Core {
 class System;
 }
 
+namespace Loader {
+struct NSOHeader;
+}
+
 namespace Service::FileSystem {
 class FileSystemController;
 }
@@ -57,11 +62,12 @@ public:
     // Currently tracked NSO patches:
     // - IPS
     // - IPSwitch
-    [[nodiscard]] std::vector<u8> PatchNSO(const std::vector<u8>& nso,
-                                           const std::string& name) const;
+    // Patches are applied in place to the module image that follows the NSO header.
+    void PatchNSO(const Loader::NSOHeader& header, std::span<u8> image,
+                  const std::string& name) const;
 
     // Checks to see if PatchNSO() will have any effect given the NSO's build ID.
-    // Used to prevent expensive copies in NSO loader.
+    // Used to skip the patching pass in the NSO loader.
     [[nodiscard]] bool HasNSOPatch(const BuildID& build_id, std::string_view name) const;
 
     // Creates a CheatList object with all
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <random>
 #include <regex>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -18,6 +21,7 @@
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -25,6 +29,24 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+constexpr u32 MANIFEST_MAGIC = 0x4D435259; // "YRCM"
+constexpr u32 MANIFEST_VERSION = 1;
+
+struct ManifestHeader {
+    u32 magic;
+    u32 version;
+    u64 num_entries;
+};
+static_assert(std::is_trivially_copyable_v<ManifestHeader>);
+
+struct ManifestEntryHeader {
+    NcaID nca_id;
+    u64 size;
+    u64 title_id;
+    u64 cnmt_size;
+};
+static_assert(std::is_trivially_copyable_v<ManifestEntryHeader>);
+
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -71,6 +93,22 @@ static std::string GetRelativePathFromNcaID(const std::array<u8, 16>& nca_id, bo
     return fmt::format(format_str, hash[0], Common::HexToString(nca_id, second_hex_upper));
 }
 
+static std::filesystem::path GetManifestPath(const VirtualDir& dir) {
+    const auto full_path = dir->GetFullPath();
+    if (full_path.empty()) {
+        return {};
+    }
+
+    Core::Crypto::SHA256Hash hash{};
+    mbedtls_sha256_ret(reinterpret_cast<const u8*>(full_path.data()), full_path.size(),
+                       hash.data(), 0);
+
+    u64 name{};
+    std::memcpy(&name, hash.data(), sizeof(name));
+    return Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "registered_cache" /
+           fmt::format("{:016X}.bin", name);
+}
+
 static std::string GetCNMTName(TitleType type, u64 title_id) {
     static constexpr std::array<const char*, 9> TITLE_TYPE_NAMES{
         "SystemProgram",
@@ -413,14 +451,41 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
 }
 
 void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
+    std::map<NcaID, ManifestEntry> new_manifest;
+    bool manifest_changed = false;
+
     for (const auto& id : ids) {
         const auto file = GetFileAtID(id);
 
-        if (file == nullptr)
+        if (file == nullptr || !present_ids.insert(id).second)
+            continue;
+
+        // NcaIDs are derived from the contents, so an NCA of the same ID and size is unchanged.
+        const auto size = file->GetSize();
+        const auto cached = manifest.find(id);
+        if (cached != manifest.end() && cached->second.size == size) {
+            if (!cached->second.cnmt.empty()) {
+                meta.insert_or_assign(
+                    cached->second.title_id,
+                    CNMT(std::make_shared<VectorVfsFile>(cached->second.cnmt)));
+                meta_id.insert_or_assign(cached->second.title_id, id);
+            }
+            new_manifest.insert_or_assign(id, std::move(cached->second));
             continue;
+        }
+
         const auto nca = std::make_shared<NCA>(parser(file, id));
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
+        if (nca->GetStatus() != Loader::ResultStatus::Success) {
+            // Parsing may succeed later on, e.g. once the keys are available.
+            continue;
+        }
+
+        manifest_changed = true;
+        auto& entry = new_manifest[id];
+        entry.size = size;
+        entry.title_id = nca->GetTitleId();
+
+        if (nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
             continue;
         }
 
@@ -430,11 +495,99 @@ void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
             if (section0_file->GetExtension() != "cnmt")
                 continue;
 
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
+            CNMT cnmt(section0_file);
+            entry.cnmt = cnmt.Serialize();
+            meta.insert_or_assign(nca->GetTitleId(), std::move(cnmt));
             meta_id.insert_or_assign(nca->GetTitleId(), id);
             break;
         }
     }
+
+    // Entries of NCAs that are gone are dropped as well.
+    manifest_changed |= new_manifest.size() != manifest.size();
+    manifest = std::move(new_manifest);
+    if (manifest_changed) {
+        SaveManifest();
+    }
+}
+
+void RegisteredCache::LoadManifest() {
+    manifest_loaded = true;
+
+    const auto path = GetManifestPath(dir);
+    if (path.empty()) {
+        return;
+    }
+
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    ManifestHeader header{};
+    if (!file.ReadObject(header) || header.magic != MANIFEST_MAGIC ||
+        header.version != MANIFEST_VERSION) {
+        return;
+    }
+
+    for (u64 i = 0; i < header.num_entries; ++i) {
+        ManifestEntryHeader entry_header{};
+        if (!file.ReadObject(entry_header)) {
+            manifest.clear();
+            return;
+        }
+
+        std::vector<u8> cnmt(entry_header.cnmt_size);
+        if (file.ReadSpan<u8>(cnmt) != cnmt.size()) {
+            manifest.clear();
+            return;
+        }
+
+        manifest.insert_or_assign(entry_header.nca_id, ManifestEntry{
+                                                           .size = entry_header.size,
+                                                           .title_id = entry_header.title_id,
+                                                           .cnmt = std::move(cnmt),
+                                                       });
+    }
+}
+
+void RegisteredCache::SaveManifest() const {
+    const auto path = GetManifestPath(dir);
+    if (path.empty() || !Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    const ManifestHeader header{
+        .magic = MANIFEST_MAGIC,
+        .version = MANIFEST_VERSION,
+        .num_entries = manifest.size(),
+    };
+    bool success = file.WriteObject(header);
+
+    for (const auto& [id, entry] : manifest) {
+        const ManifestEntryHeader entry_header{
+            .nca_id = id,
+            .size = entry.size,
+            .title_id = entry.title_id,
+            .cnmt_size = entry.cnmt.size(),
+        };
+        success = success && file.WriteObject(entry_header) &&
+                  file.WriteSpan<u8>(entry.cnmt) == entry.cnmt.size();
+    }
+
+    if (!success) {
+        LOG_WARNING(Loader, "Failed to write the content manifest to {}",
+                    Common::FS::PathToUTF8String(path));
+        file.Close();
+        Common::FS::RemoveFile(path);
+    }
 }
 
 void RegisteredCache::AccumulateYuzuMeta() {
@@ -458,6 +611,15 @@ void RegisteredCache::Refresh() {
         return;
     }
 
+    if (!manifest_loaded) {
+        LoadManifest();
+    }
+
+    meta_id.clear();
+    meta.clear();
+    yuzu_meta.clear();
+    present_ids.clear();
+
     const auto ids = AccumulateFiles();
     ProcessFiles(ids);
     AccumulateYuzuMeta();
@@ -508,25 +670,35 @@ std::unique_ptr<NCA> RegisteredCache::GetEntry(u64 title_id, ContentRecordType t
 template <typename T>
 void RegisteredCache::IterateAllMetadata(
     std::vector<T>& out, std::function<T(const CNMT&, const ContentRecord&)> proc,
-    std::function<bool(const CNMT&, const ContentRecord&)> filter) const {
-    for (const auto& kv : meta) {
-        const auto& cnmt = kv.second;
+    std::function<bool(const CNMT&, const ContentRecord&)> filter,
+    std::optional<u64> title_id) const {
+    // Both maps are keyed by title ID, so only the matching entries need to be visited.
+    const auto for_each_cnmt = [&title_id](const std::map<u64, CNMT>& map, auto&& func) {
+        if (!title_id) {
+            for (const auto& kv : map) {
+                func(kv.second);
+            }
+        } else if (const auto iter = map.find(*title_id); iter != map.end()) {
+            func(iter->second);
+        }
+    };
+
+    for_each_cnmt(meta, [&](const CNMT& cnmt) {
         if (filter(cnmt, EMPTY_META_CONTENT_RECORD))
             out.push_back(proc(cnmt, EMPTY_META_CONTENT_RECORD));
         for (const auto& rec : cnmt.GetContentRecords()) {
-            if (GetFileAtID(rec.nca_id) != nullptr && filter(cnmt, rec)) {
+            if (present_ids.contains(rec.nca_id) && filter(cnmt, rec)) {
                 out.push_back(proc(cnmt, rec));
             }
         }
-    }
-    for (const auto& kv : yuzu_meta) {
-        const auto& cnmt = kv.second;
+    });
+    for_each_cnmt(yuzu_meta, [&](const CNMT& cnmt) {
         for (const auto& rec : cnmt.GetContentRecords()) {
-            if (GetFileAtID(rec.nca_id) != nullptr && filter(cnmt, rec)) {
+            if (present_ids.contains(rec.nca_id) && filter(cnmt, rec)) {
                 out.push_back(proc(cnmt, rec));
             }
         }
-    }
+    });
 }
 
 std::vector<ContentProviderEntry> RegisteredCache::ListEntriesFilter(
@@ -546,7 +718,8 @@ std::vector<ContentProviderEntry> RegisteredCache::ListEntriesFilter(
             if (title_id && *title_id != c.GetTitleID())
                 return false;
             return true;
-        });
+        },
+        title_id);
     return out;
 }
 
@@ -671,7 +844,9 @@ InstallResult RegisteredCache::InstallEntry(const NCA& nca, TitleType type,
     if (!RawInstallYuzuMeta(new_cnmt)) {
         return InstallResult::ErrorMetaFailed;
     }
-    return RawInstallNCA(nca, copy, overwrite_if_exists, c_rec.nca_id);
+    const auto result = RawInstallNCA(nca, copy, overwrite_if_exists, c_rec.nca_id);
+    Refresh();
+    return result;
 }
 
 InstallResult RegisteredCache::InstallEntry(const NCA& nca, const CNMTHeader& base_header,
@@ -696,10 +871,12 @@ InstallResult RegisteredCache::InstallEntry(const NCA& nca, const CNMTHeader& ba
     if (!RawInstallYuzuMeta(new_cnmt)) {
         return InstallResult::ErrorMetaFailed;
     }
-    return RawInstallNCA(nca, copy, overwrite_if_exists, base_record.nca_id);
+    const auto result = RawInstallNCA(nca, copy, overwrite_if_exists, base_record.nca_id);
+    Refresh();
+    return result;
 }
 
-bool RegisteredCache::RemoveExistingEntry(u64 title_id) const {
+bool RegisteredCache::RemoveExistingEntry(u64 title_id) {
     bool removed_data = false;
 
     const auto delete_nca = [this](const NcaID& id) {
@@ -758,6 +935,10 @@ bool RegisteredCache::RemoveExistingEntry(u64 title_id) const {
         }
     }
 
+    if (removed_data) {
+        Refresh();
+    }
+
     return removed_data;
 }
 
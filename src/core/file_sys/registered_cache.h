@@ -5,7 +5,10 @@
 
 #include <array>
 #include <functional>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <vector>
 #include <boost/container/flat_map.hpp>
@@ -175,16 +178,27 @@ public:
                                const VfsCopyFunction& copy = &VfsRawCopy);
 
     // Removes an existing entry based on title id
-    bool RemoveExistingEntry(u64 title_id) const;
+    bool RemoveExistingEntry(u64 title_id);
 
 private:
+    // What ProcessFiles found in an NCA, remembered across runs so that unchanged NCAs don't
+    // have to be opened again.
+    struct ManifestEntry {
+        u64 size;
+        u64 title_id;
+        std::vector<u8> cnmt; ///< Serialized CNMT, empty if the NCA is not a meta NCA.
+    };
+
     template <typename T>
     void IterateAllMetadata(std::vector<T>& out,
                             std::function<T(const CNMT&, const ContentRecord&)> proc,
-                            std::function<bool(const CNMT&, const ContentRecord&)> filter) const;
+                            std::function<bool(const CNMT&, const ContentRecord&)> filter,
+                            std::optional<u64> title_id = {}) const;
     std::vector<NcaID> AccumulateFiles() const;
     void ProcessFiles(const std::vector<NcaID>& ids);
     void AccumulateYuzuMeta();
+    void LoadManifest();
+    void SaveManifest() const;
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& open_dir, std::string_view path) const;
@@ -201,6 +215,11 @@ private:
     std::map<u64, CNMT> meta;
     // maps tid -> meta for CNMT in yuzu_meta
     std::map<u64, CNMT> yuzu_meta;
+    // NcaIDs of all NCAs found by the last refresh
+    std::set<NcaID> present_ids;
+    // maps NcaID -> cached metadata of that NCA
+    std::map<NcaID, ManifestEntry> manifest;
+    bool manifest_loaded = false;
 };
 
 enum class ContentProviderUnionSlot {
@@ -149,7 +149,8 @@ VirtualDir ExtractRomFS(VirtualFile file) {
     ProcessDirectory(ctx, 0, root_container);
 
     if (auto root = root_container->GetSubdirectory(""); root) {
-        return root;
+        // Titles and services look up many files by path, so serve those from an index.
+        return std::make_shared<CachedVfsDirectory>(std::move(root));
     }
 
     ASSERT(false);
@@ -4,7 +4,11 @@
 #include <algorithm>
 #include <numeric>
 #include <string>
+#include "common/bounded_threadsafe_queue.h"
+#include "common/div_ceil.h"
 #include "common/fs/path_util.h"
+#include "common/polyfill_thread.h"
+#include "common/thread.h"
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
@@ -523,6 +527,59 @@ bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t blo
     return true;
 }
 
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size,
+                      const std::function<bool(std::size_t)>& callback) {
+    if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
+        return false;
+
+    const auto size = src->GetSize();
+    if (!dest->Resize(size))
+        return false;
+
+    struct Block {
+        std::vector<u8> data;
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    // The blocks cycle between the reader and the writer, bounding the data in flight.
+    constexpr std::size_t NumBlocks = 8;
+    Common::SPSCQueue<Block, NumBlocks> free_blocks;
+    Common::SPSCQueue<Block, NumBlocks> read_blocks;
+    for (std::size_t i = 0; i < std::min(NumBlocks, Common::DivCeil(size, block_size)); ++i) {
+        free_blocks.EmplaceWait(Block{std::vector<u8>(block_size), 0, 0});
+    }
+
+    std::jthread reader{[&](std::stop_token stop_token) {
+        Common::SetCurrentThreadName("VfsCopy");
+        for (std::size_t offset = 0; offset < size; offset += block_size) {
+            Block block{};
+            free_blocks.PopWait(block, stop_token);
+            if (stop_token.stop_requested()) {
+                return;
+            }
+
+            const auto length = std::min(block_size, size - offset);
+            block.offset = offset;
+            block.length = src->Read(block.data.data(), length, offset);
+            read_blocks.EmplaceWait(std::move(block));
+        }
+    }};
+
+    for (std::size_t offset = 0; offset < size; offset += block_size) {
+        Block block = read_blocks.PopWait();
+        const auto length = std::min(block_size, size - offset);
+        if (block.length != length || (callback && callback(offset)) ||
+            dest->Write(block.data.data(), length, offset) != length) {
+            reader.request_stop();
+            return false;
+        }
+        free_blocks.EmplaceWait(std::move(block));
+    }
+
+    return true;
+}
+
 bool VfsRawCopyD(const VirtualDir& src, const VirtualDir& dest, std::size_t block_size) {
     if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
         return false;
@@ -314,6 +314,13 @@ bool DeepEquals(const VirtualFile& file1, const VirtualFile& file2,
 // directory of src/dest.
 bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size = 0x1000);
 
+// Performs the same copy as VfsRawCopy, but reads ahead on another thread so that reading src
+// overlaps with writing dest. Meant for large files, e.g. when installing content. The callback
+// is invoked with the offset of each block before it is written, and cancels the copy by returning
+// true.
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size,
+                      const std::function<bool(std::size_t)>& callback = {});
+
 // A method that performs a similar function to VfsRawCopy above, but instead copies entire
 // directories. It suffers the same performance penalties as above and an implementation-specific
 // Copy should always be preferred.
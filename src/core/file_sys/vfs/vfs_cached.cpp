@@ -1,23 +1,71 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/fs/path_util.h"
 #include "core/file_sys/vfs/vfs_cached.h"
 #include "core/file_sys/vfs/vfs_types.h"
 
 namespace FileSys {
 
 CachedVfsDirectory::CachedVfsDirectory(VirtualDir&& source_dir)
-    : name(source_dir->GetName()), parent(source_dir->GetParentDirectory()) {
+    : CachedVfsDirectory(std::move(source_dir), std::make_shared<PathIndex>(), "") {}
+
+CachedVfsDirectory::CachedVfsDirectory(VirtualDir&& source_dir, std::shared_ptr<PathIndex> index_,
+                                       std::string path_)
+    : name(source_dir->GetName()), parent(source_dir->GetParentDirectory()),
+      index(std::move(index_)), path(std::move(path_)) {
     for (auto& dir : source_dir->GetSubdirectories()) {
-        dirs.emplace(dir->GetName(), std::make_shared<CachedVfsDirectory>(std::move(dir)));
+        auto dir_name = dir->GetName();
+        if (dirs.contains(dir_name)) {
+            continue;
+        }
+
+        auto dir_path = path + dir_name;
+        auto cached = std::shared_ptr<CachedVfsDirectory>(
+            new CachedVfsDirectory(std::move(dir), index, dir_path + '/'));
+        dirs.emplace(std::move(dir_name), cached);
+        index->dirs.emplace(std::move(dir_path), cached);
+        dir_list.push_back(std::move(cached));
     }
     for (auto& file : source_dir->GetFiles()) {
-        files.emplace(file->GetName(), std::move(file));
+        if (files.emplace(file->GetName(), file).second) {
+            index->files.emplace(path + file->GetName(), file);
+            file_list.push_back(std::move(file));
+        }
     }
 }
 
 CachedVfsDirectory::~CachedVfsDirectory() = default;
 
+std::string CachedVfsDirectory::GetIndexKey(std::string_view relative_path) const {
+    std::string key = path;
+    for (const auto component : Common::FS::SplitPathComponents(relative_path)) {
+        if (key.size() != path.size()) {
+            key += '/';
+        }
+        key += component;
+    }
+    return key;
+}
+
+VirtualFile CachedVfsDirectory::GetFileRelative(std::string_view relative_path) const {
+    const auto it = index->files.find(GetIndexKey(relative_path));
+    if (it != index->files.end()) {
+        return it->second;
+    }
+
+    return nullptr;
+}
+
+VirtualDir CachedVfsDirectory::GetDirectoryRelative(std::string_view relative_path) const {
+    const auto it = index->dirs.find(GetIndexKey(relative_path));
+    if (it != index->dirs.end()) {
+        return it->second.lock();
+    }
+
+    return nullptr;
+}
+
 VirtualFile CachedVfsDirectory::GetFile(std::string_view file_name) const {
     auto it = files.find(file_name);
     if (it != files.end()) {
@@ -37,19 +85,11 @@ VirtualDir CachedVfsDirectory::GetSubdirectory(std::string_view dir_name) const
 }
 
 std::vector<VirtualFile> CachedVfsDirectory::GetFiles() const {
-    std::vector<VirtualFile> out;
-    for (auto& [file_name, file] : files) {
-        out.push_back(file);
-    }
-    return out;
+    return file_list;
 }
 
 std::vector<VirtualDir> CachedVfsDirectory::GetSubdirectories() const {
-    std::vector<VirtualDir> out;
-    for (auto& [dir_name, dir] : dirs) {
-        out.push_back(dir);
-    }
-    return out;
+    return dir_list;
 }
 
 std::string CachedVfsDirectory::GetName() const {
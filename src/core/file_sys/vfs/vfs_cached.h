@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "core/file_sys/vfs/vfs.h"
 
@@ -14,6 +18,8 @@ public:
     CachedVfsDirectory(VirtualDir&& source_directory);
 
     ~CachedVfsDirectory() override;
+    VirtualFile GetFileRelative(std::string_view path) const override;
+    VirtualDir GetDirectoryRelative(std::string_view path) const override;
     VirtualFile GetFile(std::string_view file_name) const override;
     VirtualDir GetSubdirectory(std::string_view dir_name) const override;
     std::vector<VirtualFile> GetFiles() const override;
@@ -22,8 +28,26 @@ public:
     VirtualDir GetParentDirectory() const override;
 
 private:
+    // Files and directories of the whole tree, keyed by their path relative to the root of the
+    // tree, so that relative lookups don't have to walk the tree component by component.
+    // Directories are owned by their parents, which also share the index.
+    struct PathIndex {
+        std::unordered_map<std::string, VirtualFile> files;
+        std::unordered_map<std::string, std::weak_ptr<VfsDirectory>> dirs;
+    };
+
+    CachedVfsDirectory(VirtualDir&& source_directory, std::shared_ptr<PathIndex> index,
+                       std::string path);
+
+    std::string GetIndexKey(std::string_view relative_path) const;
+
     std::string name;
     VirtualDir parent;
+    std::shared_ptr<PathIndex> index;
+    // Path of this directory relative to the root of the tree, with a trailing separator.
+    std::string path;
+    std::vector<VirtualDir> dir_list;
+    std::vector<VirtualFile> file_list;
     std::map<std::string, VirtualDir, std::less<>> dirs;
     std::map<std::string, VirtualFile, std::less<>> files;
 };
@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
-#include <set>
-#include <unordered_set>
 #include <utility>
 #include "core/file_sys/vfs/vfs_layered.h"
 
@@ -24,34 +22,47 @@ VirtualDir LayeredVfsDirectory::MakeLayeredDirectory(std::vector<VirtualDir> dir
     return VirtualDir(new LayeredVfsDirectory(std::move(dirs), std::move(name)));
 }
 
-VirtualFile LayeredVfsDirectory::GetFileRelative(std::string_view path) const {
-    for (const auto& layer : dirs) {
-        const auto file = layer->GetFileRelative(path);
-        if (file != nullptr)
-            return file;
-    }
+void LayeredVfsDirectory::BuildIndex() const {
+    std::call_once(index_flag, [this] {
+        // Earlier layers take precedence over later ones, directories are merged across all.
+        std::vector<std::string> subdir_names;
+        std::map<std::string, std::vector<VirtualDir>, std::less<>> subdir_layers;
 
-    return nullptr;
-}
+        for (const auto& layer : dirs) {
+            for (auto& file : layer->GetFiles()) {
+                if (files_by_name.try_emplace(file->GetName(), file).second) {
+                    files.emplace_back(std::move(file));
+                }
+            }
 
-VirtualDir LayeredVfsDirectory::GetDirectoryRelative(std::string_view path) const {
-    std::vector<VirtualDir> out;
-    for (const auto& layer : dirs) {
-        auto dir = layer->GetDirectoryRelative(path);
-        if (dir != nullptr) {
-            out.emplace_back(std::move(dir));
+            for (auto& subdir : layer->GetSubdirectories()) {
+                const auto [it, is_new] = subdir_layers.try_emplace(subdir->GetName());
+                if (is_new) {
+                    subdir_names.push_back(it->first);
+                }
+                it->second.emplace_back(std::move(subdir));
+            }
         }
-    }
 
-    return MakeLayeredDirectory(std::move(out));
+        subdirs.reserve(subdir_names.size());
+        for (auto& subdir_name : subdir_names) {
+            auto subdir = MakeLayeredDirectory(std::move(subdir_layers[subdir_name]));
+            subdirs.push_back(subdir);
+            subdirs_by_name.emplace(std::move(subdir_name), std::move(subdir));
+        }
+    });
 }
 
 VirtualFile LayeredVfsDirectory::GetFile(std::string_view file_name) const {
-    return GetFileRelative(file_name);
+    BuildIndex();
+    const auto it = files_by_name.find(file_name);
+    return it != files_by_name.end() ? it->second : nullptr;
 }
 
 VirtualDir LayeredVfsDirectory::GetSubdirectory(std::string_view subdir_name) const {
-    return GetDirectoryRelative(subdir_name);
+    BuildIndex();
+    const auto it = subdirs_by_name.find(subdir_name);
+    return it != subdirs_by_name.end() ? it->second : nullptr;
 }
 
 std::string LayeredVfsDirectory::GetFullPath() const {
@@ -59,37 +70,13 @@ std::string LayeredVfsDirectory::GetFullPath() const {
 }
 
 std::vector<VirtualFile> LayeredVfsDirectory::GetFiles() const {
-    std::vector<VirtualFile> out;
-    std::unordered_set<std::string> out_names;
-
-    for (const auto& layer : dirs) {
-        for (auto& file : layer->GetFiles()) {
-            const auto [it, is_new] = out_names.emplace(file->GetName());
-            if (is_new) {
-                out.emplace_back(std::move(file));
-            }
-        }
-    }
-
-    return out;
+    BuildIndex();
+    return files;
 }
 
 std::vector<VirtualDir> LayeredVfsDirectory::GetSubdirectories() const {
-    std::vector<VirtualDir> out;
-    std::unordered_set<std::string> out_names;
-
-    for (const auto& layer : dirs) {
-        for (const auto& sd : layer->GetSubdirectories()) {
-            out_names.emplace(sd->GetName());
-        }
-    }
-
-    out.reserve(out_names.size());
-    for (const auto& subdir : out_names) {
-        out.emplace_back(GetSubdirectory(subdir));
-    }
-
-    return out;
+    BuildIndex();
+    return subdirs;
 }
 
 bool LayeredVfsDirectory::IsWritable() const {
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
@@ -20,8 +22,6 @@ public:
     /// Wrapper function to allow for more efficient handling of dirs.size() == 0, 1 cases.
     static VirtualDir MakeLayeredDirectory(std::vector<VirtualDir> dirs, std::string name = "");
 
-    VirtualFile GetFileRelative(std::string_view path) const override;
-    VirtualDir GetDirectoryRelative(std::string_view path) const override;
     VirtualFile GetFile(std::string_view file_name) const override;
     VirtualDir GetSubdirectory(std::string_view subdir_name) const override;
     std::string GetFullPath() const override;
@@ -39,8 +39,18 @@ public:
     bool Rename(std::string_view new_name) override;
 
 private:
+    void BuildIndex() const;
+
     std::vector<VirtualDir> dirs;
     std::string name;
+
+    // Merged view of the direct children of all layers, built on first access so that lookups
+    // don't have to visit every layer.
+    mutable std::once_flag index_flag;
+    mutable std::vector<VirtualFile> files;
+    mutable std::vector<VirtualDir> subdirs;
+    mutable std::map<std::string, VirtualFile, std::less<>> files_by_name;
+    mutable std::map<std::string, VirtualDir, std::less<>> subdirs_by_name;
 };
 
 } // namespace FileSys
@@ -3,12 +3,14 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
 #include "core/file_sys/vfs/vfs.h"
 #include "core/file_sys/vfs/vfs_real.h"
@@ -27,10 +29,12 @@
 namespace FileSys {
 
 namespace FS = Common::FS;
+using namespace Common::Literals;
 
 namespace {
 
 constexpr size_t MaxOpenFiles = 512;
+constexpr u64 MinimumMappedFileSize = 16_MiB;
 
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(OpenMode mode) {
     switch (mode) {
@@ -90,6 +94,19 @@ VirtualFile RealVfsFilesystem::OpenFileFromEntry(std::string_view path_, std::op
         return nullptr;
     }
 
+    // Large read-only files (game images) are mapped in their entirety so that reads are served
+    // with a copy instead of a seek and read syscall pair. Fall back to buffered IO if the file
+    // cannot be mapped (e.g. the backing storage does not support it).
+    if (perms == OpenMode::Read &&
+        (size ? *size : FS::GetSize(path)) >= MinimumMappedFileSize) {
+        if (FS::MappedFile mapping{path}; mapping.IsOpen()) {
+            auto file = std::shared_ptr<RealVfsMappedFile>(
+                new RealVfsMappedFile(*this, std::move(mapping), path));
+            cache[path] = file;
+            return file;
+        }
+    }
+
     auto reference = std::make_unique<FileReference>();
     this->InsertReferenceIntoListLocked(*reference);
 
@@ -333,6 +350,60 @@ bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
 }
 
+RealVfsMappedFile::RealVfsMappedFile(RealVfsFilesystem& base_, FS::MappedFile&& mapping_,
+                                     const std::string& path_)
+    : base(base_), mapping(std::move(mapping_)), path(path_),
+      parent_path(FS::GetParentPath(path_)), path_components(FS::SplitPathComponentsCopy(path_)) {}
+
+RealVfsMappedFile::~RealVfsMappedFile() = default;
+
+std::string RealVfsMappedFile::GetName() const {
+#ifdef ANDROID
+    if (path[0] != '/') {
+        return FS::Android::GetFilename(path);
+    }
+#endif
+    return path_components.empty() ? "" : std::string(path_components.back());
+}
+
+std::size_t RealVfsMappedFile::GetSize() const {
+    return mapping.Size();
+}
+
+bool RealVfsMappedFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+VirtualDir RealVfsMappedFile::GetContainingDirectory() const {
+    return base.OpenDirectory(parent_path, OpenMode::Read);
+}
+
+bool RealVfsMappedFile::IsWritable() const {
+    return false;
+}
+
+bool RealVfsMappedFile::IsReadable() const {
+    return true;
+}
+
+std::size_t RealVfsMappedFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const auto contents = mapping.Data();
+    if (offset >= contents.size()) {
+        return 0;
+    }
+    const auto read_size = std::min(length, contents.size() - offset);
+    std::memcpy(data, contents.data() + offset, read_size);
+    return read_size;
+}
+
+std::size_t RealVfsMappedFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool RealVfsMappedFile::Rename(std::string_view name) {
+    return false;
+}
+
 // TODO(DarkLordZach): MSVC would not let me combine the following two functions using 'if
 // constexpr' because there is a compile error in the branch not used.
 
@@ -3,9 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <bit>
-#include <functional>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -14,16 +14,57 @@
 
 namespace Core {
 
+/**
+ * Collects the memory written by a single CPU core that is cached by the GPU.
+ *
+ * Writes to the same page are coalesced into a bitmap of 64 byte blocks. Once a write hits a
+ * different page, the previous bitmap is appended to a lock-free single producer, single consumer
+ * log that the GPU drains in bulk. Only the owning core may call Collect.
+ */
 class GPUDirtyMemoryManager {
 public:
     GPUDirtyMemoryManager() : current{default_transform} {
-        back_buffer.reserve(256);
-        front_buffer.reserve(256);
+        overflow_buffer.reserve(256);
     }
 
     ~GPUDirtyMemoryManager() = default;
 
     void Collect(PAddr address, size_t size) {
+        // A transform covers a single tracking page, split larger writes
+        while ((address & page_mask) + size > page_size) [[unlikely]] {
+            const size_t first_size = page_size - (address & page_mask);
+            CollectPage(address, first_size);
+            address += first_size;
+            size -= first_size;
+        }
+        CollectPage(address, size);
+    }
+
+    /// Appends all the ranges written since the last call, ranges are not sorted nor merged.
+    void Gather(std::vector<std::pair<PAddr, size_t>>& ranges) {
+        std::scoped_lock lk(gather_guard);
+        const TransformAddress t = current.exchange(default_transform, std::memory_order_acq_rel);
+        const size_t head = log_head.load(std::memory_order_acquire);
+        size_t tail = log_tail.load(std::memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            Expand(log[tail % log_size], ranges);
+        }
+        log_tail.store(tail, std::memory_order_release);
+        if (IsValid(t.address)) {
+            Expand(t, ranges);
+        }
+        if (has_overflow.load(std::memory_order_acquire)) {
+            std::scoped_lock overflow_lk(overflow_guard);
+            for (const TransformAddress& transform : overflow_buffer) {
+                Expand(transform, ranges);
+            }
+            overflow_buffer.clear();
+            has_overflow.store(false, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    void CollectPage(PAddr address, size_t size) {
         TransformAddress t = BuildTransform(address, size);
         TransformAddress tmp, original;
         do {
@@ -31,9 +72,13 @@ public:
             original = tmp;
             if (tmp.address != t.address) {
                 if (IsValid(tmp.address)) {
-                    std::scoped_lock lk(guard);
-                    back_buffer.emplace_back(tmp);
-                    current.exchange(t, std::memory_order_relaxed);
+                    // Whoever takes the transform out of current is responsible for logging it,
+                    // this might race with Gather taking it first.
+                    const TransformAddress previous =
+                        current.exchange(t, std::memory_order_acq_rel);
+                    if (IsValid(previous.address)) {
+                        Append(previous);
+                    }
                     return;
                 }
                 tmp.address = t.address;
@@ -47,34 +92,6 @@ public:
                                                 std::memory_order_relaxed));
     }
 
-    void Gather(std::function<void(PAddr, size_t)>& callback) {
-        {
-            std::scoped_lock lk(guard);
-            TransformAddress t = current.exchange(default_transform, std::memory_order_relaxed);
-            front_buffer.swap(back_buffer);
-            if (IsValid(t.address)) {
-                front_buffer.emplace_back(t);
-            }
-        }
-        for (auto& transform : front_buffer) {
-            size_t offset = 0;
-            u64 mask = transform.mask;
-            while (mask != 0) {
-                const size_t empty_bits = std::countr_zero(mask);
-                offset += empty_bits << align_bits;
-                mask = mask >> empty_bits;
-
-                const size_t continuous_bits = std::countr_one(mask);
-                callback((static_cast<PAddr>(transform.address) << page_bits) + offset,
-                         continuous_bits << align_bits);
-                mask = continuous_bits < align_size ? (mask >> continuous_bits) : 0;
-                offset += continuous_bits << align_bits;
-            }
-        }
-        front_buffer.clear();
-    }
-
-private:
     struct alignas(8) TransformAddress {
         u32 address;
         u32 mask;
@@ -89,6 +106,8 @@ private:
     constexpr static size_t align_mask = align_size - 1;
     constexpr static TransformAddress default_transform = {.address = ~0U, .mask = 0U};
 
+    constexpr static size_t log_size = 4096;
+
     bool IsValid(PAddr address) {
         return address < (1ULL << 39);
     }
@@ -113,10 +132,46 @@ private:
         return result;
     }
 
+    void Append(TransformAddress transform) {
+        const size_t head = log_head.load(std::memory_order_relaxed);
+        const size_t tail = log_tail.load(std::memory_order_acquire);
+        if (head - tail < log_size) [[likely]] {
+            log[head % log_size] = transform;
+            log_head.store(head + 1, std::memory_order_release);
+            return;
+        }
+        // The GPU hasn't drained the log in a while, spill to a locked buffer
+        std::scoped_lock lk(overflow_guard);
+        overflow_buffer.push_back(transform);
+        has_overflow.store(true, std::memory_order_release);
+    }
+
+    void Expand(TransformAddress transform, std::vector<std::pair<PAddr, size_t>>& ranges) {
+        size_t offset = 0;
+        u64 mask = transform.mask;
+        while (mask != 0) {
+            const size_t empty_bits = std::countr_zero(mask);
+            offset += empty_bits << align_bits;
+            mask = mask >> empty_bits;
+
+            const size_t continuous_bits = std::countr_one(mask);
+            ranges.emplace_back((static_cast<PAddr>(transform.address) << page_bits) + offset,
+                                continuous_bits << align_bits);
+            mask = continuous_bits < align_size ? (mask >> continuous_bits) : 0;
+            offset += continuous_bits << align_bits;
+        }
+    }
+
     std::atomic<TransformAddress> current{};
-    std::mutex guard;
-    std::vector<TransformAddress> back_buffer;
-    std::vector<TransformAddress> front_buffer;
+
+    std::array<TransformAddress, log_size> log{};
+    std::atomic<size_t> log_head{};
+    std::atomic<size_t> log_tail{};
+
+    std::mutex gather_guard;
+    std::mutex overflow_guard;
+    std::atomic<bool> has_overflow{};
+    std::vector<TransformAddress> overflow_buffer;
 };
 
 } // namespace Core
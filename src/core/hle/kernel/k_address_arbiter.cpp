@@ -134,9 +134,10 @@ Result KAddressArbiter::Signal(uint64_t addr, s32 count) {
     s32 num_waiters{};
     {
         KScopedSchedulerLock sl(m_kernel);
+        ThreadTree& tree = m_trees.Get(addr);
 
-        auto it = m_tree.nfind_key({addr, -1});
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        auto it = tree.nfind_key({addr, -1});
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -145,7 +146,7 @@ Result KAddressArbiter::Signal(uint64_t addr, s32 count) {
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -157,6 +158,7 @@ Result KAddressArbiter::SignalAndIncrementIfEqual(uint64_t addr, s32 value, s32
     s32 num_waiters{};
     {
         KScopedSchedulerLock sl(m_kernel);
+        ThreadTree& tree = m_trees.Get(addr);
 
         // Check the userspace value.
         s32 user_value{};
@@ -164,8 +166,8 @@ Result KAddressArbiter::SignalAndIncrementIfEqual(uint64_t addr, s32 value, s32
                  ResultInvalidCurrentMemory);
         R_UNLESS(user_value == value, ResultInvalidState);
 
-        auto it = m_tree.nfind_key({addr, -1});
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        auto it = tree.nfind_key({addr, -1});
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -174,7 +176,7 @@ Result KAddressArbiter::SignalAndIncrementIfEqual(uint64_t addr, s32 value, s32
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -186,21 +188,22 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
     s32 num_waiters{};
     {
         KScopedSchedulerLock sl(m_kernel);
+        ThreadTree& tree = m_trees.Get(addr);
 
-        auto it = m_tree.nfind_key({addr, -1});
+        auto it = tree.nfind_key({addr, -1});
         // Determine the updated value.
         s32 new_value{};
         if (count <= 0) {
-            if (it != m_tree.end() && it->GetAddressArbiterKey() == addr) {
+            if (it != tree.end() && it->GetAddressArbiterKey() == addr) {
                 new_value = value - 2;
             } else {
                 new_value = value + 1;
             }
         } else {
-            if (it != m_tree.end() && it->GetAddressArbiterKey() == addr) {
+            if (it != tree.end() && it->GetAddressArbiterKey() == addr) {
                 auto tmp_it = it;
                 s32 tmp_num_waiters{};
-                while (++tmp_it != m_tree.end() && tmp_it->GetAddressArbiterKey() == addr) {
+                while (++tmp_it != tree.end() && tmp_it->GetAddressArbiterKey() == addr) {
                     if (tmp_num_waiters++ >= count) {
                         break;
                     }
@@ -228,7 +231,7 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
         R_UNLESS(succeeded, ResultInvalidCurrentMemory);
         R_UNLESS(user_value == value, ResultInvalidState);
 
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -237,7 +240,7 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -248,7 +251,8 @@ Result KAddressArbiter::WaitIfLessThan(uint64_t addr, s32 value, bool decrement,
     // Prepare to wait.
     KThread* cur_thread = GetCurrentThreadPointer(m_kernel);
     KHardwareTimer* timer{};
-    ThreadQueueImplForKAddressArbiter wait_queue(m_kernel, std::addressof(m_tree));
+    ThreadTree& tree = m_trees.Get(addr);
+    ThreadQueueImplForKAddressArbiter wait_queue(m_kernel, std::addressof(tree));
 
     {
         KScopedSchedulerLockAndSleep slp{m_kernel, std::addressof(timer), cur_thread, timeout};
@@ -286,8 +290,8 @@ Result KAddressArbiter::WaitIfLessThan(uint64_t addr, s32 value, bool decrement,
         }
 
         // Set the arbiter.
-        cur_thread->SetAddressArbiter(std::addressof(m_tree), addr);
-        m_tree.insert(*cur_thread);
+        cur_thread->SetAddressArbiter(std::addressof(tree), addr);
+        tree.insert(*cur_thread);
 
         // Wait for the thread to finish.
         wait_queue.SetHardwareTimer(timer);
@@ -303,7 +307,8 @@ Result KAddressArbiter::WaitIfEqual(uint64_t addr, s32 value, s64 timeout) {
     // Prepare to wait.
     KThread* cur_thread = GetCurrentThreadPointer(m_kernel);
     KHardwareTimer* timer{};
-    ThreadQueueImplForKAddressArbiter wait_queue(m_kernel, std::addressof(m_tree));
+    ThreadTree& tree = m_trees.Get(addr);
+    ThreadQueueImplForKAddressArbiter wait_queue(m_kernel, std::addressof(tree));
 
     {
         KScopedSchedulerLockAndSleep slp{m_kernel, std::addressof(timer), cur_thread, timeout};
@@ -334,8 +339,8 @@ Result KAddressArbiter::WaitIfEqual(uint64_t addr, s32 value, s64 timeout) {
         }
 
         // Set the arbiter.
-        cur_thread->SetAddressArbiter(std::addressof(m_tree), addr);
-        m_tree.insert(*cur_thread);
+        cur_thread->SetAddressArbiter(std::addressof(tree), addr);
+        tree.insert(*cur_thread);
 
         // Wait for the thread to finish.
         wait_queue.SetHardwareTimer(timer);
@@ -21,6 +21,7 @@ class KernelCore;
 class KAddressArbiter {
 public:
     using ThreadTree = KConditionVariable::ThreadTree;
+    using ThreadTrees = KConditionVariable::ThreadTrees;
 
     explicit KAddressArbiter(Core::System& system);
     ~KAddressArbiter();
@@ -59,7 +60,7 @@ private:
     Result WaitIfEqual(uint64_t addr, s32 value, s64 timeout);
 
 private:
-    ThreadTree m_tree;
+    ThreadTrees m_trees;
     Core::System& m_system;
     KernelCore& m_kernel;
 };
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "common/assert.h"
 
 #include "core/hle/kernel/k_scheduler.h"
@@ -21,6 +23,22 @@ class KConditionVariable {
 public:
     using ThreadTree = typename KThread::ConditionVariableThreadTreeType;
 
+    /// Waiting threads split across trees by key, a lookup only walks the waiters of the keys
+    /// that share its bucket. Each tree keeps its waiters ordered by key and priority.
+    class ThreadTrees {
+    public:
+        ThreadTree& Get(u64 key) {
+            // Keys are word aligned addresses, mix the bits above the page offset in as well
+            const u64 hash = (key >> 2) ^ (key >> 12);
+            return m_trees[hash % NumTrees];
+        }
+
+    private:
+        static constexpr size_t NumTrees = 16;
+
+        std::array<ThreadTree, NumTrees> m_trees{};
+    };
+
     explicit KConditionVariable(Core::System& system);
     ~KConditionVariable();
 
@@ -39,7 +57,7 @@ private:
 private:
     Core::System& m_system;
     KernelCore& m_kernel;
-    ThreadTree m_tree{};
+    ThreadTrees m_trees{};
 };
 
 inline void BeforeUpdatePriority(KernelCore& kernel, KConditionVariable::ThreadTree* tree,
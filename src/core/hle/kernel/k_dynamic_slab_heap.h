@@ -35,6 +35,10 @@ public:
         return m_count.load();
     }
 
+    KSlabHeapMagazineStats GetMagazineStats() const {
+        return KSlabHeapImpl::GetMagazineStats();
+    }
+
     constexpr bool IsInRange(KVirtualAddress addr) const {
         return this->GetAddress() <= addr && addr <= this->GetAddress() + this->GetSize() - 1;
     }
@@ -80,10 +80,10 @@ KProcessAddress KMemoryBlockManager::FindFreeArea(KProcessAddress region_start,
 }
 
 void KMemoryBlockManager::CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator* allocator,
-                                            KProcessAddress address, size_t num_pages) {
-    // Find the iterator now that we've updated.
-    iterator it = this->FindIterator(address);
-    if (address != m_start_address) {
+                                            iterator it, KProcessAddress address,
+                                            size_t num_pages) {
+    // Start from the block before the updated range, it may merge with the first updated block.
+    if (it != m_memory_block_tree.begin()) {
         it--;
     }
 
@@ -122,6 +122,8 @@ void KMemoryBlockManager::Update(KMemoryBlockManagerUpdateAllocator* allocator,
     KProcessAddress cur_address = address;
     size_t remaining_pages = num_pages;
     iterator it = this->FindIterator(address);
+    iterator first = m_memory_block_tree.end();
+    bool updated = false;
 
     while (remaining_pages > 0) {
         const size_t remaining_size = remaining_pages * PageSize;
@@ -160,15 +162,22 @@ void KMemoryBlockManager::Update(KMemoryBlockManagerUpdateAllocator* allocator,
             }
 
             // Update block state.
+            updated = true;
             it->Update(state, perm, attr, it->GetAddress() == address,
                        static_cast<u8>(set_disable_attr), static_cast<u8>(clear_disable_attr));
             cur_address += cur_info.GetSize();
             remaining_pages -= cur_info.GetNumPages();
         }
+        if (first == m_memory_block_tree.end()) {
+            first = it;
+        }
         it++;
     }
 
-    this->CoalesceForUpdate(allocator, address, num_pages);
+    // Nothing changed, the blocks are still coalesced.
+    if (updated) {
+        this->CoalesceForUpdate(allocator, first, address, num_pages);
+    }
 }
 
 void KMemoryBlockManager::UpdateIfMatch(KMemoryBlockManagerUpdateAllocator* allocator,
@@ -187,6 +196,8 @@ void KMemoryBlockManager::UpdateIfMatch(KMemoryBlockManagerUpdateAllocator* allo
     KProcessAddress cur_address = address;
     size_t remaining_pages = num_pages;
     iterator it = this->FindIterator(address);
+    iterator first = m_memory_block_tree.end();
+    bool updated = false;
 
     while (remaining_pages > 0) {
         const size_t remaining_size = remaining_pages * PageSize;
@@ -216,6 +227,7 @@ void KMemoryBlockManager::UpdateIfMatch(KMemoryBlockManagerUpdateAllocator* allo
             }
 
             // Update block state.
+            updated = true;
             it->Update(state, perm, attr, false, static_cast<u8>(set_disable_attr),
                        static_cast<u8>(clear_disable_attr));
             cur_address += cur_info.GetSize();
@@ -231,10 +243,16 @@ void KMemoryBlockManager::UpdateIfMatch(KMemoryBlockManagerUpdateAllocator* allo
                 cur_address = cur_info.GetEndAddress();
             }
         }
+        if (first == m_memory_block_tree.end()) {
+            first = it;
+        }
         it++;
     }
 
-    this->CoalesceForUpdate(allocator, address, num_pages);
+    // Nothing changed, the blocks are still coalesced.
+    if (updated) {
+        this->CoalesceForUpdate(allocator, first, address, num_pages);
+    }
 }
 
 void KMemoryBlockManager::UpdateLock(KMemoryBlockManagerUpdateAllocator* allocator,
@@ -247,6 +265,7 @@ void KMemoryBlockManager::UpdateLock(KMemoryBlockManagerUpdateAllocator* allocat
     KProcessAddress cur_address = address;
     size_t remaining_pages = num_pages;
     iterator it = this->FindIterator(address);
+    iterator first = m_memory_block_tree.end();
 
     const KProcessAddress end_address = address + (num_pages * PageSize);
 
@@ -281,10 +300,13 @@ void KMemoryBlockManager::UpdateLock(KMemoryBlockManagerUpdateAllocator* allocat
                                           cur_info.GetEndAddress() == end_address);
         cur_address += cur_info.GetSize();
         remaining_pages -= cur_info.GetNumPages();
+        if (first == m_memory_block_tree.end()) {
+            first = it;
+        }
         it++;
     }
 
-    this->CoalesceForUpdate(allocator, address, num_pages);
+    this->CoalesceForUpdate(allocator, first, address, num_pages);
 }
 
 void KMemoryBlockManager::UpdateAttribute(KMemoryBlockManagerUpdateAllocator* allocator,
@@ -297,6 +319,8 @@ void KMemoryBlockManager::UpdateAttribute(KMemoryBlockManagerUpdateAllocator* al
     KProcessAddress cur_address = address;
     size_t remaining_pages = num_pages;
     iterator it = this->FindIterator(address);
+    iterator first = m_memory_block_tree.end();
+    bool updated = false;
 
     while (remaining_pages > 0) {
         const size_t remaining_size = remaining_pages * PageSize;
@@ -326,6 +350,7 @@ void KMemoryBlockManager::UpdateAttribute(KMemoryBlockManagerUpdateAllocator* al
             }
 
             // Update block state.
+            updated = true;
             it->UpdateAttribute(mask, attr);
             cur_address += cur_info.GetSize();
             remaining_pages -= cur_info.GetNumPages();
@@ -340,10 +365,16 @@ void KMemoryBlockManager::UpdateAttribute(KMemoryBlockManagerUpdateAllocator* al
                 cur_address = cur_info.GetEndAddress();
             }
         }
+        if (first == m_memory_block_tree.end()) {
+            first = it;
+        }
         it++;
     }
 
-    this->CoalesceForUpdate(allocator, address, num_pages);
+    // Nothing changed, the blocks are still coalesced.
+    if (updated) {
+        this->CoalesceForUpdate(allocator, first, address, num_pages);
+    }
 }
 
 // Debug.
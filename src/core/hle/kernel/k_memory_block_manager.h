@@ -138,8 +138,10 @@ public:
     bool CheckState() const;
 
 private:
-    void CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator* allocator, KProcessAddress address,
-                           size_t num_pages);
+    // Coalesces the updated blocks starting from the block containing address, which the update
+    // already has at hand, instead of looking it up in the tree again.
+    void CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator* allocator, iterator it,
+                           KProcessAddress address, size_t num_pages);
 
     MemoryBlockTree m_memory_block_tree;
     KProcessAddress m_start_address{};
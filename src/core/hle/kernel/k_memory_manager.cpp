@@ -2,9 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <bit>
+#include <cstring>
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/device_memory.h"
@@ -33,6 +36,23 @@ constexpr KMemoryManager::Pool GetPoolFromMemoryRegionType(u32 type) {
     }
 }
 
+// Calls func(word, mask, word_offset) for each word of a bitmap holding bits of the range, with
+// the mask of the bits in the range and the offset of the first bit of the word.
+template <typename Func>
+void ForEachBitmapWord(u64* bitmap, size_t offset, size_t count, Func&& func) {
+    constexpr size_t BitsPerWord = Common::BitSize<u64>();
+    while (count > 0) {
+        const size_t shift = offset % BitsPerWord;
+        const size_t cur_bits = std::min(count, BitsPerWord - shift);
+        const u64 mask =
+            (cur_bits == BitsPerWord ? ~u64(0) : ((u64(1) << cur_bits) - 1)) << shift;
+        func(bitmap[offset / BitsPerWord], mask, offset - shift);
+
+        offset += cur_bits;
+        count -= cur_bits;
+    }
+}
+
 } // namespace
 
 KMemoryManager::KMemoryManager(Core::System& system)
@@ -468,18 +488,9 @@ void KMemoryManager::Impl::TrackUnoptimizedAllocation(KernelCore& kernel, KPhysi
     auto optimize_pa = KPageTable::GetHeapPhysicalAddress(kernel, m_management_region);
     auto* optimize_map = kernel.System().DeviceMemory().GetPointer<u64>(optimize_pa);
 
-    // Get the range we're tracking.
-    size_t offset = this->GetPageOffset(block);
-    const size_t last = offset + num_pages - 1;
-
-    // Track.
-    while (offset <= last) {
-        // Mark the page as not being optimized-allocated.
-        optimize_map[offset / Common::BitSize<u64>()] &=
-            ~(u64(1) << (offset % Common::BitSize<u64>()));
-
-        offset++;
-    }
+    // Mark the pages as not being optimized-allocated, a word at a time.
+    ForEachBitmapWord(optimize_map, this->GetPageOffset(block), num_pages,
+                      [](u64& word, u64 mask, size_t) { word &= ~mask; });
 }
 
 void KMemoryManager::Impl::TrackOptimizedAllocation(KernelCore& kernel, KPhysicalAddress block,
@@ -487,18 +498,9 @@ void KMemoryManager::Impl::TrackOptimizedAllocation(KernelCore& kernel, KPhysica
     auto optimize_pa = KPageTable::GetHeapPhysicalAddress(kernel, m_management_region);
     auto* optimize_map = kernel.System().DeviceMemory().GetPointer<u64>(optimize_pa);
 
-    // Get the range we're tracking.
-    size_t offset = this->GetPageOffset(block);
-    const size_t last = offset + num_pages - 1;
-
-    // Track.
-    while (offset <= last) {
-        // Mark the page as being optimized-allocated.
-        optimize_map[offset / Common::BitSize<u64>()] |=
-            (u64(1) << (offset % Common::BitSize<u64>()));
-
-        offset++;
-    }
+    // Mark the pages as being optimized-allocated, a word at a time.
+    ForEachBitmapWord(optimize_map, this->GetPageOffset(block), num_pages,
+                      [](u64& word, u64 mask, size_t) { word |= mask; });
 }
 
 bool KMemoryManager::Impl::ProcessOptimizedAllocation(KernelCore& kernel, KPhysicalAddress block,
@@ -510,25 +512,27 @@ bool KMemoryManager::Impl::ProcessOptimizedAllocation(KernelCore& kernel, KPhysi
     // We want to return whether any pages were newly allocated.
     bool any_new = false;
 
-    // Get the range we're processing.
-    size_t offset = this->GetPageOffset(block);
-    const size_t last = offset + num_pages - 1;
-
-    // Process.
-    while (offset <= last) {
-        // Check if the page has been optimized-allocated before.
-        if ((optimize_map[offset / Common::BitSize<u64>()] &
-             (u64(1) << (offset % Common::BitSize<u64>()))) == 0) {
-            // If not, it's new.
-            any_new = true;
-
-            // Fill the page.
-            auto* ptr = device_memory.GetPointer<u8>(m_heap.GetAddress());
-            std::memset(ptr + offset * PageSize, fill_pattern, PageSize);
-        }
-
-        offset++;
-    }
+    // Process, filling each run of pages that has not been optimized-allocated before at once.
+    auto* const ptr = device_memory.GetPointer<u8>(m_heap.GetAddress());
+    ForEachBitmapWord(optimize_map, this->GetPageOffset(block), num_pages,
+                      [&](u64& word, u64 mask, size_t word_offset) {
+                          u64 new_pages = ~word & mask;
+                          while (new_pages != 0) {
+                              any_new = true;
+
+                              // Fill the run of new pages.
+                              const size_t first = std::countr_zero(new_pages);
+                              const size_t run = std::countr_one(new_pages >> first);
+                              std::memset(ptr + (word_offset + first) * PageSize, fill_pattern,
+                                          run * PageSize);
+
+                              // Advance past the run.
+                              if (first + run == Common::BitSize<u64>()) {
+                                  break;
+                              }
+                              new_pages &= ~u64(0) << (first + run);
+                          }
+                      });
 
     // Return the number of pages we processed.
     return any_new;
@@ -129,6 +129,13 @@ void KProcess::Finalize() {
     // Delete the process local region.
     this->DeleteThreadLocalRegion(m_plr_address);
 
+    // Free the cached thread local page.
+    if (m_free_tlp != nullptr) {
+        m_free_tlp->Finalize();
+        KThreadLocalPage::Free(m_kernel, m_free_tlp);
+        m_free_tlp = nullptr;
+    }
+
     // Get the used memory size.
     const size_t used_memory_size = this->GetUsedNonSystemUserPhysicalMemorySize();
 
@@ -640,6 +647,24 @@ Result KProcess::CreateThreadLocalRegion(KProcessAddress* out) {
             *out = tlr;
             R_SUCCEED();
         }
+
+        // Otherwise, reuse the cached free page if we have one.
+        if (m_free_tlp != nullptr) {
+            tlp = m_free_tlp;
+            m_free_tlp = nullptr;
+
+            tlr = tlp->Reserve();
+            ASSERT(tlr != 0);
+
+            if (tlp->IsAllUsed()) {
+                m_fully_used_tlp_tree.insert(*tlp);
+            } else {
+                m_partially_used_tlp_tree.insert(*tlp);
+            }
+
+            *out = tlr;
+            R_SUCCEED();
+        }
     }
 
     // Allocate a new page.
@@ -707,6 +732,12 @@ Result KProcess::DeleteThreadLocalRegion(KProcessAddress addr) {
                 page_to_free = tlp;
             }
         }
+
+        // Keep the page for the next thread rather than freeing it, if none is cached yet.
+        if (page_to_free != nullptr && m_free_tlp == nullptr) {
+            m_free_tlp = page_to_free;
+            page_to_free = nullptr;
+        }
     }
 
     // If we should free the page it was in, do so.
@@ -72,6 +72,9 @@ private:
     std::atomic<size_t> m_used_kernel_memory_size{};
     TLPTree m_fully_used_tlp_tree{};
     TLPTree m_partially_used_tlp_tree{};
+    // Page whose regions are all free, kept mapped so short-lived threads do not map and unmap a
+    // page each.
+    KThreadLocalPage* m_free_tlp{};
     s32 m_ideal_core_id{};
     KResourceLimit* m_resource_limit{};
     KSystemResource* m_system_resource{};
@@ -67,6 +67,10 @@ public:
         return m_state.prev_thread;
     }
 
+    KThread* GetHighestPriorityThread() const {
+        return m_state.highest_priority_thread;
+    }
+
     KThread* GetSchedulerCurrentThread() const {
         return m_current_thread.load();
     }
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <memory>
 
 #include "common/assert.h"
 #include "common/atomic_ops.h"
@@ -15,6 +17,13 @@ namespace Kernel {
 
 class KernelCore;
 
+/// Per-heap totals of the per-core magazine caches in front of the shared freelist
+struct KSlabHeapMagazineStats {
+    u64 hits{};
+    u64 misses{};
+    size_t depth{};
+};
+
 namespace impl {
 
 class KSlabHeapImpl {
@@ -40,32 +49,142 @@ public:
     void* Allocate() {
         // KScopedInterruptDisable di;
 
-        m_lock.lock();
+        Magazine& magazine = m_magazines[GetMagazineIndex()];
+        magazine.lock.lock();
 
-        Node* ret = m_head;
+        Node* ret = magazine.head;
         if (ret != nullptr) [[likely]] {
-            m_head = ret->next;
+            magazine.head = ret->next;
+            magazine.count--;
+            magazine.hits.store(magazine.hits.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+        } else {
+            magazine.misses.store(magazine.misses.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+            ret = this->RefillLocked(magazine);
         }
 
-        m_lock.unlock();
+        magazine.lock.unlock();
+
+        if (ret == nullptr) [[unlikely]] {
+            // Objects may still be cached by other magazines, don't fail while they have some.
+            ret = this->StealFromOtherMagazines(magazine);
+        }
         return ret;
     }
 
     void Free(void* obj) {
         // KScopedInterruptDisable di;
 
-        m_lock.lock();
+        Magazine& magazine = m_magazines[GetMagazineIndex()];
+        magazine.lock.lock();
+
+        if (magazine.count == MagazineCapacity) [[unlikely]] {
+            this->FlushLocked(magazine);
+        }
 
         Node* node = static_cast<Node*>(obj);
-        node->next = m_head;
-        m_head = node;
+        node->next = magazine.head;
+        magazine.head = node;
+        magazine.count++;
 
-        m_lock.unlock();
+        magazine.lock.unlock();
+    }
+
+    KSlabHeapMagazineStats GetMagazineStats() const {
+        KSlabHeapMagazineStats stats{};
+        for (Magazine& magazine : m_magazines) {
+            stats.hits += magazine.hits.load(std::memory_order_relaxed);
+            stats.misses += magazine.misses.load(std::memory_order_relaxed);
+            magazine.lock.lock();
+            stats.depth += magazine.count;
+            magazine.lock.unlock();
+        }
+        return stats;
     }
 
 private:
+    static constexpr size_t NumMagazines = 4;
+    static constexpr size_t MagazineCapacity = 16;
+
+    // Each host thread sticks to one magazine. Guest cores run on their own host threads, so in
+    // practice these are per-core caches, while other threads are spread across them.
+    struct alignas(64) Magazine {
+        Common::SpinLock lock;
+        Node* head{};
+        size_t count{};
+        std::atomic<u64> hits{};
+        std::atomic<u64> misses{};
+    };
+
+    static size_t GetMagazineIndex() {
+        static std::atomic<size_t> next_index{};
+        thread_local const size_t index =
+            next_index.fetch_add(1, std::memory_order_relaxed) % NumMagazines;
+        return index;
+    }
+
+    /// Moves half a magazine from the shared list into an empty magazine and returns one object.
+    Node* RefillLocked(Magazine& magazine) {
+        m_lock.lock();
+
+        Node* ret = m_head;
+        if (ret != nullptr) [[likely]] {
+            Node* last = ret;
+            size_t taken = 1;
+            while (taken <= MagazineCapacity / 2 && last->next != nullptr) {
+                last = last->next;
+                taken++;
+            }
+            m_head = last->next;
+            last->next = nullptr;
+
+            magazine.head = ret->next;
+            magazine.count = taken - 1;
+        }
+
+        m_lock.unlock();
+        return ret;
+    }
+
+    /// Returns half of a full magazine to the shared list.
+    void FlushLocked(Magazine& magazine) {
+        Node* first = magazine.head;
+        Node* last = first;
+        for (size_t i = 1; i < MagazineCapacity / 2; i++) {
+            last = last->next;
+        }
+        magazine.head = last->next;
+        magazine.count -= MagazineCapacity / 2;
+
+        m_lock.lock();
+        last->next = m_head;
+        m_head = first;
+        m_lock.unlock();
+    }
+
+    Node* StealFromOtherMagazines(const Magazine& own) {
+        for (Magazine& magazine : m_magazines) {
+            if (std::addressof(magazine) == std::addressof(own)) {
+                continue;
+            }
+            magazine.lock.lock();
+            Node* ret = magazine.head;
+            if (ret != nullptr) {
+                magazine.head = ret->next;
+                magazine.count--;
+            }
+            magazine.lock.unlock();
+            if (ret != nullptr) {
+                return ret;
+            }
+        }
+        return nullptr;
+    }
+
     std::atomic<Node*> m_head{};
     Common::SpinLock m_lock;
+    mutable std::array<Magazine, NumMagazines> m_magazines{};
 };
 
 } // namespace impl
@@ -164,6 +283,10 @@ public:
         return m_start;
     }
 
+    KSlabHeapMagazineStats GetMagazineStats() const {
+        return KSlabHeapImpl::GetMagazineStats();
+    }
+
     size_t GetNumRemaining() const {
         // Only calculate the number of remaining objects under debug configuration.
         return 0;
@@ -16,6 +16,7 @@
 #include "common/scope_exit.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
+#include "common/trace.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
@@ -41,6 +42,7 @@
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_profiler.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sm/sm.h"
@@ -861,6 +863,7 @@ void KernelCore::Initialize() {
 }
 
 void KernelCore::Shutdown() {
+    Svc::LogSvcStats();
     impl->Shutdown();
 }
 
@@ -1061,6 +1064,7 @@ static std::jthread RunHostThreadFunc(KernelCore& kernel, KProcess* process,
         [&kernel, thread, thread_name_{std::move(thread_name)}, func_{std::move(func)}] {
             // Set the thread name.
             Common::SetCurrentThreadName(thread_name_.c_str());
+            Common::Trace::SetThreadName(thread_name_.c_str());
 
             // Set the thread as current.
             kernel.RegisterHostThread(thread);
@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/spin_lock.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/debugger/debugger.h"
 #include "core/hle/kernel/k_process.h"
@@ -91,6 +95,7 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
                     thread->SetStepState(StepState::StepPerformed);
                 }
             } else {
+                TRACE_SCOPE(Cpu, "RunGuest");
                 hr = interface->RunThread(thread);
             }
 
@@ -204,8 +209,27 @@ void PhysicalCore::LogBacktrace() {
 }
 
 void PhysicalCore::Idle() {
+    // Interrupts often arrive right after a core goes idle, and waking up from the condition
+    // variable takes much longer than that. Spin for a while first, growing the spin when it
+    // catches the interrupt and shrinking it when the core ends up sleeping for long anyway.
+    const auto idle_start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - idle_start < m_idle_spin) {
+        if (m_is_interrupted.load(std::memory_order_acquire)) {
+            m_idle_spin = std::min(m_idle_spin * 2, MaxIdleSpin);
+            return;
+        }
+        Common::ThreadPause();
+    }
+
     std::unique_lock lk{m_guard};
-    m_on_interrupt.wait(lk, [this] { return m_is_interrupted; });
+    m_on_interrupt.wait(lk, [this] { return m_is_interrupted.load(std::memory_order_relaxed); });
+
+    const auto idle_time = std::chrono::steady_clock::now() - idle_start;
+    if (idle_time < MaxIdleSpin) {
+        m_idle_spin = std::min(m_idle_spin * 2, MaxIdleSpin);
+    } else {
+        m_idle_spin = std::max(m_idle_spin / 2, MinIdleSpin);
+    }
 }
 
 bool PhysicalCore::IsInterrupted() const {
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
@@ -63,6 +65,10 @@ public:
     }
 
 private:
+    // Bounds of the adaptive spin done before an idle core goes to sleep.
+    static constexpr std::chrono::nanoseconds MinIdleSpin{500};
+    static constexpr std::chrono::nanoseconds MaxIdleSpin{50'000};
+
     KernelCore& m_kernel;
     const std::size_t m_core_index;
 
@@ -70,7 +76,8 @@ private:
     std::condition_variable m_on_interrupt;
     Core::ArmInterface* m_arm_interface{};
     KThread* m_current_thread{};
-    bool m_is_interrupted{};
+    std::atomic<bool> m_is_interrupted{};
+    std::chrono::nanoseconds m_idle_spin{MinIdleSpin};
     bool m_is_single_core{};
 };
 
@@ -9,6 +9,7 @@
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_profiler.h"
 
 namespace Kernel::Svc {
 
@@ -4429,6 +4430,7 @@ void Call(Core::System& system, u32 imm) {
     std::array<uint64_t, 8> args;
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
+    const auto svc_profile = EnterSvcProfile(imm);
 
     if (process.Is64Bit()) {
         Call64(system, imm, args);
@@ -4436,6 +4438,7 @@ void Call(Core::System& system, u32 imm) {
         Call32(system, imm, args);
     }
 
+    LeaveSvcProfile(svc_profile);
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
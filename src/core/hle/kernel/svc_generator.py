@@ -549,6 +549,7 @@ PROLOGUE_CPP = """
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_profiler.h"
 
 namespace Kernel::Svc {
 
@@ -597,6 +598,7 @@ void Call(Core::System& system, u32 imm) {
     std::array<uint64_t, 8> args;
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
+    const auto svc_profile = EnterSvcProfile(imm);
 
     if (process.Is64Bit()) {
         Call64(system, imm, args);
@@ -604,6 +606,7 @@ void Call(Core::System& system, u32 imm) {
         Call32(system, imm, args);
     }
 
+    LeaveSvcProfile(svc_profile);
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
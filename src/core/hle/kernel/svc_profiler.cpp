@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <numeric>
+#include <utility>
+
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/settings.h"
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_profiler.h"
+
+namespace Kernel::Svc {
+namespace {
+struct AtomicSvcStats {
+    std::atomic<u64> calls{};
+    std::atomic<u64> total_ns{};
+    std::atomic<u64> max_ns{};
+    std::array<std::atomic<u64>, NUM_SVC_LATENCY_BUCKETS> histogram{};
+};
+
+std::array<AtomicSvcStats, NUM_SVC_SLOTS> svc_stats;
+
+// clang-format off
+constexpr std::array<std::pair<SvcId, const char*>, 123> SVC_NAMES{{
+    {SvcId::SetHeapSize, "SetHeapSize"},
+    {SvcId::SetMemoryPermission, "SetMemoryPermission"},
+    {SvcId::SetMemoryAttribute, "SetMemoryAttribute"},
+    {SvcId::MapMemory, "MapMemory"},
+    {SvcId::UnmapMemory, "UnmapMemory"},
+    {SvcId::QueryMemory, "QueryMemory"},
+    {SvcId::ExitProcess, "ExitProcess"},
+    {SvcId::CreateThread, "CreateThread"},
+    {SvcId::StartThread, "StartThread"},
+    {SvcId::ExitThread, "ExitThread"},
+    {SvcId::SleepThread, "SleepThread"},
+    {SvcId::GetThreadPriority, "GetThreadPriority"},
+    {SvcId::SetThreadPriority, "SetThreadPriority"},
+    {SvcId::GetThreadCoreMask, "GetThreadCoreMask"},
+    {SvcId::SetThreadCoreMask, "SetThreadCoreMask"},
+    {SvcId::GetCurrentProcessorNumber, "GetCurrentProcessorNumber"},
+    {SvcId::SignalEvent, "SignalEvent"},
+    {SvcId::ClearEvent, "ClearEvent"},
+    {SvcId::MapSharedMemory, "MapSharedMemory"},
+    {SvcId::UnmapSharedMemory, "UnmapSharedMemory"},
+    {SvcId::CreateTransferMemory, "CreateTransferMemory"},
+    {SvcId::CloseHandle, "CloseHandle"},
+    {SvcId::ResetSignal, "ResetSignal"},
+    {SvcId::WaitSynchronization, "WaitSynchronization"},
+    {SvcId::CancelSynchronization, "CancelSynchronization"},
+    {SvcId::ArbitrateLock, "ArbitrateLock"},
+    {SvcId::ArbitrateUnlock, "ArbitrateUnlock"},
+    {SvcId::WaitProcessWideKeyAtomic, "WaitProcessWideKeyAtomic"},
+    {SvcId::SignalProcessWideKey, "SignalProcessWideKey"},
+    {SvcId::GetSystemTick, "GetSystemTick"},
+    {SvcId::ConnectToNamedPort, "ConnectToNamedPort"},
+    {SvcId::SendSyncRequestLight, "SendSyncRequestLight"},
+    {SvcId::SendSyncRequest, "SendSyncRequest"},
+    {SvcId::SendSyncRequestWithUserBuffer, "SendSyncRequestWithUserBuffer"},
+    {SvcId::SendAsyncRequestWithUserBuffer, "SendAsyncRequestWithUserBuffer"},
+    {SvcId::GetProcessId, "GetProcessId"},
+    {SvcId::GetThreadId, "GetThreadId"},
+    {SvcId::Break, "Break"},
+    {SvcId::OutputDebugString, "OutputDebugString"},
+    {SvcId::ReturnFromException, "ReturnFromException"},
+    {SvcId::GetInfo, "GetInfo"},
+    {SvcId::FlushEntireDataCache, "FlushEntireDataCache"},
+    {SvcId::FlushDataCache, "FlushDataCache"},
+    {SvcId::MapPhysicalMemory, "MapPhysicalMemory"},
+    {SvcId::UnmapPhysicalMemory, "UnmapPhysicalMemory"},
+    {SvcId::GetDebugFutureThreadInfo, "GetDebugFutureThreadInfo"},
+    {SvcId::GetLastThreadInfo, "GetLastThreadInfo"},
+    {SvcId::GetResourceLimitLimitValue, "GetResourceLimitLimitValue"},
+    {SvcId::GetResourceLimitCurrentValue, "GetResourceLimitCurrentValue"},
+    {SvcId::SetThreadActivity, "SetThreadActivity"},
+    {SvcId::GetThreadContext3, "GetThreadContext3"},
+    {SvcId::WaitForAddress, "WaitForAddress"},
+    {SvcId::SignalToAddress, "SignalToAddress"},
+    {SvcId::SynchronizePreemptionState, "SynchronizePreemptionState"},
+    {SvcId::GetResourceLimitPeakValue, "GetResourceLimitPeakValue"},
+    {SvcId::CreateIoPool, "CreateIoPool"},
+    {SvcId::CreateIoRegion, "CreateIoRegion"},
+    {SvcId::KernelDebug, "KernelDebug"},
+    {SvcId::ChangeKernelTraceState, "ChangeKernelTraceState"},
+    {SvcId::CreateSession, "CreateSession"},
+    {SvcId::AcceptSession, "AcceptSession"},
+    {SvcId::ReplyAndReceiveLight, "ReplyAndReceiveLight"},
+    {SvcId::ReplyAndReceive, "ReplyAndReceive"},
+    {SvcId::ReplyAndReceiveWithUserBuffer, "ReplyAndReceiveWithUserBuffer"},
+    {SvcId::CreateEvent, "CreateEvent"},
+    {SvcId::MapIoRegion, "MapIoRegion"},
+    {SvcId::UnmapIoRegion, "UnmapIoRegion"},
+    {SvcId::MapPhysicalMemoryUnsafe, "MapPhysicalMemoryUnsafe"},
+    {SvcId::UnmapPhysicalMemoryUnsafe, "UnmapPhysicalMemoryUnsafe"},
+    {SvcId::SetUnsafeLimit, "SetUnsafeLimit"},
+    {SvcId::CreateCodeMemory, "CreateCodeMemory"},
+    {SvcId::ControlCodeMemory, "ControlCodeMemory"},
+    {SvcId::SleepSystem, "SleepSystem"},
+    {SvcId::ReadWriteRegister, "ReadWriteRegister"},
+    {SvcId::SetProcessActivity, "SetProcessActivity"},
+    {SvcId::CreateSharedMemory, "CreateSharedMemory"},
+    {SvcId::MapTransferMemory, "MapTransferMemory"},
+    {SvcId::UnmapTransferMemory, "UnmapTransferMemory"},
+    {SvcId::CreateInterruptEvent, "CreateInterruptEvent"},
+    {SvcId::QueryPhysicalAddress, "QueryPhysicalAddress"},
+    {SvcId::QueryIoMapping, "QueryIoMapping"},
+    {SvcId::CreateDeviceAddressSpace, "CreateDeviceAddressSpace"},
+    {SvcId::AttachDeviceAddressSpace, "AttachDeviceAddressSpace"},
+    {SvcId::DetachDeviceAddressSpace, "DetachDeviceAddressSpace"},
+    {SvcId::MapDeviceAddressSpaceByForce, "MapDeviceAddressSpaceByForce"},
+    {SvcId::MapDeviceAddressSpaceAligned, "MapDeviceAddressSpaceAligned"},
+    {SvcId::UnmapDeviceAddressSpace, "UnmapDeviceAddressSpace"},
+    {SvcId::InvalidateProcessDataCache, "InvalidateProcessDataCache"},
+    {SvcId::StoreProcessDataCache, "StoreProcessDataCache"},
+    {SvcId::FlushProcessDataCache, "FlushProcessDataCache"},
+    {SvcId::DebugActiveProcess, "DebugActiveProcess"},
+    {SvcId::BreakDebugProcess, "BreakDebugProcess"},
+    {SvcId::TerminateDebugProcess, "TerminateDebugProcess"},
+    {SvcId::GetDebugEvent, "GetDebugEvent"},
+    {SvcId::ContinueDebugEvent, "ContinueDebugEvent"},
+    {SvcId::GetProcessList, "GetProcessList"},
+    {SvcId::GetThreadList, "GetThreadList"},
+    {SvcId::GetDebugThreadContext, "GetDebugThreadContext"},
+    {SvcId::SetDebugThreadContext, "SetDebugThreadContext"},
+    {SvcId::QueryDebugProcessMemory, "QueryDebugProcessMemory"},
+    {SvcId::ReadDebugProcessMemory, "ReadDebugProcessMemory"},
+    {SvcId::WriteDebugProcessMemory, "WriteDebugProcessMemory"},
+    {SvcId::SetHardwareBreakPoint, "SetHardwareBreakPoint"},
+    {SvcId::GetDebugThreadParam, "GetDebugThreadParam"},
+    {SvcId::GetSystemInfo, "GetSystemInfo"},
+    {SvcId::CreatePort, "CreatePort"},
+    {SvcId::ManageNamedPort, "ManageNamedPort"},
+    {SvcId::ConnectToPort, "ConnectToPort"},
+    {SvcId::SetProcessMemoryPermission, "SetProcessMemoryPermission"},
+    {SvcId::MapProcessMemory, "MapProcessMemory"},
+    {SvcId::UnmapProcessMemory, "UnmapProcessMemory"},
+    {SvcId::QueryProcessMemory, "QueryProcessMemory"},
+    {SvcId::MapProcessCodeMemory, "MapProcessCodeMemory"},
+    {SvcId::UnmapProcessCodeMemory, "UnmapProcessCodeMemory"},
+    {SvcId::CreateProcess, "CreateProcess"},
+    {SvcId::StartProcess, "StartProcess"},
+    {SvcId::TerminateProcess, "TerminateProcess"},
+    {SvcId::GetProcessInfo, "GetProcessInfo"},
+    {SvcId::CreateResourceLimit, "CreateResourceLimit"},
+    {SvcId::SetResourceLimitLimitValue, "SetResourceLimitLimitValue"},
+    {SvcId::CallSecureMonitor, "CallSecureMonitor"},
+    {SvcId::MapInsecureMemory, "MapInsecureMemory"},
+    {SvcId::UnmapInsecureMemory, "UnmapInsecureMemory"},
+}};
+// clang-format on
+
+constexpr std::array<const char*, NUM_SVC_SLOTS> SVC_NAME_TABLE = [] {
+    std::array<const char*, NUM_SVC_SLOTS> table{};
+    for (const auto& [id, name] : SVC_NAMES) {
+        table[static_cast<size_t>(id)] = name;
+    }
+    return table;
+}();
+
+// Tokens are registered on first use so the SVC group only shows up in MicroProfile when
+// profiling has been enabled.
+std::array<MicroProfileToken, NUM_SVC_SLOTS> svc_tokens;
+std::once_flag svc_tokens_flag;
+
+void RegisterTokens() {
+    for (size_t index = 0; index < NUM_SVC_SLOTS; ++index) {
+        if (SVC_NAME_TABLE[index] != nullptr) {
+            svc_tokens[index] =
+                MicroProfileGetToken("SVC", SVC_NAME_TABLE[index], MP_RGB(70, 200, 70));
+        }
+    }
+}
+
+size_t LatencyBucket(u64 time_ns) {
+    const u64 scaled{time_ns / SVC_LATENCY_BUCKET_BASE_NS};
+    return std::min<size_t>(std::bit_width(scaled), NUM_SVC_LATENCY_BUCKETS - 1);
+}
+
+/// Returns the upper bound in nanoseconds of the bucket containing the given percentile
+u64 Percentile(const SvcStats& stats, u64 percent) {
+    const u64 target{(stats.calls * percent + 99) / 100};
+    u64 seen{};
+    for (size_t bucket = 0; bucket < NUM_SVC_LATENCY_BUCKETS - 1; ++bucket) {
+        seen += stats.histogram[bucket];
+        if (seen >= target) {
+            return SVC_LATENCY_BUCKET_BASE_NS << bucket;
+        }
+    }
+    return stats.max_ns;
+}
+} // Anonymous namespace
+
+bool IsSvcProfilingEnabled() {
+    return Settings::values.profile_svcs.GetValue();
+}
+
+SvcProfileScope EnterSvcProfile(u32 imm) {
+    if (!IsSvcProfilingEnabled() || imm >= NUM_SVC_SLOTS || SVC_NAME_TABLE[imm] == nullptr) {
+        return {};
+    }
+    std::call_once(svc_tokens_flag, RegisterTokens);
+    return SvcProfileScope{
+        .start = std::chrono::steady_clock::now(),
+        .microprofile_tick = MicroProfileEnter(svc_tokens[imm]),
+        .imm = imm,
+        .is_profiled = true,
+    };
+}
+
+void LeaveSvcProfile(const SvcProfileScope& scope) {
+    if (!scope.is_profiled) {
+        return;
+    }
+    const auto elapsed{std::chrono::steady_clock::now() - scope.start};
+    MicroProfileLeave(svc_tokens[scope.imm], scope.microprofile_tick);
+
+    const u64 time_ns{static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())};
+    AtomicSvcStats& stats{svc_stats[scope.imm]};
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    stats.total_ns.fetch_add(time_ns, std::memory_order_relaxed);
+    stats.histogram[LatencyBucket(time_ns)].fetch_add(1, std::memory_order_relaxed);
+    u64 max_ns{stats.max_ns.load(std::memory_order_relaxed)};
+    while (max_ns < time_ns &&
+           !stats.max_ns.compare_exchange_weak(max_ns, time_ns, std::memory_order_relaxed)) {
+    }
+}
+
+SvcStats GetSvcStats(u32 imm) {
+    if (imm >= NUM_SVC_SLOTS) {
+        return {};
+    }
+    const AtomicSvcStats& stats{svc_stats[imm]};
+    SvcStats result{
+        .calls = stats.calls.load(std::memory_order_relaxed),
+        .total_ns = stats.total_ns.load(std::memory_order_relaxed),
+        .max_ns = stats.max_ns.load(std::memory_order_relaxed),
+    };
+    for (size_t bucket = 0; bucket < NUM_SVC_LATENCY_BUCKETS; ++bucket) {
+        result.histogram[bucket] = stats.histogram[bucket].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+std::string_view SvcName(u32 imm) {
+    if (imm >= NUM_SVC_SLOTS || SVC_NAME_TABLE[imm] == nullptr) {
+        return "Unknown";
+    }
+    return SVC_NAME_TABLE[imm];
+}
+
+void LogSvcStats() {
+    std::array<SvcStats, NUM_SVC_SLOTS> stats;
+    for (u32 imm = 0; imm < NUM_SVC_SLOTS; ++imm) {
+        stats[imm] = GetSvcStats(imm);
+    }
+    for (AtomicSvcStats& entry : svc_stats) {
+        entry.calls.store(0, std::memory_order_relaxed);
+        entry.total_ns.store(0, std::memory_order_relaxed);
+        entry.max_ns.store(0, std::memory_order_relaxed);
+        for (auto& bucket : entry.histogram) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    if (std::ranges::all_of(stats, [](const SvcStats& svc) { return svc.calls == 0; })) {
+        return;
+    }
+    std::array<u32, NUM_SVC_SLOTS> order;
+    std::iota(order.begin(), order.end(), u32{0});
+    std::ranges::sort(order, std::ranges::greater{},
+                      [&](u32 imm) { return stats[imm].total_ns; });
+
+    LOG_INFO(Kernel_SVC, "SVC host timings:");
+    for (const u32 imm : order) {
+        const SvcStats& svc{stats[imm]};
+        if (svc.calls == 0) {
+            continue;
+        }
+        LOG_INFO(Kernel_SVC,
+                 "{:>32}: {:>10} calls, {:>10.3f} ms total, {:>8.3f} us avg, "
+                 "p50 < {:>8.3f} us, p99 < {:>8.3f} us, {:>10.3f} us max",
+                 SvcName(imm), svc.calls, svc.total_ns / 1e6, svc.total_ns / 1e3 / svc.calls,
+                 Percentile(svc, 50) / 1e3, Percentile(svc, 99) / 1e3, svc.max_ns / 1e3);
+    }
+}
+
+} // namespace Kernel::Svc
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Kernel::Svc {
+
+constexpr size_t NUM_SVC_SLOTS = 0x100;
+constexpr size_t NUM_SVC_LATENCY_BUCKETS = 16;
+
+/// Host latency of the first histogram bucket, each following bucket doubles it
+constexpr u64 SVC_LATENCY_BUCKET_BASE_NS = 256;
+
+struct SvcStats {
+    u64 calls{};
+    u64 total_ns{};
+    u64 max_ns{};
+    /// Bucket N counts calls shorter than SVC_LATENCY_BUCKET_BASE_NS << N, the last is unbounded
+    std::array<u64, NUM_SVC_LATENCY_BUCKETS> histogram{};
+};
+
+/// Profiling state of an in-flight SVC, kept on the calling guest thread's stack
+struct SvcProfileScope {
+    std::chrono::steady_clock::time_point start{};
+    u64 microprofile_tick{};
+    u32 imm{};
+    bool is_profiled{};
+};
+
+/// Returns true when per-SVC statistics are being collected
+[[nodiscard]] bool IsSvcProfilingEnabled();
+
+/// Starts timing an SVC, also entering its MicroProfile timer in the "SVC" group
+[[nodiscard]] SvcProfileScope EnterSvcProfile(u32 imm);
+
+/// Finishes timing an SVC started with EnterSvcProfile, safe to call from multiple threads
+void LeaveSvcProfile(const SvcProfileScope& scope);
+
+/// Returns the statistics accumulated for an SVC since the last LogSvcStats
+[[nodiscard]] SvcStats GetSvcStats(u32 imm);
+
+[[nodiscard]] std::string_view SvcName(u32 imm);
+
+/// Logs the accumulated statistics sorted by total time, if any were collected, and clears them
+void LogSvcStats();
+
+} // namespace Kernel::Svc
@@ -27,6 +27,14 @@ void LoopProcess(Core::System& system) {
                                          std::make_shared<IFinalOutputRecorderManager>(system));
     server_manager->RegisterNamedService("audren:u",
                                          std::make_shared<IAudioRendererManager>(system));
+    ServerManager::RunServer(std::move(server_manager));
+}
+
+void LoopProcessHardwareOpus(Core::System& system) {
+    auto server_manager = std::make_unique<ServerManager>(system);
+
+    // Opus decodes can take a while for multistream voice and music packets, so they run on a
+    // server of their own to not hold up audout and audren requests behind them.
     server_manager->RegisterNamedService("hwopus",
                                          std::make_shared<IHardwareOpusDecoderManager>(system));
     ServerManager::RunServer(std::move(server_manager));
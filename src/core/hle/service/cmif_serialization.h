@@ -8,6 +8,7 @@
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/service.h"
+#include "core/memory.h"
 
 namespace Service {
 
@@ -239,7 +240,11 @@ constexpr RequestLayout GetReplyOutLayout(bool is_domain) {
     return is_domain ? GetDomainReplyOutLayout<MethodArguments>() : GetNonDomainReplyOutLayout<MethodArguments>();
 }
 
-using OutTemporaryBuffers = std::array<Common::ScratchBuffer<u8>, 3>;
+struct OutTemporaryBuffers {
+    std::array<Common::ScratchBuffer<u8>, 3> scratch;
+    // Set for out buffers the handler writes directly in guest memory, these are not copied back.
+    std::array<bool, 3> is_direct{};
+};
 
 template <typename MethodArguments, typename CallArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t HandleIndex = 0, size_t InBufferIndex = 0, size_t OutBufferIndex = 0, bool RawDataFinished = false, size_t ArgIndex = 0>
 void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
@@ -338,8 +343,23 @@ void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLE
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
             using ElementType = typename ArgType::Type;
 
+            // Let the handler write mapped buffers in place when they are contiguous in host memory.
+            if constexpr ((ArgType::Attr & BufferAttr_HipcMapAlias) && !(ArgType::Attr & BufferAttr_HipcAutoSelect)) {
+                const auto descriptors = ctx.BufferDescriptorB();
+                if (OutBufferIndex < descriptors.size() && descriptors[OutBufferIndex].Size() > 0) {
+                    const auto& descriptor = descriptors[OutBufferIndex];
+                    u8* const host_ptr = ctx.GetMemory().GetSpan(descriptor.Address(), descriptor.Size());
+                    if (host_ptr != nullptr && reinterpret_cast<uintptr_t>(host_ptr) % alignof(ElementType) == 0) {
+                        temp.is_direct[OutBufferIndex] = true;
+                        std::get<ArgIndex>(args) = std::span(reinterpret_cast<ElementType*>(host_ptr), descriptor.Size() / sizeof(ElementType));
+
+                        return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
+                    }
+                }
+            }
+
             // Set up scratch buffer.
-            auto& buffer = temp[OutBufferIndex];
+            auto& buffer = temp.scratch[OutBufferIndex];
             if (ctx.CanWriteBuffer(OutBufferIndex)) {
                 buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
             } else {
@@ -412,10 +432,14 @@ void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequ
 
             return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            auto& buffer = temp[OutBufferIndex];
+            auto& buffer = temp.scratch[OutBufferIndex];
             const size_t size = buffer.size();
 
-            if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
+            if (temp.is_direct[OutBufferIndex]) {
+                // The data is in guest memory already, only let the GPU know it was written.
+                const auto& descriptor = ctx.BufferDescriptorB()[OutBufferIndex];
+                ctx.GetMemory().StoreDataCache(descriptor.Address(), descriptor.Size());
+            } else if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
                 if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
                     ctx.WriteBuffer(buffer.data(), size, OutBufferIndex);
                 } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
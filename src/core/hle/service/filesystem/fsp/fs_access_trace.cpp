@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/hle/service/filesystem/fsp/fs_access_trace.h"
+
+namespace Service::FileSystem {
+
+namespace {
+using namespace Common::Literals;
+using namespace std::chrono_literals;
+
+constexpr u32 TraceMagic = 0x54465259; // "YRFT"
+constexpr u32 TraceVersion = 1;
+
+/// How long after the RomFS is first opened reads are recorded
+constexpr auto BootTraceDuration = 60s;
+
+/// Bounds for a trace, which also bound the memory used while prefetching it
+constexpr u64 MaxTraceSize = 128_MiB;
+constexpr size_t MaxTraceRanges = 0x4000;
+
+/// Amount of the RomFS start hashed to tell RomFS images apart, this covers the header
+constexpr size_t KeySize = 0x200;
+
+struct TraceHeader {
+    u32 magic;
+    u32 version;
+    u64 num_ranges;
+};
+static_assert(std::is_trivially_copyable_v<TraceHeader>);
+static_assert(std::is_trivially_copyable_v<AccessRange>);
+
+u64 HashRanges(const std::vector<AccessRange>& ranges) {
+    return Common::CityHash64(reinterpret_cast<const char*>(ranges.data()),
+                              ranges.size() * sizeof(AccessRange));
+}
+} // Anonymous namespace
+
+RomFsAccessTrace::RomFsAccessTrace(u64 program_id, const FileSys::VirtualFile& romfs) {
+    if (!romfs) {
+        return;
+    }
+
+    std::array<u8, KeySize> head{};
+    const size_t head_size{romfs->Read(head.data(), head.size())};
+    const u64 key{Common::CityHash64WithSeed(reinterpret_cast<const char*>(head.data()),
+                                             head_size, romfs->GetSize())};
+    path = Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "romfs_trace" /
+           fmt::format("{:016X}-{:016X}.bin", program_id, key);
+
+    this->Load();
+    recording = true;
+    start_time = std::chrono::steady_clock::now();
+}
+
+RomFsAccessTrace::~RomFsAccessTrace() {
+    std::scoped_lock lk{mutex};
+    if (recording) {
+        this->Save();
+    }
+}
+
+std::vector<AccessRange> RomFsAccessTrace::TakePrefetchRanges() {
+    std::scoped_lock lk{mutex};
+    return std::exchange(prefetch_ranges, {});
+}
+
+void RomFsAccessTrace::Record(u64 offset, u64 size) {
+    std::scoped_lock lk{mutex};
+    if (!recording || size == 0) {
+        return;
+    }
+    if (std::chrono::steady_clock::now() - start_time > BootTraceDuration ||
+        recorded_size >= MaxTraceSize || recorded.size() >= MaxTraceRanges) {
+        recording = false;
+        this->Save();
+        return;
+    }
+
+    const u64 end{offset + size};
+
+    // Record the parts of the read that were not read before
+    auto it = covered.upper_bound(offset);
+    u64 pos{offset};
+    if (it != covered.begin()) {
+        pos = std::max(pos, std::prev(it)->second);
+    }
+    for (; pos < end; ++it) {
+        const u64 gap_end{it != covered.end() ? std::min(it->first, end) : end};
+        if (pos < gap_end) {
+            this->Append(pos, gap_end - pos);
+        }
+        if (it == covered.end()) {
+            break;
+        }
+        pos = std::max(pos, it->second);
+    }
+
+    // Merge the read into the covered ranges
+    u64 merged_begin{offset};
+    u64 merged_end{end};
+    it = covered.upper_bound(offset);
+    if (it != covered.begin() && std::prev(it)->second >= offset) {
+        --it;
+        merged_begin = it->first;
+    }
+    while (it != covered.end() && it->first <= merged_end) {
+        merged_end = std::max(merged_end, it->second);
+        it = covered.erase(it);
+    }
+    covered.emplace(merged_begin, merged_end);
+}
+
+void RomFsAccessTrace::Append(u64 offset, u64 size) {
+    recorded_size += size;
+    if (!recorded.empty() && recorded.back().offset + recorded.back().size == offset) {
+        recorded.back().size += size;
+        return;
+    }
+    recorded.push_back({offset, size});
+}
+
+void RomFsAccessTrace::Load() {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    TraceHeader header{};
+    if (!file.ReadObject(header) || header.magic != TraceMagic ||
+        header.version != TraceVersion || header.num_ranges > MaxTraceRanges) {
+        return;
+    }
+
+    std::vector<AccessRange> ranges(header.num_ranges);
+    if (file.ReadSpan<AccessRange>(ranges) != ranges.size()) {
+        return;
+    }
+
+    LOG_INFO(Service_FS, "Prefetching {} RomFS ranges recorded by a previous boot", ranges.size());
+    loaded_hash = HashRanges(ranges);
+    prefetch_ranges = std::move(ranges);
+}
+
+void RomFsAccessTrace::Save() {
+    if (path.empty() || recorded.empty() || HashRanges(recorded) == loaded_hash ||
+        !Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    const TraceHeader header{
+        .magic = TraceMagic,
+        .version = TraceVersion,
+        .num_ranges = recorded.size(),
+    };
+    if (!file.WriteObject(header) ||
+        file.WriteSpan<AccessRange>(recorded) != recorded.size()) {
+        LOG_WARNING(Service_FS, "Failed to write the RomFS access trace to {}",
+                    Common::FS::PathToUTF8String(path));
+        file.Close();
+        Common::FS::RemoveFile(path);
+        return;
+    }
+
+    LOG_INFO(Service_FS, "Recorded {} RomFS ranges ({} bytes) read during boot", recorded.size(),
+             recorded_size);
+}
+
+} // namespace Service::FileSystem
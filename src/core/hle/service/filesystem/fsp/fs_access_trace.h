@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+
+namespace Service::FileSystem {
+
+/**
+ * Records which ranges of the current process' RomFS the guest reads while booting, so that the
+ * next boot can prefetch them before they are requested. Traces live in the cache directory and
+ * are keyed by program ID and a hash of the RomFS size and header, so an update or a LayeredFS
+ * mod that changes the RomFS gets a trace of its own.
+ *
+ * Every boot is traced, also while prefetching a previous trace, so that the trace follows the
+ * way the title is played. The trace file is only rewritten when the reads differ from it.
+ */
+class RomFsAccessTrace {
+public:
+    explicit RomFsAccessTrace(u64 program_id, const FileSys::VirtualFile& romfs);
+    ~RomFsAccessTrace();
+
+    RomFsAccessTrace(const RomFsAccessTrace&) = delete;
+    RomFsAccessTrace& operator=(const RomFsAccessTrace&) = delete;
+
+    /// Returns the ranges recorded by a previous boot in the order they were first read. Only the
+    /// first caller receives them.
+    std::vector<AccessRange> TakePrefetchRanges();
+
+    /// Records a guest read if this boot is being traced
+    void Record(u64 offset, u64 size);
+
+private:
+    void Load();
+    void Save();
+    void Append(u64 offset, u64 size);
+
+    std::mutex mutex;
+    std::filesystem::path path;
+    std::vector<AccessRange> prefetch_ranges;
+    /// Hash of the trace loaded from disk, a recording with the same hash is not saved again
+    u64 loaded_hash{};
+    bool recording{};
+    std::chrono::steady_clock::time_point start_time;
+    std::vector<AccessRange> recorded;
+    /// Ranges read so far, merged, used to record every byte only once
+    std::map<u64, u64> covered;
+    u64 recorded_size{};
+};
+
+} // namespace Service::FileSystem
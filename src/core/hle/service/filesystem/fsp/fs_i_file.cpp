@@ -7,8 +7,12 @@
 
 namespace Service::FileSystem {
 
-IFile::IFile(Core::System& system_, FileSys::VirtualFile file_)
-    : ServiceFramework{system_, "IFile"}, backend{std::make_unique<FileSys::Fsa::IFile>(file_)} {
+IFile::IFile(Core::System& system_, FileSys::VirtualFile file_, bool write_back_,
+             bool read_ahead_)
+    : ServiceFramework{system_, "IFile"},
+      write_back{write_back_ ? std::make_shared<WriteBackFile>(file_) : nullptr},
+      backend{std::make_unique<FileSys::Fsa::IFile>(write_back ? write_back : file_)},
+      read_ahead{write_back ? write_back : file_, read_ahead_} {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, D<&IFile::Read>, "Read"},
@@ -30,9 +34,17 @@ Result IFile::Read(
     LOG_DEBUG(Service_FS, "called, option={}, offset=0x{:X}, length={}", option.value, offset,
               size);
 
-    // Read the data from the Storage backend
-    R_RETURN(
-        backend->Read(reinterpret_cast<size_t*>(out_size.Get()), offset, out_buffer.data(), size));
+    // Validate the read like FileSys::Fsa::IFile::Read, but serve it through the read ahead buffer
+    if (size == 0) {
+        *out_size = 0;
+        R_SUCCEED();
+    }
+    R_UNLESS(offset >= 0, FileSys::ResultOutOfRange);
+    R_UNLESS(Common::CanAddWithoutOverflow<s64>(offset, size), FileSys::ResultOutOfRange);
+
+    *out_size = static_cast<s64>(read_ahead.Read(out_buffer.data(), static_cast<size_t>(size),
+                                                 static_cast<size_t>(offset)));
+    R_SUCCEED();
 }
 
 Result IFile::Write(
@@ -41,13 +53,21 @@ Result IFile::Write(
     LOG_DEBUG(Service_FS, "called, option={}, offset=0x{:X}, length={}", option.value, offset,
               size);
 
-    R_RETURN(backend->Write(offset, buffer.data(), size, option));
+    R_TRY(backend->Write(offset, buffer.data(), size, option));
+    if (write_back && option.HasFlushFlag()) {
+        write_back->Flush();
+    }
+    R_SUCCEED();
 }
 
 Result IFile::Flush() {
     LOG_DEBUG(Service_FS, "called");
 
-    R_RETURN(backend->Flush());
+    R_TRY(backend->Flush());
+    if (write_back) {
+        write_back->Flush();
+    }
+    R_SUCCEED();
 }
 
 Result IFile::SetSize(s64 size) {
@@ -6,16 +6,21 @@
 #include "core/file_sys/fsa/fs_i_file.h"
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+#include "core/hle/service/filesystem/fsp/fs_write_back.h"
 #include "core/hle/service/service.h"
 
 namespace Service::FileSystem {
 
 class IFile final : public ServiceFramework<IFile> {
 public:
-    explicit IFile(Core::System& system_, FileSys::VirtualFile file_);
+    explicit IFile(Core::System& system_, FileSys::VirtualFile file_, bool write_back_ = false,
+                   bool read_ahead_ = true);
 
 private:
+    std::shared_ptr<WriteBackFile> write_back;
     std::unique_ptr<FileSys::Fsa::IFile> backend;
+    ReadAheadFile read_ahead;
 
     Result Read(FileSys::ReadOption option, Out<s64> out_size, s64 offset,
                 const OutBuffer<BufferAttr_HipcMapAlias | BufferAttr_HipcMapTransferAllowsNonSecure>
@@ -7,13 +7,16 @@
 #include "core/hle/service/filesystem/fsp/fs_i_directory.h"
 #include "core/hle/service/filesystem/fsp/fs_i_file.h"
 #include "core/hle/service/filesystem/fsp/fs_i_filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_write_back.h"
 
 namespace Service::FileSystem {
 
-IFileSystem::IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_)
+IFileSystem::IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_,
+                         bool write_back_)
     : ServiceFramework{system_, "IFileSystem"}, backend{std::make_unique<FileSys::Fsa::IFileSystem>(
                                                     dir_)},
-      size_getter{std::move(size_getter_)} {
+      size_getter{std::move(size_getter_)}, write_back{write_back_},
+      is_read_only{dir_ == nullptr || !dir_->IsWritable()} {
     static const FunctionInfo functions[] = {
         {0, D<&IFileSystem::CreateFile>, "CreateFile"},
         {1, D<&IFileSystem::DeleteFile>, "DeleteFile"},
@@ -46,6 +49,7 @@ Result IFileSystem::CreateFile(const InLargeData<FileSys::Sf::Path, BufferAttr_H
 Result IFileSystem::DeleteFile(const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. file={}", path->str);
 
+    FlushWriteBackFile(FileSys::Path(path->str));
     R_RETURN(backend->DeleteFile(FileSys::Path(path->str)));
 }
 
@@ -60,6 +64,7 @@ Result IFileSystem::DeleteDirectory(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. directory={}", path->str);
 
+    FlushWriteBackDirectory(FileSys::Path(path->str));
     R_RETURN(backend->DeleteDirectory(FileSys::Path(path->str)));
 }
 
@@ -67,6 +72,7 @@ Result IFileSystem::DeleteDirectoryRecursively(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. directory={}", path->str);
 
+    FlushWriteBackDirectory(FileSys::Path(path->str));
     R_RETURN(backend->DeleteDirectoryRecursively(FileSys::Path(path->str)));
 }
 
@@ -74,6 +80,7 @@ Result IFileSystem::CleanDirectoryRecursively(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. Directory: {}", path->str);
 
+    FlushWriteBackDirectory(FileSys::Path(path->str));
     R_RETURN(backend->CleanDirectoryRecursively(FileSys::Path(path->str)));
 }
 
@@ -82,7 +89,16 @@ Result IFileSystem::RenameFile(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> new_path) {
     LOG_DEBUG(Service_FS, "called. file '{}' to file '{}'", old_path->str, new_path->str);
 
-    R_RETURN(backend->RenameFile(FileSys::Path(old_path->str), FileSys::Path(new_path->str)));
+    const auto host_path = FlushWriteBackFile(FileSys::Path(old_path->str));
+    R_TRY(backend->RenameFile(FileSys::Path(old_path->str), FileSys::Path(new_path->str)));
+
+    // Open handles still refer to the old path, point them to the renamed file
+    FileSys::VirtualFile new_file{};
+    if (!host_path.empty() && R_SUCCEEDED(backend->OpenFile(&new_file, FileSys::Path(new_path->str),
+                                                            FileSys::OpenMode::ReadWrite))) {
+        RenameWriteBackFile(host_path, std::move(new_file));
+    }
+    R_SUCCEED();
 }
 
 Result IFileSystem::OpenFile(OutInterface<IFile> out_interface,
@@ -94,7 +110,8 @@ Result IFileSystem::OpenFile(OutInterface<IFile> out_interface,
     R_TRY(backend->OpenFile(&vfs_file, FileSys::Path(path->str),
                             static_cast<FileSys::OpenMode>(mode)));
 
-    *out_interface = std::make_shared<IFile>(system, vfs_file);
+    // Files of a writable filesystem may be written through another handle, don't read ahead
+    *out_interface = std::make_shared<IFile>(system, vfs_file, write_back, is_read_only);
     R_SUCCEED();
 }
 
@@ -103,6 +120,7 @@ Result IFileSystem::OpenDirectory(OutInterface<IDirectory> out_interface,
                                   u32 mode) {
     LOG_DEBUG(Service_FS, "called. directory={}, mode={}", path->str, mode);
 
+    FlushWriteBackDirectory(FileSys::Path(path->str));
     FileSys::VirtualDir vfs_dir{};
     R_TRY(backend->OpenDirectory(&vfs_dir, FileSys::Path(path->str),
                                  static_cast<FileSys::OpenDirectoryMode>(mode)));
@@ -124,8 +142,11 @@ Result IFileSystem::GetEntryType(
 }
 
 Result IFileSystem::Commit() {
-    LOG_WARNING(Service_FS, "(STUBBED) called");
+    LOG_DEBUG(Service_FS, "called");
 
+    if (write_back) {
+        FlushWriteBackFiles();
+    }
     R_SUCCEED();
 }
 
@@ -170,4 +191,25 @@ Result IFileSystem::GetFileSystemAttribute(Out<FileSys::FileSystemAttribute> out
     R_SUCCEED();
 }
 
+std::string IFileSystem::FlushWriteBackFile(const FileSys::Path& path) {
+    // Buffered writes have to reach the host before the file is moved or deleted
+    FileSys::VirtualFile file{};
+    if (!write_back || R_FAILED(backend->OpenFile(&file, path, FileSys::OpenMode::Read))) {
+        return {};
+    }
+
+    auto host_path = file->GetFullPath();
+    FlushWriteBackFiles(host_path);
+    return host_path;
+}
+
+void IFileSystem::FlushWriteBackDirectory(const FileSys::Path& path) {
+    // Likewise for the files below a directory before it is deleted or listed
+    FileSys::VirtualDir dir{};
+    if (write_back &&
+        R_SUCCEEDED(backend->OpenDirectory(&dir, path, FileSys::OpenDirectoryMode::All))) {
+        FlushWriteBackFiles(dir->GetFullPath());
+    }
+}
+
 } // namespace Service::FileSystem
@@ -23,7 +23,8 @@ class IDirectory;
 
 class IFileSystem final : public ServiceFramework<IFileSystem> {
 public:
-    explicit IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_);
+    explicit IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_,
+                         bool write_back_ = false);
 
     Result CreateFile(const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path, s32 option,
                       s64 size);
@@ -53,8 +54,16 @@ public:
     Result GetFileSystemAttribute(Out<FileSys::FileSystemAttribute> out_attribute);
 
 private:
+    /// Writes back the buffered writes to the file, returning its host path if it exists
+    std::string FlushWriteBackFile(const FileSys::Path& path);
+    void FlushWriteBackDirectory(const FileSys::Path& path);
+
     std::unique_ptr<FileSys::Fsa::IFileSystem> backend;
     SizeGetter size_getter;
+    /// Whether files are opened through the write back cache, used for save data
+    bool write_back;
+    /// Whether no file of the filesystem can be written, which allows reading them ahead
+    bool is_read_only;
 };
 
 } // namespace Service::FileSystem
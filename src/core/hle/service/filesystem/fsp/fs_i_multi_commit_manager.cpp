@@ -4,6 +4,7 @@
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/fsp/fs_i_filesystem.h"
 #include "core/hle/service/filesystem/fsp/fs_i_multi_commit_manager.h"
+#include "core/hle/service/filesystem/fsp/fs_write_back.h"
 
 namespace Service::FileSystem {
 
@@ -27,6 +28,7 @@ Result IMultiCommitManager::Add(std::shared_ptr<IFileSystem> filesystem) {
 Result IMultiCommitManager::Commit() {
     LOG_WARNING(Service_FS, "(STUBBED) called");
 
+    FlushWriteBackFiles();
     R_SUCCEED();
 }
 
@@ -7,8 +7,10 @@
 
 namespace Service::FileSystem {
 
-IStorage::IStorage(Core::System& system_, FileSys::VirtualFile backend_)
-    : ServiceFramework{system_, "IStorage"}, backend(std::move(backend_)) {
+IStorage::IStorage(Core::System& system_, FileSys::VirtualFile backend_,
+                   std::shared_ptr<RomFsAccessTrace> trace_)
+    : ServiceFramework{system_, "IStorage"}, backend(std::move(backend_)), read_ahead{backend},
+      trace{std::move(trace_)} {
     static const FunctionInfo functions[] = {
         {0, D<&IStorage::Read>, "Read"},
         {1, nullptr, "Write"},
@@ -18,6 +20,10 @@ IStorage::IStorage(Core::System& system_, FileSys::VirtualFile backend_)
         {5, nullptr, "OperateRange"},
     };
     RegisterHandlers(functions);
+
+    if (trace) {
+        read_ahead.Prefetch(trace->TakePrefetchRanges());
+    }
 }
 
 Result IStorage::Read(
@@ -28,8 +34,12 @@ Result IStorage::Read(
     R_UNLESS(length >= 0, FileSys::ResultInvalidSize);
     R_UNLESS(offset >= 0, FileSys::ResultInvalidOffset);
 
+    if (trace) {
+        trace->Record(offset, length);
+    }
+
     // Read the data from the Storage backend
-    backend->Read(out_bytes.data(), length, offset);
+    read_ahead.Read(out_bytes.data(), length, offset);
 
     R_SUCCEED();
 }
@@ -6,16 +6,21 @@
 #include "core/file_sys/vfs/vfs.h"
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_access_trace.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
 #include "core/hle/service/service.h"
 
 namespace Service::FileSystem {
 
 class IStorage final : public ServiceFramework<IStorage> {
 public:
-    explicit IStorage(Core::System& system_, FileSys::VirtualFile backend_);
+    explicit IStorage(Core::System& system_, FileSys::VirtualFile backend_,
+                      std::shared_ptr<RomFsAccessTrace> trace_ = nullptr);
 
 private:
     FileSys::VirtualFile backend;
+    ReadAheadFile read_ahead;
+    std::shared_ptr<RomFsAccessTrace> trace;
 
     Result Read(
         OutBuffer<BufferAttr_HipcMapAlias | BufferAttr_HipcMapTransferAllowsNonSecure> out_bytes,
@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common/literals.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+
+namespace Service::FileSystem {
+
+namespace {
+/// Number of back to back sequential reads before reading ahead
+constexpr u32 SequentialReadsBeforeReadAhead = 2;
+
+/// Minimum amount of data read ahead, larger requests read ahead twice their size
+constexpr size_t MinReadAheadSize = 1_MiB;
+
+/// Upper bound for a request's read ahead window
+constexpr size_t MaxReadAheadSize = 8_MiB;
+
+/// Largest single read issued while prefetching
+constexpr u64 PrefetchChunkSize = 1_MiB;
+
+/// How long the prefetch worker waits for the guest to read a chunk before dropping the oldest
+constexpr auto PrefetchEvictionDelay = std::chrono::seconds{1};
+
+// Storage chains such as the AES-CTR layers of an NCA keep unlocked state, and files opened by
+// different sessions can share them. Every read issued by fsp and by the read ahead worker goes
+// through this lock so that the worker never races the fsp service thread. Only fsp takes it,
+// readers outside fsp that share a storage chain are no more serialized against the worker
+// than they already were against the fsp service thread.
+std::mutex& IoLock() {
+    static std::mutex lock;
+    return lock;
+}
+
+Common::ThreadWorker& Worker() {
+    static Common::ThreadWorker worker(1, "FSReadAhead");
+    return worker;
+}
+
+// Prefetches are queued up front in bulk, keep them from delaying read ahead requests
+Common::ThreadWorker& PrefetchWorker() {
+    static Common::ThreadWorker worker(1, "FSPrefetch");
+    return worker;
+}
+} // Anonymous namespace
+
+struct ReadAheadFile::Buffer {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool pending{};
+    size_t offset{};
+    std::vector<u8> data;
+};
+
+struct ReadAheadFile::Prefetched {
+    struct Chunk {
+        std::vector<u8> data;
+        u64 sequence;
+    };
+
+    /// Reads a chunk into memory, runs on the prefetch worker
+    void Fetch(const FileSys::VirtualFile& file, size_t offset, size_t size) {
+        const size_t end{offset + size};
+        {
+            // Don't run further ahead of the guest than the memory bound allows
+            std::unique_lock lk{mutex};
+            while (!cancelled && !WasReadLocked(offset, end) &&
+                   resident_size + size > MaxPrefetchedSize) {
+                if (cv.wait_for(lk, PrefetchEvictionDelay) == std::cv_status::timeout) {
+                    EvictOldestLocked();
+                }
+            }
+            if (cancelled || WasReadLocked(offset, end)) {
+                FinishChunkLocked();
+                return;
+            }
+        }
+
+        std::vector<u8> storage;
+        {
+            std::scoped_lock io_lk{IoLock()};
+            const size_t file_size{file->GetSize()};
+            storage.resize(offset < file_size ? std::min(size, file_size - offset) : 0);
+            storage.resize(file->Read(storage.data(), storage.size(), offset));
+        }
+
+        std::scoped_lock lk{mutex};
+        if (!storage.empty() && !WasReadLocked(offset, end)) {
+            auto& chunk = chunks[offset];
+            resident_size += storage.size() - chunk.data.size();
+            chunk.data = std::move(storage);
+            chunk.sequence = next_sequence++;
+        }
+        FinishChunkLocked();
+    }
+
+    /// Remembers a guest read that was not served from memory, so that it is not prefetched
+    void RecordGuestRead(size_t offset, size_t end) {
+        std::unique_lock lk{mutex};
+        if (pending_chunks == 0 || offset >= end) {
+            return;
+        }
+
+        auto it = guest_reads.upper_bound(offset);
+        if (it != guest_reads.begin() && std::prev(it)->second >= offset) {
+            --it;
+            offset = it->first;
+        }
+        while (it != guest_reads.end() && it->first <= end) {
+            end = std::max(end, it->second);
+            it = guest_reads.erase(it);
+        }
+        guest_reads.emplace(offset, end);
+
+        // Chunks the guest has read past are not going to be needed either
+        bool released{};
+        for (auto chunk = chunks.lower_bound(offset);
+             chunk != chunks.end() && chunk->first + chunk->second.data.size() <= end;) {
+            resident_size -= chunk->second.data.size();
+            chunk = chunks.erase(chunk);
+            released = true;
+        }
+        lk.unlock();
+
+        if (released) {
+            cv.notify_all();
+        }
+    }
+
+    bool WasReadLocked(size_t offset, size_t end) const {
+        auto it = guest_reads.upper_bound(offset);
+        return it != guest_reads.begin() && std::prev(it)->second >= end;
+    }
+
+    void EvictOldestLocked() {
+        const auto oldest = std::ranges::min_element(
+            chunks, {}, [](const auto& pair) { return pair.second.sequence; });
+        if (oldest != chunks.end()) {
+            resident_size -= oldest->second.data.size();
+            chunks.erase(oldest);
+        }
+    }
+
+    void FinishChunkLocked() {
+        if (--pending_chunks == 0) {
+            guest_reads.clear();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    /// Prefetched chunks keyed by their offset, in the order they were read by their sequence
+    std::map<size_t, Chunk> chunks;
+    size_t resident_size{};
+    u64 next_sequence{};
+    /// Number of chunks queued on the worker and not read yet
+    size_t pending_chunks{};
+    /// Merged ranges the guest read while chunks were pending, keyed by their start
+    std::map<size_t, size_t> guest_reads;
+    bool cancelled{};
+};
+
+ReadAheadFile::ReadAheadFile(FileSys::VirtualFile file_, bool allow_read_ahead)
+    : file{std::move(file_)} {
+    if (allow_read_ahead && file && !file->IsWritable()) {
+        buffer = std::make_shared<Buffer>();
+    }
+}
+
+ReadAheadFile::~ReadAheadFile() {
+    if (prefetched) {
+        {
+            std::scoped_lock lk{prefetched->mutex};
+            prefetched->cancelled = true;
+        }
+        prefetched->cv.notify_all();
+    }
+}
+
+size_t ReadAheadFile::Read(u8* data, size_t length, size_t offset) {
+    if (!buffer) {
+        std::scoped_lock io_lk{IoLock()};
+        return file->Read(data, length, offset);
+    }
+
+    size_t read_size{};
+    bool is_buffered{};
+    const bool is_prefetched{prefetched && this->ReadPrefetched(data, length, offset)};
+    if (is_prefetched) {
+        read_size = length;
+        is_buffered = true;
+    } else {
+        std::unique_lock lk{buffer->mutex};
+        buffer->cv.wait(lk, [this] { return !buffer->pending; });
+        const size_t buffer_end{buffer->offset + buffer->data.size()};
+        if (length != 0 && offset >= buffer->offset && offset + length <= buffer_end) {
+            std::memcpy(data, buffer->data.data() + (offset - buffer->offset), length);
+            read_size = length;
+            is_buffered = true;
+        }
+    }
+    if (!is_buffered) {
+        std::scoped_lock io_lk{IoLock()};
+        read_size = file->Read(data, length, offset);
+    }
+    if (prefetched && !is_prefetched) {
+        prefetched->RecordGuestRead(offset, offset + read_size);
+    }
+
+    if (offset == next_offset) {
+        ++sequential_reads;
+    } else {
+        sequential_reads = 0;
+    }
+    next_offset = offset + read_size;
+
+    if (!is_prefetched && read_size == length &&
+        sequential_reads >= SequentialReadsBeforeReadAhead) {
+        this->StartReadAhead(length);
+    }
+    return read_size;
+}
+
+void ReadAheadFile::Prefetch(std::vector<AccessRange> ranges) {
+    if (!buffer || ranges.empty()) {
+        return;
+    }
+    if (!prefetched) {
+        prefetched = std::make_shared<Prefetched>();
+    }
+
+    // Split the ranges into chunks so that guest reads never wait long on the IO lock
+    for (const auto& range : ranges) {
+        for (u64 offset = range.offset; offset < range.offset + range.size;
+             offset += PrefetchChunkSize) {
+            const u64 size{std::min<u64>(PrefetchChunkSize, range.offset + range.size - offset)};
+            {
+                std::scoped_lock lk{prefetched->mutex};
+                ++prefetched->pending_chunks;
+            }
+            PrefetchWorker().QueueWork([prefetched = prefetched, file = file, offset, size] {
+                prefetched->Fetch(file, offset, size);
+            });
+        }
+    }
+}
+
+bool ReadAheadFile::ReadPrefetched(u8* data, size_t length, size_t offset) {
+    std::unique_lock lk{prefetched->mutex};
+    auto& chunks = prefetched->chunks;
+    auto it = chunks.upper_bound(offset);
+    if (length == 0 || it == chunks.begin()) {
+        return false;
+    }
+    --it;
+
+    // Reads may span several consecutive chunks, all of which must be there
+    const size_t end{offset + length};
+    size_t pos{offset};
+    for (auto chunk = it; pos < end; ++chunk) {
+        if (chunk == chunks.end() || chunk->first > pos ||
+            chunk->first + chunk->second.data.size() <= pos) {
+            return false;
+        }
+        pos = chunk->first + chunk->second.data.size();
+    }
+
+    bool released{};
+    for (pos = offset; pos < end;) {
+        const auto& chunk_data = it->second.data;
+        const size_t chunk_end{it->first + chunk_data.size()};
+        const size_t copy_size{std::min(chunk_end, end) - pos};
+        std::memcpy(data + (pos - offset), chunk_data.data() + (pos - it->first), copy_size);
+        pos += copy_size;
+        if (chunk_end <= end) {
+            prefetched->resident_size -= chunk_data.size();
+            it = chunks.erase(it);
+            released = true;
+        } else {
+            ++it;
+        }
+    }
+    lk.unlock();
+
+    if (released) {
+        prefetched->cv.notify_all();
+    }
+    return true;
+}
+
+void ReadAheadFile::WaitForPrefetch() {
+    PrefetchWorker().WaitForRequests();
+}
+
+void ReadAheadFile::StartReadAhead(size_t length) {
+    std::vector<u8> storage;
+    {
+        std::scoped_lock lk{buffer->mutex};
+        // Keep using the current window until the next request of this size would not fit in it.
+        if (next_offset + length <= buffer->offset + buffer->data.size()) {
+            return;
+        }
+        buffer->pending = true;
+        storage = std::move(buffer->data);
+    }
+
+    const size_t window{std::clamp(length * 2, MinReadAheadSize, MaxReadAheadSize)};
+    Worker().QueueWork([buffer = buffer, file = file, offset = next_offset, window,
+                        storage = std::move(storage)]() mutable {
+        size_t read_size{};
+        {
+            std::scoped_lock io_lk{IoLock()};
+            const size_t file_size{file->GetSize()};
+            storage.resize(offset < file_size ? std::min(window, file_size - offset) : 0);
+            read_size = file->Read(storage.data(), storage.size(), offset);
+        }
+        storage.resize(read_size);
+        {
+            std::scoped_lock lk{buffer->mutex};
+            buffer->offset = offset;
+            buffer->data = std::move(storage);
+            buffer->pending = false;
+        }
+        buffer->cv.notify_all();
+    });
+}
+
+} // namespace Service::FileSystem
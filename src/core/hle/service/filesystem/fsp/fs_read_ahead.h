@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace Service::FileSystem {
+
+using namespace Common::Literals;
+
+/// A range of a file or storage read by the guest
+struct AccessRange {
+    u64 offset;
+    u64 size;
+};
+
+/**
+ * Wraps a file read through fsp, detecting sequential access and then reading ahead into a
+ * buffer on a worker thread. This lets large streaming reads overlap with emulation instead of
+ * stalling the guest thread waiting on the request. Files are only read ahead when they are
+ * read-only and the caller knows no other handle can write them, such as files of a read-only
+ * filesystem. Changes made to the host file behind the emulator's back are not observed.
+ */
+class ReadAheadFile {
+public:
+    /// Files that may be written through other handles must pass allow_read_ahead as false
+    explicit ReadAheadFile(FileSys::VirtualFile file_, bool allow_read_ahead = true);
+    ~ReadAheadFile();
+
+    ReadAheadFile(const ReadAheadFile&) = delete;
+    ReadAheadFile& operator=(const ReadAheadFile&) = delete;
+
+    /// Reads from the file, returning the number of bytes read
+    size_t Read(u8* data, size_t length, size_t offset);
+
+    /**
+     * Reads the given ranges into memory on the worker thread, in order, in chunks. A chunk is
+     * released once the guest has read up to its end. At most MaxPrefetchedSize bytes are kept in
+     * memory, the worker waits for the guest to catch up beyond that, and drops the oldest chunks
+     * when the guest does not read them in time.
+     */
+    void Prefetch(std::vector<AccessRange> ranges);
+
+    /// Waits until every queued prefetch has been read or dropped
+    static void WaitForPrefetch();
+
+    static constexpr size_t MaxPrefetchedSize = 32_MiB;
+
+private:
+    struct Buffer;
+    struct Prefetched;
+
+    bool ReadPrefetched(u8* data, size_t length, size_t offset);
+
+    void StartReadAhead(size_t length);
+
+    FileSys::VirtualFile file;
+    std::shared_ptr<Buffer> buffer;
+    std::shared_ptr<Prefetched> prefetched;
+    size_t next_offset{};
+    u32 sequential_reads{};
+};
+
+} // namespace Service::FileSystem
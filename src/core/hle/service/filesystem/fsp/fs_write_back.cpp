@@ -0,0 +1,356 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/thread_worker.h"
+#include "core/hle/service/filesystem/fsp/fs_write_back.h"
+
+namespace Service::FileSystem {
+
+namespace {
+using namespace Common::Literals;
+
+/// Amount of dirty data a file may accumulate before it is written back
+constexpr size_t MaxDirtySize = 4_MiB;
+
+/// Non-overlapping runs of file data keyed by their offset
+using RunMap = std::map<size_t, std::vector<u8>>;
+
+size_t RunsEnd(const RunMap& runs) {
+    if (runs.empty()) {
+        return 0;
+    }
+    const auto& [offset, data] = *runs.rbegin();
+    return offset + data.size();
+}
+
+void InsertRun(RunMap& runs, const u8* data, size_t length, size_t offset) {
+    const size_t end{offset + length};
+    auto it = runs.upper_bound(offset);
+    if (it != runs.begin()) {
+        const auto prev = std::prev(it);
+        if (prev->first + prev->second.size() >= offset) {
+            it = prev;
+        }
+    }
+
+    // Appends and rewrites within a single run extend it in place
+    if (it != runs.end() && it->first <= offset) {
+        const auto next = std::next(it);
+        if (next == runs.end() || next->first >= end) {
+            auto& run = it->second;
+            run.resize(std::max(run.size(), end - it->first));
+            std::memcpy(run.data() + (offset - it->first), data, length);
+            return;
+        }
+    }
+
+    // Otherwise merge every run the new data overlaps or touches
+    size_t merged_begin{offset};
+    size_t merged_end{end};
+    auto last = it;
+    for (; last != runs.end() && last->first <= end; ++last) {
+        merged_begin = std::min(merged_begin, last->first);
+        merged_end = std::max(merged_end, last->first + last->second.size());
+    }
+    std::vector<u8> merged(merged_end - merged_begin);
+    for (auto run = it; run != last; ++run) {
+        std::memcpy(merged.data() + (run->first - merged_begin), run->second.data(),
+                    run->second.size());
+    }
+    std::memcpy(merged.data() + (offset - merged_begin), data, length);
+    runs.erase(it, last);
+    runs.emplace(merged_begin, std::move(merged));
+}
+
+void OverlayRuns(const RunMap& runs, u8* data, size_t length, size_t offset) {
+    const size_t end{offset + length};
+    auto it = runs.upper_bound(offset);
+    if (it != runs.begin()) {
+        --it;
+    }
+    for (; it != runs.end() && it->first < end; ++it) {
+        const size_t begin{std::max(it->first, offset)};
+        const size_t run_end{std::min(it->first + it->second.size(), end)};
+        if (begin < run_end) {
+            std::memcpy(data + (begin - offset), it->second.data() + (begin - it->first),
+                        run_end - begin);
+        }
+    }
+}
+
+void WriteRuns(const FileSys::VirtualFile& file, const RunMap& runs) {
+    for (const auto& [offset, data] : runs) {
+        const size_t written{file->Write(data.data(), data.size(), offset)};
+        if (written != data.size()) {
+            LOG_ERROR(Service_FS, "Could not write back {} bytes at 0x{:X} to {}", data.size(),
+                      offset, file->GetFullPath());
+        }
+    }
+}
+
+Common::ThreadWorker& Worker() {
+    static Common::ThreadWorker worker(1, "FSWriteBack");
+    return worker;
+}
+} // Anonymous namespace
+
+struct WriteBackEntry {
+    ~WriteBackEntry() {
+        // Nothing is in flight once the last reference is gone, write back anything left over
+        if (file->IsWritable()) {
+            WriteRuns(file, flushing);
+            WriteRuns(file, dirty);
+        }
+    }
+
+    /// Moves the dirty data to the worker, waiting for a previous write back to finish first
+    void StartWriteBack(const std::shared_ptr<WriteBackEntry>& self) {
+        FileSys::VirtualFile target;
+        {
+            std::unique_lock lk{mutex};
+            if (dirty.empty()) {
+                return;
+            }
+            cv.wait(lk, [this] { return !writing; });
+            flushing = std::move(dirty);
+            dirty.clear();
+            dirty_size = 0;
+            writing = true;
+            target = file;
+        }
+        Worker().QueueWork([self, target = std::move(target)] {
+            // flushing is not modified while writing is set, so it can be read without the lock
+            WriteRuns(target, self->flushing);
+            {
+                std::scoped_lock lk{self->mutex};
+                self->flushing.clear();
+                self->writing = false;
+            }
+            self->cv.notify_all();
+        });
+    }
+
+    void WaitForWriteBack() {
+        std::unique_lock lk{mutex};
+        cv.wait(lk, [this] { return !writing; });
+    }
+
+    void Flush(const std::shared_ptr<WriteBackEntry>& self) {
+        StartWriteBack(self);
+        WaitForWriteBack();
+    }
+
+    size_t GetSizeLocked() const {
+        return std::max({file->GetSize(), RunsEnd(flushing), RunsEnd(dirty)});
+    }
+
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    /// Host file shared by every handle, writable as soon as any handle is
+    FileSys::VirtualFile file;
+    RunMap dirty;
+    size_t dirty_size{};
+    /// Data being written back by the worker
+    RunMap flushing;
+    bool writing{};
+};
+
+namespace {
+std::mutex entries_mutex;
+std::unordered_map<std::string, std::weak_ptr<WriteBackEntry>> entries;
+
+bool IsWithin(std::string_view path, std::string_view parent) {
+    if (parent.empty()) {
+        return true;
+    }
+    return path.starts_with(parent) &&
+           (path.size() == parent.size() || parent.ends_with('/') || path[parent.size()] == '/');
+}
+
+std::vector<std::shared_ptr<WriteBackEntry>> GetOpenEntries(std::string_view path) {
+    std::vector<std::shared_ptr<WriteBackEntry>> open_entries;
+    std::scoped_lock lk{entries_mutex};
+    for (const auto& [entry_path, weak_entry] : entries) {
+        if (!IsWithin(entry_path, path)) {
+            continue;
+        }
+        if (auto entry = weak_entry.lock()) {
+            open_entries.push_back(std::move(entry));
+        }
+    }
+    return open_entries;
+}
+
+void FlushEntries(const std::vector<std::shared_ptr<WriteBackEntry>>& open_entries) {
+    for (const auto& entry : open_entries) {
+        entry->StartWriteBack(entry);
+    }
+    for (const auto& entry : open_entries) {
+        entry->WaitForWriteBack();
+    }
+}
+} // Anonymous namespace
+
+WriteBackFile::WriteBackFile(FileSys::VirtualFile file_)
+    : writable{file_->IsWritable()}, readable{file_->IsReadable()} {
+    const auto path = file_->GetFullPath();
+    {
+        std::scoped_lock lk{entries_mutex};
+        std::erase_if(entries, [](const auto& pair) { return pair.second.expired(); });
+        auto& weak_entry = entries[path];
+        entry = weak_entry.lock();
+        if (!entry) {
+            entry = std::make_shared<WriteBackEntry>();
+            entry->file = file_;
+            weak_entry = entry;
+            return;
+        }
+    }
+
+    // Buffered data can only be written back through a writable handle
+    std::scoped_lock lk{entry->mutex};
+    if (writable && !entry->file->IsWritable()) {
+        entry->file = std::move(file_);
+    }
+}
+
+WriteBackFile::~WriteBackFile() {
+    entry->StartWriteBack(entry);
+}
+
+FileSys::VirtualFile WriteBackFile::GetHostFile() const {
+    std::scoped_lock lk{entry->mutex};
+    return entry->file;
+}
+
+std::string WriteBackFile::GetName() const {
+    return GetHostFile()->GetName();
+}
+
+std::size_t WriteBackFile::GetSize() const {
+    std::scoped_lock lk{entry->mutex};
+    return entry->GetSizeLocked();
+}
+
+bool WriteBackFile::Resize(std::size_t new_size) {
+    if (!writable) {
+        return false;
+    }
+    entry->Flush(entry);
+    return GetHostFile()->Resize(new_size);
+}
+
+FileSys::VirtualDir WriteBackFile::GetContainingDirectory() const {
+    return GetHostFile()->GetContainingDirectory();
+}
+
+bool WriteBackFile::IsWritable() const {
+    return writable;
+}
+
+bool WriteBackFile::IsReadable() const {
+    return readable;
+}
+
+std::size_t WriteBackFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    std::scoped_lock lk{entry->mutex};
+    const size_t size{entry->GetSizeLocked()};
+    if (offset >= size) {
+        return 0;
+    }
+    length = std::min(length, size - offset);
+
+    // Buffered writes may extend the file past its size on the host
+    const auto& file = entry->file;
+    const size_t host_size{file->GetSize()};
+    const size_t read_size{offset < host_size ? file->Read(data, length, offset) : 0};
+    std::memset(data + read_size, 0, length - read_size);
+    OverlayRuns(entry->flushing, data, length, offset);
+    OverlayRuns(entry->dirty, data, length, offset);
+    return length;
+}
+
+std::size_t WriteBackFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    if (!writable) {
+        return 0;
+    }
+    if (length == 0) {
+        return 0;
+    }
+
+    bool is_full{};
+    {
+        std::scoped_lock lk{entry->mutex};
+        InsertRun(entry->dirty, data, length, offset);
+        entry->dirty_size += length;
+        is_full = entry->dirty_size >= MaxDirtySize;
+    }
+    if (is_full) {
+        entry->StartWriteBack(entry);
+    }
+    return length;
+}
+
+bool WriteBackFile::Rename(std::string_view name) {
+    entry->Flush(entry);
+
+    const auto file = GetHostFile();
+    const auto old_path = file->GetFullPath();
+    if (!file->Rename(name)) {
+        return false;
+    }
+
+    // The host file may keep pointing at the old path, look the renamed file up again
+    const auto parent = file->GetContainingDirectory();
+    auto new_file = parent != nullptr ? parent->GetFile(name) : nullptr;
+    RenameWriteBackFile(old_path, new_file != nullptr ? std::move(new_file) : file);
+    return true;
+}
+
+std::string WriteBackFile::GetFullPath() const {
+    return GetHostFile()->GetFullPath();
+}
+
+void WriteBackFile::Flush() {
+    entry->StartWriteBack(entry);
+}
+
+void FlushWriteBackFiles() {
+    FlushWriteBackFiles("");
+}
+
+void FlushWriteBackFiles(std::string_view path) {
+    FlushEntries(GetOpenEntries(path));
+}
+
+void RenameWriteBackFile(std::string_view old_path, FileSys::VirtualFile new_file) {
+    std::scoped_lock lk{entries_mutex};
+    const auto it = entries.find(std::string(old_path));
+    if (it == entries.end()) {
+        return;
+    }
+    const auto entry = it->second.lock();
+    entries.erase(it);
+    if (!entry) {
+        return;
+    }
+
+    {
+        std::scoped_lock entry_lk{entry->mutex};
+        entry->file = new_file;
+    }
+    entries.insert_or_assign(new_file->GetFullPath(), entry);
+}
+
+} // namespace Service::FileSystem
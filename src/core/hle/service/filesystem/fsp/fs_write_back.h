@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs.h"
+
+namespace Service::FileSystem {
+
+struct WriteBackEntry;
+
+/**
+ * Wraps a file opened through a save data filesystem, coalescing guest writes in memory and
+ * writing them back to the host file on a worker thread. Titles that autosave through many small
+ * writes would otherwise stall the service thread on host IO for every one of them.
+ *
+ * Handles to the same host file share their buffered data, so reads through any handle observe
+ * every write. Dirty data is written back when the guest flushes the file, when too much of it
+ * accumulates, and when the last handle to the file is closed. Commit waits for the host writes
+ * through FlushWriteBackFiles, so committed data is on the host before the guest is told so.
+ *
+ * The host file is shared by the handles as well, so that every handle follows the file when it
+ * is renamed through RenameWriteBackFile.
+ */
+class WriteBackFile final : public FileSys::VfsFile {
+public:
+    explicit WriteBackFile(FileSys::VirtualFile file_);
+    ~WriteBackFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    FileSys::VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+    std::string GetFullPath() const override;
+
+    /// Starts writing back the dirty data of this file without waiting for it
+    void Flush();
+
+private:
+    FileSys::VirtualFile GetHostFile() const;
+
+    std::shared_ptr<WriteBackEntry> entry;
+    bool writable;
+    bool readable;
+};
+
+/// Writes back the dirty data of every open save data file and waits for it to reach the host
+void FlushWriteBackFiles();
+
+/**
+ * Writes back the dirty data of the open save data files at the given host path, or below it when
+ * it is a directory, and waits for it to reach the host.
+ */
+void FlushWriteBackFiles(std::string_view path);
+
+/// Points the handles open at old_path to the file it was renamed to
+void RenameWriteBackFile(std::string_view old_path, FileSys::VirtualFile new_file);
+
+} // namespace Service::FileSystem
@@ -29,6 +29,7 @@
 #include "core/hle/result.h"
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_access_trace.h"
 #include "core/hle/service/filesystem/fsp/fs_i_filesystem.h"
 #include "core/hle/service/filesystem/fsp/fs_i_multi_commit_manager.h"
 #include "core/hle/service/filesystem/fsp/fs_i_save_data_info_reader.h"
@@ -270,8 +271,8 @@ Result FSP_SRV::OpenSaveDataFileSystem(OutInterface<IFileSystem> out_interface,
         ASSERT(false);
     }
 
-    *out_interface =
-        std::make_shared<IFileSystem>(system, std::move(dir), SizeGetter::FromStorageId(fsc, id));
+    *out_interface = std::make_shared<IFileSystem>(system, std::move(dir),
+                                                   SizeGetter::FromStorageId(fsc, id), true);
 
     R_SUCCEED();
 }
@@ -406,9 +407,10 @@ Result FSP_SRV::OpenDataStorageByCurrentProcess(OutInterface<IStorage> out_inter
         }
 
         romfs = current_romfs;
+        romfs_trace = std::make_shared<RomFsAccessTrace>(program_id, romfs);
     }
 
-    *out_interface = std::make_shared<IStorage>(system, romfs);
+    *out_interface = std::make_shared<IStorage>(system, romfs, romfs_trace);
 
     R_SUCCEED();
 }
@@ -27,6 +27,7 @@ class IFileSystem;
 class ISaveDataInfoReader;
 class ISaveDataTransferProhibiter;
 class IStorage;
+class RomFsAccessTrace;
 class IMultiCommitManager;
 
 enum class AccessLogVersion : u32 {
@@ -112,6 +113,7 @@ private:
     const Core::Reporter& reporter;
 
     FileSys::VirtualFile romfs;
+    std::shared_ptr<RomFsAccessTrace> romfs_trace;
     u64 current_process_id = 0;
     u32 access_log_program_index = 0;
     AccessLogMode access_log_mode = AccessLogMode::None;
@@ -152,9 +152,6 @@ void HLERequestContext::ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming) {
         }
         if (incoming) {
             // Populate the object lists with the data in the IPC request.
-            incoming_copy_handles.reserve(handle_descriptor_header->num_handles_to_copy);
-            incoming_move_handles.reserve(handle_descriptor_header->num_handles_to_move);
-
             for (u32 handle = 0; handle < handle_descriptor_header->num_handles_to_copy; ++handle) {
                 incoming_copy_handles.push_back(rp.Pop<Handle>());
             }
@@ -169,11 +166,6 @@ void HLERequestContext::ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming) {
         }
     }
 
-    buffer_x_descriptors.reserve(command_header->num_buf_x_descriptors);
-    buffer_a_descriptors.reserve(command_header->num_buf_a_descriptors);
-    buffer_b_descriptors.reserve(command_header->num_buf_b_descriptors);
-    buffer_w_descriptors.reserve(command_header->num_buf_w_descriptors);
-
     for (u32 i = 0; i < command_header->num_buf_x_descriptors; ++i) {
         buffer_x_descriptors.push_back(rp.PopRaw<IPC::BufferDescriptorX>());
     }
@@ -450,6 +442,34 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+std::span<u8> HLERequestContext::GetWriteBufferSpan(std::size_t buffer_index) const {
+    const std::size_t size{GetWriteBufferSize(buffer_index)};
+    if (size == 0) {
+        return {};
+    }
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    const VAddr address{is_buffer_b ? BufferDescriptorB()[buffer_index].Address()
+                                    : BufferDescriptorC()[buffer_index].Address()};
+    u8* const pointer{memory.GetSpan(address, size)};
+    if (pointer == nullptr) {
+        return {};
+    }
+    return {pointer, size};
+}
+
+void HLERequestContext::CommitWriteBuffer(std::size_t size, std::size_t buffer_index) const {
+    if (size == 0) {
+        return;
+    }
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    const VAddr address{is_buffer_b ? BufferDescriptorB()[buffer_index].Address()
+                                    : BufferDescriptorC()[buffer_index].Address()};
+    // The data bypassed the memory write path, let the GPU know about it
+    memory.StoreDataCache(address, std::min(size, GetWriteBufferSize(buffer_index)));
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
@@ -12,6 +12,9 @@
 #include <type_traits>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/concepts.h"
@@ -177,9 +180,10 @@ private:
 
 /**
  * Class containing information about an in-flight IPC request being handled by an HLE service
- * implementation.
+ * implementation. Requests are owned by shared pointers, so services can tell deferred requests
+ * apart from new requests reusing their address.
  */
-class HLERequestContext {
+class HLERequestContext : public std::enable_shared_from_this<HLERequestContext> {
 public:
     explicit HLERequestContext(Kernel::KernelCore& kernel, Core::Memory::Memory& memory,
                                Kernel::KServerSession* session, Kernel::KThread* thread);
@@ -233,20 +237,20 @@ public:
         return data_payload_offset;
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorX>& BufferDescriptorX() const {
-        return buffer_x_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorX> BufferDescriptorX() const {
+        return {buffer_x_descriptors.data(), buffer_x_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
-        return buffer_a_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorABW> BufferDescriptorA() const {
+        return {buffer_a_descriptors.data(), buffer_a_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
-        return buffer_b_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorABW> BufferDescriptorB() const {
+        return {buffer_b_descriptors.data(), buffer_b_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorC>& BufferDescriptorC() const {
-        return buffer_c_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorC> BufferDescriptorC() const {
+        return {buffer_c_descriptors.data(), buffer_c_descriptors.size()};
     }
 
     [[nodiscard]] const IPC::DomainMessageHeader& GetDomainMessageHeader() const {
@@ -281,6 +285,17 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /**
+     * Helper function to get the output buffer as a span of guest memory, to write to it without
+     * an intermediate copy. Empty when the buffer is not contiguous in host memory, it then has to
+     * be written with WriteBuffer. Data written to the span must be committed with
+     * CommitWriteBuffer.
+     */
+    [[nodiscard]] std::span<u8> GetWriteBufferSpan(std::size_t buffer_index = 0) const;
+
+    /// Helper function to commit the data written to the start of the span of the output buffer
+    void CommitWriteBuffer(std::size_t size, std::size_t buffer_index = 0) const;
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -399,22 +414,32 @@ private:
     Kernel::KHandleTable* client_handle_table{};
     Kernel::KThread* thread{};
 
-    std::vector<Handle> incoming_move_handles;
-    std::vector<Handle> incoming_copy_handles;
+    // Handle and buffer descriptor counts are 4-bit fields in the command header, so the parsed
+    // request fits in fixed inline storage and building a context does not touch the heap.
+    static constexpr size_t MaxDescriptors = 16;
+
+    template <typename T>
+    using DescriptorList = boost::container::static_vector<T, MaxDescriptors>;
+
+    template <typename T>
+    using OutgoingList = boost::container::small_vector<T, 4>;
+
+    DescriptorList<Handle> incoming_move_handles;
+    DescriptorList<Handle> incoming_copy_handles;
 
-    std::vector<Kernel::KAutoObject*> outgoing_move_objects;
-    std::vector<Kernel::KAutoObject*> outgoing_copy_objects;
-    std::vector<SessionRequestHandlerPtr> outgoing_domain_objects;
+    OutgoingList<Kernel::KAutoObject*> outgoing_move_objects;
+    OutgoingList<Kernel::KAutoObject*> outgoing_copy_objects;
+    OutgoingList<SessionRequestHandlerPtr> outgoing_domain_objects;
 
     std::optional<IPC::CommandHeader> command_header;
     std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
     std::optional<IPC::DataPayloadHeader> data_payload_header;
     std::optional<IPC::DomainMessageHeader> domain_message_header;
-    std::vector<IPC::BufferDescriptorX> buffer_x_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_a_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_b_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_w_descriptors;
-    std::vector<IPC::BufferDescriptorC> buffer_c_descriptors;
+    DescriptorList<IPC::BufferDescriptorX> buffer_x_descriptors;
+    DescriptorList<IPC::BufferDescriptorABW> buffer_a_descriptors;
+    DescriptorList<IPC::BufferDescriptorABW> buffer_b_descriptors;
+    DescriptorList<IPC::BufferDescriptorABW> buffer_w_descriptors;
+    DescriptorList<IPC::BufferDescriptorC> buffer_c_descriptors;
 
     u32_le command{};
     u64 pid{};
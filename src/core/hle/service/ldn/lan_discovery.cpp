@@ -364,6 +364,7 @@ void LANDiscovery::ResetStations() {
         station.Reset();
     }
     connected_clients.clear();
+    synced_clients.clear();
 }
 
 void LANDiscovery::UpdateNodes() {
@@ -377,8 +378,16 @@ void LANDiscovery::UpdateNodes() {
     }
     network_info.ldn.node_count = count + 1;
 
-    for (auto local_ip : connected_clients) {
-        SendPacket(Network::LDNPacketType::SyncNetwork, network_info, local_ip);
+    // Games republish unchanged advertise data at a high rate, only sync the clients when they
+    // would see a different network
+    const bool info_changed =
+        std::memcmp(&synced_network_info, &network_info, sizeof(NetworkInfo)) != 0;
+    if (info_changed || synced_clients != connected_clients) {
+        for (auto local_ip : connected_clients) {
+            SendPacket(Network::LDNPacketType::SyncNetwork, network_info, local_ip);
+        }
+        synced_network_info = network_info;
+        synced_clients = connected_clients;
     }
 
     OnNetworkInfoChanged();
@@ -421,56 +430,29 @@ Network::IPv4Address LANDiscovery::GetLocalIp() const {
 template <typename Data>
 void LANDiscovery::SendPacket(Network::LDNPacketType type, const Data& data,
                               Ipv4Address remote_ip) {
-    Network::LDNPacket packet;
-    packet.type = type;
-
-    packet.broadcast = false;
-    packet.local_ip = GetLocalIp();
-    packet.remote_ip = remote_ip;
-
-    packet.data.resize(sizeof(data));
-    std::memcpy(packet.data.data(), &data, sizeof(data));
-    SendPacket(packet);
+    SendPacket(type, remote_ip, false, std::as_bytes(std::span{&data, 1}));
 }
 
 void LANDiscovery::SendPacket(Network::LDNPacketType type, Ipv4Address remote_ip) {
-    Network::LDNPacket packet;
-    packet.type = type;
-
-    packet.broadcast = false;
-    packet.local_ip = GetLocalIp();
-    packet.remote_ip = remote_ip;
-
-    SendPacket(packet);
+    SendPacket(type, remote_ip, false, {});
 }
 
 template <typename Data>
 void LANDiscovery::SendBroadcast(Network::LDNPacketType type, const Data& data) {
-    Network::LDNPacket packet;
-    packet.type = type;
-
-    packet.broadcast = true;
-    packet.local_ip = GetLocalIp();
-
-    packet.data.resize(sizeof(data));
-    std::memcpy(packet.data.data(), &data, sizeof(data));
-    SendPacket(packet);
+    SendPacket(type, {}, true, std::as_bytes(std::span{&data, 1}));
 }
 
 void LANDiscovery::SendBroadcast(Network::LDNPacketType type) {
-    Network::LDNPacket packet;
-    packet.type = type;
-
-    packet.broadcast = true;
-    packet.local_ip = GetLocalIp();
-
-    SendPacket(packet);
+    SendPacket(type, {}, true, {});
 }
 
-void LANDiscovery::SendPacket(const Network::LDNPacket& packet) {
+void LANDiscovery::SendPacket(Network::LDNPacketType type, Ipv4Address remote_ip, bool broadcast,
+                              std::span<const std::byte> data) {
     if (auto room_member = room_network.GetRoomMember().lock()) {
         if (room_member->IsConnected()) {
-            room_member->SendLdnPacket(packet);
+            // The payload is serialized straight from the caller's data
+            room_member->SendLdnPacket(type, GetLocalIp(), remote_ip, broadcast,
+                                       {reinterpret_cast<const u8*>(data.data()), data.size()});
         }
     }
 }
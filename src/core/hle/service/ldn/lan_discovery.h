@@ -106,7 +106,8 @@ protected:
     template <typename Data>
     void SendBroadcast(Network::LDNPacketType type, const Data& data);
     void SendBroadcast(Network::LDNPacketType type);
-    void SendPacket(const Network::LDNPacket& packet);
+    void SendPacket(Network::LDNPacketType type, Ipv4Address remote_ip, bool broadcast,
+                    std::span<const std::byte> data);
 
     static const LanEventFunc empty_func;
     static constexpr Ssid fake_ssid{"YuzuFakeSsidForLdn"};
@@ -126,6 +127,10 @@ protected:
     std::vector<Ipv4Address> connected_clients;
     std::optional<Ipv4Address> host_ip;
 
+    /// Network info and clients of the last SyncNetwork sent to the clients
+    NetworkInfo synced_network_info{};
+    std::vector<Ipv4Address> synced_clients;
+
     LanEventFunc lan_event;
 
     Network::RoomNetwork& room_network;
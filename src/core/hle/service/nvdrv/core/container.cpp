@@ -106,7 +106,6 @@ SessionId Container::OpenSession(Kernel::KProcess* process) {
         if (start_region != 0) {
             session.mapper = std::make_unique<HeapMapper>(region_start, start_region, region_size,
                                                           asid, impl->host1x);
-            smmu.TrackContinuity(start_region, region_start, region_size, asid);
             session.has_preallocated_area = true;
             LOG_DEBUG(Debug, "Preallocation created!");
         }
@@ -71,10 +71,31 @@ NvResult NvMap::Handle::Duplicate(bool internal_session) {
 
 NvMap::NvMap(Container& core_, Tegra::Host1x::Host1x& host1x_) : host1x{host1x_}, core{core_} {}
 
-void NvMap::AddHandle(std::shared_ptr<Handle> handle_description) {
-    std::scoped_lock lock(handles_lock);
+NvMap::Handle::Id NvMap::MakeHandleId(size_t slot, u32 generation) {
+    // Slots are stored plus one, so no ID is zero
+    const u32 index{(generation << HandleSlotBits) | static_cast<u32>(slot + 1)};
+    return index * HandleIdIncrement;
+}
 
-    handles.emplace(handle_description->id, std::move(handle_description));
+std::optional<size_t> NvMap::HandleSlot(Handle::Id handle) {
+    const u32 slot{(handle / HandleIdIncrement) & static_cast<u32>(MaxHandleSlots)};
+    if (slot == 0 || handle % HandleIdIncrement != 0) {
+        return std::nullopt;
+    }
+    return slot - 1;
+}
+
+std::shared_ptr<NvMap::Handle>* NvMap::FindHandle(Handle::Id handle) {
+    const std::optional<size_t> slot{HandleSlot(handle)};
+    if (!slot || *slot >= handles.size()) {
+        return nullptr;
+    }
+    // Handles that used the slot before have another generation in their ID
+    std::shared_ptr<Handle>& entry{handles[*slot].handle};
+    if (!entry || entry->id != handle) {
+        return nullptr;
+    }
+    return &entry;
 }
 
 void NvMap::UnmapHandle(Handle& handle_description) {
@@ -115,9 +136,9 @@ bool NvMap::TryRemoveHandle(const Handle& handle_description) {
     if (handle_description.dupes == 0 && handle_description.internal_dupes == 0) {
         std::scoped_lock lock(handles_lock);
 
-        auto it{handles.find(handle_description.id)};
-        if (it != handles.end()) {
-            handles.erase(it);
+        if (auto* const slot{FindHandle(handle_description.id)}) {
+            slot->reset();
+            free_slots.push_back(*HandleSlot(handle_description.id));
         }
 
         return true;
@@ -131,30 +152,36 @@ NvResult NvMap::CreateHandle(u64 size, std::shared_ptr<NvMap::Handle>& result_ou
         return NvResult::BadValue;
     }
 
-    u32 id{next_handle_id.fetch_add(HandleIdIncrement, std::memory_order_relaxed)};
-    auto handle_description{std::make_shared<Handle>(size, id)};
-    AddHandle(handle_description);
+    std::scoped_lock lock(handles_lock);
+    size_t slot;
+    if (!free_slots.empty()) {
+        slot = free_slots.back();
+        free_slots.pop_back();
+    } else if (handles.size() < MaxHandleSlots) {
+        slot = handles.size();
+        handles.emplace_back();
+    } else [[unlikely]] {
+        return NvResult::InsufficientMemory;
+    }
+    HandleEntry& entry{handles[slot]};
+    const Handle::Id id{MakeHandleId(slot, entry.generation)};
+    entry.generation = (entry.generation + 1) & HandleGenerationMask;
+    entry.handle = std::make_shared<Handle>(size, id);
 
-    result_out = handle_description;
+    result_out = entry.handle;
     return NvResult::Success;
 }
 
 std::shared_ptr<NvMap::Handle> NvMap::GetHandle(Handle::Id handle) {
     std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle);
-    } catch (std::out_of_range&) {
-        return nullptr;
-    }
+    auto* const slot{FindHandle(handle)};
+    return slot ? *slot : nullptr;
 }
 
 DAddr NvMap::GetHandleAddress(Handle::Id handle) {
     std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle)->d_address;
-    } catch (std::out_of_range&) {
-        return 0;
-    }
+    auto* const slot{FindHandle(handle)};
+    return slot ? (*slot)->d_address : 0;
 }
 
 DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
@@ -224,7 +251,7 @@ DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
             }
 
             handle_description->d_address = address;
-            smmu.Map(address, vaddress, map_size, session->asid, true);
+            smmu.Map(address, vaddress, map_size, session->asid);
             handle_description->in_heap = false;
         }
     }
@@ -327,12 +354,21 @@ std::optional<NvMap::FreeInfo> NvMap::FreeHandle(Handle::Id handle, bool interna
 }
 
 void NvMap::UnmapAllHandles(NvCore::SessionId session_id) {
-    auto handles_copy = [&] {
-        std::scoped_lock lk{handles_lock};
-        return handles;
-    }();
-
-    for (auto& [id, handle] : handles_copy) {
+    // Handles are freed with their own lock taken before `handles_lock`, so they are visited one
+    // at a time instead of under the table lock
+    for (size_t slot = 0;; ++slot) {
+        std::shared_ptr<Handle> handle;
+        {
+            std::scoped_lock lk{handles_lock};
+            if (slot >= handles.size()) {
+                break;
+            }
+            handle = handles[slot].handle;
+        }
+        if (!handle) {
+            continue;
+        }
+        const Handle::Id id{handle->id};
         {
             std::scoped_lock lk{handle->mutex};
             if (handle->session_id.id != session_id.id || handle->dupes <= 0) {
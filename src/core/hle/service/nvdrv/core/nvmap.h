@@ -4,12 +4,11 @@
 
 #pragma once
 
-#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <unordered_map>
+#include <vector>
 #include <assert.h>
 
 #include "common/bit_field.h"
@@ -158,16 +157,36 @@ private:
     std::list<std::shared_ptr<Handle>> unmap_queue{};
     std::mutex unmap_queue_lock{}; //!< Protects access to `unmap_queue`
 
-    std::unordered_map<Handle::Id, std::shared_ptr<Handle>>
-        handles{};           //!< Main owning map of handles
-    std::mutex handles_lock; //!< Protects access to `handles`
+    struct HandleEntry {
+        std::shared_ptr<Handle> handle;
+        u32 generation{}; //!< Number of handles that used the slot, part of the next ID
+    };
+
+    std::vector<HandleEntry> handles{}; //!< Main owning table of handles, indexed by `HandleSlot`
+    std::vector<size_t> free_slots{};   //!< Slots of `handles` without a handle, reused first
+    std::mutex handles_lock;            //!< Protects access to `handles` and `free_slots`
 
-    static constexpr u32 HandleIdIncrement{
-        4}; //!< Each new handle ID is an increment of 4 from the previous
-    std::atomic<u32> next_handle_id{HandleIdIncrement};
+    static constexpr u32 HandleIdIncrement{4}; //!< Handle IDs are multiples of 4
+    static constexpr u32 HandleSlotBits{
+        20}; //!< Bits of an ID over `HandleIdIncrement` holding its slot, the rest its generation
+    static constexpr size_t MaxHandleSlots{(1U << HandleSlotBits) - 1};
+    static constexpr u32 HandleGenerationMask{(1U << (30 - HandleSlotBits)) - 1};
     Tegra::Host1x::Host1x& host1x;
 
-    void AddHandle(std::shared_ptr<Handle> handle);
+    /**
+     * @brief Returns the ID of the handle using a slot, the generation keeps IDs of earlier
+     * handles in the slot from finding it
+     */
+    static Handle::Id MakeHandleId(size_t slot, u32 generation);
+
+    /// @brief Returns the index of a handle ID in `handles`
+    static std::optional<size_t> HandleSlot(Handle::Id handle);
+
+    /**
+     * @brief Returns the handle with the given ID, or nullptr
+     * @note `handles_lock` MUST be locked when calling this
+     */
+    std::shared_ptr<Handle>* FindHandle(Handle::Id handle);
 
     /**
      * @brief Unmaps and frees the SMMU memory region a handle is mapped to
@@ -62,6 +62,8 @@ void nvdisp_disp0::Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers
     output_layers.reserve(sorted_layers.size());
     output_fences.reserve(sorted_layers.size());
 
+    const auto composition_time{std::chrono::steady_clock::now()};
+
     for (auto& layer : sorted_layers) {
         output_layers.emplace_back(Tegra::FramebufferConfig{
             .address = nvmap.GetHandleAddress(layer.buffer_handle),
@@ -73,6 +75,7 @@ void nvdisp_disp0::Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers
             .transform_flags = layer.transform,
             .crop_rect = layer.crop_rect,
             .blending = ConvertBlending(layer.blending),
+            .composition_time = composition_time,
         });
 
         for (size_t i = 0; i < layer.acquire_fence.num_fences; i++) {
@@ -81,8 +84,9 @@ void nvdisp_disp0::Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers
     }
 
     system.GPU().RequestComposite(std::move(output_layers), std::move(output_fences));
-    system.SpeedLimiter().DoSpeedLimiting(system.CoreTiming().GetGlobalTimeUs());
-    system.GetPerfStats().EndSystemFrame();
+    const auto pacing_error =
+        system.SpeedLimiter().DoSpeedLimiting(system.CoreTiming().GetGlobalTimeUs());
+    system.GetPerfStats().EndSystemFrame(pacing_error);
     system.GetPerfStats().BeginSystemFrame();
 }
 
@@ -8,6 +8,7 @@
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/hle/service/nvdrv/core/container.h"
 #include "core/hle/service/nvdrv/core/nvmap.h"
@@ -270,6 +271,12 @@ NvResult nvhost_as_gpu::Remap(std::span<IoctlRemapEntry> entries) {
         return NvResult::BadValue;
     }
 
+    // Invalidate the caches once for the whole batch of remaps
+    gmmu->BeginMapBatch();
+    SCOPE_EXIT {
+        gmmu->EndMapBatch();
+    };
+
     for (const auto& entry : entries) {
         GPUVAddr virtual_address{static_cast<u64>(entry.as_offset_big_pages)
                                  << vm.big_page_size_bits};
@@ -21,6 +21,12 @@ BufferQueueConsumer::~BufferQueueConsumer() = default;
 
 Status BufferQueueConsumer::AcquireBuffer(BufferItem* out_buffer,
                                           std::chrono::nanoseconds expected_present) {
+    // The compositor tries to acquire a buffer of every layer on each vsync, and most of the time
+    // none was queued since the last one. Return early without contending with the producer.
+    if (core->can_skip_acquire.load(std::memory_order_acquire)) {
+        return Status::NoBufferAvailable;
+    }
+
     std::scoped_lock lock{core->mutex};
 
     // Check that the consumer doesn't currently have the maximum number of buffers acquired.
@@ -110,6 +116,7 @@ Status BufferQueueConsumer::AcquireBuffer(BufferItem* out_buffer,
     }
 
     core->queue.erase(front);
+    core->AcquireStateChangedLocked();
 
     // We might have freed a slot while dropping old buffers, or the producer  may be blocked
     // waiting for the number of buffers in the queue to decrease.
@@ -151,6 +158,7 @@ Status BufferQueueConsumer::ReleaseBuffer(s32 slot, u64 frame_number, const Fenc
             // by properly waiting for the fence in the BufferItemConsumer.
             // slots[slot].fence = release_fence;
             slots[slot].buffer_state = BufferState::Free;
+            core->AcquireStateChangedLocked();
 
             listener = core->connected_producer_listener;
 
@@ -214,6 +222,7 @@ Status BufferQueueConsumer::Disconnect() {
     core->is_abandoned = true;
     core->consumer_listener = nullptr;
     core->queue.clear();
+    core->AcquireStateChangedLocked();
     core->FreeAllBuffersLocked();
     core->SignalDequeueCondition();
 
@@ -26,6 +26,15 @@ bool BufferQueueCore::WaitForDequeueCondition(std::unique_lock<std::mutex>& lk)
     return true;
 }
 
+void BufferQueueCore::AcquireStateChangedLocked() {
+    // At the limit of acquired buffers acquiring fails with InvalidOperation instead
+    const auto num_acquired_buffers{std::count_if(slots.begin(), slots.end(), [](const auto& slot) {
+        return slot.buffer_state == BufferState::Acquired;
+    })};
+    can_skip_acquire.store(queue.empty() && num_acquired_buffers < max_acquired_buffer_count + 1,
+                           std::memory_order_release);
+}
+
 s32 BufferQueueCore::GetMinUndequeuedBufferCountLocked(bool async) const {
     // If DequeueBuffer is allowed to error out, we don't have to add an extra buffer.
     if (!use_async_buffer) {
@@ -74,7 +83,8 @@ void BufferQueueCore::FreeBufferLocked(s32 slot) {
 
     slots[slot].graphic_buffer.reset();
 
-    if (slots[slot].buffer_state == BufferState::Acquired) {
+    const bool was_acquired{slots[slot].buffer_state == BufferState::Acquired};
+    if (was_acquired) {
         slots[slot].needs_cleanup_on_release = true;
     }
 
@@ -82,6 +92,10 @@ void BufferQueueCore::FreeBufferLocked(s32 slot) {
     slots[slot].frame_number = UINT32_MAX;
     slots[slot].acquire_called = false;
     slots[slot].fence = Fence::NoFence();
+
+    if (was_acquired) {
+        AcquireStateChangedLocked();
+    }
 }
 
 void BufferQueueCore::FreeAllBuffersLocked() {
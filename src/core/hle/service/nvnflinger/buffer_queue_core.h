@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <list>
 #include <memory>
@@ -37,6 +38,7 @@ public:
 private:
     void SignalDequeueCondition();
     bool WaitForDequeueCondition(std::unique_lock<std::mutex>& lk);
+    void AcquireStateChangedLocked();
 
     s32 GetMinUndequeuedBufferCountLocked(bool async) const;
     s32 GetMinMaxBufferCountLocked(bool async) const;
@@ -57,6 +59,8 @@ private:
     std::shared_ptr<IProducerListener> connected_producer_listener;
     BufferQueueDefs::SlotsType slots{};
     std::vector<BufferItem> queue;
+    // Set while AcquireBuffer can only return NoBufferAvailable, to check it without locking
+    std::atomic<bool> can_skip_acquire{true};
     s32 override_max_buffer_count{};
     std::condition_variable dequeue_condition;
     std::atomic<bool> dequeue_possible{};
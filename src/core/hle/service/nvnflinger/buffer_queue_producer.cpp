@@ -556,6 +556,7 @@ Status BufferQueueProducer::QueueBuffer(s32 slot, const QueueBufferInput& input,
                 frame_available_listener = core->consumer_listener;
             }
         }
+        core->AcquireStateChangedLocked();
 
         core->buffer_has_been_queued = true;
         core->SignalDequeueCondition();
@@ -744,6 +745,7 @@ Status BufferQueueProducer::Disconnect(NativeWindowApi api) {
         case NativeWindowApi::Camera:
             if (core->connected_api == api) {
                 core->queue.clear();
+                core->AcquireStateChangedLocked();
                 core->FreeAllBuffersLocked();
                 core->connected_producer_listener = nullptr;
                 core->connected_api = NativeWindowApi::NoConnectedApi;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/scope_exit.h"
+#include "common/trace.h"
 
 #include "core/core.h"
 #include "core/hle/kernel/k_client_port.h"
@@ -360,6 +361,8 @@ Result ServerManager::OnSessionEvent(Session* session) {
 }
 
 Result ServerManager::CompleteSyncRequest(Session* session) {
+    TRACE_SCOPE(Service, "CompleteSyncRequest");
+
     Result res = ResultSuccess;
     Result service_res = ResultSuccess;
 
@@ -48,6 +48,12 @@ public:
     Result ManageDeferral(Kernel::KEvent** out_event);
 
     Result LoopProcess();
+
+    /**
+     * Starts extra host threads that serve this manager's sessions concurrently. Calls into a
+     * single service object are still serialized by ServiceFrameworkBase::LockService, so this is
+     * only safe for managers whose services don't share unlocked state across interfaces.
+     */
     void StartAdditionalHostThreads(const char* name, size_t num_threads);
 
     static void RunServer(std::unique_ptr<ServerManager>&& server);
@@ -10,6 +10,7 @@
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/service_profiler.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/reporter.h"
 
@@ -91,7 +92,7 @@ void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
     }
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
+    CallHandler(ctx, *info, false);
 }
 
 void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
@@ -105,7 +106,19 @@ void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
     }
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
+    CallHandler(ctx, *info, true);
+}
+
+void ServiceFrameworkBase::CallHandler(HLERequestContext& ctx, const FunctionInfoBase& info,
+                                       bool is_tipc) {
+    if (!IsServiceProfilingEnabled()) [[likely]] {
+        handler_invoker(this, info.handler_callback, ctx);
+        return;
+    }
+    const auto profile{
+        EnterServiceProfile(service_name, info.name, ctx.GetCommand(), is_tipc, ctx)};
+    handler_invoker(this, info.handler_callback, ctx);
+    LeaveServiceProfile(profile);
 }
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/settings.h"
+#include "core/hle/service/hle_ipc.h"
+#include "core/hle/service/service_profiler.h"
+
+namespace Service {
+
+namespace Profiler {
+struct CommandEntry {
+    std::string service_name;
+    std::string command_name;
+    u32 command_id{};
+    bool is_tipc{};
+    MicroProfileToken token{};
+    std::atomic<u64> calls{};
+    std::atomic<u64> total_ns{};
+    std::atomic<u64> max_ns{};
+    std::atomic<u64> bytes_in{};
+    std::atomic<u64> bytes_out{};
+};
+} // namespace Profiler
+
+namespace {
+using Profiler::CommandEntry;
+using CommandKey = std::tuple<std::string, u32, bool>;
+
+std::mutex entries_mutex;
+// Entries are never erased, so scopes can keep pointers to them without holding the lock.
+std::map<CommandKey, std::unique_ptr<CommandEntry>, std::less<>> entries;
+
+template <typename Descriptors>
+u64 SumSizes(const Descriptors& descriptors) {
+    u64 size{};
+    for (const auto& descriptor : descriptors) {
+        size += descriptor.Size();
+    }
+    return size;
+}
+
+void AtomicMax(std::atomic<u64>& value, u64 candidate) {
+    u64 current{value.load(std::memory_order_relaxed)};
+    while (current < candidate &&
+           !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+    }
+}
+
+CommandEntry& GetEntry(std::string_view service_name, std::string_view command_name,
+                       u32 command_id, bool is_tipc) {
+    std::scoped_lock lk{entries_mutex};
+    const auto it{entries.find(std::make_tuple(service_name, command_id, is_tipc))};
+    if (it != entries.end()) {
+        return *it->second;
+    }
+    auto entry{std::make_unique<CommandEntry>()};
+    entry->service_name = service_name;
+    entry->command_name = command_name;
+    entry->command_id = command_id;
+    entry->is_tipc = is_tipc;
+    const auto timer_name{fmt::format("{}::{}", service_name, command_name)};
+    entry->token = MicroProfileGetToken("HLE", timer_name.c_str(), MP_RGB(200, 100, 200));
+    CommandEntry& result{*entry};
+    entries.emplace(CommandKey{std::string{service_name}, command_id, is_tipc}, std::move(entry));
+    return result;
+}
+} // Anonymous namespace
+
+bool IsServiceProfilingEnabled() {
+    return Settings::values.profile_services.GetValue();
+}
+
+ServiceProfileScope EnterServiceProfile(std::string_view service_name,
+                                        std::string_view command_name, u32 command_id,
+                                        bool is_tipc, const HLERequestContext& ctx) {
+    CommandEntry& entry{GetEntry(service_name, command_name, command_id, is_tipc)};
+    entry.bytes_in.fetch_add(SumSizes(ctx.BufferDescriptorA()) + SumSizes(ctx.BufferDescriptorX()),
+                             std::memory_order_relaxed);
+    entry.bytes_out.fetch_add(SumSizes(ctx.BufferDescriptorB()) +
+                                  SumSizes(ctx.BufferDescriptorC()),
+                              std::memory_order_relaxed);
+    return ServiceProfileScope{
+        .entry = &entry,
+        .start = std::chrono::steady_clock::now(),
+        .microprofile_tick = MicroProfileEnter(entry.token),
+    };
+}
+
+void LeaveServiceProfile(const ServiceProfileScope& scope) {
+    const auto elapsed{std::chrono::steady_clock::now() - scope.start};
+    MicroProfileLeave(scope.entry->token, scope.microprofile_tick);
+
+    const u64 time_ns{static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())};
+    scope.entry->calls.fetch_add(1, std::memory_order_relaxed);
+    scope.entry->total_ns.fetch_add(time_ns, std::memory_order_relaxed);
+    AtomicMax(scope.entry->max_ns, time_ns);
+}
+
+std::vector<ServiceCommandStats> GetServiceStats() {
+    std::scoped_lock lk{entries_mutex};
+    std::vector<ServiceCommandStats> stats;
+    stats.reserve(entries.size());
+    for (const auto& [key, entry] : entries) {
+        stats.push_back(ServiceCommandStats{
+            .service_name = entry->service_name,
+            .command_name = entry->command_name,
+            .command_id = entry->command_id,
+            .is_tipc = entry->is_tipc,
+            .calls = entry->calls.load(std::memory_order_relaxed),
+            .total_ns = entry->total_ns.load(std::memory_order_relaxed),
+            .max_ns = entry->max_ns.load(std::memory_order_relaxed),
+            .bytes_in = entry->bytes_in.load(std::memory_order_relaxed),
+            .bytes_out = entry->bytes_out.load(std::memory_order_relaxed),
+        });
+    }
+    return stats;
+}
+
+void LogServiceStats() {
+    std::vector<ServiceCommandStats> stats{GetServiceStats()};
+    {
+        // Entries are reset rather than erased, commands may still be in flight on other threads.
+        std::scoped_lock lk{entries_mutex};
+        for (auto& [key, entry] : entries) {
+            entry->calls.store(0, std::memory_order_relaxed);
+            entry->total_ns.store(0, std::memory_order_relaxed);
+            entry->max_ns.store(0, std::memory_order_relaxed);
+            entry->bytes_in.store(0, std::memory_order_relaxed);
+            entry->bytes_out.store(0, std::memory_order_relaxed);
+        }
+    }
+    std::erase_if(stats, [](const ServiceCommandStats& command) { return command.calls == 0; });
+    if (stats.empty()) {
+        return;
+    }
+    std::ranges::sort(stats, std::ranges::greater{}, &ServiceCommandStats::total_ns);
+
+    LOG_INFO(Service, "HLE service command timings:");
+    for (const ServiceCommandStats& command : stats) {
+        LOG_INFO(Service,
+                 "{:>24}::{:<40} ({}{:>4}): {:>9} calls, {:>10.3f} ms total, {:>8.3f} us avg, "
+                 "{:>10.3f} us max, {} B in, {} B out",
+                 command.service_name, command.command_name, command.is_tipc ? "tipc " : "",
+                 command.command_id, command.calls, command.total_ns / 1e6,
+                 command.total_ns / 1e3 / command.calls, command.max_ns / 1e3, command.bytes_in,
+                 command.bytes_out);
+    }
+}
+
+} // namespace Service
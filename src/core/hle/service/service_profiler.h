@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Service {
+
+class HLERequestContext;
+
+struct ServiceCommandStats {
+    std::string service_name;
+    std::string command_name;
+    u32 command_id{};
+    bool is_tipc{};
+    u64 calls{};
+    u64 total_ns{};
+    u64 max_ns{};
+    /// Bytes in the request's A and X buffers
+    u64 bytes_in{};
+    /// Bytes in the request's B and C buffers
+    u64 bytes_out{};
+};
+
+namespace Profiler {
+struct CommandEntry;
+}
+
+/// Profiling state of an in-flight service command, kept on the handling thread's stack
+struct ServiceProfileScope {
+    Profiler::CommandEntry* entry{};
+    std::chrono::steady_clock::time_point start{};
+    u64 microprofile_tick{};
+};
+
+/// Returns true when per-command service statistics are being collected
+[[nodiscard]] bool IsServiceProfilingEnabled();
+
+/**
+ * Starts timing a service command. The command is also timed under its own MicroProfile timer
+ * in the "HLE" group. Commands are aggregated over every instance of a service interface.
+ */
+[[nodiscard]] ServiceProfileScope EnterServiceProfile(std::string_view service_name,
+                                                      std::string_view command_name,
+                                                      u32 command_id, bool is_tipc,
+                                                      const HLERequestContext& ctx);
+
+/// Finishes timing a command started with EnterServiceProfile
+void LeaveServiceProfile(const ServiceProfileScope& scope);
+
+/// Returns the statistics accumulated for every command since the last LogServiceStats
+[[nodiscard]] std::vector<ServiceCommandStats> GetServiceStats();
+
+/// Logs the accumulated statistics sorted by total time, if any were collected, and clears them
+void LogServiceStats();
+
+} // namespace Service
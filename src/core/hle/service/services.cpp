@@ -54,6 +54,7 @@
 #include "core/hle/service/ptm/ptm.h"
 #include "core/hle/service/ro/ro.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/service_profiler.h"
 #include "core/hle/service/set/settings.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/hle/service/sockets/sockets.h"
@@ -72,9 +73,9 @@ Services::Services(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system
 
     // clang-format off
     kernel.RunOnHostCoreProcess("audio",      [&] { Audio::LoopProcess(system); }).detach();
+    kernel.RunOnHostCoreProcess("hwopus",     [&] { Audio::LoopProcessHardwareOpus(system); }).detach();
     kernel.RunOnHostCoreProcess("FS",         [&] { FileSystem::LoopProcess(system); }).detach();
     kernel.RunOnHostCoreProcess("jit",        [&] { JIT::LoopProcess(system); }).detach();
-    kernel.RunOnHostCoreProcess("ldn",        [&] { LDN::LoopProcess(system); }).detach();
     kernel.RunOnHostCoreProcess("Loader",     [&] { LDR::LoopProcess(system); }).detach();
     kernel.RunOnHostCoreProcess("nvservices", [&] { Nvidia::LoopProcess(system); }).detach();
     kernel.RunOnHostCoreProcess("bsdsocket",  [&] { Sockets::LoopProcess(system); }).detach();
@@ -85,52 +86,104 @@ Services::Services(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system
     kernel.RunOnGuestCoreProcess("am",         [&] { AM::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("aoc",        [&] { AOC::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("apm",        [&] { APM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("bcat",       [&] { BCAT::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("bpc",        [&] { BPC::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("btdrv",      [&] { BtDrv::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("btm",        [&] { BTM::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("capsrv",     [&] { Capture::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("erpt",       [&] { ERPT::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("es",         [&] { ES::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("eupld",      [&] { EUPLD::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("fatal",      [&] { Fatal::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("fgm",        [&] { FGM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("friends",    [&] { Friend::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("settings",   [&] { Set::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("psc",        [&] { PSC::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("glue",       [&] { Glue::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("grc",        [&] { GRC::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("hid",        [&] { HID::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("lbl",        [&] { LBL::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("LogManager.Prod", [&] { LM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("mig",        [&] { Migration::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("mii",        [&] { Mii::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("mm",         [&] { MM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("mnpp",       [&] { MNPP::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("nvnflinger", [&] { Nvnflinger::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("NCM",        [&] { NCM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("nfc",        [&] { NFC::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("nfp",        [&] { NFP::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("ngc",        [&] { NGC::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("nifm",       [&] { NIFM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("nim",        [&] { NIM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("npns",       [&] { NPNS::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("ns",         [&] { NS::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("olsc",       [&] { OLSC::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("omm",        [&] { OMM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("pcie",       [&] { PCIe::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("pctl",       [&] { PCTL::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("pcv",        [&] { PCV::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("prepo",      [&] { PlayReport::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("ProcessManager", [&] { PM::LoopProcess(system); });
     kernel.RunOnGuestCoreProcess("ptm",        [&] { PTM::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("ro",         [&] { RO::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("spl",        [&] { SPL::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("ssl",        [&] { SSL::LoopProcess(system); });
-    kernel.RunOnGuestCoreProcess("usb",        [&] { USB::LoopProcess(system); });
+    // clang-format on
+
+    // Services most applications never use are only started once one of them is requested.
+    // ServiceManager::GetService does not start them, services it looks up must start above.
+    const auto run_lazily = [&](std::string&& process_name, std::function<void()>&& func,
+                                std::vector<std::string>&& service_names) {
+        sm->RegisterLazyProcess(std::move(service_names),
+                                [&system, process_name = std::move(process_name),
+                                 func = std::move(func)]() mutable {
+                                    system.Kernel().RunOnGuestCoreProcess(std::move(process_name),
+                                                                          std::move(func));
+                                });
+    };
+
+    sm->RegisterLazyProcess({"ldn:m", "ldn:s", "ldn:u", "lp2p:app", "lp2p:sys", "lp2p:m"},
+                            [&system] {
+                                system.Kernel()
+                                    .RunOnHostCoreProcess("ldn",
+                                                          [&system] { LDN::LoopProcess(system); })
+                                    .detach();
+                            });
+
+    // clang-format off
+    run_lazily("bcat",    [&system] { BCAT::LoopProcess(system); },
+               {"bcat:a", "bcat:m", "bcat:u", "bcat:s", "news:a", "news:p", "news:c", "news:v",
+                "news:m"});
+    run_lazily("btdrv",   [&system] { BtDrv::LoopProcess(system); },
+               {"btdrv", "bt"});
+    run_lazily("btm",     [&system] { BTM::LoopProcess(system); },
+               {"btm", "btm:dbg", "btm:sys", "btm:u"});
+    run_lazily("erpt",    [&system] { ERPT::LoopProcess(system); },
+               {"erpt:c", "erpt:r"});
+    run_lazily("es",      [&system] { ES::LoopProcess(system); },
+               {"es"});
+    run_lazily("eupld",   [&system] { EUPLD::LoopProcess(system); },
+               {"eupld:c", "eupld:r"});
+    run_lazily("fgm",     [&system] { FGM::LoopProcess(system); },
+               {"fgm", "fgm:0", "fgm:9", "fgm:dbg"});
+    run_lazily("friends", [&system] { Friend::LoopProcess(system); },
+               {"friend:a", "friend:m", "friend:s", "friend:u", "friend:v"});
+    run_lazily("grc",     [&system] { GRC::LoopProcess(system); },
+               {"grc:c"});
+    run_lazily("lbl",     [&system] { LBL::LoopProcess(system); },
+               {"lbl"});
+    run_lazily("mig",     [&system] { Migration::LoopProcess(system); },
+               {"mig:user"});
+    run_lazily("mnpp",    [&system] { MNPP::LoopProcess(system); },
+               {"mnpp:app"});
+    run_lazily("ngc",     [&system] { NGC::LoopProcess(system); },
+               {"ngct:u", "ngc:u"});
+    run_lazily("nfc",     [&system] { NFC::LoopProcess(system); },
+               {"nfc:am", "nfc:mf:u", "nfc:user", "nfc:sys"});
+    run_lazily("nfp",     [&system] { NFP::LoopProcess(system); },
+               {"nfp:user", "nfp:sys", "nfp:dbg"});
+    run_lazily("nim",     [&system] { NIM::LoopProcess(system); },
+               {"nim", "nim:eca", "nim:shp", "ntc"});
+    run_lazily("npns",    [&system] { NPNS::LoopProcess(system); },
+               {"npns:s", "npns:u"});
+    run_lazily("olsc",    [&system] { OLSC::LoopProcess(system); },
+               {"olsc:u", "olsc:s"});
+    run_lazily("omm",     [&system] { OMM::LoopProcess(system); },
+               {"idle:sys", "omm", "spsm"});
+    run_lazily("pcie",    [&system] { PCIe::LoopProcess(system); },
+               {"pcie"});
+    run_lazily("pcv",     [&system] { PCV::LoopProcess(system); },
+               {"pcv", "clkrst", "clkrst:i", "clkrst:a"});
+    run_lazily("prepo",   [&system] { PlayReport::LoopProcess(system); },
+               {"prepo:a", "prepo:a2", "prepo:m", "prepo:s", "prepo:u"});
+    run_lazily("ro",      [&system] { RO::LoopProcess(system); },
+               {"ldr:ro", "ro:1"});
+    run_lazily("spl",     [&system] { SPL::LoopProcess(system); },
+               {"csrng", "spl", "spl:mig", "spl:fs", "spl:ssl", "spl:es", "spl:manu"});
+    run_lazily("ssl",     [&system] { SSL::LoopProcess(system); },
+               {"ssl"});
+    run_lazily("usb",     [&system] { USB::LoopProcess(system); },
+               {"usb:ds", "usb:hs", "usb:pd", "usb:pd:c", "usb:pm"});
     // clang-format on
 }
 
-Services::~Services() = default;
+Services::~Services() {
+    LogServiceStats();
+}
 
 } // namespace Service
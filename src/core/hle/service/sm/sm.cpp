@@ -98,15 +98,40 @@ Result ServiceManager::GetServicePort(Kernel::KClientPort** out_client_port,
                                       const std::string& name) {
     R_TRY(ValidateServiceName(name));
 
-    std::scoped_lock lk{lock};
-    auto it = service_ports.find(name);
-    if (it == service_ports.end()) {
-        LOG_WARNING(Service_SM, "Server is not registered! service={}", name);
-        return Service::SM::ResultNotRegistered;
+    std::shared_ptr<std::function<void()>> lazy_process;
+    {
+        std::scoped_lock lk{lock};
+        auto it = service_ports.find(name);
+        if (it != service_ports.end()) {
+            *out_client_port = it->second;
+            return ResultSuccess;
+        }
+
+        const auto lazy_it = lazy_processes.find(name);
+        if (lazy_it == lazy_processes.end()) {
+            LOG_WARNING(Service_SM, "Server is not registered! service={}", name);
+            return Service::SM::ResultNotRegistered;
+        }
+
+        // Forget every service of the process, so it is only started once.
+        lazy_process = lazy_it->second;
+        std::erase_if(lazy_processes,
+                      [&](const auto& entry) { return entry.second == lazy_process; });
     }
 
-    *out_client_port = it->second;
-    return ResultSuccess;
+    LOG_INFO(Service_SM, "Starting the process of service {}", name);
+    (*lazy_process)();
+    return Service::SM::ResultNotRegistered;
+}
+
+void ServiceManager::RegisterLazyProcess(std::vector<std::string> service_names,
+                                         std::function<void()> start) {
+    auto lazy_process = std::make_shared<std::function<void()>>(std::move(start));
+
+    std::scoped_lock lk{lock};
+    for (auto& service_name : service_names) {
+        lazy_processes.emplace(std::move(service_name), lazy_process);
+    }
 }
 
 /**
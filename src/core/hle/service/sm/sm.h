@@ -4,10 +4,12 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/concepts.h"
 #include "core/hle/kernel/k_port.h"
@@ -63,6 +65,15 @@ public:
     Result UnregisterService(const std::string& name);
     Result GetServicePort(Kernel::KClientPort** out_client_port, const std::string& name);
 
+    /**
+     * Defers starting a service process until one of the services it registers is requested.
+     * Requests for those services wait until the started process registers them.
+     *
+     * @param service_names Names of all the services the process registers.
+     * @param start         Starts the process, called at most once.
+     */
+    void RegisterLazyProcess(std::vector<std::string> service_names, std::function<void()> start);
+
     template <Common::DerivedFrom<SessionRequestHandler> T>
     std::shared_ptr<T> GetService(const std::string& service_name, bool block = false) const {
         auto service = registered_services.find(service_name);
@@ -96,6 +107,8 @@ private:
     std::mutex lock;
     std::unordered_map<std::string, SessionRequestHandlerFactory> registered_services;
     std::unordered_map<std::string, Kernel::KClientPort*> service_ports;
+    /// Processes not started yet, by the names of the services they register.
+    std::unordered_map<std::string, std::shared_ptr<std::function<void()>>> lazy_processes;
 
     /// Kernel context
     Kernel::KernelCore& kernel;
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -14,6 +17,7 @@
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/sockets/bsd.h"
+#include "core/hle/service/sockets/socket_waiter.h"
 #include "core/hle/service/sockets/sockets_translate.h"
 #include "core/internal_network/network.h"
 #include "core/internal_network/socket_proxy.h"
@@ -51,6 +55,25 @@ void PutValue(std::span<u8> buffer, const T& t) {
     std::memcpy(buffer.data(), &t, std::min(sizeof(T), buffer.size()));
 }
 
+/// Returns the buffer to receive into when the output buffer can not be received into directly
+std::vector<u8> MakeReceiveCopy(HLERequestContext& ctx, std::span<const u8> message,
+                                std::size_t buffer_index) {
+    if (!message.empty()) {
+        return {};
+    }
+    return std::vector<u8>(ctx.GetWriteBufferSize(buffer_index));
+}
+
+/// Writes the received data back, to the guest unless it was received into guest memory
+void CommitReceive(HLERequestContext& ctx, std::span<const u8> message,
+                   const std::vector<u8>& message_copy, s32 ret, std::size_t buffer_index) {
+    if (message.empty()) {
+        ctx.WriteBuffer(message_copy, buffer_index);
+    } else {
+        ctx.CommitWriteBuffer(static_cast<std::size_t>(std::max(ret, 0)), buffer_index);
+    }
+}
+
 } // Anonymous namespace
 
 void BSD::PollWork::Execute(BSD* bsd) {
@@ -96,11 +119,12 @@ void BSD::ConnectWork::Response(HLERequestContext& ctx) {
 }
 
 void BSD::RecvWork::Execute(BSD* bsd) {
-    std::tie(ret, bsd_errno) = bsd->RecvImpl(fd, flags, message);
+    std::tie(ret, bsd_errno) =
+        bsd->RecvImpl(fd, flags, message.empty() ? std::span<u8>{message_copy} : message);
 }
 
 void BSD::RecvWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message);
+    CommitReceive(ctx, message, message_copy, ret, 0);
 
     IPC::ResponseBuilder rb{ctx, 4};
     rb.Push(ResultSuccess);
@@ -109,11 +133,12 @@ void BSD::RecvWork::Response(HLERequestContext& ctx) {
 }
 
 void BSD::RecvFromWork::Execute(BSD* bsd) {
-    std::tie(ret, bsd_errno) = bsd->RecvFromImpl(fd, flags, message, addr);
+    std::tie(ret, bsd_errno) =
+        bsd->RecvFromImpl(fd, flags, message.empty() ? std::span<u8>{message_copy} : message, addr);
 }
 
 void BSD::RecvFromWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message, 0);
+    CommitReceive(ctx, message, message_copy, ret, 0);
     if (!addr.empty()) {
         ctx.WriteBuffer(addr, 1);
     }
@@ -198,12 +223,31 @@ void BSD::Poll(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. nfds={} timeout={}", nfds, timeout);
 
-    ExecuteWork(ctx, PollWork{
-                         .nfds = nfds,
-                         .timeout = timeout,
-                         .read_buffer = ctx.ReadBuffer(),
-                         .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    PollWork work{
+        .nfds = nfds,
+        .timeout = timeout,
+        .read_buffer = ctx.ReadBuffer(),
+        .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
+    };
+    if (socket_waiter && (timeout > 0 || timeout == -1)) {
+        // Poll without blocking, and wait off the service thread when nothing is ready yet
+        work.timeout = 0;
+        work.Execute(this);
+        s32 remaining_timeout = timeout;
+        if (work.ret == 0 && work.bsd_errno == Errno::SUCCESS &&
+            DeferPoll(ctx, work.read_buffer, nfds, remaining_timeout)) {
+            return;
+        }
+        socket_waiter->Cancel(ctx.weak_from_this());
+        if (work.ret == 0 && work.bsd_errno == Errno::SUCCESS && remaining_timeout != 0) {
+            // Sockets the waiter can not wait for block the service thread for the time left
+            work.timeout = remaining_timeout;
+            work.Execute(this);
+        }
+        work.Response(ctx);
+        return;
+    }
+    ExecuteWork(ctx, std::move(work));
 }
 
 void BSD::Accept(HLERequestContext& ctx) {
@@ -212,6 +256,9 @@ void BSD::Accept(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={}", fd);
 
+    if (DeferUntilReady(ctx, fd, 0, Network::PollEvents::In)) {
+        return;
+    }
     ExecuteWork(ctx, AcceptWork{
                          .fd = fd,
                          .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
@@ -355,10 +402,15 @@ void BSD::Recv(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={}", fd, flags, ctx.GetWriteBufferSize());
 
+    if (DeferUntilReady(ctx, fd, flags, Network::PollEvents::In)) {
+        return;
+    }
+    const std::span<u8> message = ctx.GetWriteBufferSpan();
     ExecuteWork(ctx, RecvWork{
                          .fd = fd,
                          .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize()),
+                         .message = message,
+                         .message_copy = MakeReceiveCopy(ctx, message, 0),
                      });
 }
 
@@ -371,10 +423,15 @@ void BSD::RecvFrom(HLERequestContext& ctx) {
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={} addrlen={}", fd, flags,
               ctx.GetWriteBufferSize(0), ctx.GetWriteBufferSize(1));
 
+    if (DeferUntilReady(ctx, fd, flags, Network::PollEvents::In)) {
+        return;
+    }
+    const std::span<u8> message = ctx.GetWriteBufferSpan(0);
     ExecuteWork(ctx, RecvFromWork{
                          .fd = fd,
                          .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize(0)),
+                         .message = message,
+                         .message_copy = MakeReceiveCopy(ctx, message, 0),
                          .addr = std::vector<u8>(ctx.GetWriteBufferSize(1)),
                      });
 }
@@ -387,6 +444,9 @@ void BSD::Send(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={}", fd, flags, ctx.GetReadBufferSize());
 
+    if (DeferUntilReady(ctx, fd, flags, Network::PollEvents::Out)) {
+        return;
+    }
     ExecuteWork(ctx, SendWork{
                          .fd = fd,
                          .flags = flags,
@@ -402,6 +462,9 @@ void BSD::SendTo(HLERequestContext& ctx) {
     LOG_DEBUG(Service, "called. fd={} flags=0x{} len={} addrlen={}", fd, flags,
               ctx.GetReadBufferSize(0), ctx.GetReadBufferSize(1));
 
+    if (DeferUntilReady(ctx, fd, flags, Network::PollEvents::Out)) {
+        return;
+    }
     ExecuteWork(ctx, SendToWork{
                          .fd = fd,
                          .flags = flags,
@@ -416,6 +479,9 @@ void BSD::Write(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={} len={}", fd, ctx.GetReadBufferSize());
 
+    if (DeferUntilReady(ctx, fd, 0, Network::PollEvents::Out)) {
+        return;
+    }
     ExecuteWork(ctx, SendWork{
                          .fd = fd,
                          .flags = 0,
@@ -485,6 +551,82 @@ void BSD::ExecuteWork(HLERequestContext& ctx, Work work) {
     work.Response(ctx);
 }
 
+bool BSD::DeferUntilReady(HLERequestContext& ctx, s32 fd, u32 flags, Network::PollEvents events) {
+    if (!socket_waiter) {
+        return false;
+    }
+    if (fd < 0 || fd >= static_cast<s32>(MAX_FD) || !file_descriptors[fd]) {
+        // Let the call report the error
+        socket_waiter->Cancel(ctx.weak_from_this());
+        return false;
+    }
+    const FileDescriptor& descriptor = *file_descriptors[fd];
+    const bool is_blocking = (descriptor.flags & Network::FLAG_O_NONBLOCK) == 0 &&
+                             (flags & Network::FLAG_MSG_DONTWAIT) == 0;
+    // Proxy sockets have no host socket to wait for
+    const bool is_host_socket = dynamic_cast<Network::Socket*>(descriptor.socket.get()) != nullptr;
+    if (!is_blocking || descriptor.has_timeout || !is_host_socket) {
+        socket_waiter->Cancel(ctx.weak_from_this());
+        return false;
+    }
+
+    std::vector<Network::PollFD> pollfds{{
+        .socket = descriptor.socket.get(),
+        .events = events,
+        .revents = Network::PollEvents{},
+    }};
+    const auto [ready, poll_errno] = Network::Poll(pollfds, 0);
+    if (ready != 0 || poll_errno != Network::Errno::SUCCESS) {
+        // The call can make progress or fails right away, there is nothing to wait for
+        socket_waiter->Cancel(ctx.weak_from_this());
+        return false;
+    }
+    if (!socket_waiter->Wait(ctx.weak_from_this(), {{descriptor.socket, events}},
+                             SocketWaiter::Clock::time_point::max())) {
+        return false;
+    }
+    ctx.SetIsDeferred();
+    return true;
+}
+
+bool BSD::DeferPoll(HLERequestContext& ctx, std::span<const u8> read_buffer, s32 nfds,
+                    s32& timeout) {
+    // The deadline is kept across the runs of the request
+    const auto now = SocketWaiter::Clock::now();
+    const auto deadline = socket_waiter->GetDeadline(ctx.weak_from_this()).value_or(
+        timeout == -1 ? SocketWaiter::Clock::time_point::max()
+                      : now + std::chrono::milliseconds{timeout});
+    if (deadline != SocketWaiter::Clock::time_point::max()) {
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+        timeout = static_cast<s32>(
+            std::clamp<s64>(remaining.count(), 0, std::numeric_limits<s32>::max()));
+    }
+    if (timeout == 0) {
+        return false;
+    }
+
+    std::vector<PollFD> fds(nfds);
+    std::memcpy(fds.data(), read_buffer.data(), nfds * sizeof(PollFD));
+    std::vector<SocketWaiter::Target> targets;
+    targets.reserve(fds.size());
+    for (const PollFD& pollfd : fds) {
+        if (pollfd.fd < 0 || pollfd.fd >= static_cast<s32>(MAX_FD) ||
+            !file_descriptors[pollfd.fd]) {
+            return false;
+        }
+        const auto& socket = file_descriptors[pollfd.fd]->socket;
+        if (dynamic_cast<Network::Socket*>(socket.get()) == nullptr) {
+            return false;
+        }
+        targets.push_back({socket, Translate(pollfd.events)});
+    }
+    if (!socket_waiter->Wait(ctx.weak_from_this(), std::move(targets), deadline)) {
+        return false;
+    }
+    ctx.SetIsDeferred();
+    return true;
+}
+
 std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protocol) {
     if (type == Type::SEQPACKET) {
         UNIMPLEMENTED_MSG("SOCK_SEQPACKET errno management");
@@ -773,8 +915,10 @@ Errno BSD::SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8
     case OptName::RCVBUF:
         return Translate(socket->SetRcvBuf(value));
     case OptName::SNDTIMEO:
+        file_descriptors[fd]->has_timeout |= value != 0;
         return Translate(socket->SetSndTimeo(value));
     case OptName::RCVTIMEO:
+        file_descriptors[fd]->has_timeout |= value != 0;
         return Translate(socket->SetRcvTimeo(value));
     case OptName::NOSIGPIPE:
         LOG_WARNING(Service, "(STUBBED) setting NOSIGPIPE to {}", value);
@@ -793,7 +937,7 @@ Errno BSD::ShutdownImpl(s32 fd, s32 how) {
     return Translate(file_descriptors[fd]->socket->Shutdown(host_how));
 }
 
-std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message) {
+std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::span<u8> message) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
     }
@@ -820,7 +964,7 @@ std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message)
     return {ret, bsd_errno};
 }
 
-std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                         std::vector<u8>& addr) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
@@ -969,8 +1113,9 @@ void BSD::OnProxyPacketReceived(const Network::ProxyPacket& packet) {
     }
 }
 
-BSD::BSD(Core::System& system_, const char* name)
-    : ServiceFramework{system_, name}, room_network{system_.GetRoomNetwork()} {
+BSD::BSD(Core::System& system_, const char* name, std::shared_ptr<SocketWaiter> socket_waiter_)
+    : ServiceFramework{system_, name}, room_network{system_.GetRoomNetwork()},
+      socket_waiter{std::move(socket_waiter_)} {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, &BSD::RegisterClient, "RegisterClient"},
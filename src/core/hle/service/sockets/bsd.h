@@ -12,6 +12,7 @@
 #include "common/socket_types.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sockets/sockets.h"
+#include "core/internal_network/network.h"
 #include "network/network.h"
 
 namespace Core {
@@ -25,9 +26,12 @@ class Socket;
 
 namespace Service::Sockets {
 
+class SocketWaiter;
+
 class BSD final : public ServiceFramework<BSD> {
 public:
-    explicit BSD(Core::System& system_, const char* name);
+    explicit BSD(Core::System& system_, const char* name,
+                 std::shared_ptr<SocketWaiter> socket_waiter_ = nullptr);
     ~BSD() override;
 
     // These methods are called from SSL; the first two are also called from
@@ -45,6 +49,8 @@ private:
         std::shared_ptr<Network::SocketBase> socket;
         s32 flags = 0;
         bool is_connection_based = false;
+        /// A send or receive timeout is set, blocking calls on it are not deferred
+        bool has_timeout = false;
     };
 
     struct PollWork {
@@ -84,7 +90,9 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        /// Output buffer in guest memory, empty when it has to be received into message_copy
+        std::span<u8> message;
+        std::vector<u8> message_copy;
         s32 ret{};
         Errno bsd_errno{};
     };
@@ -95,7 +103,9 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        /// Output buffer in guest memory, empty when it has to be received into message_copy
+        std::span<u8> message;
+        std::vector<u8> message_copy;
         std::vector<u8> addr;
         s32 ret{};
         Errno bsd_errno{};
@@ -152,6 +162,21 @@ private:
     template <typename Work>
     void ExecuteWork(HLERequestContext& ctx, Work work);
 
+    /**
+     * Defers a blocking call until the socket has the given events when running it now would
+     * block the service thread.
+     * @return True when the request was deferred
+     */
+    bool DeferUntilReady(HLERequestContext& ctx, s32 fd, u32 flags, Network::PollEvents events);
+
+    /**
+     * Defers a poll that found no ready socket until one is ready or the timeout expires.
+     * @param timeout Timeout of the poll, set to the time left of it when it is not deferred
+     * @return True when the request was deferred
+     */
+    bool DeferPoll(HLERequestContext& ctx, std::span<const u8> read_buffer, s32 nfds,
+                   s32& timeout);
+
     std::pair<s32, Errno> SocketImpl(Domain domain, Type type, Protocol protocol);
     std::pair<s32, Errno> PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
                                    s32 nfds, s32 timeout);
@@ -165,8 +190,8 @@ private:
     Errno GetSockOptImpl(s32 fd, u32 level, OptName optname, std::vector<u8>& optval);
     Errno SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8> optval);
     Errno ShutdownImpl(s32 fd, s32 how);
-    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::vector<u8>& message);
-    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::span<u8> message);
+    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                        std::vector<u8>& addr);
     std::pair<s32, Errno> SendImpl(s32 fd, u32 flags, std::span<const u8> message);
     std::pair<s32, Errno> SendToImpl(s32 fd, u32 flags, std::span<const u8> message,
@@ -181,6 +206,9 @@ private:
 
     Network::RoomNetwork& room_network;
 
+    /// Waits for the sockets of deferred blocking calls, null when calls block the service thread
+    std::shared_ptr<SocketWaiter> socket_waiter;
+
     /// Callback to parse and handle a received wifi packet.
     void OnProxyPacketReceived(const Network::ProxyPacket& packet);
 
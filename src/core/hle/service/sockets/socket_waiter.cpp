@@ -0,0 +1,232 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/k_event.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/service/sockets/socket_waiter.h"
+#include "core/internal_network/sockets.h"
+
+namespace Service::Sockets {
+
+namespace {
+
+/// Period at which a woken up request is woken up again until it runs, in case it was not
+/// deferred yet when the deferral event was signaled
+constexpr auto ResignalPeriod = std::chrono::milliseconds{10};
+
+/// Time after which the wait of a woken up request that never ran again is dropped, e.g. because
+/// its session was closed
+constexpr auto WokenLifetime = std::chrono::seconds{1};
+
+/// Time to back off when a poll ends without any ready socket, e.g. while the socket operations
+/// are interrupted for shutdown
+constexpr auto InterruptedBackoff = std::chrono::milliseconds{10};
+
+bool IsSameRequest(const SocketWaiter::Request& lhs, const SocketWaiter::Request& rhs) {
+    return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+}
+
+} // Anonymous namespace
+
+SocketWaiter::SocketWaiter(Core::System& system_, Kernel::KEvent* deferral_event_)
+    : system{system_}, deferral_event{deferral_event_} {}
+
+SocketWaiter::~SocketWaiter() {
+    {
+        std::scoped_lock lk{mutex};
+        stop = true;
+        Interrupt();
+    }
+    cv.notify_one();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    deferral_event->Close();
+}
+
+bool SocketWaiter::Wait(const Request& request, std::vector<Target> targets,
+                        Clock::time_point deadline) {
+    {
+        std::scoped_lock lk{mutex};
+        if (failed) {
+            return false;
+        }
+        if (!thread.joinable()) {
+            wake_socket = std::make_unique<Network::Socket>();
+            const Network::SockAddrIn loopback{
+                .family = Network::Domain::INET,
+                .ip = {127, 0, 0, 1},
+                .portno = 0,
+            };
+            Network::Errno error =
+                wake_socket->Initialize(Network::Domain::INET, Network::Type::DGRAM,
+                                        Network::Protocol::UDP);
+            if (error == Network::Errno::SUCCESS) {
+                error = wake_socket->Bind(loopback);
+            }
+            if (error == Network::Errno::SUCCESS) {
+                std::tie(wake_address, error) = wake_socket->GetSockName();
+            }
+            if (error != Network::Errno::SUCCESS) {
+                LOG_ERROR(Service, "Failed to create the socket waiter, error={}", error);
+                wake_socket.reset();
+                failed = true;
+                return false;
+            }
+            thread = system.Kernel().RunOnHostCoreThread("bsdsocket:waiter",
+                                                         [this] { ThreadLoop(); });
+        }
+
+        std::erase_if(watches, [&request](const Watch& watch) {
+            return IsSameRequest(watch.request, request);
+        });
+        watches.push_back(Watch{
+            .request = request,
+            .id = next_id++,
+            .targets = std::move(targets),
+            .deadline = deadline,
+        });
+        changed = true;
+        Interrupt();
+    }
+    cv.notify_one();
+    return true;
+}
+
+void SocketWaiter::Cancel(const Request& request) {
+    std::scoped_lock lk{mutex};
+    // The watch is no longer polled once woken up, the thread does not need to know
+    std::erase_if(watches,
+                  [&request](const Watch& watch) { return IsSameRequest(watch.request, request); });
+}
+
+std::optional<SocketWaiter::Clock::time_point> SocketWaiter::GetDeadline(
+    const Request& request) const {
+    std::scoped_lock lk{mutex};
+    const auto it = std::ranges::find_if(
+        watches, [&request](const Watch& watch) { return IsSameRequest(watch.request, request); });
+    if (it == watches.end()) {
+        return std::nullopt;
+    }
+    return it->deadline;
+}
+
+void SocketWaiter::ThreadLoop() {
+    std::vector<Network::PollFD> pollfds;
+    std::vector<u64> polled_ids;
+    // Keeps the sockets alive while polling, a request may cancel its wait in the meantime
+    std::vector<std::shared_ptr<Network::SocketBase>> polled_sockets;
+
+    std::unique_lock lk{mutex};
+    while (!stop) {
+        const auto now = Clock::now();
+        // Requests whose session was closed while they were deferred never run again
+        std::erase_if(watches, [now](const Watch& watch) {
+            return watch.request.expired() ||
+                   (watch.woken_at && now - *watch.woken_at > WokenLifetime);
+        });
+
+        bool signal = false;
+        auto wakeup = Clock::time_point::max();
+        pollfds.clear();
+        polled_ids.clear();
+        polled_sockets.clear();
+        for (Watch& watch : watches) {
+            if (!watch.woken_at && now >= watch.deadline) {
+                watch.woken_at = now;
+            }
+            if (watch.woken_at) {
+                if (!watch.last_signal || now - *watch.last_signal >= ResignalPeriod) {
+                    watch.last_signal = now;
+                    signal = true;
+                }
+                wakeup = std::min(wakeup, *watch.last_signal + ResignalPeriod);
+                continue;
+            }
+            wakeup = std::min(wakeup, watch.deadline);
+            for (const Target& target : watch.targets) {
+                pollfds.push_back({
+                    .socket = target.socket.get(),
+                    .events = target.events,
+                    .revents = Network::PollEvents{},
+                });
+                polled_ids.push_back(watch.id);
+                polled_sockets.push_back(target.socket);
+            }
+        }
+        changed = false;
+
+        if (signal) {
+            lk.unlock();
+            deferral_event->Signal();
+            lk.lock();
+            continue;
+        }
+        const auto has_changed = [this] { return stop || changed; };
+        if (pollfds.empty()) {
+            if (wakeup == Clock::time_point::max()) {
+                cv.wait(lk, has_changed);
+            } else {
+                cv.wait_until(lk, wakeup, has_changed);
+            }
+            continue;
+        }
+
+        pollfds.push_back({
+            .socket = wake_socket.get(),
+            .events = Network::PollEvents::In,
+            .revents = Network::PollEvents{},
+        });
+        s32 timeout = -1;
+        if (wakeup != Clock::time_point::max()) {
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(wakeup - now);
+            timeout = static_cast<s32>(
+                std::clamp<s64>(remaining.count(), 0, std::numeric_limits<s32>::max()));
+        }
+
+        polling = true;
+        lk.unlock();
+        const auto [result, error] = Network::Poll(pollfds, timeout);
+        lk.lock();
+        polling = false;
+
+        bool woke = false;
+        if (True(pollfds.back().revents & Network::PollEvents::In)) {
+            std::array<u8, 1> byte;
+            wake_socket->RecvFrom(0, byte, nullptr);
+            wake_pending = false;
+            woke = true;
+        }
+        const auto after = Clock::now();
+        for (size_t i = 0; i < polled_ids.size(); ++i) {
+            if (pollfds[i].revents == Network::PollEvents{}) {
+                continue;
+            }
+            const auto it = std::ranges::find(watches, polled_ids[i], &Watch::id);
+            if (it != watches.end() && !it->woken_at) {
+                it->woken_at = after;
+                woke = true;
+            }
+        }
+        if (!woke && (result != 0 || error != Network::Errno::SUCCESS)) {
+            cv.wait_for(lk, InterruptedBackoff, has_changed);
+        }
+    }
+}
+
+void SocketWaiter::Interrupt() {
+    if (!polling || wake_pending) {
+        return;
+    }
+    const std::array<u8, 1> byte{};
+    wake_socket->SendTo(0, byte, &wake_address);
+    wake_pending = true;
+}
+
+} // namespace Service::Sockets
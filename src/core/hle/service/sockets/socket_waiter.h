@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/internal_network/network.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class KEvent;
+}
+
+namespace Network {
+class Socket;
+class SocketBase;
+} // namespace Network
+
+namespace Service::Sockets {
+
+/**
+ * Waits on the host for the sockets of deferred blocking requests, so they do not hold one of the
+ * threads of the sockets service. Signals the deferral event of the service once a request can
+ * make progress or times out; the deferred requests then run again and either complete or wait
+ * again.
+ */
+class SocketWaiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Target {
+        std::shared_ptr<Network::SocketBase> socket;
+        Network::PollEvents events;
+    };
+
+    /// Takes ownership of the deferral event
+    explicit SocketWaiter(Core::System& system_, Kernel::KEvent* deferral_event_);
+    ~SocketWaiter();
+
+    /// Identifies a request by its context, its wait is dropped once the context is destroyed
+    using Request = std::weak_ptr<const void>;
+
+    /**
+     * Waits for any of the targets on behalf of a request, replacing its previous wait.
+     * @param request Identifies the request
+     * @param targets Sockets and the events to wait for on them
+     * @param deadline Time at which the request runs again even if no target is ready
+     * @return False when the sockets can not be waited for, the request has to block instead
+     */
+    bool Wait(const Request& request, std::vector<Target> targets, Clock::time_point deadline);
+
+    /// Forgets the wait of a request, called once it completes
+    void Cancel(const Request& request);
+
+    /// Returns the deadline of the wait of a request, if it has one
+    std::optional<Clock::time_point> GetDeadline(const Request& request) const;
+
+private:
+    struct Watch {
+        /// Keeps the control block of the context alive, a new context can not be mistaken for it
+        Request request;
+        u64 id;
+        std::vector<Target> targets;
+        Clock::time_point deadline;
+        /// Set once the request was woken up, its targets are no longer polled
+        std::optional<Clock::time_point> woken_at;
+        std::optional<Clock::time_point> last_signal;
+    };
+
+    void ThreadLoop();
+
+    /// Interrupts the poll of the thread, if it is polling
+    void Interrupt();
+
+    Core::System& system;
+    Kernel::KEvent* deferral_event;
+
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Watch> watches;
+    u64 next_id{};
+    bool changed{};
+    bool polling{};
+    bool wake_pending{};
+    bool stop{};
+    bool failed{};
+
+    /// Loopback socket written to interrupt a poll when the watches change
+    std::unique_ptr<Network::Socket> wake_socket;
+    Network::SockAddrIn wake_address{};
+
+    /// Started when the first request waits
+    std::jthread thread;
+};
+
+} // namespace Service::Sockets
@@ -5,6 +5,7 @@
 #include "core/hle/service/sockets/bsd.h"
 #include "core/hle/service/sockets/nsd.h"
 #include "core/hle/service/sockets/sfdnsres.h"
+#include "core/hle/service/sockets/socket_waiter.h"
 #include "core/hle/service/sockets/sockets.h"
 
 namespace Service::Sockets {
@@ -12,8 +13,16 @@ namespace Service::Sockets {
 void LoopProcess(Core::System& system) {
     auto server_manager = std::make_unique<ServerManager>(system);
 
-    server_manager->RegisterNamedService("bsd:s", std::make_shared<BSD>(system, "bsd:s"));
-    server_manager->RegisterNamedService("bsd:u", std::make_shared<BSD>(system, "bsd:u"));
+    // Blocking calls are deferred while their sockets are waited for, so a slow call does not
+    // hold one of the service threads
+    Kernel::KEvent* deferral_event{};
+    server_manager->ManageDeferral(&deferral_event);
+    auto socket_waiter = std::make_shared<SocketWaiter>(system, deferral_event);
+
+    server_manager->RegisterNamedService("bsd:s",
+                                         std::make_shared<BSD>(system, "bsd:s", socket_waiter));
+    server_manager->RegisterNamedService("bsd:u",
+                                         std::make_shared<BSD>(system, "bsd:u", socket_waiter));
     server_manager->RegisterNamedService("bsdcfg", std::make_shared<BSDCFG>(system));
     server_manager->RegisterNamedService("nsd:a", std::make_shared<NSD>(system, "nsd:a"));
     server_manager->RegisterNamedService("nsd:u", std::make_shared<NSD>(system, "nsd:u"));
@@ -1,8 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cstring>
+#include <latch>
 #include <vector>
 
 #include "common/common_funcs.h"
@@ -11,6 +14,7 @@
 #include "common/lz4_compression.h"
 #include "common/settings.h"
 #include "common/swap.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/hle/kernel/code_set.h"
@@ -37,20 +41,15 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
-
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
-
-    return uncompressed_data;
-}
-
 constexpr u32 PageAlignSize(u32 size) {
     return static_cast<u32>((size + Core::Memory::YUZU_PAGEMASK) & ~Core::Memory::YUZU_PAGEMASK);
 }
+
+// Shared by every module, so that loading a title doesn't spawn threads per module.
+Common::ThreadWorker& GetDecompressionWorkers() {
+    static Common::ThreadWorker workers{2, "NsoDecompress"};
+    return workers;
+}
 } // Anonymous namespace
 
 bool NSOHeader::IsSegmentCompressed(size_t segment_num) const {
@@ -105,42 +104,89 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         return 0;
     }();
 
-    // Build program image
+    // Determine the program image layout. Each segment ends where its data ends.
     Kernel::CodeSet codeset;
-    Kernel::PhysicalMemory program_image;
+    std::array<u32, 3> segment_data_sizes{};
+    size_t image_end = module_start;
+    size_t segments_end = module_start;
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
-                                                  nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
-        }
-        program_image.resize(module_start + nso_header.segments[i].location +
-                             static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + module_start + nso_header.segments[i].location,
-                    data.data(), data.size());
+        segment_data_sizes[i] = nso_header.IsSegmentCompressed(i)
+                                    ? nso_header.segments[i].size
+                                    : nso_header.segments_compressed_size[i];
+        image_end = module_start + nso_header.segments[i].location + segment_data_sizes[i];
+        segments_end = std::max(segments_end, image_end);
         codeset.segments[i].addr = module_start + nso_header.segments[i].location;
         codeset.segments[i].offset = module_start + nso_header.segments[i].location;
         codeset.segments[i].size = nso_header.segments[i].size;
     }
 
-    if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
+    const bool has_arguments =
+        should_pass_arguments && !Settings::values.program_args.GetValue().empty();
+    const size_t data_end = image_end + (has_arguments ? NSO_ARGUMENT_DATA_ALLOCATION_SIZE : 0);
+    u32 image_size{PageAlignSize(static_cast<u32>(data_end) + nso_header.segments[2].bss_size)};
+
+    // The code layout only depends on the headers, unless the code has to be patched.
+    if (!load_into_process && patches == nullptr) {
+        return load_base + image_size;
+    }
+
+    // Build program image
+    Kernel::PhysicalMemory program_image(std::max<size_t>(image_size, segments_end));
+    std::array<std::vector<u8>, 3> compressed_segments;
+    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+        const auto offset = module_start + nso_header.segments[i].location;
+        if (nso_header.IsSegmentCompressed(i)) {
+            compressed_segments[i] = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
+                                                        nso_header.segments[i].offset);
+        } else {
+            nso_file.Read(program_image.data() + offset, segment_data_sizes[i],
+                          nso_header.segments[i].offset);
+        }
+    }
+
+    // Decompress the segments concurrently, straight into the program image.
+    const auto decompress_segment = [&](std::size_t i) {
+        const auto offset = module_start + nso_header.segments[i].location;
+        const int decompressed_size = Common::Compression::DecompressDataLZ4(
+            program_image.data() + offset, segment_data_sizes[i], compressed_segments[i].data(),
+            compressed_segments[i].size());
+        ASSERT_MSG(decompressed_size == static_cast<int>(nso_header.segments[i].size), "{} != {}",
+                   nso_header.segments[i].size, decompressed_size);
+    };
+    {
+        std::ptrdiff_t num_tasks = 0;
+        for (std::size_t i = 1; i < nso_header.segments.size(); ++i) {
+            num_tasks += nso_header.IsSegmentCompressed(i) ? 1 : 0;
+        }
+
+        std::latch remaining{num_tasks};
+        for (std::size_t i = 1; i < nso_header.segments.size(); ++i) {
+            if (nso_header.IsSegmentCompressed(i)) {
+                GetDecompressionWorkers().QueueWork([&, i] {
+                    decompress_segment(i);
+                    remaining.count_down();
+                });
+            }
+        }
+        if (nso_header.IsSegmentCompressed(0)) {
+            decompress_segment(0);
+        }
+        remaining.wait();
+    }
+    program_image.resize(image_size);
+
+    if (has_arguments) {
         const auto arg_data{Settings::values.program_args.GetValue()};
 
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
-        std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
-        std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
+        std::memcpy(program_image.data() + image_end, &args_header, sizeof(NSOArgumentHeader));
+        std::memcpy(program_image.data() + image_end + sizeof(NSOArgumentHeader), arg_data.data(),
                     arg_data.size());
     }
 
     codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
-    program_image.resize(image_size);
 
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
@@ -151,14 +197,7 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     if (pm && (pm->HasNSOPatch(nso_header.build_id, name) || Settings::values.dump_nso)) {
         std::span<u8> patchable_section(program_image.data() + module_start,
                                         program_image.size() - module_start);
-        std::vector<u8> pi_header(sizeof(NSOHeader) + patchable_section.size());
-        std::memcpy(pi_header.data(), &nso_header, sizeof(NSOHeader));
-        std::memcpy(pi_header.data() + sizeof(NSOHeader), patchable_section.data(),
-                    patchable_section.size());
-
-        pi_header = pm->PatchNSO(pi_header, name);
-
-        std::copy(pi_header.begin() + sizeof(NSOHeader), pi_header.end(), patchable_section.data());
+        pm->PatchNSO(nso_header, patchable_section, name);
     }
 
 #ifdef HAS_NCE
@@ -258,7 +258,7 @@ struct Memory::Impl {
         }
 
         while (remaining_size) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(YUZU_PAGESIZE) - page_offset, remaining_size);
             const auto current_vaddr =
                 static_cast<u64>((page_index << YUZU_PAGEBITS) + page_offset);
@@ -273,6 +273,15 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 u8* mem_ptr =
                     reinterpret_cast<u8*>(pointer + page_offset + (page_index << YUZU_PAGEBITS));
+                // Pages backed by contiguous host memory store the same pointer, so the whole run
+                // can be handed to the callback at once instead of one page at a time.
+                const uintptr_t raw_pointer = page_table.pointers[page_index].Raw();
+                while (copy_amount < remaining_size &&
+                       page_table.pointers[page_index + 1].Raw() == raw_pointer) {
+                    copy_amount += std::min(static_cast<std::size_t>(YUZU_PAGESIZE),
+                                            remaining_size - copy_amount);
+                    ++page_index;
+                }
                 on_memory(copy_amount, mem_ptr);
                 break;
             }
@@ -283,6 +292,17 @@ struct Memory::Impl {
             }
             case Common::PageType::RasterizerCachedMemory: {
                 u8* const host_ptr{GetPointerFromRasterizerCachedMemory(current_vaddr)};
+                // Same for cached pages with contiguous backing, the rasterizer notification is
+                // then issued once for the whole run.
+                const PAddr backing = page_table.backing_addr[page_index];
+                while (copy_amount < remaining_size &&
+                       page_table.pointers[page_index + 1].Type() ==
+                           Common::PageType::RasterizerCachedMemory &&
+                       page_table.backing_addr[page_index + 1] == backing) {
+                    copy_amount += std::min(static_cast<std::size_t>(YUZU_PAGESIZE),
+                                            remaining_size - copy_amount);
+                    ++page_index;
+                }
                 on_rasterizer(current_vaddr, copy_amount, host_ptr);
                 break;
             }
@@ -654,12 +674,14 @@ struct Memory::Impl {
                 base += 1;
             }
         } else {
-            auto orig_base = base;
+            // Both the target and the address advance by a page each page, the offsets from the
+            // address to the host pointer and to the backing address are the same for every page.
+            const auto orig_base = base;
+            const auto host_ptr =
+                reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
+                (base << YUZU_PAGEBITS);
+            const auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
             while (base != end) {
-                auto host_ptr =
-                    reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
-                    (base << YUZU_PAGEBITS);
-                auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
                 page_table.pointers[base].Store(host_ptr, type);
                 page_table.backing_addr[base] = backing;
                 page_table.blocks[base] = orig_base << YUZU_PAGEBITS;
@@ -668,7 +690,6 @@ struct Memory::Impl {
                            "memory mapping base yield a nullptr within the table");
 
                 base += 1;
-                target += YUZU_PAGESIZE;
             }
         }
     }
@@ -800,6 +821,19 @@ struct Memory::Impl {
         return true;
     }
 
+    /// Calls func for each page sized chunk of a range with physically contiguous backing.
+    template <typename Func>
+    static void ForEachPageChunk(VAddr v_address, const u8* p, size_t size, Func&& func) {
+        size_t offset = 0;
+        while (offset < size) {
+            const size_t page_offset = (v_address + offset) & YUZU_PAGEMASK;
+            const size_t chunk =
+                std::min(static_cast<size_t>(YUZU_PAGESIZE) - page_offset, size - offset);
+            func(p + offset, chunk);
+            offset += chunk;
+        }
+    }
+
     void HandleRasterizerDownload(VAddr v_address, size_t size) {
         const auto* p = GetPointerImpl(
             v_address, []() {}, []() {});
@@ -808,13 +842,16 @@ struct Memory::Impl {
         }
         const size_t core = system.GetCurrentHostThreadID();
         auto& current_area = rasterizer_read_areas[core];
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
-            const DAddr end_address = address + size;
-            if (current_area.start_address <= address && end_address <= current_area.end_address)
-                [[likely]] {
-                return;
-            }
-            current_area = system.GPU().OnCPURead(address, size);
+        ForEachPageChunk(v_address, p, size, [&](const u8* page_pointer, size_t page_size) {
+            gpu_device_memory->ApplyOpOnPointer(
+                page_pointer, scratch_buffers[core], [&](DAddr address) {
+                    const DAddr end_address = address + page_size;
+                    if (current_area.start_address <= address &&
+                        end_address <= current_area.end_address) [[likely]] {
+                        return;
+                    }
+                    current_area = system.GPU().OnCPURead(address, page_size);
+                });
         });
     }
 
@@ -836,18 +873,21 @@ struct Memory::Impl {
                 sys_core_guard.unlock();
             }
         };
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
-            auto& current_area = rasterizer_write_areas[core];
-            PAddr subaddress = address >> YUZU_PAGEBITS;
-            bool do_collection = current_area.last_address == subaddress;
-            if (!do_collection) [[unlikely]] {
-                do_collection = system.GPU().OnCPUWrite(address, size);
-                if (!do_collection) {
-                    return;
-                }
-                current_area.last_address = subaddress;
-            }
-            gpu_dirty_managers[core].Collect(address, size);
+        ForEachPageChunk(v_address, p, size, [&](const u8* page_pointer, size_t page_size) {
+            gpu_device_memory->ApplyOpOnPointer(
+                page_pointer, scratch_buffers[core], [&](DAddr address) {
+                    auto& current_area = rasterizer_write_areas[core];
+                    PAddr subaddress = address >> YUZU_PAGEBITS;
+                    bool do_collection = current_area.last_address == subaddress;
+                    if (!do_collection) [[unlikely]] {
+                        do_collection = system.GPU().OnCPUWrite(address, page_size);
+                        if (!do_collection) {
+                            return;
+                        }
+                        current_area.last_address = subaddress;
+                    }
+                    gpu_dirty_managers[core].Collect(address, page_size);
+                });
         });
     }
 
@@ -7,13 +7,13 @@
 #include <mutex>
 #include <numeric>
 #include <sstream>
-#include <thread>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/settings.h"
+#include "common/thread.h"
 #include "core/perf_stats.h"
 
 using namespace std::chrono_literals;
@@ -57,9 +57,15 @@ void PerfStats::BeginSystemFrame() {
     frame_begin = Clock::now();
 }
 
-void PerfStats::EndSystemFrame() {
+void PerfStats::EndSystemFrame(std::optional<Clock::duration> pacing_error) {
     std::scoped_lock lock{object_mutex};
 
+    if (pacing_error) {
+        accumulated_pacing_error += *pacing_error;
+        max_pacing_error = std::max(max_pacing_error, *pacing_error);
+        ++paced_frames;
+    }
+
     auto frame_end = Clock::now();
     const auto frame_time = frame_end - frame_begin;
     if (current_index < perf_history.size()) {
@@ -89,6 +95,22 @@ double PerfStats::GetMeanFrametime() const {
     return sum / static_cast<double>(current_index - IgnoreFrames);
 }
 
+std::vector<double> PerfStats::GetFrametimeHistory() const {
+    std::scoped_lock lock{object_mutex};
+
+    if (current_index <= IgnoreFrames) {
+        return {};
+    }
+    return std::vector<double>(perf_history.begin() + IgnoreFrames,
+                               perf_history.begin() + current_index);
+}
+
+std::size_t PerfStats::GetRecordedFrameCount() const {
+    std::scoped_lock lock{object_mutex};
+
+    return current_index;
+}
+
 PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
     std::scoped_lock lock{object_mutex};
 
@@ -105,6 +127,12 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .pacing_error = paced_frames != 0
+                            ? duration_cast<DoubleSecs>(accumulated_pacing_error).count() /
+                                  static_cast<double>(paced_frames)
+                            : 0.0,
+        .max_pacing_error = duration_cast<DoubleSecs>(max_pacing_error).count(),
+        .memory_usage = Common::GetMemoryUsage(),
     };
 
     // Reset counters
@@ -112,6 +140,9 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     reset_point_system_us = current_system_time_us;
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
+    accumulated_pacing_error = Clock::duration::zero();
+    max_pacing_error = Clock::duration::zero();
+    paced_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
     previous_fps = current_fps;
 
@@ -125,10 +156,11 @@ double PerfStats::GetLastFrameTimeScale() const {
     return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
 }
 
-void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
+std::optional<SpeedLimiter::Clock::duration> SpeedLimiter::DoSpeedLimiting(
+    microseconds current_system_time_us) {
     if (Settings::values.use_multi_core.GetValue() ||
         !Settings::values.use_speed_limit.GetValue()) {
-        return;
+        return std::nullopt;
     }
 
     auto now = Clock::now();
@@ -148,15 +180,21 @@ void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
     speed_limiting_delta_err =
         std::clamp(speed_limiting_delta_err, -max_lag_time_us, max_lag_time_us);
 
+    std::optional<Clock::duration> pacing_error;
     if (speed_limiting_delta_err > microseconds::zero()) {
-        std::this_thread::sleep_for(speed_limiting_delta_err);
+        // Sleeping overshoots by up to a few milliseconds depending on the platform, which shows
+        // up as uneven frame times
+        const auto deadline = now + speed_limiting_delta_err;
+        Common::PreciseSleepUntil(deadline);
         auto now_after_sleep = Clock::now();
+        pacing_error = now_after_sleep - deadline;
         speed_limiting_delta_err -= duration_cast<microseconds>(now_after_sleep - now);
         now = now_after_sleep;
     }
 
     previous_system_time_us = current_system_time_us;
     previous_walltime = now;
+    return pacing_error;
 }
 
 } // namespace Core
@@ -8,7 +8,10 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <optional>
+#include <vector>
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 
 namespace Core {
 
@@ -21,6 +24,13 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Mean time the speed limiter woke up after the deadline of the frames it waited for, in
+    /// seconds
+    double pacing_error;
+    /// Largest time the speed limiter woke up after the deadline of a frame, in seconds
+    double max_pacing_error;
+    /// Host memory in use by each subsystem when the stats were gathered, in bytes
+    Common::MemoryUsage memory_usage;
 };
 
 /**
@@ -35,7 +45,8 @@ public:
     using Clock = std::chrono::steady_clock;
 
     void BeginSystemFrame();
-    void EndSystemFrame();
+    /// Ends a system frame, with how late the speed limiter woke up for it if it waited
+    void EndSystemFrame(std::optional<Clock::duration> pacing_error = std::nullopt);
     void EndGameFrame();
 
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
@@ -45,6 +56,15 @@ public:
      */
     double GetMeanFrametime() const;
 
+    /**
+     * Returns a copy of the frametime values (in milliseconds) stored in the performance history,
+     * excluding the boot frames that are ignored for statistics.
+     */
+    std::vector<double> GetFrametimeHistory() const;
+
+    /// Returns the number of system frames recorded since this object was created.
+    std::size_t GetRecordedFrameCount() const;
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
      * useful for scaling inputs or outputs moving between the two time domains.
@@ -73,6 +93,12 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
+    /// Cumulative pacing error of the system frames the speed limiter waited for since last reset
+    Clock::duration accumulated_pacing_error = Clock::duration::zero();
+    /// Largest pacing error of a system frame since last reset
+    Clock::duration max_pacing_error = Clock::duration::zero();
+    /// Number of system frames the speed limiter waited for since last reset
+    u32 paced_frames = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -88,7 +114,12 @@ class SpeedLimiter {
 public:
     using Clock = std::chrono::steady_clock;
 
-    void DoSpeedLimiting(std::chrono::microseconds current_system_time_us);
+    /**
+     * Waits until the walltime catches up with the emulated time.
+     * @returns How late the wait ended compared to its deadline, nothing when it did not wait
+     */
+    std::optional<Clock::duration> DoSpeedLimiting(
+        std::chrono::microseconds current_system_time_us);
 
 private:
     /// Emulated system time (in microseconds) at the last limiter invocation
@@ -140,20 +140,13 @@ inline InstallResult InstallNSP(Core::System& system, FileSys::VfsFilesystem& vf
         if (src == nullptr || dest == nullptr) {
             return false;
         }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
 
         using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
-
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
+        const auto size = src->GetSize();
+        const auto report_progress = [&](std::size_t offset) { return callback(size, offset); };
+        if (!FileSys::VfsPipelinedCopy(src, dest, 1_MiB, report_progress)) {
+            dest->Resize(0);
+            return false;
         }
         return true;
     };
@@ -206,20 +199,13 @@ inline InstallResult InstallNCA(FileSys::VfsFilesystem& vfs, const std::string&
         if (src == nullptr || dest == nullptr) {
             return false;
         }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
 
         using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
-
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
+        const auto size = src->GetSize();
+        const auto report_progress = [&](std::size_t offset) { return callback(size, offset); };
+        if (!FileSys::VfsPipelinedCopy(src, dest, 1_MiB, report_progress)) {
+            dest->Resize(0);
+            return false;
         }
         return true;
     };
@@ -15,6 +15,8 @@ namespace Core::HID {
 constexpr s32 HID_JOYSTICK_MAX = 0x7fff;
 constexpr s32 HID_TRIGGER_MAX = 0x7fff;
 constexpr u32 TURBO_BUTTON_DELAY = 4;
+// Period the HID services sample motion at, faster sensors are fused but reported at this rate
+constexpr auto MOTION_REFRESH_PERIOD = std::chrono::milliseconds{5};
 // Use a common UUID for TAS and Virtual Gamepad
 constexpr Common::UUID TAS_UUID =
     Common::UUID{{0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xA5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
@@ -415,15 +417,9 @@ void EmulatedController::ReloadInput() {
 
         // Restore motion state
         auto& emulated_motion = controller.motion_values[index].emulated;
-        auto& motion = controller.motion_state[index];
         emulated_motion.ResetRotations();
         emulated_motion.ResetQuaternion();
-        motion.accel = emulated_motion.GetAcceleration();
-        motion.gyro = emulated_motion.GetGyroscope();
-        motion.rotation = emulated_motion.GetRotations();
-        motion.euler = emulated_motion.GetEulerAngles();
-        motion.orientation = emulated_motion.GetOrientation();
-        motion.is_at_rest = !emulated_motion.IsMoving(motion_sensitivity);
+        RefreshMotionState(index);
     }
 
     for (std::size_t index = 0; index < camera_devices.size(); ++index) {
@@ -574,14 +570,22 @@ void EmulatedController::UnloadInput() {
 }
 
 void EmulatedController::EnableConfiguration() {
-    std::scoped_lock lock{connect_mutex, npad_mutex};
-    is_configuring = true;
-    tmp_is_connected = is_connected;
-    tmp_npad_type = npad_type;
+    {
+        std::scoped_lock lock{connect_mutex, npad_mutex};
+        is_configuring = true;
+        tmp_is_connected = is_connected;
+        tmp_npad_type = npad_type;
+    }
+    std::scoped_lock lock{mutex};
+    PublishServiceState();
 }
 
 void EmulatedController::DisableConfiguration() {
     is_configuring = false;
+    {
+        std::scoped_lock lock{mutex};
+        PublishServiceState();
+    }
 
     // Get Joycon colors before turning on the controller
     for (const auto& color_device : color_devices) {
@@ -620,12 +624,14 @@ void EmulatedController::DisableSystemButtons() {
     system_buttons_enabled = false;
     controller.home_button_state.raw = 0;
     controller.capture_button_state.raw = 0;
+    PublishServiceState();
 }
 
 void EmulatedController::ResetSystemButtons() {
     std::scoped_lock lock{mutex};
     controller.home_button_state.home.Assign(false);
     controller.capture_button_state.capture.Assign(false);
+    PublishServiceState();
 }
 
 bool EmulatedController::IsConfiguring() const {
@@ -803,6 +809,8 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
     }
 
     if (!value_changed) {
+        // The turbo setting may still have changed
+        PublishServiceState();
         return;
     }
 
@@ -811,6 +819,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         controller.debug_pad_button_state.raw = 0;
         controller.home_button_state.raw = 0;
         controller.capture_button_state.raw = 0;
+        PublishServiceState();
         lock.unlock();
         TriggerOnChange(ControllerTriggerType::Button, false);
         return;
@@ -915,6 +924,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         break;
     }
 
+    PublishServiceState();
     lock.unlock();
 
     if (!is_connected) {
@@ -937,6 +947,9 @@ void EmulatedController::SetStick(const Common::Input::CallbackStatus& callback,
         TriggerOnChange(ControllerTriggerType::Stick, !is_configuring);
     };
     std::scoped_lock lock{mutex};
+    SCOPE_EXIT {
+        PublishServiceState();
+    };
     const auto stick_value = TransformToStick(callback);
 
     // Only read stick values that have the same uuid or are over the threshold to avoid flapping
@@ -994,6 +1007,9 @@ void EmulatedController::SetTrigger(const Common::Input::CallbackStatus& callbac
         TriggerOnChange(ControllerTriggerType::Trigger, !is_configuring);
     };
     std::scoped_lock lock{mutex};
+    SCOPE_EXIT {
+        PublishServiceState();
+    };
     const auto trigger_value = TransformToTrigger(callback);
 
     // Only read trigger values that have the same uuid or are pressed once
@@ -1038,28 +1054,42 @@ void EmulatedController::SetMotion(const Common::Input::CallbackStatus& callback
     if (index >= controller.motion_values.size()) {
         return;
     }
-    SCOPE_EXIT {
-        TriggerOnChange(ControllerTriggerType::Motion, !is_configuring);
-    };
-    std::scoped_lock lock{mutex};
-    auto& raw_status = controller.motion_values[index].raw_status;
-    auto& emulated = controller.motion_values[index].emulated;
-
-    raw_status = TransformToMotion(callback);
-    emulated.SetAcceleration(Common::Vec3f{
-        raw_status.accel.x.value,
-        raw_status.accel.y.value,
-        raw_status.accel.z.value,
-    });
-    emulated.SetGyroscope(Common::Vec3f{
-        raw_status.gyro.x.value,
-        raw_status.gyro.y.value,
-        raw_status.gyro.z.value,
-    });
-    emulated.SetUserGyroThreshold(raw_status.gyro.x.properties.threshold);
-    emulated.UpdateRotation(raw_status.delta_timestamp);
-    emulated.UpdateOrientation(raw_status.delta_timestamp);
+    {
+        std::scoped_lock lock{mutex};
+        auto& raw_status = controller.motion_values[index].raw_status;
+        auto& emulated = controller.motion_values[index].emulated;
+
+        raw_status = TransformToMotion(callback);
+        emulated.SetAcceleration(Common::Vec3f{
+            raw_status.accel.x.value,
+            raw_status.accel.y.value,
+            raw_status.accel.z.value,
+        });
+        emulated.SetGyroscope(Common::Vec3f{
+            raw_status.gyro.x.value,
+            raw_status.gyro.y.value,
+            raw_status.gyro.z.value,
+        });
+        emulated.SetUserGyroThreshold(raw_status.gyro.x.properties.threshold);
+        emulated.UpdateRotation(raw_status.delta_timestamp);
+        emulated.UpdateOrientation(raw_status.delta_timestamp);
+
+        // Every sample is integrated, but deriving the reported state and notifying the
+        // listeners is only done at the rate the HID services sample motion at
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_motion_refresh[index] < MOTION_REFRESH_PERIOD) {
+            motion_refresh_pending[index] = true;
+            return;
+        }
+        last_motion_refresh[index] = now;
+        RefreshMotionState(index);
+        PublishServiceState();
+    }
+    TriggerOnChange(ControllerTriggerType::Motion, !is_configuring);
+}
 
+void EmulatedController::RefreshMotionState(std::size_t index) {
+    const auto& emulated = controller.motion_values[index].emulated;
     auto& motion = controller.motion_state[index];
     motion.accel = emulated.GetAcceleration();
     motion.gyro = emulated.GetGyroscope();
@@ -1067,6 +1097,7 @@ void EmulatedController::SetMotion(const Common::Input::CallbackStatus& callback
     motion.euler = emulated.GetEulerAngles();
     motion.orientation = emulated.GetOrientation();
     motion.is_at_rest = !emulated.IsMoving(motion_sensitivity);
+    motion_refresh_pending[index] = false;
 }
 
 void EmulatedController::SetColors(const Common::Input::CallbackStatus& callback,
@@ -1857,58 +1888,55 @@ RingAnalogValue EmulatedController::GetRingSensorValues() const {
 }
 
 HomeButtonState EmulatedController::GetHomeButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.home_button_state;
+    return state.home_button_state;
 }
 
 CaptureButtonState EmulatedController::GetCaptureButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.capture_button_state;
+    return state.capture_button_state;
 }
 
 NpadButtonState EmulatedController::GetNpadButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-    return {controller.npad_button_state.raw & GetTurboButtonMask()};
+    return {state.npad_button_state.raw & state.turbo_button_mask};
 }
 
 DebugPadButton EmulatedController::GetDebugPadButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.debug_pad_button_state;
+    return state.debug_pad_button_state;
 }
 
 AnalogSticks EmulatedController::GetSticks() const {
-    std::scoped_lock lock{mutex};
-
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-
-    return controller.analog_stick_state;
+    return state.analog_stick_state;
 }
 
 NpadGcTriggerState EmulatedController::GetTriggers() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = service_button_state.Load();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.gc_trigger_state;
+    return state.gc_trigger_state;
 }
 
 MotionState EmulatedController::GetMotions() const {
-    std::unique_lock lock{mutex};
-    return controller.motion_state;
+    return service_motion_state.Load();
 }
 
 ControllerColors EmulatedController::GetColors() const {
@@ -1975,6 +2003,16 @@ void EmulatedController::DeleteCallback(int key) {
 
 void EmulatedController::StatusUpdate() {
     turbo_button_state = (turbo_button_state + 1) % (TURBO_BUTTON_DELAY * 2);
+    {
+        std::scoped_lock lock{mutex};
+        // Report the samples received since the last refresh
+        for (std::size_t index = 0; index < motion_refresh_pending.size(); ++index) {
+            if (motion_refresh_pending[index]) {
+                RefreshMotionState(index);
+            }
+        }
+        PublishServiceState();
+    }
 
     // Some drivers like key motion need constant refreshing
     for (std::size_t index = 0; index < motion_devices.size(); ++index) {
@@ -1990,6 +2028,20 @@ void EmulatedController::StatusUpdate() {
     }
 }
 
+void EmulatedController::PublishServiceState() {
+    service_button_state.Store({
+        .home_button_state = controller.home_button_state,
+        .capture_button_state = controller.capture_button_state,
+        .npad_button_state = controller.npad_button_state,
+        .debug_pad_button_state = controller.debug_pad_button_state,
+        .analog_stick_state = controller.analog_stick_state,
+        .gc_trigger_state = controller.gc_trigger_state,
+        .turbo_button_mask = GetTurboButtonMask(),
+        .is_configuring = is_configuring,
+    });
+    service_motion_state.Store(controller.motion_state);
+}
+
 NpadButton EmulatedController::GetTurboButtonMask() const {
     // Apply no mask when disabled
     if (turbo_button_state < TURBO_BUTTON_DELAY) {
@@ -13,6 +13,7 @@
 #include "common/common_types.h"
 #include "common/input.h"
 #include "common/param_package.h"
+#include "common/seqlock.h"
 #include "common/settings.h"
 #include "common/vector_math.h"
 #include "hid_core/frontend/motion_input.h"
@@ -117,6 +118,18 @@ enum EmulatedDeviceIndex : u8 {
 
 using MotionState = std::array<ControllerMotion, 2>;
 
+// Button and analog state the HID services read on every update
+struct ServiceButtonState {
+    HomeButtonState home_button_state{};
+    CaptureButtonState capture_button_state{};
+    NpadButtonState npad_button_state{};
+    DebugPadButton debug_pad_button_state{};
+    AnalogSticks analog_stick_state{};
+    NpadGcTriggerState gc_trigger_state{};
+    NpadButton turbo_button_mask{};
+    bool is_configuring{};
+};
+
 struct ControllerStatus {
     // Data from input_common
     ButtonValues button_values{};
@@ -570,6 +583,12 @@ private:
 
     NpadButton GetTurboButtonMask() const;
 
+    /// Publishes the state read by the HID services, the mutex must be held
+    void PublishServiceState();
+
+    /// Derives the reported motion state from the fused samples, the mutex must be held
+    void RefreshMotionState(std::size_t index);
+
     const NpadIdType npad_id_type;
     NpadStyleIndex npad_type{NpadStyleIndex::None};
     NpadStyleIndex original_npad_type{NpadStyleIndex::None};
@@ -584,6 +603,8 @@ private:
     std::array<VibrationValue, 2> last_vibration_value{DEFAULT_VIBRATION_VALUE,
                                                        DEFAULT_VIBRATION_VALUE};
     std::array<std::chrono::steady_clock::time_point, 2> last_vibration_timepoint{};
+    std::array<std::chrono::steady_clock::time_point, 2> last_motion_refresh{};
+    std::array<bool, 2> motion_refresh_pending{};
 
     // Temporary values to avoid doing changes while the controller is in configuring mode
     NpadStyleIndex tmp_npad_type{NpadStyleIndex::None};
@@ -635,6 +656,10 @@ private:
 
     // Stores the current status of all controller input
     ControllerStatus controller;
+
+    // Copies of the controller status read by the HID services without taking the mutex
+    Common::SeqLock<ServiceButtonState> service_button_state;
+    Common::SeqLock<MotionState> service_motion_state;
 };
 
 } // namespace Core::HID
@@ -98,7 +98,10 @@ void MotionInput::ResetQuaternion() {
 }
 
 bool MotionInput::IsMoving(f32 sensitivity) const {
-    return gyro.Length() >= sensitivity || accel.Length() <= 0.9f || accel.Length() >= 1.1f;
+    // Squared lengths avoid the square roots
+    const f32 accel_length2 = accel.Length2();
+    return gyro.Length2() >= sensitivity * sensitivity || accel_length2 <= 0.9f * 0.9f ||
+           accel_length2 >= 1.1f * 1.1f;
 }
 
 bool MotionInput::IsCalibrated(f32 sensitivity) const {
@@ -144,7 +147,8 @@ void MotionInput::UpdateOrientation(u64 elapsed_time) {
         return;
     }
 
-    const auto normal_accel = accel.Normalized();
+    const f32 accel_length = accel.Length();
+    const auto normal_accel = accel / accel_length;
     auto rad_gyro = gyro * Common::PI * 2;
     const f32 swap = rad_gyro.x;
     rad_gyro.x = rad_gyro.y;
@@ -159,7 +163,7 @@ void MotionInput::UpdateOrientation(u64 elapsed_time) {
     }
 
     // Ignore drift correction if acceleration is not reliable
-    if (accel.Length() >= 0.75f && accel.Length() <= 1.25f) {
+    if (accel_length >= 0.75f && accel_length <= 1.25f) {
         const f32 ax = -normal_accel.x;
         const f32 ay = normal_accel.y;
         const f32 az = -normal_accel.z;
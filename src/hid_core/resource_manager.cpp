@@ -47,46 +47,29 @@ constexpr auto default_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000}; //
 constexpr auto mouse_keyboard_update_ns = std::chrono::nanoseconds{8 * 1000 * 1000}; // (8ms, 125Hz)
 constexpr auto motion_update_ns = std::chrono::nanoseconds{5 * 1000 * 1000};         // (5ms, 200Hz)
 
+// All devices update from a single tick, the period of each device must be a multiple of it
+constexpr auto input_update_ns = npad_update_ns;
+static_assert(default_update_ns % input_update_ns == std::chrono::nanoseconds{0});
+static_assert(mouse_keyboard_update_ns % input_update_ns == std::chrono::nanoseconds{0});
+static_assert(motion_update_ns % input_update_ns == std::chrono::nanoseconds{0});
+
 ResourceManager::ResourceManager(Core::System& system_,
                                  std::shared_ptr<HidFirmwareSettings> settings)
     : firmware_settings{settings}, system{system_}, service_context{system_, "hid"} {
     applet_resource = std::make_shared<AppletResource>(system);
 
-    // Register update callbacks
-    npad_update_event = Core::Timing::CreateEvent("HID::UpdatePadCallback",
-                                                  [this](s64 time, std::chrono::nanoseconds ns_late)
-                                                      -> std::optional<std::chrono::nanoseconds> {
-                                                      UpdateNpad(ns_late);
-                                                      return std::nullopt;
-                                                  });
-    default_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateDefaultCallback",
-        [this](s64 time,
-               std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateControllers(ns_late);
-            return std::nullopt;
-        });
-    mouse_keyboard_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateMouseKeyboardCallback",
-        [this](s64 time,
-               std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateMouseKeyboard(ns_late);
-            return std::nullopt;
-        });
-    motion_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateMotionCallback",
+    // Register update callback
+    input_update_event = Core::Timing::CreateEvent(
+        "HID::UpdateInputCallback",
         [this](s64 time,
                std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateMotion(ns_late);
+            UpdateInput(ns_late);
             return std::nullopt;
         });
 }
 
 ResourceManager::~ResourceManager() {
-    system.CoreTiming().UnscheduleEvent(npad_update_event);
-    system.CoreTiming().UnscheduleEvent(default_update_event);
-    system.CoreTiming().UnscheduleEvent(mouse_keyboard_update_event);
-    system.CoreTiming().UnscheduleEvent(motion_update_event);
+    system.CoreTiming().UnscheduleEvent(input_update_event);
     system.CoreTiming().UnscheduleEvent(touch_update_event);
     input_event->Finalize();
 };
@@ -248,13 +231,7 @@ void ResourceManager::InitializeHidCommonSampler() {
     sleep_button->SetAppletResource(applet_resource, &shared_mutex);
     capture_button->SetAppletResource(applet_resource, &shared_mutex);
 
-    system.CoreTiming().ScheduleLoopingEvent(npad_update_ns, npad_update_ns, npad_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(default_update_ns, default_update_ns,
-                                             default_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(mouse_keyboard_update_ns, mouse_keyboard_update_ns,
-                                             mouse_keyboard_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(motion_update_ns, motion_update_ns,
-                                             motion_update_event);
+    system.CoreTiming().ScheduleLoopingEvent(input_update_ns, input_update_ns, input_update_event);
 }
 
 void ResourceManager::InitializeTouchScreenSampler() {
@@ -470,6 +447,28 @@ Result ResourceManager::GetTouchScreenFirmwareVersion(Core::HID::FirmwareVersion
     return ResultSuccess;
 }
 
+void ResourceManager::UpdateInput(std::chrono::nanoseconds ns_late) {
+    const u64 tick = ++input_update_ticks;
+    const auto is_due = [tick](std::chrono::nanoseconds period) {
+        return tick % static_cast<u64>(period / input_update_ns) == 0;
+    };
+
+    // Devices lock the shared memory again, taking it once makes those uncontended
+    std::scoped_lock shared_lock{shared_mutex};
+    if (is_due(npad_update_ns)) {
+        UpdateNpad(ns_late);
+    }
+    if (is_due(default_update_ns)) {
+        UpdateControllers(ns_late);
+    }
+    if (is_due(mouse_keyboard_update_ns)) {
+        UpdateMouseKeyboard(ns_late);
+    }
+    if (is_due(motion_update_ns)) {
+        UpdateMotion(ns_late);
+    }
+}
+
 void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
     auto& core_timing = system.CoreTiming();
     debug_pad->OnUpdate(core_timing);
@@ -109,6 +109,7 @@ public:
 
     Result GetTouchScreenFirmwareVersion(Core::HID::FirmwareVersion& firmware) const;
 
+    void UpdateInput(std::chrono::nanoseconds ns_late);
     void UpdateControllers(std::chrono::nanoseconds ns_late);
     void UpdateNpad(std::chrono::nanoseconds ns_late);
     void UpdateMouseKeyboard(std::chrono::nanoseconds ns_late);
@@ -147,10 +148,9 @@ private:
     std::shared_ptr<SixAxis> six_axis{nullptr};
     std::shared_ptr<SleepButton> sleep_button{nullptr};
     std::shared_ptr<UniquePad> unique_pad{nullptr};
-    std::shared_ptr<Core::Timing::EventType> npad_update_event;
-    std::shared_ptr<Core::Timing::EventType> default_update_event;
-    std::shared_ptr<Core::Timing::EventType> mouse_keyboard_update_event;
-    std::shared_ptr<Core::Timing::EventType> motion_update_event;
+    std::shared_ptr<Core::Timing::EventType> input_update_event;
+    /// Number of input update ticks so far, devices update every few ticks
+    u64 input_update_ticks{};
 
     // TODO: Create these resources
     // std::shared_ptr<AudioControl> audio_control{nullptr};
@@ -45,6 +45,10 @@ void Packet::Clear() {
     is_valid = true;
 }
 
+void Packet::Reserve(std::size_t size_in_bytes) {
+    data.reserve(size_in_bytes);
+}
+
 const void* Packet::GetData() const {
     return !data.empty() ? &data[0] : nullptr;
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
 #include <vector>
 #include "common/common_types.h"
 
@@ -15,6 +16,11 @@ public:
     Packet() = default;
     ~Packet() = default;
 
+    Packet(const Packet&) = default;
+    Packet& operator=(const Packet&) = default;
+    Packet(Packet&&) noexcept = default;
+    Packet& operator=(Packet&&) noexcept = default;
+
     /**
      * Append data to the end of the packet
      * @param data        Pointer to the sequence of bytes to append
@@ -31,10 +37,16 @@ public:
 
     /**
      * Clear the packet
-     * After calling Clear, the packet is empty.
+     * After calling Clear, the packet is empty, but keeps its storage for reuse.
      */
     void Clear();
 
+    /**
+     * Allocates storage for the given number of bytes
+     * @param size_in_bytes Number of bytes the packet can hold without reallocating
+     */
+    void Reserve(std::size_t size_in_bytes);
+
     /**
      * Ignores bytes while reading
      * @param length THe number of bytes to ignore
@@ -123,7 +135,11 @@ Packet& Packet::Read(std::vector<T>& out_data) {
     Read(size);
     out_data.resize(size);
 
-    // Then extract the data
+    // Then extract the data, bytes need no conversion and are copied at once
+    if constexpr (sizeof(T) == 1 && std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>) {
+        Read(out_data.data(), out_data.size());
+        return *this;
+    }
     for (std::size_t i = 0; i < out_data.size(); ++i) {
         T character;
         Read(character);
@@ -148,6 +164,10 @@ Packet& Packet::Write(const std::vector<T>& in_data) {
     Write(static_cast<u32>(in_data.size()));
 
     // Then insert the data
+    if constexpr (sizeof(T) == 1 && std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>) {
+        Append(in_data.data(), in_data.size());
+        return *this;
+    }
     for (std::size_t i = 0; i < in_data.size(); ++i) {
         Write(in_data[i]);
     }
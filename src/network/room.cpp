@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <mutex>
 #include <random>
@@ -48,6 +50,13 @@ public:
     IPBanList ip_ban_list;             ///< List of banned IP addresses
     mutable std::mutex ban_list_mutex; ///< Mutex for the ban lists
 
+    /// Traffic counters, written by the room thread and read by GetStatistics
+    std::atomic<u64> packets_received{};
+    std::atomic<u64> bytes_received{};
+    std::atomic<u64> packets_relayed{};
+    std::atomic<u64> bytes_relayed{};
+    Statistics logged_statistics{}; ///< Counters at the last traffic summary
+
     RoomImpl() : random_gen(std::random_device()()) {}
 
     /// Thread that receives and dispatches network packets
@@ -60,6 +69,12 @@ public:
     void ServerLoop();
     void StartLoop();
 
+    /// Dispatches an event received by the server
+    void HandleEvent(ENetEvent& event);
+
+    /// Logs the traffic of the room since the previous call
+    void LogStatistics(std::chrono::steady_clock::duration elapsed);
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -217,6 +232,16 @@ public:
      */
     void HandleLdnPacket(const ENetEvent* event);
 
+    /**
+     * Sends a received packet on to the member with the given address, or to all members except
+     * the sender when broadcasting. Every destination shares a single copy of the data.
+     * @param event The ENet event containing the data
+     * @param destination_address Fake IP address of the destination member
+     * @param broadcast Whether to send the data to all members instead
+     */
+    void RelayPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                     bool broadcast);
+
     /**
      * Extracts a chat entry from a received ENet packet and adds it to the chat queue.
      * @param event The ENet event that was received.
@@ -238,56 +263,104 @@ public:
 
 // RoomImpl
 void Room::RoomImpl::ServerLoop() {
+    // Interval between the traffic summaries written to the log
+    constexpr auto statistics_interval = std::chrono::minutes(1);
+    auto last_statistics = std::chrono::steady_clock::now();
+
     while (state != State::Closed) {
         ENetEvent event;
         if (enet_host_service(server, &event, 5) > 0) {
-            switch (event.type) {
-            case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdJoinRequest:
-                    HandleJoinRequest(&event);
-                    break;
-                case IdSetGameInfo:
-                    HandleGameInfoPacket(&event);
-                    break;
-                case IdProxyPacket:
-                    HandleProxyPacket(&event);
-                    break;
-                case IdLdnPacket:
-                    HandleLdnPacket(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                // Moderation
-                case IdModKick:
-                    HandleModKickPacket(&event);
-                    break;
-                case IdModBan:
-                    HandleModBanPacket(&event);
-                    break;
-                case IdModUnban:
-                    HandleModUnbanPacket(&event);
-                    break;
-                case IdModGetBanList:
-                    HandleModGetBanListPacket(&event);
-                    break;
-                }
-                enet_packet_destroy(event.packet);
-                break;
-            case ENET_EVENT_TYPE_DISCONNECT:
-                HandleClientDisconnection(event.peer);
-                break;
-            case ENET_EVENT_TYPE_NONE:
-            case ENET_EVENT_TYPE_CONNECT:
-                break;
+            HandleEvent(event);
+            // Drain the events already received before sending, so the packets queued for each
+            // member while handling them go out together instead of one flush per packet
+            while (enet_host_check_events(server, &event) > 0) {
+                HandleEvent(event);
             }
+            enet_host_flush(server);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_statistics >= statistics_interval) {
+            LogStatistics(now - last_statistics);
+            last_statistics = now;
         }
     }
     // Close the connection to all members:
     SendCloseMessage();
 }
 
+void Room::RoomImpl::HandleEvent(ENetEvent& event) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_RECEIVE:
+        packets_received.fetch_add(1, std::memory_order_relaxed);
+        bytes_received.fetch_add(event.packet->dataLength, std::memory_order_relaxed);
+        switch (event.packet->data[0]) {
+        case IdJoinRequest:
+            HandleJoinRequest(&event);
+            break;
+        case IdSetGameInfo:
+            HandleGameInfoPacket(&event);
+            break;
+        case IdProxyPacket:
+            HandleProxyPacket(&event);
+            break;
+        case IdLdnPacket:
+            HandleLdnPacket(&event);
+            break;
+        case IdChatMessage:
+            HandleChatPacket(&event);
+            break;
+        // Moderation
+        case IdModKick:
+            HandleModKickPacket(&event);
+            break;
+        case IdModBan:
+            HandleModBanPacket(&event);
+            break;
+        case IdModUnban:
+            HandleModUnbanPacket(&event);
+            break;
+        case IdModGetBanList:
+            HandleModGetBanListPacket(&event);
+            break;
+        }
+        enet_packet_destroy(event.packet);
+        break;
+    case ENET_EVENT_TYPE_DISCONNECT:
+        HandleClientDisconnection(event.peer);
+        break;
+    case ENET_EVENT_TYPE_NONE:
+    case ENET_EVENT_TYPE_CONNECT:
+        break;
+    }
+}
+
+void Room::RoomImpl::LogStatistics(std::chrono::steady_clock::duration elapsed) {
+    static constexpr auto load = [](const std::atomic<u64>& counter) {
+        return counter.load(std::memory_order_relaxed);
+    };
+    const Statistics& last = logged_statistics;
+    const Statistics current{
+        .packets_received = load(packets_received),
+        .bytes_received = load(bytes_received),
+        .packets_relayed = load(packets_relayed),
+        .bytes_relayed = load(bytes_relayed),
+    };
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    if (current.packets_received != last.packets_received) {
+        LOG_INFO(Network,
+                 "Room traffic: in {:.0f} packets/s ({:.1f} KiB/s), "
+                 "relayed {:.0f} packets/s ({:.1f} KiB/s)",
+                 static_cast<double>(current.packets_received - last.packets_received) / seconds,
+                 static_cast<double>(current.bytes_received - last.bytes_received) / seconds /
+                     1024.0,
+                 static_cast<double>(current.packets_relayed - last.packets_relayed) / seconds,
+                 static_cast<double>(current.bytes_relayed - last.bytes_relayed) / seconds /
+                     1024.0);
+    }
+    logged_statistics = current;
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread = std::make_unique<std::thread>(&Room::RoomImpl::ServerLoop, this);
 }
@@ -813,104 +886,58 @@ IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
 }
 
 void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
-    in_packet.IgnoreBytes(sizeof(u8)); // Message type
-
-    in_packet.IgnoreBytes(sizeof(u8));          // Domain
-    in_packet.IgnoreBytes(sizeof(IPv4Address)); // IP
-    in_packet.IgnoreBytes(sizeof(u16));         // Port
-
-    in_packet.IgnoreBytes(sizeof(u8)); // Domain
-    IPv4Address remote_ip;
-    in_packet.Read(remote_ip);          // IP
-    in_packet.IgnoreBytes(sizeof(u16)); // Port
-
-    in_packet.IgnoreBytes(sizeof(u8)); // Protocol
-
-    bool broadcast;
-    in_packet.Read(broadcast); // Broadcast
-
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
+    // Only the routing fields are needed, read them in place instead of copying the payload
+    // Message type, the local domain, IP and port, then the remote domain
+    constexpr size_t remote_ip_offset = 3 * sizeof(u8) + sizeof(IPv4Address) + sizeof(u16);
+    // Remote IP, then its port and the protocol
+    constexpr size_t broadcast_offset =
+        remote_ip_offset + sizeof(IPv4Address) + sizeof(u16) + sizeof(u8);
+    if (event->packet->dataLength <= broadcast_offset) {
+        LOG_ERROR(Network, "Received a truncated proxy packet");
+        return;
     }
-    enet_host_flush(server);
+    const u8* const data = event->packet->data;
+    IPv4Address remote_ip;
+    std::memcpy(remote_ip.data(), data + remote_ip_offset, sizeof(IPv4Address));
+    RelayPacket(event, remote_ip, data[broadcast_offset] != 0);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
-
-    in_packet.IgnoreBytes(sizeof(u8)); // Message type
-
-    in_packet.IgnoreBytes(sizeof(u8));          // LAN packet type
-    in_packet.IgnoreBytes(sizeof(IPv4Address)); // Local IP
-
+    // Message type, LAN packet type and local IP
+    constexpr size_t remote_ip_offset = 2 * sizeof(u8) + sizeof(IPv4Address);
+    constexpr size_t broadcast_offset = remote_ip_offset + sizeof(IPv4Address);
+    if (event->packet->dataLength <= broadcast_offset) {
+        LOG_ERROR(Network, "Received a truncated LDN packet");
+        return;
+    }
+    const u8* const data = event->packet->data;
     IPv4Address remote_ip;
-    in_packet.Read(remote_ip); // Remote IP
-
-    bool broadcast;
-    in_packet.Read(broadcast); // Broadcast
+    std::memcpy(remote_ip.data(), data + remote_ip_offset, sizeof(IPv4Address));
+    RelayPacket(event, remote_ip, data[broadcast_offset] != 0);
+}
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
+void Room::RoomImpl::RelayPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                                 bool broadcast) {
+    // ENet reference counts the packet, it is freed once sent to the last destination
+    ENetPacket* enet_packet = enet_packet_create(event->packet->data, event->packet->dataLength,
                                                  ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
+    u64 num_destinations = 0;
     if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
+        std::shared_lock lock(member_mutex);
         for (const auto& member : members) {
             if (member.peer != event->peer) {
-                sent_packet = true;
+                ++num_destinations;
                 enet_peer_send(member.peer, 0, enet_packet);
             }
         }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else {
-        std::lock_guard lock(member_mutex);
+    } else { // Send the data only to the destination client
+        std::shared_lock lock(member_mutex);
         auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
+                                   [&destination_address](const Member& member_entry) -> bool {
                                        return member_entry.fake_ip == destination_address;
                                    });
         if (member != members.end()) {
+            ++num_destinations;
             enet_peer_send(member->peer, 0, enet_packet);
         } else {
             LOG_ERROR(Network,
@@ -918,10 +945,15 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
                       "{}.{}.{}.{}",
                       destination_address[0], destination_address[1], destination_address[2],
                       destination_address[3]);
-            enet_packet_destroy(enet_packet);
         }
     }
-    enet_host_flush(server);
+    if (num_destinations == 0) {
+        enet_packet_destroy(enet_packet);
+        return;
+    }
+    packets_relayed.fetch_add(num_destinations, std::memory_order_relaxed);
+    bytes_relayed.fetch_add(num_destinations * event->packet->dataLength,
+                            std::memory_order_relaxed);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
@@ -1117,6 +1149,15 @@ bool Room::HasPassword() const {
     return !room_impl->password.empty();
 }
 
+Room::Statistics Room::GetStatistics() const {
+    return {
+        .packets_received = room_impl->packets_received.load(std::memory_order_relaxed),
+        .bytes_received = room_impl->bytes_received.load(std::memory_order_relaxed),
+        .packets_relayed = room_impl->packets_relayed.load(std::memory_order_relaxed),
+        .bytes_relayed = room_impl->bytes_relayed.load(std::memory_order_relaxed),
+    };
+}
+
 void Room::SetVerifyUID(const std::string& uid) {
     std::lock_guard lock(room_impl->verify_uid_mutex);
     room_impl->verify_uid = uid;
@@ -1138,6 +1179,11 @@ void Room::Destroy() {
     }
     room_impl->room_information.member_slots = 0;
     room_impl->room_information.name.clear();
+    room_impl->packets_received = 0;
+    room_impl->bytes_received = 0;
+    room_impl->packets_relayed = 0;
+    room_impl->bytes_relayed = 0;
+    room_impl->logged_statistics = {};
 }
 
 } // namespace Network
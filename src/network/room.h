@@ -80,6 +80,14 @@ public:
         Closed, ///< The room is not opened and can not accept connections.
     };
 
+    /// Traffic counters of the room since it was created
+    struct Statistics {
+        u64 packets_received; ///< Packets received from the members
+        u64 bytes_received;   ///< Payload bytes received from the members
+        u64 packets_relayed;  ///< Proxy and LDN packets sent on, once per destination
+        u64 bytes_relayed;    ///< Payload bytes sent on, once per destination
+    };
+
     Room();
     ~Room();
 
@@ -108,6 +116,11 @@ public:
      */
     bool HasPassword() const;
 
+    /**
+     * Gets the traffic counters of the room.
+     */
+    Statistics GetStatistics() const;
+
     using UsernameBanList = std::vector<std::string>;
     using IPBanList = std::vector<std::string>;
 
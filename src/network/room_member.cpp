@@ -2,7 +2,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
-#include <list>
 #include <mutex>
 #include <set>
 #include <thread>
@@ -16,6 +15,9 @@ namespace Network {
 
 constexpr u32 ConnectionTimeoutMs = 5000;
 
+/// Number of sent packets kept around to serialize the next ones without allocating
+constexpr size_t MaxPooledPackets = 64;
+
 class RoomMember::RoomMemberImpl {
 public:
     ENetHost* client = nullptr; ///< ENet network interface.
@@ -44,8 +46,15 @@ public:
     std::mutex network_mutex; ///< Mutex that controls access to the `client` variable.
     /// Thread that receives and dispatches network packets
     std::unique_ptr<std::thread> loop_thread;
-    std::mutex send_list_mutex;  ///< Mutex that controls access to the `send_list` variable.
-    std::list<Packet> send_list; ///< A list that stores all packets to send the async
+    /// Mutex that controls access to the `send_list` and `free_packets` variables.
+    std::mutex send_list_mutex;
+    std::vector<Packet> send_list;    ///< A list that stores all packets to send the async
+    std::vector<Packet> free_packets; ///< Sent packets whose storage can be reused
+
+    /// Reused by the loop thread to parse the received packets without allocating
+    Packet received_packet;
+    ProxyPacket received_proxy_packet{};
+    LDNPacket received_ldn_packet{};
 
     template <typename T>
     using CallbackSet = std::set<CallbackHandle<T>>;
@@ -78,6 +87,11 @@ public:
      */
     void Send(Packet&& packet);
 
+    /**
+     * Returns an empty packet, reusing the storage of a sent packet when there is one.
+     */
+    Packet AcquirePacket();
+
     /**
      * Sends a request to the server, asking for permission to join a room with the specified
      * nickname and preferred fake ip.
@@ -162,6 +176,7 @@ bool RoomMember::RoomMemberImpl::IsConnected() const {
 }
 
 void RoomMember::RoomMemberImpl::MemberLoop() {
+    std::vector<Packet> packets;
     // Receive packets while the connection is open
     while (IsConnected()) {
         std::lock_guard lock(network_mutex);
@@ -257,17 +272,30 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
                 break;
             }
         }
-        std::list<Packet> packets;
         {
             std::lock_guard send_lock(send_list_mutex);
             packets.swap(send_list);
         }
+        if (packets.empty()) {
+            continue;
+        }
         for (const auto& packet : packets) {
             ENetPacket* enetPacket = enet_packet_create(packet.GetData(), packet.GetDataSize(),
                                                         ENET_PACKET_FLAG_RELIABLE);
             enet_peer_send(server, 0, enetPacket);
         }
         enet_host_flush(client);
+
+        // ENet copied the data, hand the storage back for the next packets
+        std::lock_guard send_lock(send_list_mutex);
+        for (auto& packet : packets) {
+            if (free_packets.size() >= MaxPooledPackets) {
+                break;
+            }
+            packet.Clear();
+            free_packets.push_back(std::move(packet));
+        }
+        packets.clear();
     }
     Disconnect();
 };
@@ -281,6 +309,16 @@ void RoomMember::RoomMemberImpl::Send(Packet&& packet) {
     send_list.push_back(std::move(packet));
 }
 
+Packet RoomMember::RoomMemberImpl::AcquirePacket() {
+    std::lock_guard lock(send_list_mutex);
+    if (free_packets.empty()) {
+        return {};
+    }
+    Packet packet = std::move(free_packets.back());
+    free_packets.pop_back();
+    return packet;
+}
+
 void RoomMember::RoomMemberImpl::SendJoinRequest(const std::string& nickname_,
                                                  const IPv4Address& preferred_fake_ip,
                                                  const std::string& password,
@@ -352,8 +390,14 @@ void RoomMember::RoomMemberImpl::HandleJoinPacket(const ENetEvent* event) {
 }
 
 void RoomMember::RoomMemberImpl::HandleProxyPackets(const ENetEvent* event) {
-    ProxyPacket proxy_packet{};
-    Packet packet;
+    // Only the header is reset, the data keeps its storage from the previous packets
+    ProxyPacket& proxy_packet = received_proxy_packet;
+    proxy_packet.local_endpoint = {};
+    proxy_packet.remote_endpoint = {};
+    proxy_packet.protocol = {};
+    proxy_packet.broadcast = false;
+    Packet& packet = received_packet;
+    packet.Clear();
     packet.Append(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
@@ -383,8 +427,14 @@ void RoomMember::RoomMemberImpl::HandleProxyPackets(const ENetEvent* event) {
 }
 
 void RoomMember::RoomMemberImpl::HandleLdnPackets(const ENetEvent* event) {
-    LDNPacket ldn_packet{};
-    Packet packet;
+    // Only the header is reset, the data keeps its storage from the previous packets
+    LDNPacket& ldn_packet = received_ldn_packet;
+    ldn_packet.type = {};
+    ldn_packet.local_ip = {};
+    ldn_packet.remote_ip = {};
+    ldn_packet.broadcast = false;
+    Packet& packet = received_packet;
+    packet.Clear();
     packet.Append(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
@@ -625,7 +675,7 @@ bool RoomMember::IsConnected() const {
 }
 
 void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
-    Packet packet;
+    Packet packet = room_member_impl->AcquirePacket();
     packet.Write(static_cast<u8>(IdProxyPacket));
 
     packet.Write(static_cast<u8>(proxy_packet.local_endpoint.family));
@@ -644,16 +694,28 @@ void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
 }
 
 void RoomMember::SendLdnPacket(const LDNPacket& ldn_packet) {
-    Packet packet;
+    SendLdnPacket(ldn_packet.type, ldn_packet.local_ip, ldn_packet.remote_ip, ldn_packet.broadcast,
+                  ldn_packet.data);
+}
+
+void RoomMember::SendLdnPacket(LDNPacketType type, const IPv4Address& local_ip,
+                               const IPv4Address& remote_ip, bool broadcast,
+                               std::span<const u8> data) {
+    // Message id, type, both IP addresses, broadcast flag and payload size
+    constexpr size_t header_size = 3 * sizeof(u8) + 2 * sizeof(IPv4Address) + sizeof(u32);
+    Packet packet = room_member_impl->AcquirePacket();
+    packet.Reserve(header_size + data.size());
     packet.Write(static_cast<u8>(IdLdnPacket));
 
-    packet.Write(static_cast<u8>(ldn_packet.type));
+    packet.Write(static_cast<u8>(type));
 
-    packet.Write(ldn_packet.local_ip);
-    packet.Write(ldn_packet.remote_ip);
-    packet.Write(ldn_packet.broadcast);
+    packet.Write(local_ip);
+    packet.Write(remote_ip);
+    packet.Write(broadcast);
 
-    packet.Write(ldn_packet.data);
+    // Same layout as writing a std::vector<u8>
+    packet.Write(static_cast<u32>(data.size()));
+    packet.Append(data.data(), data.size());
 
     room_member_impl->Send(std::move(packet));
 }
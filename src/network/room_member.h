@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 #include "common/announce_multiplayer_room.h"
@@ -174,6 +175,17 @@ public:
      */
     void SendLdnPacket(const LDNPacket& packet);
 
+    /**
+     * Sends an LDN packet to the room, serializing the payload straight from the given view.
+     * @param type The type of the LDN packet.
+     * @param local_ip The fake IP address of the sender.
+     * @param remote_ip The fake IP address of the destination, unused when broadcasting.
+     * @param broadcast Whether the packet is sent to all members of the room.
+     * @param data The payload of the packet.
+     */
+    void SendLdnPacket(LDNPacketType type, const IPv4Address& local_ip,
+                       const IPv4Address& remote_ip, bool broadcast, std::span<const u8> data);
+
     /**
      * Sends a chat message to the room.
      * @param message The contents of the message.
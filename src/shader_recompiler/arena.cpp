@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "shader_recompiler/arena.h"
+
+namespace Shader {
+namespace {
+constexpr size_t MAX_BUFFER_SIZE{16 * 1024 * 1024};
+
+thread_local std::pmr::memory_resource* current_resource{};
+} // Anonymous namespace
+
+TranslationArena::TranslationArena(size_t initial_size)
+    : buffer{std::make_unique<std::byte[]>(initial_size)}, buffer_size{initial_size} {
+    resource.emplace(buffer.get(), buffer_size, &upstream);
+}
+
+TranslationArena::~TranslationArena() = default;
+
+void TranslationArena::Reset() {
+    resource->release();
+    if (upstream.overflow_bytes == 0) {
+        return;
+    }
+    // The last session did not fit in the initial buffer, grow it so the next one is likely to be
+    // served from a single block
+    const size_t new_size{std::min(buffer_size + upstream.overflow_bytes, MAX_BUFFER_SIZE)};
+    upstream.overflow_bytes = 0;
+    if (new_size == buffer_size) {
+        return;
+    }
+    resource.reset();
+    buffer = std::make_unique<std::byte[]>(new_size);
+    buffer_size = new_size;
+    resource.emplace(buffer.get(), buffer_size, &upstream);
+}
+
+void* TranslationArena::OverflowResource::do_allocate(size_t bytes, size_t alignment) {
+    overflow_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void TranslationArena::OverflowResource::do_deallocate(void* pointer, size_t bytes,
+                                                       size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool TranslationArena::OverflowResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+ArenaScope::ArenaScope(TranslationArena& arena) noexcept
+    : previous{std::exchange(current_resource, arena.Resource())} {}
+
+ArenaScope::~ArenaScope() {
+    current_resource = previous;
+}
+
+std::pmr::memory_resource* CurrentArenaResource() noexcept {
+    return current_resource ? current_resource : std::pmr::get_default_resource();
+}
+
+} // namespace Shader
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace Shader {
+
+/// Bump-pointer arena backing the temporary containers of a single shader translation session.
+/// Every allocation is released at once by Reset, the arena itself is reused across sessions.
+class TranslationArena {
+public:
+    explicit TranslationArena(size_t initial_size = 64 * 1024);
+    ~TranslationArena();
+
+    TranslationArena(const TranslationArena&) = delete;
+    TranslationArena& operator=(const TranslationArena&) = delete;
+
+    TranslationArena(TranslationArena&&) = delete;
+    TranslationArena& operator=(TranslationArena&&) = delete;
+
+    /// Releases all allocations made since the last reset
+    void Reset();
+
+    [[nodiscard]] std::pmr::memory_resource* Resource() noexcept {
+        return &*resource;
+    }
+
+private:
+    /// Upstream resource that counts the bytes requested after the initial buffer is exhausted
+    class OverflowResource final : public std::pmr::memory_resource {
+    public:
+        size_t overflow_bytes{};
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    OverflowResource upstream;
+    std::unique_ptr<std::byte[]> buffer;
+    size_t buffer_size{};
+    std::optional<std::pmr::monotonic_buffer_resource> resource;
+};
+
+/// Makes an arena the current one for the calling thread for the duration of the scope
+class ArenaScope {
+public:
+    explicit ArenaScope(TranslationArena& arena) noexcept;
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    std::pmr::memory_resource* previous;
+};
+
+/// Returns the memory resource of the current thread's arena, or the default resource when no
+/// translation session is active
+[[nodiscard]] std::pmr::memory_resource* CurrentArenaResource() noexcept;
+
+} // namespace Shader
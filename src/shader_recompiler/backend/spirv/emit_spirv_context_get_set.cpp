@@ -564,6 +564,9 @@ Id EmitIsHelperInvocation(EmitContext& ctx) {
 }
 
 Id EmitYDirection(EmitContext& ctx) {
+    if (Sirit::ValidId(ctx.y_negate_spec)) {
+        return ctx.OpSelect(ctx.F32[1], ctx.y_negate_spec, ctx.Const(-1.0f), ctx.Const(1.0f));
+    }
     return ctx.Const(ctx.runtime_info.y_negate ? -1.0f : 1.0f);
 }
 
@@ -18,10 +18,15 @@ void ConvertDepthMode(EmitContext& ctx) {
 }
 
 void SetFixedPipelinePointSize(EmitContext& ctx) {
-    if (ctx.runtime_info.fixed_state_point_size) {
-        const float point_size{*ctx.runtime_info.fixed_state_point_size};
-        ctx.OpStore(ctx.output_point_size, ctx.Const(point_size));
+    if (!ctx.runtime_info.fixed_state_point_size) {
+        return;
+    }
+    if (Sirit::ValidId(ctx.fixed_state_point_size_spec)) {
+        ctx.OpStore(ctx.output_point_size, ctx.fixed_state_point_size_spec);
+        return;
     }
+    const float point_size{*ctx.runtime_info.fixed_state_point_size};
+    ctx.OpStore(ctx.output_point_size, ctx.Const(point_size));
 }
 
 Id DefaultVarying(EmitContext& ctx, u32 num_components, u32 element, Id zero, Id one,
@@ -61,13 +66,30 @@ Id ComparisonFunction(EmitContext& ctx, CompareFunction comparison, Id operand_1
     throw InvalidArgument("Comparison function {}", comparison);
 }
 
-void AlphaTest(EmitContext& ctx) {
-    if (!ctx.runtime_info.alpha_test_func) {
-        return;
+Id SpecializedComparisonFunction(EmitContext& ctx, Id operand_1, Id operand_2) {
+    // The comparison is selected from the specialization constant, drivers fold the selection
+    // once the pipeline is specialized
+    Id condition{ctx.true_value};
+    for (u32 index = static_cast<u32>(CompareFunction::Never);
+         index < static_cast<u32>(CompareFunction::Always); ++index) {
+        const auto comparison{static_cast<CompareFunction>(index)};
+        const Id is_comparison{ctx.OpIEqual(ctx.U1, ctx.alpha_test_func_spec, ctx.Const(index))};
+        condition = ctx.OpSelect(ctx.U1, is_comparison,
+                                 ComparisonFunction(ctx, comparison, operand_1, operand_2),
+                                 condition);
     }
-    const auto comparison{*ctx.runtime_info.alpha_test_func};
-    if (comparison == CompareFunction::Always) {
-        return;
+    return condition;
+}
+
+void AlphaTest(EmitContext& ctx) {
+    const bool is_specialized{Sirit::ValidId(ctx.alpha_test_func_spec)};
+    if (!is_specialized) {
+        if (!ctx.runtime_info.alpha_test_func) {
+            return;
+        }
+        if (*ctx.runtime_info.alpha_test_func == CompareFunction::Always) {
+            return;
+        }
     }
     if (!Sirit::ValidId(ctx.frag_color[0])) {
         return;
@@ -79,8 +101,14 @@ void AlphaTest(EmitContext& ctx) {
 
     const Id true_label{ctx.OpLabel()};
     const Id discard_label{ctx.OpLabel()};
-    const Id alpha_reference{ctx.Const(ctx.runtime_info.alpha_test_reference)};
-    const Id condition{ComparisonFunction(ctx, comparison, alpha, alpha_reference)};
+    const Id condition{[&] {
+        if (is_specialized) {
+            return SpecializedComparisonFunction(ctx, alpha, ctx.alpha_test_reference_spec);
+        }
+        const Id alpha_reference{ctx.Const(ctx.runtime_info.alpha_test_reference)};
+        return ComparisonFunction(ctx, *ctx.runtime_info.alpha_test_func, alpha,
+                                  alpha_reference);
+    }()};
 
     ctx.OpSelectionMerge(true_label, spv::SelectionControlMask::MaskNone);
     ctx.OpBranchConditional(condition, true_label, discard_label);
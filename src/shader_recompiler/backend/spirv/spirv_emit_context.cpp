@@ -468,6 +468,7 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     AddCapability(spv::Capability::Shader);
     DefineCommonTypes(program.info);
     DefineCommonConstants();
+    DefineSpecializationConstants();
     DefineInterfaces(program);
     DefineLocalMemory(program);
     DefineSharedMemory(program);
@@ -575,6 +576,32 @@ void EmitContext::DefineCommonConstants() {
     f32_zero_value = Const(0.0f);
 }
 
+void EmitContext::DefineSpecializationConstants() {
+    if (!runtime_info.specialize_fixed_state) {
+        return;
+    }
+    const auto define{[this](Id spec_constant, SpecializationConstant spec_id,
+                             std::string_view name) {
+        Decorate(spec_constant, spv::Decoration::SpecId, static_cast<u32>(spec_id));
+        Name(spec_constant, name);
+        return spec_constant;
+    }};
+    const SpecializationValues defaults{};
+    if (stage == Stage::Fragment) {
+        alpha_test_func_spec = define(SpecConstant(U32[1], defaults.alpha_test_func),
+                                      SpecializationConstant::AlphaTestFunc, "alpha_test_func");
+        alpha_test_reference_spec =
+            define(SpecConstant(F32[1], defaults.alpha_test_reference),
+                   SpecializationConstant::AlphaTestReference, "alpha_test_reference");
+    }
+    if (stage == Stage::VertexB || stage == Stage::Geometry) {
+        fixed_state_point_size_spec =
+            define(SpecConstant(F32[1], defaults.fixed_state_point_size),
+                   SpecializationConstant::FixedStatePointSize, "fixed_state_point_size");
+    }
+    y_negate_spec = define(SpecConstantFalse(U1), SpecializationConstant::YNegate, "y_negate");
+}
+
 void EmitContext::DefineInterfaces(const IR::Program& program) {
     DefineInputs(program);
     DefineOutputs(program);
@@ -224,6 +224,12 @@ public:
     Id u32_zero_value{};
     Id f32_zero_value{};
 
+    /// Specialization constants of the fixed state, when it is specialized
+    Id alpha_test_func_spec{};
+    Id alpha_test_reference_spec{};
+    Id fixed_state_point_size_spec{};
+    Id y_negate_spec{};
+
     UniformDefinitions uniform_types;
     StorageTypeDefinitions storage_types;
 
@@ -362,6 +368,7 @@ public:
 private:
     void DefineCommonTypes(const Info& info);
     void DefineCommonConstants();
+    void DefineSpecializationConstants();
     void DefineInterfaces(const IR::Program& program);
     void DefineLocalMemory(const IR::Program& program);
     void DefineSharedMemory(const IR::Program& program);
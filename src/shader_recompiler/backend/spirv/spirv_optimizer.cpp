@@ -0,0 +1,261 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <spirv/unified1/spirv.hpp>
+
+#include "shader_recompiler/backend/spirv/spirv_optimizer.h"
+
+namespace Shader::Backend::SPIRV {
+namespace {
+constexpr size_t HEADER_WORDS{5};
+
+struct Instruction {
+    spv::Op opcode;
+    std::span<const u32> words;
+};
+
+bool Parse(std::span<const u32> code, std::vector<Instruction>& instructions) {
+    size_t offset{HEADER_WORDS};
+    while (offset < code.size()) {
+        const u32 word_count{code[offset] >> 16};
+        if (word_count == 0 || offset + word_count > code.size()) {
+            return false;
+        }
+        instructions.push_back(Instruction{
+            .opcode = static_cast<spv::Op>(code[offset] & 0xffff),
+            .words = code.subspan(offset, word_count),
+        });
+        offset += word_count;
+    }
+    return true;
+}
+
+bool IsReadOnly(spv::StorageClass storage_class) {
+    switch (storage_class) {
+    case spv::StorageClass::Input:
+    case spv::StorageClass::Uniform:
+    case spv::StorageClass::PushConstant:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool IsRemovable(spv::StorageClass storage_class) {
+    switch (storage_class) {
+    case spv::StorageClass::Private:
+    case spv::StorageClass::Workgroup:
+    case spv::StorageClass::Function:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Returns the offset of the first word after the literal string starting at the given offset
+size_t SkipString(std::span<const u32> words, size_t offset) {
+    while (offset < words.size()) {
+        const u32 word{words[offset++]};
+        if ((word & 0xff000000) == 0 || (word & 0x00ff0000) == 0 || (word & 0x0000ff00) == 0 ||
+            (word & 0x000000ff) == 0) {
+            break;
+        }
+    }
+    return offset;
+}
+
+class Optimizer {
+public:
+    explicit Optimizer(std::span<const Instruction> instructions_)
+        : instructions{instructions_} {}
+
+    void Run(std::vector<u32>& output) {
+        FindDeadVariables();
+        for (const Instruction& inst : instructions) {
+            Emit(inst, output);
+        }
+    }
+
+private:
+    void FindDeadVariables() {
+        std::unordered_map<u32, size_t> uses;
+        for (const Instruction& inst : instructions) {
+            if (inst.opcode == spv::Op::OpVariable) {
+                const auto storage_class{static_cast<spv::StorageClass>(inst.words[3])};
+                pointer_classes.emplace(inst.words[2], storage_class);
+                if (IsRemovable(storage_class) && inst.words.size() == 4) {
+                    uses.emplace(inst.words[2], 0);
+                }
+            }
+            if (inst.opcode == spv::Op::OpDecorate &&
+                (static_cast<spv::Decoration>(inst.words[2]) == spv::Decoration::Volatile ||
+                 (static_cast<spv::Decoration>(inst.words[2]) == spv::Decoration::BuiltIn &&
+                  static_cast<spv::BuiltIn>(inst.words[3]) == spv::BuiltIn::HelperInvocation))) {
+                volatile_pointers.insert(inst.words[1]);
+            }
+        }
+        // Any word matching a variable id counts as a use, literals can only make this
+        // conservative
+        for (const Instruction& inst : instructions) {
+            switch (inst.opcode) {
+            case spv::Op::OpName:
+            case spv::Op::OpDecorate:
+            case spv::Op::OpEntryPoint:
+            case spv::Op::OpVariable:
+                continue;
+            default:
+                break;
+            }
+            for (const u32 word : inst.words.subspan(1)) {
+                if (const auto it{uses.find(word)}; it != uses.end()) {
+                    ++it->second;
+                }
+            }
+        }
+        for (const auto& [id, count] : uses) {
+            if (count == 0) {
+                dead_variables.insert(id);
+            }
+        }
+    }
+
+    void Emit(const Instruction& inst, std::vector<u32>& output) {
+        switch (inst.opcode) {
+        case spv::Op::OpName:
+        case spv::Op::OpDecorate:
+            if (dead_variables.contains(inst.words[1])) {
+                return;
+            }
+            break;
+        case spv::Op::OpVariable:
+            if (dead_variables.contains(inst.words[2])) {
+                return;
+            }
+            break;
+        case spv::Op::OpEntryPoint:
+            EmitEntryPoint(inst, output);
+            return;
+        case spv::Op::OpFunction:
+        case spv::Op::OpLabel:
+            access_chains.clear();
+            loads.clear();
+            break;
+        case spv::Op::OpAccessChain:
+        case spv::Op::OpInBoundsAccessChain:
+            if (ForwardAccessChain(inst, output)) {
+                return;
+            }
+            break;
+        case spv::Op::OpLoad:
+            if (ForwardLoad(inst, output)) {
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+        output.insert(output.end(), inst.words.begin(), inst.words.end());
+    }
+
+    void EmitEntryPoint(const Instruction& inst, std::vector<u32>& output) {
+        const size_t start{output.size()};
+        const size_t interface_offset{SkipString(inst.words, 3)};
+        output.insert(output.end(), inst.words.begin(), inst.words.begin() + interface_offset);
+        for (const u32 id : inst.words.subspan(interface_offset)) {
+            if (!dead_variables.contains(id)) {
+                output.push_back(id);
+            }
+        }
+        const u32 word_count{static_cast<u32>(output.size() - start)};
+        output[start] = (word_count << 16) | static_cast<u32>(inst.opcode);
+    }
+
+    bool ForwardAccessChain(const Instruction& inst, std::vector<u32>& output) {
+        const u32 result{inst.words[2]};
+        const u32 base{Resolve(inst.words[3])};
+        const auto class_it{pointer_classes.find(base)};
+        if (class_it == pointer_classes.end()) {
+            return false;
+        }
+        pointer_classes.emplace(result, class_it->second);
+        if (volatile_pointers.contains(base)) {
+            volatile_pointers.insert(result);
+            return false;
+        }
+        if (!IsReadOnly(class_it->second)) {
+            return false;
+        }
+        std::vector<u32> key{static_cast<u32>(inst.opcode), inst.words[1], base};
+        key.insert(key.end(), inst.words.begin() + 4, inst.words.end());
+        const auto [it, is_new]{access_chains.try_emplace(std::move(key), result)};
+        if (is_new) {
+            return false;
+        }
+        EmitCopy(inst.words[1], result, it->second, output);
+        return true;
+    }
+
+    bool ForwardLoad(const Instruction& inst, std::vector<u32>& output) {
+        if (inst.words.size() != 4) {
+            // Loads with memory operands are left alone
+            return false;
+        }
+        const u32 pointer{Resolve(inst.words[3])};
+        const auto class_it{pointer_classes.find(pointer)};
+        if (class_it == pointer_classes.end() || !IsReadOnly(class_it->second) ||
+            volatile_pointers.contains(pointer)) {
+            return false;
+        }
+        const u64 key{(static_cast<u64>(inst.words[1]) << 32) | pointer};
+        const auto [it, is_new]{loads.try_emplace(key, inst.words[2])};
+        if (is_new) {
+            return false;
+        }
+        EmitCopy(inst.words[1], inst.words[2], it->second, output);
+        return true;
+    }
+
+    void EmitCopy(u32 type, u32 result, u32 source, std::vector<u32>& output) {
+        output.push_back((4U << 16) | static_cast<u32>(spv::Op::OpCopyObject));
+        output.push_back(type);
+        output.push_back(result);
+        output.push_back(source);
+        aliases.emplace(result, source);
+    }
+
+    u32 Resolve(u32 id) const {
+        const auto it{aliases.find(id)};
+        return it != aliases.end() ? it->second : id;
+    }
+
+    std::span<const Instruction> instructions;
+    std::unordered_map<u32, spv::StorageClass> pointer_classes;
+    std::unordered_set<u32> volatile_pointers;
+    std::unordered_set<u32> dead_variables;
+    std::unordered_map<u32, u32> aliases;
+    std::map<std::vector<u32>, u32> access_chains;
+    std::unordered_map<u64, u32> loads;
+};
+} // Anonymous namespace
+
+void OptimizeSPIRV(std::vector<u32>& code) {
+    if (code.size() < HEADER_WORDS) {
+        return;
+    }
+    std::vector<Instruction> instructions;
+    if (!Parse(code, instructions)) {
+        return;
+    }
+    std::vector<u32> output(code.begin(), code.begin() + HEADER_WORDS);
+    output.reserve(code.size());
+    Optimizer{instructions}.Run(output);
+    code = std::move(output);
+}
+
+} // namespace Shader::Backend::SPIRV
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Shader::Backend::SPIRV {
+
+/// Removes unused private and workgroup variables and forwards repeated loads from read-only
+/// memory inside a block. Leaves the module untouched if it can not be parsed.
+void OptimizeSPIRV(std::vector<u32>& code);
+
+} // namespace Shader::Backend::SPIRV
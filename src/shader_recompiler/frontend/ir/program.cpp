@@ -3,9 +3,11 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
+#include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/frontend/ir/value.h"
@@ -28,4 +30,123 @@ std::string DumpProgram(const Program& program) {
     return ret;
 }
 
+Program CloneProgram(ObjectPool<Inst>& inst_pool, ObjectPool<Block>& block_pool,
+                     const Program& program) {
+    std::unordered_map<const Block*, Block*> block_map;
+    std::unordered_map<const Inst*, Inst*> inst_map;
+    block_map.reserve(program.blocks.size());
+
+    // Allocate every block and instruction first, arguments can reference instructions defined
+    // later in the program through phi nodes
+    for (const Block* const block : program.blocks) {
+        Block* const new_block{block_pool.Create(inst_pool)};
+        new_block->SetOrder(block->GetOrder());
+        block_map.emplace(block, new_block);
+        for (const Inst& inst : *block) {
+            Inst* const new_inst{inst_pool.Create(inst.GetOpcode(), inst.Flags<u32>())};
+            new_block->Instructions().push_back(*new_inst);
+            inst_map.emplace(&inst, new_inst);
+        }
+    }
+    const auto map_block{[&](const Block* block) -> Block* {
+        if (block == nullptr) {
+            return nullptr;
+        }
+        const auto it{block_map.find(block)};
+        if (it == block_map.end()) {
+            throw LogicError("Block is not part of the cloned program");
+        }
+        return it->second;
+    }};
+    const auto map_value{[&](const Value& value) {
+        const Value resolved{value.Resolve()};
+        if (resolved.IsImmediate()) {
+            return resolved;
+        }
+        const auto it{inst_map.find(resolved.Inst())};
+        if (it == inst_map.end()) {
+            throw LogicError("Instruction is not part of the cloned program");
+        }
+        return Value{it->second};
+    }};
+    for (const Block* const block : program.blocks) {
+        Block* const new_block{block_map.at(block)};
+        for (const Block* const successor : block->ImmSuccessors()) {
+            new_block->AddBranch(map_block(successor));
+        }
+        for (const Inst& inst : *block) {
+            Inst* const new_inst{inst_map.at(&inst)};
+            const size_t num_args{inst.NumArgs()};
+            for (size_t index = 0; index < num_args; ++index) {
+                if (inst.GetOpcode() == Opcode::Phi) {
+                    new_inst->AddPhiOperand(map_block(inst.PhiBlock(index)),
+                                            map_value(inst.Arg(index)));
+                } else {
+                    new_inst->SetArg(index, map_value(inst.Arg(index)));
+                }
+            }
+        }
+    }
+    // Preserve usages that were added outside of instruction arguments
+    for (const auto& [inst, new_inst] : inst_map) {
+        new_inst->DestructiveAddUsage(inst->UseCount() - new_inst->UseCount());
+    }
+
+    Program result;
+    result.syntax_list.reserve(program.syntax_list.size());
+    for (const AbstractSyntaxNode& node : program.syntax_list) {
+        AbstractSyntaxNode& new_node{result.syntax_list.emplace_back(node)};
+        auto& data{new_node.data};
+        switch (node.type) {
+        case AbstractSyntaxNode::Type::Block:
+            data.block = map_block(data.block);
+            break;
+        case AbstractSyntaxNode::Type::If:
+            data.if_node.cond = U1{map_value(data.if_node.cond)};
+            data.if_node.body = map_block(data.if_node.body);
+            data.if_node.merge = map_block(data.if_node.merge);
+            break;
+        case AbstractSyntaxNode::Type::EndIf:
+            data.end_if.merge = map_block(data.end_if.merge);
+            break;
+        case AbstractSyntaxNode::Type::Loop:
+            data.loop.body = map_block(data.loop.body);
+            data.loop.continue_block = map_block(data.loop.continue_block);
+            data.loop.merge = map_block(data.loop.merge);
+            break;
+        case AbstractSyntaxNode::Type::Repeat:
+            data.repeat.cond = U1{map_value(data.repeat.cond)};
+            data.repeat.loop_header = map_block(data.repeat.loop_header);
+            data.repeat.merge = map_block(data.repeat.merge);
+            break;
+        case AbstractSyntaxNode::Type::Break:
+            data.break_node.cond = U1{map_value(data.break_node.cond)};
+            data.break_node.merge = map_block(data.break_node.merge);
+            data.break_node.skip = map_block(data.break_node.skip);
+            break;
+        case AbstractSyntaxNode::Type::Return:
+        case AbstractSyntaxNode::Type::Unreachable:
+            break;
+        }
+    }
+    result.blocks.reserve(program.blocks.size());
+    for (const Block* const block : program.blocks) {
+        result.blocks.push_back(map_block(block));
+    }
+    result.post_order_blocks.reserve(program.post_order_blocks.size());
+    for (const Block* const block : program.post_order_blocks) {
+        result.post_order_blocks.push_back(map_block(block));
+    }
+    result.info = program.info;
+    result.stage = program.stage;
+    result.workgroup_size = program.workgroup_size;
+    result.output_topology = program.output_topology;
+    result.output_vertices = program.output_vertices;
+    result.invocations = program.invocations;
+    result.local_memory_size = program.local_memory_size;
+    result.shared_memory_size = program.shared_memory_size;
+    result.is_geometry_passthrough = program.is_geometry_passthrough;
+    return result;
+}
+
 } // namespace Shader::IR
@@ -3,13 +3,16 @@
 
 #include <algorithm>
 #include <array>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "common/polyfill_ranges.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/frontend/maxwell/decode.h"
@@ -253,9 +256,17 @@ void CFG::AnalyzeLabel(FunctionId function_id, Label& label) {
 bool CFG::InspectVisitedBlocks(FunctionId function_id, const Label& label) {
     const Location pc{label.address};
     Function& function{functions[function_id]};
-    const auto it{
-        std::ranges::find_if(function.blocks, [pc](auto& block) { return block.Contains(pc); })};
-    if (it == function.blocks.end()) {
+    // Blocks do not overlap, only the last non-empty block starting before pc can contain it.
+    // Empty blocks are virtual blocks impersonating the block that follows them.
+    auto it{function.blocks.upper_bound(pc, Compare{})};
+    do {
+        if (it == function.blocks.begin()) {
+            // Address has not been visited
+            return false;
+        }
+        --it;
+    } while (it->begin == it->end);
+    if (!it->Contains(pc)) {
         // Address has not been visited
         return false;
     }
@@ -438,7 +449,7 @@ CFG::AnalysisState CFG::AnalyzeBRX(Block* block, Location pc, Instruction inst,
     if (flow_test != IR::FlowTest::T || pred != Predicate{true}) {
         throw NotImplementedException("Conditional indirect branch");
     }
-    std::vector<u32> targets;
+    std::pmr::vector<u32> targets{CurrentArenaResource()};
     targets.reserve(brx_table->num_entries);
     for (u32 i = 0; i < brx_table->num_entries; ++i) {
         u32 target{env.ReadCbufValue(brx_table->cbuf_index, brx_table->cbuf_offset + i * 4)};
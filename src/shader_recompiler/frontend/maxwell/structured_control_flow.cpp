@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -13,6 +14,7 @@
 #include <boost/intrusive/list.hpp>
 
 #include "common/polyfill_ranges.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
@@ -239,9 +241,7 @@ size_t Level(Node stmt) {
     return level;
 }
 
-bool IsDirectlyRelated(Node goto_stmt, Node label_stmt) {
-    const size_t goto_level{Level(goto_stmt)};
-    const size_t label_level{Level(label_stmt)};
+bool IsDirectlyRelated(Node goto_stmt, Node label_stmt, size_t goto_level, size_t label_level) {
     size_t min_level;
     size_t max_level;
     Node min;
@@ -264,8 +264,9 @@ bool IsDirectlyRelated(Node goto_stmt, Node label_stmt) {
     return min->up == max->up;
 }
 
-bool IsIndirectlyRelated(Node goto_stmt, Node label_stmt) {
-    return goto_stmt->up != label_stmt->up && !IsDirectlyRelated(goto_stmt, label_stmt);
+bool IsIndirectlyRelated(Node goto_stmt, Node label_stmt, size_t goto_level, size_t label_level) {
+    return goto_stmt->up != label_stmt->up &&
+           !IsDirectlyRelated(goto_stmt, label_stmt, goto_level, label_level);
 }
 
 [[maybe_unused]] bool AreSiblings(Node goto_stmt, Node label_stmt) noexcept {
@@ -312,7 +313,7 @@ bool NeedsLift(Node goto_stmt, Node label_stmt) noexcept {
 class GotoPass {
 public:
     explicit GotoPass(Flow::CFG& cfg, ObjectPool<Statement>& stmt_pool) : pool{stmt_pool} {
-        std::vector gotos{BuildTree(cfg)};
+        std::pmr::vector<Node> gotos{BuildTree(cfg)};
         const auto end{gotos.rend()};
         for (auto goto_stmt = gotos.rbegin(); goto_stmt != end; ++goto_stmt) {
             RemoveGoto(*goto_stmt);
@@ -327,17 +328,20 @@ private:
     void RemoveGoto(Node goto_stmt) {
         // Force goto_stmt and label_stmt to be directly related
         const Node label_stmt{goto_stmt->label};
-        if (IsIndirectlyRelated(goto_stmt, label_stmt)) {
+        // Each outward movement takes goto_stmt one level up, track the levels instead of
+        // walking up the tree on every check
+        const size_t label_level{Level(label_stmt)};
+        size_t goto_level{Level(goto_stmt)};
+        if (IsIndirectlyRelated(goto_stmt, label_stmt, goto_level, label_level)) {
             // Move goto_stmt out using outward-movement transformation until it becomes
             // directly related to label_stmt
-            while (!IsDirectlyRelated(goto_stmt, label_stmt)) {
+            while (!IsDirectlyRelated(goto_stmt, label_stmt, goto_level, label_level)) {
                 goto_stmt = MoveOutward(goto_stmt);
+                --goto_level;
             }
         }
         // Force goto_stmt and label_stmt to be siblings
-        if (IsDirectlyRelated(goto_stmt, label_stmt)) {
-            const size_t label_level{Level(label_stmt)};
-            size_t goto_level{Level(goto_stmt)};
+        if (IsDirectlyRelated(goto_stmt, label_stmt, goto_level, label_level)) {
             if (goto_level > label_level) {
                 // Move goto_stmt out of its level using outward-movement transformations
                 while (goto_level > label_level) {
@@ -374,20 +378,20 @@ private:
         }
     }
 
-    std::vector<Node> BuildTree(Flow::CFG& cfg) {
+    std::pmr::vector<Node> BuildTree(Flow::CFG& cfg) {
         u32 label_id{0};
-        std::vector<Node> gotos;
+        std::pmr::vector<Node> gotos{CurrentArenaResource()};
         Flow::Function& first_function{cfg.Functions().front()};
         BuildTree(cfg, first_function, label_id, gotos, root_stmt.children.end(), std::nullopt);
         return gotos;
     }
 
     void BuildTree(Flow::CFG& cfg, Flow::Function& function, u32& label_id,
-                   std::vector<Node>& gotos, Node function_insert_point,
+                   std::pmr::vector<Node>& gotos, Node function_insert_point,
                    std::optional<Node> return_label) {
         Statement* const false_stmt{pool.Create(Identity{}, IR::Condition{false}, &root_stmt)};
         Tree& root{root_stmt.children};
-        std::unordered_map<Flow::Block*, Node> local_labels;
+        std::pmr::unordered_map<Flow::Block*, Node> local_labels{CurrentArenaResource()};
         local_labels.reserve(function.blocks.size());
 
         for (Flow::Block& block : function.blocks) {
@@ -867,8 +871,8 @@ private:
 
     void DemoteCombinationPass() {
         using Type = IR::AbstractSyntaxNode::Type;
-        std::vector<IR::Block*> demote_blocks;
-        std::vector<IR::U1> demote_conds;
+        std::pmr::vector<IR::Block*> demote_blocks{CurrentArenaResource()};
+        std::pmr::vector<IR::U1> demote_conds{CurrentArenaResource()};
         u32 num_epilogues{};
         u32 branch_depth{};
         for (const IR::AbstractSyntaxNode& node : syntax_list) {
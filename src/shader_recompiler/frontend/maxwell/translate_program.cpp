@@ -15,6 +15,7 @@
 #include "shader_recompiler/frontend/maxwell/translate/translate.h"
 #include "shader_recompiler/frontend/maxwell/translate_program.h"
 #include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/ir_opt/pass_profiler.h"
 #include "shader_recompiler/ir_opt/passes.h"
 
 namespace Shader::Maxwell {
@@ -279,38 +280,47 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     }
     RemoveUnreachableBlocks(program);
 
+    using Optimization::PassId;
+    using Optimization::RunPass;
+
     // Replace instructions before the SSA rewrite
     if (!host_info.support_float64) {
-        Optimization::LowerFp64ToFp32(program);
+        RunPass(PassId::LowerFp64ToFp32, [&] { Optimization::LowerFp64ToFp32(program); });
     }
     if (!host_info.support_float16) {
-        Optimization::LowerFp16ToFp32(program);
+        RunPass(PassId::LowerFp16ToFp32, [&] { Optimization::LowerFp16ToFp32(program); });
     }
     if (!host_info.support_int64) {
-        Optimization::LowerInt64ToInt32(program);
+        RunPass(PassId::LowerInt64ToInt32, [&] { Optimization::LowerInt64ToInt32(program); });
     }
     if (!host_info.support_conditional_barrier) {
-        Optimization::ConditionalBarrierPass(program);
+        RunPass(PassId::ConditionalBarrier,
+                [&] { Optimization::ConditionalBarrierPass(program); });
     }
-    Optimization::SsaRewritePass(program);
+    RunPass(PassId::SsaRewrite, [&] { Optimization::SsaRewritePass(program); });
 
-    Optimization::ConstantPropagationPass(env, program);
+    RunPass(PassId::ConstantPropagation,
+            [&] { Optimization::ConstantPropagationPass(env, program); });
+    if (host_info.support_float16) {
+        RunPass(PassId::NarrowFp32ToFp16, [&] { Optimization::NarrowFp32ToFp16(program); });
+    }
 
-    Optimization::PositionPass(env, program);
+    RunPass(PassId::Position, [&] { Optimization::PositionPass(env, program); });
 
-    Optimization::GlobalMemoryToStorageBufferPass(program, host_info);
-    Optimization::TexturePass(env, program, host_info);
+    RunPass(PassId::GlobalMemoryToStorageBuffer,
+            [&] { Optimization::GlobalMemoryToStorageBufferPass(program, host_info); });
+    RunPass(PassId::Texture, [&] { Optimization::TexturePass(env, program, host_info); });
 
     if (Settings::values.resolution_info.active) {
-        Optimization::RescalingPass(program);
+        RunPass(PassId::Rescaling, [&] { Optimization::RescalingPass(program); });
     }
-    Optimization::DeadCodeEliminationPass(program);
+    RunPass(PassId::DeadCodeElimination, [&] { Optimization::DeadCodeEliminationPass(program); });
     if (Settings::values.renderer_debug) {
-        Optimization::VerificationPass(program);
+        RunPass(PassId::Verification, [&] { Optimization::VerificationPass(program); });
     }
-    Optimization::CollectShaderInfoPass(env, program);
-    Optimization::LayerPass(program, host_info);
-    Optimization::VendorWorkaroundPass(program);
+    RunPass(PassId::CollectShaderInfo, [&] { Optimization::CollectShaderInfoPass(env, program); });
+    RunPass(PassId::Layer, [&] { Optimization::LayerPass(program, host_info); });
+    RunPass(PassId::VendorWorkaround, [&] { Optimization::VendorWorkaroundPass(program); });
 
     CollectInterpolationInfo(env, program);
     AddNVNStorageBuffers(program);
@@ -319,9 +329,14 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
 
 IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b,
                                     Environment& env_vertex_b) {
+    using Optimization::PassId;
+    using Optimization::RunPass;
+
     IR::Program result{};
-    Optimization::VertexATransformPass(vertex_a);
-    Optimization::VertexBTransformPass(vertex_b);
+    RunPass(PassId::DualVertex, [&] {
+        Optimization::VertexATransformPass(vertex_a);
+        Optimization::VertexBTransformPass(vertex_b);
+    });
     for (const auto& term : vertex_a.syntax_list) {
         if (term.type != IR::AbstractSyntaxNode::Type::Return) {
             result.syntax_list.push_back(term);
@@ -342,11 +357,12 @@ IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b
 
     Optimization::JoinTextureInfo(result.info, vertex_b.info);
     Optimization::JoinStorageInfo(result.info, vertex_b.info);
-    Optimization::DeadCodeEliminationPass(result);
+    RunPass(PassId::DeadCodeElimination, [&] { Optimization::DeadCodeEliminationPass(result); });
     if (Settings::values.renderer_debug) {
-        Optimization::VerificationPass(result);
+        RunPass(PassId::Verification, [&] { Optimization::VerificationPass(result); });
     }
-    Optimization::CollectShaderInfoPass(env_vertex_b, result);
+    RunPass(PassId::CollectShaderInfo,
+            [&] { Optimization::CollectShaderInfoPass(env_vertex_b, result); });
     return result;
 }
 
@@ -410,6 +426,29 @@ void ConvertLegacyToGeneric(IR::Program& program, const Shader::RuntimeInfo& run
     }
 }
 
+void RemoveUnusedGenericOutputs(IR::Program& program, const VaryingState& next_stage_loads) {
+    bool any_removed{false};
+    for (IR::Block* const block : program.post_order_blocks) {
+        auto it{block->begin()};
+        while (it != block->end()) {
+            if (it->GetOpcode() == IR::Opcode::SetAttribute) {
+                const IR::Attribute attr{it->Arg(0).Attribute()};
+                if (IR::IsGeneric(attr) && !next_stage_loads[attr]) {
+                    program.info.stores.Set(attr, false);
+                    it->Invalidate();
+                    it = block->Instructions().erase(it);
+                    any_removed = true;
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+    if (any_removed) {
+        Optimization::DeadCodeEliminationPass(program);
+    }
+}
+
 IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
                                         ObjectPool<IR::Block>& block_pool,
                                         const HostTranslateInfo& host_info,
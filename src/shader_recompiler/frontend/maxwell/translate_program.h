@@ -25,6 +25,10 @@ namespace Shader::Maxwell {
 
 void ConvertLegacyToGeneric(IR::Program& program, const RuntimeInfo& runtime_info);
 
+// Removes the stores to generic outputs that the next stage does not load, along with the
+// computations only feeding them, and drops them from the stores of the program.
+void RemoveUnusedGenericOutputs(IR::Program& program, const VaryingState& next_stage_loads);
+
 // Maxwell v1 and older Nvidia cards don't support setting gl_Layer from non-geometry stages.
 // This creates a workaround by setting the layer as a generic output and creating a
 // passthrough geometry shader that reads the generic and sets the layer.
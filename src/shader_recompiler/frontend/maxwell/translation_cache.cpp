@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/host_translate_info.h"
+
+namespace Shader::Maxwell {
+namespace {
+/// Number of programs kept before the cache is flushed, the pools can not release single entries
+constexpr size_t MAX_ENTRIES{256};
+
+constexpr u32 NO_REPLACEMENT{std::numeric_limits<u32>::max()};
+
+struct Query {
+    enum class Type : u32 {
+        CbufValue,
+        TextureType,
+        TexturePixelFormat,
+        IsTexturePixelFormatInteger,
+        ViewportTransformState,
+        ReplaceConstBuffer,
+    };
+
+    Type type;
+    u32 arg0;
+    u32 arg1;
+    u32 result;
+};
+
+struct InstructionRange {
+    u32 lowest{std::numeric_limits<u32>::max()};
+    u32 highest{};
+    u64 lowest_value{};
+    u64 highest_value{};
+};
+
+/// Environment state read through const accessors, these do not depend on the query arguments
+struct EnvironmentState {
+    std::array<u32, 8> gp_passthrough_mask{};
+    std::array<u32, 3> workgroup_size{};
+    u32 texture_bound{};
+    u32 local_memory_size{};
+    u32 shared_memory_size{};
+    bool has_hle_macro_state{};
+
+    bool operator==(const EnvironmentState&) const noexcept = default;
+};
+
+EnvironmentState CaptureState(const Environment& env) {
+    return EnvironmentState{
+        .gp_passthrough_mask = env.GpPassthroughMask(),
+        .workgroup_size = env.WorkgroupSize(),
+        .texture_bound = env.TextureBoundBuffer(),
+        .local_memory_size = env.LocalMemorySize(),
+        .shared_memory_size = env.SharedMemorySize(),
+        .has_hle_macro_state = env.HasHLEMacroState(),
+    };
+}
+
+u32 EncodeReplacement(std::optional<ReplaceConstant> replacement) {
+    return replacement ? static_cast<u32>(*replacement) : NO_REPLACEMENT;
+}
+
+u32 Evaluate(Environment& env, Query::Type type, u32 arg0, u32 arg1) {
+    switch (type) {
+    case Query::Type::CbufValue:
+        return env.ReadCbufValue(arg0, arg1);
+    case Query::Type::TextureType:
+        return static_cast<u32>(env.ReadTextureType(arg0));
+    case Query::Type::TexturePixelFormat:
+        return static_cast<u32>(env.ReadTexturePixelFormat(arg0));
+    case Query::Type::IsTexturePixelFormatInteger:
+        return env.IsTexturePixelFormatInteger(arg0) ? 1 : 0;
+    case Query::Type::ViewportTransformState:
+        return env.ReadViewportTransformState();
+    case Query::Type::ReplaceConstBuffer:
+        return EncodeReplacement(env.GetReplaceConstBuffer(arg0, arg1));
+    }
+    return 0;
+}
+
+/// Forwards to another environment while recording the answers that shaped the translation
+class RecordingEnvironment final : public Environment {
+public:
+    explicit RecordingEnvironment(Environment& env_, std::vector<Query>& queries_,
+                                  InstructionRange& range_)
+        : env{env_}, queries{queries_}, range{range_} {
+        sph = env.SPH();
+        gp_passthrough_mask = env.GpPassthroughMask();
+        stage = env.ShaderStage();
+        start_address = env.StartAddress();
+        is_proprietary_driver = env.IsProprietaryDriver();
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        const u64 value{env.ReadInstruction(address)};
+        if (address < range.lowest) {
+            range.lowest = address;
+            range.lowest_value = value;
+        }
+        if (address >= range.highest) {
+            range.highest = address;
+            range.highest_value = value;
+        }
+        return value;
+    }
+
+    u32 ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) override {
+        return Record(Query::Type::CbufValue, cbuf_index, cbuf_offset);
+    }
+
+    TextureType ReadTextureType(u32 raw_handle) override {
+        return static_cast<TextureType>(Record(Query::Type::TextureType, raw_handle));
+    }
+
+    TexturePixelFormat ReadTexturePixelFormat(u32 raw_handle) override {
+        return static_cast<TexturePixelFormat>(
+            Record(Query::Type::TexturePixelFormat, raw_handle));
+    }
+
+    bool IsTexturePixelFormatInteger(u32 raw_handle) override {
+        return Record(Query::Type::IsTexturePixelFormatInteger, raw_handle) != 0;
+    }
+
+    u32 ReadViewportTransformState() override {
+        return Record(Query::Type::ViewportTransformState);
+    }
+
+    u32 TextureBoundBuffer() const override {
+        return env.TextureBoundBuffer();
+    }
+
+    u32 LocalMemorySize() const override {
+        return env.LocalMemorySize();
+    }
+
+    u32 SharedMemorySize() const override {
+        return env.SharedMemorySize();
+    }
+
+    std::array<u32, 3> WorkgroupSize() const override {
+        return env.WorkgroupSize();
+    }
+
+    bool HasHLEMacroState() const override {
+        return env.HasHLEMacroState();
+    }
+
+    std::optional<ReplaceConstant> GetReplaceConstBuffer(u32 bank, u32 offset) override {
+        const u32 result{Record(Query::Type::ReplaceConstBuffer, bank, offset)};
+        if (result == NO_REPLACEMENT) {
+            return std::nullopt;
+        }
+        return static_cast<ReplaceConstant>(result);
+    }
+
+    void Dump(u64 pipeline_hash, u64 shader_hash) override {
+        env.Dump(pipeline_hash, shader_hash);
+    }
+
+private:
+    u32 Record(Query::Type type, u32 arg0 = 0, u32 arg1 = 0) {
+        const u32 result{Evaluate(env, type, arg0, arg1)};
+        queries.push_back(Query{
+            .type = type,
+            .arg0 = arg0,
+            .arg1 = arg1,
+            .result = result,
+        });
+        return result;
+    }
+
+    Environment& env;
+    std::vector<Query>& queries;
+    InstructionRange& range;
+};
+} // Anonymous namespace
+
+struct TranslationCache::Entry {
+    /// Replays the recorded queries, this also makes the environment record them for
+    /// serialization as if the program had been translated from it
+    [[nodiscard]] bool Matches(Environment& env) const {
+        if (CaptureState(env) != state) {
+            return false;
+        }
+        if (range.lowest <= range.highest &&
+            (env.ReadInstruction(range.lowest) != range.lowest_value ||
+             env.ReadInstruction(range.highest) != range.highest_value)) {
+            return false;
+        }
+        return std::ranges::all_of(queries, [&env](const Query& query) {
+            return Evaluate(env, query.type, query.arg0, query.arg1) == query.result;
+        });
+    }
+
+    IR::Program program;
+    std::vector<Query> queries;
+    InstructionRange range;
+    EnvironmentState state;
+};
+
+size_t TranslationCache::KeyHash::operator()(const Key& key) const noexcept {
+    size_t seed{static_cast<size_t>(key.shader_hash)};
+    boost::hash_combine(seed, key.cfg_offset);
+    boost::hash_combine(seed, static_cast<u32>(key.stage));
+    boost::hash_combine(seed, key.exits_to_dispatcher);
+    return seed;
+}
+
+TranslationCache::TranslationCache() = default;
+
+TranslationCache::~TranslationCache() = default;
+
+IR::Program TranslationCache::Translate(ObjectPool<IR::Inst>& inst_pool_,
+                                        ObjectPool<IR::Block>& block_pool_,
+                                        ObjectPool<Flow::Block>& flow_block_pool, Environment& env,
+                                        u32 cfg_offset, bool exits_to_dispatcher,
+                                        const HostTranslateInfo& host_info, u64 shader_hash) {
+    const Key key{
+        .shader_hash = shader_hash,
+        .cfg_offset = cfg_offset,
+        .stage = env.ShaderStage(),
+        .exits_to_dispatcher = exits_to_dispatcher,
+    };
+    {
+        std::shared_lock lock{mutex};
+        const auto it{entries.find(key)};
+        if (it != entries.end() && it->second->Matches(env)) {
+            return IR::CloneProgram(inst_pool_, block_pool_, it->second->program);
+        }
+    }
+    auto entry{std::make_unique<Entry>()};
+    RecordingEnvironment recording_env{env, entry->queries, entry->range};
+    Flow::CFG cfg(recording_env, flow_block_pool, cfg_offset, exits_to_dispatcher);
+    IR::Program program{TranslateProgram(inst_pool_, block_pool_, recording_env, cfg, host_info)};
+    entry->state = CaptureState(env);
+
+    std::scoped_lock lock{mutex};
+    if (entries.size() >= MAX_ENTRIES) {
+        entries.clear();
+        inst_pool.ReleaseContents();
+        block_pool.ReleaseContents();
+    }
+    entry->program = IR::CloneProgram(inst_pool, block_pool, program);
+    entries.insert_or_assign(key, std::move(entry));
+    return program;
+}
+
+} // namespace Shader::Maxwell
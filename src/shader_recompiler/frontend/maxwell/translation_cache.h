@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/stage.h"
+
+namespace Shader {
+struct HostTranslateInfo;
+}
+
+namespace Shader::Maxwell {
+
+/// Caches optimized programs so pipelines combining the same stage with different ones only have
+/// to run the backend again. Entries are reused only when the environment answers every query the
+/// original translation made with the same values.
+class TranslationCache {
+public:
+    explicit TranslationCache();
+    ~TranslationCache();
+
+    TranslationCache(const TranslationCache&) = delete;
+    TranslationCache& operator=(const TranslationCache&) = delete;
+
+    /// Returns the translated program of the given shader, allocated from the given pools
+    [[nodiscard]] IR::Program Translate(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool,
+                                        ObjectPool<Flow::Block>& flow_block_pool, Environment& env,
+                                        u32 cfg_offset, bool exits_to_dispatcher,
+                                        const HostTranslateInfo& host_info, u64 shader_hash);
+
+private:
+    struct Key {
+        u64 shader_hash;
+        u32 cfg_offset;
+        Stage stage;
+        bool exits_to_dispatcher;
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+
+    struct KeyHash {
+        [[nodiscard]] size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry;
+
+    std::shared_mutex mutex;
+    ObjectPool<IR::Inst> inst_pool{8192};
+    ObjectPool<IR::Block> block_pool{32};
+    std::unordered_map<Key, std::unique_ptr<Entry>, KeyHash> entries;
+};
+
+} // namespace Shader::Maxwell
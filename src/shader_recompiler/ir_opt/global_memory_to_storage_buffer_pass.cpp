@@ -51,6 +51,10 @@ struct StorageInfo {
     StorageBufferSet set;
     StorageInstVector to_replace;
     StorageWritesSet writes;
+    /// Global memory instructions left to the global memory fallbacks, reported once per program
+    size_t num_untracked{};
+    /// Global memory instructions tracked to a storage buffer outside of the NVN range
+    size_t num_unbiased{};
 };
 
 /// Returns true when the instruction is a global memory instruction
@@ -294,15 +298,16 @@ std::optional<LowAddrInfo> TrackLowAddress(IR::Inst* inst) {
     // This address is expected to either be a PackUint2x32, a IAdd64, or a CompositeConstructU32x2
     IR::Inst* addr_inst{addr.InstRecursive()};
     s32 imm_offset{0};
-    if (addr_inst->GetOpcode() == IR::Opcode::IAdd64) {
+    while (addr_inst->GetOpcode() == IR::Opcode::IAdd64) {
         // If it's an IAdd64, get the immediate offset it is applying and grab the address
         // instruction. This expects for the instruction to be canonicalized having the address on
-        // the first argument and the immediate offset on the second one.
+        // the first argument and the immediate offset on the second one. Chains of them, as
+        // emitted for successive offsets from the same pointer, are accumulated.
         const IR::U64 imm_offset_value{addr_inst->Arg(1)};
         if (!imm_offset_value.IsImmediate()) {
             return std::nullopt;
         }
-        imm_offset = static_cast<s32>(static_cast<s64>(imm_offset_value.U64()));
+        imm_offset += static_cast<s32>(static_cast<s64>(imm_offset_value.U64()));
         const IR::U64 iadd_addr{addr_inst->Arg(0)};
         if (iadd_addr.IsImmediate()) {
             return std::nullopt;
@@ -377,24 +382,30 @@ void CollectStorageBuffers(IR::Block& block, IR::Inst& inst, StorageInfo& info)
         .alignment = 16,
     };
     // Track the low address of the instruction
-    const std::optional<LowAddrInfo> low_addr_info{TrackLowAddress(&inst)};
-    if (!low_addr_info) {
-        // Failed to track the low address, use NVN fallbacks
-        return;
-    }
-    // First try to find storage buffers in the NVN address
-    const IR::U32 low_addr{low_addr_info->value};
-    std::optional<StorageBufferAddr> storage_buffer{Track(low_addr, &nvn_bias)};
-    if (!storage_buffer) {
-        // If it fails, track without a bias
-        storage_buffer = Track(low_addr, nullptr);
+    std::optional<StorageBufferAddr> storage_buffer;
+    if (const std::optional<LowAddrInfo> low_addr_info{TrackLowAddress(&inst)}) {
+        // First try to find storage buffers in the NVN address
+        const IR::U32 low_addr{low_addr_info->value};
+        storage_buffer = Track(low_addr, &nvn_bias);
         if (!storage_buffer) {
-            // If that also fails, use NVN fallbacks
-            LOG_WARNING(Shader, "Storage buffer failed to track, using global memory fallbacks");
-            return;
+            // If it fails, track without a bias
+            storage_buffer = Track(low_addr, nullptr);
+            if (storage_buffer) {
+                ++info.num_unbiased;
+            }
         }
-        LOG_WARNING(Shader, "Storage buffer tracked without bias, index {} offset {}",
-                    storage_buffer->index, storage_buffer->offset);
+    } else {
+        // The address is not a constant offset from a 32-bit pair, e.g. it adds a dynamic offset
+        // or it is carried by a loop. Search the whole address computation, through its
+        // arithmetic and phi nodes, but only accept the NVN range as other constant buffer reads
+        // are likely to be the dynamic part of the address. The storage offset is then computed
+        // from the full address.
+        storage_buffer = Track(inst.Arg(0), &nvn_bias);
+    }
+    if (!storage_buffer) {
+        // Use NVN fallbacks
+        ++info.num_untracked;
+        return;
     }
     // Collect storage buffer and the instruction
     if (IsGlobalMemoryWrite(inst)) {
@@ -530,6 +541,16 @@ void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateIn
             CollectStorageBuffers(*block, inst, info);
         }
     }
+    if (info.num_unbiased != 0) {
+        LOG_WARNING(Shader, "{} global memory accesses tracked to storage buffers without bias",
+                    info.num_unbiased);
+    }
+    if (info.num_untracked != 0) {
+        LOG_WARNING(Shader,
+                    "{} of {} global memory accesses failed to track, using global memory "
+                    "fallbacks",
+                    info.num_untracked, info.num_untracked + info.to_replace.size());
+    }
     for (const StorageBufferAddr& storage_buffer : info.set) {
         program.info.storage_buffers_descriptors.push_back({
             .cbuf_index = storage_buffer.index,
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/modifiers.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+using NarrowingUses = boost::container::small_vector<IR::Inst*, 2>;
+
+std::optional<IR::Opcode> NarrowOpcode(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::FPAdd32:
+        return IR::Opcode::FPAdd16;
+    case IR::Opcode::FPMul32:
+        return IR::Opcode::FPMul16;
+    default:
+        return std::nullopt;
+    }
+}
+
+bool IsRoundToNearest(const IR::Inst& inst) {
+    const IR::FpRounding rounding{inst.Flags<IR::FpControl>().rounding};
+    return rounding == IR::FpRounding::DontCare || rounding == IR::FpRounding::RN;
+}
+
+/// Returns the 16-bit value an operand was widened from, building its sign modifiers before the
+/// insertion point, or nothing when the operand is not a widened 16-bit value
+std::optional<IR::Value> NarrowOperand(IR::Block& block, IR::Block::iterator insertion_point,
+                                       const IR::Value& operand) {
+    if (operand.IsImmediate()) {
+        return std::nullopt;
+    }
+    IR::Inst* const inst{operand.InstRecursive()};
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::ConvertF32F16:
+        return inst->Arg(0);
+    case IR::Opcode::FPNeg32:
+    case IR::Opcode::FPAbs32: {
+        const std::optional<IR::Value> source{NarrowOperand(block, insertion_point, inst->Arg(0))};
+        if (!source) {
+            return std::nullopt;
+        }
+        const IR::Opcode op{inst->GetOpcode() == IR::Opcode::FPNeg32 ? IR::Opcode::FPNeg16
+                                                                        : IR::Opcode::FPAbs16};
+        return IR::Value{&*block.PrependNewInst(insertion_point, op, {*source})};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Checks that an operand can be narrowed, before building any instruction for it
+bool CanNarrowOperand(const IR::Value& operand) {
+    if (operand.IsImmediate()) {
+        return false;
+    }
+    const IR::Inst* const inst{operand.InstRecursive()};
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::ConvertF32F16:
+        return true;
+    case IR::Opcode::FPNeg32:
+    case IR::Opcode::FPAbs32:
+        return CanNarrowOperand(inst->Arg(0));
+    default:
+        return false;
+    }
+}
+} // Anonymous namespace
+
+void NarrowFp32ToFp16(IR::Program& program) {
+    // Find the 32-bit operations whose results are narrowed to 16 bits
+    std::unordered_map<const IR::Inst*, NarrowingUses> narrowing_uses;
+    for (IR::Block* const block : program.post_order_blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            if (inst.GetOpcode() != IR::Opcode::ConvertF16F32 || !IsRoundToNearest(inst)) {
+                continue;
+            }
+            const IR::Value value{inst.Arg(0)};
+            if (value.IsImmediate() || !NarrowOpcode(value.InstRecursive()->GetOpcode())) {
+                continue;
+            }
+            narrowing_uses[value.InstRecursive()].push_back(&inst);
+        }
+    }
+    if (narrowing_uses.empty()) {
+        return;
+    }
+    // Adding or multiplying two 16-bit values in 32 bits and rounding the result to 16 bits gives
+    // the same result as the 16-bit operation, as 32 bits hold more than twice the precision.
+    // Operations whose 32-bit result has no other use are computed in 16 bits instead.
+    for (IR::Block* const block : program.post_order_blocks) {
+        for (auto it = block->Instructions().begin(); it != block->Instructions().end(); ++it) {
+            IR::Inst& inst{*it};
+            const auto uses{narrowing_uses.find(&inst)};
+            if (uses == narrowing_uses.end()) {
+                continue;
+            }
+            if (static_cast<size_t>(inst.UseCount()) != uses->second.size() ||
+                !IsRoundToNearest(inst) || !CanNarrowOperand(inst.Arg(0)) ||
+                !CanNarrowOperand(inst.Arg(1))) {
+                continue;
+            }
+            const IR::Value lhs{*NarrowOperand(*block, it, inst.Arg(0))};
+            const IR::Value rhs{*NarrowOperand(*block, it, inst.Arg(1))};
+            const IR::Opcode op{*NarrowOpcode(inst.GetOpcode())};
+            const IR::Value result{
+                &*block->PrependNewInst(it, op, {lhs, rhs}, inst.Flags<u32>())};
+            for (IR::Inst* const use : uses->second) {
+                use->ReplaceUsesWith(result);
+            }
+        }
+    }
+}
+
+} // namespace Shader::Optimization
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "shader_recompiler/ir_opt/pass_profiler.h"
+
+namespace Shader::Optimization {
+namespace {
+struct AtomicPassStats {
+    std::atomic<u64> invocations{};
+    std::atomic<u64> total_ns{};
+    std::atomic<u64> max_ns{};
+};
+
+std::array<AtomicPassStats, NUM_PASS_IDS> pass_stats;
+
+constexpr std::array<std::string_view, NUM_PASS_IDS> PASS_NAMES{
+    "LowerFp64ToFp32",
+    "LowerFp16ToFp32",
+    "LowerInt64ToInt32",
+    "ConditionalBarrier",
+    "SsaRewrite",
+    "ConstantPropagation",
+    "NarrowFp32ToFp16",
+    "Position",
+    "GlobalMemoryToStorageBuffer",
+    "Texture",
+    "Rescaling",
+    "DeadCodeElimination",
+    "Verification",
+    "CollectShaderInfo",
+    "Layer",
+    "VendorWorkaround",
+    "DualVertex",
+};
+} // Anonymous namespace
+
+bool IsPassProfilingEnabled() {
+    return Settings::values.profile_shader_passes.GetValue();
+}
+
+void RecordPassTime(PassId pass, std::chrono::nanoseconds time) {
+    AtomicPassStats& stats{pass_stats[static_cast<size_t>(pass)]};
+    const u64 time_ns{static_cast<u64>(time.count())};
+    stats.invocations.fetch_add(1, std::memory_order_relaxed);
+    stats.total_ns.fetch_add(time_ns, std::memory_order_relaxed);
+    u64 max_ns{stats.max_ns.load(std::memory_order_relaxed)};
+    while (max_ns < time_ns &&
+           !stats.max_ns.compare_exchange_weak(max_ns, time_ns, std::memory_order_relaxed)) {
+    }
+}
+
+std::array<PassStats, NUM_PASS_IDS> GetPassStats() {
+    std::array<PassStats, NUM_PASS_IDS> result;
+    for (size_t index = 0; index < NUM_PASS_IDS; ++index) {
+        result[index] = PassStats{
+            .invocations = pass_stats[index].invocations.load(std::memory_order_relaxed),
+            .total_ns = pass_stats[index].total_ns.load(std::memory_order_relaxed),
+            .max_ns = pass_stats[index].max_ns.load(std::memory_order_relaxed),
+        };
+    }
+    return result;
+}
+
+std::string_view PassName(PassId pass) {
+    return PASS_NAMES[static_cast<size_t>(pass)];
+}
+
+void LogPassStats() {
+    const std::array stats{GetPassStats()};
+    std::array<size_t, NUM_PASS_IDS> order;
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::ranges::sort(order, std::ranges::greater{},
+                      [&](size_t index) { return stats[index].total_ns; });
+    if (std::ranges::all_of(stats, [](const PassStats& pass) { return pass.invocations == 0; })) {
+        return;
+    }
+    LOG_INFO(Shader, "Shader recompiler pass timings:");
+    for (const size_t index : order) {
+        const PassStats& pass{stats[index]};
+        if (pass.invocations == 0) {
+            continue;
+        }
+        LOG_INFO(Shader, "{:>28}: {:>8} runs, {:>10.3f} ms total, {:>8.3f} us avg, {:>8.3f} us max",
+                 PASS_NAMES[index], pass.invocations, pass.total_ns / 1e6,
+                 pass.total_ns / 1e3 / pass.invocations, pass.max_ns / 1e3);
+    }
+}
+
+} // namespace Shader::Optimization
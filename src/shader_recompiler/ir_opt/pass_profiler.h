@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Shader::Optimization {
+
+enum class PassId : u32 {
+    LowerFp64ToFp32,
+    LowerFp16ToFp32,
+    LowerInt64ToInt32,
+    ConditionalBarrier,
+    SsaRewrite,
+    ConstantPropagation,
+    NarrowFp32ToFp16,
+    Position,
+    GlobalMemoryToStorageBuffer,
+    Texture,
+    Rescaling,
+    DeadCodeElimination,
+    Verification,
+    CollectShaderInfo,
+    Layer,
+    VendorWorkaround,
+    DualVertex,
+    Count,
+};
+
+constexpr size_t NUM_PASS_IDS = static_cast<size_t>(PassId::Count);
+
+struct PassStats {
+    u64 invocations{};
+    u64 total_ns{};
+    u64 max_ns{};
+};
+
+/// Returns true when pass timings are being collected
+[[nodiscard]] bool IsPassProfilingEnabled();
+
+/// Accumulates the time spent in a pass, safe to call from multiple threads
+void RecordPassTime(PassId pass, std::chrono::nanoseconds time);
+
+/// Returns the time accumulated in each pass since startup
+[[nodiscard]] std::array<PassStats, NUM_PASS_IDS> GetPassStats();
+
+[[nodiscard]] std::string_view PassName(PassId pass);
+
+/// Logs the accumulated pass timings sorted by total time, if any were collected
+void LogPassStats();
+
+/// Runs an optimization pass, timing it when profiling is enabled
+template <typename Func>
+void RunPass(PassId pass, Func&& func) {
+    if (!IsPassProfilingEnabled()) {
+        func();
+        return;
+    }
+    const auto start{std::chrono::steady_clock::now()};
+    func();
+    RecordPassTime(pass, std::chrono::steady_clock::now() - start);
+}
+
+} // namespace Shader::Optimization
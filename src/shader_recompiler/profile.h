@@ -48,6 +48,9 @@ struct Profile {
 
     bool warp_size_potentially_larger_than_guest{};
 
+    /// Runs the SPIR-V cleanup pass on the emitted module
+    bool optimize_spirv{};
+
     bool lower_left_origin_mode{};
     /// Fragment outputs have to be declared even if they are not written to avoid undefined values.
     /// See Ori and the Blind Forest's main menu for reference.
@@ -80,6 +80,9 @@ struct RuntimeInfo {
 
     /// Static Y negate value
     bool y_negate{};
+    /// Emit the alpha test, the fixed state point size and the Y negate value as SPIR-V
+    /// specialization constants, so pipelines differing only in them share the same module
+    bool specialize_fixed_state{};
     /// Use storage buffers instead of global pointers on GLASM
     bool glasm_use_storage_buffers{};
 
@@ -88,4 +91,21 @@ struct RuntimeInfo {
     u32 xfb_count{0};
 };
 
+/// SPIR-V specialization constant ids of the fixed state, see RuntimeInfo::specialize_fixed_state
+enum class SpecializationConstant : u32 {
+    AlphaTestFunc,
+    AlphaTestReference,
+    FixedStatePointSize,
+    YNegate,
+};
+
+/// Values of the specialization constants, in the order of their ids
+struct SpecializationValues {
+    u32 alpha_test_func{static_cast<u32>(CompareFunction::Always)};
+    f32 alpha_test_reference{};
+    f32 fixed_state_point_size{1.0f};
+    /// 32-bit boolean
+    u32 y_negate{};
+};
+
 } // namespace Shader
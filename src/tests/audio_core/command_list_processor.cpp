@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/renderer/command/data_source/pcm_int16.h"
+#include "common/common_types.h"
+
+namespace AudioCore::ADSP::AudioRenderer {
+
+namespace {
+constexpr u32 SampleCount = 16;
+
+/// Data source that fills its voice mix buffer with its node id, without reading guest memory
+struct TestDataSource final : Renderer::PcmInt16DataSourceVersion1Command {
+    void Process(const CommandListProcessor& processor) override {
+        for (u32 i = 0; i < processor.sample_count; i++) {
+            processor.mix_buffers[output_index * processor.sample_count + i] =
+                static_cast<s32>(node_id);
+        }
+        ++processed;
+    }
+
+    bool Verify(const CommandListProcessor& processor) override {
+        return true;
+    }
+
+    std::atomic<u32> processed{};
+};
+
+/// Command list of voice data sources, each on a mix buffer of its own
+struct TestCommandList {
+    explicit TestCommandList(u32 voice_count) {
+        storage = std::make_unique<TestDataSource[]>(voice_count);
+        for (u32 i = 0; i < voice_count; i++) {
+            auto& command{storage[i]};
+            command.magic = Renderer::CommandMagic;
+            command.enabled = true;
+            command.type = Renderer::CommandId::DataSourcePcmInt16Version1;
+            command.size = sizeof(TestDataSource);
+            command.node_id = i + 1;
+            command.output_index = static_cast<s16>(i);
+        }
+        mix_buffers.resize(voice_count * SampleCount);
+
+        processor.commands = reinterpret_cast<u8*>(storage.get());
+        processor.commands_buffer_size = voice_count * sizeof(TestDataSource);
+        processor.command_count = voice_count;
+        processor.sample_count = SampleCount;
+        processor.mix_buffers = mix_buffers;
+        processor.buffer_count = voice_count;
+    }
+
+    std::unique_ptr<TestDataSource[]> storage;
+    std::vector<s32> mix_buffers;
+    CommandListProcessor processor;
+};
+} // Anonymous namespace
+
+TEST_CASE("CommandListProcessor::VoiceGroups", "[audio_core]") {
+    TestCommandList list{6};
+    std::vector<s32> results;
+    const auto groups{list.processor.ProcessVoiceGroups(results)};
+
+    // Every voice is processed once, into the results rather than the shared mix buffers
+    REQUIRE(groups.size() == 6);
+    REQUIRE(results.size() == 6 * SampleCount);
+    for (u32 i = 0; i < 6; i++) {
+        REQUIRE(groups[i].first == i);
+        REQUIRE(groups[i].count == 1);
+        REQUIRE(groups[i].buffer == static_cast<s16>(i));
+        REQUIRE(list.storage[i].processed == 1);
+        REQUIRE(results[i * SampleCount] == static_cast<s32>(i + 1));
+        REQUIRE(results[i * SampleCount + SampleCount - 1] == static_cast<s32>(i + 1));
+    }
+    REQUIRE(list.mix_buffers == std::vector<s32>(6 * SampleCount));
+}
+
+TEST_CASE("CommandListProcessor::VoiceGroupsStop", "[audio_core]") {
+    TestCommandList list{7};
+    list.storage[4].magic = 0;
+    std::vector<s32> results;
+    const auto groups{list.processor.ProcessVoiceGroups(results)};
+
+    // The command list stops at the invalid command, the voices after it must not run ahead
+    REQUIRE(groups.size() == 4);
+    for (u32 i = 0; i < 7; i++) {
+        REQUIRE(list.storage[i].processed == (i < 4 ? 1 : 0));
+    }
+}
+
+TEST_CASE("CommandListProcessor::VoiceGroupsFew", "[audio_core]") {
+    TestCommandList list{6};
+    list.storage[3].size = 0;
+    std::vector<s32> results;
+
+    // Too few groups before the stop are left to the sequential pass
+    REQUIRE(list.processor.ProcessVoiceGroups(results).empty());
+    for (u32 i = 0; i < 6; i++) {
+        REQUIRE(list.storage[i].processed == 0);
+    }
+}
+
+} // namespace AudioCore::ADSP::AudioRenderer
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+namespace {
+struct Gain {
+    f32 volume;
+    f32 ramp;
+};
+
+// Unity, typical, muted, negative, ramping and out of the 32-bit fast path range at 23 bits
+constexpr std::array<Gain, 8> TestGains{{
+    {1.0f, 0.0f},
+    {0.7071f, 0.0f},
+    {0.0f, 0.0f},
+    {-0.5f, 0.0f},
+    {0.25f, 0.0031f},
+    {1.5f, -0.0042f},
+    {300.0f, 0.0f},
+    {0.1f, 2.0f},
+}};
+
+constexpr std::array<u32, 5> TestSampleCounts{0, 1, 7, 160, 243};
+
+std::vector<s32> MakeSamples(std::mt19937& rng, u32 count) {
+    std::uniform_int_distribution<s32> dist(std::numeric_limits<s32>::min(),
+                                            std::numeric_limits<s32>::max());
+    std::vector<s32> samples(count);
+    for (auto& sample : samples) {
+        // Keep most samples in the range real mixes see, with a few extremes to test wrapping
+        sample = dist(rng) >> ((rng() & 7) == 0 ? 0 : 8);
+    }
+    return samples;
+}
+
+template <size_t Q>
+void CheckBackend(MixKernelBackend backend) {
+    std::mt19937 rng{1234};
+    for (const u32 count : TestSampleCounts) {
+        for (const auto& gain : TestGains) {
+            const auto input{MakeSamples(rng, count)};
+            const auto output{MakeSamples(rng, count)};
+
+            auto expected{output};
+            auto result{output};
+            const s32 expected_last{MixKernel<Q>(MixKernelBackend::Scalar, expected, input,
+                                                 gain.volume, gain.ramp, count)};
+            const s32 result_last{
+                MixKernel<Q>(backend, result, input, gain.volume, gain.ramp, count)};
+            REQUIRE(result == expected);
+            REQUIRE(result_last == expected_last);
+
+            GainKernel<Q>(MixKernelBackend::Scalar, expected, input, gain.volume, gain.ramp,
+                          count);
+            GainKernel<Q>(backend, result, input, gain.volume, gain.ramp, count);
+            REQUIRE(result == expected);
+
+            // In place, as VolumeCommand does when input and output are the same buffer
+            expected = input;
+            result = input;
+            GainKernel<Q>(MixKernelBackend::Scalar, expected, expected, gain.volume, gain.ramp,
+                          count);
+            GainKernel<Q>(backend, result, result, gain.volume, gain.ramp, count);
+            REQUIRE(result == expected);
+
+            // Mixing a buffer into itself, the returned sample is gained from the input
+            expected = input;
+            result = input;
+            const s32 expected_self{MixKernel<Q>(MixKernelBackend::Scalar, expected, expected,
+                                                 gain.volume, gain.ramp, count)};
+            const s32 result_self{
+                MixKernel<Q>(backend, result, result, gain.volume, gain.ramp, count)};
+            REQUIRE(result == expected);
+            REQUIRE(result_self == expected_self);
+        }
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("MixKernels::MatchScalar", "[audio_core]") {
+    for (const auto backend : GetSupportedMixKernelBackends()) {
+        CheckBackend<15>(backend);
+        CheckBackend<23>(backend);
+    }
+}
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/resample/resample.h"
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+namespace {
+// Upsampling from the common 32kHz and 22.05kHz rates, one to one and downsampling
+constexpr std::array<f32, 6> TestRatios{
+    32000.0f / 48000.0f, 22050.0f / 48000.0f, 1.0f, 1.2f, 44100.0f / 32000.0f, 2.0f,
+};
+
+// Also covers counts that leave samples to the scalar tail of the vector loops
+constexpr std::array<u32, 5> TestSampleCounts{0, 1, 7, 160, 243};
+
+// Taps read past the last input sample the ratio steps to
+constexpr u32 MaxTaps{8};
+
+void CheckBackend(MixKernelBackend backend, SrcQuality quality) {
+    std::mt19937 rng{1234};
+    std::uniform_int_distribution<s32> dist(std::numeric_limits<s16>::min(),
+                                            std::numeric_limits<s16>::max());
+    for (const f32 ratio : TestRatios) {
+        for (const u32 count : TestSampleCounts) {
+            const Common::FixedPoint<49, 15> sample_rate_ratio{ratio};
+            std::vector<s16> input(static_cast<size_t>(count * ratio) + MaxTaps + 1);
+            for (auto& sample : input) {
+                sample = static_cast<s16>(dist(rng));
+            }
+            const Common::FixedPoint<49, 15> start_fraction{
+                static_cast<f32>(rng() % 1000) / 1000.0f};
+
+            std::vector<s32> expected(count);
+            std::vector<s32> result(count);
+            auto expected_fraction{start_fraction};
+            auto result_fraction{start_fraction};
+            Resample(MixKernelBackend::Scalar, expected, input, sample_rate_ratio,
+                     expected_fraction, count, quality);
+            Resample(backend, result, input, sample_rate_ratio, result_fraction, count, quality);
+            REQUIRE(result == expected);
+            REQUIRE(result_fraction == expected_fraction);
+        }
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("Resample::MatchScalar", "[audio_core]") {
+    for (const auto backend : GetSupportedMixKernelBackends()) {
+        CheckBackend(backend, SrcQuality::Medium);
+        CheckBackend(backend, SrcQuality::High);
+    }
+}
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/fast_hash.h"
+#include "common/fiber.h"
+#include "common/lz4_compression.h"
+#include "common/range_map.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+#include "common/scratch_buffer.h"
+#include "common/slot_vector.h"
+#include "common/zstd_compression.h"
+
+namespace {
+
+constexpr u64 PAGE = 4096;
+
+/// Returns data compressing about as well as guest memory does, runs of words and noise
+std::vector<u8> MakeCompressibleData(size_t size) {
+    std::mt19937 rng{0x59757A75};
+    std::vector<u8> data(size);
+    for (size_t offset = 0; offset < size; offset += 64) {
+        const u8 value = (rng() % 4 == 0) ? 0 : static_cast<u8>(rng());
+        for (size_t i = offset; i < std::min(offset + 64, size); ++i) {
+            data[i] = (rng() % 8 == 0) ? static_cast<u8>(rng()) : value;
+        }
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("CityHash: Benchmark", "[common]") {
+    for (const size_t size : {16U, 256U, 64U * 1024U}) {
+        const std::vector<u8> data = MakeCompressibleData(size);
+        const auto* const buf = reinterpret_cast<const char*>(data.data());
+        BENCHMARK("CityHash64 " + std::to_string(size) + " bytes") {
+            return Common::CityHash64(buf, data.size());
+        };
+        BENCHMARK("CityHash128 " + std::to_string(size) + " bytes") {
+            return Common::CityHash128(buf, data.size())[0];
+        };
+        BENCHMARK("FastHash64 " + std::to_string(size) + " bytes") {
+            return Common::FastHash64(data.data(), data.size());
+        };
+    }
+}
+
+TEST_CASE("RangeMap: Benchmark", "[common]") {
+    constexpr u64 num_ranges = 1024;
+    Common::RangeMap<u64, u32> map{0};
+    for (u64 i = 0; i < num_ranges; ++i) {
+        map.Map(i * PAGE * 2, i * PAGE * 2 + PAGE, static_cast<u32>(i + 1));
+    }
+    BENCHMARK("Lookup") {
+        u32 sum = 0;
+        for (u64 i = 0; i < num_ranges; ++i) {
+            sum += map.GetValueAt(static_cast<s64>(i * PAGE * 2 + PAGE / 2));
+        }
+        return sum;
+    };
+    BENCHMARK("Continuous size") {
+        size_t sum = 0;
+        for (u64 i = 0; i < num_ranges; ++i) {
+            sum += map.GetContinuousSizeFrom(i * PAGE * 2);
+        }
+        return sum;
+    };
+    BENCHMARK("Map and unmap") {
+        map.Map(PAGE / 2, num_ranges * PAGE, 1);
+        map.Unmap(PAGE / 2, num_ranges * PAGE);
+        return map.GetValueAt(0);
+    };
+}
+
+TEST_CASE("RangeSets: Benchmark", "[common]") {
+    constexpr u64 num_ranges = 1024;
+    Common::RangeSet<u64> set;
+    Common::OverlapRangeSet<u64> overlap_set;
+    for (u64 i = 0; i < num_ranges; ++i) {
+        set.Add(i * PAGE * 2, PAGE);
+        overlap_set.Add(i * PAGE * 2, PAGE * 3);
+    }
+    BENCHMARK("RangeSet add and subtract") {
+        set.Add(PAGE, PAGE * 16);
+        set.Subtract(PAGE, PAGE * 16);
+        return set.Empty();
+    };
+    BENCHMARK("RangeSet iterate range") {
+        u64 sum = 0;
+        set.ForEachInRange(0, num_ranges * PAGE,
+                           [&sum](u64 begin, u64 end) { sum += end - begin; });
+        return sum;
+    };
+    BENCHMARK("OverlapRangeSet add and subtract") {
+        overlap_set.Add(PAGE, PAGE * 16);
+        overlap_set.Subtract(PAGE, PAGE * 16);
+        return overlap_set.Empty();
+    };
+    BENCHMARK("OverlapRangeSet iterate range") {
+        u64 sum = 0;
+        overlap_set.ForEachInRange(0, num_ranges * PAGE,
+                                   [&sum](u64 begin, u64 end, s32) { sum += end - begin; });
+        return sum;
+    };
+}
+
+TEST_CASE("SlotVector: Benchmark", "[common]") {
+    struct Entry {
+        u64 address;
+        u64 size;
+    };
+    constexpr u32 num_entries = 4096;
+    Common::SlotVector<Entry> slots;
+    std::vector<Common::SlotId> ids;
+    for (u32 i = 0; i < num_entries; ++i) {
+        ids.push_back(slots.insert(Entry{i * PAGE, PAGE}));
+    }
+    BENCHMARK("Lookup") {
+        u64 sum = 0;
+        for (const Common::SlotId id : ids) {
+            sum += slots[id].address;
+        }
+        return sum;
+    };
+    BENCHMARK("Iterate") {
+        u64 sum = 0;
+        for (const auto& [id, entry] : slots) {
+            sum += entry->size;
+        }
+        return sum;
+    };
+    BENCHMARK("Erase and insert") {
+        for (u32 i = 0; i < num_entries; i += 4) {
+            slots.erase(ids[i]);
+        }
+        for (u32 i = 0; i < num_entries; i += 4) {
+            ids[i] = slots.insert(Entry{i * PAGE, PAGE});
+        }
+        return ids[0];
+    };
+}
+
+TEST_CASE("ScratchBuffer: Benchmark", "[common]") {
+    Common::ScratchBuffer<u8> buffer;
+    std::vector<u8> vector;
+    BENCHMARK("ScratchBuffer resize_destructive") {
+        for (size_t size = 64; size <= 64 * 1024; size *= 2) {
+            buffer.resize_destructive(size);
+            buffer[size - 1] = 1;
+        }
+        return buffer[0];
+    };
+    BENCHMARK("std::vector resize") {
+        for (size_t size = 64; size <= 64 * 1024; size *= 2) {
+            vector.resize(size);
+            vector[size - 1] = 1;
+        }
+        vector.clear();
+        return vector.capacity();
+    };
+}
+
+TEST_CASE("Fiber: Benchmark", "[common]") {
+    const std::shared_ptr<Common::Fiber> thread_fiber = Common::Fiber::ThreadToFiber();
+    std::shared_ptr<Common::Fiber> work_fiber;
+    u64 num_switches = 0;
+    work_fiber = std::make_shared<Common::Fiber>([&] {
+        while (true) {
+            ++num_switches;
+            Common::Fiber::YieldTo(work_fiber, *thread_fiber);
+        }
+    });
+    BENCHMARK("Round trip switch") {
+        Common::Fiber::YieldTo(thread_fiber, *work_fiber);
+        return num_switches;
+    };
+    BENCHMARK("Create fiber") {
+        return std::make_shared<Common::Fiber>([] {});
+    };
+    thread_fiber->Exit();
+}
+
+TEST_CASE("Compression: Benchmark", "[common]") {
+    constexpr size_t size = 1024 * 1024;
+    const std::vector<u8> data = MakeCompressibleData(size);
+    const std::vector<u8> lz4 = Common::Compression::CompressDataLZ4(data.data(), data.size());
+    const std::vector<u8> zstd =
+        Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+    std::vector<u8> output(size);
+    BENCHMARK("LZ4 compress 1 MiB") {
+        return Common::Compression::CompressDataLZ4(data.data(), data.size());
+    };
+    BENCHMARK("LZ4 decompress 1 MiB") {
+        return Common::Compression::DecompressDataLZ4(output.data(), output.size(), lz4.data(),
+                                                      lz4.size());
+    };
+    BENCHMARK("Zstd compress 1 MiB") {
+        return Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+    };
+    BENCHMARK("Zstd decompress 1 MiB") {
+        return Common::Compression::DecompressDataZSTD(zstd);
+    };
+}
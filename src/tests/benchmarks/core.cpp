@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/core_timing.h"
+
+namespace {
+
+u64 num_callbacks = 0;
+
+std::optional<std::chrono::nanoseconds> CountCallback(s64, std::chrono::nanoseconds) {
+    ++num_callbacks;
+    return std::nullopt;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("CoreTiming: Benchmark", "[core]") {
+    Core::Timing::CoreTiming core_timing;
+    core_timing.SetMulticore(true);
+    core_timing.Initialize([] {});
+    // Keep the timer thread out of the way, events are only run by the calls to Advance
+    core_timing.SyncPause(true);
+
+    constexpr size_t num_events = 64;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < num_events; ++i) {
+        events.push_back(Core::Timing::CreateEvent("Event" + std::to_string(i), CountCallback));
+    }
+
+    BENCHMARK("Schedule and unschedule 64 events") {
+        for (size_t i = 0; i < num_events; ++i) {
+            core_timing.ScheduleEvent(std::chrono::seconds{10} + std::chrono::nanoseconds{i},
+                                      events[i]);
+        }
+        for (const auto& event : events) {
+            core_timing.UnscheduleEvent(event, Core::Timing::UnscheduleEventType::NoWait);
+        }
+        return core_timing.HasPendingEvents();
+    };
+    BENCHMARK("Schedule and run 64 events") {
+        for (const auto& event : events) {
+            core_timing.ScheduleEvent(std::chrono::nanoseconds{0}, event);
+        }
+        while (core_timing.HasPendingEvents()) {
+            (void)core_timing.Advance();
+        }
+        return num_callbacks;
+    };
+    BENCHMARK("Global time query") {
+        return core_timing.GetGlobalTimeNs();
+    };
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/buffer_cache/word_manager.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+
+constexpr u64 PAGE = 4096;
+
+class DeviceTracker {
+public:
+    void UpdatePagesCachedCount(VAddr, u64, int delta) {
+        count += delta;
+    }
+
+    int count = 0;
+};
+
+/**
+ * Returns ASTC blocks decoding to a single partition with RGBA endpoints and a 4x4 weight grid.
+ * Only the data of the blocks is random, so every block goes through the whole decoding path.
+ */
+std::vector<u8> MakeASTCBlocks(size_t num_blocks) {
+    // Block mode 0x52 (layout 0, R = 5, 4x4 weights), one partition, endpoint mode 12
+    constexpr u32 header = 0x52 | (12U << 13);
+    constexpr u32 header_bits = 17;
+    std::mt19937 rng{0x41535443};
+    std::vector<u8> blocks(num_blocks * 16);
+    for (size_t block = 0; block < num_blocks; ++block) {
+        std::array<u32, 4> words;
+        for (u32& word : words) {
+            word = static_cast<u32>(rng());
+        }
+        words[0] = (words[0] & ~((1U << header_bits) - 1)) | header;
+        std::memcpy(blocks.data() + block * 16, words.data(), sizeof(words));
+    }
+    return blocks;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("WordManager: Benchmark", "[video_core]") {
+    using WordManager = VideoCommon::WordManager<DeviceTracker>;
+    constexpr VAddr cpu_addr = 1ULL << 32;
+    constexpr u64 size = 256ULL * 1024 * 1024;
+    DeviceTracker tracker;
+    WordManager manager{cpu_addr, tracker, size};
+    manager.ChangeRegionState<VideoCommon::Type::CPU, false>(cpu_addr, size);
+    manager.ChangeRegionState<VideoCommon::Type::GPU, true>(cpu_addr + size - PAGE, PAGE);
+
+    BENCHMARK("Clean CPU region query") {
+        return manager.IsRegionModified<VideoCommon::Type::CPU>(0, size);
+    };
+    BENCHMARK("GPU modified region") {
+        return manager.ModifiedRegion<VideoCommon::Type::GPU>(0, size);
+    };
+    BENCHMARK("GPU modified ranges") {
+        u64 total = 0;
+        manager.ForEachModifiedRange<VideoCommon::Type::GPU, false>(
+            cpu_addr, static_cast<s64>(size), [&total](VAddr, u64 range_size) {
+                total += range_size;
+            });
+        return total;
+    };
+    BENCHMARK("Mark and unmark CPU region") {
+        manager.ChangeRegionState<VideoCommon::Type::CPU, true>(cpu_addr, 64 * PAGE * 64);
+        manager.ChangeRegionState<VideoCommon::Type::CPU, false>(cpu_addr, 64 * PAGE * 64);
+        return tracker.count;
+    };
+}
+
+TEST_CASE("UnswizzleTexture: Benchmark", "[video_core]") {
+    for (const u32 bytes_per_pixel : {1U, 4U, 16U}) {
+        const u32 width = 4096 / bytes_per_pixel;
+        constexpr u32 height = 1024;
+        constexpr u32 block_height = 4;
+        std::vector<u8> tiled(Tegra::Texture::CalculateSize(true, bytes_per_pixel, width, height,
+                                                            1, block_height, 0));
+        for (size_t i = 0; i < tiled.size(); ++i) {
+            tiled[i] = static_cast<u8>(i * 13 + i / 257);
+        }
+        std::vector<u8> linear(width * height * bytes_per_pixel);
+        BENCHMARK("Unswizzle 4 MiB " + std::to_string(bytes_per_pixel) + " bytes per pixel") {
+            Tegra::Texture::UnswizzleTexture(linear, tiled, bytes_per_pixel, width, height, 1,
+                                             block_height, 0);
+            return linear[0];
+        };
+    }
+}
+
+TEST_CASE("ASTC: Benchmark", "[video_core]") {
+    constexpr u32 width = 512;
+    constexpr u32 height = 512;
+    for (const u32 block_size : {4U, 8U}) {
+        const size_t num_blocks = (width / block_size) * (height / block_size);
+        const std::vector<u8> blocks = MakeASTCBlocks(num_blocks);
+        std::vector<u8> output(width * height * 4);
+        const std::string name = std::to_string(block_size) + "x" + std::to_string(block_size);
+        BENCHMARK("Decompress 512x512 " + name) {
+            Tegra::Texture::ASTC::Decompress(blocks, width, height, 1, block_size, block_size,
+                                             output);
+            return output[0];
+        };
+    }
+}
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+
+namespace Common {
+
+TEST_CASE("SPSCQueue: Try operations", "[common]") {
+    SPSCQueue<int, 4> queue;
+    int value{};
+
+    REQUIRE(!queue.TryPop(value));
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.TryEmplace(i));
+    }
+    // Pushing into a full queue should fail
+    REQUIRE(!queue.TryEmplace(4));
+
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE(!queue.TryPop(value));
+}
+
+TEST_CASE("SPSCQueue: Threaded producer and consumer", "[common]") {
+    // A small capacity forces both sides to sleep repeatedly
+    SPSCQueue<size_t, 8> queue;
+    constexpr size_t count = 100000;
+
+    std::jthread producer([&queue] {
+        for (size_t i = 0; i < count; ++i) {
+            queue.EmplaceWait(i);
+        }
+    });
+    bool in_order{true};
+    for (size_t i = 0; i < count; ++i) {
+        in_order &= queue.PopWait() == i;
+    }
+    REQUIRE(in_order);
+}
+
+TEST_CASE("SPSCQueue: Stop token wakes the consumer", "[common]") {
+    SPSCQueue<int, 4> queue;
+    std::stop_source stop_source;
+    std::jthread stopper([&stop_source] { stop_source.request_stop(); });
+    int value{-1};
+    queue.PopWait(value, stop_source.get_token());
+    REQUIRE(value == -1);
+}
+
+TEST_CASE("MPMCQueue: Try operations", "[common]") {
+    MPMCQueue<int, 4> queue;
+    int value{};
+
+    REQUIRE(!queue.TryPop(value));
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.TryEmplace(i));
+    }
+    REQUIRE(!queue.TryEmplace(4));
+
+    // Wrap around the ring a few times
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == i);
+        REQUIRE(queue.TryEmplace(i + 4));
+    }
+}
+
+TEST_CASE("MPMCQueue: Threaded producers and consumers", "[common]") {
+    MPMCQueue<size_t, 16> queue;
+    constexpr size_t num_threads = 4;
+    constexpr size_t count = 50000;
+
+    std::vector<size_t> sums(num_threads);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&queue] {
+                for (size_t i = 1; i <= count; ++i) {
+                    queue.EmplaceWait(i);
+                }
+            });
+            threads.emplace_back([&queue, &sum = sums[t]] {
+                for (size_t i = 0; i < count; ++i) {
+                    sum += queue.PopWait();
+                }
+            });
+        }
+    }
+    size_t total{};
+    for (const size_t sum : sums) {
+        total += sum;
+    }
+    REQUIRE(total == num_threads * count * (count + 1) / 2);
+}
+
+TEST_CASE("MPMCQueue: Stop token wakes the consumer", "[common]") {
+    MPMCQueue<int, 4> queue;
+    std::stop_source stop_source;
+    std::jthread stopper([&stop_source] { stop_source.request_stop(); });
+    int value{-1};
+    queue.PopWait(value, stop_source.get_token());
+    REQUIRE(value == -1);
+}
+
+namespace {
+/// The previous multiple producer queue, a single producer queue behind a producer lock
+template <typename T, size_t Capacity>
+class LockedQueue {
+public:
+    void EmplaceWait(T value) {
+        std::scoped_lock lock{write_mutex};
+        queue.EmplaceWait(value);
+    }
+
+    T PopWait() {
+        return queue.PopWait();
+    }
+
+private:
+    SPSCQueue<T, Capacity> queue;
+    std::mutex write_mutex;
+};
+
+constexpr size_t BENCHMARK_ITEMS = 100000;
+
+/// Moves items from the producers to the calling thread, returns their sum
+template <typename Queue>
+size_t Transfer(Queue& queue, size_t num_producers) {
+    std::vector<std::jthread> producers;
+    for (size_t t = 0; t < num_producers; ++t) {
+        producers.emplace_back([&queue, num_producers] {
+            for (size_t i = 0; i < BENCHMARK_ITEMS / num_producers; ++i) {
+                queue.EmplaceWait(i);
+            }
+        });
+    }
+    size_t sum{};
+    for (size_t i = 0; i < BENCHMARK_ITEMS / num_producers * num_producers; ++i) {
+        sum += queue.PopWait();
+    }
+    return sum;
+}
+
+/// Bounces an item between two threads, measuring the wake up latency of the queue
+template <typename Queue>
+size_t PingPong(Queue& ping, Queue& pong, size_t round_trips) {
+    std::jthread echo([&] {
+        for (size_t i = 0; i < round_trips; ++i) {
+            pong.EmplaceWait(ping.PopWait());
+        }
+    });
+    size_t sum{};
+    for (size_t i = 0; i < round_trips; ++i) {
+        ping.EmplaceWait(i);
+        sum += pong.PopWait();
+    }
+    return sum;
+}
+} // Anonymous namespace
+
+TEST_CASE("MPMCQueue: Benchmark", "[.benchmark]") {
+    constexpr size_t capacity = 1024;
+    const auto spsc = std::make_unique<SPSCQueue<size_t, capacity>>();
+    const auto locked = std::make_unique<LockedQueue<size_t, capacity>>();
+    const auto mpmc = std::make_unique<MPMCQueue<size_t, capacity>>();
+
+    BENCHMARK("SPSCQueue throughput, 1 producer") {
+        return Transfer(*spsc, 1);
+    };
+    BENCHMARK("MPMCQueue throughput, 1 producer") {
+        return Transfer(*mpmc, 1);
+    };
+    for (const size_t num_producers : {2, 4}) {
+        const std::string producers = std::to_string(num_producers) + " producers";
+        BENCHMARK("Locked SPSCQueue throughput, " + producers) {
+            return Transfer(*locked, num_producers);
+        };
+        BENCHMARK("MPMCQueue throughput, " + producers) {
+            return Transfer(*mpmc, num_producers);
+        };
+    }
+
+    constexpr size_t round_trips = 1000;
+    const auto spsc_pong = std::make_unique<SPSCQueue<size_t, capacity>>();
+    const auto mpmc_pong = std::make_unique<MPMCQueue<size_t, capacity>>();
+    BENCHMARK("SPSCQueue latency, 1000 round trips") {
+        return PingPong(*spsc, *spsc_pong, round_trips);
+    };
+    BENCHMARK("MPMCQueue latency, 1000 round trips") {
+        return PingPong(*mpmc, *mpmc_pong, round_trips);
+    };
+}
+
+} // namespace Common
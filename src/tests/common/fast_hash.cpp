@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/fast_hash.h"
+
+using namespace Common;
+
+namespace {
+std::vector<u8> MakeData(size_t size) {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>(i * 7 + i / 251);
+    }
+    return data;
+}
+} // Anonymous namespace
+
+TEST_CASE("FastHash: Known values", "[common]") {
+    // Hashes are persisted in shader caches, they must not change without a version bump.
+    // These results were built against the scalar backend and hold for every backend.
+    constexpr std::array<std::pair<size_t, u64>, 11> expected{{
+        {0, 0xA7094BBE6442F7C6},
+        {3, 0x0FC79AC4CA92341B},
+        {8, 0xF5FB81B94B6FD60E},
+        {16, 0x4A6FB9F8E982DCEC},
+        {17, 0xE2AFAA92B303C510},
+        {100, 0x0E0AAB1A6F7514A0},
+        {256, 0xBE8B512A3BEDE250},
+        {257, 0xC0744777C52C5BE5},
+        {1024, 0xC0BEF30BB99FDC98},
+        {1025, 0x26CD1A7641A67F98},
+        {5000, 0x5ED035797BFFA7D8},
+    }};
+    const std::vector<u8> data = MakeData(5000);
+    for (const auto& [size, hash] : expected) {
+        REQUIRE(FastHash64(data.data(), size) == hash);
+    }
+}
+
+TEST_CASE("FastHash: Fixed size keys", "[common]") {
+    struct SmallKey {
+        std::array<u8, 40> bytes;
+    };
+    struct LargeKey {
+        std::array<u8, 1000> bytes;
+    };
+    const std::vector<u8> data = MakeData(1000);
+    SmallKey small_key;
+    LargeKey large_key;
+    std::copy_n(data.begin(), small_key.bytes.size(), small_key.bytes.begin());
+    std::copy_n(data.begin(), large_key.bytes.size(), large_key.bytes.begin());
+    REQUIRE(FastHash64(small_key) == FastHash64(data.data(), sizeof(small_key)));
+    REQUIRE(FastHash64(large_key) == FastHash64(data.data(), sizeof(large_key)));
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <memory>
@@ -310,4 +312,45 @@ TEST_CASE("Fibers::Rewind", "[common]") {
     REQUIRE(test_control.rewinded);
 }
 
+class TestControl5 {
+public:
+    static constexpr u32 NumSwitches = 100000;
+
+    TestControl5() {
+        work_fiber = std::make_shared<Fiber>([this] { DoWork(); });
+    }
+
+    void Execute() {
+        thread_fiber = Fiber::ThreadToFiber();
+        const auto start{std::chrono::steady_clock::now()};
+        for (u32 i = 0; i < NumSwitches; ++i) {
+            Fiber::YieldTo(thread_fiber, *work_fiber);
+        }
+        const auto end{std::chrono::steady_clock::now()};
+        thread_fiber->Exit();
+
+        const double ns{static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())};
+        // Every iteration switches to the work fiber and back.
+        printf("Fiber switch: %.1f ns/switch\n", ns / (NumSwitches * 2));
+    }
+
+    void DoWork() {
+        while (true) {
+            ++counter;
+            Fiber::YieldTo(work_fiber, *thread_fiber);
+        }
+    }
+
+    std::shared_ptr<Common::Fiber> work_fiber;
+    std::shared_ptr<Common::Fiber> thread_fiber;
+    u32 counter{};
+};
+
+TEST_CASE("Fibers::SwitchLatency", "[common]") {
+    TestControl5 test_control{};
+    test_control.Execute();
+    REQUIRE(test_control.counter == TestControl5::NumSwitches);
+}
+
 } // namespace Common
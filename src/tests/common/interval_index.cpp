@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/interval_index.h"
+
+namespace {
+using Interval = std::tuple<u64, u64, u32>;
+
+std::vector<Interval> Query(const Common::IntervalIndex<u64, u32>& index, u64 begin, u64 end) {
+    std::vector<Interval> result;
+    index.ForEachOverlapping(begin, end, [&result](u64 interval_begin, u64 interval_end, u32 id) {
+        result.emplace_back(interval_begin, interval_end, id);
+    });
+    std::ranges::sort(result);
+    return result;
+}
+} // Anonymous namespace
+
+TEST_CASE("IntervalIndex: Overlaps", "[common]") {
+    Common::IntervalIndex<u64, u32> index;
+    index.Insert(0, 0x1000, 1);
+    index.Insert(0x800, 0x900, 2);
+    index.Insert(0x1000, 0x101000, 3);
+    index.Insert(0x200000, 0x200001, 4);
+    REQUIRE(index.Size() == 4);
+
+    REQUIRE(Query(index, 0, 1) == std::vector<Interval>{{0, 0x1000, 1}});
+    REQUIRE(Query(index, 0x8ff, 0x1001) ==
+            std::vector<Interval>{{0, 0x1000, 1}, {0x800, 0x900, 2}, {0x1000, 0x101000, 3}});
+    REQUIRE(Query(index, 0x900, 0x1000) == std::vector<Interval>{{0, 0x1000, 1}});
+    REQUIRE(Query(index, 0x100fff, 0x200000) == std::vector<Interval>{{0x1000, 0x101000, 3}});
+    REQUIRE(Query(index, 0x101000, 0x200000).empty());
+    REQUIRE(Query(index, 0x200000, 0x200001) == std::vector<Interval>{{0x200000, 0x200001, 4}});
+
+    index.Erase(0x1000, 0x101000, 3);
+    REQUIRE(Query(index, 0x100fff, 0x200000).empty());
+    index.Erase(0, 0x1000, 1);
+    index.Erase(0x800, 0x900, 2);
+    index.Erase(0x200000, 0x200001, 4);
+    REQUIRE(index.Empty());
+}
+
+TEST_CASE("IntervalIndex: Duplicates", "[common]") {
+    Common::IntervalIndex<u64, u32> index;
+    index.Insert(0x4000, 0x8000, 1);
+    index.Insert(0x4000, 0x8000, 2);
+    REQUIRE(Query(index, 0x7fff, 0x8000) ==
+            std::vector<Interval>{{0x4000, 0x8000, 1}, {0x4000, 0x8000, 2}});
+    index.Erase(0x4000, 0x8000, 1);
+    REQUIRE(Query(index, 0, 0x10000) == std::vector<Interval>{{0x4000, 0x8000, 2}});
+}
+
+TEST_CASE("IntervalIndex: Matches linear search", "[common]") {
+    std::mt19937_64 rng{1234};
+    std::uniform_int_distribution<u64> address_dist{0, 1ULL << 24};
+    std::uniform_int_distribution<u32> length_log2_dist{0, 22};
+
+    Common::IntervalIndex<u64, u32> index;
+    std::vector<Interval> intervals;
+    for (u32 id = 0; id < 512; ++id) {
+        const u64 begin = address_dist(rng);
+        const u64 length = 1 + (rng() & ((1ULL << length_log2_dist(rng)) - 1));
+        intervals.emplace_back(begin, begin + length, id);
+        index.Insert(begin, begin + length, id);
+    }
+    for (int query = 0; query < 256; ++query) {
+        const u64 begin = address_dist(rng);
+        const u64 end = begin + 1 + (rng() & 0xfffff);
+        std::vector<Interval> expected;
+        std::ranges::copy_if(intervals, std::back_inserter(expected), [&](const Interval& it) {
+            return std::get<0>(it) < end && begin < std::get<1>(it);
+        });
+        std::ranges::sort(expected);
+        REQUIRE(Query(index, begin, end) == expected);
+    }
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/memory_accounting.h"
+
+using Common::MemoryAccount;
+using Common::MemoryCategory;
+
+namespace {
+u64 Usage(MemoryCategory category) {
+    return Common::GetMemoryUsage()[static_cast<size_t>(category)];
+}
+} // Anonymous namespace
+
+TEST_CASE("MemoryAccounting: Add and remove", "[common]") {
+    const u64 base = Usage(MemoryCategory::VfsCache);
+    Common::AddMemoryUsage(MemoryCategory::VfsCache, 4096);
+    REQUIRE(Usage(MemoryCategory::VfsCache) == base + 4096);
+    Common::RemoveMemoryUsage(MemoryCategory::VfsCache, 4096);
+    REQUIRE(Usage(MemoryCategory::VfsCache) == base);
+}
+
+TEST_CASE("MemoryAccounting: Account", "[common]") {
+    const u64 base = Usage(MemoryCategory::TextureCache);
+    {
+        MemoryAccount account{MemoryCategory::TextureCache};
+        account.Add(1000);
+        account.Set(300);
+        REQUIRE(account.Bytes() == 300);
+        REQUIRE(Usage(MemoryCategory::TextureCache) == base + 300);
+        account.Set(5000);
+        account.Remove(1000);
+        REQUIRE(account.Bytes() == 4000);
+        REQUIRE(Usage(MemoryCategory::TextureCache) == base + 4000);
+    }
+    REQUIRE(Usage(MemoryCategory::TextureCache) == base);
+}
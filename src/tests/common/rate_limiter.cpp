@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/logging/rate_limiter.h"
+
+namespace Common::Log {
+
+namespace {
+constexpr u32 LIMIT = RateLimiter::MAX_MESSAGES_PER_SECOND;
+/// Call sites are told apart by the address of their file name
+constexpr char FILENAME[] = "rate_limiter.cpp";
+
+/// Counts how many of the messages from a call site in a second get through
+u32 CountLogged(RateLimiter& limiter, unsigned int line_num, u32 second, u32 messages) {
+    u32 logged = 0;
+    for (u32 i = 0; i < messages; i++) {
+        u32 suppressed = 0;
+        logged += limiter.Check(FILENAME, line_num, second, suppressed) ? 1 : 0;
+    }
+    return logged;
+}
+} // Anonymous namespace
+
+TEST_CASE("RateLimiter::Limit", "[common]") {
+    RateLimiter limiter;
+    REQUIRE(CountLogged(limiter, 1, 0, LIMIT + 36) == LIMIT);
+
+    // The first message of the next second gets through and reports what was dropped
+    u32 suppressed = 0;
+    REQUIRE(limiter.Check(FILENAME, 1, 1, suppressed));
+    REQUIRE(suppressed == 36);
+
+    // Nothing was dropped in a second within the limit
+    REQUIRE(CountLogged(limiter, 1, 1, LIMIT - 1) == LIMIT - 1);
+    REQUIRE(limiter.Check(FILENAME, 1, 2, suppressed));
+    REQUIRE(suppressed == 0);
+}
+
+TEST_CASE("RateLimiter::CallSites", "[common]") {
+    RateLimiter limiter;
+
+    // A call site hitting its limit does not limit the others
+    REQUIRE(CountLogged(limiter, 1, 0, LIMIT * 2) == LIMIT);
+    REQUIRE(CountLogged(limiter, 2, 0, LIMIT * 2) == LIMIT);
+    REQUIRE(CountLogged(limiter, 3, 0, 1) == 1);
+}
+
+TEST_CASE("RateLimiter::Threads", "[common]") {
+    RateLimiter limiter;
+    std::atomic<u32> logged{};
+    std::vector<std::thread> threads;
+    for (u32 i = 0; i < 4; i++) {
+        threads.emplace_back([&] { logged += CountLogged(limiter, 1, 0, LIMIT * 4); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Messages from every thread count towards the same limit
+    REQUIRE(logged == LIMIT);
+    u32 suppressed = 0;
+    REQUIRE(limiter.Check(FILENAME, 1, 1, suppressed));
+    REQUIRE(suppressed == LIMIT * 15);
+}
+
+} // namespace Common::Log
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/seqlock.h"
+
+namespace {
+struct Sample {
+    std::array<u32, 9> values{};
+};
+} // Anonymous namespace
+
+TEST_CASE("SeqLock: Store and load", "[common]") {
+    Common::SeqLock<Sample> lock;
+    REQUIRE(lock.Load().values == std::array<u32, 9>{});
+
+    Sample sample;
+    sample.values.fill(7);
+    lock.Store(sample);
+    REQUIRE(lock.Load().values == sample.values);
+}
+
+TEST_CASE("SeqLock: Loads never tear", "[common]") {
+    Common::SeqLock<Sample> lock;
+    std::atomic_bool done{false};
+    std::thread writer([&] {
+        for (u32 i = 1; i <= 200'000; ++i) {
+            Sample sample;
+            sample.values.fill(i);
+            lock.Store(sample);
+        }
+        done = true;
+    });
+
+    bool torn = false;
+    while (!done) {
+        const Sample sample = lock.Load();
+        for (const u32 value : sample.values) {
+            torn |= value != sample.values[0];
+        }
+    }
+    writer.join();
+
+    REQUIRE(!torn);
+    REQUIRE(lock.Load().values[8] == 200'000);
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/settings.h"
+
+namespace Settings {
+
+namespace {
+/// Restores the settings read by the snapshot and publishes them again when it is destroyed
+struct ScopedSettings {
+    ScopedSettings()
+        : old_gpu_accuracy{values.gpu_accuracy.GetValue()},
+          old_fast_gpu_time{values.use_fast_gpu_time.GetValue()},
+          old_setup{values.resolution_setup.GetValue()} {}
+
+    ~ScopedSettings() {
+        values.gpu_accuracy.SetValue(old_gpu_accuracy);
+        values.use_fast_gpu_time.SetValue(old_fast_gpu_time);
+        values.resolution_setup.SetValue(old_setup);
+        UpdateRescalingInfo();
+        UpdateGPUAccuracy();
+    }
+
+    GpuAccuracy old_gpu_accuracy;
+    bool old_fast_gpu_time;
+    ResolutionSetup old_setup;
+};
+
+void SetScale(ResolutionSetup setup) {
+    values.resolution_setup.SetValue(setup);
+    UpdateRescalingInfo();
+}
+} // Anonymous namespace
+
+TEST_CASE("HotValues::Publish", "[common]") {
+    ScopedSettings settings;
+    values.gpu_accuracy.SetValue(GpuAccuracy::Normal);
+    UpdateGPUAccuracy();
+    values.use_fast_gpu_time.SetValue(false);
+    SetScale(ResolutionSetup::Res3X);
+
+    // Settings only reach the snapshot once they are published
+    REQUIRE(!GetHotValues().use_fast_gpu_time);
+    REQUIRE(GetHotValues().resolution_info.up_scale == 3);
+    values.use_fast_gpu_time.SetValue(true);
+    REQUIRE(!GetHotValues().use_fast_gpu_time);
+    UpdateHotValues();
+    REQUIRE(GetHotValues().use_fast_gpu_time);
+
+    // The GPU accuracy waits for the end of the command list
+    values.gpu_accuracy.SetValue(GpuAccuracy::Extreme);
+    UpdateHotValues();
+    REQUIRE(GetHotValues().gpu_accuracy == GpuAccuracy::Normal);
+    REQUIRE(!IsGPULevelHigh());
+    UpdateGPUAccuracy();
+    REQUIRE(GetHotValues().gpu_accuracy == GpuAccuracy::Extreme);
+    REQUIRE(IsGPULevelHigh());
+    REQUIRE(IsGPULevelExtreme());
+}
+
+TEST_CASE("HotValues::Snapshots", "[common]") {
+    ScopedSettings settings;
+    SetScale(ResolutionSetup::Res2X);
+    const HotValues& snapshot = GetHotValues();
+
+    // Publishing the same values keeps the current snapshot
+    UpdateHotValues();
+    UpdateGPUAccuracy();
+    REQUIRE(&GetHotValues() == &snapshot);
+
+    // Changes publish a new snapshot and leave the old one as it was
+    SetScale(ResolutionSetup::Res4X);
+    REQUIRE(&GetHotValues() != &snapshot);
+    REQUIRE(GetHotValues().resolution_info.up_scale == 4);
+    REQUIRE(snapshot.resolution_info.up_scale == 2);
+}
+
+TEST_CASE("HotValues::Threads", "[common]") {
+    ScopedSettings settings;
+    values.use_fast_gpu_time.SetValue(true);
+    SetScale(ResolutionSetup::Res2X);
+    std::atomic<bool> done{};
+    std::atomic<bool> consistent{true};
+    std::thread reader([&] {
+        // Values published together are always seen together
+        while (!done.load(std::memory_order_relaxed)) {
+            const HotValues& snapshot = GetHotValues();
+            if (snapshot.use_fast_gpu_time != (snapshot.resolution_info.up_scale == 2)) {
+                consistent = false;
+            }
+        }
+    });
+    for (int i = 0; i < 1000; i++) {
+        const bool fast_gpu_time = i % 2 == 0;
+        values.use_fast_gpu_time.SetValue(fast_gpu_time);
+        SetScale(fast_gpu_time ? ResolutionSetup::Res2X : ResolutionSetup::Res3X);
+    }
+    done = true;
+    reader.join();
+    REQUIRE(consistent);
+}
+
+} // namespace Settings
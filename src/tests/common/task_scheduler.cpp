@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <cstddef>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/task_scheduler.h"
+
+namespace Common {
+
+TEST_CASE("TaskGroup: Runs every task", "[common]") {
+    TaskGroup group{TaskPriority::FrameCritical};
+    std::atomic<size_t> count{};
+    constexpr size_t num_tasks = 1000;
+    for (size_t i = 0; i < num_tasks; ++i) {
+        group.QueueWork([&count] { ++count; });
+    }
+    group.WaitForRequests();
+    REQUIRE(count == num_tasks);
+}
+
+TEST_CASE("TaskGroup: Serial group keeps the queued order", "[common]") {
+    TaskGroup group{TaskPriority::Background, 1};
+    std::mutex mutex;
+    std::vector<size_t> order;
+    constexpr size_t num_tasks = 100;
+    for (size_t i = 0; i < num_tasks; ++i) {
+        group.QueueWork([&, i] {
+            std::scoped_lock lk{mutex};
+            order.push_back(i);
+        });
+    }
+    group.WaitForRequests();
+    REQUIRE(order.size() == num_tasks);
+    for (size_t i = 0; i < num_tasks; ++i) {
+        REQUIRE(order[i] == i);
+    }
+}
+
+TEST_CASE("TaskScheduler: Frame work leaves a worker to latency critical work", "[common]") {
+    TaskScheduler scheduler{2};
+    std::atomic<bool> release{};
+    std::atomic<size_t> frame_started{};
+    for (size_t i = 0; i < 2; ++i) {
+        scheduler.Submit(TaskPriority::FrameCritical, [&] {
+            ++frame_started;
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (frame_started == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+
+    // The second frame task waits for the first one while latency critical work still runs
+    std::atomic<bool> latency_ran{};
+    scheduler.Submit(TaskPriority::LatencyCritical, [&] { latency_ran = true; });
+    while (!latency_ran && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    REQUIRE(latency_ran);
+    REQUIRE(frame_started == 1);
+    release = true;
+}
+
+} // namespace Common
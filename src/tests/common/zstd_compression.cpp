@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/zstd_compression.h"
+
+using namespace Common::Compression;
+
+namespace {
+std::vector<u8> MakeEntry(size_t index) {
+    // Entries share most of their structure, like the entries of a pipeline cache
+    std::vector<u8> entry(256 + index % 64);
+    for (size_t i = 0; i < entry.size(); ++i) {
+        entry[i] = static_cast<u8>(i % 13 == 0 ? index * 31 + i : i / 4);
+    }
+    return entry;
+}
+} // Anonymous namespace
+
+TEST_CASE("ZSTD: Dictionary round trip", "[common]") {
+    std::vector<u8> samples;
+    std::vector<size_t> sample_sizes;
+    for (size_t index = 0; index < 256; ++index) {
+        const std::vector<u8> entry = MakeEntry(index);
+        samples.insert(samples.end(), entry.begin(), entry.end());
+        sample_sizes.push_back(entry.size());
+    }
+    std::vector<u8> dictionary_data = TrainDictionaryZSTD(samples, sample_sizes, 16 * 1024);
+    REQUIRE(!dictionary_data.empty());
+    const ZSTDDictionary dictionary(std::move(dictionary_data), 3);
+
+    const std::vector<u8> entry = MakeEntry(1000);
+    const std::vector<u8> compressed = CompressDataZSTD(entry.data(), entry.size(), dictionary);
+    REQUIRE(compressed.size() < CompressDataZSTD(entry.data(), entry.size(), 3).size());
+    REQUIRE(DecompressDataZSTD(compressed, dictionary) == entry);
+}
+
+TEST_CASE("ZSTD: Streaming frames", "[common]") {
+    std::stringstream file;
+    {
+        ZSTDCompressBuffer compress_buffer(file, 3);
+        std::ostream stream(&compress_buffer);
+        for (size_t index = 0; index < 16; ++index) {
+            const std::vector<u8> entry = MakeEntry(index);
+            stream.write(reinterpret_cast<const char*>(entry.data()),
+                         static_cast<std::streamsize>(entry.size()));
+            compress_buffer.EndFrame();
+        }
+    }
+    const std::string compressed = file.str();
+    std::streamsize decompressed_size{};
+
+    ZSTDDecompressBuffer decompress_buffer(file);
+    std::istream stream(&decompress_buffer);
+    stream.exceptions(std::ios::failbit | std::ios::badbit);
+    for (size_t index = 0; index < 16; ++index) {
+        const std::vector<u8> expected = MakeEntry(index);
+        std::vector<u8> entry(expected.size());
+        stream.read(reinterpret_cast<char*>(entry.data()),
+                    static_cast<std::streamsize>(entry.size()));
+        REQUIRE(entry == expected);
+        decompressed_size += static_cast<std::streamsize>(entry.size());
+    }
+    REQUIRE(stream.peek() == std::istream::traits_type::eof());
+
+    // Truncated frames are reported instead of reading as the end of the stream
+    std::stringstream truncated_file(compressed.substr(0, compressed.size() - 4));
+    ZSTDDecompressBuffer truncated_buffer(truncated_file);
+    std::istream truncated_stream(&truncated_buffer);
+    truncated_stream.exceptions(std::ios::failbit | std::ios::badbit);
+    std::vector<char> data(static_cast<size_t>(decompressed_size));
+    REQUIRE_THROWS_AS(truncated_stream.read(data.data(), decompressed_size), std::ios_base::failure);
+}
@@ -31,6 +31,12 @@ std::optional<std::chrono::nanoseconds> HostCallbackTemplate(s64 time,
     return std::nullopt;
 }
 
+std::optional<std::chrono::nanoseconds> UnexpectedCallback(s64 time,
+                                                           std::chrono::nanoseconds ns_late) {
+    FAIL("Unscheduled event ran");
+    return std::nullopt;
+}
+
 struct ScopeInit final {
     ScopeInit() {
         core_timing.SetMulticore(true);
@@ -139,3 +145,41 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[ScheduleUnscheduleThroughput]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    constexpr size_t num_types = 64;
+    constexpr size_t events_per_type = 256;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < num_types; i++) {
+        events.push_back(Core::Timing::CreateEvent("throughput", UnexpectedCallback));
+    }
+
+    core_timing.SyncPause(true);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < events_per_type; i++) {
+        for (const auto& event : events) {
+            core_timing.ScheduleEvent(std::chrono::seconds{10}, event);
+        }
+    }
+    const auto scheduled = std::chrono::steady_clock::now();
+    for (const auto& event : events) {
+        core_timing.UnscheduleEvent(event);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    REQUIRE(!core_timing.Advance().has_value());
+
+    const auto Nanoseconds = [](auto duration) {
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+    constexpr double num_events = static_cast<double>(num_types * events_per_type);
+    printf("HostTimer Schedule: %.1f ns/event\n", Nanoseconds(scheduled - start) / num_events);
+    printf("HostTimer Unschedule: %.1f ns/event\n", Nanoseconds(end - scheduled) / num_events);
+
+    core_timing.SyncPause(false);
+}
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/file_sys/fssystem/fssystem_block_verification_state.h"
+#include "core/file_sys/fssystem/fssystem_integrity_verification_storage.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace FileSys {
+
+namespace {
+constexpr s64 BlockSize = 64;
+constexpr size_t BlockCount = 4;
+constexpr size_t DataSize = BlockSize * BlockCount;
+
+// SHA-256 of a block of zeroes
+constexpr std::array<u8, 0x20> ZeroBlockHash{
+    0xf5, 0xa5, 0xfd, 0x42, 0xd1, 0x6a, 0x20, 0x30, 0x27, 0x98, 0xef, 0x6e, 0xd3, 0x09, 0x97, 0x9b,
+    0x43, 0x00, 0x3d, 0x23, 0x20, 0xd9, 0xf0, 0xe8, 0xea, 0x98, 0x31, 0xa9, 0x27, 0x59, 0xfb, 0x4b,
+};
+
+struct TestStorage {
+    explicit TestStorage(VerificationMode mode) {
+        std::vector<u8> hashes;
+        for (size_t i = 0; i < BlockCount; ++i) {
+            hashes.insert(hashes.end(), ZeroBlockHash.begin(), ZeroBlockHash.end());
+        }
+        hash_storage = std::make_shared<VectorVfsFile>(std::move(hashes));
+        data_storage = std::make_shared<VectorVfsFile>(std::vector<u8>(DataSize));
+        storage.Initialize(hash_storage, data_storage, BlockSize, BlockSize, true, mode);
+    }
+
+    void Corrupt(size_t offset) {
+        const u8 value = 0xFF;
+        data_storage->Write(&value, 1, offset);
+    }
+
+    size_t Read(size_t size, size_t offset) {
+        std::vector<u8> buffer(size);
+        return storage.Read(buffer.data(), buffer.size(), offset);
+    }
+
+    std::shared_ptr<VectorVfsFile> hash_storage;
+    std::shared_ptr<VectorVfsFile> data_storage;
+    IntegrityVerificationStorage storage;
+};
+} // Anonymous namespace
+
+TEST_CASE("IntegrityVerificationStorage::Off", "[core]") {
+    TestStorage test(VerificationMode::Off);
+    test.Corrupt(BlockSize);
+    REQUIRE(test.Read(DataSize, 0) == DataSize);
+}
+
+TEST_CASE("IntegrityVerificationStorage::Once", "[core]") {
+    TestStorage test(VerificationMode::Once);
+    test.Corrupt(BlockSize * 2 + 3);
+
+    // Intact blocks read fine, whole or in part
+    REQUIRE(test.Read(BlockSize * 2, 0) == BlockSize * 2);
+    REQUIRE(test.Read(16, BlockSize * 3 + 8) == 16);
+
+    // The corrupted block fails every read, it is never recorded as verified
+    REQUIRE(test.Read(BlockSize, BlockSize * 2) == 0);
+    REQUIRE(test.Read(8, BlockSize * 2 + 40) == 0);
+    REQUIRE(test.Read(DataSize, 0) == 0);
+
+    // Verified blocks are not hashed again
+    test.Corrupt(0);
+    REQUIRE(test.Read(BlockSize, 0) == BlockSize);
+}
+
+TEST_CASE("IntegrityVerificationStorage::Asynchronous", "[core]") {
+    TestStorage test(VerificationMode::Asynchronous);
+
+    // Intact data keeps being served once verified
+    REQUIRE(test.Read(BlockSize, 0) == BlockSize);
+    BlockVerificationState::WaitForVerification();
+    REQUIRE(test.Read(BlockSize, 0) == BlockSize);
+
+    // A corrupted block is only caught off the read path, then every read fails
+    test.Corrupt(BlockSize + 5);
+    REQUIRE(test.Read(8, BlockSize + 16) == 8);
+    BlockVerificationState::WaitForVerification();
+    REQUIRE(test.Read(BlockSize, 0) == 0);
+    REQUIRE(test.Read(BlockSize, BlockSize * 3) == 0);
+}
+
+} // namespace FileSys
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+
+namespace Service::FileSystem {
+
+namespace {
+using namespace Common::Literals;
+
+/// Read-only file that counts the reads that reach it
+class CountingFile final : public FileSys::VfsFile {
+public:
+    explicit CountingFile(size_t size) : data(size) {
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<u8>(i * 7 + (i >> 12));
+        }
+    }
+
+    std::string GetName() const override {
+        return "counting";
+    }
+    std::size_t GetSize() const override {
+        return data.size();
+    }
+    bool Resize(std::size_t new_size) override {
+        return false;
+    }
+    FileSys::VirtualDir GetContainingDirectory() const override {
+        return nullptr;
+    }
+    bool IsWritable() const override {
+        return false;
+    }
+    bool IsReadable() const override {
+        return true;
+    }
+    std::size_t Read(u8* out, std::size_t length, std::size_t offset) const override {
+        ++reads;
+        if (offset >= data.size()) {
+            return 0;
+        }
+        length = std::min(length, data.size() - offset);
+        std::memcpy(out, data.data() + offset, length);
+        return length;
+    }
+    std::size_t Write(const u8* in, std::size_t length, std::size_t offset) override {
+        return 0;
+    }
+    bool Rename(std::string_view name) override {
+        return false;
+    }
+
+    bool Matches(const std::vector<u8>& read, size_t offset) const {
+        return std::equal(read.begin(), read.end(), data.begin() + offset);
+    }
+
+    std::vector<u8> data;
+    mutable std::atomic<size_t> reads{};
+};
+
+std::vector<u8> Read(ReadAheadFile& file, size_t length, size_t offset) {
+    std::vector<u8> out(length);
+    out.resize(file.Read(out.data(), out.size(), offset));
+    return out;
+}
+} // Anonymous namespace
+
+TEST_CASE("ReadAheadFile::Prefetch", "[core]") {
+    const auto host = std::make_shared<CountingFile>(4_MiB);
+    ReadAheadFile file{host};
+    file.Prefetch({{.offset = 0, .size = 1536_KiB}, {.offset = 3_MiB, .size = 4_KiB}});
+    ReadAheadFile::WaitForPrefetch();
+    const size_t prefetch_reads{host->reads};
+
+    // Reads within the chunks, also across two of them, are served from memory
+    REQUIRE(host->Matches(Read(file, 16_KiB, 0), 0));
+    REQUIRE(host->Matches(Read(file, 64_KiB, 1_MiB - 32_KiB), 1_MiB - 32_KiB));
+    REQUIRE(host->Matches(Read(file, 4_KiB, 3_MiB), 3_MiB));
+    REQUIRE(host->reads == prefetch_reads);
+
+    // Reads outside of them go to the file, as do reads of chunks that were read to their end
+    REQUIRE(host->Matches(Read(file, 4_KiB, 2_MiB), 2_MiB));
+    REQUIRE(host->reads == prefetch_reads + 1);
+    REQUIRE(host->Matches(Read(file, 4_KiB, 3_MiB), 3_MiB));
+    REQUIRE(host->reads == prefetch_reads + 2);
+}
+
+TEST_CASE("ReadAheadFile::PrefetchBound", "[core]") {
+    constexpr size_t Size = ReadAheadFile::MaxPrefetchedSize + 2_MiB;
+    const auto host = std::make_shared<CountingFile>(Size);
+    ReadAheadFile file{host};
+    file.Prefetch({{.offset = 0, .size = Size}});
+
+    // The guest never reads the start, the oldest chunks are dropped to make room for the rest
+    ReadAheadFile::WaitForPrefetch();
+    const size_t prefetch_reads{host->reads};
+    REQUIRE(host->Matches(Read(file, 4_KiB, Size - 4_KiB), Size - 4_KiB));
+    REQUIRE(host->reads == prefetch_reads);
+    REQUIRE(host->Matches(Read(file, 4_KiB, 0), 0));
+    REQUIRE(host->reads == prefetch_reads + 1);
+}
+
+TEST_CASE("ReadAheadFile::PrefetchFollowsGuest", "[core]") {
+    constexpr size_t Size = ReadAheadFile::MaxPrefetchedSize * 2;
+    const auto host = std::make_shared<CountingFile>(Size);
+    ReadAheadFile file{host};
+    file.Prefetch({{.offset = 0, .size = Size}});
+
+    // Reading the prefetched data makes room for more, so nothing has to be dropped
+    for (size_t offset = 0; offset < Size; offset += 1_MiB) {
+        REQUIRE(host->Matches(Read(file, 1_MiB, offset), offset));
+    }
+    ReadAheadFile::WaitForPrefetch();
+}
+
+} // namespace Service::FileSystem
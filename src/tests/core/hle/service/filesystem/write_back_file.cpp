@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/fs/path_util.h"
+#include "core/file_sys/fs_filesystem.h"
+#include "core/file_sys/vfs/vfs_real.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+#include "core/hle/service/filesystem/fsp/fs_write_back.h"
+
+namespace Service::FileSystem {
+
+namespace {
+std::vector<u8> Bytes(std::string_view str) {
+    return {str.begin(), str.end()};
+}
+
+std::vector<u8> ReadAll(const FileSys::VfsFile& file) {
+    std::vector<u8> data(file.GetSize());
+    data.resize(file.Read(data.data(), data.size(), 0));
+    return data;
+}
+
+/// Host directory that is removed along with everything written to it
+struct TempDirectory {
+    TempDirectory()
+        : path{std::filesystem::temp_directory_path() / "yuzu_write_back_file_test"},
+          dir{[this] {
+              std::filesystem::remove_all(path);
+              return vfs.CreateDirectory(Common::FS::PathToUTF8String(path),
+                                         FileSys::OpenMode::ReadWrite);
+          }()} {}
+
+    ~TempDirectory() {
+        dir.reset();
+        std::filesystem::remove_all(path);
+    }
+
+    std::filesystem::path path;
+    FileSys::RealVfsFilesystem vfs;
+    FileSys::VirtualDir dir;
+};
+} // Anonymous namespace
+
+TEST_CASE("WriteBackFile::Coalesce", "[core]") {
+    const auto host = std::make_shared<FileSys::VectorVfsFile>(Bytes("0123456789"), "coalesce");
+    WriteBackFile file{host};
+
+    REQUIRE(file.WriteBytes(Bytes("abcd"), 2) == 4);
+    REQUIRE(file.WriteBytes(Bytes("XY"), 4) == 2);
+    REQUIRE(file.WriteBytes(Bytes("zz"), 12) == 2);
+
+    // Buffered writes are visible, and extend the file with zeroes, before reaching the host
+    REQUIRE(ReadAll(file) == std::vector<u8>{'0', '1', 'a', 'b', 'X', 'Y', '6', '7', '8', '9', 0,
+                                             0, 'z', 'z'});
+    REQUIRE(ReadAll(*host) == Bytes("0123456789"));
+
+    FlushWriteBackFiles();
+    REQUIRE(ReadAll(*host) == ReadAll(file));
+}
+
+TEST_CASE("WriteBackFile::SharedHandles", "[core]") {
+    const auto host = std::make_shared<FileSys::VectorVfsFile>(Bytes("........"), "shared");
+    WriteBackFile first{host};
+    WriteBackFile second{host};
+
+    REQUIRE(first.WriteBytes(Bytes("ab"), 0) == 2);
+    REQUIRE(second.WriteBytes(Bytes("cd"), 6) == 2);
+    REQUIRE(ReadAll(first) == Bytes("ab....cd"));
+    REQUIRE(ReadAll(second) == Bytes("ab....cd"));
+    REQUIRE(ReadAll(*host) == Bytes("........"));
+
+    first.Flush();
+    FlushWriteBackFiles(host->GetFullPath());
+    REQUIRE(ReadAll(*host) == Bytes("ab....cd"));
+}
+
+TEST_CASE("WriteBackFile::ScopedFlush", "[core]") {
+    TempDirectory temp;
+    const auto saves = temp.dir->CreateSubdirectory("saves");
+    const auto other = temp.dir->CreateSubdirectory("other");
+    const auto save_host = saves->CreateFile("save.bin");
+    const auto other_host = other->CreateFile("other.bin");
+    REQUIRE(save_host != nullptr);
+    REQUIRE(other_host != nullptr);
+
+    WriteBackFile save{save_host};
+    WriteBackFile other_file{other_host};
+    REQUIRE(save.WriteBytes(Bytes("save"), 0) == 4);
+    REQUIRE(other_file.WriteBytes(Bytes("other"), 0) == 5);
+
+    // Only the files below the flushed directory are written back
+    FlushWriteBackFiles(saves->GetFullPath());
+    REQUIRE(ReadAll(*save_host) == Bytes("save"));
+    REQUIRE(other_host->GetSize() == 0);
+
+    FlushWriteBackFiles(other_host->GetFullPath());
+    REQUIRE(ReadAll(*other_host) == Bytes("other"));
+}
+
+TEST_CASE("WriteBackFile::Rename", "[core]") {
+    TempDirectory temp;
+    REQUIRE(temp.dir->CreateFile("old.bin") != nullptr);
+
+    WriteBackFile file{temp.dir->GetFile("old.bin")};
+    const auto old_path = file.GetFullPath();
+    REQUIRE(file.WriteBytes(Bytes("abcd"), 0) == 4);
+
+    // Rename the file behind the handle's back, as the filesystem service does
+    FlushWriteBackFiles(old_path);
+    REQUIRE(temp.dir->GetFile("old.bin")->Rename("new.bin"));
+    RenameWriteBackFile(old_path, temp.dir->GetFile("new.bin"));
+
+    // The handle now writes to the renamed file, instead of bringing the old one back
+    REQUIRE(file.GetName() == "new.bin");
+    REQUIRE(file.WriteBytes(Bytes("ef"), 4) == 2);
+    FlushWriteBackFiles();
+    REQUIRE(temp.dir->GetFile("old.bin") == nullptr);
+    REQUIRE(ReadAll(*temp.dir->GetFile("new.bin")) == Bytes("abcdef"));
+
+    // Renaming through the handle itself follows the file as well
+    REQUIRE(file.Rename("newer.bin"));
+    REQUIRE(file.WriteBytes(Bytes("gh"), 6) == 2);
+    FlushWriteBackFiles();
+    REQUIRE(temp.dir->GetFile("new.bin") == nullptr);
+    REQUIRE(ReadAll(*temp.dir->GetFile("newer.bin")) == Bytes("abcdefgh"));
+}
+
+} // namespace Service::FileSystem
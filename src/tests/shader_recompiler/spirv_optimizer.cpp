@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <initializer_list>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spirv/unified1/spirv.hpp>
+
+#include "common/common_types.h"
+#include "shader_recompiler/backend/spirv/spirv_optimizer.h"
+
+namespace Shader::Backend::SPIRV {
+
+namespace {
+// "main" and "dead" as null terminated literal strings
+constexpr u32 MAIN_STRING = 0x6e69616d;
+constexpr u32 DEAD_STRING = 0x64616564;
+
+enum Id : u32 {
+    Float = 1,
+    Void,
+    FunctionType,
+    InputPointer,
+    PrivatePointer,
+    UniformPointer,
+    UniformStruct,
+    UniformStructPointer,
+    Int,
+    Zero,
+    Main,
+    Input,
+    VolatileInput,
+    DeadPrivate,
+    LivePrivate,
+    Uniform,
+    FirstLabel,
+    SecondLabel,
+    FirstResult,
+    Bound = 64,
+};
+
+constexpr u32 StorageClass(spv::StorageClass storage_class) {
+    return static_cast<u32>(storage_class);
+}
+
+/// Assembles a module out of instructions given as opcode and operands
+class Module {
+public:
+    Module() : code{spv::MagicNumber, 0x00010000, 0, Bound, 0} {}
+
+    Module& Add(spv::Op opcode, std::initializer_list<u32> operands) {
+        code.push_back((static_cast<u32>(operands.size() + 1) << 16) | static_cast<u32>(opcode));
+        code.insert(code.end(), operands.begin(), operands.end());
+        return *this;
+    }
+
+    std::vector<u32> code;
+};
+
+/// Declares the variables and opens the entry point, optionally with an unused private variable
+Module Prologue(bool dead_private) {
+    Module module;
+    if (dead_private) {
+        module
+            .Add(spv::Op::OpEntryPoint, {static_cast<u32>(spv::ExecutionModel::Vertex), Main,
+                                         MAIN_STRING, 0, Input, VolatileInput, DeadPrivate})
+            .Add(spv::Op::OpName, {DeadPrivate, DEAD_STRING, 0});
+    } else {
+        module.Add(spv::Op::OpEntryPoint, {static_cast<u32>(spv::ExecutionModel::Vertex), Main,
+                                           MAIN_STRING, 0, Input, VolatileInput});
+    }
+    module.Add(spv::Op::OpDecorate, {Input, static_cast<u32>(spv::Decoration::Location), 0})
+        .Add(spv::Op::OpDecorate, {VolatileInput, static_cast<u32>(spv::Decoration::Volatile)})
+        .Add(spv::Op::OpTypeFloat, {Float, 32})
+        .Add(spv::Op::OpTypeVoid, {Void})
+        .Add(spv::Op::OpTypeFunction, {FunctionType, Void})
+        .Add(spv::Op::OpTypeInt, {Int, 32, 0})
+        .Add(spv::Op::OpConstant, {Int, Zero, 0})
+        .Add(spv::Op::OpTypeStruct, {UniformStruct, Float})
+        .Add(spv::Op::OpTypePointer, {InputPointer, StorageClass(spv::StorageClass::Input), Float})
+        .Add(spv::Op::OpTypePointer,
+             {PrivatePointer, StorageClass(spv::StorageClass::Private), Float})
+        .Add(spv::Op::OpTypePointer,
+             {UniformPointer, StorageClass(spv::StorageClass::Uniform), Float})
+        .Add(spv::Op::OpTypePointer,
+             {UniformStructPointer, StorageClass(spv::StorageClass::Uniform), UniformStruct})
+        .Add(spv::Op::OpVariable, {InputPointer, Input, StorageClass(spv::StorageClass::Input)})
+        .Add(spv::Op::OpVariable,
+             {InputPointer, VolatileInput, StorageClass(spv::StorageClass::Input)});
+    if (dead_private) {
+        module.Add(spv::Op::OpVariable,
+                   {PrivatePointer, DeadPrivate, StorageClass(spv::StorageClass::Private)});
+    }
+    module
+        .Add(spv::Op::OpVariable,
+             {PrivatePointer, LivePrivate, StorageClass(spv::StorageClass::Private)})
+        .Add(spv::Op::OpVariable,
+             {UniformStructPointer, Uniform, StorageClass(spv::StorageClass::Uniform)})
+        .Add(spv::Op::OpFunction, {Void, Main, 0, FunctionType})
+        .Add(spv::Op::OpLabel, {FirstLabel});
+    return module;
+}
+} // Anonymous namespace
+
+TEST_CASE("OptimizeSPIRV::DeadVariables", "[shader]") {
+    Module module{Prologue(true)};
+    module.Add(spv::Op::OpStore, {LivePrivate, FirstResult})
+        .Add(spv::Op::OpReturn, {})
+        .Add(spv::Op::OpFunctionEnd, {});
+    OptimizeSPIRV(module.code);
+
+    // The unused private variable is gone along with its name and interface entry
+    Module expected{Prologue(false)};
+    expected.Add(spv::Op::OpStore, {LivePrivate, FirstResult})
+        .Add(spv::Op::OpReturn, {})
+        .Add(spv::Op::OpFunctionEnd, {});
+    REQUIRE(module.code == expected.code);
+}
+
+TEST_CASE("OptimizeSPIRV::ForwardLoads", "[shader]") {
+    Module module{Prologue(false)};
+    module.Add(spv::Op::OpLoad, {Float, FirstResult, Input})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 1, Input})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 2, VolatileInput})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 3, VolatileInput})
+        .Add(spv::Op::OpAccessChain, {UniformPointer, FirstResult + 4, Uniform, Zero})
+        .Add(spv::Op::OpAccessChain, {UniformPointer, FirstResult + 5, Uniform, Zero})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 6, FirstResult + 4})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 7, FirstResult + 5})
+        .Add(spv::Op::OpStore, {LivePrivate, FirstResult + 7})
+        .Add(spv::Op::OpBranch, {SecondLabel})
+        .Add(spv::Op::OpLabel, {SecondLabel})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 8, Input})
+        .Add(spv::Op::OpReturn, {})
+        .Add(spv::Op::OpFunctionEnd, {});
+    OptimizeSPIRV(module.code);
+
+    // Repeated reads of read-only memory in a block reuse the first result, including loads
+    // through repeated access chains. Volatile reads and reads in other blocks are kept.
+    Module expected{Prologue(false)};
+    expected.Add(spv::Op::OpLoad, {Float, FirstResult, Input})
+        .Add(spv::Op::OpCopyObject, {Float, FirstResult + 1, FirstResult})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 2, VolatileInput})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 3, VolatileInput})
+        .Add(spv::Op::OpAccessChain, {UniformPointer, FirstResult + 4, Uniform, Zero})
+        .Add(spv::Op::OpCopyObject, {UniformPointer, FirstResult + 5, FirstResult + 4})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 6, FirstResult + 4})
+        .Add(spv::Op::OpCopyObject, {Float, FirstResult + 7, FirstResult + 6})
+        .Add(spv::Op::OpStore, {LivePrivate, FirstResult + 7})
+        .Add(spv::Op::OpBranch, {SecondLabel})
+        .Add(spv::Op::OpLabel, {SecondLabel})
+        .Add(spv::Op::OpLoad, {Float, FirstResult + 8, Input})
+        .Add(spv::Op::OpReturn, {})
+        .Add(spv::Op::OpFunctionEnd, {});
+    REQUIRE(module.code == expected.code);
+}
+
+TEST_CASE("OptimizeSPIRV::Malformed", "[shader]") {
+    Module module{Prologue(true)};
+    module.Add(spv::Op::OpReturn, {});
+    module.code.push_back((8U << 16) | static_cast<u32>(spv::Op::OpFunctionEnd));
+    const std::vector<u32> original{module.code};
+
+    // A module that can not be parsed is left untouched
+    OptimizeSPIRV(module.code);
+    REQUIRE(module.code == original);
+}
+
+} // namespace Shader::Backend::SPIRV
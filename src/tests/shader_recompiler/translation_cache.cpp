@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace Shader::Maxwell {
+
+namespace {
+constexpr u64 HASH = 0x1234'5678'9abc'def0ULL;
+
+// Scheduling word, two NOPs and an unconditional EXIT
+constexpr u64 SCHED = 0x001f'8000'fc00'07e0ULL;
+constexpr u64 NOP = 0x50b0'0000'0007'0f00ULL;
+constexpr u64 EXIT = 0xe300'0000'0007'000fULL;
+
+/// Vertex environment over a small instruction buffer that counts what it is asked
+class TestEnvironment final : public Environment {
+public:
+    explicit TestEnvironment(std::vector<u64> code_) : code{std::move(code_)} {
+        stage = Stage::VertexB;
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        ++instruction_reads;
+        const size_t index{address / sizeof(u64)};
+        return index < code.size() ? code[index] : 0;
+    }
+
+    u32 ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) override {
+        return 0;
+    }
+
+    TextureType ReadTextureType(u32 raw_handle) override {
+        return TextureType::Color2D;
+    }
+
+    TexturePixelFormat ReadTexturePixelFormat(u32 raw_handle) override {
+        return TexturePixelFormat::A8B8G8R8_UNORM;
+    }
+
+    bool IsTexturePixelFormatInteger(u32 raw_handle) override {
+        return false;
+    }
+
+    u32 ReadViewportTransformState() override {
+        ++viewport_reads;
+        return viewport_transform_state;
+    }
+
+    u32 TextureBoundBuffer() const override {
+        return 0;
+    }
+
+    u32 LocalMemorySize() const override {
+        return 0;
+    }
+
+    u32 SharedMemorySize() const override {
+        return 0;
+    }
+
+    std::array<u32, 3> WorkgroupSize() const override {
+        return {};
+    }
+
+    bool HasHLEMacroState() const override {
+        return false;
+    }
+
+    std::optional<ReplaceConstant> GetReplaceConstBuffer(u32 bank, u32 offset) override {
+        return std::nullopt;
+    }
+
+    void Dump(u64 pipeline_hash, u64 shader_hash) override {}
+
+    std::vector<u64> code;
+    u32 viewport_transform_state{1};
+    size_t instruction_reads{};
+    size_t viewport_reads{};
+};
+
+struct Pools {
+    ObjectPool<IR::Inst> inst{64};
+    ObjectPool<IR::Block> block{8};
+    ObjectPool<Flow::Block> flow_block{8};
+};
+
+/// Lists the instructions of every block, unlike DumpProgram this does not print addresses
+std::string Translate(TranslationCache& cache, Pools& pools, TestEnvironment& env) {
+    const HostTranslateInfo host_info{};
+    const IR::Program program{
+        cache.Translate(pools.inst, pools.block, pools.flow_block, env, 0, true, host_info, HASH)};
+    std::string result;
+    for (const IR::Block* const block : program.blocks) {
+        for (const IR::Inst& inst : *block) {
+            result += fmt::format("{}({}) ", IR::NameOf(inst.GetOpcode()), inst.UseCount());
+        }
+        result += '\n';
+    }
+    return result;
+}
+} // Anonymous namespace
+
+TEST_CASE("TranslationCache::Reuse", "[shader]") {
+    TranslationCache cache;
+    Pools pools;
+    TestEnvironment first{{SCHED, NOP, NOP, EXIT}};
+    const std::string translated{Translate(cache, pools, first)};
+    REQUIRE(first.instruction_reads > 2);
+
+    // A new pipeline with the same stage gets a copy, checking only the recorded state
+    TestEnvironment second{{SCHED, NOP, NOP, EXIT}};
+    REQUIRE(Translate(cache, pools, second) == translated);
+    REQUIRE(second.instruction_reads == 2);
+    REQUIRE(second.viewport_reads == 1);
+
+    // The copy does not share instructions with the cache, it outlives releasing the pools
+    pools.inst.ReleaseContents();
+    pools.block.ReleaseContents();
+    TestEnvironment third{{SCHED, NOP, NOP, EXIT}};
+    REQUIRE(Translate(cache, pools, third) == translated);
+    REQUIRE(third.instruction_reads == 2);
+}
+
+TEST_CASE("TranslationCache::QueryMismatch", "[shader]") {
+    TranslationCache cache;
+    Pools pools;
+    TestEnvironment first{{SCHED, NOP, NOP, EXIT}};
+    static_cast<void>(Translate(cache, pools, first));
+
+    // The position pass depends on the viewport transform, which the hash does not cover
+    TestEnvironment second{{SCHED, NOP, NOP, EXIT}};
+    second.viewport_transform_state = 0;
+    const std::string retranslated{Translate(cache, pools, second)};
+    REQUIRE(second.instruction_reads > 2);
+
+    // The new translation replaced the old one
+    TestEnvironment third{{SCHED, NOP, NOP, EXIT}};
+    third.viewport_transform_state = 0;
+    REQUIRE(Translate(cache, pools, third) == retranslated);
+    REQUIRE(third.instruction_reads == 2);
+}
+
+TEST_CASE("TranslationCache::CodeMismatch", "[shader]") {
+    TranslationCache cache;
+    Pools pools;
+    TestEnvironment first{{SCHED, NOP, NOP, EXIT}};
+    static_cast<void>(Translate(cache, pools, first));
+
+    // A hash collision with different code is caught by the extreme instruction reads
+    TestEnvironment second{{SCHED, NOP, NOP, EXIT ^ (1ULL << 40)}};
+    static_cast<void>(Translate(cache, pools, second));
+    REQUIRE(second.instruction_reads > 2);
+}
+
+} // namespace Shader::Maxwell
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/engines/sw_blitter/converter.h"
+
+namespace Tegra::Engines::Blitter {
+
+namespace {
+// Also covers counts that leave pixels to the byte loop after the vectors
+constexpr std::array<size_t, 6> TestPixelCounts{0, 1, 3, 4, 37, 1024};
+
+std::vector<u8> RandomPixels(size_t size) {
+    std::mt19937 rng{1234};
+    std::vector<u8> pixels(size);
+    for (auto& byte : pixels) {
+        byte = static_cast<u8>(rng());
+    }
+    return pixels;
+}
+
+/// Converts through floats, the path blits took before byte shuffles
+std::vector<u8> ConvertIR(ConverterFactory& factory, RenderTargetFormat src_format,
+                          RenderTargetFormat dst_format, const std::vector<u8>& input,
+                          size_t num_pixels) {
+    std::vector<f32> intermediate(num_pixels * 4);
+    std::vector<u8> output(input.size());
+    factory.GetFormatConverter(src_format)->ConvertTo(input, intermediate);
+    factory.GetFormatConverter(dst_format)->ConvertFrom(intermediate, output);
+    return output;
+}
+
+/// Checks the shuffle gives the result of the float conversion, separately and in place
+void CheckMatchesIR(RenderTargetFormat src_format, RenderTargetFormat dst_format,
+                    size_t bytes_per_pixel) {
+    ConverterFactory factory;
+    const ByteShuffle* const shuffle = factory.GetByteShuffle(src_format, dst_format);
+    REQUIRE(shuffle != nullptr);
+    for (const size_t num_pixels : TestPixelCounts) {
+        const std::vector<u8> input = RandomPixels(num_pixels * bytes_per_pixel);
+        const std::vector<u8> expected =
+            ConvertIR(factory, src_format, dst_format, input, num_pixels);
+
+        std::vector<u8> output(input.size());
+        shuffle->Shuffle(input, output);
+        REQUIRE(output == expected);
+
+        std::vector<u8> in_place = input;
+        shuffle->Shuffle(in_place, in_place);
+        REQUIRE(in_place == expected);
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("ByteShuffle::MatchIR", "[video_core]") {
+    CheckMatchesIR(RenderTargetFormat::A8B8G8R8_UNORM, RenderTargetFormat::A8R8G8B8_UNORM, 4);
+    CheckMatchesIR(RenderTargetFormat::A8R8G8B8_UNORM, RenderTargetFormat::A8B8G8R8_UNORM, 4);
+
+    // The unused byte of the destination is cleared like the float conversion does
+    CheckMatchesIR(RenderTargetFormat::A8B8G8R8_UNORM, RenderTargetFormat::X8R8G8B8_UNORM, 4);
+    CheckMatchesIR(RenderTargetFormat::X8B8G8R8_UNORM, RenderTargetFormat::X8R8G8B8_UNORM, 4);
+}
+
+TEST_CASE("ByteShuffle::Exact", "[video_core]") {
+    ConverterFactory factory;
+    const ByteShuffle* const shuffle = factory.GetByteShuffle(RenderTargetFormat::A8R8G8B8_SRGB,
+                                                              RenderTargetFormat::A8B8G8R8_SRGB);
+    REQUIRE(shuffle != nullptr);
+
+    // Colors keep every bit instead of going through linear floats, and going back restores them
+    const ByteShuffle* const back = factory.GetByteShuffle(RenderTargetFormat::A8B8G8R8_SRGB,
+                                                           RenderTargetFormat::A8R8G8B8_SRGB);
+    REQUIRE(back != nullptr);
+    for (const size_t num_pixels : TestPixelCounts) {
+        const std::vector<u8> input = RandomPixels(num_pixels * 4);
+        std::vector<u8> output(input.size());
+        shuffle->Shuffle(input, output);
+        for (size_t pixel = 0; pixel < num_pixels; pixel++) {
+            REQUIRE(output[pixel * 4 + 0] == input[pixel * 4 + 0]);
+            REQUIRE(output[pixel * 4 + 1] == input[pixel * 4 + 3]);
+            REQUIRE(output[pixel * 4 + 2] == input[pixel * 4 + 2]);
+            REQUIRE(output[pixel * 4 + 3] == input[pixel * 4 + 1]);
+        }
+        back->Shuffle(output, output);
+        REQUIRE(output == input);
+    }
+}
+
+TEST_CASE("ByteShuffle::WidePixels", "[video_core]") {
+    ConverterFactory factory;
+    const ByteShuffle* const shuffle = factory.GetByteShuffle(
+        RenderTargetFormat::R32G32B32A32_FLOAT, RenderTargetFormat::R32G32B32X32_FLOAT);
+    REQUIRE(shuffle != nullptr);
+
+    // Pixels as wide as a vector keep their color and clear the unused component
+    for (const size_t num_pixels : TestPixelCounts) {
+        const std::vector<u8> input = RandomPixels(num_pixels * 16);
+        std::vector<u8> output(input.size());
+        shuffle->Shuffle(input, output);
+        for (size_t byte = 0; byte < input.size(); byte++) {
+            REQUIRE(output[byte] == (byte % 16 < 12 ? input[byte] : 0));
+        }
+    }
+}
+
+TEST_CASE("ByteShuffle::Unsupported", "[video_core]") {
+    ConverterFactory factory;
+
+    // Different component types, sizes or components not made of whole bytes need floats
+    REQUIRE(factory.GetByteShuffle(RenderTargetFormat::A8B8G8R8_UNORM,
+                                   RenderTargetFormat::A8B8G8R8_SRGB) == nullptr);
+    REQUIRE(factory.GetByteShuffle(RenderTargetFormat::A8B8G8R8_UNORM,
+                                   RenderTargetFormat::R16G16B16A16_UNORM) == nullptr);
+    REQUIRE(factory.GetByteShuffle(RenderTargetFormat::R5G6B5_UNORM,
+                                   RenderTargetFormat::R5G6B5_UNORM) == nullptr);
+
+    // A destination component missing from the source can not be moved from it
+    REQUIRE(factory.GetByteShuffle(RenderTargetFormat::X8R8G8B8_UNORM,
+                                   RenderTargetFormat::A8R8G8B8_UNORM) == nullptr);
+
+    // Shuffles are built once per pair of formats
+    const ByteShuffle* const shuffle = factory.GetByteShuffle(
+        RenderTargetFormat::A8B8G8R8_UNORM, RenderTargetFormat::A8R8G8B8_UNORM);
+    REQUIRE(shuffle != nullptr);
+    REQUIRE(factory.GetByteShuffle(RenderTargetFormat::A8B8G8R8_UNORM,
+                                   RenderTargetFormat::A8R8G8B8_UNORM) == shuffle);
+}
+
+} // namespace Tegra::Engines::Blitter
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "video_core/cdma_pusher.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/host1x/syncpoint_manager.h"
+
+namespace Tegra {
+
+namespace {
+constexpr u32 SyncpointId = 3;
+constexpr u32 Submissions = 64;
+
+ChCommandHeader MakeHeader(ChSubmissionMode mode, u32 method_offset, u32 value) {
+    ChCommandHeader header{};
+    header.raw = (static_cast<u32>(mode) << 28) | (method_offset << 16) | value;
+    return header;
+}
+
+/// Selects NVDEC and increments the syncpoint once the command before it has run
+ChCommandHeaderList MakeIncrement() {
+    return {
+        MakeHeader(ChSubmissionMode::SetClass, 0, static_cast<u32>(ChClassId::NvDec) << 6),
+        MakeHeader(ChSubmissionMode::Immediate, static_cast<u32>(ThiMethod::IncSyncpt),
+                   SyncpointId),
+    };
+}
+
+/// Host1x of a system that is only initialized far enough to provide device memory
+struct TestHost1x {
+    TestHost1x() : use_multi_core{Settings::values.use_multi_core.GetValue()} {
+        // Single core mode does not start the timer thread, which needs a running kernel
+        Settings::values.use_multi_core.SetValue(false);
+        system.Initialize();
+        host1x = std::make_unique<Host1x::Host1x>(system);
+    }
+
+    ~TestHost1x() {
+        host1x.reset();
+        Settings::values.use_multi_core.SetValue(use_multi_core);
+    }
+
+    Host1x::SyncpointManager& Syncpoints() {
+        return host1x->GetSyncpointManager();
+    }
+
+    bool use_multi_core;
+    Core::System system;
+    std::unique_ptr<Host1x::Host1x> host1x;
+};
+} // Anonymous namespace
+
+TEST_CASE("CDmaPusher::PushEntries", "[video_core]") {
+    TestHost1x test;
+    CDmaPusher pusher{*test.host1x};
+
+    // Submissions return before they are processed, and increment the syncpoint in order
+    for (u32 i = 0; i < Submissions; i++) {
+        pusher.PushEntries(MakeIncrement());
+    }
+    test.Syncpoints().WaitHost(SyncpointId, Submissions);
+    REQUIRE(test.Syncpoints().GetHostSyncpointValue(SyncpointId) == Submissions);
+    REQUIRE(test.Syncpoints().GetGuestSyncpointValue(SyncpointId) == Submissions);
+}
+
+TEST_CASE("CDmaPusher::DrainOnDestruction", "[video_core]") {
+    TestHost1x test;
+    {
+        CDmaPusher pusher{*test.host1x};
+        for (u32 i = 0; i < Submissions; i++) {
+            pusher.PushEntries(MakeIncrement());
+        }
+    }
+
+    // The guest may wait on the fences of every submission, none of them can be dropped
+    REQUIRE(test.Syncpoints().GetHostSyncpointValue(SyncpointId) == Submissions);
+    REQUIRE(test.Syncpoints().GetGuestSyncpointValue(SyncpointId) == Submissions);
+}
+
+} // namespace Tegra
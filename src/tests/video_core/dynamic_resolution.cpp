@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/settings.h"
+#include "video_core/texture_cache/dynamic_resolution.h"
+
+namespace VideoCommon {
+
+namespace {
+constexpr u64 MS = 1'000'000;
+
+/// Enables dynamic resolution at 2x scale with a 60 fps target for the lifetime of the object
+struct ScopedSettings {
+    explicit ScopedSettings(bool dynamic_resolution = true)
+        : old_dynamic_resolution{Settings::values.dynamic_resolution.GetValue()},
+          old_fps{Settings::values.dynamic_resolution_fps.GetValue()},
+          old_setup{Settings::values.resolution_setup.GetValue()} {
+        Settings::values.dynamic_resolution.SetValue(dynamic_resolution);
+        Settings::values.dynamic_resolution_fps.SetValue(60);
+        Settings::values.resolution_setup.SetValue(Settings::ResolutionSetup::Res2X);
+        Settings::UpdateRescalingInfo();
+    }
+
+    ~ScopedSettings() {
+        Settings::values.dynamic_resolution.SetValue(old_dynamic_resolution);
+        Settings::values.dynamic_resolution_fps.SetValue(old_fps);
+        Settings::values.resolution_setup.SetValue(old_setup);
+        Settings::UpdateRescalingInfo();
+    }
+
+    bool old_dynamic_resolution;
+    u16 old_fps;
+    Settings::ResolutionSetup old_setup;
+};
+
+void AddFrames(DynamicResolution& dynamic_resolution, u32 count, u64 gpu_ns) {
+    for (u32 i = 0; i < count; i++) {
+        dynamic_resolution.AddFrame(gpu_ns);
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("DynamicResolution::Disabled", "[video_core]") {
+    ScopedSettings settings{false};
+    DynamicResolution dynamic_resolution;
+    REQUIRE(!dynamic_resolution.IsEnabled());
+
+    AddFrames(dynamic_resolution, 1000, 100 * MS);
+    REQUIRE(!dynamic_resolution.IsNative());
+}
+
+TEST_CASE("DynamicResolution::DropToNative", "[video_core]") {
+    ScopedSettings settings;
+    DynamicResolution dynamic_resolution;
+    REQUIRE(dynamic_resolution.IsEnabled());
+
+    // Frames within the target keep the configured scale
+    AddFrames(dynamic_resolution, 600, 15 * MS);
+    REQUIRE(!dynamic_resolution.IsNative());
+
+    // A single slow window changes nothing until the minimum number of frames is reached
+    DynamicResolution slow;
+    AddFrames(slow, 119, 20 * MS);
+    REQUIRE(!slow.IsNative());
+    AddFrames(slow, 1, 20 * MS);
+    REQUIRE(slow.IsNative());
+}
+
+TEST_CASE("DynamicResolution::ScaleUp", "[video_core]") {
+    ScopedSettings settings;
+    DynamicResolution dynamic_resolution;
+    AddFrames(dynamic_resolution, 120, 20 * MS);
+    REQUIRE(dynamic_resolution.IsNative());
+
+    // Native frames taking half as long measure a scale cost of 2, the configured scale would
+    // take 20 ms again and stays off instead of oscillating
+    AddFrames(dynamic_resolution, 1200, 10 * MS);
+    REQUIRE(dynamic_resolution.IsNative());
+
+    // At 6 ms the estimated 12 ms leave enough headroom to go back after a full window
+    AddFrames(dynamic_resolution, 29, 6 * MS);
+    REQUIRE(dynamic_resolution.IsNative());
+    AddFrames(dynamic_resolution, 1, 6 * MS);
+    REQUIRE(!dynamic_resolution.IsNative());
+}
+
+} // namespace VideoCommon
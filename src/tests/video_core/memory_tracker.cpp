@@ -4,7 +4,9 @@
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/alignment.h"
@@ -546,3 +548,51 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Sparse words in large region", "[video_core]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, WORD * 64);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 64));
+    memory_track->MarkRegionAsCpuModified(c + WORD * 5 + PAGE * 63, PAGE * 2);
+    memory_track->MarkRegionAsCpuModified(c + WORD * 37 + PAGE * 3, PAGE);
+    REQUIRE(memory_track->IsRegionCpuModified(c, WORD * 6));
+    REQUIRE(!memory_track->IsRegionCpuModified(c + WORD * 7, WORD * 30));
+    REQUIRE(memory_track->ModifiedCpuRegion(c, WORD * 64) ==
+            Range{c + WORD * 5 + PAGE * 63, c + WORD * 37 + PAGE * 4});
+    std::vector<Range> ranges;
+    memory_track->ForEachUploadRange(c, WORD * 64, [&](u64 offset, u64 size) {
+        ranges.emplace_back(offset, offset + size);
+    });
+    REQUIRE(ranges == std::vector<Range>{{c + WORD * 5 + PAGE * 63, c + WORD * 6 + PAGE},
+                                         {c + WORD * 37 + PAGE * 3, c + WORD * 37 + PAGE * 4}});
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 64));
+
+    memory_track->MarkRegionAsGpuModified(c + WORD * 50, PAGE);
+    REQUIRE(!memory_track->IsRegionGpuModified(c, WORD * 50));
+    REQUIRE(memory_track->IsRegionGpuModified(c, WORD * 64));
+    REQUIRE(memory_track->ModifiedGpuRegion(c, WORD * 64) ==
+            Range{c + WORD * 50, c + WORD * 50 + PAGE});
+}
+
+TEST_CASE("MemoryTracker: Benchmark", "[.benchmark]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    constexpr u64 size = HIGH_PAGE_SIZE * 64;
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    memory_track->MarkRegionAsGpuModified(c + size - PAGE, PAGE);
+    BENCHMARK("Clean region CPU query") {
+        return memory_track->IsRegionCpuModified(c, size);
+    };
+    BENCHMARK("Clean region GPU query") {
+        return memory_track->IsRegionGpuModified(c, size - PAGE);
+    };
+    BENCHMARK("Modified GPU region") {
+        return memory_track->ModifiedGpuRegion(c, size);
+    };
+    BENCHMARK("Clean region download ranges") {
+        int num = 0;
+        memory_track->ForEachDownloadRange(c, size - PAGE, false, [&](u64, u64) { ++num; });
+        return num;
+    };
+}
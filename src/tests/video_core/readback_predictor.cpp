@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/readback_predictor.h"
+
+namespace VideoCommon {
+
+namespace {
+constexpr GPUVAddr ADDR = 0x10000000;
+constexpr size_t SIZE = 0x384000;
+} // Anonymous namespace
+
+TEST_CASE("ReadbackPredictor::Predict", "[video_core]") {
+    ReadbackPredictor predictor;
+    REQUIRE(!predictor.IsPredicted(ADDR, SIZE));
+
+    predictor.RecordReadback(ADDR, SIZE, 0);
+    REQUIRE(predictor.IsPredicted(ADDR, SIZE));
+
+    // Images of another size or at another address are something else
+    REQUIRE(!predictor.IsPredicted(ADDR, SIZE / 2));
+    REQUIRE(!predictor.IsPredicted(ADDR + SIZE, SIZE));
+
+    // The last read back decides the size of the region
+    predictor.RecordReadback(ADDR, SIZE / 2, 1);
+    REQUIRE(!predictor.IsPredicted(ADDR, SIZE));
+    REQUIRE(predictor.IsPredicted(ADDR, SIZE / 2));
+}
+
+TEST_CASE("ReadbackPredictor::Forget", "[video_core]") {
+    ReadbackPredictor predictor;
+    predictor.RecordReadback(ADDR, SIZE, 100);
+    predictor.RecordReadback(ADDR + SIZE, SIZE, 1000);
+
+    predictor.Tick(1900);
+    REQUIRE(predictor.IsPredicted(ADDR, SIZE));
+
+    // Regions are forgotten once they have not been read back for 1800 frames
+    predictor.Tick(1901);
+    REQUIRE(!predictor.IsPredicted(ADDR, SIZE));
+    REQUIRE(predictor.IsPredicted(ADDR + SIZE, SIZE));
+
+    // Reading a region back again keeps it for another 1800 frames
+    predictor.RecordReadback(ADDR + SIZE, SIZE, 2000);
+    predictor.Tick(3000);
+    REQUIRE(predictor.IsPredicted(ADDR + SIZE, SIZE));
+}
+
+TEST_CASE("ReadbackPredictor::Capacity", "[video_core]") {
+    ReadbackPredictor predictor;
+    for (u64 i = 0; i < 256; i++) {
+        predictor.RecordReadback(ADDR + i * SIZE, SIZE, 256 - i);
+    }
+
+    // Recording a known region keeps every region
+    predictor.RecordReadback(ADDR, SIZE, 300);
+    for (u64 i = 0; i < 256; i++) {
+        REQUIRE(predictor.IsPredicted(ADDR + i * SIZE, SIZE));
+    }
+
+    // A new region beyond the limit replaces the one read back the longest time ago
+    predictor.RecordReadback(ADDR + 256 * SIZE, SIZE, 301);
+    REQUIRE(predictor.IsPredicted(ADDR + 256 * SIZE, SIZE));
+    REQUIRE(!predictor.IsPredicted(ADDR + 255 * SIZE, SIZE));
+    for (u64 i = 0; i < 255; i++) {
+        REQUIRE(predictor.IsPredicted(ADDR + i * SIZE, SIZE));
+    }
+}
+
+} // namespace VideoCommon
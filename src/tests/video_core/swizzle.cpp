@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using Tegra::Texture::CalculateSize;
+using Tegra::Texture::GetGOBOffset;
+using Tegra::Texture::GOB_SIZE_X;
+using Tegra::Texture::GOB_SIZE_Y;
+using Tegra::Texture::MakeSwizzleTable;
+using Tegra::Texture::SwizzleSubrect;
+using Tegra::Texture::SwizzleTexture;
+using Tegra::Texture::UnswizzleTexture;
+
+constexpr auto SWIZZLE_TABLE = MakeSwizzleTable();
+
+struct Image2D {
+    u32 bytes_per_pixel;
+    u32 width;
+    u32 height;
+    u32 block_height;
+};
+
+std::vector<u8> MakeLinear(const Image2D& image) {
+    std::vector<u8> linear(image.width * image.height * image.bytes_per_pixel);
+    for (size_t i = 0; i < linear.size(); ++i) {
+        linear[i] = static_cast<u8>(i * 7 + i / 251);
+    }
+    return linear;
+}
+
+size_t SwizzledSize(const Image2D& image) {
+    return CalculateSize(true, image.bytes_per_pixel, image.width, image.height, 1,
+                         image.block_height, 0);
+}
+
+void CheckAgainstReference(const Image2D& image) {
+    const std::vector<u8> linear = MakeLinear(image);
+    std::vector<u8> swizzled(SwizzledSize(image));
+    SwizzleTexture(swizzled, linear, image.bytes_per_pixel, image.width, image.height, 1,
+                   image.block_height, 0, 0);
+
+    const u32 pitch = image.width * image.bytes_per_pixel;
+    for (u32 y = 0; y < image.height; ++y) {
+        for (u32 x = 0; x < pitch; ++x) {
+            const u64 gob_offset = GetGOBOffset(image.width, image.height, x / image.bytes_per_pixel,
+                                                y, image.block_height, image.bytes_per_pixel);
+            const u64 offset = gob_offset + SWIZZLE_TABLE[y % GOB_SIZE_Y][x % GOB_SIZE_X];
+            REQUIRE(swizzled[offset] == linear[y * pitch + x]);
+        }
+    }
+
+    std::vector<u8> unswizzled(linear.size());
+    UnswizzleTexture(unswizzled, swizzled, image.bytes_per_pixel, image.width, image.height, 1,
+                     image.block_height, 0, 0);
+    REQUIRE(unswizzled == linear);
+}
+} // Anonymous namespace
+
+TEST_CASE("Swizzle: Whole GOB rows", "[video_core]") {
+    CheckAgainstReference({.bytes_per_pixel = 4, .width = 256, .height = 64, .block_height = 2});
+    CheckAgainstReference({.bytes_per_pixel = 8, .width = 64, .height = 40, .block_height = 1});
+    CheckAgainstReference({.bytes_per_pixel = 16, .width = 48, .height = 16, .block_height = 0});
+}
+
+TEST_CASE("Swizzle: Partial GOB rows", "[video_core]") {
+    CheckAgainstReference({.bytes_per_pixel = 4, .width = 100, .height = 24, .block_height = 1});
+    CheckAgainstReference({.bytes_per_pixel = 2, .width = 33, .height = 17, .block_height = 0});
+    CheckAgainstReference({.bytes_per_pixel = 1, .width = 77, .height = 9, .block_height = 3});
+}
+
+TEST_CASE("Swizzle: Whole surface subrect", "[video_core]") {
+    // VIC swizzles whole frames with SwizzleTexture, which must match a full surface subrect
+    for (const Image2D& image : {
+             Image2D{.bytes_per_pixel = 4, .width = 1920, .height = 1080, .block_height = 4},
+             Image2D{.bytes_per_pixel = 4, .width = 100, .height = 37, .block_height = 1},
+             Image2D{.bytes_per_pixel = 4, .width = 33, .height = 9, .block_height = 0},
+         }) {
+        const std::vector<u8> linear = MakeLinear(image);
+        std::vector<u8> subrect(SwizzledSize(image));
+        std::vector<u8> texture(SwizzledSize(image));
+        SwizzleSubrect(subrect, linear, image.bytes_per_pixel, image.width, image.height, 1, 0, 0,
+                       image.width, image.height, image.block_height, 0,
+                       image.width * image.bytes_per_pixel);
+        SwizzleTexture(texture, linear, image.bytes_per_pixel, image.width, image.height, 1,
+                       image.block_height, 0, 0);
+        REQUIRE(subrect == texture);
+    }
+}
+
+TEST_CASE("Swizzle: Benchmark", "[.benchmark]") {
+    for (const u32 bytes_per_pixel : {4U, 8U, 16U}) {
+        const Image2D image{
+            .bytes_per_pixel = bytes_per_pixel,
+            .width = 4096 / bytes_per_pixel,
+            .height = 512,
+            .block_height = 4,
+        };
+        const std::vector<u8> linear = MakeLinear(image);
+        std::vector<u8> swizzled(SwizzledSize(image));
+        std::vector<u8> unswizzled(linear.size());
+
+        BENCHMARK("Swizzle " + std::to_string(bytes_per_pixel) + " bytes per pixel") {
+            SwizzleTexture(swizzled, linear, image.bytes_per_pixel, image.width, image.height, 1,
+                           image.block_height, 0, 0);
+            return swizzled[0];
+        };
+        BENCHMARK("Unswizzle " + std::to_string(bytes_per_pixel) + " bytes per pixel") {
+            UnswizzleTexture(unswizzled, swizzled, image.bytes_per_pixel, image.width,
+                             image.height, 1, image.block_height, 0, 0);
+            return unswizzled[0];
+        };
+    }
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/buffer_cache/upload_fingerprints.h"
+
+namespace VideoCommon {
+
+namespace {
+constexpr DAddr ADDR = 0x10000;
+constexpr size_t PAGE = 4096;
+
+std::vector<u8> Pages(size_t count, u8 value) {
+    return std::vector<u8>(count * PAGE, value);
+}
+
+/// Checks a range and uploads it when it changed, returns whether it was uploaded
+bool Upload(UploadFingerprints& fingerprints, u64& contents_version, DAddr device_addr,
+            std::span<const u8> contents) {
+    if (fingerprints.IsUnchanged(device_addr, contents, contents_version)) {
+        fingerprints.Commit(contents_version);
+        return false;
+    }
+    fingerprints.Commit(++contents_version);
+    return true;
+}
+} // Anonymous namespace
+
+TEST_CASE("UploadFingerprints::Unchanged", "[video_core]") {
+    UploadFingerprints fingerprints;
+    u64 contents_version = 1;
+    const std::vector<u8> a = Pages(3, 0xAA);
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, a));
+    REQUIRE(!Upload(fingerprints, contents_version, ADDR, a));
+
+    // Other contents or another size of the range are uploaded
+    const std::vector<u8> b = Pages(3, 0xBB);
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, b));
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, std::span(b).first(PAGE)));
+}
+
+TEST_CASE("UploadFingerprints::OverlappingUpload", "[video_core]") {
+    UploadFingerprints fingerprints;
+    u64 contents_version = 1;
+    const std::vector<u8> a = Pages(3, 0xAA);
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, a));
+
+    // Uploading the middle page changes the buffer under the fingerprint of the whole range
+    const std::vector<u8> c = Pages(1, 0xCC);
+    REQUIRE(Upload(fingerprints, contents_version, ADDR + PAGE, c));
+
+    // Rewriting the whole range with its first contents has to upload the middle page again
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, a));
+}
+
+TEST_CASE("UploadFingerprints::OtherChanges", "[video_core]") {
+    UploadFingerprints fingerprints;
+    u64 contents_version = 1;
+    const std::vector<u8> a = Pages(1, 0xAA);
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, a));
+
+    // A GPU write, clear or copy gives the buffer a new version
+    ++contents_version;
+    REQUIRE(Upload(fingerprints, contents_version, ADDR, a));
+}
+
+TEST_CASE("UploadFingerprints::CheckedTogether", "[video_core]") {
+    UploadFingerprints fingerprints;
+    u64 contents_version = 1;
+    const std::vector<u8> a = Pages(1, 0xAA);
+    const std::vector<u8> b = Pages(1, 0xBB);
+    const DAddr b_addr = ADDR + 2 * PAGE;
+    REQUIRE(!fingerprints.IsUnchanged(ADDR, a, contents_version));
+    REQUIRE(!fingerprints.IsUnchanged(b_addr, b, contents_version));
+    fingerprints.Commit(++contents_version);
+
+    // Ranges skipped next to an uploaded range stay valid, the upload did not touch them
+    const std::vector<u8> d = Pages(1, 0xDD);
+    REQUIRE(fingerprints.IsUnchanged(ADDR, a, contents_version));
+    REQUIRE(!fingerprints.IsUnchanged(b_addr, d, contents_version));
+    fingerprints.Commit(++contents_version);
+    REQUIRE(!Upload(fingerprints, contents_version, ADDR, a));
+}
+
+} // namespace VideoCommon
@@ -73,6 +73,33 @@ public:
         return stream_score;
     }
 
+    /// Records a CPU to GPU upload into the buffer at the given frame
+    void AddCpuUploadHeat(u64 frame_tick) noexcept {
+        DecayHeat(frame_tick);
+        cpu_upload_heat = std::min(cpu_upload_heat + 1, MAX_HEAT);
+    }
+
+    /// Records a GPU write into the buffer at the given frame
+    void AddGpuWriteHeat(u64 frame_tick) noexcept {
+        DecayHeat(frame_tick);
+        gpu_write_heat = std::min(gpu_write_heat + 1, MAX_HEAT);
+    }
+
+    /// Accumulates the access heat of a buffer being joined into this one
+    void InheritHeat(BufferBase& other, u64 frame_tick) noexcept {
+        DecayHeat(frame_tick);
+        other.DecayHeat(frame_tick);
+        cpu_upload_heat = std::min(cpu_upload_heat + other.cpu_upload_heat, MAX_HEAT);
+        gpu_write_heat = std::min(gpu_write_heat + other.gpu_write_heat, MAX_HEAT);
+    }
+
+    /// Returns true when the buffer is frequently uploaded from the CPU and rarely written by
+    /// the GPU, making it behave like a stream buffer
+    [[nodiscard]] bool IsCpuHot(u64 frame_tick) noexcept {
+        DecayHeat(frame_tick);
+        return cpu_upload_heat >= CPU_HOT_THRESHOLD && gpu_write_heat < GPU_WARM_THRESHOLD;
+    }
+
     /// Returns true when vaddr -> vaddr+size is fully contained in the buffer
     [[nodiscard]] bool IsInBounds(VAddr addr, u64 size) const noexcept {
         return addr >= cpu_addr && addr + size <= cpu_addr + SizeBytes();
@@ -115,10 +142,41 @@ public:
         return size_bytes;
     }
 
+    /// Records a change of the buffer contents, invalidating host data derived from them
+    void MarkContentsModified(u64 version) noexcept {
+        contents_version = version;
+    }
+
+    /// Returns the version of the buffer contents, unique among the buffers of a cache
+    [[nodiscard]] u64 ContentsVersion() const noexcept {
+        return contents_version;
+    }
+
 private:
+    static constexpr u32 MAX_HEAT = 1U << 16;
+    static constexpr u32 CPU_HOT_THRESHOLD = 8;
+    static constexpr u32 GPU_WARM_THRESHOLD = 2;
+
+    /// Halves the access heat once for every frame elapsed since the last update
+    void DecayHeat(u64 frame_tick) noexcept {
+        const u64 elapsed = frame_tick - heat_tick;
+        heat_tick = frame_tick;
+        if (elapsed >= 32) {
+            cpu_upload_heat = 0;
+            gpu_write_heat = 0;
+            return;
+        }
+        cpu_upload_heat >>= elapsed;
+        gpu_write_heat >>= elapsed;
+    }
+
     VAddr cpu_addr = 0;
     BufferFlagBits flags{};
     int stream_score = 0;
+    u32 cpu_upload_heat = 0;
+    u32 gpu_write_heat = 0;
+    u64 heat_tick = 0;
+    u64 contents_version = 0;
     size_t lru_id = SIZE_MAX;
     size_t size_bytes = 0;
 };
@@ -7,6 +7,7 @@
 #include <memory>
 #include <numeric>
 
+#include "common/fast_hash.h"
 #include "common/range_sets.inc"
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/guest_memory.h"
@@ -234,6 +235,7 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     src_buffer.MarkUsage(copy.src_offset, copy.size);
     dest_buffer.MarkUsage(copy.dst_offset, copy.size);
     runtime.CopyBuffer(dest_buffer, src_buffer, copies, true);
+    MarkContentsModified(dest_buffer);
     if (has_new_downloads) {
         memory_tracker.MarkRegionAsGpuModified(*cpu_dest_address, amount);
     }
@@ -264,6 +266,7 @@ bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const u32 offset = dest_buffer.Offset(*cpu_dst_address);
     runtime.ClearBuffer(dest_buffer, offset, size, value);
     dest_buffer.MarkUsage(offset, size);
+    MarkContentsModified(dest_buffer);
     return true;
 }
 
@@ -303,6 +306,7 @@ std::pair<typename P::Buffer*, u32> BufferCache<P>::ObtainCPUBuffer(
         const size_t new_size = device_addr_end - device_addr_start;
         ClearDownload(device_addr_start, new_size);
         gpu_modified_ranges.Subtract(device_addr_start, new_size);
+        MarkContentsModified(buffer);
         break;
     }
     default:
@@ -321,6 +325,9 @@ void BufferCache<P>::BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr
         .size = size,
         .buffer_id = BufferId{},
     };
+    if (channel_state->uniform_buffers[stage][index].device_addr != binding.device_addr) {
+        channel_state->streamed_uniform_buffers[stage] &= ~(1U << index);
+    }
     channel_state->uniform_buffers[stage][index] = binding;
 }
 
@@ -687,6 +694,7 @@ void BufferCache<P>::BindHostIndexBuffer() {
     const u32 offset = buffer.Offset(channel_state->index_buffer.device_addr);
     const u32 size = channel_state->index_buffer.size;
     const auto& draw_state = maxwell3d->draw_manager->GetDrawState();
+    std::optional<HostImportRange> host_import;
     if (!draw_state.inline_index_draw_indexes.empty()) [[unlikely]] {
         if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
             auto upload_staging = runtime.UploadStagingBuffer(size);
@@ -698,31 +706,61 @@ void BufferCache<P>::BindHostIndexBuffer() {
         } else {
             buffer.ImmediateUpload(0, draw_state.inline_index_draw_indexes);
         }
+        MarkContentsModified(buffer);
     } else {
-        SynchronizeBuffer(buffer, channel_state->index_buffer.device_addr, size);
+        if constexpr (IMPLEMENTS_HOST_MEMORY_IMPORT) {
+            host_import = FindHostImport(channel_state->index_buffer.device_addr, size);
+        }
+        if (!host_import) {
+            SynchronizeBuffer(buffer, channel_state->index_buffer.device_addr, size, true);
+        }
     }
     if constexpr (HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT) {
         const u32 new_offset =
             offset + draw_state.index_buffer.first * draw_state.index_buffer.FormatSizeInBytes();
         runtime.BindIndexBuffer(buffer, new_offset, size);
     } else {
+        if constexpr (IMPLEMENTS_HOST_MEMORY_IMPORT) {
+            if (host_import) {
+                runtime.BindIndexBuffer(draw_state.topology, draw_state.index_buffer.format,
+                                        draw_state.index_buffer.first,
+                                        draw_state.index_buffer.count,
+                                        runtime.ImportHostMemory(host_import->chunk,
+                                                                 HOST_IMPORT_CHUNK_SIZE),
+                                        host_import->offset, size, 0);
+                return;
+            }
+        }
         buffer.MarkUsage(offset, size);
         runtime.BindIndexBuffer(draw_state.topology, draw_state.index_buffer.format,
                                 draw_state.index_buffer.first, draw_state.index_buffer.count,
-                                buffer, offset, size);
+                                buffer, offset, size, buffer.ContentsVersion());
     }
 }
 
 template <class P>
 void BufferCache<P>::BindHostVertexBuffers() {
     HostBindings<typename P::Buffer> host_bindings;
+    std::array<std::optional<HostImportRange>, NUM_VERTEX_BUFFERS> host_imports;
     bool any_valid{false};
     auto& flags = maxwell3d->dirty.flags;
     for (u32 index = 0; index < NUM_VERTEX_BUFFERS; ++index) {
         const Binding& binding = channel_state->vertex_buffers[index];
         Buffer& buffer = slot_buffers[binding.buffer_id];
         TouchBuffer(buffer, binding.buffer_id);
-        SynchronizeBuffer(buffer, binding.device_addr, binding.size);
+        if constexpr (IMPLEMENTS_HOST_MEMORY_IMPORT) {
+            // Rebind when the buffer switches between the cached copy and the imported memory
+            host_imports[index] = FindHostImport(binding.device_addr, binding.size);
+            const u32 mask = 1U << index;
+            const bool was_imported = (channel_state->host_imported_vertex_buffers & mask) != 0;
+            if (host_imports[index].has_value() != was_imported) {
+                channel_state->host_imported_vertex_buffers ^= mask;
+                flags[Dirty::VertexBuffer0 + index] = true;
+            }
+        }
+        if (!host_imports[index]) {
+            SynchronizeBuffer(buffer, binding.device_addr, binding.size, true);
+        }
         if (!flags[Dirty::VertexBuffer0 + index]) {
             continue;
         }
@@ -750,7 +788,21 @@ void BufferCache<P>::BindHostVertexBuffers() {
             host_bindings.sizes.push_back(binding.size);
             host_bindings.strides.push_back(stride);
         }
+        const u32 min_index = host_bindings.min_index;
+        const u32 max_index = host_bindings.max_index;
         runtime.BindVertexBuffers(host_bindings);
+        if constexpr (IMPLEMENTS_HOST_MEMORY_IMPORT) {
+            for (u32 index = min_index; index < max_index; ++index) {
+                const std::optional<HostImportRange>& host_import = host_imports[index];
+                if (!host_import) {
+                    continue;
+                }
+                const u32 stride = maxwell3d->regs.vertex_streams[index].stride;
+                runtime.BindVertexBuffer(
+                    index, runtime.ImportHostMemory(host_import->chunk, HOST_IMPORT_CHUNK_SIZE),
+                    host_import->offset, channel_state->vertex_buffers[index].size, stride);
+            }
+        }
     }
 }
 
@@ -791,9 +843,17 @@ void BufferCache<P>::BindHostGraphicsUniformBuffer(size_t stage, u32 index, u32
     const u32 size = std::min(binding.size, (*channel_state->uniform_buffer_sizes)[stage][index]);
     Buffer& buffer = slot_buffers[binding.buffer_id];
     TouchBuffer(buffer, binding.buffer_id);
-    const bool use_fast_buffer = binding.buffer_id != NULL_BUFFER_ID &&
-                                 size <= channel_state->uniform_buffer_skip_cache_size &&
-                                 !memory_tracker.IsRegionGpuModified(device_addr, size);
+    // Stale cached copies would need an upload and a copy command anyway, so stream them once.
+    // Streaming leaves the cached copy stale, the next draw synchronizes it so later draws bind
+    // the clean copy. OpenGL fast uniform buffers are only allocated with the default skip size.
+    const u32 index_mask = 1U << index;
+    const bool stream_stale = !IS_OPENGL && size <= MAX_STREAMED_UNIFORM_SIZE &&
+                              (channel_state->streamed_uniform_buffers[stage] & index_mask) == 0 &&
+                              memory_tracker.IsRegionCpuModified(device_addr, size);
+    const bool use_fast_buffer =
+        binding.buffer_id != NULL_BUFFER_ID &&
+        (size <= channel_state->uniform_buffer_skip_cache_size || stream_stale) &&
+        !memory_tracker.IsRegionGpuModified(device_addr, size);
     if (use_fast_buffer) {
         if constexpr (IS_OPENGL) {
             if (runtime.HasFastBufferSubData()) {
@@ -819,9 +879,13 @@ void BufferCache<P>::BindHostGraphicsUniformBuffer(size_t stage, u32 index, u32
         // Stream buffer path to avoid stalling on non-Nvidia drivers or Vulkan
         const std::span<u8> span = runtime.BindMappedUniformBuffer(stage, binding_index, size);
         device_memory.ReadBlockUnsafe(device_addr, span.data(), size);
+        if (size > channel_state->uniform_buffer_skip_cache_size) {
+            channel_state->streamed_uniform_buffers[stage] |= index_mask;
+        }
         return;
     }
     // Classic cached path
+    channel_state->streamed_uniform_buffers[stage] &= ~index_mask;
     const bool sync_cached = SynchronizeBuffer(buffer, device_addr, size);
     if (sync_cached) {
         ++channel_state->uniform_cache_hits[0];
@@ -1263,11 +1327,18 @@ void BufferCache<P>::UpdateComputeTextureBuffers() {
 
 template <class P>
 void BufferCache<P>::MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size) {
+    slot_buffers[buffer_id].AddGpuWriteHeat(frame_tick);
+    MarkContentsModified(slot_buffers[buffer_id]);
     memory_tracker.MarkRegionAsGpuModified(device_addr, size);
     gpu_modified_ranges.Add(device_addr, size);
     uncommitted_gpu_modified_ranges.Add(device_addr, size);
 }
 
+template <class P>
+void BufferCache<P>::MarkContentsModified(Buffer& buffer) noexcept {
+    buffer.MarkContentsModified(++contents_version);
+}
+
 template <class P>
 BufferId BufferCache<P>::FindBuffer(DAddr device_addr, u32 size) {
     if (device_addr == 0) {
@@ -1343,9 +1414,11 @@ typename BufferCache<P>::OverlapResult BufferCache<P>::ResolveOverlaps(DAddr dev
             end = overlap_end;
         }
         stream_score += overlap.StreamScore();
-        if (stream_score > STREAM_LEAP_THRESHOLD && !has_stream_leap) {
-            // When this memory region has been joined a bunch of times, we assume it's being used
-            // as a stream buffer. Increase the size to skip constantly recreating buffers.
+        const bool is_cpu_hot = overlap.IsCpuHot(frame_tick);
+        if ((stream_score > STREAM_LEAP_THRESHOLD || is_cpu_hot) && !has_stream_leap) {
+            // When this memory region has been joined a bunch of times, or it is constantly
+            // uploaded from the CPU, we assume it's being used as a stream buffer. Increase the
+            // size to skip constantly recreating buffers.
             has_stream_leap = true;
             if (expands_right) {
                 expand_begin(CACHING_PAGESIZE * 128);
@@ -1371,6 +1444,7 @@ void BufferCache<P>::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
     if (accumulate_stream_score) {
         new_buffer.IncreaseStreamScore(overlap.StreamScore() + 1);
     }
+    new_buffer.InheritHeat(overlap, frame_tick);
     boost::container::small_vector<BufferCopy, 10> copies;
     const size_t dst_base_offset = overlap.CpuAddr() - new_buffer.CpuAddr();
     copies.push_back(BufferCopy{
@@ -1395,6 +1469,7 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     const size_t size_bytes = new_buffer.SizeBytes();
     runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
     new_buffer.MarkUsage(0, size_bytes);
+    MarkContentsModified(new_buffer);
     for (const BufferId overlap_id : overlap.ids) {
         JoinOverlap(new_buffer_id, overlap_id, !overlap.has_stream_leap);
     }
@@ -1420,9 +1495,11 @@ void BufferCache<P>::ChangeRegister(BufferId buffer_id) {
     const auto size = buffer.SizeBytes();
     if (insert) {
         total_used_memory += Common::AlignUp(size, 1024);
+        memory_account.Add(Common::AlignUp(size, 1024));
         buffer.setLRUID(lru_cache.Insert(buffer_id, frame_tick));
     } else {
         total_used_memory -= Common::AlignUp(size, 1024);
+        memory_account.Remove(Common::AlignUp(size, 1024));
         lru_cache.Free(buffer.getLRUID());
     }
     const DAddr device_addr_begin = buffer.CpuAddr();
@@ -1446,12 +1523,22 @@ void BufferCache<P>::TouchBuffer(Buffer& buffer, BufferId buffer_id) noexcept {
 }
 
 template <class P>
-bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size) {
+bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size,
+                                       bool check_fingerprints) {
     boost::container::small_vector<BufferCopy, 4> copies;
     u64 total_size_bytes = 0;
     u64 largest_copy = 0;
     DAddr buffer_start = buffer.CpuAddr();
     memory_tracker.ForEachUploadRange(device_addr, size, [&](u64 device_addr_out, u64 range_size) {
+        if (check_fingerprints) {
+            const u8* const pointer = device_memory.GetSpan(device_addr_out, range_size);
+            if (pointer != nullptr &&
+                upload_fingerprints.IsUnchanged(device_addr_out,
+                                                std::span<const u8>(pointer, range_size),
+                                                buffer.ContentsVersion())) {
+                return;
+            }
+        }
         copies.push_back(BufferCopy{
             .src_offset = total_size_bytes,
             .dst_offset = device_addr_out - buffer_start,
@@ -1461,13 +1548,56 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
         largest_copy = std::max(largest_copy, range_size);
     });
     if (total_size_bytes == 0) {
+        if (check_fingerprints) {
+            upload_fingerprints.Commit(buffer.ContentsVersion());
+        }
         return true;
     }
+    buffer.AddCpuUploadHeat(frame_tick);
+    MarkContentsModified(buffer);
+    if (check_fingerprints) {
+        upload_fingerprints.Commit(buffer.ContentsVersion());
+    }
     const std::span<BufferCopy> copies_span(copies.data(), copies.size());
     UploadMemory(buffer, total_size_bytes, largest_copy, copies_span);
     return false;
 }
 
+template <class P>
+std::optional<HostImportRange> BufferCache<P>::FindHostImport([[maybe_unused]] DAddr device_addr,
+                                                              [[maybe_unused]] u32 size) {
+    if constexpr (IMPLEMENTS_HOST_MEMORY_IMPORT) {
+        if (size < MIN_HOST_IMPORT_SIZE || !runtime.CanImportHostMemory()) {
+            return std::nullopt;
+        }
+        // Only ranges the CPU modified since their last upload are read in place. Up to date
+        // ranges are better served from the cached buffer, and GPU written ranges are stale in
+        // guest memory.
+        if (!memory_tracker.IsRegionCpuModified(device_addr, size) ||
+            memory_tracker.IsRegionGpuModified(device_addr, size)) {
+            return std::nullopt;
+        }
+        u8* const pointer = device_memory.GetSpan(device_addr, size);
+        if (pointer == nullptr) {
+            return std::nullopt;
+        }
+        const u64 raw_addr = device_memory.GetPhysicalRawAddressFromDAddr(device_addr);
+        const u64 chunk_addr = Common::AlignDown(raw_addr, HOST_IMPORT_CHUNK_SIZE);
+        if (raw_addr + size > chunk_addr + HOST_IMPORT_CHUNK_SIZE) {
+            return std::nullopt;
+        }
+        u8* const chunk = pointer - (raw_addr - chunk_addr);
+        if (!runtime.ImportHostMemory(chunk, HOST_IMPORT_CHUNK_SIZE)) {
+            return std::nullopt;
+        }
+        return HostImportRange{
+            .chunk = chunk,
+            .offset = static_cast<u32>(raw_addr - chunk_addr),
+        };
+    }
+    return std::nullopt;
+}
+
 template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
@@ -1566,6 +1696,7 @@ void BufferCache<P>::InlineMemoryImplementation(DAddr dest_address, size_t copy_
     } else {
         buffer.ImmediateUpload(buffer.Offset(dest_address), inlined_buffer.first(copy_size));
     }
+    MarkContentsModified(buffer);
 }
 
 template <class P>
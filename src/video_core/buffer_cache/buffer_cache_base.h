@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -17,12 +18,14 @@
 #include "common/div_ceil.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include "common/microprofile.h"
 #include "common/range_sets.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "common/slot_vector.h"
 #include "video_core/buffer_cache/buffer_base.h"
+#include "video_core/buffer_cache/upload_fingerprints.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
 #include "video_core/dirty_flags.h"
@@ -74,6 +77,12 @@ enum class ObtainBufferOperation : u32 {
 
 static constexpr BufferId NULL_BUFFER_ID{0};
 static constexpr u32 DEFAULT_SKIP_CACHE_SIZE = static_cast<u32>(4_KiB);
+/// Uniform buffers up to this size are streamed instead of copied when their cached copy is stale
+static constexpr u32 MAX_STREAMED_UNIFORM_SIZE = static_cast<u32>(64_KiB);
+/// Granularity of guest memory imported into the host device for in place reads
+static constexpr u64 HOST_IMPORT_CHUNK_SIZE = 4_MiB;
+/// Vertex and index buffers smaller than this are always uploaded
+static constexpr u32 MIN_HOST_IMPORT_SIZE = static_cast<u32>(16_KiB);
 
 struct Binding {
     DAddr device_addr{};
@@ -85,6 +94,12 @@ struct TextureBufferBinding : Binding {
     PixelFormat format;
 };
 
+/// Range of guest memory read in place from an imported host memory chunk
+struct HostImportRange {
+    u8* chunk;
+    u32 offset;
+};
+
 static constexpr Binding NULL_BINDING{
     .device_addr = 0,
     .size = 0,
@@ -144,10 +159,13 @@ public:
 
     u32 uniform_buffer_skip_cache_size = DEFAULT_SKIP_CACHE_SIZE;
 
+    u32 host_imported_vertex_buffers = 0;
+
     bool has_deleted_buffers = false;
 
     std::array<u32, NUM_STAGES> dirty_uniform_buffers{};
     std::array<u32, NUM_STAGES> fast_bound_uniform_buffers{};
+    std::array<u32, NUM_STAGES> streamed_uniform_buffers{};
     std::array<std::array<u32, NUM_GRAPHICS_UNIFORM_BUFFERS>, NUM_STAGES>
         uniform_buffer_binding_sizes{};
 };
@@ -169,6 +187,7 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
     static constexpr bool USE_MEMORY_MAPS = P::USE_MEMORY_MAPS;
     static constexpr bool SEPARATE_IMAGE_BUFFERS_BINDINGS = P::SEPARATE_IMAGE_BUFFER_BINDINGS;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = P::USE_MEMORY_MAPS_FOR_UPLOADS;
+    static constexpr bool IMPLEMENTS_HOST_MEMORY_IMPORT = P::IMPLEMENTS_HOST_MEMORY_IMPORT;
 
     static constexpr s64 DEFAULT_EXPECTED_MEMORY = 512_MiB;
     static constexpr s64 DEFAULT_CRITICAL_MEMORY = 1_GiB;
@@ -395,6 +414,8 @@ private:
 
     void MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size);
 
+    void MarkContentsModified(Buffer& buffer) noexcept;
+
     [[nodiscard]] BufferId FindBuffer(DAddr device_addr, u32 size);
 
     [[nodiscard]] OverlapResult ResolveOverlaps(DAddr device_addr, u32 wanted_size);
@@ -412,7 +433,14 @@ private:
 
     void TouchBuffer(Buffer& buffer, BufferId buffer_id) noexcept;
 
-    bool SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size);
+    /// Uploads the CPU modified ranges of a buffer region, returns true when nothing was uploaded
+    /// @param check_fingerprints Skips the ranges rewritten with the contents last uploaded to them
+    bool SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size,
+                           bool check_fingerprints = false);
+
+    /// Returns the imported host memory range to read in place instead of synchronizing the
+    /// cached buffer, or nullopt when the range has to be uploaded
+    [[nodiscard]] std::optional<HostImportRange> FindHostImport(DAddr device_addr, u32 size);
 
     void UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                       std::span<BufferCopy> copies);
@@ -476,7 +504,10 @@ private:
     };
     Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
     u64 frame_tick = 0;
+    u64 contents_version = 0;
+    UploadFingerprints upload_fingerprints;
     u64 total_used_memory = 0;
+    Common::MemoryAccount memory_account{Common::MemoryCategory::BufferCache};
     u64 minimum_memory = 0;
     u64 critical_memory = 0;
     BufferId inline_buffer_id;
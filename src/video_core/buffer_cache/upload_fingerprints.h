@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/fast_hash.h"
+
+namespace VideoCommon {
+
+/**
+ * Hashes of the guest memory last uploaded to ranges of buffers, to skip uploading ranges the
+ * guest rewrote with the same contents. A fingerprint only matches while the buffer keeps the
+ * contents version it had after the upload, so any other change of the buffer, including uploads
+ * to overlapping ranges, invalidates it.
+ */
+class UploadFingerprints {
+    /// Fingerprints kept before forgetting all of them
+    static constexpr size_t MAX_FINGERPRINTS = 4096;
+    /// Consecutive misses after which a range checks its contents at the lowest rate
+    static constexpr u32 MAX_MISSES = 6;
+
+    struct Fingerprint {
+        u64 size{};
+        u64 hash{};
+        u64 contents_version{};
+        /// False when the range was uploaded without hashing its contents
+        bool is_valid{};
+        u32 misses{};
+        u32 checks_to_skip{};
+    };
+
+public:
+    /**
+     * Checks whether a CPU modified range holds the contents last uploaded to it.
+     * Ranges checked together must not overlap, and Commit must be called once they are uploaded.
+     *
+     * @param contents_version Contents version of the buffer before the ranges are uploaded
+     * @return True when the range does not have to be uploaded
+     */
+    [[nodiscard]] bool IsUnchanged(DAddr device_addr, std::span<const u8> contents,
+                                   u64 contents_version) {
+        Fingerprint& fingerprint = fingerprints[device_addr];
+        checked.push_back(&fingerprint);
+        // Ranges that keep changing are hashed less and less often, so that they do not pay for
+        // reading their contents twice on every upload
+        if (fingerprint.checks_to_skip > 0) {
+            --fingerprint.checks_to_skip;
+            fingerprint.is_valid = false;
+            return false;
+        }
+        const u64 hash = Common::FastHash64(contents.data(), contents.size());
+        if (fingerprint.is_valid && fingerprint.size == contents.size() &&
+            fingerprint.hash == hash && fingerprint.contents_version == contents_version) {
+            fingerprint.misses = 0;
+            return true;
+        }
+        if (fingerprint.is_valid) {
+            fingerprint.misses = std::min(fingerprint.misses + 1, MAX_MISSES);
+            fingerprint.checks_to_skip = (1U << fingerprint.misses) - 1;
+        }
+        fingerprint.size = contents.size();
+        fingerprint.hash = hash;
+        fingerprint.is_valid = true;
+        return false;
+    }
+
+    /**
+     * Records the contents version of the buffer after uploading the ranges checked since the
+     * last commit. Unchanged ranges are kept valid, the upload did not touch them.
+     */
+    void Commit(u64 contents_version) {
+        for (Fingerprint* const fingerprint : checked) {
+            fingerprint->contents_version = contents_version;
+        }
+        checked.clear();
+        if (fingerprints.size() >= MAX_FINGERPRINTS) {
+            fingerprints.clear();
+        }
+    }
+
+private:
+    std::unordered_map<DAddr, Fingerprint> fingerprints;
+    boost::container::small_vector<Fingerprint*, 4> checked;
+};
+
+} // namespace VideoCommon
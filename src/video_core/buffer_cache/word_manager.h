@@ -227,6 +227,66 @@ public:
         }
     }
 
+    /**
+     * Like IterateWords, but only visits the words with pages set in the given state.
+     * For GPU state, pages that are untracked are ignored.
+     * Runs of empty words are skipped several words at a time.
+     */
+    template <Type type, typename Func>
+    void IterateSetWords(size_t offset, size_t size, Func&& func) const {
+        using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
+        static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+        const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
+        const size_t end = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset + size), 0LL));
+        if (start >= SizeBytes() || end <= start) {
+            return;
+        }
+        auto [start_word, start_page] = GetWordPage(start);
+        auto [end_word, end_page] = GetWordPage(end + BYTES_PER_PAGE - 1ULL);
+        const size_t num_words = NumWords();
+        start_word = std::min(start_word, num_words);
+        end_word = std::min(end_word, num_words);
+        const size_t diff = end_word - start_word;
+        end_word += (end_page + PAGES_PER_WORD - 1ULL) / PAGES_PER_WORD;
+        end_word = std::min(end_word, num_words);
+        end_page += diff * PAGES_PER_WORD;
+
+        const u64* const state_words = words.template Span<type>().data();
+        const u64* const untracked_words = words.template Span<Type::Untracked>().data();
+        const auto set_bits = [&](size_t index) {
+            if constexpr (type == Type::GPU) {
+                return state_words[index] & ~untracked_words[index];
+            } else {
+                return state_words[index];
+            }
+        };
+        constexpr u64 base_mask{~0ULL};
+        for (size_t word_index = start_word; word_index < end_word; ++word_index) {
+            // Empty words are tested in blocks, ORing them lets the compiler vectorize the test
+            while (word_index + 4 <= end_word && (set_bits(word_index) | set_bits(word_index + 1) |
+                                                  set_bits(word_index + 2) |
+                                                  set_bits(word_index + 3)) == 0) {
+                word_index += 4;
+            }
+            while (word_index < end_word && set_bits(word_index) == 0) {
+                ++word_index;
+            }
+            if (word_index == end_word) {
+                return;
+            }
+            const size_t skipped_pages = (word_index - start_word) * PAGES_PER_WORD;
+            const size_t page_begin = word_index == start_word ? start_page : 0;
+            const u64 mask = ExtractBits(base_mask, page_begin, end_page - skipped_pages);
+            if constexpr (BOOL_BREAK) {
+                if (func(word_index, mask)) {
+                    return;
+                }
+            } else {
+                func(word_index, mask);
+            }
+        }
+    }
+
     template <typename Func>
     void IteratePages(u64 mask, Func&& func) const {
         size_t offset = 0;
@@ -301,7 +361,7 @@ public:
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const auto visit_word = [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -336,7 +396,13 @@ public:
                 release();
                 reset();
             });
-        });
+        };
+        if constexpr (clear && (type == Type::CPU || type == Type::CachedCPU)) {
+            // Clearing CPU state also updates untracked pages of words without modified pages
+            IterateWords(offset, size, visit_word);
+        } else {
+            IterateSetWords<type>(offset, size, visit_word);
+        }
         if (pending) {
             release();
         }
@@ -356,7 +422,7 @@ public:
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        IterateSetWords<type>(offset, size, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -384,7 +450,7 @@ public:
             words.template Span<Type::Untracked>();
         u64 begin = std::numeric_limits<u64>::max();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        IterateSetWords<type>(offset, size, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
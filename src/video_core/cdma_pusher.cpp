@@ -19,7 +19,17 @@ CDmaPusher::CDmaPusher(Host1x::Host1x& host1x_)
       host1x_processor(std::make_unique<Host1x::Control>(host1x)),
       sync_manager(std::make_unique<Host1x::SyncptIncrManager>(host1x)) {}
 
-CDmaPusher::~CDmaPusher() = default;
+CDmaPusher::~CDmaPusher() {
+    // The guest may still be waiting on the fences of queued submissions
+    worker.WaitForRequests();
+}
+
+void CDmaPusher::PushEntries(ChCommandHeaderList&& entries) {
+    // Syncpoint fences are handed to the guest on submission, and every increment happens once
+    // the commands before it have run, so the guest waits on them as it would on hardware.
+    worker.QueueWork(
+        [this, entries = std::move(entries)]() mutable { ProcessEntries(std::move(entries)); });
+}
 
 void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
     for (const auto& value : entries) {
@@ -9,6 +9,7 @@
 #include "common/bit_field.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 
 namespace Tegra {
 
@@ -92,10 +93,14 @@ public:
     explicit CDmaPusher(Host1x::Host1x& host1x);
     ~CDmaPusher();
 
+    /// Queue the command entries to be processed in order on the pusher's thread, every queued
+    /// entry is processed before the pusher is destroyed
+    void PushEntries(ChCommandHeaderList&& entries);
+
+private:
     /// Process the command entry
     void ProcessEntries(ChCommandHeaderList&& entries);
 
-private:
     /// Invoke command class devices to execute the command based on the current state
     void ExecuteCommand(u32 state_offset, u32 data);
 
@@ -115,6 +120,10 @@ private:
     u32 offset{};
     u32 mask{};
     bool incrementing{};
+
+    /// Processes the pushed entries, declared last so that it is stopped before the devices
+    /// it uses are destroyed
+    Common::ThreadWorker worker{1, "Host1x_CDmaPusher"};
 };
 
 } // namespace Tegra
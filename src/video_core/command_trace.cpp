@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "common/logging/log.h"
+#include "video_core/command_trace.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu.h"
+#include "video_core/memory_manager.h"
+
+namespace Tegra {
+
+namespace {
+constexpr u32 TraceMagic = Common::MakeMagic('Y', 'G', 'P', 'T');
+constexpr u32 TraceVersion = 1;
+
+template <typename T>
+std::span<const u8> AsBytes(const T& object) {
+    return {reinterpret_cast<const u8*>(&object), sizeof(T)};
+}
+} // Anonymous namespace
+
+CommandTraceWriter::CommandTraceWriter(const std::filesystem::path& path)
+    : file{path, Common::FS::FileAccessMode::Write, Common::FS::FileType::BinaryFile} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU command trace {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    const CommandTraceFileHeader header{
+        .magic = TraceMagic,
+        .version = TraceVersion,
+    };
+    void(file.WriteObject(header));
+    LOG_INFO(HW_GPU, "Recording GPU command trace to {}", Common::FS::PathToUTF8String(path));
+}
+
+CommandTraceWriter::~CommandTraceWriter() = default;
+
+bool CommandTraceWriter::IsOpen() const {
+    return file.IsOpen();
+}
+
+void CommandTraceWriter::RecordAddressSpace(const CommandTraceAddressSpace& address_space) {
+    WriteRecord(CommandTraceRecordType::AddressSpace, AsBytes(address_space));
+}
+
+void CommandTraceWriter::RecordMap(u64 address_space, GPUVAddr gpu_addr, DAddr device_addr,
+                                   u64 size, PTEKind kind, bool is_big_pages, bool is_sparse) {
+    CommandTraceMap map{};
+    map.address_space = address_space;
+    map.gpu_addr = gpu_addr;
+    map.device_addr = device_addr;
+    map.size = size;
+    map.kind = kind;
+    map.is_big_pages = is_big_pages ? 1 : 0;
+    map.is_sparse = is_sparse ? 1 : 0;
+    WriteRecord(CommandTraceRecordType::Map, AsBytes(map));
+}
+
+void CommandTraceWriter::RecordUnmap(u64 address_space, GPUVAddr gpu_addr, u64 size) {
+    const CommandTraceUnmap unmap{
+        .address_space = address_space,
+        .gpu_addr = gpu_addr,
+        .size = size,
+    };
+    WriteRecord(CommandTraceRecordType::Unmap, AsBytes(unmap));
+}
+
+void CommandTraceWriter::RecordCommandList(s32 channel, u64 address_space, GPUVAddr gpu_addr,
+                                           std::span<const CommandHeader> commands) {
+    const CommandTraceCommandList command_list{
+        .channel = channel,
+        .word_count = static_cast<u32>(commands.size()),
+        .address_space = address_space,
+        .gpu_addr = gpu_addr,
+    };
+    WriteRecord(CommandTraceRecordType::CommandList, AsBytes(command_list),
+                {reinterpret_cast<const u8*>(commands.data()), commands.size_bytes()});
+}
+
+void CommandTraceWriter::WriteRecord(CommandTraceRecordType type, std::span<const u8> payload,
+                                     std::span<const u8> extra) {
+    const CommandTraceRecordHeader header{
+        .type = type,
+        .size = static_cast<u32>(payload.size() + extra.size()),
+    };
+    std::scoped_lock lock{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    void(file.WriteObject(header));
+    void(file.WriteSpan(payload));
+    if (!extra.empty()) {
+        void(file.WriteSpan(extra));
+    }
+}
+
+CommandTraceReader::CommandTraceReader(const std::filesystem::path& path)
+    : file{path, Common::FS::FileAccessMode::Read, Common::FS::FileType::BinaryFile} {
+    CommandTraceFileHeader header{};
+    if (!file.IsOpen() || !file.ReadObject(header)) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU command trace {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    if (header.magic != TraceMagic || header.version != TraceVersion) {
+        LOG_ERROR(HW_GPU, "Unsupported GPU command trace, magic={:08X} version={}", header.magic,
+                  header.version);
+        return;
+    }
+    is_valid = true;
+}
+
+CommandTraceReader::~CommandTraceReader() = default;
+
+bool CommandTraceReader::IsValid() const {
+    return is_valid;
+}
+
+std::optional<CommandTraceEntry> CommandTraceReader::Next() {
+    if (!is_valid) {
+        return std::nullopt;
+    }
+    CommandTraceRecordHeader header{};
+    if (!file.ReadObject(header)) {
+        return std::nullopt;
+    }
+    std::vector<u8> payload(header.size);
+    if (file.ReadSpan<u8>(payload) != payload.size()) {
+        LOG_ERROR(HW_GPU, "Truncated GPU command trace record");
+        is_valid = false;
+        return std::nullopt;
+    }
+    const auto read_payload = [&]<typename T>(T& object) {
+        if (payload.size() < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&object, payload.data(), sizeof(T));
+        return true;
+    };
+
+    CommandTraceEntry entry{.type = header.type};
+    bool is_ok{};
+    switch (header.type) {
+    case CommandTraceRecordType::AddressSpace:
+        is_ok = read_payload(entry.address_space);
+        break;
+    case CommandTraceRecordType::Map:
+        is_ok = read_payload(entry.map);
+        break;
+    case CommandTraceRecordType::Unmap:
+        is_ok = read_payload(entry.unmap);
+        break;
+    case CommandTraceRecordType::CommandList: {
+        is_ok = read_payload(entry.command_list);
+        const std::size_t words_size = payload.size() - sizeof(CommandTraceCommandList);
+        if (!is_ok || words_size != entry.command_list.word_count * sizeof(u32)) {
+            is_ok = false;
+            break;
+        }
+        entry.words.resize(entry.command_list.word_count);
+        std::memcpy(entry.words.data(), payload.data() + sizeof(CommandTraceCommandList),
+                    words_size);
+        break;
+    }
+    }
+    if (!is_ok) {
+        LOG_ERROR(HW_GPU, "Corrupt GPU command trace record type={}",
+                  static_cast<u32>(header.type));
+        is_valid = false;
+        return std::nullopt;
+    }
+    return entry;
+}
+
+CommandTraceReplayer::CommandTraceReplayer(Core::System& system_, GPU& gpu_, u64 program_id_)
+    : system{system_}, gpu{gpu_}, program_id{program_id_} {}
+
+CommandTraceReplayer::~CommandTraceReplayer() {
+    for (auto& [id, channel] : channels) {
+        gpu.ReleaseChannel(*channel);
+    }
+}
+
+u64 CommandTraceReplayer::Replay(CommandTraceReader& reader) {
+    u64 submitted_lists{};
+    while (auto entry = reader.Next()) {
+        switch (entry->type) {
+        case CommandTraceRecordType::AddressSpace: {
+            const auto& info = entry->address_space;
+            auto memory_manager = std::make_shared<MemoryManager>(
+                system, info.address_space_bits, info.split_address, info.big_page_bits,
+                info.page_bits);
+            gpu.InitAddressSpace(*memory_manager);
+            address_spaces.insert_or_assign(info.id, std::move(memory_manager));
+            break;
+        }
+        case CommandTraceRecordType::Map: {
+            const auto& map = entry->map;
+            const auto it = address_spaces.find(map.address_space);
+            if (it == address_spaces.end()) {
+                LOG_WARNING(HW_GPU, "Map into unknown address space {}", map.address_space);
+                break;
+            }
+            if (map.is_sparse != 0) {
+                it->second->MapSparse(map.gpu_addr, map.size, map.is_big_pages != 0);
+            } else {
+                it->second->Map(map.gpu_addr, map.device_addr, map.size, map.kind,
+                                map.is_big_pages != 0);
+            }
+            break;
+        }
+        case CommandTraceRecordType::Unmap: {
+            const auto& unmap = entry->unmap;
+            const auto it = address_spaces.find(unmap.address_space);
+            if (it != address_spaces.end()) {
+                it->second->Unmap(unmap.gpu_addr, unmap.size);
+            }
+            break;
+        }
+        case CommandTraceRecordType::CommandList: {
+            const auto& info = entry->command_list;
+            Control::ChannelState& channel = GetChannel(info.channel, info.address_space);
+            boost::container::small_vector<CommandHeader, 512> commands(entry->words.size());
+            std::memcpy(commands.data(), entry->words.data(), entry->words.size() * sizeof(u32));
+            gpu.PushGPUEntries(channel.bind_id, CommandList{std::move(commands)});
+            ++submitted_lists;
+            break;
+        }
+        }
+    }
+    return submitted_lists;
+}
+
+Control::ChannelState& CommandTraceReplayer::GetChannel(s32 channel, u64 address_space) {
+    if (const auto it = channels.find(channel); it != channels.end()) {
+        return *it->second;
+    }
+    auto channel_state = gpu.AllocateChannel();
+    if (const auto it = address_spaces.find(address_space); it != address_spaces.end()) {
+        channel_state->memory_manager = it->second;
+    } else {
+        LOG_WARNING(HW_GPU, "Channel {} uses unknown address space {}", channel, address_space);
+        auto memory_manager = std::make_shared<MemoryManager>(system);
+        gpu.InitAddressSpace(*memory_manager);
+        channel_state->memory_manager = memory_manager;
+        address_spaces.emplace(address_space, std::move(memory_manager));
+    }
+    gpu.InitChannel(*channel_state, program_id);
+    return *channels.emplace(channel, std::move(channel_state)).first->second;
+}
+
+} // namespace Tegra
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/pte_kind.h"
+
+namespace Core {
+class System;
+}
+
+namespace Tegra {
+
+class GPU;
+class MemoryManager;
+union CommandHeader;
+
+namespace Control {
+struct ChannelState;
+}
+
+/**
+ * Trace file layout: a CommandTraceFileHeader followed by a stream of records. Every record starts
+ * with a CommandTraceRecordHeader and is followed by `size` bytes of payload. Command lists are
+ * stored already resolved from guest memory, so a trace can be replayed without the process that
+ * produced it.
+ */
+enum class CommandTraceRecordType : u32 {
+    AddressSpace = 1, ///< CommandTraceAddressSpace
+    Map = 2,          ///< CommandTraceMap
+    Unmap = 3,        ///< CommandTraceUnmap
+    CommandList = 4,  ///< CommandTraceCommandList followed by the command words
+};
+
+struct CommandTraceFileHeader {
+    u32 magic;
+    u32 version;
+};
+static_assert(sizeof(CommandTraceFileHeader) == 0x8);
+
+struct CommandTraceRecordHeader {
+    CommandTraceRecordType type;
+    u32 size;
+};
+static_assert(sizeof(CommandTraceRecordHeader) == 0x8);
+
+struct CommandTraceAddressSpace {
+    u64 id;
+    u64 address_space_bits;
+    u64 split_address;
+    u64 big_page_bits;
+    u64 page_bits;
+};
+static_assert(sizeof(CommandTraceAddressSpace) == 0x28);
+
+struct CommandTraceMap {
+    u64 address_space;
+    GPUVAddr gpu_addr;
+    DAddr device_addr;
+    u64 size;
+    PTEKind kind;
+    u8 is_big_pages;
+    u8 is_sparse;
+    INSERT_PADDING_BYTES(5);
+};
+static_assert(sizeof(CommandTraceMap) == 0x28);
+
+struct CommandTraceUnmap {
+    u64 address_space;
+    GPUVAddr gpu_addr;
+    u64 size;
+};
+static_assert(sizeof(CommandTraceUnmap) == 0x18);
+
+struct CommandTraceCommandList {
+    s32 channel;
+    u32 word_count;
+    u64 address_space;
+    GPUVAddr gpu_addr; ///< Address the words were fetched from, zero for prefetched lists
+};
+static_assert(sizeof(CommandTraceCommandList) == 0x18);
+
+/// Serializes GPU submissions and address space changes into a trace file. Thread-safe.
+class CommandTraceWriter {
+public:
+    explicit CommandTraceWriter(const std::filesystem::path& path);
+    ~CommandTraceWriter();
+
+    [[nodiscard]] bool IsOpen() const;
+
+    void RecordAddressSpace(const CommandTraceAddressSpace& address_space);
+
+    void RecordMap(u64 address_space, GPUVAddr gpu_addr, DAddr device_addr, u64 size, PTEKind kind,
+                   bool is_big_pages, bool is_sparse);
+
+    void RecordUnmap(u64 address_space, GPUVAddr gpu_addr, u64 size);
+
+    void RecordCommandList(s32 channel, u64 address_space, GPUVAddr gpu_addr,
+                           std::span<const CommandHeader> commands);
+
+private:
+    void WriteRecord(CommandTraceRecordType type, std::span<const u8> payload,
+                     std::span<const u8> extra = {});
+
+    std::mutex mutex;
+    Common::FS::IOFile file;
+};
+
+/// A single decoded trace record
+struct CommandTraceEntry {
+    CommandTraceRecordType type{};
+    CommandTraceAddressSpace address_space{};
+    CommandTraceMap map{};
+    CommandTraceUnmap unmap{};
+    CommandTraceCommandList command_list{};
+    std::vector<u32> words;
+};
+
+/// Sequentially decodes the records of a trace file
+class CommandTraceReader {
+public:
+    explicit CommandTraceReader(const std::filesystem::path& path);
+    ~CommandTraceReader();
+
+    /// Returns true when the file was opened and has a compatible header
+    [[nodiscard]] bool IsValid() const;
+
+    /// Returns the next record, or std::nullopt at the end of the trace or on a corrupt record
+    [[nodiscard]] std::optional<CommandTraceEntry> Next();
+
+private:
+    Common::FS::IOFile file;
+    bool is_valid{};
+};
+
+/**
+ * Drives the GPU engines from a trace. Address spaces and channels are recreated on the given GPU
+ * and command lists are submitted as prefetched lists, so no guest process is required.
+ */
+class CommandTraceReplayer {
+public:
+    explicit CommandTraceReplayer(Core::System& system_, GPU& gpu_, u64 program_id_);
+    ~CommandTraceReplayer();
+
+    /// Replays every record of the trace, returns the number of submitted command lists
+    u64 Replay(CommandTraceReader& reader);
+
+private:
+    Control::ChannelState& GetChannel(s32 channel, u64 address_space);
+
+    Core::System& system;
+    GPU& gpu;
+    u64 program_id;
+
+    std::map<u64, std::shared_ptr<MemoryManager>> address_spaces;
+    std::map<s32, std::shared_ptr<Control::ChannelState>> channels;
+};
+
+} // namespace Tegra
@@ -1,11 +1,16 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/cityhash.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "core/core.h"
+#include "video_core/command_trace.h"
+#include "video_core/control/channel_state.h"
 #include "video_core/dma_pusher.h"
+#include "video_core/engines/draw_manager.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
 #include "video_core/guest_memory.h"
@@ -18,8 +23,8 @@ constexpr u32 ComputeInline = 0x6D;
 
 DmaPusher::DmaPusher(Core::System& system_, GPU& gpu_, MemoryManager& memory_manager_,
                      Control::ChannelState& channel_state_)
-    : gpu{gpu_}, system{system_}, memory_manager{memory_manager_}, puller{gpu_, memory_manager_,
-                                                                          *this, channel_state_} {}
+    : gpu{gpu_}, system{system_}, memory_manager{memory_manager_}, channel_state{channel_state_},
+      command_trace{gpu_.CommandTrace()}, puller{gpu_, memory_manager_, *this, channel_state_} {}
 
 DmaPusher::~DmaPusher() = default;
 
@@ -37,6 +42,7 @@ void DmaPusher::DispatchCalls() {
             break;
         }
     }
+    FlushPendingDraw();
     gpu.FlushCommands();
     gpu.OnCommandListEnd();
 }
@@ -60,6 +66,10 @@ bool DmaPusher::Step() {
 
     if (command_list.prefetch_command_list.size()) {
         // Prefetched command list from nvdrv, used for things like synchronization
+        if (command_trace) [[unlikely]] {
+            command_trace->RecordCommandList(channel_state.bind_id, memory_manager.GetID(), 0,
+                                             command_list.prefetch_command_list);
+        }
         ProcessCommands(command_list.prefetch_command_list);
         dma_pushbuffer.pop();
     } else {
@@ -84,11 +94,18 @@ bool DmaPusher::Step() {
                     dma_state.dma_get, command_list_header.size * sizeof(u32));
             }
         }
+        const auto record_command_list = [&](std::span<const CommandHeader> headers) {
+            if (command_trace) [[unlikely]] {
+                command_trace->RecordCommandList(channel_state.bind_id, memory_manager.GetID(),
+                                                 dma_state.dma_get, headers);
+            }
+        };
         const auto safe_process = [&] {
             Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader,
                                           Tegra::Memory::GuestMemoryFlags::SafeRead>
                 headers(memory_manager, dma_state.dma_get, command_list_header.size,
                         &command_headers);
+            record_command_list(headers);
             ProcessCommands(headers);
         };
         const auto unsafe_process = [&] {
@@ -96,6 +113,7 @@ bool DmaPusher::Step() {
                                           Tegra::Memory::GuestMemoryFlags::UnsafeRead>
                 headers(memory_manager, dma_state.dma_get, command_list_header.size,
                         &command_headers);
+            record_command_list(headers);
             ProcessCommands(headers);
         };
         if (Settings::IsGPULevelHigh()) {
@@ -131,6 +149,17 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
                 dma_state.is_last_call = true;
                 index += max_write;
                 continue;
+            } else if (!dma_increment_once && dma_state.method >= non_puller_methods) {
+                // Plain register writes are the bulk of most command lists, batch them
+                const u32 num_sinked = SinkMethodRun(commands.subspan(index));
+                if (num_sinked != 0) {
+                    dma_state.method += num_sinked;
+                    dma_state.method_count -= num_sinked;
+                    index += num_sinked;
+                    continue;
+                }
+                dma_state.is_last_call = dma_state.method_count <= 1;
+                CallMethod(command_header.argument);
             } else {
                 dma_state.is_last_call = dma_state.method_count <= 1;
                 CallMethod(command_header.argument);
@@ -188,6 +217,7 @@ void DmaPusher::SetState(const CommandHeader& command_header) {
 
 void DmaPusher::CallMethod(u32 argument) const {
     if (dma_state.method < non_puller_methods) {
+        FlushPendingDraw();
         puller.CallPullerMethod(Engines::Puller::MethodCall{
             dma_state.method,
             argument,
@@ -200,6 +230,9 @@ void DmaPusher::CallMethod(u32 argument) const {
             subchannel->method_sink.emplace_back(dma_state.method, argument);
             return;
         }
+        if (subchannel != channel_state.maxwell_3d.get()) {
+            FlushPendingDraw();
+        }
         subchannel->ConsumeSink();
         subchannel->current_dma_segment = dma_state.dma_get + dma_state.dma_word_offset;
         subchannel->CallMethod(dma_state.method, argument, dma_state.is_last_call);
@@ -208,10 +241,14 @@ void DmaPusher::CallMethod(u32 argument) const {
 
 void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     if (dma_state.method < non_puller_methods) {
+        FlushPendingDraw();
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
                                dma_state.method_count);
     } else {
         auto subchannel = subchannels[dma_state.subchannel];
+        if (subchannel != channel_state.maxwell_3d.get()) {
+            FlushPendingDraw();
+        }
         subchannel->ConsumeSink();
         subchannel->current_dma_segment = dma_state.dma_get + dma_state.dma_word_offset;
         subchannel->CallMultiMethod(dma_state.method, base_start, num_methods,
@@ -219,6 +256,30 @@ void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     }
 }
 
+void DmaPusher::FlushPendingDraw() const {
+    // Methods of other engines and the puller can read or write memory used by a draw that the
+    // 3D engine is still holding back
+    channel_state.maxwell_3d->draw_manager->FlushPendingDraw();
+}
+
+u32 DmaPusher::SinkMethodRun(std::span<const CommandHeader> arguments) const {
+    auto subchannel = subchannels[dma_state.subchannel];
+    const auto& execution_mask{subchannel->execution_mask};
+    const u32 first_method{dma_state.method};
+    const u32 max_methods{
+        static_cast<u32>(std::min<size_t>(arguments.size(), dma_state.method_count))};
+    u32 num_methods{};
+    while (num_methods < max_methods && !execution_mask[first_method + num_methods]) {
+        ++num_methods;
+    }
+    auto& method_sink{subchannel->method_sink};
+    method_sink.reserve(method_sink.size() + num_methods);
+    for (u32 i = 0; i < num_methods; ++i) {
+        method_sink.emplace_back(first_method + i, arguments[i].argument);
+    }
+    return num_methods;
+}
+
 void DmaPusher::BindRasterizer(VideoCore::RasterizerInterface* rasterizer) {
     puller.BindRasterizer(rasterizer);
 }
@@ -25,6 +25,7 @@ namespace Control {
 struct ChannelState;
 }
 
+class CommandTraceWriter;
 class GPU;
 class MemoryManager;
 
@@ -149,6 +150,12 @@ private:
     void CallMethod(u32 argument) const;
     void CallMultiMethod(const u32* base_start, u32 num_methods) const;
 
+    /// Queues a run of consecutive non-executable methods into the engine's method sink at once
+    /// @returns Number of data words consumed, zero when the current method is executable
+    u32 SinkMethodRun(std::span<const CommandHeader> arguments) const;
+
+    void FlushPendingDraw() const;
+
     Common::ScratchBuffer<CommandHeader>
         command_headers; ///< Buffer for list of commands fetched at once
 
@@ -177,6 +184,8 @@ private:
     GPU& gpu;
     Core::System& system;
     MemoryManager& memory_manager;
+    Control::ChannelState& channel_state;
+    CommandTraceWriter* command_trace;
     mutable Engines::Puller puller;
 };
 
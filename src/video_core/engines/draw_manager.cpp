@@ -68,6 +68,7 @@ void DrawManager::ProcessMethodCall(u32 method, u32 argument) {
 }
 
 void DrawManager::Clear(u32 layer_count) {
+    FlushPendingDraw();
     if (maxwell3d->ShouldExecute()) {
         maxwell3d->rasterizer->Clear(layer_count);
     }
@@ -77,12 +78,14 @@ void DrawManager::DrawDeferred() {
     if (draw_state.draw_mode != DrawMode::Instance || draw_state.instance_count == 0) {
         return;
     }
+    FlushPendingDraw();
     DrawEnd(draw_state.instance_count + 1, true);
     draw_state.instance_count = 0;
 }
 
 void DrawManager::DrawArray(PrimitiveTopology topology, u32 vertex_first, u32 vertex_count,
                             u32 base_instance, u32 num_instances) {
+    FlushPendingDraw();
     draw_state.topology = topology;
     draw_state.vertex_buffer.first = vertex_first;
     draw_state.vertex_buffer.count = vertex_count;
@@ -92,6 +95,7 @@ void DrawManager::DrawArray(PrimitiveTopology topology, u32 vertex_first, u32 ve
 
 void DrawManager::DrawArrayInstanced(PrimitiveTopology topology, u32 vertex_first, u32 vertex_count,
                                      bool subsequent) {
+    FlushPendingDraw();
     draw_state.topology = topology;
     draw_state.vertex_buffer.first = vertex_first;
     draw_state.vertex_buffer.count = vertex_count;
@@ -108,6 +112,7 @@ void DrawManager::DrawArrayInstanced(PrimitiveTopology topology, u32 vertex_firs
 
 void DrawManager::DrawIndex(PrimitiveTopology topology, u32 index_first, u32 index_count,
                             u32 base_index, u32 base_instance, u32 num_instances) {
+    FlushPendingDraw();
     const auto& regs{maxwell3d->regs};
     draw_state.topology = topology;
     draw_state.index_buffer = regs.index_buffer;
@@ -119,6 +124,7 @@ void DrawManager::DrawIndex(PrimitiveTopology topology, u32 index_first, u32 ind
 }
 
 void DrawManager::DrawArrayIndirect(PrimitiveTopology topology) {
+    FlushPendingDraw();
     draw_state.topology = topology;
 
     ProcessDrawIndirect();
@@ -126,6 +132,7 @@ void DrawManager::DrawArrayIndirect(PrimitiveTopology topology) {
 
 void DrawManager::DrawIndexedIndirect(PrimitiveTopology topology, u32 index_first,
                                       u32 index_count) {
+    FlushPendingDraw();
     const auto& regs{maxwell3d->regs};
     draw_state.topology = topology;
     draw_state.index_buffer = regs.index_buffer;
@@ -136,6 +143,7 @@ void DrawManager::DrawIndexedIndirect(PrimitiveTopology topology, u32 index_firs
 }
 
 void DrawManager::SetInlineIndexBuffer(u32 index) {
+    FlushPendingDraw();
     draw_state.inline_index_draw_indexes.push_back(static_cast<u8>(index & 0x000000ff));
     draw_state.inline_index_draw_indexes.push_back(static_cast<u8>((index & 0x0000ff00) >> 8));
     draw_state.inline_index_draw_indexes.push_back(static_cast<u8>((index & 0x00ff0000) >> 16));
@@ -168,18 +176,27 @@ void DrawManager::DrawEnd(u32 instance_count, bool force_draw) {
             break;
         }
         [[fallthrough]];
-    case DrawMode::General:
+    case DrawMode::General: {
+        const bool draw_indexed = draw_state.draw_indexed;
+        draw_state.draw_indexed = false;
+        const bool coalesce = instance_count == 1 && !force_draw;
+        if (coalesce && TryMergeDraw(draw_indexed)) {
+            break;
+        }
+        FlushPendingDraw();
         draw_state.base_instance = regs.global_base_instance_index;
         draw_state.base_index = regs.global_base_vertex_index;
-        if (draw_state.draw_indexed) {
+        if (draw_indexed) {
             draw_state.index_buffer = regs.index_buffer;
-            ProcessDraw(true, instance_count);
         } else {
             draw_state.vertex_buffer = regs.vertex_buffer;
-            ProcessDraw(false, instance_count);
         }
-        draw_state.draw_indexed = false;
+        if (coalesce && DeferDraw(draw_indexed)) {
+            break;
+        }
+        ProcessDraw(draw_indexed, instance_count);
         break;
+    }
     case DrawMode::InlineIndex:
         draw_state.base_instance = regs.global_base_instance_index;
         draw_state.base_index = regs.global_base_vertex_index;
@@ -195,6 +212,7 @@ void DrawManager::DrawEnd(u32 instance_count, bool force_draw) {
 }
 
 void DrawManager::DrawIndexSmall(u32 argument) {
+    FlushPendingDraw();
     const auto& regs{maxwell3d->regs};
     IndexBufferSmall index_small_params{argument};
     draw_state.base_instance = regs.global_base_instance_index;
@@ -208,6 +226,7 @@ void DrawManager::DrawIndexSmall(u32 argument) {
 }
 
 void DrawManager::DrawTexture() {
+    FlushPendingDraw();
     const auto& regs{maxwell3d->regs};
     draw_texture_state.dst_x0 = static_cast<float>(regs.draw_texture.dst_x0) / 4096.f;
     draw_texture_state.dst_y0 = static_cast<float>(regs.draw_texture.dst_y0) / 4096.f;
@@ -271,6 +290,80 @@ void DrawManager::ProcessDraw(bool draw_indexed, u32 instance_count) {
     }
 }
 
+bool DrawManager::DeferDraw(bool draw_indexed) {
+    // Only list topologies can be joined by extending the range of the previous draw, strips and
+    // fans would connect the primitives of both draws
+    UpdateTopology();
+    switch (draw_state.topology) {
+    case PrimitiveTopology::Points:
+    case PrimitiveTopology::Lines:
+    case PrimitiveTopology::Triangles:
+        break;
+    default:
+        return false;
+    }
+    if (maxwell3d->regs.transform_feedback_enabled != 0) {
+        return false;
+    }
+    pending_draw = PendingDraw{
+        .active = true,
+        .indexed = draw_indexed,
+        .topology = draw_state.topology,
+        .merged_draws = 0,
+    };
+    return true;
+}
+
+bool DrawManager::TryMergeDraw(bool draw_indexed) {
+    if (!pending_draw.active || pending_draw.indexed != draw_indexed) {
+        return false;
+    }
+    // Any state change between both draws has already flushed the pending draw, so only the
+    // topology and the draw ranges have to be compared here
+    UpdateTopology();
+    if (draw_state.topology != pending_draw.topology) {
+        return false;
+    }
+    const auto& regs{maxwell3d->regs};
+    if (draw_state.base_instance != regs.global_base_instance_index ||
+        draw_state.base_index != regs.global_base_vertex_index) {
+        return false;
+    }
+    if (draw_indexed) {
+        auto& pending = draw_state.index_buffer;
+        const auto& next = regs.index_buffer;
+        if (pending.StartAddress() != next.StartAddress() ||
+            pending.EndAddress() != next.EndAddress() || pending.format != next.format ||
+            pending.first + pending.count != next.first) {
+            return false;
+        }
+        pending.count += next.count;
+    } else {
+        auto& pending = draw_state.vertex_buffer;
+        const auto& next = regs.vertex_buffer;
+        if (pending.first + pending.count != next.first) {
+            return false;
+        }
+        pending.count += next.count;
+    }
+    ++pending_draw.merged_draws;
+    return true;
+}
+
+void DrawManager::FlushPendingDrawImpl() {
+    pending_draw.active = false;
+    // The topology may already have been overwritten by the begin method of the next draw
+    const PrimitiveTopology next_topology = draw_state.topology;
+    draw_state.topology = pending_draw.topology;
+    if (pending_draw.indexed && pending_draw.merged_draws != 0) {
+        // The index buffer binding is sized from the index count
+        maxwell3d->dirty.flags[VideoCommon::Dirty::IndexBuffer] = true;
+    }
+    LOG_TRACE(HW_GPU, "coalesced {} draws", pending_draw.merged_draws + 1);
+    ProcessDraw(pending_draw.indexed, 1);
+    draw_state.topology = next_topology;
+}
+
 void DrawManager::ProcessDrawIndirect() {
     LOG_TRACE(
         HW_GPU,
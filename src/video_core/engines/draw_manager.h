@@ -92,7 +92,48 @@ public:
         return indirect_state;
     }
 
+    /// Returns true when a draw is being held back to be coalesced with the next one
+    bool HasPendingDraw() const {
+        return pending_draw.active;
+    }
+
+    /// Sends the held back draw, if any, to the rasterizer
+    void FlushPendingDraw() {
+        if (pending_draw.active) [[unlikely]] {
+            FlushPendingDrawImpl();
+        }
+    }
+
+    /// Sends the held back draw before method is processed, unless method only describes the
+    /// range of the next draw
+    void FlushPendingDrawBefore(u32 method) {
+        if (pending_draw.active && !IsDrawRangeMethod(method)) [[unlikely]] {
+            FlushPendingDrawImpl();
+        }
+    }
+
 private:
+    struct PendingDraw {
+        bool active{};
+        bool indexed{};
+        PrimitiveTopology topology{};
+        u32 merged_draws{};
+    };
+
+    static constexpr bool IsDrawRangeMethod(u32 method) {
+        switch (method) {
+        case MAXWELL3D_REG_INDEX(draw.begin):
+        case MAXWELL3D_REG_INDEX(draw.end):
+        case MAXWELL3D_REG_INDEX(vertex_buffer.first):
+        case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+        case MAXWELL3D_REG_INDEX(index_buffer.first):
+        case MAXWELL3D_REG_INDEX(index_buffer.count):
+            return true;
+        default:
+            return false;
+        }
+    }
+
     void SetInlineIndexBuffer(u32 index);
 
     void DrawBegin();
@@ -109,9 +150,16 @@ private:
 
     void ProcessDrawIndirect();
 
+    bool DeferDraw(bool draw_indexed);
+
+    bool TryMergeDraw(bool draw_indexed);
+
+    void FlushPendingDrawImpl();
+
     Maxwell3D* maxwell3d{};
     State draw_state{};
     DrawTextureState draw_texture_state{};
     IndirectParams indirect_state{};
+    PendingDraw pending_draw{};
 };
 } // namespace Tegra::Engines
@@ -319,15 +319,17 @@ void Maxwell3D::ProcessDirtyRegisters(u32 method, u32 argument) {
     if (regs.reg_array[method] == argument) {
         return;
     }
+    draw_manager->FlushPendingDrawBefore(method);
     regs.reg_array[method] = argument;
 
-    for (const auto& table : dirty.tables) {
-        dirty.flags[table[method]] = true;
-    }
+    const auto [flag_a, flag_b] = dirty.packed_table[method];
+    dirty.flags[flag_a] = true;
+    dirty.flags[flag_b] = true;
 }
 
 void Maxwell3D::ProcessMethodCall(u32 method, u32 argument, u32 nonshadow_argument,
                                   bool is_last_call) {
+    draw_manager->FlushPendingDrawBefore(method);
     switch (method) {
     case MAXWELL3D_REG_INDEX(wait_for_idle):
         return rasterizer->WaitForIdle();
@@ -404,6 +406,9 @@ void Maxwell3D::CallMacroMethod(u32 method, const std::vector<u32>& parameters)
     const u32 entry =
         ((method - MacroRegistersStart) >> 1) % static_cast<u32>(macro_positions.size());
 
+    // HLE macros change registers directly, do not let them join a draw issued before them
+    draw_manager->FlushPendingDraw();
+
     // Execute the current macro.
     macro_engine->Execute(macro_positions[entry], parameters);
 
@@ -440,6 +445,7 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
         ProcessMacro(method, base_start, amount, amount == methods_pending);
         return;
     }
+    draw_manager->FlushPendingDrawBefore(method);
     switch (method) {
     case MAXWELL3D_REG_INDEX(const_buffer.buffer):
     case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 1:
@@ -465,6 +471,13 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
         return;
     }
     default:
+        if (!execution_mask[method]) {
+            // Plain register writes, only shadow RAM and dirty tracking have to run per value
+            for (u32 i = 0; i < amount; i++) {
+                ProcessDirtyRegisters(method, ProcessShadowRam(method, base_start[i]));
+            }
+            return;
+        }
         for (u32 i = 0; i < amount; i++) {
             CallMethod(method, base_start[i], methods_pending - i <= 1);
         }
@@ -538,6 +551,15 @@ void Maxwell3D::ProcessQueryCondition() {
         return;
     }
     const GPUVAddr condition_address{regs.render_enable.Address()};
+    const auto read_condition = [this, condition_address] {
+        Regs::ReportSemaphore::Compare cmp;
+        if (rasterizer->SpeculateConditionalRendering()) {
+            memory_manager.ReadBlockUnsafe(condition_address, &cmp, sizeof(cmp));
+        } else {
+            memory_manager.ReadBlock(condition_address, &cmp, sizeof(cmp));
+        }
+        return cmp;
+    };
     switch (regs.render_enable_override) {
     case Regs::RenderEnable::Override::AlwaysRender:
         execute_on = true;
@@ -556,21 +578,18 @@ void Maxwell3D::ProcessQueryCondition() {
             break;
         }
         case Regs::RenderEnable::Mode::Conditional: {
-            Regs::ReportSemaphore::Compare cmp;
-            memory_manager.ReadBlock(condition_address, &cmp, sizeof(cmp));
+            const Regs::ReportSemaphore::Compare cmp{read_condition()};
             execute_on = cmp.initial_sequence != 0U && cmp.initial_mode != 0U;
             break;
         }
         case Regs::RenderEnable::Mode::IfEqual: {
-            Regs::ReportSemaphore::Compare cmp;
-            memory_manager.ReadBlock(condition_address, &cmp, sizeof(cmp));
+            const Regs::ReportSemaphore::Compare cmp{read_condition()};
             execute_on = cmp.initial_sequence == cmp.current_sequence &&
                          cmp.initial_mode == cmp.current_mode;
             break;
         }
         case Regs::RenderEnable::Mode::IfNotEqual: {
-            Regs::ReportSemaphore::Compare cmp;
-            memory_manager.ReadBlock(condition_address, &cmp, sizeof(cmp));
+            const Regs::ReportSemaphore::Compare cmp{read_condition()};
             execute_on = cmp.initial_sequence != cmp.current_sequence ||
                          cmp.initial_mode != cmp.current_mode;
             break;
@@ -3094,9 +3094,19 @@ public:
         using Flags = std::bitset<std::numeric_limits<u8>::max()>;
         using Table = std::array<u8, Regs::NUM_REGS>;
         using Tables = std::array<Table, 2>;
+        using PackedTable = std::array<std::array<u8, 2>, Regs::NUM_REGS>;
+
+        /// Interleaves the tables into the packed table, call after changing them
+        void PackTables() {
+            for (size_t method = 0; method < Regs::NUM_REGS; ++method) {
+                packed_table[method] = {tables[0][method], tables[1][method]};
+            }
+        }
 
         Flags flags;
         Tables tables{};
+        /// Flags of both tables next to each other, so a register write reads them at once
+        PackedTable packed_table{};
     } dirty;
 
     std::unique_ptr<DrawManager> draw_manager;
@@ -226,6 +226,29 @@ void MaxwellDMA::CopyBlockLinearToPitch() {
 
     const size_t dst_size = dst_operand.pitch * regs.line_count;
 
+    const DMA::SwizzleCopy swizzle_copy{
+        .src{
+            .size = static_cast<u32>(src_size),
+            .pitch = 0,
+            .width = width,
+            .height = height,
+            .origin_x = x_offset,
+            .origin_y = src_params.origin.y,
+            .block_height = block_height,
+            .block_depth = block_depth,
+        },
+        .dst{
+            .size = static_cast<u32>(dst_size),
+            .pitch = dst_operand.pitch,
+        },
+        .bytes_per_pixel = bytes_per_pixel,
+        .extent_x = x_elements,
+        .num_lines = regs.line_count,
+    };
+    if (depth == 1 && AccelerateSwizzle(src_operand.address, dst_operand.address, swizzle_copy)) {
+        return;
+    }
+
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead> tmp_read_buffer(
         memory_manager, src_operand.address, src_size, &read_buffer);
     Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::UnsafeReadCachedWrite>
@@ -288,6 +311,30 @@ void MaxwellDMA::CopyPitchToBlockLinear() {
         CalculateSize(true, bytes_per_pixel, width, height, depth, block_height, block_depth);
     const size_t src_size = static_cast<size_t>(regs.pitch_in) * regs.line_count;
 
+    const DMA::SwizzleCopy swizzle_copy{
+        .src{
+            .size = static_cast<u32>(src_size),
+            .pitch = static_cast<u32>(regs.pitch_in),
+        },
+        .dst{
+            .size = static_cast<u32>(dst_size),
+            .pitch = 0,
+            .width = width,
+            .height = height,
+            .origin_x = x_offset,
+            .origin_y = dst_params.origin.y,
+            .block_height = block_height,
+            .block_depth = block_depth,
+        },
+        .bytes_per_pixel = bytes_per_pixel,
+        .extent_x = x_elements,
+        .num_lines = regs.line_count,
+    };
+    if (depth == 1 && regs.pitch_in > 0 &&
+        AccelerateSwizzle(regs.offset_in, regs.offset_out, swizzle_copy)) {
+        return;
+    }
+
     GPUVAddr src_addr = regs.offset_in;
     GPUVAddr dst_addr = regs.offset_out;
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead> tmp_read_buffer(
@@ -339,6 +386,36 @@ void MaxwellDMA::CopyBlockLinearToBlockLinear() {
     const size_t dst_size = CalculateSize(true, bytes_per_pixel, dst_width, dst.height, dst.depth,
                                           dst.block_size.height, dst.block_size.depth);
 
+    const DMA::SwizzleCopy swizzle_copy{
+        .src{
+            .size = static_cast<u32>(src_size),
+            .pitch = 0,
+            .width = src_width,
+            .height = src.height,
+            .origin_x = src_x_offset,
+            .origin_y = src.origin.y,
+            .block_height = src.block_size.height,
+            .block_depth = src.block_size.depth,
+        },
+        .dst{
+            .size = static_cast<u32>(dst_size),
+            .pitch = 0,
+            .width = dst_width,
+            .height = dst.height,
+            .origin_x = dst_x_offset,
+            .origin_y = dst.origin.y,
+            .block_height = dst.block_size.height,
+            .block_depth = dst.block_size.depth,
+        },
+        .bytes_per_pixel = bytes_per_pixel,
+        .extent_x = x_elements,
+        .num_lines = regs.line_count,
+    };
+    if (src.depth == 1 && dst.depth == 1 &&
+        AccelerateSwizzle(regs.offset_in, regs.offset_out, swizzle_copy)) {
+        return;
+    }
+
     const u32 pitch = x_elements * bytes_per_pixel;
     const size_t mid_buffer_size = pitch * regs.line_count;
 
@@ -358,6 +435,22 @@ void MaxwellDMA::CopyBlockLinearToBlockLinear() {
                    dst.block_size.height, dst.block_size.depth, pitch);
 }
 
+bool MaxwellDMA::AccelerateSwizzle(GPUVAddr src_address, GPUVAddr dst_address,
+                                   DMA::SwizzleCopy copy) {
+    if (!memory_manager.IsContinuousRange(src_address, copy.src.size) ||
+        !memory_manager.IsContinuousRange(dst_address, copy.dst.size)) {
+        return false;
+    }
+    const std::optional<DAddr> src_device_address = memory_manager.GpuToCpuAddress(src_address);
+    const std::optional<DAddr> dst_device_address = memory_manager.GpuToCpuAddress(dst_address);
+    if (!src_device_address || !dst_device_address) {
+        return false;
+    }
+    copy.src.address = *src_device_address;
+    copy.dst.address = *dst_device_address;
+    return rasterizer->AccessAccelerateDMA().BufferSwizzle(copy);
+}
+
 void MaxwellDMA::ReleaseSemaphore() {
     const auto type = regs.launch_dma.semaphore_type;
     const GPUVAddr address = regs.semaphore.address;
@@ -70,6 +70,33 @@ struct BufferOperand {
     GPUVAddr address;
 };
 
+/// One side of a copy between pitch linear and block linear memory
+struct SwizzleOperand {
+    /// Device address of the operand
+    DAddr address;
+    /// Size in bytes of the memory the operand covers
+    u32 size;
+    /// Pitch in bytes of a pitch linear operand, zero when the operand is block linear
+    u32 pitch;
+    /// Size and origin in elements, and log2 of the block size in GOBs of a block linear operand
+    u32 width;
+    u32 height;
+    u32 origin_x;
+    u32 origin_y;
+    u32 block_height;
+    u32 block_depth;
+};
+
+/// Copy of a single slice where at least one of the operands is block linear
+struct SwizzleCopy {
+    SwizzleOperand src;
+    SwizzleOperand dst;
+    u32 bytes_per_pixel;
+    /// Elements copied per line
+    u32 extent_x;
+    u32 num_lines;
+};
+
 } // namespace DMA
 } // namespace Tegra
 
@@ -87,6 +114,8 @@ public:
 
     virtual bool BufferToImage(const DMA::ImageCopy& copy_info, const DMA::BufferOperand& src,
                                const DMA::ImageOperand& dst) = 0;
+
+    virtual bool BufferSwizzle(const DMA::SwizzleCopy& copy) = 0;
 };
 
 /**
@@ -259,6 +288,9 @@ private:
 
     void CopyBlockLinearToBlockLinear();
 
+    /// Tries to do a swizzled copy on the host GPU, the operands are given by their GPU address
+    bool AccelerateSwizzle(GPUVAddr src_address, GPUVAddr dst_address, DMA::SwizzleCopy copy);
+
     void ReleaseSemaphore();
 
     void ConsumeSinkImpl() override;
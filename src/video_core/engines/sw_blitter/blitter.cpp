@@ -32,16 +32,27 @@ void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_wi
                      u32 dst_width, u32 dst_height, size_t bpp) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
+    const size_t src_row_size = src_width * bpp;
+    const size_t dst_row_size = dst_width * bpp;
     size_t src_y = 0;
+    size_t last_src_row = ~size_t{0};
     for (u32 y = 0; y < dst_height; y++) {
-        size_t src_x = 0;
-        for (u32 x = 0; x < dst_width; x++) {
-            const size_t read_from = ((src_y * src_width + src_x) >> 32) * bpp;
-            const size_t write_to = (y * dst_width + x) * bpp;
-
-            std::memcpy(&output[write_to], &input[read_from], bpp);
-            src_x += dx_du;
+        const size_t src_row = src_y >> 32;
+        u8* const write_to = &output[y * dst_row_size];
+        if (src_row == last_src_row) {
+            // Rows repeated by a vertical stretch are copies of the row written before
+            std::memcpy(write_to, write_to - dst_row_size, dst_row_size);
+        } else if (src_width == dst_width) {
+            std::memcpy(write_to, &input[src_row * src_row_size], dst_row_size);
+        } else {
+            const u8* const read_from = &input[src_row * src_row_size];
+            size_t src_x = 0;
+            for (u32 x = 0; x < dst_width; x++) {
+                std::memcpy(&write_to[x * bpp], &read_from[(src_x >> 32) * bpp], bpp);
+                src_x += dx_du;
+            }
         }
+        last_src_row = src_row;
         src_y += dy_dv;
     }
 }
@@ -54,7 +65,7 @@ void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32
     for (u32 y = 0; y < dst_height; y++) {
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
-            const size_t read_from = ((src_y * src_width + src_x) >> 32) * ir_components;
+            const size_t read_from = ((src_y >> 32) * src_width + (src_x >> 32)) * ir_components;
             const size_t write_to = (y * dst_width + x) * ir_components;
 
             std::memcpy(&output[write_to], &input[read_from], sizeof(f32) * ir_components);
@@ -178,6 +189,16 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
                         dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
     };
 
+    const auto conversion_phase_shuffle = [&](const ByteShuffle& shuffle) {
+        if (src_extent_x != dst_extent_x || src_extent_y != dst_extent_y) {
+            NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
+                            dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
+            shuffle.Shuffle(impl->dst_buffer, impl->dst_buffer);
+        } else {
+            shuffle.Shuffle(impl->src_buffer, impl->dst_buffer);
+        }
+    };
+
     const auto conversion_phase_ir = [&]() {
         auto* input_converter = impl->converter_factory.GetFormatConverter(src.format);
         impl->intermediate_src.resize_destructive((src_copy_size / src_bytes_per_pixel) *
@@ -212,10 +233,15 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
 
     // Conversion Phase
     if (no_passthrough) {
-        if (src.format != dst.format || config.filter == Fermi2D::Filter::Bilinear) {
+        if (config.filter == Fermi2D::Filter::Bilinear) {
             conversion_phase_ir();
-        } else {
+        } else if (src.format == dst.format) {
             conversion_phase_same_format();
+        } else if (const ByteShuffle* const shuffle =
+                       impl->converter_factory.GetByteShuffle(src.format, dst.format)) {
+            conversion_phase_shuffle(*shuffle);
+        } else {
+            conversion_phase_ir();
         }
     } else {
         impl->dst_buffer.swap(impl->src_buffer);
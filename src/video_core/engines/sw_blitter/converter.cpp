@@ -1,10 +1,14 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <map>
+#include <optional>
 #include <span>
 #include <unordered_map>
+#include <utility>
 
 #include "common/assert.h"
 #include "common/bit_cast.h"
@@ -12,12 +16,29 @@
 #include "video_core/surface.h"
 #include "video_core/textures/decoders.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
 #ifdef _MSC_VER
 #define FORCE_INLINE __forceinline
 #else
 #define FORCE_INLINE inline __attribute__((always_inline))
 #endif
 
+#if defined(__GNUC__) && defined(ARCHITECTURE_x86_64)
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#else
+#define SSSE3_TARGET
+#endif
+
 namespace Tegra::Engines::Blitter {
 
 enum class Swizzle : size_t {
@@ -681,6 +702,33 @@ private:
 
     static constexpr std::array<u32, num_components> component_mask = GetComponentsMask();
 
+    static constexpr std::optional<ByteLayout> BuildByteLayout() {
+        ByteLayout layout{};
+        layout.bytes_per_pixel = total_bytes_per_pixel;
+        if (total_bytes_per_pixel > layout.bytes.size()) {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < num_components; i++) {
+            if (component_sizes[i] % 8 != 0 || bound_offsets[i] % 8 != 0) {
+                return std::nullopt;
+            }
+            if (component_swizzle[i] == Swizzle::None) {
+                continue;
+            }
+            const size_t component_bytes = component_sizes[i] / 8;
+            const size_t first_byte = bound_words[i] * sizeof(u32) + bound_offsets[i] / 8;
+            for (size_t byte = 0; byte < component_bytes; byte++) {
+                layout.bytes[first_byte + byte] =
+                    (static_cast<u32>(component_types[i]) << 24) |
+                    static_cast<u32>(component_bytes << 16) |
+                    (static_cast<u32>(component_swizzle[i]) << 8) | static_cast<u32>(byte);
+            }
+        }
+        return layout;
+    }
+
+    static constexpr std::optional<ByteLayout> byte_layout = BuildByteLayout();
+
     // We are forcing inline so the compiler can SIMD the conversations, since it may do 4 function
     // calls, it may fail to detect the benefit of inlining.
     template <size_t which_component>
@@ -916,12 +964,110 @@ public:
         }
     }
 
+    const ByteLayout* GetByteLayout() const override {
+        return byte_layout ? &*byte_layout : nullptr;
+    }
+
     ConverterImpl() = default;
     ~ConverterImpl() override = default;
 };
 
+namespace {
+
+#if defined(ARCHITECTURE_x86_64)
+
+SSSE3_TARGET size_t ShuffleSSSE3(const u8* input, u8* output, size_t size,
+                                 const std::array<u8, 16>& mask) {
+    const __m128i shuffle{_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data()))};
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i in{_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_shuffle_epi8(in, shuffle));
+    }
+    return i;
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+size_t ShuffleNEON(const u8* input, u8* output, size_t size, const std::array<u8, 16>& mask) {
+    const uint8x16_t shuffle{vld1q_u8(mask.data())};
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        vst1q_u8(output + i, vqtbl1q_u8(vld1q_u8(input + i), shuffle));
+    }
+    return i;
+}
+
+#endif
+
+/// Shuffles whole vectors of pixels, returns the number of bytes shuffled
+size_t ShuffleVectors(const u8* input, u8* output, size_t size, const std::array<u8, 16>& mask) {
+#if defined(ARCHITECTURE_x86_64)
+    static const bool has_ssse3{Common::GetCPUCaps().ssse3};
+    return has_ssse3 ? ShuffleSSSE3(input, output, size, mask) : 0;
+#elif defined(ARCHITECTURE_arm64)
+    return ShuffleNEON(input, output, size, mask);
+#else
+    return 0;
+#endif
+}
+
+std::unique_ptr<ByteShuffle> BuildByteShuffle(const ByteLayout& src, const ByteLayout& dst) {
+    if (src.bytes_per_pixel != dst.bytes_per_pixel) {
+        return nullptr;
+    }
+    std::array<u8, 16> pixel_mask{};
+    for (size_t dst_byte = 0; dst_byte < dst.bytes_per_pixel; dst_byte++) {
+        if (dst.bytes[dst_byte] == 0) {
+            pixel_mask[dst_byte] = 0x80;
+            continue;
+        }
+        const auto src_end = src.bytes.begin() + src.bytes_per_pixel;
+        const auto it = std::find(src.bytes.begin(), src_end, dst.bytes[dst_byte]);
+        if (it == src_end) {
+            return nullptr;
+        }
+        pixel_mask[dst_byte] = static_cast<u8>(std::distance(src.bytes.begin(), it));
+    }
+    return std::make_unique<ByteShuffle>(dst.bytes_per_pixel, pixel_mask);
+}
+
+} // namespace
+
+ByteShuffle::ByteShuffle(size_t bytes_per_pixel_, const std::array<u8, 16>& pixel_mask_)
+    : bytes_per_pixel{bytes_per_pixel_}, pixel_mask{pixel_mask_},
+      has_vector_mask{vector_mask.size() % bytes_per_pixel == 0} {
+    for (size_t i = 0; i < vector_mask.size(); i++) {
+        const size_t pixel_byte = i % bytes_per_pixel;
+        const u8 mask = pixel_mask[pixel_byte];
+        vector_mask[i] = (mask & 0x80) != 0 ? mask : static_cast<u8>(i - pixel_byte + mask);
+    }
+}
+
+void ByteShuffle::Shuffle(std::span<const u8> input, std::span<u8> output) const {
+    const size_t num_pixels = output.size() / bytes_per_pixel;
+    size_t pixel = 0;
+    if (has_vector_mask) {
+        pixel = ShuffleVectors(input.data(), output.data(), num_pixels * bytes_per_pixel,
+                               vector_mask) /
+                bytes_per_pixel;
+    }
+    // Finish the pixels left over from the vectors by bytes
+    for (; pixel < num_pixels; pixel++) {
+        std::array<u8, 16> in;
+        std::memcpy(in.data(), &input[pixel * bytes_per_pixel], bytes_per_pixel);
+        u8* const out = &output[pixel * bytes_per_pixel];
+        for (size_t byte = 0; byte < bytes_per_pixel; byte++) {
+            const u8 mask = pixel_mask[byte];
+            out[byte] = (mask & 0x80) != 0 ? 0 : in[mask];
+        }
+    }
+}
+
 struct ConverterFactory::ConverterFactoryImpl {
     std::unordered_map<RenderTargetFormat, std::unique_ptr<Converter>> converters_cache;
+    std::map<std::pair<RenderTargetFormat, RenderTargetFormat>, std::unique_ptr<ByteShuffle>>
+        byte_shuffles;
 };
 
 ConverterFactory::ConverterFactory() {
@@ -938,6 +1084,19 @@ Converter* ConverterFactory::GetFormatConverter(RenderTargetFormat format) {
     return it->second.get();
 }
 
+const ByteShuffle* ConverterFactory::GetByteShuffle(RenderTargetFormat src_format,
+                                                    RenderTargetFormat dst_format) {
+    const auto [it, is_new] = impl->byte_shuffles.try_emplace({src_format, dst_format});
+    if (is_new) [[unlikely]] {
+        const ByteLayout* const src_layout = GetFormatConverter(src_format)->GetByteLayout();
+        const ByteLayout* const dst_layout = GetFormatConverter(dst_format)->GetByteLayout();
+        if (src_layout && dst_layout) {
+            it->second = BuildByteShuffle(*src_layout, *dst_layout);
+        }
+    }
+    return it->second.get();
+}
+
 class NullConverter : public Converter {
 public:
     void ConvertTo([[maybe_unused]] std::span<const u8> input, std::span<f32> output) override {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 
@@ -12,13 +13,41 @@
 
 namespace Tegra::Engines::Blitter {
 
+/// Describes what each byte of a pixel holds, for formats made of whole byte components
+struct ByteLayout {
+    size_t bytes_per_pixel;
+    /// Type, size, channel and byte of the component each byte is part of, zero for unused bytes
+    std::array<u32, 16> bytes;
+};
+
 class Converter {
 public:
     virtual void ConvertTo(std::span<const u8> input, std::span<f32> output) = 0;
     virtual void ConvertFrom(std::span<const f32> input, std::span<u8> output) = 0;
+    virtual const ByteLayout* GetByteLayout() const {
+        return nullptr;
+    }
     virtual ~Converter() = default;
 };
 
+/// Converts pixels between formats that hold the same components in a different order by moving
+/// their bytes, exactly and without going through floats
+class ByteShuffle {
+public:
+    explicit ByteShuffle(size_t bytes_per_pixel_, const std::array<u8, 16>& pixel_mask_);
+
+    /// Input and output can be the same buffer
+    void Shuffle(std::span<const u8> input, std::span<u8> output) const;
+
+private:
+    size_t bytes_per_pixel;
+    /// Input byte of each byte of a pixel, 0x80 for bytes that are cleared
+    std::array<u8, 16> pixel_mask;
+    /// Pixel mask repeated over 16 bytes of pixels, when pixels evenly divide them
+    std::array<u8, 16> vector_mask;
+    bool has_vector_mask;
+};
+
 class ConverterFactory {
 public:
     ConverterFactory();
@@ -26,6 +55,11 @@ public:
 
     Converter* GetFormatConverter(RenderTargetFormat format);
 
+    /// Returns the byte shuffle between the formats, nullptr when they can not be converted by
+    /// moving bytes
+    const ByteShuffle* GetByteShuffle(RenderTargetFormat src_format,
+                                      RenderTargetFormat dst_format);
+
 private:
     Converter* BuildConverter(RenderTargetFormat format);
 
@@ -5,10 +5,17 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <ctime>
 #include <list>
 #include <memory>
+#include <utility>
+#include <vector>
+
+#include <fmt/chrono.h>
 
 #include "common/assert.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -18,6 +25,7 @@
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/perf_stats.h"
 #include "video_core/cdma_pusher.h"
+#include "video_core/command_trace.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/dma_pusher.h"
@@ -40,7 +48,11 @@ struct GPU::Impl {
     explicit Impl(GPU& gpu_, Core::System& system_, bool is_async_, bool use_nvdec_)
         : gpu{gpu_}, system{system_}, host1x{system.Host1x()}, use_nvdec{use_nvdec_},
           shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_},
-          gpu_thread{system_, is_async_}, scheduler{std::make_unique<Control::Scheduler>(gpu)} {}
+          gpu_thread{system_, is_async_}, scheduler{std::make_unique<Control::Scheduler>(gpu)} {
+        if (Settings::values.record_gpu_command_trace.GetValue()) {
+            CreateCommandTrace();
+        }
+    }
 
     ~Impl() = default;
 
@@ -75,6 +87,22 @@ struct GPU::Impl {
 
     void InitAddressSpace(Tegra::MemoryManager& memory_manager) {
         memory_manager.BindRasterizer(rasterizer);
+        memory_manager.BindCommandTrace(command_trace.get());
+    }
+
+    void CreateCommandTrace() {
+        const auto trace_dir =
+            Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir) / "gpu_traces";
+        if (!Common::FS::CreateDirs(trace_dir)) {
+            LOG_ERROR(HW_GPU, "Failed to create GPU command trace directory");
+            return;
+        }
+        const std::time_t t = std::time(nullptr);
+        const auto name = fmt::format("{:%F-%H-%M-%S}.ygpt", *std::localtime(&t));
+        command_trace = std::make_unique<CommandTraceWriter>(trace_dir / name);
+        if (!command_trace->IsOpen()) {
+            command_trace.reset();
+        }
     }
 
     void ReleaseChannel(Control::ChannelState& to_release) {
@@ -96,9 +124,13 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes(
-            [this](PAddr address, size_t size) { rasterizer->OnCacheInvalidation(address, size); });
-        system.GatherGPUDirtyMemory(callback_writes);
+        // This can be called from the GPU and the fence threads
+        thread_local std::vector<std::pair<PAddr, size_t>> dirty_ranges;
+        dirty_ranges.clear();
+        system.GatherGPUDirtyMemory(dirty_ranges);
+        if (!dirty_ranges.empty()) {
+            rasterizer->InnerCacheInvalidation(dirty_ranges);
+        }
     }
 
     /// Signal the ending of command list.
@@ -191,6 +223,10 @@ struct GPU::Impl {
         return *shader_notify;
     }
 
+    [[nodiscard]] CommandTraceWriter* CommandTrace() const {
+        return command_trace.get();
+    }
+
     /// Returns a const reference to the shader notifier.
     [[nodiscard]] const VideoCore::ShaderNotify& ShaderNotify() const {
         return *shader_notify;
@@ -199,7 +235,7 @@ struct GPU::Impl {
     [[nodiscard]] u64 GetTicks() const {
         u64 gpu_tick = system.CoreTiming().GetGPUTicks();
 
-        if (Settings::values.use_fast_gpu_time.GetValue()) {
+        if (Settings::GetHotValues().use_fast_gpu_time) {
             gpu_tick /= 256;
         }
 
@@ -260,10 +296,10 @@ struct GPU::Impl {
             cdma_pushers.insert_or_assign(id, std::make_unique<Tegra::CDmaPusher>(host1x));
         }
 
-        // SubmitCommandBuffer would make the nvdec operations async, this is not currently working
         // TODO(ameerj): RE proper async nvdec operation
-        // gpu_thread.SubmitCommandBuffer(std::move(entries));
-        cdma_pushers[id]->ProcessEntries(std::move(entries));
+        // Until then the submissions of a channel run in order on its pusher's own thread, and the
+        // guest keeps running until it waits on the returned syncpoint fences.
+        cdma_pushers[id]->PushEntries(std::move(entries));
     }
 
     /// Frees the CDMAPusher instance to free up resources
@@ -370,6 +406,8 @@ struct GPU::Impl {
     s32 new_channel_id{1};
     /// Shader build notifier
     std::unique_ptr<VideoCore::ShaderNotify> shader_notify;
+    /// Command stream capture, only present when record_gpu_command_trace is enabled
+    std::unique_ptr<CommandTraceWriter> command_trace;
     /// When true, we are about to shut down emulation session, so terminate outstanding tasks
     std::atomic_bool shutting_down{};
 
@@ -507,6 +545,10 @@ VideoCore::ShaderNotify& GPU::ShaderNotify() {
     return impl->ShaderNotify();
 }
 
+CommandTraceWriter* GPU::CommandTrace() const {
+    return impl->CommandTrace();
+}
+
 const VideoCore::ShaderNotify& GPU::ShaderNotify() const {
     return impl->ShaderNotify();
 }
@@ -130,6 +130,7 @@ namespace Host1x {
 class Host1x;
 } // namespace Host1x
 
+class CommandTraceWriter;
 class MemoryManager;
 
 class GPU final {
@@ -204,6 +205,9 @@ public:
     /// Returns a const reference to the shader notifier.
     [[nodiscard]] const VideoCore::ShaderNotify& ShaderNotify() const;
 
+    /// Returns the command stream capture, or nullptr when recording is disabled.
+    [[nodiscard]] CommandTraceWriter* CommandTrace() const;
+
     [[nodiscard]] u64 GetTicks() const;
 
     [[nodiscard]] bool IsAsync() const;
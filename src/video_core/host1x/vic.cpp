@@ -19,6 +19,7 @@ extern "C" {
 #include "common/logging/log.h"
 
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/nvdec.h"
 #include "video_core/host1x/vic.h"
@@ -138,14 +139,7 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         scaler_height = frame_height;
         converted_frame_buffer.reset();
     }
-    if (!converted_frame_buffer) {
-        const size_t frame_size = frame_width * frame_height * 4;
-        converted_frame_buffer = AVMallocPtr{static_cast<u8*>(av_malloc(frame_size)), av_free};
-    }
     const std::array<int, 4> converted_stride{frame_width * 4, frame_height * 4, 0, 0};
-    u8* const converted_frame_buf_addr{converted_frame_buffer.get()};
-    sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
-              &converted_frame_buf_addr, converted_stride.data());
 
     // Use the minimum of surface/frame dimensions to avoid buffer overflow.
     const u32 surface_width = static_cast<u32>(config.surface_width_minus1) + 1;
@@ -153,16 +147,38 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     const u32 width = std::min(surface_width, static_cast<u32>(frame_width));
     const u32 height = std::min(surface_height, static_cast<u32>(frame_height));
     const u32 blk_kind = static_cast<u32>(config.block_linear_kind);
+    if (blk_kind == 0 && width == static_cast<u32>(frame_width) &&
+        height == static_cast<u32>(frame_height)) {
+        // The whole frame fits in the pitch linear surface, convert it straight into guest memory
+        const size_t linear_size = width * height * 4;
+        luma_buffer.resize_destructive(linear_size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), output_surface_luma_address, linear_size, &luma_buffer);
+        u8* const surface_addr{surface.data()};
+        sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
+                  &surface_addr, converted_stride.data());
+        return;
+    }
+
+    if (!converted_frame_buffer) {
+        const size_t frame_size = frame_width * frame_height * 4;
+        converted_frame_buffer = AVMallocPtr{static_cast<u8*>(av_malloc(frame_size)), av_free};
+    }
+    u8* const converted_frame_buf_addr{converted_frame_buffer.get()};
+    sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
+              &converted_frame_buf_addr, converted_stride.data());
+
     if (blk_kind != 0) {
-        // swizzle pitch linear to block linear
+        // swizzle pitch linear to block linear, straight into guest memory. This is a whole
+        // surface swizzle, which copies GOB rows in 16 byte columns and splits large frames
+        // across the texture workers.
         const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
         const auto size = Texture::CalculateSize(true, 4, width, height, 1, block_height, 0);
         luma_buffer.resize_destructive(size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), output_surface_luma_address, size, &luma_buffer);
         std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * width * height);
-        Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0, 0, width, height,
-                                block_height, 0, width * 4);
-
-        host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), size);
+        Texture::SwizzleTexture(surface, frame_buff, 4, width, height, 1, block_height, 0, 0);
     } else {
         // send pitch linear frame
         const size_t linear_size = width * height * 4;
@@ -183,17 +199,22 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
 
     const auto stride = static_cast<size_t>(frame->GetStride(0));
 
+    // The planes are written straight into guest memory, the scratch buffers only back them when
+    // the surfaces aren't contiguous in host memory.
     luma_buffer.resize_destructive(aligned_width * surface_height);
     chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
+    Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite> luma(
+        host1x.GMMU(), output_surface_luma_address, luma_buffer.size(), &luma_buffer);
+    Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite> chroma(
+        host1x.GMMU(), output_surface_chroma_address, chroma_buffer.size(), &chroma_buffer);
 
     // Populate luma buffer
     const u8* luma_src = frame->GetData(0);
     for (std::size_t y = 0; y < frame_height; ++y) {
         const std::size_t src = y * stride;
         const std::size_t dst = y * aligned_width;
-        std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
+        std::memcpy(luma.data() + dst, luma_src + src, frame_width);
     }
-    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
 
     // Chroma
     const std::size_t half_height = frame_height / 2;
@@ -204,7 +225,7 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         // Frame from FFmpeg software
         // Populate chroma buffer from both channels with interleaving.
         const std::size_t half_width = frame_width / 2;
-        u8* chroma_buffer_data = chroma_buffer.data();
+        u8* chroma_buffer_data = chroma.data();
         const u8* chroma_b_src = frame->GetData(1);
         const u8* chroma_r_src = frame->GetData(2);
         for (std::size_t y = 0; y < half_height; ++y) {
@@ -224,7 +245,7 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         for (std::size_t y = 0; y < half_height; ++y) {
             const std::size_t src = y * stride;
             const std::size_t dst = y * aligned_width;
-            std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+            std::memcpy(chroma.data() + dst, chroma_src + src, frame_width);
         }
         break;
     }
@@ -232,8 +253,6 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         ASSERT(false);
         break;
     }
-    host1x.GMMU().WriteBlock(output_surface_chroma_address, chroma_buffer.data(),
-                             chroma_buffer.size());
 }
 
 } // namespace Host1x
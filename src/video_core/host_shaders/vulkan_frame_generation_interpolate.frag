@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Synthesizes the frame halfway between the previous frame and the current one by moving both
+// along half of the estimated motion and blending them.
+
+#version 460
+
+layout (location = 0) in vec2 texcoord;
+
+layout (location = 0) out vec4 color;
+
+layout (binding = 0) uniform sampler2D previous_frame;
+layout (binding = 1) uniform sampler2D current_frame;
+layout (binding = 2) uniform sampler2D motion_field;
+
+void main() {
+    vec2 texel_size = 1.0 / vec2(textureSize(current_frame, 0));
+
+    // Motion in pixels, filtered between the blocks it was estimated on
+    vec2 half_motion = 0.5 * textureLod(motion_field, texcoord, 0.0).xy * texel_size;
+    vec4 previous = textureLod(previous_frame, texcoord - half_motion, 0.0);
+    vec4 current = textureLod(current_frame, texcoord + half_motion, 0.0);
+
+    // Where the moved frames disagree the motion is wrong or the area is only visible in one of
+    // them, the current frame is shown there instead of a ghosted blend
+    float mismatch = distance(previous.rgb, current.rgb);
+    float previous_weight = 0.5 * (1.0 - smoothstep(0.1, 0.3, mismatch));
+    color = mix(current, previous, previous_weight);
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Estimates how every block of the frame moved from the previous frame to the current one by
+// block matching on luma, searching coarsely first and refining around the best match.
+// Every fragment of the output covers one block of the frames.
+
+#version 460
+
+layout (location = 0) in vec2 texcoord;
+
+layout (location = 0) out vec4 motion;
+
+layout (binding = 0) uniform sampler2D previous_frame;
+layout (binding = 1) uniform sampler2D current_frame;
+
+// Must match FrameGeneration::BLOCK_SIZE
+const float BLOCK_SIZE = 16.0;
+// Samples per axis compared in every block
+const int BLOCK_SAMPLES = 4;
+const int COARSE_RADIUS = 6;
+const float COARSE_STEP = 4.0;
+const int FINE_RADIUS = 2;
+// Still blocks are the most common, so they are preferred over similarly good matches
+const float STILL_BIAS = 0.9;
+
+float Luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+float BlockCost(vec2 origin, vec2 offset, vec2 texel_size) {
+    float cost = 0.0;
+    for (int y = 0; y < BLOCK_SAMPLES; ++y) {
+        for (int x = 0; x < BLOCK_SAMPLES; ++x) {
+            vec2 position = origin + (vec2(x, y) + 0.5) * (BLOCK_SIZE / BLOCK_SAMPLES);
+            float previous =
+                Luma(textureLod(previous_frame, position * texel_size, 0.0).rgb);
+            float current =
+                Luma(textureLod(current_frame, (position + offset) * texel_size, 0.0).rgb);
+            cost += abs(previous - current);
+        }
+    }
+    return cost;
+}
+
+void main() {
+    vec2 texel_size = 1.0 / vec2(textureSize(previous_frame, 0));
+    vec2 origin = floor(gl_FragCoord.xy) * BLOCK_SIZE;
+
+    vec2 best_offset = vec2(0.0);
+    float best_cost = BlockCost(origin, best_offset, texel_size) * STILL_BIAS;
+    for (int y = -COARSE_RADIUS; y <= COARSE_RADIUS; ++y) {
+        for (int x = -COARSE_RADIUS; x <= COARSE_RADIUS; ++x) {
+            vec2 offset = vec2(x, y) * COARSE_STEP;
+            float cost = BlockCost(origin, offset, texel_size);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_offset = offset;
+            }
+        }
+    }
+
+    vec2 coarse_offset = best_offset;
+    for (int y = -FINE_RADIUS; y <= FINE_RADIUS; ++y) {
+        for (int x = -FINE_RADIUS; x <= FINE_RADIUS; ++x) {
+            vec2 offset = coarse_offset + vec2(x, y);
+            float cost = BlockCost(origin, offset, texel_size);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_offset = offset;
+            }
+        }
+    }
+
+    motion = vec4(best_offset, best_cost / float(BLOCK_SAMPLES * BLOCK_SAMPLES), 0.0);
+}
@@ -1,10 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <optional>
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "common/container_hash.h"
 
@@ -22,6 +27,9 @@
 #ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
 #endif
+#ifdef ARCHITECTURE_arm64
+#include "video_core/macro/macro_jit_arm64.h"
+#endif
 
 MICROPROFILE_DEFINE(MacroHLE, "GPU", "Execute macro HLE", MP_RGB(128, 192, 192));
 
@@ -57,7 +65,11 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d_)
     : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    if (!macro_profiles.empty()) {
+        DumpProfiles();
+    }
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -76,8 +88,7 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
             MICROPROFILE_SCOPE(MacroHLE);
             cache_info.hle_program->Execute(parameters, method);
         } else {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
+            ExecuteLLE(cache_info, parameters, method);
         }
     } else {
         // Macro not compiled, check if it's uploaded and if so, compile it
@@ -113,8 +124,11 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
 
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
         if (!hle_program || Settings::values.disable_macro_hle) {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
+            if (Settings::values.profile_macros) {
+                macro_profiles[cache_info.hash].code_size =
+                    uploaded_macro_code[method].size();
+            }
+            ExecuteLLE(cache_info, parameters, method);
         } else {
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program);
@@ -128,12 +142,63 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     }
 }
 
+void MacroEngine::ExecuteLLE(const CacheInfo& cache_info, const std::vector<u32>& parameters,
+                             u32 method) {
+    maxwell3d.RefreshParameters();
+    if (!Settings::values.profile_macros) {
+        cache_info.lle_program->Execute(parameters, method);
+        return;
+    }
+    const auto start{std::chrono::steady_clock::now()};
+    cache_info.lle_program->Execute(parameters, method);
+    const auto elapsed{std::chrono::steady_clock::now() - start};
+
+    auto& profile{macro_profiles[cache_info.hash]};
+    ++profile.call_count;
+    profile.execution_time_ns += static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void MacroEngine::DumpProfiles() const {
+    const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+    const auto macro_dir{base_dir / "macros"};
+    if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(macro_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create macro dump directories");
+        return;
+    }
+    std::vector<std::pair<u64, MacroProfile>> profiles(macro_profiles.begin(),
+                                                       macro_profiles.end());
+    std::ranges::sort(profiles, std::ranges::greater{},
+                      [](const auto& profile) { return profile.second.execution_time_ns; });
+
+    const auto name{macro_dir / "macro_profile.txt"};
+    std::ofstream profile_file(name, std::ios::out | std::ios::trunc);
+    if (!profile_file) {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}",
+                  Common::FS::PathToUTF8String(name));
+        return;
+    }
+    profile_file << "hash             calls      total_us   avg_ns     code_size\n";
+    for (const auto& [hash, profile] : profiles) {
+        const u64 average_ns{profile.call_count != 0
+                                 ? profile.execution_time_ns / profile.call_count
+                                 : 0};
+        profile_file << fmt::format("{:016x} {:<10} {:<10} {:<10} {}\n", hash, profile.call_count,
+                                    profile.execution_time_ns / 1000, average_ns,
+                                    profile.code_size);
+    }
+    LOG_INFO(HW_GPU, "Wrote {} macro profiles to {}", profiles.size(),
+             Common::FS::PathToUTF8String(name));
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
     }
 #ifdef ARCHITECTURE_x86_64
     return std::make_unique<MacroJITx64>(maxwell3d);
+#elif defined(ARCHITECTURE_arm64)
+    return std::make_unique<MacroJITArm64>(maxwell3d);
 #else
     return std::make_unique<MacroInterpreter>(maxwell3d);
 #endif
@@ -134,6 +134,20 @@ private:
         bool has_hle_program{};
     };
 
+    /// Execution statistics of a macro without an HLE implementation
+    struct MacroProfile {
+        u64 call_count{};
+        u64 execution_time_ns{};
+        size_t code_size{};
+    };
+
+    void ExecuteLLE(const CacheInfo& cache_info, const std::vector<u32>& parameters, u32 method);
+
+    /// Writes the collected macro profiles to the dump directory, slowest macros first
+    void DumpProfiles() const;
+
+    std::unordered_map<u64, MacroProfile> macro_profiles;
+
     std::unordered_map<u32, CacheInfo> macro_cache;
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
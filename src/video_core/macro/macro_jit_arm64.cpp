@@ -0,0 +1,572 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <oaknut/code_block.hpp>
+#include <oaknut/oaknut.hpp>
+
+#include "common/assert.h"
+#include "common/bit_field.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_jit_arm64.h"
+
+MICROPROFILE_DEFINE(MacroJitCompile, "GPU", "Compile macro JIT", MP_RGB(173, 255, 47));
+MICROPROFILE_DEFINE(MacroJitExecute, "GPU", "Execute macro JIT", MP_RGB(255, 255, 0));
+
+namespace Tegra {
+namespace {
+using namespace oaknut::util;
+
+// All persistent state lives in callee saved registers, so host calls don't have to spill it.
+constexpr oaknut::XReg STATE{19};
+constexpr oaknut::WReg RESULT{20};
+constexpr oaknut::XReg MAX_PARAMETER{21};
+constexpr oaknut::XReg PARAMETERS{22};
+constexpr oaknut::WReg METHOD_ADDRESS{23};
+constexpr oaknut::XReg BRANCH_HOLDER{24};
+constexpr oaknut::WReg CARRY_FLAG{25};
+constexpr oaknut::XReg REGISTER_FILE{26};
+
+// Generous upper bound for the host instructions emitted by a single macro instruction.
+constexpr size_t MAX_HOST_INSTRUCTIONS_PER_OPCODE = 64;
+constexpr size_t PROLOGUE_EPILOGUE_SIZE = 64;
+
+constexpr size_t CodeSize(size_t num_opcodes) {
+    return (num_opcodes * MAX_HOST_INSTRUCTIONS_PER_OPCODE + PROLOGUE_EPILOGUE_SIZE) * sizeof(u32);
+}
+
+void Send(Engines::Maxwell3D* maxwell3d, u32 raw_method_address, u32 value) {
+    Macro::MethodAddress method_address{};
+    method_address.raw = raw_method_address;
+    maxwell3d->CallMethod(method_address.address, value, true);
+}
+
+void WarnInvalidParameter(uintptr_t parameter, uintptr_t max_parameter) {
+    LOG_CRITICAL(HW_GPU,
+                 "Macro JIT: invalid parameter access 0x{:x} (0x{:x} is the last parameter)",
+                 parameter, max_parameter - sizeof(u32));
+}
+
+class MacroJITArm64Impl final : public CachedMacro {
+public:
+    explicit MacroJITArm64Impl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
+        : code_block{CodeSize(code_.size())}, c{code_block.ptr()}, code{code_},
+          maxwell3d{maxwell3d_} {
+        Compile();
+    }
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override;
+
+    void Compile_ALU(Macro::Opcode opcode);
+    void Compile_AddImmediate(Macro::Opcode opcode);
+    void Compile_ExtractInsert(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftRegister(Macro::Opcode opcode);
+    void Compile_Read(Macro::Opcode opcode);
+    void Compile_Branch(Macro::Opcode opcode);
+
+private:
+    void Optimizer_ScanFlags();
+
+    void Compile();
+    void Compile_NextInstruction();
+
+    oaknut::WReg Compile_FetchParameter();
+    oaknut::WReg Compile_GetRegister(u32 index, oaknut::WReg dst);
+    void Compile_AddRegisterImmediate(u32 index, s32 immediate);
+
+    void Compile_ProcessResult(Macro::ResultOperation operation, u32 reg);
+    void Compile_Send(oaknut::WReg value);
+
+    template <typename Func>
+    void Compile_CallFarFunction(Func* func);
+
+    Macro::Opcode GetOpCode() const;
+
+    struct JITState {
+        Engines::Maxwell3D* maxwell3d{};
+        std::array<u32, Macro::NUM_MACRO_REGISTERS> registers{};
+    };
+    static_assert(offsetof(JITState, maxwell3d) == 0, "Maxwell3D is not at 0x0");
+    using ProgramType = void (*)(JITState*, const u32*, const u32*);
+
+    struct OptimizerState {
+        bool can_skip_carry{};
+        bool has_delayed_pc{};
+        bool skip_dummy_addimmediate{};
+        bool optimize_for_method_move{};
+    };
+    OptimizerState optimizer{};
+
+    std::optional<Macro::Opcode> next_opcode{};
+    ProgramType program{nullptr};
+
+    oaknut::CodeBlock code_block;
+    oaknut::CodeGenerator c;
+
+    std::vector<oaknut::Label> labels;
+    std::vector<oaknut::Label> delay_skip;
+    oaknut::Label end_of_code{};
+
+    bool is_delay_slot{};
+    u32 pc{};
+
+    const std::vector<u32>& code;
+    Engines::Maxwell3D& maxwell3d;
+};
+
+void MacroJITArm64Impl::Execute(const std::vector<u32>& parameters, u32 method) {
+    MICROPROFILE_SCOPE(MacroJitExecute);
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    JITState state{};
+    state.maxwell3d = &maxwell3d;
+    state.registers = {};
+    program(&state, parameters.data(), parameters.data() + parameters.size());
+}
+
+void MacroJITArm64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const oaknut::WReg src_a = Compile_GetRegister(opcode.src_a, RESULT);
+    const oaknut::WReg src_b = Compile_GetRegister(opcode.src_b, W1);
+
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        if (optimizer.can_skip_carry) {
+            c.ADD(RESULT, src_a, src_b);
+        } else {
+            c.ADDS(RESULT, src_a, src_b);
+            c.CSET(CARRY_FLAG, oaknut::Cond::CS);
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        // Move the carry flag into the host C flag
+        c.CMP(CARRY_FLAG, 1);
+        c.ADCS(RESULT, src_a, src_b);
+        c.CSET(CARRY_FLAG, oaknut::Cond::CS);
+        break;
+    case Macro::ALUOperation::Subtract:
+        // The host C flag matches the macro carry flag, it is set when there is no borrow
+        if (optimizer.can_skip_carry) {
+            c.SUB(RESULT, src_a, src_b);
+        } else {
+            c.SUBS(RESULT, src_a, src_b);
+            c.CSET(CARRY_FLAG, oaknut::Cond::CS);
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        c.CMP(CARRY_FLAG, 1);
+        c.SBCS(RESULT, src_a, src_b);
+        c.CSET(CARRY_FLAG, oaknut::Cond::CS);
+        break;
+    case Macro::ALUOperation::Xor:
+        c.EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        c.ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        c.AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        c.BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        c.AND(RESULT, src_a, src_b);
+        c.MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    if (optimizer.skip_dummy_addimmediate) {
+        // Games tend to use this as an exit instruction placeholder. It's to encode an instruction
+        // without doing anything. In our case we can just not emit anything.
+        if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+            return;
+        }
+    }
+    // Check for redundant moves
+    if (optimizer.optimize_for_method_move &&
+        opcode.result_operation == Macro::ResultOperation::MoveAndSetMethod) {
+        if (next_opcode.has_value()) {
+            const auto next = *next_opcode;
+            if (next.result_operation == Macro::ResultOperation::MoveAndSetMethod &&
+                opcode.dst == next.dst) {
+                return;
+            }
+        }
+    }
+    Compile_AddRegisterImmediate(opcode.src_a, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, RESULT);
+    Compile_GetRegister(opcode.src_b, W1);
+
+    c.MOV(W2, ~(opcode.GetBitfieldMask() << opcode.bf_dst_bit));
+    c.AND(RESULT, RESULT, W2);
+    c.LSR(W1, W1, opcode.bf_src_bit.Value());
+    c.MOV(W2, opcode.GetBitfieldMask());
+    c.AND(W1, W1, W2);
+    c.LSL(W1, W1, opcode.bf_dst_bit.Value());
+    c.ORR(RESULT, RESULT, W1);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, W1);
+    Compile_GetRegister(opcode.src_b, RESULT);
+
+    c.LSRV(RESULT, RESULT, W1);
+    c.MOV(W2, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, W2);
+    c.LSL(RESULT, RESULT, opcode.bf_dst_bit.Value());
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, W1);
+    Compile_GetRegister(opcode.src_b, RESULT);
+
+    c.LSR(RESULT, RESULT, opcode.bf_src_bit.Value());
+    c.MOV(W2, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, W2);
+    c.LSLV(RESULT, RESULT, W1);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_AddRegisterImmediate(opcode.src_a, opcode.immediate);
+
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue:
+    c.LDR(RESULT, REGISTER_FILE, RESULT, oaknut::IndexExt::UXTW, 2);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Send(oaknut::WReg value) {
+    c.MOV(W2, value);
+    c.MOV(W1, METHOD_ADDRESS);
+    c.LDR(X0, STATE, offsetof(JITState, maxwell3d));
+    Compile_CallFarFunction(&Send);
+
+    // Increment the method address by the method increment, the increment itself is kept
+    c.UBFX(W0, METHOD_ADDRESS, 12, 6);
+    c.ADD(W0, METHOD_ADDRESS, W0);
+    c.BFI(METHOD_ADDRESS, W0, 0, 12);
+}
+
+void MacroJITArm64Impl::Compile_Branch(Macro::Opcode opcode) {
+    ASSERT_MSG(!is_delay_slot, "Executing a branch in a delay slot is not valid");
+    const s32 jump_address =
+        static_cast<s32>(pc) + static_cast<s32>(opcode.GetBranchTarget() / sizeof(s32));
+    ASSERT(jump_address >= 0 && static_cast<size_t>(jump_address) < labels.size());
+    oaknut::Label& target = labels[jump_address];
+
+    const oaknut::WReg value = Compile_GetRegister(opcode.src_a, W0);
+    if (optimizer.has_delayed_pc) {
+        oaknut::Label end;
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            c.CBNZ(value, end);
+            break;
+        case Macro::BranchCondition::NotZero:
+            c.CBZ(value, end);
+            break;
+        }
+
+        if (opcode.branch_annul) {
+            c.MOV(BRANCH_HOLDER, 0);
+            c.B(target);
+        } else {
+            oaknut::Label handle_post_exit{};
+            oaknut::Label skip{};
+            c.B(skip);
+
+            c.l(handle_post_exit);
+            c.MOV(BRANCH_HOLDER, 0);
+            c.B(target);
+
+            // Execute the delay slot first, it jumps to handle_post_exit when it finishes
+            c.l(skip);
+            c.ADR(BRANCH_HOLDER, handle_post_exit);
+            c.B(delay_skip[pc]);
+        }
+        c.l(end);
+    } else {
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            c.CBZ(value, target);
+            break;
+        case Macro::BranchCondition::NotZero:
+            c.CBNZ(value, target);
+            break;
+        }
+    }
+}
+
+void MacroJITArm64Impl::Optimizer_ScanFlags() {
+    optimizer.can_skip_carry = true;
+    optimizer.has_delayed_pc = false;
+    for (auto raw_op : code) {
+        Macro::Opcode op{};
+        op.raw = raw_op;
+
+        if (op.operation == Macro::Operation::ALU) {
+            // Scan for any ALU operations which actually use the carry flag, if they don't exist in
+            // our current code we can skip emitting the carry flag handling operations
+            if (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+                optimizer.can_skip_carry = false;
+            }
+        }
+
+        if (op.operation == Macro::Operation::Branch) {
+            if (!op.branch_annul) {
+                optimizer.has_delayed_pc = true;
+            }
+        }
+    }
+}
+
+void MacroJITArm64Impl::Compile() {
+    MICROPROFILE_SCOPE(MacroJitCompile);
+    labels.resize(code.size() + 1);
+    delay_skip.resize(code.size());
+
+    code_block.unprotect();
+    program = reinterpret_cast<ProgramType>(code_block.ptr());
+
+    c.STP(X29, X30, SP, PRE_INDEXED, -80);
+    c.STP(X19, X20, SP, 16);
+    c.STP(X21, X22, SP, 32);
+    c.STP(X23, X24, SP, 48);
+    c.STP(X25, X26, SP, 64);
+
+    // JIT state
+    c.MOV(STATE, X0);
+    c.MOV(PARAMETERS, X1);
+    c.MOV(MAX_PARAMETER, X2);
+    c.MOV(RESULT, 0);
+    c.MOV(METHOD_ADDRESS, 0);
+    c.MOV(BRANCH_HOLDER, 0);
+    c.MOV(CARRY_FLAG, 0);
+    c.MOV(REGISTER_FILE, reinterpret_cast<u64>(maxwell3d.regs.reg_array.data()));
+
+    c.STR(Compile_FetchParameter(), STATE, offsetof(JITState, registers) + 4);
+
+    // AddImmediate tends to be used as a NOP instruction, if we detect this we can
+    // completely skip the entire code path and no emit anything
+    optimizer.skip_dummy_addimmediate = true;
+
+    // SMO tends to emit a lot of unnecessary method moves, we can mitigate this by only emitting
+    // one if our register isn't "dirty"
+    optimizer.optimize_for_method_move = true;
+
+    // Check to see if we can skip emitting certain instructions
+    Optimizer_ScanFlags();
+
+    const u32 op_count = static_cast<u32>(code.size());
+    for (u32 i = 0; i < op_count; i++) {
+        if (i < op_count - 1) {
+            pc = i + 1;
+            next_opcode = GetOpCode();
+        } else {
+            next_opcode = {};
+        }
+        pc = i;
+        Compile_NextInstruction();
+    }
+
+    // A delay slot past the end of the code just exits
+    c.l(labels[op_count]);
+    c.l(end_of_code);
+
+    c.LDP(X25, X26, SP, 64);
+    c.LDP(X23, X24, SP, 48);
+    c.LDP(X21, X22, SP, 32);
+    c.LDP(X19, X20, SP, 16);
+    c.LDP(X29, X30, SP, POST_INDEXED, 80);
+    c.RET();
+
+    code_block.protect();
+    code_block.invalidate_all();
+}
+
+void MacroJITArm64Impl::Compile_NextInstruction() {
+    const auto opcode = GetOpCode();
+    c.l(labels[pc]);
+
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        Compile_Branch(opcode);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+
+    if (optimizer.has_delayed_pc) {
+        if (opcode.is_exit) {
+            // An exit inside a delay slot is ignored, otherwise run the delay slot and exit
+            oaknut::Label in_delay_slot{};
+            c.CBNZ(BRANCH_HOLDER, in_delay_slot);
+            c.ADR(BRANCH_HOLDER, end_of_code);
+            c.B(labels[pc + 1]);
+            c.l(in_delay_slot);
+        }
+        oaknut::Label no_delay_slot{};
+        c.CBZ(BRANCH_HOLDER, no_delay_slot);
+        c.MOV(X0, BRANCH_HOLDER);
+        c.MOV(BRANCH_HOLDER, 0);
+        c.BR(X0);
+        c.l(no_delay_slot);
+        c.l(delay_skip[pc]);
+    } else {
+        c.CBNZ(BRANCH_HOLDER, end_of_code);
+        if (opcode.is_exit) {
+            c.MOV(BRANCH_HOLDER, 1);
+        }
+    }
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_FetchParameter() {
+    oaknut::Label parameter_ok{};
+    c.CMP(PARAMETERS, MAX_PARAMETER);
+    c.B(oaknut::Cond::LO, parameter_ok);
+    c.MOV(X0, PARAMETERS);
+    c.MOV(X1, MAX_PARAMETER);
+    Compile_CallFarFunction(&WarnInvalidParameter);
+    c.l(parameter_ok);
+    c.LDR(W0, PARAMETERS, POST_INDEXED, 4);
+    return W0;
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_GetRegister(u32 index, oaknut::WReg dst) {
+    if (index == 0) {
+        // Register 0 is always zero
+        c.MOV(dst, 0);
+    } else {
+        c.LDR(dst, STATE, offsetof(JITState, registers) + index * sizeof(u32));
+    }
+    return dst;
+}
+
+void MacroJITArm64Impl::Compile_AddRegisterImmediate(u32 index, s32 immediate) {
+    if (index == 0) {
+        c.MOV(RESULT, static_cast<u32>(immediate));
+        return;
+    }
+    Compile_GetRegister(index, RESULT);
+    if (immediate != 0) {
+        c.MOV(W1, static_cast<u32>(immediate));
+        c.ADD(RESULT, RESULT, W1);
+    }
+}
+
+template <typename Func>
+void MacroJITArm64Impl::Compile_CallFarFunction(Func* func) {
+    // X16 is an intra-procedure-call scratch register, it is free to clobber here
+    c.MOV(X16, reinterpret_cast<u64>(func));
+    c.BLR(X16);
+}
+
+void MacroJITArm64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    const auto SetRegister = [this](u32 reg_index, oaknut::WReg result) {
+        // Register 0 is supposed to always return 0. NOP is implemented as a store to the zero
+        // register.
+        if (reg_index == 0) {
+            return;
+        }
+        c.STR(result, STATE, offsetof(JITState, registers) + reg_index * sizeof(u32));
+    };
+    const auto SetMethodAddress = [this](oaknut::WReg reg32) { c.MOV(METHOD_ADDRESS, reg32); };
+
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        // Fetch parameter and send result.
+        SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        // Move and send result.
+        SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        // Fetch parameter and use result as Method Address.
+        SetRegister(reg, Compile_FetchParameter());
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        // Move result and use as Method Address, then fetch and send parameter.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        // Move result and use as Method Address, then send bits 12:17 of result.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        c.UBFX(RESULT, RESULT, 12, 6);
+        Compile_Send(RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+        break;
+    }
+}
+
+Macro::Opcode MacroJITArm64Impl::GetOpCode() const {
+    ASSERT(pc < code.size());
+    return {code[pc]};
+}
+} // Anonymous namespace
+
+MacroJITArm64::MacroJITArm64(Engines::Maxwell3D& maxwell3d_)
+    : MacroEngine{maxwell3d_}, maxwell3d{maxwell3d_} {}
+
+std::unique_ptr<CachedMacro> MacroJITArm64::Compile(const std::vector<u32>& code) {
+    return std::make_unique<MacroJITArm64Impl>(maxwell3d, code);
+}
+} // namespace Tegra
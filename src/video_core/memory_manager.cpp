@@ -9,6 +9,7 @@
 #include "core/core.h"
 #include "core/hle/kernel/k_page_table.h"
 #include "core/hle/kernel/k_process.h"
+#include "video_core/command_trace.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/invalidation_accumulator.h"
@@ -118,7 +119,7 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
         [[maybe_unused]] const auto current_entry_type = GetEntry<false>(current_gpu_addr);
         SetEntry<false>(current_gpu_addr, entry_type);
         if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, page_size);
+            AddModifiedRange(current_gpu_addr, page_size);
         }
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
@@ -128,6 +129,7 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
         }
         remaining_size -= page_size;
     }
+    FlushModifiedRanges();
     kind_map.Map(gpu_addr, gpu_addr + size, kind);
     return gpu_addr;
 }
@@ -141,7 +143,7 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
         [[maybe_unused]] const auto current_entry_type = GetEntry<true>(current_gpu_addr);
         SetEntry<true>(current_gpu_addr, entry_type);
         if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, big_page_size);
+            AddModifiedRange(current_gpu_addr, big_page_size);
         }
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
@@ -168,6 +170,7 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
         }
         remaining_size -= big_page_size;
     }
+    FlushModifiedRanges();
     {
         std::unique_lock<std::mutex> lock(guard);
         kind_map.Map(gpu_addr, gpu_addr + size, kind);
@@ -175,12 +178,78 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
     return gpu_addr;
 }
 
+void MemoryManager::AddModifiedRange(GPUVAddr gpu_addr, u64 size) {
+    if (!modified_ranges.empty()) {
+        auto& [last_addr, last_size] = modified_ranges.back();
+        if (last_addr + last_size == gpu_addr) {
+            last_size += size;
+            return;
+        }
+    }
+    modified_ranges.emplace_back(gpu_addr, size);
+}
+
+void MemoryManager::FlushModifiedRanges() {
+    if (map_batch_depth != 0) {
+        return;
+    }
+    for (const auto& [gpu_addr, size] : modified_ranges) {
+        rasterizer->ModifyGPUMemory(unique_identifier, gpu_addr, size);
+    }
+    modified_ranges.clear();
+}
+
+void MemoryManager::BeginMapBatch() {
+    ++map_batch_depth;
+}
+
+void MemoryManager::EndMapBatch() {
+    ASSERT(map_batch_depth != 0);
+    if (--map_batch_depth != 0) {
+        return;
+    }
+    // Operations of a batch may touch the same or neighbouring ranges in any order
+    std::ranges::sort(modified_ranges);
+    size_t merged = 0;
+    for (size_t i = 1; i < modified_ranges.size(); ++i) {
+        auto& [merged_addr, merged_size] = modified_ranges[merged];
+        const auto [addr, size] = modified_ranges[i];
+        if (addr <= merged_addr + merged_size) {
+            merged_size = std::max(merged_size, addr + size - merged_addr);
+        } else {
+            modified_ranges[++merged] = modified_ranges[i];
+        }
+    }
+    if (!modified_ranges.empty()) {
+        modified_ranges.resize(merged + 1);
+    }
+    FlushModifiedRanges();
+}
+
 void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_) {
     rasterizer = rasterizer_;
 }
 
+void MemoryManager::BindCommandTrace(CommandTraceWriter* command_trace_) {
+    command_trace = command_trace_;
+    if (!command_trace) {
+        return;
+    }
+    command_trace->RecordAddressSpace({
+        .id = unique_identifier,
+        .address_space_bits = address_space_bits,
+        .split_address = split_address,
+        .big_page_bits = big_page_bits,
+        .page_bits = page_bits,
+    });
+}
+
 GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size, PTEKind kind,
                             bool is_big_pages) {
+    if (command_trace) [[unlikely]] {
+        command_trace->RecordMap(unique_identifier, gpu_addr, dev_addr, size, kind, is_big_pages,
+                                 false);
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Mapped>(gpu_addr, dev_addr, size, kind);
     }
@@ -188,6 +257,10 @@ GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size,
 }
 
 GPUVAddr MemoryManager::MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages) {
+    if (command_trace) [[unlikely]] {
+        command_trace->RecordMap(unique_identifier, gpu_addr, 0, size, PTEKind::INVALID,
+                                 is_big_pages, true);
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Reserved>(gpu_addr, 0, size, PTEKind::INVALID);
     }
@@ -198,6 +271,9 @@ void MemoryManager::Unmap(GPUVAddr gpu_addr, std::size_t size) {
     if (size == 0) {
         return;
     }
+    if (command_trace) [[unlikely]] {
+        command_trace->RecordUnmap(unique_identifier, gpu_addr, size);
+    }
     GetSubmappedRangeImpl<false>(gpu_addr, size, page_stash);
 
     for (const auto& [map_addr, map_size] : page_stash) {
@@ -365,9 +441,65 @@ inline void MemoryManager::MemoryOperation(GPUVAddr gpu_src_addr, std::size_t si
     }
 }
 
+template <typename Func>
+inline void MemoryManager::DeviceRangeOperation(GPUVAddr gpu_addr, std::size_t size,
+                                                Func&& func) const {
+    using FuncReturn = typename std::invoke_result<Func, DAddr, std::size_t>::type;
+    static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+    DAddr run_begin{};
+    std::size_t run_size{};
+    bool stop{};
+    const auto end_run = [&] {
+        if (run_size != 0) {
+            if constexpr (BOOL_BREAK) {
+                stop = func(run_begin, run_size);
+            } else {
+                func(run_begin, run_size);
+            }
+            run_size = 0;
+        }
+        return stop;
+    };
+    const auto add_to_run = [&](DAddr dev_addr, std::size_t copy_amount) {
+        if (run_size != 0 && run_begin + run_size == dev_addr) {
+            run_size += copy_amount;
+            return false;
+        }
+        if (end_run()) {
+            return true;
+        }
+        run_begin = dev_addr;
+        run_size = copy_amount;
+        return false;
+    };
+    auto not_mapped = [&]([[maybe_unused]] std::size_t page_index,
+                          [[maybe_unused]] std::size_t offset,
+                          [[maybe_unused]] std::size_t copy_amount) { return end_run(); };
+    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        const DAddr dev_addr_base =
+            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
+        return add_to_run(dev_addr_base, copy_amount);
+    };
+    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        const DAddr dev_addr_base =
+            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
+        return add_to_run(dev_addr_base, copy_amount);
+    };
+    auto short_pages = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        GPUVAddr base = (page_index << big_page_bits) + offset;
+        MemoryOperation<false>(base, copy_amount, mapped_normal, not_mapped, not_mapped);
+        return stop;
+    };
+    MemoryOperation<true>(gpu_addr, size, mapped_big, not_mapped, short_pages);
+    end_run();
+}
+
 template <bool is_safe>
 void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std::size_t size,
                                   [[maybe_unused]] VideoCommon::CacheType which) const {
+    if constexpr (is_safe) {
+        FlushRegion(gpu_src_addr, size, which);
+    }
     auto set_to_zero = [&]([[maybe_unused]] std::size_t page_index,
                            [[maybe_unused]] std::size_t offset, std::size_t copy_amount) {
         std::memset(dest_buffer, 0, copy_amount);
@@ -376,9 +508,6 @@ void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std:
     auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
         const DAddr dev_addr_base =
             (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        if constexpr (is_safe) {
-            rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-        }
         u8* physical = memory.GetPointer<u8>(dev_addr_base);
         std::memcpy(dest_buffer, physical, copy_amount);
         dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
@@ -386,9 +515,6 @@ void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std:
     auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
         const DAddr dev_addr_base =
             (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        if constexpr (is_safe) {
-            rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-        }
         if (!IsBigPageContinuous(page_index)) [[unlikely]] {
             memory.ReadBlockUnsafe(dev_addr_base, dest_buffer, copy_amount);
         } else {
@@ -418,6 +544,9 @@ void MemoryManager::ReadBlockUnsafe(GPUVAddr gpu_src_addr, void* dest_buffer,
 template <bool is_safe>
 void MemoryManager::WriteBlockImpl(GPUVAddr gpu_dest_addr, const void* src_buffer, std::size_t size,
                                    [[maybe_unused]] VideoCommon::CacheType which) {
+    if constexpr (is_safe) {
+        InvalidateRegion(gpu_dest_addr, size, which);
+    }
     auto just_advance = [&]([[maybe_unused]] std::size_t page_index,
                             [[maybe_unused]] std::size_t offset, std::size_t copy_amount) {
         src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
@@ -425,9 +554,6 @@ void MemoryManager::WriteBlockImpl(GPUVAddr gpu_dest_addr, const void* src_buffe
     auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
         const DAddr dev_addr_base =
             (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        if constexpr (is_safe) {
-            rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-        }
         u8* physical = memory.GetPointer<u8>(dev_addr_base);
         std::memcpy(physical, src_buffer, copy_amount);
         src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
@@ -435,9 +561,6 @@ void MemoryManager::WriteBlockImpl(GPUVAddr gpu_dest_addr, const void* src_buffe
     auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
         const DAddr dev_addr_base =
             (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        if constexpr (is_safe) {
-            rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-        }
         if (!IsBigPageContinuous(page_index)) [[unlikely]] {
             memory.WriteBlockUnsafe(dev_addr_base, src_buffer, copy_amount);
         } else {
@@ -472,54 +595,18 @@ void MemoryManager::WriteBlockCached(GPUVAddr gpu_dest_addr, const void* src_buf
 
 void MemoryManager::FlushRegion(GPUVAddr gpu_addr, size_t size,
                                 VideoCommon::CacheType which) const {
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) {};
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-    };
-    auto flush_short_pages = [&](std::size_t page_index, std::size_t offset,
-                                 std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation<false>(base, copy_amount, mapped_normal, do_nothing, do_nothing);
-    };
-    MemoryOperation<true>(gpu_addr, size, mapped_big, do_nothing, flush_short_pages);
+    DeviceRangeOperation(gpu_addr, size, [&](DAddr dev_addr, std::size_t run_size) {
+        rasterizer->FlushRegion(dev_addr, run_size, which);
+    });
 }
 
 bool MemoryManager::IsMemoryDirty(GPUVAddr gpu_addr, size_t size,
                                   VideoCommon::CacheType which) const {
     bool result = false;
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) { return false; };
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        result |= rasterizer->MustFlushRegion(dev_addr_base, copy_amount, which);
+    DeviceRangeOperation(gpu_addr, size, [&](DAddr dev_addr, std::size_t run_size) {
+        result = rasterizer->MustFlushRegion(dev_addr, run_size, which);
         return result;
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        result |= rasterizer->MustFlushRegion(dev_addr_base, copy_amount, which);
-        return result;
-    };
-    auto check_short_pages = [&](std::size_t page_index, std::size_t offset,
-                                 std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation<false>(base, copy_amount, mapped_normal, do_nothing, do_nothing);
-        return result;
-    };
-    MemoryOperation<true>(gpu_addr, size, mapped_big, do_nothing, check_short_pages);
+    });
     return result;
 }
 
@@ -570,26 +657,9 @@ size_t MemoryManager::GetMemoryLayoutSize(GPUVAddr gpu_addr, size_t max_size) co
 
 void MemoryManager::InvalidateRegion(GPUVAddr gpu_addr, size_t size,
                                      VideoCommon::CacheType which) const {
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) {};
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-    };
-    auto invalidate_short_pages = [&](std::size_t page_index, std::size_t offset,
-                                      std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation<false>(base, copy_amount, mapped_normal, do_nothing, do_nothing);
-    };
-    MemoryOperation<true>(gpu_addr, size, mapped_big, do_nothing, invalidate_short_pages);
+    DeviceRangeOperation(gpu_addr, size, [&](DAddr dev_addr, std::size_t run_size) {
+        rasterizer->InvalidateRegion(dev_addr, run_size, which);
+    });
 }
 
 void MemoryManager::CopyBlock(GPUVAddr gpu_dest_addr, GPUVAddr gpu_src_addr, std::size_t size,
@@ -33,6 +33,8 @@ class System;
 
 namespace Tegra {
 
+class CommandTraceWriter;
+
 class MemoryManager final {
 public:
     explicit MemoryManager(Core::System& system_, u64 address_space_bits_ = 40,
@@ -50,6 +52,9 @@ public:
     /// Binds a renderer to the memory manager.
     void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
 
+    /// Binds a command trace that records the mapping operations of this address space.
+    void BindCommandTrace(CommandTraceWriter* command_trace_);
+
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr) const;
 
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr, std::size_t size) const;
@@ -132,6 +137,11 @@ public:
     GPUVAddr MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages = true);
     void Unmap(GPUVAddr gpu_addr, std::size_t size);
 
+    /// Defers the cache invalidations of mapping changes until the matching EndMapBatch, so a
+    /// batch of mapping operations invalidates each modified range once
+    void BeginMapBatch();
+    void EndMapBatch();
+
     void FlushRegion(GPUVAddr gpu_addr, size_t size,
                      VideoCommon::CacheType which = VideoCommon::CacheType::All) const;
 
@@ -162,6 +172,11 @@ private:
     inline void MemoryOperation(GPUVAddr gpu_src_addr, std::size_t size, FuncMapped&& func_mapped,
                                 FuncReserved&& func_reserved, FuncUnmapped&& func_unmapped) const;
 
+    /// Calls func with each run of contiguous device addresses mapped in the region, merging
+    /// pages so the rasterizer is called once per run. A func returning true stops the walk.
+    template <typename Func>
+    inline void DeviceRangeOperation(GPUVAddr gpu_addr, std::size_t size, Func&& func) const;
+
     template <bool is_safe>
     void ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std::size_t size,
                        VideoCommon::CacheType which) const;
@@ -207,6 +222,7 @@ private:
     u64 big_page_table_mask;
 
     VideoCore::RasterizerInterface* rasterizer = nullptr;
+    CommandTraceWriter* command_trace = nullptr;
 
     enum class EntryType : u64 {
         Free = 0,
@@ -225,6 +241,12 @@ private:
     GPUVAddr BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr dev_addr, size_t size,
                             PTEKind kind);
 
+    /// Records a range whose mapping changed, merging it with the previous one when contiguous
+    void AddModifiedRange(GPUVAddr gpu_addr, u64 size);
+
+    /// Notifies the rasterizer of the modified ranges, unless a batch is in progress
+    void FlushModifiedRanges();
+
     template <bool is_big_page>
     inline EntryType GetEntry(size_t position) const;
 
@@ -238,6 +260,8 @@ private:
     std::vector<u64> big_page_continuous;
     boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> page_stash{};
     boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> page_stash2{};
+    std::vector<std::pair<GPUVAddr, u64>> modified_ranges;
+    u32 map_batch_depth{};
 
     mutable std::mutex guard;
 
@@ -167,6 +167,7 @@ struct QueryCacheBase<Traits>::QueryCacheBaseImpl {
     std::mutex flush_guard;
     std::deque<u64> flushes_pending;
     std::vector<QueryCacheBase<Traits>::QueryLocation> pending_unregister;
+    u32 num_speculations{};
 };
 
 template <typename Traits>
@@ -452,6 +453,38 @@ bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
     }
 }
 
+template <typename Traits>
+bool QueryCacheBase<Traits>::SpeculateHostConditionalRendering() {
+    const u32 max_speculations = Settings::values.conditional_rendering_speculation.GetValue();
+    if (max_speculations == 0) {
+        return false;
+    }
+    const auto& regs = maxwell3d->regs;
+    if (regs.render_enable_override != Maxwell::Regs::RenderEnable::Override::UseRenderEnable) {
+        return false;
+    }
+    const ComparisonMode mode = static_cast<ComparisonMode>(regs.render_enable.mode);
+    if (mode == ComparisonMode::True || mode == ComparisonMode::False) {
+        return false;
+    }
+    const auto cpu_addr_opt = gpu_memory->GpuToCpuAddress(regs.render_enable.Address());
+    if (!cpu_addr_opt) [[unlikely]] {
+        return false;
+    }
+    // The comparison modes read two 64-bit values 16 bytes apart
+    if (!IsRegionGpuModified(*cpu_addr_opt, 24)) {
+        return false;
+    }
+    // Guest memory still holds the results before the pending queries, usually the ones from
+    // the previous frame. Wait for the real results every few speculations to catch up.
+    if (impl->num_speculations >= max_speculations) {
+        impl->num_speculations = 0;
+        return false;
+    }
+    ++impl->num_speculations;
+    return true;
+}
+
 // Async downloads
 template <typename Traits>
 void QueryCacheBase<Traits>::CommitAsyncFlushes() {
@@ -101,6 +101,10 @@ public:
 
     bool AccelerateHostConditionalRendering();
 
+    /// Returns true when the conditional rendering condition depends on unresolved queries and
+    /// can be answered from the results they held before, as allowed by the speculation setting
+    bool SpeculateHostConditionalRendering();
+
     // Async downloads
     void CommitAsyncFlushes();
 
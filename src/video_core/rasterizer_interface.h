@@ -108,6 +108,13 @@ public:
     /// Notify rasterizer that any caches of the specified region are desync with guest
     virtual void OnCacheInvalidation(PAddr addr, u64 size) = 0;
 
+    /// Notify rasterizer that any caches of the specified regions are desync with guest
+    virtual void InnerCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> sequences) {
+        for (const auto& [addr, size] : sequences) {
+            OnCacheInvalidation(addr, size);
+        }
+    }
+
     virtual bool OnCPUWrite(PAddr addr, u64 size) = 0;
 
     /// Sync memory between guest and host.
@@ -143,6 +150,12 @@ public:
         return false;
     }
 
+    /// Returns true when the conditional rendering condition can be read from guest memory
+    /// without waiting for the queries it depends on to be resolved
+    [[nodiscard]] virtual bool SpeculateConditionalRendering() {
+        return false;
+    }
+
     /// Attempt to use a faster method to perform a surface copy
     [[nodiscard]] virtual bool AccelerateSurfaceCopy(
         const Tegra::Engines::Fermi2D::Surface& src, const Tegra::Engines::Fermi2D::Surface& dst,
@@ -4,6 +4,7 @@
 #include <thread>
 
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/frontend/emu_window.h"
 #include "core/frontend/graphics_context.h"
 #include "video_core/renderer_base.h"
@@ -48,4 +49,15 @@ void RendererBase::RequestScreenshot(void* data, std::function<void(bool)> callb
     renderer_settings.screenshot_requested = true;
 }
 
+bool RendererBase::SkipPresentation() {
+    const u32 frame_skip = ::Settings::values.fast_forward_frame_skip.GetValue();
+    if (::Settings::values.use_speed_limit.GetValue() || frame_skip == 0 ||
+        IsScreenshotPending() || skipped_presentations >= frame_skip) {
+        skipped_presentations = 0;
+        return false;
+    }
+    ++skipped_presentations;
+    return true;
+}
+
 } // namespace VideoCore
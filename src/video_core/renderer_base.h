@@ -92,6 +92,13 @@ public:
     void RequestScreenshot(void* data, std::function<void(bool)> callback,
                            const Layout::FramebufferLayout& layout);
 
+    /**
+     * Returns true if presenting the current guest frame can be skipped. Only frames rendered
+     * while the speed limit is disabled are skipped, as configured by the fast forward frame skip.
+     * Called once per guest frame.
+     */
+    [[nodiscard]] bool SkipPresentation();
+
 protected:
     Core::Frontend::EmuWindow& render_window; ///< Reference to the render window handle.
     std::unique_ptr<Core::Frontend::GraphicsContext> context;
@@ -103,6 +110,8 @@ protected:
 private:
     /// Updates the framebuffer layout of the contained render window handle.
     void UpdateCurrentFramebufferLayout();
+
+    u32 skipped_presentations{}; ///< Frames skipped since the last presented one
 };
 
 } // namespace VideoCore
@@ -29,6 +29,9 @@ public:
                        const Tegra::DMA::ImageOperand& dst) override {
         return false;
     }
+    bool BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) override {
+        return false;
+    }
 };
 
 class RasterizerNull final : public VideoCore::RasterizerInterface,
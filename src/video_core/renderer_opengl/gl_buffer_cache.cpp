@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <span>
 
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
@@ -50,7 +51,8 @@ Buffer::Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params)
     : VideoCommon::BufferBase(null_params) {}
 
 Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
-    : VideoCommon::BufferBase(cpu_addr_, size_bytes_) {
+    : VideoCommon::BufferBase(cpu_addr_, size_bytes_),
+      stream_buffer{runtime.stream_buffer ? &*runtime.stream_buffer : nullptr} {
     buffer.Create();
     if (runtime.device.HasDebuggingToolAttached()) {
         const std::string name = fmt::format("Buffer 0x{:x}", CpuAddr());
@@ -63,6 +65,17 @@ Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
 }
 
 void Buffer::ImmediateUpload(size_t offset, std::span<const u8> data) noexcept {
+    if (stream_buffer && data.size_bytes() < StreamBuffer::MAX_REQUEST_SIZE) {
+        // Stage the data on the persistently mapped stream buffer and copy it on the GPU,
+        // glBufferSubData stalls on drivers without a fast path for it when the buffer is in use
+        const auto [mapped_span, stream_offset] = stream_buffer->Request(data.size_bytes());
+        std::memcpy(mapped_span.data(), data.data(), data.size_bytes());
+        glCopyNamedBufferSubData(stream_buffer->Handle(), buffer.handle,
+                                 static_cast<GLintptr>(stream_offset),
+                                 static_cast<GLintptr>(offset),
+                                 static_cast<GLsizeiptr>(data.size_bytes()));
+        return;
+    }
     glNamedBufferSubData(buffer.handle, static_cast<GLintptr>(offset),
                          static_cast<GLsizeiptr>(data.size_bytes()), data.data());
 }
@@ -51,6 +51,7 @@ private:
 
     GLuint64EXT address = 0;
     OGLBuffer buffer;
+    StreamBuffer* stream_buffer = nullptr;
     GLenum current_residency_access = GL_NONE;
     std::vector<BufferView> views;
 };
@@ -254,6 +255,7 @@ struct BufferCacheParams {
 
     // TODO: Investigate why OpenGL seems to perform worse with persistently mapped buffer uploads
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = false;
+    static constexpr bool IMPLEMENTS_HOST_MEMORY_IMPORT = false;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -231,6 +231,12 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
         GenerateTransformFeedbackState();
     }
     const bool in_parallel = thread_worker != nullptr;
+    poll_link_status = !in_parallel && !force_context_flush && !assembly_shaders &&
+                       device.HasParallelShaderCompile();
+    if (poll_link_status) {
+        // The programs are still linking when they are created
+        link_notify = shader_notify;
+    }
     auto func{[this, sources_ = std::move(sources), sources_spirv_ = std::move(sources_spirv),
                shader_notify, backend, in_parallel,
                force_context_flush](ShaderContext::Context*) mutable {
@@ -260,10 +266,10 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
             // Flush this context to ensure compilation commands and fence are in the GPU pipe.
             glFlush();
             built_condvar.notify_one();
-        } else {
+        } else if (!poll_link_status) {
             is_built = true;
         }
-        if (shader_notify) {
+        if (shader_notify && !poll_link_status) {
             shader_notify->MarkShaderComplete();
         }
     }};
@@ -615,6 +621,11 @@ void GraphicsPipeline::GenerateTransformFeedbackState() {
 }
 
 void GraphicsPipeline::WaitForBuild() {
+    if (poll_link_status) {
+        // Using the programs waits for them to link
+        MarkLinked();
+        return;
+    }
     if (built_fence.handle == 0) {
         std::unique_lock lock{built_mutex};
         built_condvar.wait(lock, [this] { return built_fence.handle != 0; });
@@ -627,6 +638,15 @@ bool GraphicsPipeline::IsBuilt() noexcept {
     if (is_built) {
         return true;
     }
+    if (poll_link_status) {
+        const bool is_linked = std::ranges::all_of(source_programs, [](const OGLProgram& program) {
+            return program.handle == 0 || IsProgramLinked(program.handle);
+        });
+        if (is_linked) {
+            MarkLinked();
+        }
+        return is_linked;
+    }
     if (built_fence.handle == 0) {
         return false;
     }
@@ -634,4 +654,12 @@ bool GraphicsPipeline::IsBuilt() noexcept {
     return is_built;
 }
 
+void GraphicsPipeline::MarkLinked() {
+    is_built = true;
+    if (link_notify) {
+        link_notify->MarkShaderComplete();
+        link_notify = nullptr;
+    }
+}
+
 } // namespace OpenGL
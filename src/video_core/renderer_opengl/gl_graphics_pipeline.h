@@ -9,8 +9,8 @@
 #include <utility>
 
 #include "common/bit_field.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -46,7 +46,7 @@ struct GraphicsPipelineKey {
     VideoCommon::TransformFeedbackState xfb_state;
 
     size_t Hash() const noexcept {
-        return static_cast<size_t>(Common::CityHash64(reinterpret_cast<const char*>(this), Size()));
+        return static_cast<size_t>(Common::FastHash64(this, Size()));
     }
 
     bool operator==(const GraphicsPipelineKey& rhs) const noexcept {
@@ -126,6 +126,8 @@ private:
 
     void WaitForBuild();
 
+    void MarkLinked();
+
     TextureCache& texture_cache;
     BufferCache& buffer_cache;
     Tegra::MemoryManager* gpu_memory;
@@ -161,6 +163,10 @@ private:
     std::condition_variable built_condvar;
     OGLSync built_fence{};
     bool is_built{false};
+    /// The programs were linked by the driver in the background, poll them instead of a fence
+    bool poll_link_status{false};
+    /// Notified of the completion of the programs once they have linked
+    VideoCore::ShaderNotify* link_notify{};
 };
 
 } // namespace OpenGL
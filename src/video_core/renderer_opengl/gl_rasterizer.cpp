@@ -371,7 +371,7 @@ void RasterizerOpenGL::DrawTexture() {
     const auto& texture = texture_cache.GetImageView(draw_texture_state.src_texture);
 
     const auto Scale = [&](auto dim) -> s32 {
-        return Settings::values.resolution_info.ScaleUp(static_cast<s32>(dim));
+        return Settings::GetHotValues().resolution_info.ScaleUp(static_cast<s32>(dim));
     };
 
     Region2D dst_region = {
@@ -602,6 +602,32 @@ void RasterizerOpenGL::OnCacheInvalidation(DAddr addr, u64 size) {
     shader_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerOpenGL::InnerCacheInvalidation(
+    std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            if (addr != 0 && size != 0) {
+                texture_cache.WriteMemory(addr, size);
+            }
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            if (addr != 0 && size != 0) {
+                buffer_cache.WriteMemory(addr, size);
+            }
+        }
+    }
+    for (const auto& [addr, size] : sequences) {
+        if (addr != 0 && size != 0) {
+            shader_cache.InvalidateRegion(addr, size);
+        }
+    }
+}
+
 void RasterizerOpenGL::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -762,7 +788,7 @@ std::optional<FramebufferTextureInfo> RasterizerOpenGL::AccelerateDisplay(
         return {};
     }
 
-    const auto& resolution = Settings::values.resolution_info;
+    const auto& resolution = Settings::GetHotValues().resolution_info;
 
     FramebufferTextureInfo info{};
     info.display_texture = image_view->Handle(Shader::TextureType::Color2D);
@@ -846,7 +872,7 @@ void RasterizerOpenGL::SyncViewport() {
         state_tracker.SetYNegate(lower_left);
     }
     const bool is_rescaling{texture_cache.IsRescaling()};
-    const float scale = is_rescaling ? Settings::values.resolution_info.up_factor : 1.0f;
+    const float scale = is_rescaling ? Settings::GetHotValues().resolution_info.up_factor : 1.0f;
     const auto conv = [scale](float value) -> GLfloat {
         float new_value = value * scale;
         if (scale < 1.0f) {
@@ -1225,7 +1251,7 @@ void RasterizerOpenGL::SyncScissorTest() {
 
     const auto& regs = maxwell3d->regs;
 
-    const auto& resolution = Settings::values.resolution_info;
+    const auto& resolution = Settings::GetHotValues().resolution_info;
     const bool is_rescaling{texture_cache.IsRescaling()};
     const u32 up_scale = is_rescaling ? resolution.up_scale : 1U;
     const u32 down_shift = is_rescaling ? resolution.down_shift : 0U;
@@ -1268,7 +1294,7 @@ void RasterizerOpenGL::SyncPointState() {
     oglEnable(GL_POINT_SPRITE, maxwell3d->regs.point_sprite_enable);
     oglEnable(GL_PROGRAM_POINT_SIZE, maxwell3d->regs.point_size_attribute.enabled);
     const bool is_rescaling{texture_cache.IsRescaling()};
-    const float scale = is_rescaling ? Settings::values.resolution_info.up_factor : 1.0f;
+    const float scale = is_rescaling ? Settings::GetHotValues().resolution_info.up_factor : 1.0f;
     glPointSize(std::max(1.0f, maxwell3d->regs.point_size * scale));
 }
 
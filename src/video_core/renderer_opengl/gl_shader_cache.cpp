@@ -43,6 +43,7 @@ using Shader::Maxwell::ConvertLegacyToGeneric;
 using Shader::Maxwell::GenerateGeometryPassthrough;
 using Shader::Maxwell::MergeDualVertexPrograms;
 using Shader::Maxwell::TranslateProgram;
+using VideoCommon::CompactPipelineCache;
 using VideoCommon::ComputeEnvironment;
 using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
@@ -51,7 +52,7 @@ using VideoCommon::LoadPipelines;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 10;
+constexpr u32 CACHE_VERSION = 12;
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -178,6 +179,8 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
       state_tracker{state_tracker_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{device.UseAsynchronousShaders()},
       strict_context_required{device.StrictContextRequired()},
+      use_parallel_shader_compile{device.HasParallelShaderCompile() &&
+                                  device.GetShaderBackend() != Settings::ShaderBackend::Glasm},
       profile{
           .supported_spirv = 0x00010000,
 
@@ -251,6 +254,10 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
     if (use_asynchronous_shaders) {
         workers = CreateWorkers();
     }
+    if (use_parallel_shader_compile) {
+        // Let the driver pick how many threads compile in the background
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
 }
 
 ShaderCache::~ShaderCache() = default;
@@ -290,7 +297,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
@@ -307,7 +314,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
@@ -328,7 +335,13 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
+    if (LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute,
+                      load_graphics)) {
+        // Nothing is appended to the cache before loading finishes, so it can be compacted here
+        CompactPipelineCache(shader_cache_filename, CACHE_VERSION, sizeof(ComputePipelineKey),
+                             sizeof(GraphicsPipelineKey),
+                             [](bool, std::span<const char>) { return true; });
+    }
 
     LOG_INFO(Render_OpenGL, "Total Pipeline Count: {}", state.total);
 
@@ -450,6 +463,7 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     ShaderContext::ShaderPools& pools, const GraphicsPipelineKey& key,
     std::span<Shader::Environment* const> envs, bool use_shader_workers,
     bool force_context_flush) try {
+    const Shader::ArenaScope arena_scope{pools.arena};
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
     size_t env_index{};
@@ -477,7 +491,9 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
         ++env_index;
 
         const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
+        auto program{translation_cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                                 cfg_offset, index == 0, host_info,
+                                                 key.unique_hashes[index])};
 
         if (Settings::values.dump_shaders) {
             env.Dump(hash, key.unique_hashes[index]);
@@ -485,17 +501,16 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
 
         if (!uses_vertex_a || index != 1) {
             // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
+            programs[index] = std::move(program);
 
             total_storage_buffers +=
                 Shader::NumDescriptors(programs[index].info.storage_buffers_descriptors);
         } else {
             // VertexB path when VertexA is present.
             auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
             total_storage_buffers +=
-                Shader::NumDescriptors(program_vb.info.storage_buffers_descriptors);
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+                Shader::NumDescriptors(program.info.storage_buffers_descriptors);
+            programs[index] = MergeDualVertexPrograms(program_va, program, env);
         }
 
         if (programs[index].info.requires_layer_emulation) {
@@ -542,7 +557,9 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
         }
         previous_program = &program;
     }
-    auto* const thread_worker{use_shader_workers ? workers.get() : nullptr};
+    // Drivers compiling in parallel build the programs in the background without shared contexts
+    const bool use_thread_worker{use_shader_workers && !use_parallel_shader_compile};
+    auto* const thread_worker{use_thread_worker ? workers.get() : nullptr};
     return std::make_unique<GraphicsPipeline>(device, texture_cache, buffer_cache, program_manager,
                                               state_tracker, thread_worker, &shader_notify, sources,
                                               sources_spirv, infos, key, force_context_flush);
@@ -575,6 +592,7 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
 
+    const Shader::ArenaScope arena_scope{pools.arena};
     Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
 
     if (Settings::values.dump_shaders) {
@@ -8,6 +8,7 @@
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/profile.h"
 #include "video_core/renderer_opengl/gl_compute_pipeline.h"
@@ -73,6 +74,7 @@ private:
     VideoCore::ShaderNotify& shader_notify;
     const bool use_asynchronous_shaders;
     const bool strict_context_required;
+    const bool use_parallel_shader_compile;
 
     GraphicsPipelineKey graphics_key{};
     GraphicsPipeline* current_pipeline{};
@@ -83,6 +85,7 @@ private:
 
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
+    Shader::Maxwell::TranslationCache translation_cache;
 
     std::filesystem::path shader_cache_filename;
     std::unique_ptr<ShaderWorker> workers;
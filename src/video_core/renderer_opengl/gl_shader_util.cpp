@@ -108,4 +108,10 @@ OGLAssemblyProgram CompileProgram(std::string_view code, GLenum target) {
     return program;
 }
 
+bool IsProgramLinked(GLuint program) {
+    GLint completion_status{};
+    glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completion_status);
+    return completion_status != GL_FALSE;
+}
+
 } // namespace OpenGL
@@ -18,4 +18,7 @@ OGLProgram CreateProgram(std::span<const u32> code, GLenum stage);
 
 OGLAssemblyProgram CompileProgram(std::string_view code, GLenum target);
 
+/// Returns true when the program has finished linking, requires GL_KHR_parallel_shader_compile
+bool IsProgramLinked(GLuint program);
+
 } // namespace OpenGL
@@ -111,7 +111,7 @@ StreamBuffer::StreamBuffer() {
 }
 
 std::pair<std::span<u8>, size_t> StreamBuffer::Request(size_t size) noexcept {
-    ASSERT(size < REGION_SIZE);
+    ASSERT(size < MAX_REQUEST_SIZE);
     for (size_t region = Region(used_iterator), region_end = Region(iterator); region < region_end;
          ++region) {
         fences[region].Create();
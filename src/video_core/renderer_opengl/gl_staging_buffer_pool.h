@@ -65,6 +65,9 @@ class StreamBuffer {
     static_assert(REGION_SIZE % MAX_ALIGNMENT == 0);
 
 public:
+    /// Requests must be smaller than this
+    static constexpr size_t MAX_REQUEST_SIZE = REGION_SIZE;
+
     explicit StreamBuffer();
 
     [[nodiscard]] std::pair<std::span<u8>, size_t> Request(size_t size) noexcept;
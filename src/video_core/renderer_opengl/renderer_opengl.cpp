@@ -143,15 +143,20 @@ void RendererOpenGL::Composite(std::span<const Tegra::FramebufferConfig> framebu
     RenderAppletCaptureLayer(framebuffers);
     RenderScreenshot(framebuffers);
 
-    state_tracker.BindFramebuffer(0);
-    blit_screen->DrawScreen(framebuffers, emu_window.GetFramebufferLayout(), false);
+    const bool skip_presentation = SkipPresentation();
+    if (!skip_presentation) {
+        state_tracker.BindFramebuffer(0);
+        blit_screen->DrawScreen(framebuffers, emu_window.GetFramebufferLayout(), false);
+    }
 
     ++m_current_frame;
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
 
-    context->SwapBuffers();
+    if (!skip_presentation) {
+        context->SwapBuffers();
+    }
     render_window.OnFrameDisplayed();
 }
 
@@ -5,8 +5,8 @@
 #include <cstring>
 
 #include "common/bit_cast.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/engines/draw_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -48,20 +48,33 @@ void RefreshXfbState(VideoCommon::TransformFeedbackState& state, const Maxwell&
 }
 } // Anonymous namespace
 
-void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features) {
+bool FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features) {
     const Maxwell& regs = maxwell3d.regs;
     const auto topology_ = maxwell3d.draw_manager->GetDrawState().topology;
 
+    // State recomputed on every refresh is compared against its old value, state behind a dirty
+    // flag is assumed to have changed when its flag was set
+    static constexpr size_t head_size = offsetof(FixedPipelineState, viewport_swizzles);
+    std::array<u8, head_size> old_head;
+    std::memcpy(old_head.data(), this, head_size);
+    const DynamicState old_dynamic_state = dynamic_state;
+    const auto old_vertex_strides = vertex_strides;
+    bool changed = false;
+
     raw1 = 0;
     extended_dynamic_state.Assign(features.has_extended_dynamic_state ? 1 : 0);
     extended_dynamic_state_2.Assign(features.has_extended_dynamic_state_2 ? 1 : 0);
     extended_dynamic_state_2_extra.Assign(features.has_extended_dynamic_state_2_extra ? 1 : 0);
     extended_dynamic_state_3_blend.Assign(features.has_extended_dynamic_state_3_blend ? 1 : 0);
     extended_dynamic_state_3_enables.Assign(features.has_extended_dynamic_state_3_enables ? 1 : 0);
+    extended_dynamic_state_3_rasterization.Assign(
+        features.has_extended_dynamic_state_3_rasterization ? 1 : 0);
     dynamic_vertex_input.Assign(features.has_dynamic_vertex_input ? 1 : 0);
     xfb_enabled.Assign(regs.transform_feedback_enabled != 0);
     ndc_minus_one_to_one.Assign(regs.depth_mode == Maxwell::DepthMode::MinusOneToOne ? 1 : 0);
-    polygon_mode.Assign(PackPolygonMode(regs.polygon_mode_front));
+    if (!extended_dynamic_state_3_rasterization) {
+        polygon_mode.Assign(PackPolygonMode(regs.polygon_mode_front));
+    }
     tessellation_primitive.Assign(static_cast<u32>(regs.tessellation.params.domain_type.Value()));
     tessellation_spacing.Assign(static_cast<u32>(regs.tessellation.params.spacing.Value()));
     tessellation_clockwise.Assign(regs.tessellation.params.output_primitives.Value() ==
@@ -82,8 +95,11 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     provoking_vertex_last.Assign(regs.provoking_vertex == Maxwell::ProvokingVertex::Last ? 1 : 0);
     conservative_raster_enable.Assign(regs.conservative_raster_enable != 0 ? 1 : 0);
     smooth_lines.Assign(regs.line_anti_alias_enable != 0 ? 1 : 0);
-    alpha_to_coverage_enabled.Assign(regs.anti_alias_alpha_control.alpha_to_coverage != 0 ? 1 : 0);
-    alpha_to_one_enabled.Assign(regs.anti_alias_alpha_control.alpha_to_one != 0 ? 1 : 0);
+    if (!extended_dynamic_state_3_rasterization) {
+        const auto& alpha_control = regs.anti_alias_alpha_control;
+        alpha_to_coverage_enabled.Assign(alpha_control.alpha_to_coverage != 0 ? 1 : 0);
+        alpha_to_one_enabled.Assign(alpha_control.alpha_to_one != 0 ? 1 : 0);
+    }
     app_stage.Assign(maxwell3d.engine_state);
 
     for (size_t i = 0; i < regs.rt.size(); ++i) {
@@ -93,6 +109,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     point_size = Common::BitCast<u32>(regs.point_size);
 
     if (maxwell3d.dirty.flags[Dirty::VertexInput]) {
+        changed = true;
         if (features.has_dynamic_vertex_input) {
             // Dirty flag will be reset by the command buffer update
             static constexpr std::array LUT{
@@ -134,6 +151,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     }
     if (maxwell3d.dirty.flags[Dirty::ViewportSwizzles]) {
         maxwell3d.dirty.flags[Dirty::ViewportSwizzles] = false;
+        changed = true;
         const auto& transform = regs.viewport_transform;
         std::ranges::transform(transform, viewport_swizzles.begin(), [](const auto& viewport) {
             return static_cast<u16>(viewport.swizzle.raw);
@@ -153,6 +171,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     if (!extended_dynamic_state_3_blend) {
         if (maxwell3d.dirty.flags[Dirty::Blending]) {
             maxwell3d.dirty.flags[Dirty::Blending] = false;
+            changed = true;
             for (size_t index = 0; index < attachments.size(); ++index) {
                 attachments[index].Refresh(regs, index);
             }
@@ -162,8 +181,16 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
         dynamic_state.Refresh3(regs);
     }
     if (xfb_enabled) {
-        RefreshXfbState(xfb_state, regs);
+        VideoCommon::TransformFeedbackState new_xfb_state;
+        RefreshXfbState(new_xfb_state, regs);
+        if (std::memcmp(&new_xfb_state, &xfb_state, sizeof(xfb_state)) != 0) {
+            xfb_state = new_xfb_state;
+            changed = true;
+        }
     }
+    return changed || std::memcmp(old_head.data(), this, head_size) != 0 ||
+           std::memcmp(&old_dynamic_state, &dynamic_state, sizeof(dynamic_state)) != 0 ||
+           old_vertex_strides != vertex_strides;
 }
 
 void FixedPipelineState::BlendingAttachment::Refresh(const Maxwell& regs, size_t index) {
@@ -261,8 +288,7 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs) {
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
-    return static_cast<size_t>(hash);
+    return static_cast<size_t>(Common::FastHash64(this, Size()));
 }
 
 bool FixedPipelineState::operator==(const FixedPipelineState& rhs) const noexcept {
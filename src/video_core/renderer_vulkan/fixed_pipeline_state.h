@@ -23,6 +23,7 @@ struct DynamicFeatures {
     bool has_extended_dynamic_state_2_extra;
     bool has_extended_dynamic_state_3_blend;
     bool has_extended_dynamic_state_3_enables;
+    bool has_extended_dynamic_state_3_rasterization;
     bool has_dynamic_vertex_input;
 };
 
@@ -196,6 +197,7 @@ struct FixedPipelineState {
         BitField<12, 2, u32> tessellation_spacing;
         BitField<14, 1, u32> tessellation_clockwise;
         BitField<15, 5, u32> patch_control_points_minus_one;
+        BitField<20, 1, u32> extended_dynamic_state_3_rasterization;
 
         BitField<24, 4, Maxwell::PrimitiveTopology> topology;
         BitField<28, 4, Tegra::Texture::MsaaMode> msaa_mode;
@@ -233,7 +235,9 @@ struct FixedPipelineState {
 
     VideoCommon::TransformFeedbackState xfb_state;
 
-    void Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features);
+    /// Updates the state from the engine registers, returns true when it may have changed since
+    /// the previous refresh
+    bool Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features);
 
     size_t Hash() const noexcept;
 
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <string_view>
 
 #include <fmt/format.h>
@@ -30,7 +31,14 @@ static u64 GetUint64(const VkPipelineExecutableStatisticKHR& statistic) {
 
 PipelineStatistics::PipelineStatistics(const Device& device_) : device{device_} {}
 
-void PipelineStatistics::Collect(VkPipeline pipeline) {
+void PipelineStatistics::Collect(VkPipeline pipeline, std::chrono::microseconds compile_time) {
+    {
+        const u64 compile_time_us{static_cast<u64>(compile_time.count())};
+        std::scoped_lock lock{mutex};
+        ++num_pipelines;
+        total_compile_time_us += compile_time_us;
+        max_compile_time_us = std::max(max_compile_time_us, compile_time_us);
+    }
     const auto& dev{device.GetLogical()};
     const std::vector properties{dev.GetPipelineExecutablePropertiesKHR(pipeline)};
     const u32 num_executables{static_cast<u32>(properties.size())};
@@ -64,6 +72,9 @@ void PipelineStatistics::Collect(VkPipeline pipeline) {
 void PipelineStatistics::Report() const {
     double num{};
     Stats total;
+    u64 pipelines{};
+    u64 compile_time_us{};
+    u64 slowest_compile_time_us{};
     {
         std::scoped_lock lock{mutex};
         for (const Stats& stats : collected_stats) {
@@ -75,6 +86,9 @@ void PipelineStatistics::Report() const {
             total.basic_block_count += stats.basic_block_count;
         }
         num = static_cast<double>(collected_stats.size());
+        pipelines = num_pipelines;
+        compile_time_us = total_compile_time_us;
+        slowest_compile_time_us = max_compile_time_us;
     }
     std::string report;
     const auto add = [&](const char* fmt, u64 value) {
@@ -88,6 +102,12 @@ void PipelineStatistics::Report() const {
     add("VGPRs:          {:9.03f}\n", total.vgpr_count);
     add("Branches count: {:9.03f}\n", total.branches_count);
     add("Basic blocks:   {:9.03f}\n", total.basic_block_count);
+    if (pipelines > 0) {
+        report += fmt::format("Compile time:   {:9.03f} ms (slowest {:.03f} ms)\n",
+                              static_cast<double>(compile_time_us) / 1000.0 /
+                                  static_cast<double>(pipelines),
+                              static_cast<double>(slowest_compile_time_us) / 1000.0);
+    }
 
     LOG_INFO(Render_Vulkan,
              "\nAverage pipeline statistics\n"
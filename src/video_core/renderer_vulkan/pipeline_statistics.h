@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <mutex>
 #include <vector>
 
@@ -17,7 +18,7 @@ class PipelineStatistics {
 public:
     explicit PipelineStatistics(const Device& device_);
 
-    void Collect(VkPipeline pipeline);
+    void Collect(VkPipeline pipeline, std::chrono::microseconds compile_time);
 
     void Report() const;
 
@@ -34,6 +35,9 @@ private:
     const Device& device;
     mutable std::mutex mutex;
     std::vector<Stats> collected_stats;
+    u64 num_pipelines{};
+    u64 total_compile_time_us{};
+    u64 max_compile_time_us{};
 };
 
 } // namespace Vulkan
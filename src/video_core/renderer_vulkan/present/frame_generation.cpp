@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_vert_spv.h"
+#include "video_core/host_shaders/vulkan_frame_generation_interpolate_frag_spv.h"
+#include "video_core/host_shaders/vulkan_frame_generation_motion_frag_spv.h"
+#include "video_core/renderer_vulkan/present/frame_generation.h"
+#include "video_core/renderer_vulkan/present/util.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_shader_util.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+
+namespace {
+
+// Every device can sample, render to and blit to this format, whatever the swapchain uses
+constexpr VkFormat FRAME_FORMAT = VK_FORMAT_R16G16B16A16_SFLOAT;
+constexpr VkFormat MOTION_FORMAT = VK_FORMAT_R16G16B16A16_SFLOAT;
+
+constexpr VkMemoryBarrier MEMORY_BARRIER{
+    .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+    .pNext = nullptr,
+    .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+    .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+};
+
+} // Anonymous namespace
+
+FrameGeneration::FrameGeneration(const Device& device, MemoryAllocator& allocator,
+                                 VkExtent2D extent, VkFormat output_format)
+    : m_device(device), m_allocator(allocator), m_extent(extent),
+      m_motion_extent{
+          .width = Common::DivCeil(extent.width, BLOCK_SIZE),
+          .height = Common::DivCeil(extent.height, BLOCK_SIZE),
+      },
+      m_output_format(output_format) {
+    CreateImages();
+    CreateRenderPasses();
+    CreateSampler();
+    CreateShaders();
+    CreateDescriptorPool();
+    CreateDescriptorSetLayouts();
+    CreateDescriptorSets();
+    CreatePipelineLayouts();
+    CreatePipelines();
+    UpdateDescriptorSets();
+}
+
+FrameGeneration::~FrameGeneration() = default;
+
+void FrameGeneration::CreateImages() {
+    for (size_t i = 0; i < m_frames.size(); i++) {
+        m_frames[i] = CreateWrappedImage(m_allocator, m_extent, FRAME_FORMAT);
+        m_frame_views[i] = CreateWrappedImageView(m_device, m_frames[i], FRAME_FORMAT);
+    }
+    m_motion_image = CreateWrappedImage(m_allocator, m_motion_extent, MOTION_FORMAT);
+    m_motion_image_view = CreateWrappedImageView(m_device, m_motion_image, MOTION_FORMAT);
+}
+
+void FrameGeneration::CreateRenderPasses() {
+    m_motion_renderpass =
+        CreateWrappedRenderPass(m_device, MOTION_FORMAT, VK_IMAGE_LAYOUT_UNDEFINED);
+    m_motion_framebuffer = CreateWrappedFramebuffer(m_device, m_motion_renderpass,
+                                                    m_motion_image_view, m_motion_extent);
+
+    // Compatible with the window adapt pass, which presentation frame framebuffers are made for
+    m_output_renderpass =
+        CreateWrappedRenderPass(m_device, m_output_format, VK_IMAGE_LAYOUT_UNDEFINED);
+}
+
+void FrameGeneration::CreateSampler() {
+    m_sampler = CreateBilinearSampler(m_device);
+}
+
+void FrameGeneration::CreateShaders() {
+    m_vertex_shader = BuildShader(m_device, VULKAN_FIDELITYFX_FSR_VERT_SPV);
+    m_motion_shader = BuildShader(m_device, VULKAN_FRAME_GENERATION_MOTION_FRAG_SPV);
+    m_interpolate_shader = BuildShader(m_device, VULKAN_FRAME_GENERATION_INTERPOLATE_FRAG_SPV);
+}
+
+void FrameGeneration::CreateDescriptorPool() {
+    // Motion: 2 descriptors
+    // Interpolate: 3 descriptors
+    // 10 descriptors, 4 descriptor sets, one of each for each current frame
+    m_descriptor_pool = CreateWrappedDescriptorPool(m_device, 10, 4);
+}
+
+void FrameGeneration::CreateDescriptorSetLayouts() {
+    m_motion_descriptor_set_layout =
+        CreateWrappedDescriptorSetLayout(m_device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER});
+    m_interpolate_descriptor_set_layout =
+        CreateWrappedDescriptorSetLayout(m_device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER});
+}
+
+void FrameGeneration::CreateDescriptorSets() {
+    const std::array motion_layouts{*m_motion_descriptor_set_layout,
+                                    *m_motion_descriptor_set_layout};
+    const std::array interpolate_layouts{*m_interpolate_descriptor_set_layout,
+                                         *m_interpolate_descriptor_set_layout};
+
+    m_motion_descriptor_sets = CreateWrappedDescriptorSets(m_descriptor_pool, motion_layouts);
+    m_interpolate_descriptor_sets =
+        CreateWrappedDescriptorSets(m_descriptor_pool, interpolate_layouts);
+}
+
+void FrameGeneration::CreatePipelineLayouts() {
+    m_motion_pipeline_layout =
+        CreateWrappedPipelineLayout(m_device, m_motion_descriptor_set_layout);
+    m_interpolate_pipeline_layout =
+        CreateWrappedPipelineLayout(m_device, m_interpolate_descriptor_set_layout);
+}
+
+void FrameGeneration::CreatePipelines() {
+    m_motion_pipeline = CreateWrappedPipeline(m_device, m_motion_renderpass,
+                                              m_motion_pipeline_layout,
+                                              std::tie(m_vertex_shader, m_motion_shader));
+    m_interpolate_pipeline = CreateWrappedPipeline(
+        m_device, m_output_renderpass, m_interpolate_pipeline_layout,
+        std::tie(m_vertex_shader, m_interpolate_shader));
+}
+
+void FrameGeneration::UpdateDescriptorSets() {
+    // The descriptor sets never change, the frames alternate between being previous and current
+    std::vector<VkDescriptorImageInfo> image_infos;
+    std::vector<VkWriteDescriptorSet> updates;
+    image_infos.reserve(10);
+
+    for (size_t current = 0; current < m_frames.size(); current++) {
+        const VkImageView previous_view = *m_frame_views[current ^ 1];
+        const VkImageView current_view = *m_frame_views[current];
+        const VkDescriptorSet motion_set = m_motion_descriptor_sets[current];
+        const VkDescriptorSet interpolate_set = m_interpolate_descriptor_sets[current];
+
+        updates.push_back(
+            CreateWriteDescriptorSet(image_infos, *m_sampler, previous_view, motion_set, 0));
+        updates.push_back(
+            CreateWriteDescriptorSet(image_infos, *m_sampler, current_view, motion_set, 1));
+        updates.push_back(
+            CreateWriteDescriptorSet(image_infos, *m_sampler, previous_view, interpolate_set, 0));
+        updates.push_back(
+            CreateWriteDescriptorSet(image_infos, *m_sampler, current_view, interpolate_set, 1));
+        updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, *m_motion_image_view,
+                                                   interpolate_set, 2));
+    }
+
+    m_device.GetLogical().UpdateDescriptorSets(updates, {});
+}
+
+void FrameGeneration::UploadImages(Scheduler& scheduler) {
+    if (m_images_ready) {
+        return;
+    }
+
+    scheduler.Record([&](vk::CommandBuffer cmdbuf) {
+        for (auto& frame : m_frames) {
+            ClearColorImage(cmdbuf, *frame);
+        }
+        ClearColorImage(cmdbuf, *m_motion_image);
+    });
+    scheduler.Finish();
+
+    m_images_ready = true;
+}
+
+void FrameGeneration::PushFrame(Scheduler& scheduler, VkImage image) {
+    UploadImages(scheduler);
+
+    m_current ^= 1;
+    m_frame_count = std::min<size_t>(m_frame_count + 1, m_frames.size());
+
+    const VkImage frame_image{*m_frames[m_current]};
+    const VkImageSubresourceLayers subresource{
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .mipLevel = 0,
+        .baseArrayLayer = 0,
+        .layerCount = 1,
+    };
+    const VkOffset3D end{
+        .x = static_cast<s32>(m_extent.width),
+        .y = static_cast<s32>(m_extent.height),
+        .z = 1,
+    };
+    const VkImageBlit blit{
+        .srcSubresource = subresource,
+        .srcOffsets = {{0, 0, 0}, end},
+        .dstSubresource = subresource,
+        .dstOffsets = {{0, 0, 0}, end},
+    };
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, MEMORY_BARRIER);
+        cmdbuf.BlitImage(image, VK_IMAGE_LAYOUT_GENERAL, frame_image, VK_IMAGE_LAYOUT_GENERAL,
+                         blit, VK_FILTER_NEAREST);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, MEMORY_BARRIER);
+    });
+}
+
+void FrameGeneration::Draw(Scheduler& scheduler, VkFramebuffer output_framebuffer) {
+    if (m_frame_count < m_frames.size()) {
+        return;
+    }
+
+    const VkImage motion_image{*m_motion_image};
+    const VkFramebuffer motion_framebuffer{*m_motion_framebuffer};
+    const VkRenderPass motion_renderpass{*m_motion_renderpass};
+    const VkRenderPass output_renderpass{*m_output_renderpass};
+    const VkPipeline motion_pipeline{*m_motion_pipeline};
+    const VkPipeline interpolate_pipeline{*m_interpolate_pipeline};
+    const VkPipelineLayout motion_layout{*m_motion_pipeline_layout};
+    const VkPipelineLayout interpolate_layout{*m_interpolate_pipeline_layout};
+    const VkDescriptorSet motion_descriptor_set{m_motion_descriptor_sets[m_current]};
+    const VkDescriptorSet interpolate_descriptor_set{m_interpolate_descriptor_sets[m_current]};
+    const VkExtent2D motion_extent{m_motion_extent};
+    const VkExtent2D extent{m_extent};
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        BeginRenderPass(cmdbuf, motion_renderpass, motion_framebuffer, motion_extent);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, motion_pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, motion_layout, 0,
+                                  motion_descriptor_set, {});
+        cmdbuf.Draw(3, 1, 0, 0);
+        cmdbuf.EndRenderPass();
+
+        TransitionImageLayout(cmdbuf, motion_image, VK_IMAGE_LAYOUT_GENERAL);
+        BeginRenderPass(cmdbuf, output_renderpass, output_framebuffer, extent);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, interpolate_pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, interpolate_layout, 0,
+                                  interpolate_descriptor_set, {});
+        cmdbuf.Draw(3, 1, 0, 0);
+        cmdbuf.EndRenderPass();
+    });
+}
+
+} // namespace Vulkan
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/// Generates frames halfway between two presented frames from the motion estimated between them
+class FrameGeneration {
+public:
+    /// Size in pixels of the square blocks motion is estimated on
+    static constexpr u32 BLOCK_SIZE = 16;
+
+    explicit FrameGeneration(const Device& device, MemoryAllocator& allocator, VkExtent2D extent,
+                             VkFormat output_format);
+    ~FrameGeneration();
+
+    /// Keeps a copy of the image as the current frame, the old current frame becomes the
+    /// previous one
+    void PushFrame(Scheduler& scheduler, VkImage image);
+
+    /// Draws the frame halfway between the previous and the current frame to the framebuffer
+    void Draw(Scheduler& scheduler, VkFramebuffer output_framebuffer);
+
+    /// Returns true when a frame can be generated after the next pushed frame
+    [[nodiscard]] bool HasFrame() const {
+        return m_frame_count > 0;
+    }
+
+    [[nodiscard]] VkExtent2D GetExtent() const {
+        return m_extent;
+    }
+
+    [[nodiscard]] VkFormat GetOutputFormat() const {
+        return m_output_format;
+    }
+
+private:
+    void CreateImages();
+    void CreateRenderPasses();
+    void CreateSampler();
+    void CreateShaders();
+    void CreateDescriptorPool();
+    void CreateDescriptorSetLayouts();
+    void CreateDescriptorSets();
+    void CreatePipelineLayouts();
+    void CreatePipelines();
+    void UpdateDescriptorSets();
+    void UploadImages(Scheduler& scheduler);
+
+    const Device& m_device;
+    MemoryAllocator& m_allocator;
+    const VkExtent2D m_extent;
+    const VkExtent2D m_motion_extent;
+    const VkFormat m_output_format;
+
+    vk::ShaderModule m_vertex_shader{};
+    vk::ShaderModule m_motion_shader{};
+    vk::ShaderModule m_interpolate_shader{};
+    vk::DescriptorPool m_descriptor_pool{};
+    vk::DescriptorSetLayout m_motion_descriptor_set_layout{};
+    vk::DescriptorSetLayout m_interpolate_descriptor_set_layout{};
+    vk::PipelineLayout m_motion_pipeline_layout{};
+    vk::PipelineLayout m_interpolate_pipeline_layout{};
+    vk::Pipeline m_motion_pipeline{};
+    vk::Pipeline m_interpolate_pipeline{};
+    vk::RenderPass m_motion_renderpass{};
+    vk::RenderPass m_output_renderpass{};
+    vk::Sampler m_sampler{};
+
+    /// Copies of the last two pushed frames, alternating between previous and current
+    std::array<vk::Image, 2> m_frames{};
+    std::array<vk::ImageView, 2> m_frame_views{};
+    vk::Image m_motion_image{};
+    vk::ImageView m_motion_image_view{};
+    vk::Framebuffer m_motion_framebuffer{};
+
+    /// Descriptor sets for each frame being the current one
+    vk::DescriptorSets m_motion_descriptor_sets{};
+    vk::DescriptorSets m_interpolate_descriptor_sets{};
+
+    size_t m_current{};
+    size_t m_frame_count{};
+    bool m_images_ready{};
+};
+
+} // namespace Vulkan
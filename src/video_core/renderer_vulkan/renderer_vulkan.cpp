@@ -25,6 +25,7 @@
 #include "video_core/renderer_vulkan/present/util.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
+#include "video_core/renderer_vulkan/vk_gpu_timer.h"
 #include "video_core/renderer_vulkan/vk_rasterizer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
@@ -155,17 +156,52 @@ void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebu
     }
 
     RenderScreenshot(framebuffers);
-    Frame* frame = present_manager.GetRenderFrame();
-    blit_swapchain.DrawToFrame(rasterizer, frame, framebuffers,
-                               render_window.GetFramebufferLayout(), swapchain.GetImageCount(),
-                               swapchain.GetImageViewFormat());
-    scheduler.Flush(*frame->render_ready);
-    present_manager.Present(frame);
+    if (SkipPresentation()) {
+        // The guest work of the frame is still submitted, only its presentation is skipped
+        scheduler.Flush();
+    } else {
+        Frame* frame = present_manager.GetRenderFrame();
+        frame->composition_time = framebuffers.front().composition_time;
+        blit_swapchain.DrawToPresentFrame(rasterizer, frame, framebuffers,
+                                          render_window.GetFramebufferLayout(),
+                                          swapchain.GetImageCount(),
+                                          swapchain.GetImageViewFormat());
+        if (present_manager.IsFrameGenerationEnabled()) {
+            GenerateFrame(frame);
+        }
+        scheduler.Flush(*frame->render_ready);
+        present_manager.Present(frame);
+        if (turbo_mode) {
+            if (GpuTimer* const gpu_timer = scheduler.GetGpuTimer()) {
+                turbo_mode->FrameEnded(gpu_timer->GetGpuTime());
+            }
+        }
+    }
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
 }
 
+void RendererVulkan::GenerateFrame(Frame* frame) {
+    using namespace std::chrono_literals;
+
+    // Only titles running well below the display refresh rate, such as ones locked to 30 fps,
+    // get a frame generated between two of their frames
+    const auto frame_interval = frame->composition_time - last_composition_time;
+    last_composition_time = frame->composition_time;
+    const bool is_slow_title = frame_interval >= 25ms && frame_interval <= 100ms;
+    if (!is_slow_title || !blit_swapchain.CanGenerateFrame(frame)) {
+        blit_swapchain.DrawGeneratedFrame(frame, nullptr);
+        return;
+    }
+
+    Frame* generated_frame = present_manager.GetRenderFrame();
+    generated_frame->generated = true;
+    blit_swapchain.DrawGeneratedFrame(frame, generated_frame);
+    scheduler.Flush(*generated_frame->render_ready);
+    present_manager.Present(generated_frame);
+}
+
 void RendererVulkan::Report() const {
     using namespace Common::Literals;
     const std::string vendor_name{device.GetVendorName()};
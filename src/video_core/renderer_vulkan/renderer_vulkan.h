@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <variant>
@@ -66,6 +67,7 @@ private:
                               VkDeviceSize buffer_size);
     void RenderScreenshot(std::span<const Tegra::FramebufferConfig> framebuffers);
     void RenderAppletCaptureLayer(std::span<const Tegra::FramebufferConfig> framebuffers);
+    void GenerateFrame(Frame* frame);
 
     Core::TelemetrySession& telemetry_session;
     Tegra::MaxwellDeviceMemoryManager& device_memory;
@@ -91,6 +93,7 @@ private:
     std::optional<TurboMode> turbo_mode;
 
     Frame applet_frame;
+    std::chrono::steady_clock::time_point last_composition_time;
 };
 
 } // namespace Vulkan
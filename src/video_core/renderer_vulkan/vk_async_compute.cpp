@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "video_core/renderer_vulkan/vk_async_compute.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+AsyncComputeQueue::AsyncComputeQueue(const Device& device_, Scheduler& scheduler_)
+    : device{device_}, scheduler{scheduler_} {
+    static constexpr VkSemaphoreTypeCreateInfo semaphore_type_ci{
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+        .pNext = nullptr,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+        .initialValue = 0,
+    };
+    static constexpr VkSemaphoreCreateInfo semaphore_ci{
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &semaphore_type_ci,
+        .flags = 0,
+    };
+    semaphore = device.GetLogical().CreateSemaphore(semaphore_ci);
+    command_pool = device.GetLogical().CreateCommandPool({
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags =
+            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = device.GetGraphicsFamily(),
+    });
+    command_buffers = command_pool.Allocate(NUM_COMMAND_BUFFERS);
+}
+
+AsyncComputeQueue::~AsyncComputeQueue() {
+    semaphore.Wait(current_value);
+}
+
+vk::CommandBuffer AsyncComputeQueue::CurrentCommandBuffer() {
+    const vk::CommandBuffer cmdbuf{command_buffers[command_buffer_index],
+                                   device.GetDispatchLoader()};
+    if (!is_recording) {
+        // Make sure the previous use of this command buffer has finished before resetting it
+        semaphore.Wait(command_buffer_values[command_buffer_index]);
+        cmdbuf.Begin({
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+            .pInheritanceInfo = nullptr,
+        });
+        is_recording = true;
+    }
+    return cmdbuf;
+}
+
+void AsyncComputeQueue::Submit() {
+    if (!is_recording) {
+        return;
+    }
+    const VkCommandBuffer cmdbuf = command_buffers[command_buffer_index];
+    vk::CommandBuffer{cmdbuf, device.GetDispatchLoader()}.End();
+    is_recording = false;
+
+    const u64 signal_value = ++current_value;
+    const u32 num_wait_semaphores = graphics_wait_tick != 0 ? 1 : 0;
+    const VkSemaphore wait_semaphore = scheduler.GetMasterSemaphore().GetTimelineSemaphore();
+    static constexpr VkPipelineStageFlags wait_stage_mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = num_wait_semaphores,
+        .pWaitSemaphoreValues = &graphics_wait_tick,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &signal_value,
+    };
+    const VkSemaphore signal_semaphore = *semaphore;
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timeline_si,
+        .waitSemaphoreCount = num_wait_semaphores,
+        .pWaitSemaphores = &wait_semaphore,
+        .pWaitDstStageMask = &wait_stage_mask,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cmdbuf,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &signal_semaphore,
+    };
+    switch (const VkResult result = device.GetAsyncComputeQueue().Submit(submit_info)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+    graphics_wait_tick = 0;
+    command_buffer_values[command_buffer_index] = signal_value;
+    command_buffer_index = (command_buffer_index + 1) % NUM_COMMAND_BUFFERS;
+
+    // Resources written here are consumed by graphics work, hold the next submission until done
+    scheduler.GetMasterSemaphore().WaitOnSubmit(scheduler.CurrentTick(), signal_semaphore,
+                                                signal_value);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/// Records and submits compute work to the secondary queue of the graphics family.
+/// Graphics submissions are made to wait for the asynchronous work through a timeline semaphore.
+class AsyncComputeQueue {
+public:
+    explicit AsyncComputeQueue(const Device& device_, Scheduler& scheduler_);
+    ~AsyncComputeQueue();
+
+    AsyncComputeQueue(const AsyncComputeQueue&) = delete;
+    AsyncComputeQueue& operator=(const AsyncComputeQueue&) = delete;
+
+    /// Records commands on the calling thread into the current asynchronous command buffer.
+    template <typename Func>
+    void Record(Func&& func) {
+        func(CurrentCommandBuffer());
+    }
+
+    /// Makes the next asynchronous submission wait for a graphics tick on the GPU.
+    void WaitGraphicsTick(u64 tick) {
+        graphics_wait_tick = std::max(graphics_wait_tick, tick);
+    }
+
+    /// Submits the recorded commands, the next graphics submission will wait for them.
+    void Submit();
+
+private:
+    static constexpr size_t NUM_COMMAND_BUFFERS = 8;
+
+    /// Returns the current command buffer, beginning it when necessary.
+    vk::CommandBuffer CurrentCommandBuffer();
+
+    const Device& device;
+    Scheduler& scheduler;
+    vk::Semaphore semaphore; ///< Timeline semaphore signaled by the asynchronous queue.
+    vk::CommandPool command_pool;
+    vk::CommandBuffers command_buffers;
+    std::array<u64, NUM_COMMAND_BUFFERS> command_buffer_values{}; ///< Value signaled on completion.
+    size_t command_buffer_index = 0;
+    u64 current_value = 0;      ///< Last value submitted to the semaphore.
+    u64 graphics_wait_tick = 0; ///< Graphics tick to wait for in the next submission.
+    bool is_recording = false;  ///< True when the current command buffer has begun.
+};
+
+} // namespace Vulkan
@@ -1,12 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "video_core/framebuffer_config.h"
 #include "video_core/present.h"
 #include "video_core/renderer_vulkan/present/filters.h"
+#include "video_core/renderer_vulkan/present/frame_generation.h"
 #include "video_core/renderer_vulkan/present/layer.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
+#include "video_core/renderer_vulkan/vk_rasterizer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 
 namespace Vulkan {
@@ -56,6 +59,47 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
                              const Layout::FramebufferLayout& layout,
                              size_t current_swapchain_image_count,
                              VkFormat current_swapchain_view_format) {
+    PrepareFrame(frame, framebuffers, layout, current_swapchain_image_count,
+                 current_swapchain_view_format);
+
+    // Perform the draw
+    scheduler.BeginProfileScope("Present");
+    window_adapt->Draw(rasterizer, scheduler, image_index, layers, framebuffers, layout, frame);
+    scheduler.EndProfileScope();
+
+    // Advance to next image
+    if (++image_index >= image_count) {
+        image_index = 0;
+    }
+}
+
+void BlitScreen::DrawToPresentFrame(RasterizerVulkan& rasterizer, Frame* frame,
+                                    std::span<const Tegra::FramebufferConfig> framebuffers,
+                                    const Layout::FramebufferLayout& layout,
+                                    size_t current_swapchain_image_count,
+                                    VkFormat current_swapchain_view_format) {
+    PrepareFrame(frame, framebuffers, layout, current_swapchain_image_count,
+                 current_swapchain_view_format);
+
+    if (TryPresentDirectly(rasterizer, frame, framebuffers, layout)) {
+        return;
+    }
+
+    // Perform the draw
+    scheduler.BeginProfileScope("Present");
+    window_adapt->Draw(rasterizer, scheduler, image_index, layers, framebuffers, layout, frame);
+    scheduler.EndProfileScope();
+
+    // Advance to next image
+    if (++image_index >= image_count) {
+        image_index = 0;
+    }
+}
+
+void BlitScreen::PrepareFrame(Frame* frame, std::span<const Tegra::FramebufferConfig> framebuffers,
+                              const Layout::FramebufferLayout& layout,
+                              size_t current_swapchain_image_count,
+                              VkFormat current_swapchain_view_format) {
     bool resource_update_required = false;
     bool presentation_recreate_required = false;
 
@@ -105,14 +149,119 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
         layers.emplace_back(device, memory_allocator, scheduler, device_memory, image_count,
                             window_size, window_adapt->GetDescriptorSetLayout(), filters);
     }
+}
 
-    // Perform the draw
-    window_adapt->Draw(rasterizer, scheduler, image_index, layers, framebuffers, layout, frame);
+bool BlitScreen::TryPresentDirectly(RasterizerVulkan& rasterizer, Frame* frame,
+                                    std::span<const Tegra::FramebufferConfig> framebuffers,
+                                    const Layout::FramebufferLayout& layout) {
+    if (!present_manager.CanPresentDirectly() || framebuffers.size() != 1) {
+        return false;
+    }
 
-    // Advance to next image
-    if (++image_index >= image_count) {
-        image_index = 0;
+    // Only a single opaque layer covering the whole window that is not filtered beyond what a
+    // blit to the swapchain does can skip the composition pass.
+    const Tegra::FramebufferConfig& framebuffer = framebuffers.front();
+    if (framebuffer.blending != Tegra::BlendMode::Opaque ||
+        filters.get_anti_aliasing() != Settings::AntiAliasing::None) {
+        return false;
+    }
+    if (scaling_filter != Settings::ScalingFilter::Bilinear &&
+        scaling_filter != Settings::ScalingFilter::NearestNeighbor) {
+        return false;
+    }
+    if (layout.screen.left != 0 || layout.screen.top != 0 ||
+        layout.screen.GetWidth() != layout.width || layout.screen.GetHeight() != layout.height) {
+        return false;
+    }
+
+    // Blitting from these formats is supported by every device
+    const auto image_format = [&] {
+        switch (framebuffer.pixel_format) {
+        case Service::android::PixelFormat::Rgba8888:
+        case Service::android::PixelFormat::Rgbx8888:
+            return VideoCore::Surface::PixelFormat::A8B8G8R8_UNORM;
+        case Service::android::PixelFormat::Bgra8888:
+            return VideoCore::Surface::PixelFormat::B8G8R8A8_UNORM;
+        default:
+            return VideoCore::Surface::PixelFormat::Invalid;
+        }
+    }();
+    if (image_format == VideoCore::Surface::PixelFormat::Invalid) {
+        return false;
+    }
+
+    // Layers that are not rendered by the GPU have to be uploaded by the composition pass
+    const auto texture_info = rasterizer.AccelerateDisplay(
+        framebuffer, framebuffer.address + framebuffer.offset, framebuffer.stride);
+    if (!texture_info) {
+        return false;
+    }
+
+    // The composition pass samples the image through a view of the layer format and resolves
+    // multisampled images, a blit reads the image as it is and only from single sampled images
+    if (texture_info->image_format != image_format ||
+        texture_info->samples != VK_SAMPLE_COUNT_1_BIT) {
+        return false;
+    }
+
+    const auto crop = Tegra::NormalizeCrop(framebuffer, texture_info->width, texture_info->height);
+    const auto scaled_width = static_cast<f32>(texture_info->scaled_width);
+    const auto scaled_height = static_cast<f32>(texture_info->scaled_height);
+    frame->direct_image = texture_info->image;
+    frame->direct_offsets = {
+        VkOffset3D{
+            .x = static_cast<s32>(crop.left * scaled_width),
+            .y = static_cast<s32>(crop.top * scaled_height),
+            .z = 0,
+        },
+        VkOffset3D{
+            .x = static_cast<s32>(crop.right * scaled_width),
+            .y = static_cast<s32>(crop.bottom * scaled_height),
+            .z = 1,
+        },
+    };
+    frame->direct_filter = scaling_filter == Settings::ScalingFilter::NearestNeighbor
+                               ? VK_FILTER_NEAREST
+                               : VK_FILTER_LINEAR;
+    return true;
+}
+
+bool BlitScreen::CanGenerateFrame(const Frame* frame) const {
+    if (!frame_generation || !frame_generation->HasFrame()) {
+        return false;
+    }
+    const VkExtent2D extent = frame_generation->GetExtent();
+    return extent.width == frame->width && extent.height == frame->height &&
+           frame_generation->GetOutputFormat() == swapchain_view_format;
+}
+
+void BlitScreen::DrawGeneratedFrame(Frame* frame, Frame* generated_frame) {
+    const VkExtent2D extent{
+        .width = frame->width,
+        .height = frame->height,
+    };
+    if (!frame_generation || frame_generation->GetExtent().width != extent.width ||
+        frame_generation->GetExtent().height != extent.height ||
+        frame_generation->GetOutputFormat() != swapchain_view_format) {
+        // Wait for idle to ensure no resources are in use
+        WaitIdle();
+
+        frame_generation = std::make_unique<FrameGeneration>(device, memory_allocator, extent,
+                                                             swapchain_view_format);
+    }
+
+    frame_generation->PushFrame(scheduler, *frame->image);
+    if (!generated_frame) {
+        return;
+    }
+
+    if (generated_frame->width != frame->width || generated_frame->height != frame->height) {
+        present_manager.RecreateFrame(generated_frame, frame->width, frame->height,
+                                      swapchain_view_format, window_adapt->GetRenderPass());
     }
+    scheduler.BeginProfileScope("Frame generation");
+    frame_generation->Draw(scheduler, *generated_frame->framebuffer);
+    scheduler.EndProfileScope();
 }
 
 vk::Framebuffer BlitScreen::CreateFramebuffer(const Layout::FramebufferLayout& layout,
@@ -9,6 +9,7 @@
 #include "core/frontend/framebuffer_layout.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_vulkan/present/layer.h"
+#include "video_core/surface.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -29,6 +30,7 @@ enum class ScalingFilter : u32;
 namespace Vulkan {
 
 class Device;
+class FrameGeneration;
 class RasterizerVulkan;
 class Scheduler;
 class PresentManager;
@@ -43,6 +45,8 @@ struct FramebufferTextureInfo {
     u32 height{};
     u32 scaled_width{};
     u32 scaled_height{};
+    VideoCore::Surface::PixelFormat image_format{};
+    VkSampleCountFlagBits samples{VK_SAMPLE_COUNT_1_BIT};
 };
 
 class BlitScreen {
@@ -57,6 +61,22 @@ public:
                      const Layout::FramebufferLayout& layout, size_t current_swapchain_image_count,
                      VkFormat current_swapchain_view_format);
 
+    /// Draws the framebuffers to a frame that is only going to be presented. A single layer
+    /// that needs no composition is presented straight from its image instead.
+    void DrawToPresentFrame(RasterizerVulkan& rasterizer, Frame* frame,
+                            std::span<const Tegra::FramebufferConfig> framebuffers,
+                            const Layout::FramebufferLayout& layout,
+                            size_t current_swapchain_image_count,
+                            VkFormat current_swapchain_view_format);
+
+    /// Returns true when a frame can be generated halfway between the last frame given to
+    /// DrawGeneratedFrame and the given one
+    [[nodiscard]] bool CanGenerateFrame(const Frame* frame) const;
+
+    /// Keeps the drawn frame to generate frames from. When a generated frame is given, the frame
+    /// halfway between the previously kept frame and this one is drawn to it.
+    void DrawGeneratedFrame(Frame* frame, Frame* generated_frame);
+
     [[nodiscard]] vk::Framebuffer CreateFramebuffer(const Layout::FramebufferLayout& layout,
                                                     VkImageView image_view,
                                                     VkFormat current_view_format);
@@ -64,6 +84,12 @@ public:
 private:
     void WaitIdle();
     void SetWindowAdaptPass();
+    void PrepareFrame(Frame* frame, std::span<const Tegra::FramebufferConfig> framebuffers,
+                      const Layout::FramebufferLayout& layout, size_t current_swapchain_image_count,
+                      VkFormat current_swapchain_view_format);
+    bool TryPresentDirectly(RasterizerVulkan& rasterizer, Frame* frame,
+                            std::span<const Tegra::FramebufferConfig> framebuffers,
+                            const Layout::FramebufferLayout& layout);
     vk::Framebuffer CreateFramebuffer(const VkImageView& image_view, VkExtent2D extent,
                                       VkRenderPass render_pass);
 
@@ -80,6 +106,7 @@ private:
     Settings::ScalingFilter scaling_filter{};
     std::unique_ptr<WindowAdaptPass> window_adapt{};
     std::list<Layer> layers{};
+    std::unique_ptr<FrameGeneration> frame_generation{};
 };
 
 } // namespace Vulkan
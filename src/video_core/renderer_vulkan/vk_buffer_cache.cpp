@@ -372,6 +372,13 @@ void BufferCacheRuntime::TickFrame(Common::SlotVector<Buffer>& slot_buffers) noe
     for (auto it = slot_buffers.begin(); it != slot_buffers.end(); it++) {
         it->ResetUsageTracking();
     }
+    ++frame_number;
+    // Release the imports no longer used, failed ones are retried once they expire
+    std::erase_if(host_imports, [this](const auto& pair) {
+        const HostImport& host_import = pair.second;
+        return host_import.frame + HOST_IMPORT_LIFETIME < frame_number &&
+               scheduler.IsFree(host_import.tick);
+    });
 }
 
 void BufferCacheRuntime::Finish() {
@@ -396,19 +403,6 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     if (dst_buffer == VK_NULL_HANDLE || src_buffer == VK_NULL_HANDLE) {
         return;
     }
-    static constexpr VkMemoryBarrier READ_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
-    };
-    static constexpr VkMemoryBarrier WRITE_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
-    };
-
     // Measuring a popular game, this number never exceeds the specified size once data is warmed up
     boost::container::small_vector<VkBufferCopy, 8> vk_copies(copies.size());
     std::ranges::transform(copies, vk_copies.begin(), MakeBufferCopy);
@@ -421,89 +415,84 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     }
 
     scheduler.RequestOutsideRenderPassOperationContext();
-    scheduler.Record([src_buffer, dst_buffer, vk_copies, barrier](vk::CommandBuffer cmdbuf) {
-        if (barrier) {
-            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                   VK_PIPELINE_STAGE_TRANSFER_BIT, 0, READ_BARRIER);
-        }
+    if (barrier) {
+        scheduler.RequestPreTransferBarrier();
+    }
+    scheduler.Record([src_buffer, dst_buffer, vk_copies](vk::CommandBuffer cmdbuf) {
         cmdbuf.CopyBuffer(src_buffer, dst_buffer, vk_copies);
-        if (barrier) {
-            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
-        }
     });
+    if (barrier) {
+        scheduler.RecordPostTransferBarrier();
+    }
 }
 
 void BufferCacheRuntime::PreCopyBarrier() {
-    static constexpr VkMemoryBarrier READ_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
-    };
-    scheduler.RequestOutsideRenderPassOperationContext();
-    scheduler.Record([](vk::CommandBuffer cmdbuf) {
-        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                               0, READ_BARRIER);
-    });
+    scheduler.RequestPreTransferBarrier();
 }
 
 void BufferCacheRuntime::PostCopyBarrier() {
-    static constexpr VkMemoryBarrier WRITE_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
-    };
     scheduler.RequestOutsideRenderPassOperationContext();
-    scheduler.Record([](vk::CommandBuffer cmdbuf) {
-        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                               0, WRITE_BARRIER);
-    });
+    scheduler.RecordPostTransferBarrier();
 }
 
 void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value) {
     if (dest_buffer == VK_NULL_HANDLE) {
         return;
     }
-    static constexpr VkMemoryBarrier READ_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
-    };
-    static constexpr VkMemoryBarrier WRITE_BARRIER{
-        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-        .pNext = nullptr,
-        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
-    };
-
-    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.RequestPreTransferBarrier();
     scheduler.Record([dest_buffer, offset, size, value](vk::CommandBuffer cmdbuf) {
-        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                               0, READ_BARRIER);
         cmdbuf.FillBuffer(dest_buffer, offset, size, value);
-        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                               0, WRITE_BARRIER);
     });
+    scheduler.RecordPostTransferBarrier();
 }
 
 void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format,
                                          u32 base_vertex, u32 num_indices, VkBuffer buffer,
-                                         u32 offset, [[maybe_unused]] u32 size) {
+                                         u32 offset, [[maybe_unused]] u32 size,
+                                         u64 contents_version) {
     VkIndexType vk_index_type = MaxwellToVK::IndexFormat(index_format);
     VkDeviceSize vk_offset = offset;
     VkBuffer vk_buffer = buffer;
+    const ConvertedIndexKey key{
+        .src_buffer = buffer,
+        .src_offset = offset,
+        .num_indices = num_indices,
+        .base_vertex = base_vertex,
+        .contents_version = contents_version,
+        .index_format = index_format,
+        .topology = topology,
+    };
+    bool needs_conversion{};
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
         vk_index_type = VK_INDEX_TYPE_UINT32;
-        std::tie(vk_buffer, vk_offset) =
-            quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
-                                     topology == PrimitiveTopology::QuadStrip);
+        const bool is_strip = topology == PrimitiveTopology::QuadStrip;
+        const size_t converted_size = QuadIndexedPass::AssembledSize(num_indices, is_strip);
+        const VkBuffer cached = ReserveConvertedIndices(key, converted_size, needs_conversion);
+        if (cached == VK_NULL_HANDLE) {
+            std::tie(vk_buffer, vk_offset) = quad_index_pass.Assemble(
+                index_format, num_indices, base_vertex, buffer, offset, is_strip);
+        } else {
+            if (needs_conversion) {
+                quad_index_pass.AssembleTo(cached, 0, index_format, num_indices, base_vertex,
+                                           buffer, offset, is_strip);
+            }
+            vk_buffer = cached;
+            vk_offset = 0;
+        }
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
-            std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            const size_t converted_size = Uint8Pass::AssembledSize(num_indices);
+            const VkBuffer cached = ReserveConvertedIndices(key, converted_size, needs_conversion);
+            if (cached == VK_NULL_HANDLE) {
+                std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            } else {
+                if (needs_conversion) {
+                    uint8_pass->AssembleTo(cached, 0, num_indices, buffer, offset);
+                }
+                vk_buffer = cached;
+                vk_offset = 0;
+            }
         }
     }
     if (vk_buffer == VK_NULL_HANDLE) {
@@ -516,6 +505,41 @@ void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat
     });
 }
 
+VkBuffer BufferCacheRuntime::ReserveConvertedIndices(const ConvertedIndexKey& key, size_t size,
+                                                     bool& needs_conversion) {
+    static constexpr size_t MAX_CONVERTED_INDEX_BUFFERS = 32;
+    if (key.contents_version == 0 || size == 0) {
+        return VK_NULL_HANDLE;
+    }
+    const u64 tick = scheduler.CurrentTick();
+    ConvertedIndexBuffer* entry = nullptr;
+    for (ConvertedIndexBuffer& converted : converted_index_buffers) {
+        if (converted.key == key) {
+            converted.tick = tick;
+            needs_conversion = false;
+            return *converted.buffer;
+        }
+        // Only recycle the least recently used buffer the GPU is done reading from
+        if (scheduler.IsFree(converted.tick) && (!entry || converted.tick < entry->tick)) {
+            entry = &converted;
+        }
+    }
+    if (converted_index_buffers.size() < MAX_CONVERTED_INDEX_BUFFERS) {
+        entry = &converted_index_buffers.emplace_back();
+    }
+    if (!entry) {
+        return VK_NULL_HANDLE;
+    }
+    if (entry->capacity < size) {
+        entry->buffer = CreateBuffer(device, memory_allocator, size);
+        entry->capacity = size;
+    }
+    entry->key = key;
+    entry->tick = tick;
+    needs_conversion = true;
+    return *entry->buffer;
+}
+
 void BufferCacheRuntime::BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count) {
     if (count == 0) {
         ReserveNullBuffer();
@@ -635,6 +659,42 @@ void BufferCacheRuntime::BindTransformFeedbackBuffers(VideoCommon::HostBindings<
     });
 }
 
+bool BufferCacheRuntime::CanImportHostMemory() const {
+    return device.IsExtExternalMemoryHostSupported() &&
+           Settings::values.use_host_memory_import.GetValue();
+}
+
+VkBuffer BufferCacheRuntime::ImportHostMemory(u8* pointer, size_t size) {
+    const auto [it, is_new] = host_imports.try_emplace(pointer);
+    HostImport& host_import = it->second;
+    host_import.tick = scheduler.CurrentTick();
+    host_import.frame = frame_number;
+    if (is_new) {
+        const u64 alignment = device.GetMinImportedHostPointerAlignment();
+        if (reinterpret_cast<uintptr_t>(pointer) % alignment != 0 || size % alignment != 0) {
+            return VK_NULL_HANDLE;
+        }
+        host_import.buffer = memory_allocator.ImportHostBuffer(
+            VkBufferCreateInfo{
+                .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                .pNext = nullptr,
+                .flags = 0,
+                .size = size,
+                .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                         VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                .queueFamilyIndexCount = 0,
+                .pQueueFamilyIndices = nullptr,
+            },
+            pointer);
+        if (!host_import.buffer) {
+            LOG_WARNING(Render_Vulkan, "Failed to import host memory at {}",
+                        static_cast<void*>(pointer));
+        }
+    }
+    return host_import.buffer ? *host_import.buffer->buffer : VK_NULL_HANDLE;
+}
+
 void BufferCacheRuntime::ReserveNullBuffer() {
     if (!null_buffer) {
         null_buffer = CreateNullBuffer();
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
 #include "video_core/buffer_cache/usage_tracker.h"
@@ -111,8 +115,11 @@ public:
 
     void ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value);
 
+    /// Binds an index buffer, converting it when the device can't read it as is.
+    /// Conversions are cached while contents_version is unchanged, zero disables the cache.
     void BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format, u32 num_indices,
-                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size);
+                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size,
+                         u64 contents_version);
 
     void BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count);
 
@@ -124,6 +131,13 @@ public:
 
     void BindTransformFeedbackBuffers(VideoCommon::HostBindings<Buffer>& bindings);
 
+    /// Returns true when guest memory can be imported and read in place by the device
+    bool CanImportHostMemory() const;
+
+    /// Returns a buffer aliasing the given host memory chunk, or a null handle when the driver
+    /// can't import it. Imports unused for HOST_IMPORT_LIFETIME frames are released.
+    VkBuffer ImportHostMemory(u8* pointer, size_t size);
+
     std::span<u8> BindMappedUniformBuffer([[maybe_unused]] size_t stage,
                                           [[maybe_unused]] u32 binding_index, u32 size) {
         const StagingBufferRef ref = staging_pool.Request(size, MemoryUsage::Upload);
@@ -146,10 +160,42 @@ public:
     }
 
 private:
+    struct ConvertedIndexKey {
+        VkBuffer src_buffer;
+        u32 src_offset;
+        u32 num_indices;
+        u32 base_vertex;
+        u64 contents_version;
+        IndexFormat index_format;
+        PrimitiveTopology topology;
+
+        bool operator==(const ConvertedIndexKey&) const = default;
+    };
+
+    struct ConvertedIndexBuffer {
+        ConvertedIndexKey key;
+        vk::Buffer buffer;
+        size_t capacity;
+        u64 tick;
+    };
+
+    struct HostImport {
+        std::optional<ImportedHostBuffer> buffer;
+        u64 tick;
+        u64 frame;
+    };
+
+    static constexpr u64 HOST_IMPORT_LIFETIME = 64;
+
     void BindBuffer(VkBuffer buffer, u32 offset, u32 size) {
         guest_descriptor_queue.AddBuffer(buffer, offset, size);
     }
 
+    /// Returns the buffer holding the conversion for the given key, or a null handle when it can't
+    /// be cached. needs_conversion is set when the buffer has yet to be written.
+    VkBuffer ReserveConvertedIndices(const ConvertedIndexKey& key, size_t size,
+                                     bool& needs_conversion);
+
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
@@ -164,6 +210,11 @@ private:
 
     vk::Buffer null_buffer;
 
+    std::unordered_map<u8*, HostImport> host_imports;
+    u64 frame_number = 0;
+
+    std::vector<ConvertedIndexBuffer> converted_index_buffers;
+
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
 };
@@ -182,6 +233,7 @@ struct BufferCacheParams {
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool IMPLEMENTS_HOST_MEMORY_IMPORT = true;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
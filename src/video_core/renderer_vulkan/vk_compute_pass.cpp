@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <numeric>
@@ -9,9 +10,11 @@
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/settings.h"
 #include "common/vector_math.h"
 #include "video_core/host_shaders/astc_decoder_comp_spv.h"
 #include "video_core/host_shaders/convert_msaa_to_non_msaa_comp_spv.h"
@@ -19,6 +22,8 @@
 #include "video_core/host_shaders/queries_prefix_scan_sum_comp_spv.h"
 #include "video_core/host_shaders/queries_prefix_scan_sum_nosubgroups_comp_spv.h"
 #include "video_core/host_shaders/resolve_conditional_render_comp_spv.h"
+#include "video_core/host_shaders/vulkan_bcn_encode_comp_spv.h"
+#include "video_core/host_shaders/vulkan_dma_swizzle_comp_spv.h"
 #include "video_core/host_shaders/vulkan_quad_indexed_comp_spv.h"
 #include "video_core/host_shaders/vulkan_uint8_comp_spv.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
@@ -40,6 +45,10 @@ constexpr u32 ASTC_BINDING_INPUT_BUFFER = 0;
 constexpr u32 ASTC_BINDING_OUTPUT_IMAGE = 1;
 constexpr size_t ASTC_NUM_BINDINGS = 2;
 
+constexpr u32 BCN_BINDING_INPUT_IMAGE = 0;
+constexpr u32 BCN_BINDING_OUTPUT_BUFFER = 1;
+constexpr size_t BCN_NUM_BINDINGS = 2;
+
 template <size_t size>
 inline constexpr VkPushConstantRange COMPUTE_PUSH_CONSTANT_RANGE{
     .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
@@ -135,6 +144,33 @@ constexpr DescriptorBankInfo ASTC_BANK_INFO{
     .score = 2,
 };
 
+constexpr std::array<VkDescriptorSetLayoutBinding, BCN_NUM_BINDINGS> BCN_DESCRIPTOR_SET_BINDINGS{{
+    {
+        .binding = BCN_BINDING_INPUT_IMAGE,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+    {
+        .binding = BCN_BINDING_OUTPUT_BUFFER,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+}};
+
+constexpr DescriptorBankInfo BCN_BANK_INFO{
+    .uniform_buffers = 0,
+    .storage_buffers = 1,
+    .texture_buffers = 0,
+    .image_buffers = 0,
+    .textures = 0,
+    .images = 1,
+    .score = 2,
+};
+
 constexpr std::array<VkDescriptorSetLayoutBinding, ASTC_NUM_BINDINGS> MSAA_DESCRIPTOR_SET_BINDINGS{{
     {
         .binding = 0,
@@ -209,6 +245,26 @@ constexpr std::array<VkDescriptorUpdateTemplateEntry, ASTC_NUM_BINDINGS>
         },
     }};
 
+constexpr std::array<VkDescriptorUpdateTemplateEntry, BCN_NUM_BINDINGS>
+    BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY{{
+        {
+            .dstBinding = BCN_BINDING_INPUT_IMAGE,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .offset = BCN_BINDING_INPUT_IMAGE * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+        {
+            .dstBinding = BCN_BINDING_OUTPUT_BUFFER,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .offset = BCN_BINDING_OUTPUT_BUFFER * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+    }};
+
 struct AstcPushConstants {
     std::array<u32, 2> blocks_dims;
     u32 layer_stride;
@@ -218,6 +274,20 @@ struct AstcPushConstants {
     u32 block_height_mask;
 };
 
+struct BcnEncodePushConstants {
+    std::array<u32, 2> image_size;
+    std::array<u32, 2> num_blocks;
+    u32 is_bc3;
+};
+
+struct DmaSwizzlePushConstants {
+    std::array<u32, 4> src_layout;
+    std::array<u32, 4> dst_layout;
+    std::array<u32, 2> src_origin;
+    std::array<u32, 2> dst_origin;
+    std::array<u32, 2> extent;
+};
+
 struct QueriesPrefixScanPushConstants {
     u32 min_accumulation_base;
     u32 max_accumulation_base;
@@ -313,17 +383,27 @@ Uint8Pass::Uint8Pass(const Device& device_, Scheduler& scheduler_, DescriptorPoo
 
 Uint8Pass::~Uint8Pass() = default;
 
+size_t Uint8Pass::AssembledSize(u32 num_vertices) {
+    return num_vertices * sizeof(u16);
+}
+
 std::pair<VkBuffer, VkDeviceSize> Uint8Pass::Assemble(u32 num_vertices, VkBuffer src_buffer,
                                                       u32 src_offset) {
-    const u32 staging_size = static_cast<u32>(num_vertices * sizeof(u16));
+    const size_t staging_size = AssembledSize(num_vertices);
     const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+    AssembleTo(staging.buffer, staging.offset, num_vertices, src_buffer, src_offset);
+    return {staging.buffer, staging.offset};
+}
 
+void Uint8Pass::AssembleTo(VkBuffer dst_buffer, VkDeviceSize dst_offset, u32 num_vertices,
+                           VkBuffer src_buffer, u32 src_offset) {
     compute_pass_descriptor_queue.Acquire();
     compute_pass_descriptor_queue.AddBuffer(src_buffer, src_offset, num_vertices);
-    compute_pass_descriptor_queue.AddBuffer(staging.buffer, staging.offset, staging_size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, AssembledSize(num_vertices));
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("Uint8 index assembly");
     scheduler.Record([this, descriptor_data, num_vertices](vk::CommandBuffer cmdbuf) {
         static constexpr u32 DISPATCH_SIZE = 1024;
         static constexpr VkMemoryBarrier WRITE_BARRIER{
@@ -340,7 +420,7 @@ std::pair<VkBuffer, VkDeviceSize> Uint8Pass::Assemble(u32 num_vertices, VkBuffer
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, WRITE_BARRIER);
     });
-    return {staging.buffer, staging.offset};
+    scheduler.EndProfileScope();
 }
 
 QuadIndexedPass::QuadIndexedPass(const Device& device_, Scheduler& scheduler_,
@@ -355,9 +435,25 @@ QuadIndexedPass::QuadIndexedPass(const Device& device_, Scheduler& scheduler_,
 
 QuadIndexedPass::~QuadIndexedPass() = default;
 
+size_t QuadIndexedPass::AssembledSize(u32 num_vertices, bool is_strip) {
+    const u32 num_tri_vertices = (is_strip ? (num_vertices - 2) / 2 : num_vertices / 4) * 6;
+    return num_tri_vertices * sizeof(u32);
+}
+
 std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
     Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices, u32 base_vertex,
     VkBuffer src_buffer, u32 src_offset, bool is_strip) {
+    const size_t staging_size = AssembledSize(num_vertices, is_strip);
+    const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+    AssembleTo(staging.buffer, staging.offset, index_format, num_vertices, base_vertex, src_buffer,
+               src_offset, is_strip);
+    return {staging.buffer, staging.offset};
+}
+
+void QuadIndexedPass::AssembleTo(VkBuffer dst_buffer, VkDeviceSize dst_offset,
+                                 Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format,
+                                 u32 num_vertices, u32 base_vertex, VkBuffer src_buffer,
+                                 u32 src_offset, bool is_strip) {
     const u32 index_shift = [index_format] {
         switch (index_format) {
         case Tegra::Engines::Maxwell3D::Regs::IndexFormat::UnsignedByte:
@@ -371,17 +467,16 @@ std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
         return 2;
     }();
     const u32 input_size = num_vertices << index_shift;
-    const u32 num_tri_vertices = (is_strip ? (num_vertices - 2) / 2 : num_vertices / 4) * 6;
-
-    const std::size_t staging_size = num_tri_vertices * sizeof(u32);
-    const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+    const size_t output_size = AssembledSize(num_vertices, is_strip);
+    const u32 num_tri_vertices = static_cast<u32>(output_size / sizeof(u32));
 
     compute_pass_descriptor_queue.Acquire();
     compute_pass_descriptor_queue.AddBuffer(src_buffer, src_offset, input_size);
-    compute_pass_descriptor_queue.AddBuffer(staging.buffer, staging.offset, staging_size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, output_size);
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("Quad index assembly");
     scheduler.Record([this, descriptor_data, num_tri_vertices, base_vertex, index_shift,
                       is_strip](vk::CommandBuffer cmdbuf) {
         static constexpr u32 DISPATCH_SIZE = 1024;
@@ -402,7 +497,7 @@ std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, WRITE_BARRIER);
     });
-    return {staging.buffer, staging.offset};
+    scheduler.EndProfileScope();
 }
 
 ConditionalRenderingResolvePass::ConditionalRenderingResolvePass(
@@ -423,6 +518,7 @@ void ConditionalRenderingResolvePass::Resolve(VkBuffer dst_buffer, VkBuffer src_
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("Conditional rendering resolve");
     scheduler.Record([this, descriptor_data](vk::CommandBuffer cmdbuf) {
         static constexpr VkMemoryBarrier read_barrier{
             .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -447,6 +543,7 @@ void ConditionalRenderingResolvePass::Resolve(VkBuffer dst_buffer, VkBuffer src_
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT, 0, write_barrier);
     });
+    scheduler.EndProfileScope();
 }
 
 QueriesPrefixScanPass::QueriesPrefixScanPass(
@@ -467,59 +564,181 @@ QueriesPrefixScanPass::QueriesPrefixScanPass(
 void QueriesPrefixScanPass::Run(VkBuffer accumulation_buffer, VkBuffer dst_buffer,
                                 VkBuffer src_buffer, size_t number_of_sums,
                                 size_t min_accumulation_limit, size_t max_accumulation_limit) {
-    size_t current_runs = number_of_sums;
-    size_t offset = 0;
-    while (current_runs != 0) {
+    if (number_of_sums == 0) {
+        return;
+    }
+    compute_pass_descriptor_queue.Acquire();
+    compute_pass_descriptor_queue.AddBuffer(src_buffer, 0, number_of_sums * sizeof(u64));
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, 0, number_of_sums * sizeof(u64));
+    compute_pass_descriptor_queue.AddBuffer(accumulation_buffer, 0, sizeof(u64));
+    const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+    // Every resolve of the batch is dispatched from the same recorded command and descriptor set,
+    // each dispatch continues the accumulation of the previous one
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("Query prefix scan");
+    scheduler.Record([this, descriptor_data, number_of_sums, min_accumulation_limit,
+                      max_accumulation_limit](vk::CommandBuffer cmdbuf) {
         static constexpr size_t DISPATCH_SIZE = 2048U;
-        size_t runs_to_do = std::min<size_t>(current_runs, DISPATCH_SIZE);
-        current_runs -= runs_to_do;
-        compute_pass_descriptor_queue.Acquire();
-        compute_pass_descriptor_queue.AddBuffer(src_buffer, 0, number_of_sums * sizeof(u64));
-        compute_pass_descriptor_queue.AddBuffer(dst_buffer, 0, number_of_sums * sizeof(u64));
-        compute_pass_descriptor_queue.AddBuffer(accumulation_buffer, 0, sizeof(u64));
-        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
-        size_t used_offset = offset;
-        offset += runs_to_do;
+        static constexpr VkMemoryBarrier read_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        };
+        static constexpr VkMemoryBarrier chain_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        };
+        static constexpr VkMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT |
+                             VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                             VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                             VK_ACCESS_UNIFORM_READ_BIT |
+                             VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT,
+        };
+        const VkDescriptorSet set = descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
 
-        scheduler.RequestOutsideRenderPassOperationContext();
-        scheduler.Record([this, descriptor_data, min_accumulation_limit, max_accumulation_limit,
-                          runs_to_do, used_offset](vk::CommandBuffer cmdbuf) {
-            static constexpr VkMemoryBarrier read_barrier{
-                .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-                .pNext = nullptr,
-                .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
-            };
-            static constexpr VkMemoryBarrier write_barrier{
-                .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-                .pNext = nullptr,
-                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
-                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT |
-                                 VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
-                                 VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
-                                 VK_ACCESS_UNIFORM_READ_BIT |
-                                 VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT,
-            };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, read_barrier);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        for (size_t offset = 0; offset < number_of_sums; offset += DISPATCH_SIZE) {
+            if (offset != 0) {
+                cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, chain_barrier);
+            }
+            const size_t runs_to_do = std::min(number_of_sums - offset, DISPATCH_SIZE);
             const QueriesPrefixScanPushConstants uniforms{
                 .min_accumulation_base = static_cast<u32>(min_accumulation_limit),
                 .max_accumulation_base = static_cast<u32>(max_accumulation_limit),
                 .accumulation_limit = static_cast<u32>(runs_to_do - 1),
-                .buffer_offset = static_cast<u32>(used_offset),
+                .buffer_offset = static_cast<u32>(offset),
             };
-            const VkDescriptorSet set = descriptor_allocator.Commit();
-            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
-
-            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, read_barrier);
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
-            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
             cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
             cmdbuf.Dispatch(1, 1, 1);
-            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                                   VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT, 0,
-                                   write_barrier);
-        });
+        }
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT, 0, write_barrier);
+    });
+    scheduler.EndProfileScope();
+}
+
+DmaSwizzlePass::DmaSwizzlePass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, INPUT_OUTPUT_DESCRIPTOR_SET_BINDINGS,
+                  INPUT_OUTPUT_DESCRIPTOR_UPDATE_TEMPLATE, INPUT_OUTPUT_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(DmaSwizzlePushConstants)>,
+                  VULKAN_DMA_SWIZZLE_COMP_SPV),
+      scheduler{scheduler_}, compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+DmaSwizzlePass::~DmaSwizzlePass() = default;
+
+void DmaSwizzlePass::Copy(VkBuffer src_buffer, u32 src_offset, VkBuffer dst_buffer,
+                          u32 dst_offset, const Tegra::DMA::SwizzleCopy& copy) {
+    const u32 bytes_per_pixel = copy.bytes_per_pixel;
+    u32 num_lines = copy.num_lines;
+    // Layouts match the ones SwizzleSubrect walks for a single slice
+    const auto make_layout = [&](const Tegra::DMA::SwizzleOperand& operand, u32 offset) {
+        if (operand.pitch != 0) {
+            return std::array<u32, 4>{offset, operand.pitch, 0, 0};
+        }
+        const u32 origin_y = std::min(operand.origin_y, operand.height);
+        num_lines = std::min(num_lines, operand.height - origin_y);
+        const u32 gobs_in_x =
+            Common::DivCeilLog2(operand.width * bytes_per_pixel, Tegra::Texture::GOB_SIZE_X_SHIFT);
+        const u32 x_shift =
+            Tegra::Texture::GOB_SIZE_SHIFT + operand.block_height + operand.block_depth;
+        return std::array<u32, 4>{offset, gobs_in_x << x_shift, operand.block_height, x_shift};
+    };
+    const auto make_origin = [bytes_per_pixel](const Tegra::DMA::SwizzleOperand& operand) {
+        if (operand.pitch != 0) {
+            return std::array<u32, 2>{0, 0};
+        }
+        return std::array<u32, 2>{operand.origin_x * bytes_per_pixel, operand.origin_y};
+    };
+    // Bind the buffers at offsets they can be bound at and address the rest in the shader
+    const u32 alignment = static_cast<u32>(device.GetStorageBufferAlignment());
+    const u32 src_bind_offset = Common::AlignDown(src_offset, alignment);
+    const u32 dst_bind_offset = Common::AlignDown(dst_offset, alignment);
+    const DmaSwizzlePushConstants push_constants{
+        .src_layout = make_layout(copy.src, src_offset - src_bind_offset),
+        .dst_layout = make_layout(copy.dst, dst_offset - dst_bind_offset),
+        .src_origin = make_origin(copy.src),
+        .dst_origin = make_origin(copy.dst),
+        .extent = {copy.extent_x * bytes_per_pixel / 4, num_lines},
+    };
+    if (push_constants.extent[0] == 0 || push_constants.extent[1] == 0) {
+        return;
     }
+
+    compute_pass_descriptor_queue.Acquire();
+    compute_pass_descriptor_queue.AddBuffer(src_buffer, src_bind_offset,
+                                            src_offset - src_bind_offset + copy.src.size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_bind_offset,
+                                            dst_offset - dst_bind_offset + copy.dst.size);
+    const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("DMA swizzle");
+    scheduler.Record([this, descriptor_data, push_constants](vk::CommandBuffer cmdbuf) {
+        static constexpr VkMemoryBarrier READ_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        };
+        static constexpr VkMemoryBarrier WRITE_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+        };
+        const VkDescriptorSet set = descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, READ_BARRIER);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, push_constants);
+        cmdbuf.Dispatch(Common::DivCeil(push_constants.extent[0], 32U),
+                        Common::DivCeil(push_constants.extent[1], 8U), 1);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
+    });
+    scheduler.EndProfileScope();
+}
+
+BCnEncoderPass::BCnEncoderPass(const Device& device_, DescriptorPool& descriptor_pool_)
+    : ComputePass(device_, descriptor_pool_, BCN_DESCRIPTOR_SET_BINDINGS,
+                  BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, BCN_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BcnEncodePushConstants)>,
+                  VULKAN_BCN_ENCODE_COMP_SPV) {}
+
+BCnEncoderPass::~BCnEncoderPass() = default;
+
+void BCnEncoderPass::Encode(vk::CommandBuffer cmdbuf, const void* descriptor_data, u32 width,
+                            u32 height, u32 layers, bool is_bc3) {
+    const BcnEncodePushConstants uniforms{
+        .image_size{width, height},
+        .num_blocks{Common::DivCeil(width, 4U), Common::DivCeil(height, 4U)},
+        .is_bc3 = is_bc3 ? 1U : 0U,
+    };
+    const VkDescriptorSet set = descriptor_allocator.Commit();
+    device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+    cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+    cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+    cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+    cmdbuf.Dispatch(Common::DivCeil(uniforms.num_blocks[0], 8U),
+                    Common::DivCeil(uniforms.num_blocks[1], 8U), layers);
 }
 
 ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -531,8 +750,12 @@ ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                   ASTC_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, ASTC_BANK_INFO,
                   COMPUTE_PUSH_CONSTANT_RANGE<sizeof(AstcPushConstants)>, ASTC_DECODER_COMP_SPV),
       scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
-      compute_pass_descriptor_queue{compute_pass_descriptor_queue_}, memory_allocator{
-                                                                         memory_allocator_} {}
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_},
+      memory_allocator{memory_allocator_}, bcn_encoder_pass(device_, descriptor_pool_) {
+    if (device.HasAsyncComputeQueue()) {
+        async_compute.emplace(device, scheduler);
+    }
+}
 
 ASTCDecoderPass::~ASTCDecoderPass() = default;
 
@@ -543,19 +766,44 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         VideoCore::Surface::DefaultBlockWidth(image.info.format),
         VideoCore::Surface::DefaultBlockHeight(image.info.format),
     };
-    scheduler.RequestOutsideRenderPassOperationContext();
+    const auto recompression = Settings::values.astc_recompression.GetValue();
+    const bool recompress = recompression != Settings::AstcRecompression::Uncompressed;
+    const bool is_bc3 = recompression == Settings::AstcRecompression::Bc3;
     const VkPipeline vk_pipeline = *pipeline;
     const VkImageAspectFlags aspect_mask = image.AspectMask();
     const VkImage vk_image = image.Handle();
     const bool is_initialized = image.ExchangeInitialization();
-    scheduler.Record([vk_pipeline, vk_image, aspect_mask,
-                      is_initialized](vk::CommandBuffer cmdbuf) {
+    if (async_compute) {
+        // Decode on the asynchronous queue, previous graphics work on the image has to be submitted
+        // to be waited on. The next graphics submission waits for the decode.
+        if (is_initialized) {
+            async_compute->WaitGraphicsTick(scheduler.Flush());
+        }
+    } else {
+        scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.BeginProfileScope("ASTC decode");
+    }
+    const auto record = [this](auto&& func) {
+        if (async_compute) {
+            async_compute->Record(std::move(func));
+        } else {
+            scheduler.Record(std::move(func));
+        }
+    };
+    // Recompressed images are written by transfers from the encoded blocks instead of storage
+    // image writes
+    const VkAccessFlags write_access =
+        recompress ? VK_ACCESS_TRANSFER_WRITE_BIT : VK_ACCESS_SHADER_WRITE_BIT;
+    const VkPipelineStageFlags write_stage =
+        recompress ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    record([vk_image, aspect_mask, is_initialized, write_access,
+            write_stage](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
             .pNext = nullptr,
-            .srcAccessMask = static_cast<VkAccessFlags>(is_initialized ? VK_ACCESS_SHADER_WRITE_BIT
+            .srcAccessMask = static_cast<VkAccessFlags>(is_initialized ? write_access
                                                                        : VK_ACCESS_NONE),
-            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | write_access,
             .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
             .newLayout = VK_IMAGE_LAYOUT_GENERAL,
             .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
@@ -571,19 +819,36 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         };
         cmdbuf.PipelineBarrier(is_initialized ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
                                               : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, image_barrier);
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | write_stage, 0,
+                               image_barrier);
     });
     for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
         const size_t input_offset = swizzle.buffer_offset + map.offset;
         const u32 num_dispatches_x = Common::DivCeil(swizzle.num_tiles.width, 8U);
         const u32 num_dispatches_y = Common::DivCeil(swizzle.num_tiles.height, 8U);
         const u32 num_dispatches_z = image.info.resources.layers;
+        const u32 level = static_cast<u32>(swizzle.level);
+        const u32 level_width = std::max(image.info.size.width >> level, 1U);
+        const u32 level_height = std::max(image.info.size.height >> level, 1U);
+        const u32 num_layers = static_cast<u32>(image.info.resources.layers);
+
+        // Without recompression the decoder writes straight into the image, otherwise it writes
+        // into a transient RGBA8 image that is encoded to BCn afterwards
+        VkImage decode_image = VK_NULL_HANDLE;
+        VkImageView decode_view = VK_NULL_HANDLE;
+        if (recompress) {
+            const TransientImage& transient =
+                CreateTransientImage(level_width, level_height, num_layers);
+            decode_image = *transient.image;
+            decode_view = *transient.view;
+        } else {
+            decode_view = image.StorageImageView(swizzle.level);
+        }
 
         compute_pass_descriptor_queue.Acquire();
         compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
                                                 image.guest_size_bytes - swizzle.buffer_offset);
-        compute_pass_descriptor_queue.AddImage(image.StorageImageView(swizzle.level));
+        compute_pass_descriptor_queue.AddImage(decode_view);
         const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
         // To unswizzle the ASTC data
@@ -591,8 +856,30 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
         ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
         ASSERT(params.bytes_per_block_log2 == 4);
-        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, block_dims,
-                          params, descriptor_data](vk::CommandBuffer cmdbuf) {
+        record([this, vk_pipeline, decode_image, num_dispatches_x, num_dispatches_y,
+                num_dispatches_z, block_dims, params, descriptor_data](vk::CommandBuffer cmdbuf) {
+            if (decode_image != VK_NULL_HANDLE) {
+                const VkImageMemoryBarrier transient_barrier{
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                    .pNext = nullptr,
+                    .srcAccessMask = VK_ACCESS_NONE,
+                    .dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                    .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                    .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                    .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .image = decode_image,
+                    .subresourceRange{
+                        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                        .baseMipLevel = 0,
+                        .levelCount = 1,
+                        .baseArrayLayer = 0,
+                        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+                    },
+                };
+                cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, transient_barrier);
+            }
             const AstcPushConstants uniforms{
                 .blocks_dims = block_dims,
                 .layer_stride = params.layer_stride,
@@ -603,16 +890,80 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
             };
             const VkDescriptorSet set = descriptor_allocator.Commit();
             device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
             cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
             cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
             cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, num_dispatches_z);
         });
+        if (!recompress) {
+            continue;
+        }
+        const size_t encoded_size = static_cast<size_t>(Common::DivCeil(level_width, 4U)) *
+                                    Common::DivCeil(level_height, 4U) * num_layers *
+                                    (is_bc3 ? 16 : 8);
+        const StagingBufferRef encoded =
+            staging_buffer_pool.Request(encoded_size, MemoryUsage::DeviceLocal);
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddImage(decode_view);
+        compute_pass_descriptor_queue.AddBuffer(encoded.buffer, encoded.offset, encoded_size);
+        const void* const encode_descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+        record([this, decode_image, vk_image, aspect_mask, level, level_width, level_height,
+                num_layers, is_bc3, encoded_buffer = encoded.buffer,
+                encoded_offset = encoded.offset,
+                encode_descriptor_data](vk::CommandBuffer cmdbuf) {
+            const VkImageMemoryBarrier decoded_barrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = decode_image,
+                .subresourceRange{
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .baseMipLevel = 0,
+                    .levelCount = 1,
+                    .baseArrayLayer = 0,
+                    .layerCount = VK_REMAINING_ARRAY_LAYERS,
+                },
+            };
+            static constexpr VkMemoryBarrier encoded_barrier{
+                .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+            };
+            const VkBufferImageCopy copy{
+                .bufferOffset = encoded_offset,
+                .bufferRowLength = 0,
+                .bufferImageHeight = 0,
+                .imageSubresource{
+                    .aspectMask = aspect_mask,
+                    .mipLevel = level,
+                    .baseArrayLayer = 0,
+                    .layerCount = num_layers,
+                },
+                .imageOffset{0, 0, 0},
+                .imageExtent{level_width, level_height, 1},
+            };
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, decoded_barrier);
+            bcn_encoder_pass.Encode(cmdbuf, encode_descriptor_data, level_width, level_height,
+                                    num_layers, is_bc3);
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT, 0, encoded_barrier);
+            cmdbuf.CopyBufferToImage(encoded_buffer, vk_image, VK_IMAGE_LAYOUT_GENERAL, copy);
+        });
     }
-    scheduler.Record([vk_image, aspect_mask](vk::CommandBuffer cmdbuf) {
+    record([vk_image, aspect_mask, write_access, write_stage](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
             .pNext = nullptr,
-            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .srcAccessMask = write_access,
             .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
             .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
             .newLayout = VK_IMAGE_LAYOUT_GENERAL,
@@ -627,10 +978,68 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
                 .layerCount = VK_REMAINING_ARRAY_LAYERS,
             },
         };
-        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, image_barrier);
+        cmdbuf.PipelineBarrier(write_stage, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                               image_barrier);
+    });
+    if (async_compute) {
+        async_compute->Submit();
+    } else {
+        scheduler.EndProfileScope();
+        scheduler.Finish();
+    }
+}
+
+ASTCDecoderPass::TransientImage& ASTCDecoderPass::CreateTransientImage(u32 width, u32 height,
+                                                                       u32 layers) {
+    // Decoded images of previous uploads are only released once the GPU is done with them, the
+    // asynchronous queue is covered too since graphics submissions wait for it
+    while (!transient_images.empty() && scheduler.IsFree(transient_images.front().tick)) {
+        transient_images.pop_front();
+    }
+    static constexpr VkFormat format = VK_FORMAT_A8B8G8R8_UNORM_PACK32;
+    vk::Image transient_image = memory_allocator.CreateImage({
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = format,
+        .extent{width, height, 1},
+        .mipLevels = 1,
+        .arrayLayers = layers,
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_STORAGE_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+    });
+    vk::ImageView transient_view = device.GetLogical().CreateImageView({
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .image = *transient_image,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+        .format = format,
+        .components{
+            .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+        },
+        .subresourceRange{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = layers,
+        },
+    });
+    return transient_images.emplace_back(TransientImage{
+        .image = std::move(transient_image),
+        .view = std::move(transient_view),
+        .tick = scheduler.CurrentTick(),
     });
-    scheduler.Finish();
 }
 
 MSAACopyPass::MSAACopyPass(const Device& device_, Scheduler& scheduler_,
@@ -679,6 +1088,7 @@ void MSAACopyPass::CopyImage(Image& dst_image, Image& src_image,
                              bool msaa_to_non_msaa) {
     const VkPipeline msaa_pipeline = *pipelines[msaa_to_non_msaa ? 1 : 0];
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("MSAA copy");
     for (const VideoCommon::ImageCopy& copy : copies) {
         ASSERT(copy.src_subresource.base_layer == 0);
         ASSERT(copy.src_subresource.num_layers == 1);
@@ -727,6 +1137,7 @@ void MSAACopyPass::CopyImage(Image& dst_image, Image& src_image,
                                    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, write_barrier);
         });
     }
+    scheduler.EndProfileScope();
 }
 
 } // namespace Vulkan
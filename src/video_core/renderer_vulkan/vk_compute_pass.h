@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <deque>
 #include <optional>
 #include <span>
 #include <utility>
 
 #include "common/common_types.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
+#include "video_core/renderer_vulkan/vk_async_compute.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/texture_cache/types.h"
@@ -56,11 +59,18 @@ public:
                        ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
     ~Uint8Pass();
 
+    /// Returns the size in bytes of the uint16 indices assembled from num_vertices indices
+    static size_t AssembledSize(u32 num_vertices);
+
     /// Assemble uint8 indices into an uint16 index buffer
     /// Returns a pair with the staging buffer, and the offset where the assembled data is
     std::pair<VkBuffer, VkDeviceSize> Assemble(u32 num_vertices, VkBuffer src_buffer,
                                                u32 src_offset);
 
+    /// Assemble uint8 indices into the given buffer instead of a staging buffer
+    void AssembleTo(VkBuffer dst_buffer, VkDeviceSize dst_offset, u32 num_vertices,
+                    VkBuffer src_buffer, u32 src_offset);
+
 private:
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
@@ -75,10 +85,18 @@ public:
                              ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
     ~QuadIndexedPass();
 
+    /// Returns the size in bytes of the triangle indices assembled from num_vertices indices
+    static size_t AssembledSize(u32 num_vertices, bool is_strip);
+
     std::pair<VkBuffer, VkDeviceSize> Assemble(
         Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
         u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip);
 
+    /// Assemble the triangle indices into the given buffer instead of a staging buffer
+    void AssembleTo(VkBuffer dst_buffer, VkDeviceSize dst_offset,
+                    Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
+                    u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip);
+
 private:
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
@@ -112,6 +130,34 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+class DmaSwizzlePass final : public ComputePass {
+public:
+    explicit DmaSwizzlePass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~DmaSwizzlePass();
+
+    /// Copies between pitch linear and block linear memory, whose operands start at the given
+    /// offsets of the buffers. Elements and pitches have to be multiples of four bytes.
+    void Copy(VkBuffer src_buffer, u32 src_offset, VkBuffer dst_buffer, u32 dst_offset,
+              const Tegra::DMA::SwizzleCopy& copy);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
+class BCnEncoderPass final : public ComputePass {
+public:
+    explicit BCnEncoderPass(const Device& device_, DescriptorPool& descriptor_pool_);
+    ~BCnEncoderPass();
+
+    /// Records the encoding of an RGBA8 storage image into BC1 or BC3 blocks in a buffer.
+    /// The descriptor data has to hold the source image followed by the destination buffer.
+    void Encode(vk::CommandBuffer cmdbuf, const void* descriptor_data, u32 width, u32 height,
+                u32 layers, bool is_bc3);
+};
+
 class ASTCDecoderPass final : public ComputePass {
 public:
     explicit ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -125,10 +171,22 @@ public:
                   std::span<const VideoCommon::SwizzleParameters> swizzles);
 
 private:
+    /// RGBA8 image decoded into before recompression, kept alive until the GPU is done with it
+    struct TransientImage {
+        vk::Image image;
+        vk::ImageView view;
+        u64 tick;
+    };
+
+    TransientImage& CreateTransientImage(u32 width, u32 height, u32 layers);
+
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
     MemoryAllocator& memory_allocator;
+    std::optional<AsyncComputeQueue> async_compute;
+    BCnEncoderPass bcn_encoder_pass;
+    std::deque<TransientImage> transient_images;
 };
 
 class MSAACopyPass final : public ComputePass {
@@ -6,6 +6,7 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include "common/trace.h"
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -27,12 +28,12 @@ using Tegra::Texture::TexturePair;
 ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipeline_cache_,
                                  DescriptorPool& descriptor_pool,
                                  GuestDescriptorQueue& guest_descriptor_queue_,
-                                 Common::ThreadWorker* thread_worker,
+                                 Common::TaskGroup* thread_worker,
                                  PipelineStatistics* pipeline_statistics,
                                  VideoCore::ShaderNotify* shader_notify, const Shader::Info& info_,
-                                 vk::ShaderModule spv_module_)
-    : device{device_},
-      pipeline_cache(pipeline_cache_), guest_descriptor_queue{guest_descriptor_queue_}, info{info_},
+                                 vk::ShaderModule spv_module_, u64 shader_hash_)
+    : device{device_}, pipeline_cache(pipeline_cache_),
+      guest_descriptor_queue{guest_descriptor_queue_}, info{info_}, shader_hash{shader_hash_},
       spv_module(std::move(spv_module_)) {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
@@ -41,6 +42,8 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
                 uniform_buffer_sizes.begin());
 
     auto func{[this, &descriptor_pool, shader_notify, pipeline_statistics] {
+        TRACE_SCOPE(Shader, "BuildComputePipeline");
+        const auto build_start{std::chrono::steady_clock::now()};
         DescriptorLayoutBuilder builder{device};
         builder.Add(info, VK_SHADER_STAGE_COMPUTE_BIT);
 
@@ -79,8 +82,11 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
             },
             *pipeline_cache);
 
+        const auto compile_time{std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - build_start)};
+        compile_time_us.store(static_cast<u64>(compile_time.count()), std::memory_order::relaxed);
         if (pipeline_statistics) {
-            pipeline_statistics->Collect(*pipeline);
+            pipeline_statistics->Collect(*pipeline, compile_time);
         }
         std::scoped_lock lock{build_mutex};
         is_built = true;
@@ -4,11 +4,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 
 #include "common/common_types.h"
-#include "common/thread_worker.h"
+#include "common/task_scheduler.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
@@ -31,10 +32,10 @@ public:
     explicit ComputePipeline(const Device& device, vk::PipelineCache& pipeline_cache,
                              DescriptorPool& descriptor_pool,
                              GuestDescriptorQueue& guest_descriptor_queue,
-                             Common::ThreadWorker* thread_worker,
+                             Common::TaskGroup* thread_worker,
                              PipelineStatistics* pipeline_statistics,
                              VideoCore::ShaderNotify* shader_notify, const Shader::Info& info,
-                             vk::ShaderModule spv_module);
+                             vk::ShaderModule spv_module, u64 shader_hash);
 
     ComputePipeline& operator=(ComputePipeline&&) noexcept = delete;
     ComputePipeline(ComputePipeline&&) noexcept = delete;
@@ -45,11 +46,37 @@ public:
     void Configure(Tegra::Engines::KeplerCompute& kepler_compute, Tegra::MemoryManager& gpu_memory,
                    Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache);
 
+    /// Counts a use of this pipeline, only called from the GPU thread
+    void MarkUsed(u64 frame_number) noexcept {
+        if (use_count++ == 0) {
+            first_use_frame = frame_number;
+        }
+    }
+
+    [[nodiscard]] u64 UseCount() const noexcept {
+        return use_count;
+    }
+
+    [[nodiscard]] u64 FirstUseFrame() const noexcept {
+        return first_use_frame;
+    }
+
+    /// Hash of the guest shader this pipeline was built from
+    [[nodiscard]] u64 ShaderHash() const noexcept {
+        return shader_hash;
+    }
+
+    /// Time spent building the host pipeline, zero while it is not built
+    [[nodiscard]] std::chrono::microseconds CompileTime() const noexcept {
+        return std::chrono::microseconds{compile_time_us.load(std::memory_order::relaxed)};
+    }
+
 private:
     const Device& device;
     vk::PipelineCache& pipeline_cache;
     GuestDescriptorQueue& guest_descriptor_queue;
     Shader::Info info;
+    u64 shader_hash{};
 
     VideoCommon::ComputeUniformBufferSizes uniform_buffer_sizes{};
 
@@ -63,6 +90,9 @@ private:
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
+    u64 use_count{};
+    u64 first_use_frame{};
+    std::atomic<u64> compile_time_us{};
 };
 
 } // namespace Vulkan
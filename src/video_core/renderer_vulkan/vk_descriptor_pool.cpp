@@ -23,6 +23,7 @@ constexpr s32 SCORE_THRESHOLD = 3;
 struct DescriptorBank {
     DescriptorBankInfo info;
     std::vector<vk::DescriptorPool> pools;
+    std::mutex mutex; ///< Serializes commits of all allocators sharing this bank
 };
 
 bool DescriptorBankInfo::IsSuperset(const DescriptorBankInfo& subset) const noexcept {
@@ -90,6 +91,8 @@ DescriptorAllocator::DescriptorAllocator(const Device& device_, MasterSemaphore&
       layout{layout_} {}
 
 VkDescriptorSet DescriptorAllocator::Commit() {
+    // Commits happen on the scheduler threads, which can record in parallel
+    std::scoped_lock lock{bank->mutex};
     const size_t index = CommitResource();
     return sets[index / SETS_GROW_RATE][index % SETS_GROW_RATE];
 }
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_gpu_profiler.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+GpuProfiler::GpuProfiler(const Device& device_, const MasterSemaphore& master_semaphore_)
+    : device{device_}, master_semaphore{master_semaphore_}, scopes(NUM_SCOPES) {
+    query_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NUM_SCOPES * 2,
+        .pipelineStatistics = 0,
+    });
+    const u32 bits = device.GetGraphicsTimestampBits();
+    timestamp_mask = bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+    timestamp_period = static_cast<f64>(device.GetTimestampPeriod());
+
+    const auto log_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir);
+    const auto path = log_dir / "gpu_profile.json";
+    if (Common::FS::CreateDirs(log_dir)) {
+        trace_file.Open(path, Common::FS::FileAccessMode::Write, Common::FS::FileType::TextFile);
+    }
+    if (!trace_file.IsOpen()) {
+        LOG_ERROR(Render_Vulkan, "Failed to open {}, GPU work is not profiled",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    // The closing bracket of the event array is optional in the Chrome trace format, so a trace
+    // cut short by a crash can still be loaded
+    (void)trace_file.WriteString(std::string_view{"[\n"});
+    LOG_INFO(Render_Vulkan, "Writing GPU profile to {}", Common::FS::PathToUTF8String(path));
+}
+
+GpuProfiler::~GpuProfiler() {
+    if (dropped_scopes != 0) {
+        LOG_WARNING(Render_Vulkan, "{} GPU profiling scopes were dropped", dropped_scopes);
+    }
+}
+
+u32 GpuProfiler::Begin(std::string name) {
+    if (!trace_file.IsOpen()) {
+        return INVALID_SCOPE;
+    }
+    const u32 index = static_cast<u32>(next_scope % NUM_SCOPES);
+    Scope& scope = scopes[index];
+    if (scope.in_use) {
+        ++dropped_scopes;
+        return INVALID_SCOPE;
+    }
+    ++next_scope;
+    device.GetLogical().ResetQueryPool(*query_pool, index * 2, 2);
+    scope.name = std::move(name);
+    scope.shaders.clear();
+    scope.tick = 0;
+    scope.in_use = true;
+    scope.ended = false;
+    return index;
+}
+
+void GpuProfiler::End(u32 scope, u64 tick) {
+    if (scope == INVALID_SCOPE) {
+        return;
+    }
+    scopes[scope].tick = tick;
+    scopes[scope].ended = true;
+}
+
+void GpuProfiler::AddShader(u32 scope, u64 shader_hash) {
+    if (scope == INVALID_SCOPE) {
+        return;
+    }
+    auto& shaders = scopes[scope].shaders;
+    if (shaders.size() < MAX_SHADERS && std::ranges::find(shaders, shader_hash) == shaders.end()) {
+        shaders.push_back(shader_hash);
+    }
+}
+
+void GpuProfiler::WriteTimestamp(vk::CommandBuffer cmdbuf, u32 scope, bool end) const {
+    if (scope == INVALID_SCOPE) {
+        return;
+    }
+    const VkPipelineStageFlagBits stage =
+        end ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    cmdbuf.WriteTimestamp(stage, *query_pool, scope * 2 + (end ? 1 : 0));
+}
+
+void GpuProfiler::Collect() {
+    const u64 first_scope = oldest_scope;
+    while (oldest_scope != next_scope) {
+        const u32 index = static_cast<u32>(oldest_scope % NUM_SCOPES);
+        Scope& scope = scopes[index];
+        if (!scope.ended || !master_semaphore.IsFree(scope.tick)) {
+            break;
+        }
+        std::array<u64, 2> timestamps{};
+        const VkResult result = device.GetLogical().GetQueryResults(
+            *query_pool, index * 2, 2, sizeof(timestamps), timestamps.data(), sizeof(u64),
+            VK_QUERY_RESULT_64_BIT);
+        if (result == VK_SUCCESS) {
+            WriteEvent(scope, timestamps[0], timestamps[1]);
+        }
+        scope.in_use = false;
+        ++oldest_scope;
+    }
+    if (oldest_scope != first_scope) {
+        (void)trace_file.Flush();
+    }
+}
+
+void GpuProfiler::WriteEvent(const Scope& scope, u64 begin, u64 end) {
+    if (!base_timestamp) {
+        base_timestamp = begin;
+    }
+    const auto to_us = [this](u64 ticks) {
+        return static_cast<f64>(ticks & timestamp_mask) * timestamp_period / 1000.0;
+    };
+    std::string shaders;
+    for (const u64 hash : scope.shaders) {
+        shaders += fmt::format("{}{:016x}", shaders.empty() ? "" : " ", hash);
+    }
+    const std::string event = fmt::format(
+        "{{\"name\":\"{}\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+        "\"pid\":0,\"tid\":0,\"args\":{{\"shaders\":\"{}\"}}}},\n",
+        scope.name, to_us(begin - *base_timestamp), to_us(end - begin), shaders);
+    (void)trace_file.WriteString(event);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MasterSemaphore;
+
+/**
+ * Times scopes of GPU work with timestamp queries and writes them to a Chrome trace file.
+ *
+ * Scopes are opened and closed from the GPU thread while commands are recorded. They are
+ * resolved in the order they were opened once the GPU has finished the execution context they
+ * were closed in, without waiting for it.
+ */
+class GpuProfiler {
+public:
+    static constexpr u32 INVALID_SCOPE = ~0U;
+
+    explicit GpuProfiler(const Device& device, const MasterSemaphore& master_semaphore);
+    ~GpuProfiler();
+
+    /// Opens a scope, returns INVALID_SCOPE when too many scopes are waiting to be resolved
+    [[nodiscard]] u32 Begin(std::string name);
+
+    /// Closes a scope recorded in the execution context of a tick
+    void End(u32 scope, u64 tick);
+
+    /// Adds a shader used by an open scope to its trace arguments
+    void AddShader(u32 scope, u64 shader_hash);
+
+    /// Writes the timestamp opening or closing a scope
+    void WriteTimestamp(vk::CommandBuffer cmdbuf, u32 scope, bool end) const;
+
+    /// Writes the scopes the GPU has finished to the trace
+    void Collect();
+
+private:
+    /// Number of scopes that can wait to be resolved at the same time
+    static constexpr u32 NUM_SCOPES = 4096;
+    /// Number of shaders listed in the trace arguments of a scope
+    static constexpr size_t MAX_SHADERS = 8;
+
+    struct Scope {
+        std::string name;
+        boost::container::small_vector<u64, 4> shaders;
+        u64 tick{};
+        bool in_use{};
+        bool ended{};
+    };
+
+    void WriteEvent(const Scope& scope, u64 begin, u64 end);
+
+    const Device& device;
+    const MasterSemaphore& master_semaphore;
+    vk::QueryPool query_pool;
+    std::vector<Scope> scopes;
+    u64 next_scope{};
+    u64 oldest_scope{};
+    u64 dropped_scopes{};
+    u64 timestamp_mask{};
+    f64 timestamp_period{};
+    std::optional<u64> base_timestamp;
+    Common::FS::IOFile trace_file;
+};
+
+} // namespace Vulkan
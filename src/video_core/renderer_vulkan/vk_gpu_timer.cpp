@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <mutex>
+
+#include "video_core/renderer_vulkan/vk_gpu_timer.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+GpuTimer::GpuTimer(const Device& device_, const MasterSemaphore& master_semaphore_)
+    : device{device_}, master_semaphore{master_semaphore_} {
+    query_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = static_cast<u32>(NUM_SLOTS * 2),
+        .pipelineStatistics = 0,
+    });
+    const u32 bits = device.GetGraphicsTimestampBits();
+    timestamp_mask = bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+    timestamp_period = static_cast<f64>(device.GetTimestampPeriod());
+}
+
+GpuTimer::~GpuTimer() = default;
+
+void GpuTimer::Begin(vk::CommandBuffer cmdbuf, u64 tick) {
+    std::scoped_lock lock{mutex};
+    Collect();
+    const u32 index = static_cast<u32>(tick % NUM_SLOTS);
+    Slot& slot = slots[index];
+    if (slot.tick != 0) {
+        // Too many submissions in flight, leave this one unmeasured
+        return;
+    }
+    device.GetLogical().ResetQueryPool(*query_pool, index * 2, 2);
+    cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, *query_pool, index * 2);
+    slot.tick = tick;
+    slot.ended = false;
+}
+
+void GpuTimer::End(vk::CommandBuffer cmdbuf, u64 tick) {
+    std::scoped_lock lock{mutex};
+    const u32 index = static_cast<u32>(tick % NUM_SLOTS);
+    Slot& slot = slots[index];
+    if (slot.tick != tick) {
+        return;
+    }
+    cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *query_pool, index * 2 + 1);
+    slot.ended = true;
+}
+
+u64 GpuTimer::GetGpuTime() {
+    std::scoped_lock lock{mutex};
+    Collect();
+    return total_ns;
+}
+
+void GpuTimer::Collect() {
+    for (u32 index = 0; index < static_cast<u32>(NUM_SLOTS); ++index) {
+        Slot& slot = slots[index];
+        if (slot.tick == 0 || !slot.ended || !master_semaphore.IsFree(slot.tick)) {
+            continue;
+        }
+        std::array<u64, 2> timestamps{};
+        const VkResult result = device.GetLogical().GetQueryResults(
+            *query_pool, index * 2, 2, sizeof(timestamps), timestamps.data(), sizeof(u64),
+            VK_QUERY_RESULT_64_BIT);
+        slot.tick = 0;
+        if (result != VK_SUCCESS) {
+            continue;
+        }
+        const u64 ticks = (timestamps[1] - timestamps[0]) & timestamp_mask;
+        total_ns += static_cast<u64>(static_cast<f64>(ticks) * timestamp_period);
+    }
+}
+
+} // namespace Vulkan
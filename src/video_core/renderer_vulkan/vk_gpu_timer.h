@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MasterSemaphore;
+
+/// Measures the time the GPU spends executing each submission with timestamp queries
+class GpuTimer {
+public:
+    explicit GpuTimer(const Device& device, const MasterSemaphore& master_semaphore);
+    ~GpuTimer();
+
+    /// Writes the timestamp starting the measurement of the submission of a tick
+    void Begin(vk::CommandBuffer cmdbuf, u64 tick);
+
+    /// Writes the timestamp ending the measurement of the submission of a tick
+    void End(vk::CommandBuffer cmdbuf, u64 tick);
+
+    /// Returns the total time in nanoseconds the GPU spent on the measured submissions it
+    /// has finished so far
+    [[nodiscard]] u64 GetGpuTime();
+
+private:
+    /// Number of submissions that can be measured at the same time
+    static constexpr size_t NUM_SLOTS = 256;
+
+    struct Slot {
+        u64 tick{};   ///< Tick of the measured submission, zero when the slot is free
+        bool ended{}; ///< The timestamp ending the measurement has been written
+    };
+
+    /// Adds the time of the finished submissions and frees their slots
+    void Collect();
+
+    const Device& device;
+    const MasterSemaphore& master_semaphore;
+    vk::QueryPool query_pool;
+    std::array<Slot, NUM_SLOTS> slots{};
+    u64 timestamp_mask{};
+    f64 timestamp_period{};
+    u64 total_ns{};
+    std::mutex mutex;
+};
+
+} // namespace Vulkan
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstddef>
 #include <span>
 
 #include <boost/container/small_vector.hpp>
@@ -10,6 +11,8 @@
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 
 #include "common/bit_field.h"
+#include "common/thread.h"
+#include "common/trace.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -143,7 +146,7 @@ size_t NumAttachments(const FixedPipelineState& state) {
 }
 
 template <typename Spec>
-bool Passes(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+bool Passes(const GraphicsPipeline::ShaderModules& modules,
             const std::array<Shader::Info, NUM_STAGES>& stage_infos) {
     for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
         if (!Spec::enabled_stages[stage] && modules[stage]) {
@@ -177,7 +180,7 @@ bool Passes(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
 using ConfigureFuncPtr = void (*)(GraphicsPipeline*, bool);
 
 template <typename Spec, typename... Specs>
-ConfigureFuncPtr FindSpec(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+ConfigureFuncPtr FindSpec(const GraphicsPipeline::ShaderModules& modules,
                           const std::array<Shader::Info, NUM_STAGES>& stage_infos) {
     if constexpr (sizeof...(Specs) > 0) {
         if (!Passes<Spec>(modules, stage_infos)) {
@@ -227,7 +230,7 @@ struct DefaultSpec {
     static constexpr bool has_images = true;
 };
 
-ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+ConfigureFuncPtr ConfigureFunc(const GraphicsPipeline::ShaderModules& modules,
                                const std::array<Shader::Info, NUM_STAGES>& infos) {
     return FindSpec<SimpleVertexSpec, SimpleVertexFragmentSpec, SimpleStorageSpec, SimpleImageSpec,
                     DefaultSpec>(modules, infos);
@@ -238,13 +241,15 @@ GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
     vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
     const Device& device_, DescriptorPool& descriptor_pool,
-    GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
-    PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-    const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
-    const std::array<const Shader::Info*, NUM_STAGES>& infos)
+    GuestDescriptorQueue& guest_descriptor_queue_, Common::TaskGroup* worker_thread,
+    Common::TaskGroup* optimize_thread_, PipelineStatistics* pipeline_statistics,
+    RenderPassCache& render_pass_cache, const GraphicsPipelineCacheKey& key_,
+    ShaderModules stages, const std::array<const Shader::Info*, NUM_STAGES>& infos,
+    const Shader::SpecializationValues& specialization_values_)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
       pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)},
+      specialization_values{specialization_values_}, optimize_thread{optimize_thread_} {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
@@ -259,6 +264,8 @@ GraphicsPipeline::GraphicsPipeline(
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
     auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
+        TRACE_SCOPE(Shader, "BuildGraphicsPipeline");
+        const auto build_start{std::chrono::steady_clock::now()};
         DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
         uses_push_descriptor = builder.CanUsePushDescriptor();
         descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
@@ -273,16 +280,24 @@ GraphicsPipeline::GraphicsPipeline(
         const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
         Validate();
         MakePipeline(render_pass);
+        const auto compile_time{std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - build_start)};
+        compile_time_us.store(static_cast<u64>(compile_time.count()), std::memory_order::relaxed);
         if (pipeline_statistics) {
-            pipeline_statistics->Collect(*pipeline);
+            pipeline_statistics->Collect(*pipeline, compile_time);
         }
 
-        std::scoped_lock lock{build_mutex};
-        is_built = true;
-        build_condvar.notify_one();
+        {
+            std::scoped_lock lock{build_mutex};
+            is_built = true;
+            build_condvar.notify_all();
+        }
         if (shader_notify) {
             shader_notify->MarkShaderComplete();
         }
+        if (libraries[0]) {
+            optimize_thread->QueueWork([this] { OptimizePipeline(); });
+        }
     }};
     if (worker_thread) {
         worker_thread->QueueWork(std::move(func));
@@ -295,6 +310,7 @@ GraphicsPipeline::GraphicsPipeline(
 void GraphicsPipeline::AddTransition(GraphicsPipeline* transition) {
     transition_keys.push_back(transition->key);
     transitions.push_back(transition);
+    PushRecentTransition(transitions.size() - 1);
 }
 
 template <typename Spec>
@@ -502,13 +518,15 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     const bool is_rescaling{texture_cache.IsRescaling()};
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
     const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
+    const bool bind_descriptors{
+        scheduler.UpdateGraphicsDescriptors(guest_descriptor_queue.UpdateEntries())};
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
-                      is_rescaling, update_rescaling,
+    scheduler.Record([this, descriptor_data, bind_pipeline, bind_descriptors,
+                      rescaling_data = rescaling.Data(), is_rescaling, update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, ExecutablePipeline());
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -525,7 +543,7 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
                                  RENDERAREA_LAYOUT_OFFSET, sizeof(render_area_data),
                                  &render_area_data);
         }
-        if (!descriptor_set_layout) {
+        if (!descriptor_set_layout || !bind_descriptors) {
             return;
         }
         if (uses_push_descriptor) {
@@ -840,6 +858,14 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
             };
             dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
         }
+        if (key.state.extended_dynamic_state_3_rasterization) {
+            static constexpr std::array extended3{
+                VK_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT,
+            };
+            dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
+        }
     }
     const VkPipelineDynamicStateCreateInfo dynamic_state_ci{
         .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
@@ -853,6 +879,32 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         .pNext = nullptr,
         .requiredSubgroupSize = GuestWarpSize,
     };
+    // Every stage gets all the constants, the ones a module does not use are ignored
+    using Shader::SpecializationConstant;
+    using Shader::SpecializationValues;
+    const auto map_entry{[](SpecializationConstant id, size_t offset, size_t size) {
+        return VkSpecializationMapEntry{
+            .constantID = static_cast<u32>(id),
+            .offset = static_cast<u32>(offset),
+            .size = size,
+        };
+    }};
+    const std::array specialization_entries{
+        map_entry(SpecializationConstant::AlphaTestFunc,
+                  offsetof(SpecializationValues, alpha_test_func), sizeof(u32)),
+        map_entry(SpecializationConstant::AlphaTestReference,
+                  offsetof(SpecializationValues, alpha_test_reference), sizeof(f32)),
+        map_entry(SpecializationConstant::FixedStatePointSize,
+                  offsetof(SpecializationValues, fixed_state_point_size), sizeof(f32)),
+        map_entry(SpecializationConstant::YNegate, offsetof(SpecializationValues, y_negate),
+                  sizeof(VkBool32)),
+    };
+    const VkSpecializationInfo specialization_info{
+        .mapEntryCount = static_cast<u32>(specialization_entries.size()),
+        .pMapEntries = specialization_entries.data(),
+        .dataSize = sizeof(specialization_values),
+        .pData = &specialization_values,
+    };
     static_vector<VkPipelineShaderStageCreateInfo, 5> shader_stages;
     for (size_t stage = 0; stage < Maxwell::MaxShaderStage; ++stage) {
         if (!spv_modules[stage]) {
@@ -864,9 +916,9 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
                 .pNext = nullptr,
                 .flags = 0,
                 .stage = MaxwellToVK::ShaderStage(Shader::StageFromIndex(stage)),
-                .module = *spv_modules[stage],
+                .module = **spv_modules[stage],
                 .pName = "main",
-                .pSpecializationInfo = nullptr,
+                .pSpecializationInfo = &specialization_info,
             });
         /*
         if (program[stage]->entries.uses_warps && device.IsGuestWarpSizeSupported(stage_ci.stage)) {
@@ -878,24 +930,106 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
-    pipeline = device.GetLogical().CreateGraphicsPipeline(
+    const VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = render_pass,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    if (!optimize_thread) {
+        pipeline = device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+        return;
+    }
+    // Compiling the parts separately without link time optimizations and linking them is much
+    // faster than a monolithic build. The optimized pipeline is built later in the background.
+    MakeLibraries(pipeline_ci);
+    pipeline = LinkLibraries(flags);
+}
+
+void GraphicsPipeline::MakeLibraries(const VkGraphicsPipelineCreateInfo& pipeline_ci) {
+    static constexpr std::array<VkGraphicsPipelineLibraryFlagsEXT, 4> library_parts{
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+    };
+    static_vector<VkPipelineShaderStageCreateInfo, 5> pre_rasterization_stages;
+    static_vector<VkPipelineShaderStageCreateInfo, 1> fragment_stages;
+    for (const auto& stage : std::span(pipeline_ci.pStages, pipeline_ci.stageCount)) {
+        if (stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+            fragment_stages.push_back(stage);
+        } else {
+            pre_rasterization_stages.push_back(stage);
+        }
+    }
+    for (size_t part = 0; part < library_parts.size(); ++part) {
+        const VkGraphicsPipelineLibraryCreateInfoEXT library_ci{
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            .pNext = nullptr,
+            .flags = library_parts[part],
+        };
+        // State that does not belong to the library part is ignored by the driver
+        VkGraphicsPipelineCreateInfo ci{pipeline_ci};
+        ci.pNext = &library_ci;
+        ci.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                   VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        ci.stageCount = 0;
+        ci.pStages = nullptr;
+        if (library_parts[part] == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
+            ci.stageCount = static_cast<u32>(pre_rasterization_stages.size());
+            ci.pStages = pre_rasterization_stages.data();
+        } else if (library_parts[part] == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
+            ci.stageCount = static_cast<u32>(fragment_stages.size());
+            ci.pStages = fragment_stages.data();
+        }
+        libraries[part] = device.GetLogical().CreateGraphicsPipeline(ci, *pipeline_cache);
+    }
+}
+
+vk::Pipeline GraphicsPipeline::LinkLibraries(VkPipelineCreateFlags flags) const {
+    std::array<VkPipeline, 4> handles;
+    std::ranges::transform(libraries, handles.begin(), [](const vk::Pipeline& library) {
+        return *library;
+    });
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(handles.size()),
+        .pLibraries = handles.data(),
+    };
+    return device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
+            .pNext = &library_ci,
             .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
             .layout = *pipeline_layout,
-            .renderPass = render_pass,
+            .renderPass = nullptr,
             .subpass = 0,
             .basePipelineHandle = nullptr,
             .basePipelineIndex = 0,
@@ -903,6 +1037,17 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         *pipeline_cache);
 }
 
+void GraphicsPipeline::OptimizePipeline() {
+    try {
+        optimized_pipeline = LinkLibraries(VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+    } catch (const vk::Exception& exception) {
+        LOG_ERROR(Render_Vulkan, "Failed to optimize pipeline: {}", exception.what());
+        return;
+    }
+    // The fast linked pipeline is kept alive, it may still be in use by the GPU
+    is_optimized.store(true, std::memory_order::release);
+}
+
 void GraphicsPipeline::Validate() {
     size_t num_images{};
     for (const auto& info : stage_infos) {
@@ -6,11 +6,14 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
-#include "common/thread_worker.h"
+#include "common/task_scheduler.h"
+#include "shader_recompiler/runtime_info.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -69,14 +72,19 @@ class GraphicsPipeline {
     static constexpr size_t NUM_STAGES = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
 
 public:
+    /// Shader modules of each stage, shared between pipelines emitting identical SPIR-V
+    using ShaderModules = std::array<std::shared_ptr<const vk::ShaderModule>, NUM_STAGES>;
+
     explicit GraphicsPipeline(
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
         vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
         const Device& device, DescriptorPool& descriptor_pool,
-        GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
-        PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-        const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
-        const std::array<const Shader::Info*, NUM_STAGES>& infos);
+        GuestDescriptorQueue& guest_descriptor_queue, Common::TaskGroup* worker_thread,
+        Common::TaskGroup* optimize_thread, PipelineStatistics* pipeline_statistics,
+        RenderPassCache& render_pass_cache,
+        const GraphicsPipelineCacheKey& key, ShaderModules stages,
+        const std::array<const Shader::Info*, NUM_STAGES>& infos,
+        const Shader::SpecializationValues& specialization_values);
 
     GraphicsPipeline& operator=(GraphicsPipeline&&) noexcept = delete;
     GraphicsPipeline(GraphicsPipeline&&) noexcept = delete;
@@ -94,15 +102,64 @@ public:
         if (key == current_key) {
             return this;
         }
+        // Guests tend to cycle between a few pipelines, try the latest transitions taken first
+        const auto recent_end{recent_transitions.begin() + num_recent_transitions};
+        for (auto recent = recent_transitions.begin(); recent != recent_end; ++recent) {
+            if (transition_keys[*recent] == current_key) {
+                std::rotate(recent_transitions.begin(), recent, recent + 1);
+                return transitions[recent_transitions.front()];
+            }
+        }
         const auto it{std::find(transition_keys.begin(), transition_keys.end(), current_key)};
-        return it != transition_keys.end() ? transitions[std::distance(transition_keys.begin(), it)]
-                                           : nullptr;
+        if (it == transition_keys.end()) {
+            return nullptr;
+        }
+        const size_t index = std::distance(transition_keys.begin(), it);
+        PushRecentTransition(index);
+        return transitions[index];
     }
 
     [[nodiscard]] bool IsBuilt() const noexcept {
         return is_built.load(std::memory_order::relaxed);
     }
 
+    /// Waits up to the timeout for the pipeline to be built, returns true when it is
+    [[nodiscard]] bool WaitForBuild(std::chrono::microseconds timeout) {
+        std::unique_lock lock{build_mutex};
+        return build_condvar.wait_for(lock, timeout,
+                                      [this] { return is_built.load(std::memory_order::relaxed); });
+    }
+
+    /// Returns the hash of the last shader stage of the pipeline, usually the fragment shader
+    [[nodiscard]] u64 ShaderHash() const noexcept {
+        for (size_t stage = key.unique_hashes.size(); stage-- > 0;) {
+            if (key.unique_hashes[stage] != 0) {
+                return key.unique_hashes[stage];
+            }
+        }
+        return 0;
+    }
+
+    /// Counts a use of this pipeline, only called from the GPU thread
+    void MarkUsed(u64 frame_number) noexcept {
+        if (use_count++ == 0) {
+            first_use_frame = frame_number;
+        }
+    }
+
+    [[nodiscard]] u64 UseCount() const noexcept {
+        return use_count;
+    }
+
+    [[nodiscard]] u64 FirstUseFrame() const noexcept {
+        return first_use_frame;
+    }
+
+    /// Time spent building the host pipeline, zero while it is not built
+    [[nodiscard]] std::chrono::microseconds CompileTime() const noexcept {
+        return std::chrono::microseconds{compile_time_us.load(std::memory_order::relaxed)};
+    }
+
     template <typename Spec>
     static auto MakeConfigureSpecFunc() {
         return [](GraphicsPipeline* pl, bool is_indexed) { pl->ConfigureImpl<Spec>(is_indexed); };
@@ -122,8 +179,29 @@ private:
 
     void MakePipeline(VkRenderPass render_pass);
 
+    /// Builds the pipeline libraries of each part of the pipeline described by pipeline_ci
+    void MakeLibraries(const VkGraphicsPipelineCreateInfo& pipeline_ci);
+
+    /// Links the pipeline libraries into an executable pipeline
+    vk::Pipeline LinkLibraries(VkPipelineCreateFlags flags) const;
+
+    /// Replaces the fast linked pipeline with a link time optimized one
+    void OptimizePipeline();
+
+    /// Returns the most optimized executable pipeline available
+    [[nodiscard]] VkPipeline ExecutablePipeline() const noexcept {
+        return is_optimized.load(std::memory_order::acquire) ? *optimized_pipeline : *pipeline;
+    }
+
     void Validate();
 
+    /// Marks a transition as the most recently taken one
+    void PushRecentTransition(size_t index) noexcept {
+        num_recent_transitions = std::min(num_recent_transitions + 1, recent_transitions.size());
+        std::shift_right(recent_transitions.begin(), recent_transitions.end(), 1);
+        recent_transitions.front() = index;
+    }
+
     const GraphicsPipelineCacheKey key;
     Tegra::Engines::Maxwell3D* maxwell3d;
     Tegra::MemoryManager* gpu_memory;
@@ -138,8 +216,13 @@ private:
 
     std::vector<GraphicsPipelineCacheKey> transition_keys;
     std::vector<GraphicsPipeline*> transitions;
+    /// Indices of the latest transitions taken, most recent first
+    std::array<size_t, 4> recent_transitions{};
+    size_t num_recent_transitions{};
 
-    std::array<vk::ShaderModule, NUM_STAGES> spv_modules;
+    ShaderModules spv_modules;
+    /// Fixed state the shared modules are specialized with
+    Shader::SpecializationValues specialization_values;
 
     std::array<Shader::Info, NUM_STAGES> stage_infos;
     std::array<u32, 5> enabled_uniform_buffer_masks{};
@@ -152,10 +235,19 @@ private:
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
 
+    /// Vertex input, pre-rasterization, fragment shader and fragment output libraries
+    std::array<vk::Pipeline, 4> libraries;
+    vk::Pipeline optimized_pipeline;
+    Common::TaskGroup* optimize_thread{};
+    std::atomic_bool is_optimized{false};
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    u64 use_count{};
+    u64 first_use_frame{};
+    std::atomic<u64> compile_time_us{};
 };
 
 } // namespace Vulkan
@@ -111,6 +111,15 @@ VkResult MasterSemaphore::SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuff
     }
 }
 
+void MasterSemaphore::WaitOnSubmit(u64 host_tick, VkSemaphore timeline_semaphore, u64 value) {
+    std::scoped_lock lock{timeline_wait_mutex};
+    timeline_waits.push_back({
+        .host_tick = host_tick,
+        .semaphore = timeline_semaphore,
+        .value = value,
+    });
+}
+
 static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
@@ -128,12 +137,33 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
 
     const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
 
-    const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
+    std::vector<VkSemaphore> wait_semaphores;
+    std::vector<u64> wait_values;
+    std::vector<VkPipelineStageFlags> wait_stages;
+    if (wait_semaphore) {
+        wait_semaphores.push_back(wait_semaphore);
+        wait_values.push_back(0);
+        wait_stages.push_back(wait_stage_masks[0]);
+    }
+    {
+        // Consume the timeline waits requested for this or any previous tick
+        std::scoped_lock lock{timeline_wait_mutex};
+        std::erase_if(timeline_waits, [&](const TimelineWait& wait) {
+            if (wait.host_tick > host_tick) {
+                return false;
+            }
+            wait_semaphores.push_back(wait.semaphore);
+            wait_values.push_back(wait.value);
+            wait_stages.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+            return true;
+        });
+    }
+    const u32 num_wait_semaphores = static_cast<u32>(wait_semaphores.size());
     const VkTimelineSemaphoreSubmitInfo timeline_si{
         .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
         .pNext = nullptr,
-        .waitSemaphoreValueCount = 0,
-        .pWaitSemaphoreValues = nullptr,
+        .waitSemaphoreValueCount = num_wait_semaphores,
+        .pWaitSemaphoreValues = wait_values.data(),
         .signalSemaphoreValueCount = num_signal_semaphores,
         .pSignalSemaphoreValues = signal_values.data(),
     };
@@ -141,8 +171,8 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
         .pNext = &timeline_si,
         .waitSemaphoreCount = num_wait_semaphores,
-        .pWaitSemaphores = &wait_semaphore,
-        .pWaitDstStageMask = wait_stage_masks.data(),
+        .pWaitSemaphores = wait_semaphores.data(),
+        .pWaitDstStageMask = wait_stages.data(),
         .commandBufferCount = static_cast<u32>(cmdbuffers.size()),
         .pCommandBuffers = cmdbuffers.data(),
         .signalSemaphoreCount = num_signal_semaphores,
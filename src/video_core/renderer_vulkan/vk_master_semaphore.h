@@ -9,6 +9,7 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -45,6 +46,11 @@ public:
         return current_tick.fetch_add(1, std::memory_order_release);
     }
 
+    /// Returns the timeline semaphore signaled by graphics submissions, null when unsupported.
+    [[nodiscard]] VkSemaphore GetTimelineSemaphore() const noexcept {
+        return *semaphore;
+    }
+
     /// Refresh the known GPU tick
     void Refresh();
 
@@ -55,7 +61,17 @@ public:
     VkResult SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                          VkSemaphore signal_semaphore, VkSemaphore wait_semaphore, u64 host_tick);
 
+    /// Makes the submission of a host tick wait for a timeline semaphore value on the GPU.
+    /// Only honored when the device supports timeline semaphores.
+    void WaitOnSubmit(u64 host_tick, VkSemaphore timeline_semaphore, u64 value);
+
 private:
+    struct TimelineWait {
+        u64 host_tick;
+        VkSemaphore semaphore;
+        u64 value;
+    };
+
     VkResult SubmitQueueTimeline(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                  VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                                  u64 host_tick);
@@ -78,6 +94,8 @@ private:
     std::condition_variable_any wait_cv;
     std::queue<Waitable> wait_queue;  ///< Queue for the fences to be waited on by the wait thread.
     std::deque<vk::Fence> free_queue; ///< Holds available fences for submission.
+    std::mutex timeline_wait_mutex;
+    std::vector<TimelineWait> timeline_waits; ///< Waits to insert in upcoming submissions.
     std::jthread debug_thread;        ///< Debug thread to workaround validation layer bugs.
     std::jthread wait_thread;         ///< Helper thread that waits for submitted fences.
 };
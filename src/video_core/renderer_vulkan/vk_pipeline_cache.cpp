@@ -3,23 +3,36 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include "common/bit_cast.h"
-#include "common/cityhash.h"
+#include "common/div_ceil.h"
+#include "common/fast_hash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/memory_accounting.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
+#include "common/thread.h"
 #include "common/thread_worker.h"
+#include "common/trace.h"
+#include "common/unique_function.h"
+#include "common/zstd_compression.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/frontend/maxwell/translate_program.h"
 #include "shader_recompiler/program_header.h"
+#include "video_core/dirty_flags.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/memory_manager.h"
@@ -53,8 +66,31 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 
-constexpr u32 CACHE_VERSION = 11;
-constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
+constexpr u32 CACHE_VERSION = 13;
+constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'd'};
+
+/// Identity of the driver a Vulkan pipeline cache file was written by, checked before the cache
+/// data is read so that a driver update does not decompress and hand a stale cache to the driver
+struct VulkanCacheDriverHeader {
+    u32 vendor_id;
+    u32 device_id;
+    u32 driver_version;
+    std::array<u8, VK_UUID_SIZE> pipeline_cache_uuid;
+
+    bool operator==(const VulkanCacheDriverHeader&) const = default;
+};
+static_assert(std::has_unique_object_representations_v<VulkanCacheDriverHeader>);
+
+VulkanCacheDriverHeader MakeVulkanCacheDriverHeader(const Device& device) {
+    VulkanCacheDriverHeader header{
+        .vendor_id = device.GetVendorID(),
+        .device_id = device.GetDeviceID(),
+        .driver_version = device.GetDriverVersion(),
+        .pipeline_cache_uuid{},
+    };
+    std::ranges::copy(device.GetPipelineCacheUUID(), header.pipeline_cache_uuid.begin());
+    return header;
+}
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -260,9 +296,20 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
     }
     info.force_early_z = key.state.early_z != 0;
     info.y_negate = key.state.y_negate != 0;
+    info.specialize_fixed_state = true;
     return info;
 }
 
+Shader::SpecializationValues MakeSpecializationValues(const GraphicsPipelineCacheKey& key) {
+    return Shader::SpecializationValues{
+        .alpha_test_func = static_cast<u32>(MaxwellToCompareFunction(
+            key.state.UnpackComparisonOp(key.state.alpha_test_func.Value()))),
+        .alpha_test_reference = Common::BitCast<f32>(key.state.alpha_test_ref),
+        .fixed_state_point_size = Common::BitCast<f32>(key.state.point_size),
+        .y_negate = key.state.y_negate != 0 ? 1U : 0U,
+    };
+}
+
 size_t GetTotalPipelineWorkers() {
     const size_t max_core_threads =
         std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 2ULL) - 1ULL;
@@ -281,8 +328,7 @@ size_t GetTotalPipelineWorkers() {
 } // Anonymous namespace
 
 size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
-    return static_cast<size_t>(hash);
+    return static_cast<size_t>(Common::FastHash64(*this));
 }
 
 bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) const noexcept {
@@ -290,8 +336,7 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
-    return static_cast<size_t>(hash);
+    return static_cast<size_t>(Common::FastHash64(this, Size()));
 }
 
 bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) const noexcept {
@@ -310,9 +355,14 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
       texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
-      workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
-              "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+      use_pipeline_library{device.IsExtGraphicsPipelineLibrarySupported() &&
+                           Settings::values.use_pipeline_library.GetValue()},
+      workers(Common::TaskPriority::FrameCritical,
+              device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers()),
+      serialization_thread(1, "VkPipelineSerialization"),
+      background_workers(Common::TaskPriority::Background,
+                         device.HasBrokenParallelShaderCompiling() ? 1ULL
+                                                                   : GetTotalPipelineWorkers()) {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -356,6 +406,8 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
 
         .warp_size_potentially_larger_than_guest = device.IsWarpSizePotentiallyBiggerThanGuest(),
 
+        .optimize_spirv = Settings::values.optimize_spirv.GetValue(),
+
         .lower_left_origin_mode = false,
         .need_declared_frag_colors = false,
         .need_gather_subpixel_offset = driver_id == VK_DRIVER_ID_AMD_PROPRIETARY ||
@@ -407,11 +459,14 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_extended_dynamic_state_2_extra = device.IsExtExtendedDynamicState2ExtrasSupported(),
         .has_extended_dynamic_state_3_blend = device.IsExtExtendedDynamicState3BlendingSupported(),
         .has_extended_dynamic_state_3_enables = device.IsExtExtendedDynamicState3EnablesSupported(),
+        .has_extended_dynamic_state_3_rasterization =
+            device.IsExtExtendedDynamicState3RasterizationSupported(),
         .has_dynamic_vertex_input = device.IsExtVertexInputDynamicStateSupported(),
     };
 }
 
 PipelineCache::~PipelineCache() {
+    SavePipelineUsage();
     if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty()) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
@@ -421,16 +476,26 @@ PipelineCache::~PipelineCache() {
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
     MICROPROFILE_SCOPE(Vulkan_PipelineCache);
 
+    const bool stages_dirty{maxwell3d->dirty.flags[VideoCommon::Dirty::Shaders]};
     if (!RefreshStages(graphics_key.unique_hashes)) {
         current_pipeline = nullptr;
+        current_key_maxwell3d = nullptr;
         return nullptr;
     }
-    graphics_key.state.Refresh(*maxwell3d, dynamic_features);
+    const bool state_changed{graphics_key.state.Refresh(*maxwell3d, dynamic_features)};
+    if (current_key_maxwell3d == maxwell3d && !stages_dirty && !state_changed) {
+        // Nothing the key is made of changed since it was last resolved to the current pipeline
+        current_pipeline->MarkUsed(frame_number);
+        return BuiltPipeline(current_pipeline);
+    }
+    current_key_maxwell3d = nullptr;
 
     if (current_pipeline) {
         GraphicsPipeline* const next{current_pipeline->Next(graphics_key)};
         if (next) {
             current_pipeline = next;
+            current_key_maxwell3d = maxwell3d;
+            current_pipeline->MarkUsed(frame_number);
             return BuiltPipeline(current_pipeline);
         }
     }
@@ -450,12 +515,15 @@ ComputePipeline* PipelineCache::CurrentComputePipeline() {
         .shared_memory_size = qmd.shared_alloc,
         .workgroup_size{qmd.block_dim_x, qmd.block_dim_y, qmd.block_dim_z},
     };
+    MergeBackgroundPipelines();
     const auto [pair, is_new]{compute_cache.try_emplace(key)};
     auto& pipeline{pair->second};
-    if (!is_new) {
-        return pipeline.get();
+    if (is_new) {
+        pipeline = CreateComputePipeline(key, shader);
+    }
+    if (pipeline) {
+        pipeline->MarkUsed(frame_number);
     }
-    pipeline = CreateComputePipeline(key, shader);
     return pipeline.get();
 }
 
@@ -478,38 +546,80 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, CACHE_VERSION);
     }
 
-    struct {
+    pipeline_usage_filename = base_dir / "vulkan_usage.bin";
+    pipeline_usage = VideoCommon::LoadPipelineUsage(pipeline_usage_filename, CACHE_VERSION);
+
+    struct LoadState {
         std::mutex mutex;
         size_t total{};
         size_t built{};
         bool has_loaded{};
         std::unique_ptr<PipelineStatistics> statistics;
-    } state;
+        // Entries that failed to build or validate, removed from the disk cache by compaction
+        std::unordered_set<ComputePipelineCacheKey> dead_compute;
+        std::unordered_set<GraphicsPipelineCacheKey> dead_graphics;
+    };
+    // Shared with the background builds, which outlive this function
+    const auto state{std::make_shared<LoadState>()};
+
+    struct BuildJob {
+        u32 use_count;
+        Common::UniqueFunction<void, bool> build;
+    };
+    std::vector<BuildJob> jobs;
+
+    // Keys seen while reading the cache, duplicated entries are dropped by compaction
+    std::unordered_set<ComputePipelineCacheKey> seen_compute;
+    std::unordered_set<GraphicsPipelineCacheKey> seen_graphics;
+    bool needs_compaction{};
 
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
-        state.statistics = std::make_unique<PipelineStatistics>(device);
+        state->statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!seen_compute.insert(key).second) {
+            needs_compaction = true;
+        }
 
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
+        auto build{[this, key, env_ = std::move(env), state,
+                    &callback](bool is_background) mutable {
             ShaderPools pools;
-            auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
-            std::scoped_lock lock{state.mutex};
+            auto pipeline{CreateComputePipeline(
+                pools, key, env_, is_background ? nullptr : state->statistics.get(), false)};
+            if (!pipeline) {
+                std::scoped_lock lock{state->mutex};
+                state->dead_compute.insert(key);
+            }
+            if (is_background) {
+                if (pipeline) {
+                    std::scoped_lock lock{background_mutex};
+                    background_compute.emplace_back(key, std::move(pipeline));
+                    has_background_pipelines.store(true, std::memory_order_release);
+                }
+                return;
+            }
+            std::scoped_lock lock{state->mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
             }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
+            ++state->built;
+            if (state->has_loaded) {
+                callback(VideoCore::LoadCallbackStage::Build, state->built, state->total);
             }
+        }};
+        jobs.push_back(BuildJob{
+            .use_count = PreviousUseCount(key.Hash()),
+            .build = std::move(build),
         });
-        ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!seen_graphics.insert(key).second) {
+            needs_compaction = true;
+        }
 
         if ((key.state.extended_dynamic_state != 0) !=
                 dynamic_features.has_extended_dynamic_state ||
@@ -521,52 +631,176 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
                 dynamic_features.has_extended_dynamic_state_3_blend ||
             (key.state.extended_dynamic_state_3_enables != 0) !=
                 dynamic_features.has_extended_dynamic_state_3_enables ||
+            (key.state.extended_dynamic_state_3_rasterization != 0) !=
+                dynamic_features.has_extended_dynamic_state_3_rasterization ||
             (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
+            // Still valid for other devices and settings, the entry is kept on disk
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
+        auto build{[this, key, envs_ = std::move(envs), state,
+                    &callback](bool is_background) mutable {
             ShaderPools pools;
             boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
             for (auto& env : envs_) {
                 env_ptrs.push_back(&env);
             }
             auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
-                                                 state.statistics.get(), false)};
-
-            std::scoped_lock lock{state.mutex};
+                                                 is_background ? nullptr
+                                                               : state->statistics.get(),
+                                                 false)};
+            if (!pipeline) {
+                std::scoped_lock lock{state->mutex};
+                state->dead_graphics.insert(key);
+            }
+            if (is_background) {
+                if (pipeline) {
+                    std::scoped_lock lock{background_mutex};
+                    background_graphics.emplace_back(key, std::move(pipeline));
+                    has_background_pipelines.store(true, std::memory_order_release);
+                }
+                return;
+            }
+            std::scoped_lock lock{state->mutex};
             if (pipeline) {
                 graphics_cache.emplace(key, std::move(pipeline));
             }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
+            ++state->built;
+            if (state->has_loaded) {
+                callback(VideoCore::LoadCallbackStage::Build, state->built, state->total);
             }
+        }};
+        jobs.push_back(BuildJob{
+            .use_count = PreviousUseCount(key.Hash()),
+            .build = std::move(build),
         });
-        ++state.total;
     }};
-    VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
-                               load_graphics);
-
-    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}", state.total);
-
-    std::unique_lock lock{state.mutex};
-    callback(VideoCore::LoadCallbackStage::Build, 0, state.total);
-    state.has_loaded = true;
+    // Caches that grew enough are compacted to train their compression dictionary
+    needs_compaction |= VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename,
+                                                   CACHE_VERSION, load_compute, load_graphics);
+
+    // Build the pipelines that were used the most during previous sessions first. Only the hot
+    // set blocks the boot, the remaining pipelines are built in the background.
+    std::ranges::stable_sort(jobs, std::ranges::greater{}, &BuildJob::use_count);
+    const size_t hot_set_percentage{Settings::values.disk_pipeline_hot_set.GetValue()};
+    const size_t hot_set{Common::DivCeil(jobs.size() * hot_set_percentage, size_t{100})};
+
+    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}, building {} before boot", jobs.size(),
+             hot_set);
+
+    std::unique_lock lock{state->mutex};
+    state->total = hot_set;
+    for (size_t index = 0; index < hot_set; ++index) {
+        workers.QueueWork([build = std::move(jobs[index].build)]() mutable { build(false); });
+    }
+    callback(VideoCore::LoadCallbackStage::Build, 0, state->total);
+    state->has_loaded = true;
     lock.unlock();
 
     workers.WaitForRequests(stop_loading);
 
+    if (!stop_loading.stop_requested()) {
+        lock.lock();
+        needs_compaction |= !state->dead_compute.empty() || !state->dead_graphics.empty();
+        lock.unlock();
+        if (needs_compaction) {
+            // Appends to the cache happen on the same thread, so this is safe mid-session
+            serialization_thread.QueueWork([this, state] {
+                std::scoped_lock dead_lock{state->mutex};
+                VideoCommon::CompactPipelineCache(
+                    pipeline_cache_filename, CACHE_VERSION, sizeof(ComputePipelineCacheKey),
+                    sizeof(GraphicsPipelineCacheKey),
+                    [&state](bool is_compute, std::span<const char> key) {
+                        if (is_compute) {
+                            ComputePipelineCacheKey compute_key;
+                            std::memcpy(&compute_key, key.data(), sizeof(compute_key));
+                            return !state->dead_compute.contains(compute_key);
+                        }
+                        GraphicsPipelineCacheKey graphics_key;
+                        std::memcpy(&graphics_key, key.data(), sizeof(graphics_key));
+                        return !state->dead_graphics.contains(graphics_key);
+                    });
+            });
+        }
+        for (size_t index = hot_set; index < jobs.size(); ++index) {
+            background_workers.QueueWork(
+                [build = std::move(jobs[index].build)]() mutable { build(true); });
+        }
+    }
+
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
     }
 
-    if (state.statistics) {
-        state.statistics->Report();
+    if (state->statistics) {
+        state->statistics->Report();
     }
 }
 
+void PipelineCache::MergeBackgroundPipelines() {
+    if (!has_background_pipelines.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::scoped_lock lock{background_mutex};
+    // Pipelines the GPU thread already had to build on its own are dropped
+    for (auto& [key, pipeline] : background_graphics) {
+        graphics_cache.try_emplace(key, std::move(pipeline));
+    }
+    for (auto& [key, pipeline] : background_compute) {
+        compute_cache.try_emplace(key, std::move(pipeline));
+    }
+    background_graphics.clear();
+    background_compute.clear();
+    has_background_pipelines.store(false, std::memory_order_relaxed);
+}
+
+void PipelineCache::SavePipelineUsage() const {
+    if (pipeline_usage_filename.empty()) {
+        return;
+    }
+    // Halve the counts of previous sessions so the build order follows what is played recently
+    VideoCommon::PipelineUsageMap usage{pipeline_usage};
+    for (auto& [hash, entry] : usage) {
+        entry.use_count /= 2;
+    }
+    const auto add_usage{[&usage](u64 hash, const auto& pipeline) {
+        auto& entry{usage[hash]};
+        const u64 compile_time_us{static_cast<u64>(pipeline.CompileTime().count())};
+        if (compile_time_us != 0) {
+            entry.compile_time_us = static_cast<u32>(
+                std::min<u64>(compile_time_us, std::numeric_limits<u32>::max()));
+        }
+        const u64 use_count{pipeline.UseCount()};
+        if (use_count == 0) {
+            return;
+        }
+        if (entry.use_count == 0) {
+            entry.first_use_frame = pipeline.FirstUseFrame();
+        }
+        entry.use_count = static_cast<u32>(
+            std::min<u64>(entry.use_count + use_count, std::numeric_limits<u32>::max()));
+    }};
+    for (const auto& [key, pipeline] : graphics_cache) {
+        if (pipeline) {
+            add_usage(key.Hash(), *pipeline);
+        }
+    }
+    for (const auto& [key, pipeline] : compute_cache) {
+        if (pipeline) {
+            add_usage(key.Hash(), *pipeline);
+        }
+    }
+    std::erase_if(usage, [](const auto& item) { return item.second.use_count == 0; });
+    VideoCommon::SerializePipelineUsage(pipeline_usage_filename, CACHE_VERSION, usage);
+}
+
+u32 PipelineCache::PreviousUseCount(u64 key_hash) const {
+    const auto it{pipeline_usage.find(key_hash)};
+    return it != pipeline_usage.end() ? it->second.use_count : 0;
+}
+
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
+    MergeBackgroundPipelines();
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
     if (is_new) {
@@ -579,16 +813,22 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
         current_pipeline->AddTransition(pipeline.get());
     }
     current_pipeline = pipeline.get();
+    current_key_maxwell3d = maxwell3d;
+    current_pipeline->MarkUsed(frame_number);
     return BuiltPipeline(current_pipeline);
 }
 
-GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const noexcept {
+GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) noexcept {
     if (pipeline->IsBuilt()) {
         return pipeline;
     }
     if (!use_asynchronous_shaders) {
         return pipeline;
     }
+    // Many pipelines finish within a few milliseconds, draw them instead of skipping the draw
+    if (WaitWithinBudget(*pipeline)) {
+        return pipeline;
+    }
     // If something is using depth, we can assume that games are not rendering anything which
     // will be used one time.
     if (maxwell3d->regs.zeta_enable) {
@@ -604,10 +844,23 @@ GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const
     return nullptr;
 }
 
+bool PipelineCache::WaitWithinBudget(GraphicsPipeline& pipeline) noexcept {
+    if (async_wait_budget <= std::chrono::microseconds::zero()) {
+        return false;
+    }
+    const auto wait_start{std::chrono::steady_clock::now()};
+    const bool is_built{pipeline.WaitForBuild(async_wait_budget)};
+    async_wait_budget -= std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - wait_start);
+    return is_built;
+}
+
 std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     ShaderPools& pools, const GraphicsPipelineCacheKey& key,
     std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
     bool build_in_parallel) try {
+    TRACE_SCOPE(Shader, "TranslateGraphicsShaders");
+    const Shader::ArenaScope arena_scope{pools.arena};
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
     size_t env_index{0};
@@ -634,15 +887,16 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         ++env_index;
 
         const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
+        auto program{translation_cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                                 cfg_offset, index == 0, host_info,
+                                                 key.unique_hashes[index])};
         if (!uses_vertex_a || index != 1) {
             // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
+            programs[index] = std::move(program);
         } else {
             // VertexB path when VertexA is present.
             auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+            programs[index] = MergeDualVertexPrograms(program_va, program, env);
         }
 
         if (Settings::values.dump_shaders) {
@@ -653,8 +907,26 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
             layer_source_program = &programs[index];
         }
     }
+    // Generic outputs the next stage does not load are dead, unless transform feedback captures
+    // them or the next stage forwards them without loading them
+    if (key.state.xfb_enabled == 0 && layer_source_program == nullptr) {
+        const Shader::IR::Program* next_stage{};
+        for (size_t index = Maxwell::MaxShaderProgram; index-- > 1;) {
+            if (key.unique_hashes[index] == 0) {
+                continue;
+            }
+            Shader::IR::Program& program{programs[index]};
+            if (next_stage && program.stage != Shader::Stage::TessellationControl &&
+                !program.info.stores_indexed_attributes &&
+                !next_stage->info.loads_indexed_attributes &&
+                !next_stage->is_geometry_passthrough) {
+                Shader::Maxwell::RemoveUnusedGenericOutputs(program, next_stage->info.loads);
+            }
+            next_stage = &program;
+        }
+    }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
-    std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    GraphicsPipeline::ShaderModules modules;
 
     const Shader::IR::Program* previous_stage{};
     Shader::Backend::Bindings binding;
@@ -675,18 +947,19 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         ConvertLegacyToGeneric(program, runtime_info);
         const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding)};
         device.SaveShader(code);
-        modules[stage_index] = BuildShader(device, code);
-        if (device.HasDebuggingToolAttached()) {
-            const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
-            modules[stage_index].SetObjectNameEXT(name.c_str());
-        }
+        modules[stage_index] = GetShaderModule(code, key.unique_hashes[index]);
         previous_stage = &program;
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    Common::TaskGroup* const thread_worker{build_in_parallel ? &workers : nullptr};
+    // Pipelines found at runtime are fast linked from libraries, disk cache builds are not timing
+    // sensitive and are built fully optimized from the start
+    Common::TaskGroup* const optimize_thread{build_in_parallel && use_pipeline_library
+                                                    ? &background_workers
+                                                    : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        descriptor_pool, guest_descriptor_queue, thread_worker, optimize_thread, statistics,
+        render_pass_cache, key, std::move(modules), infos, MakeSpecializationValues(key));
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -706,6 +979,38 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     return nullptr;
 }
 
+std::shared_ptr<const vk::ShaderModule> PipelineCache::GetShaderModule(std::span<const u32> code,
+                                                                       u64 shader_hash) {
+    const u64 code_hash{Common::FastHash64(code.data(), code.size_bytes())};
+    const ShaderModuleKey module_key{code_hash, code.size()};
+    std::scoped_lock lock{shader_module_mutex};
+    if (const auto it = shader_modules.find(module_key); it != shader_modules.end()) {
+        if (auto shader_module = it->second.lock()) {
+            return shader_module;
+        }
+    }
+    if (shader_modules.size() >= shader_module_prune_size) {
+        std::erase_if(shader_modules, [](const auto& entry) { return entry.second.expired(); });
+        shader_module_prune_size = std::max<size_t>(256, shader_modules.size() * 2);
+    }
+    auto& cached{shader_modules[module_key]};
+    // The host copy of the code is what the driver keeps for the lifetime of the module
+    const u64 code_size{code.size_bytes()};
+    auto built_module{std::make_unique<vk::ShaderModule>(BuildShader(device, code))};
+    Common::AddMemoryUsage(Common::MemoryCategory::PipelineCache, code_size);
+    std::shared_ptr<const vk::ShaderModule> shader_module{
+        built_module.release(), [code_size](const vk::ShaderModule* ptr) {
+            Common::RemoveMemoryUsage(Common::MemoryCategory::PipelineCache, code_size);
+            delete ptr;
+        }};
+    if (device.HasDebuggingToolAttached()) {
+        const std::string name{fmt::format("Shader {:016x}", shader_hash)};
+        shader_module->SetObjectNameEXT(name.c_str());
+    }
+    cached = shader_module;
+    return shader_module;
+}
+
 std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GraphicsEnvironments environments;
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
@@ -751,6 +1056,7 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
     PipelineStatistics* statistics, bool build_in_parallel) try {
+    TRACE_SCOPE(Shader, "TranslateComputeShader");
     auto hash = key.Hash();
     if (device.HasBrokenCompute()) {
         LOG_ERROR(Render_Vulkan, "Skipping 0x{:016x}", hash);
@@ -759,6 +1065,7 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
 
+    const Shader::ArenaScope arena_scope{pools.arena};
     Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
 
     // Dump it before error.
@@ -774,10 +1081,11 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
         const auto name{fmt::format("Shader {:016x}", key.unique_hash)};
         spv_module.SetObjectNameEXT(name.c_str());
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    Common::TaskGroup* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<ComputePipeline>(device, vulkan_pipeline_cache, descriptor_pool,
                                              guest_descriptor_queue, thread_worker, statistics,
-                                             &shader_notify, program.info, std::move(spv_module));
+                                             &shader_notify, program.info, std::move(spv_module),
+                                             key.unique_hash);
 
 } catch (const Shader::Exception& exception) {
     LOG_ERROR(Render_Vulkan, "{}", exception.what());
@@ -787,6 +1095,15 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& filename,
                                                  const vk::PipelineCache& pipeline_cache,
                                                  u32 cache_version) try {
+    size_t cache_size = 0;
+    if (pipeline_cache) {
+        pipeline_cache.Read(&cache_size, nullptr);
+    }
+    if (cache_size == vulkan_pipeline_cache_size) {
+        // The driver cache did not grow, nothing new was built since it was loaded or saved
+        return;
+    }
+    std::vector<u8> cache_data;
     std::ofstream file(filename, std::ios::binary);
     file.exceptions(std::ifstream::failbit);
     if (!file.is_open()) {
@@ -794,17 +1111,19 @@ void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& fi
                   Common::FS::PathToUTF8String(filename));
         return;
     }
+    const VulkanCacheDriverHeader driver_header{MakeVulkanCacheDriverHeader(device)};
     file.write(VULKAN_CACHE_MAGIC_NUMBER.data(), VULKAN_CACHE_MAGIC_NUMBER.size())
-        .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
-
-    size_t cache_size = 0;
-    std::vector<char> cache_data;
-    if (pipeline_cache) {
-        pipeline_cache.Read(&cache_size, nullptr);
-        cache_data.resize(cache_size);
-        pipeline_cache.Read(&cache_size, cache_data.data());
-    }
-    file.write(cache_data.data(), cache_size);
+        .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version))
+        .write(reinterpret_cast<const char*>(&driver_header), sizeof(driver_header));
+
+    cache_data.resize(cache_size);
+    pipeline_cache.Read(&cache_size, cache_data.data());
+    vulkan_pipeline_cache_size = cache_size;
+    // Driver caches are mostly padding and repeated state, they shrink well
+    const std::vector<u8> compressed_data{
+        Common::Compression::CompressDataZSTDDefault(cache_data.data(), cache_size)};
+    file.write(reinterpret_cast<const char*>(compressed_data.data()),
+               static_cast<std::streamsize>(compressed_data.size()));
 
     LOG_INFO(Render_Vulkan, "Vulkan driver pipelines cached at: {}",
              Common::FS::PathToUTF8String(filename));
@@ -826,7 +1145,11 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
             .flags = 0,
             .initialDataSize = data_size,
             .pInitialData = data};
-        return device.GetLogical().CreatePipelineCache(pipeline_cache_ci);
+        vk::PipelineCache pipeline_cache{
+            device.GetLogical().CreatePipelineCache(pipeline_cache_ci)};
+        vulkan_pipeline_cache_size = 0;
+        pipeline_cache.Read(&vulkan_pipeline_cache_size, nullptr);
+        return pipeline_cache;
     };
     try {
         std::ifstream file(filename, std::ios::binary | std::ios::ate);
@@ -839,9 +1162,17 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
 
         std::array<char, 8> magic_number;
         u32 cache_version;
+        VulkanCacheDriverHeader driver_header;
         file.read(magic_number.data(), magic_number.size())
-            .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
-        if (magic_number != VULKAN_CACHE_MAGIC_NUMBER || cache_version != expected_cache_version) {
+            .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version))
+            .read(reinterpret_cast<char*>(&driver_header), sizeof(driver_header));
+        // The driver would reject a cache built by another driver anyway, do not read it. It is
+        // deleted, as saving skips unchanged caches and would keep it otherwise
+        const bool is_other_driver = magic_number == VULKAN_CACHE_MAGIC_NUMBER &&
+                                     cache_version == expected_cache_version &&
+                                     driver_header != MakeVulkanCacheDriverHeader(device);
+        if (magic_number != VULKAN_CACHE_MAGIC_NUMBER || cache_version != expected_cache_version ||
+            is_other_driver) {
             file.close();
             if (Common::FS::RemoveFile(filename)) {
                 if (magic_number != VULKAN_CACHE_MAGIC_NUMBER) {
@@ -850,6 +1181,10 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
                 if (cache_version != expected_cache_version) {
                     LOG_INFO(Common_Filesystem, "Deleting old Vulkan driver pipeline cache");
                 }
+                if (is_other_driver) {
+                    LOG_INFO(Common_Filesystem, "Deleting Vulkan driver pipeline cache built by "
+                                                "another driver");
+                }
             } else {
                 LOG_ERROR(Common_Filesystem,
                           "Invalid Vulkan pipeline cache file and failed to delete it in \"{}\"",
@@ -858,10 +1193,16 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
             return create_pipeline_cache(0, nullptr);
         }
 
-        static constexpr size_t header_size = magic_number.size() + sizeof(cache_version);
-        const size_t cache_size = static_cast<size_t>(end) - header_size;
-        std::vector<char> cache_data(cache_size);
-        file.read(cache_data.data(), cache_size);
+        static constexpr size_t header_size =
+            magic_number.size() + sizeof(cache_version) + sizeof(driver_header);
+        const size_t compressed_size = static_cast<size_t>(end) - header_size;
+        std::vector<u8> compressed_data(compressed_size);
+        file.read(reinterpret_cast<char*>(compressed_data.data()), compressed_size);
+        const std::vector<u8> cache_data{Common::Compression::DecompressDataZSTD(compressed_data)};
+        if (cache_data.empty()) {
+            throw std::ios_base::failure("Invalid Vulkan driver pipeline cache data");
+        }
+        const size_t cache_size = cache_data.size();
 
         LOG_INFO(Render_Vulkan,
                  "Loaded Vulkan driver pipeline cache: ", Common::FS::PathToUTF8String(filename));
@@ -4,18 +4,26 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/task_scheduler.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/object_pool.h"
 #include "shader_recompiler/profile.h"
@@ -27,6 +35,7 @@
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/shader_cache.h"
+#include "video_core/shader_environment.h"
 
 namespace Core {
 class System;
@@ -90,11 +99,13 @@ struct ShaderPools {
         flow_block.ReleaseContents();
         block.ReleaseContents();
         inst.ReleaseContents();
+        arena.Reset();
     }
 
     Shader::ObjectPool<Shader::IR::Inst> inst{8192};
     Shader::ObjectPool<Shader::IR::Block> block{32};
     Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
+    Shader::TranslationArena arena;
 };
 
 class PipelineCache : public VideoCommon::ShaderCache {
@@ -113,13 +124,35 @@ public:
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback);
 
+    /// Advances the frame number recorded as the first use of new pipelines
+    void TickFrame() noexcept {
+        ++frame_number;
+        async_wait_budget = ASYNC_WAIT_BUDGET;
+    }
+
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
-    [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) const noexcept;
+    [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) noexcept;
+
+    /// Waits for a pipeline being built with what is left of the frame's wait budget, returns
+    /// true when it finished building
+    [[nodiscard]] bool WaitWithinBudget(GraphicsPipeline& pipeline) noexcept;
+
+    /// Moves the pipelines finished by the background disk cache build into the caches
+    void MergeBackgroundPipelines();
+
+    /// Writes how often each pipeline was used, to prioritize them on the next boot
+    void SavePipelineUsage() const;
+
+    [[nodiscard]] u32 PreviousUseCount(u64 key_hash) const;
 
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline();
 
+    /// Returns a shader module for the given SPIR-V, shared with pipelines emitting the same code
+    std::shared_ptr<const vk::ShaderModule> GetShaderModule(std::span<const u32> code,
+                                                            u64 shader_hash);
+
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline(
         ShaderPools& pools, const GraphicsPipelineCacheKey& key,
         std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
@@ -150,26 +183,61 @@ private:
     VideoCore::ShaderNotify& shader_notify;
     bool use_asynchronous_shaders{};
     bool use_vulkan_pipeline_cache{};
+    bool use_pipeline_library{};
 
     GraphicsPipelineCacheKey graphics_key{};
     GraphicsPipeline* current_pipeline{};
+    /// Engine graphics_key was last resolved to current_pipeline for, null when they don't match
+    const Tegra::Engines::Maxwell3D* current_key_maxwell3d{};
 
     std::unordered_map<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>> compute_cache;
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
 
+    /// SPIR-V hash and word count
+    using ShaderModuleKey = std::pair<u64, size_t>;
+    struct ShaderModuleKeyHash {
+        size_t operator()(const ShaderModuleKey& key) const noexcept {
+            return static_cast<size_t>(key.first ^ key.second);
+        }
+    };
+    std::mutex shader_module_mutex;
+    std::unordered_map<ShaderModuleKey, std::weak_ptr<const vk::ShaderModule>, ShaderModuleKeyHash>
+        shader_modules;
+    /// Table size at which the entries of destroyed modules are removed
+    size_t shader_module_prune_size{256};
+
     ShaderPools main_pools;
 
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
+    Shader::Maxwell::TranslationCache translation_cache;
 
     std::filesystem::path pipeline_cache_filename;
+    std::filesystem::path pipeline_usage_filename;
+    VideoCommon::PipelineUsageMap pipeline_usage;
+    u64 frame_number{};
+
+    /// Time each frame may spend waiting for asynchronous pipelines instead of skipping draws
+    static constexpr std::chrono::microseconds ASYNC_WAIT_BUDGET{2000};
+    std::chrono::microseconds async_wait_budget{ASYNC_WAIT_BUDGET};
 
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
+    /// Size of the driver pipeline cache when it was last loaded or saved
+    size_t vulkan_pipeline_cache_size{};
 
-    Common::ThreadWorker workers;
+    Common::TaskGroup workers;
     Common::ThreadWorker serialization_thread;
     DynamicFeatures dynamic_features;
+
+    std::mutex background_mutex;
+    std::vector<std::pair<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>>>
+        background_graphics;
+    std::vector<std::pair<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>>>
+        background_compute;
+    std::atomic_bool has_background_pipelines{};
+    /// Builds the rarely used part of the disk cache at low priority after the game has started
+    Common::TaskGroup background_workers;
 };
 
 } // namespace Vulkan
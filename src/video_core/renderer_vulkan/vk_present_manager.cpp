@@ -1,6 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <thread>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/thread.h"
@@ -18,6 +23,11 @@ MICROPROFILE_DEFINE(Vulkan_CopyToSwapchain, "Vulkan", "Copy to swapchain", MP_RG
 
 namespace {
 
+/// Number of presents the frame queue depth is reconsidered after
+constexpr u32 PRESENT_WINDOW = 60;
+/// Number of presents in a window where the display went without a new frame before queuing more
+constexpr u32 STALL_THRESHOLD = 2;
+
 bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat format) {
     const VkFormatProperties props{physical_device.GetFormatProperties(format)};
     return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
@@ -32,23 +42,11 @@ bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat form
     };
 }
 
-[[nodiscard]] VkImageBlit MakeImageBlit(s32 frame_width, s32 frame_height, s32 swapchain_width,
-                                        s32 swapchain_height) {
+[[nodiscard]] VkImageBlit MakeImageBlit(const std::array<VkOffset3D, 2>& src_offsets,
+                                        s32 swapchain_width, s32 swapchain_height) {
     return VkImageBlit{
         .srcSubresource = MakeImageSubresourceLayers(),
-        .srcOffsets =
-            {
-                {
-                    .x = 0,
-                    .y = 0,
-                    .z = 0,
-                },
-                {
-                    .x = frame_width,
-                    .y = frame_height,
-                    .z = 1,
-                },
-            },
+        .srcOffsets = {src_offsets[0], src_offsets[1]},
         .dstSubresource = MakeImageSubresourceLayers(),
         .dstOffsets =
             {
@@ -66,6 +64,23 @@ bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat form
     };
 }
 
+[[nodiscard]] VkImageBlit MakeImageBlit(s32 frame_width, s32 frame_height, s32 swapchain_width,
+                                        s32 swapchain_height) {
+    const std::array src_offsets{
+        VkOffset3D{
+            .x = 0,
+            .y = 0,
+            .z = 0,
+        },
+        VkOffset3D{
+            .x = frame_width,
+            .y = frame_height,
+            .z = 1,
+        },
+    };
+    return MakeImageBlit(src_offsets, swapchain_width, swapchain_height);
+}
+
 [[nodiscard]] VkImageCopy MakeImageCopy(u32 frame_width, u32 frame_height, u32 swapchain_width,
                                         u32 swapchain_height) {
     return VkImageCopy{
@@ -102,7 +117,10 @@ PresentManager::PresentManager(const vk::Instance& instance_,
       memory_allocator{memory_allocator_}, scheduler{scheduler_}, swapchain{swapchain_},
       surface{surface_}, blit_supported{CanBlitToSwapchain(device.GetPhysical(),
                                                            swapchain.GetImageViewFormat())},
-      use_present_thread{Settings::values.async_presentation.GetValue()} {
+      use_present_thread{Settings::values.async_presentation.GetValue()},
+      low_latency{Settings::values.low_latency_presentation.GetValue()},
+      frame_generation{use_present_thread && !low_latency &&
+                       Settings::values.frame_generation.GetValue()} {
     SetImageCount();
 
     auto& dld = device.GetLogical();
@@ -131,6 +149,7 @@ PresentManager::PresentManager(const vk::Instance& instance_,
         });
         free_queue.push(&frame);
     }
+    max_pending_frames = frames.size();
 
     if (use_present_thread) {
         present_thread = std::jthread([this](std::stop_token token) { PresentThread(token); });
@@ -142,9 +161,12 @@ PresentManager::~PresentManager() = default;
 Frame* PresentManager::GetRenderFrame() {
     MICROPROFILE_SCOPE(Vulkan_WaitPresent);
 
-    // Wait for free presentation frames
+    // Wait for free presentation frames, without having more frames rendered ahead of the
+    // display than the present thread currently needs to keep up with it
     std::unique_lock lock{free_mutex};
-    free_cv.wait(lock, [this] { return !free_queue.empty(); });
+    free_cv.wait(lock, [this] {
+        return !free_queue.empty() && frames.size() - free_queue.size() < max_pending_frames;
+    });
 
     // Take the frame from the queue
     Frame* frame = free_queue.front();
@@ -153,6 +175,9 @@ Frame* PresentManager::GetRenderFrame() {
     // Wait for the presentation to be finished so all frame resources are free
     frame->present_done.Wait();
     frame->present_done.Reset();
+    frame->composition_time = {};
+    frame->direct_image = VK_NULL_HANDLE;
+    frame->generated = false;
 
     return frame;
 }
@@ -165,7 +190,10 @@ void PresentManager::Present(Frame* frame) {
         return;
     }
 
-    scheduler.Record([this, frame](vk::CommandBuffer) {
+    // The frame's rendering has just been flushed, it has to reach the queue before the present
+    // thread waits on it even when the next execution context is recorded on another thread.
+    scheduler.Record([this, frame, render_tick = scheduler.CurrentTick() - 1](vk::CommandBuffer) {
+        scheduler.WaitSubmission(render_tick);
         std::unique_lock lock{queue_mutex};
         present_queue.push(frame);
         frame_cv.notify_one();
@@ -263,14 +291,38 @@ void PresentManager::PresentThread(std::stop_token token) {
         std::unique_lock lock{queue_mutex};
 
         // Wait for presentation frames
+        const bool starved = present_queue.empty();
         Common::CondvarWait(frame_cv, lock, token, [this] { return !present_queue.empty(); });
         if (token.stop_requested()) {
             return;
         }
 
+        // A generated frame is shown for half of a guest frame before the guest frame after it.
+        // The frame stays queued meanwhile so WaitPresent keeps waiting for it without either
+        // lock being held during the wait.
+        if (last_present_generated && !present_queue.front()->generated) {
+            const auto wait_time = last_present_time + composition_interval / 2 -
+                                   std::chrono::steady_clock::now();
+            lock.unlock();
+            if (!Common::StoppableTimedWait(token, wait_time)) {
+                return;
+            }
+            lock.lock();
+        }
+
         // Take the frame and notify anyone waiting
         Frame* frame = present_queue.front();
         present_queue.pop();
+
+        // In low latency mode only the newest completed frame is presented
+        boost::container::small_vector<Frame*, 4> discarded_frames;
+        if (low_latency) {
+            while (!present_queue.empty()) {
+                discarded_frames.push_back(frame);
+                frame = present_queue.front();
+                present_queue.pop();
+            }
+        }
         frame_cv.notify_one();
 
         // By exchanging the lock ownership we take the swapchain lock
@@ -278,15 +330,112 @@ void PresentManager::PresentThread(std::stop_token token) {
         // lock in WaitPresent is guaranteed to occur after here.
         std::exchange(lock, std::unique_lock{swapchain_mutex});
 
+        for (Frame* discarded_frame : discarded_frames) {
+            DiscardFrame(discarded_frame);
+        }
+
+        last_present_generated = frame->generated;
         CopyToSwapchain(frame);
 
-        // Free the frame for reuse
+        // Free the frames for reuse
         std::scoped_lock fl{free_mutex};
+        UpdateFrameQueue(frame, starved);
+        for (Frame* discarded_frame : discarded_frames) {
+            free_queue.push(discarded_frame);
+        }
         free_queue.push(frame);
         free_cv.notify_one();
     }
 }
 
+void PresentManager::DiscardFrame(Frame* frame) {
+    // The frame never reaches the swapchain, but its render semaphore is signaled and its fence
+    // has to be signaled before the frame is handed out again.
+    static constexpr VkPipelineStageFlags wait_stage_mask{VK_PIPELINE_STAGE_ALL_COMMANDS_BIT};
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreCount = 1U,
+        .pWaitSemaphores = frame->render_ready.address(),
+        .pWaitDstStageMask = &wait_stage_mask,
+        .commandBufferCount = 0,
+        .pCommandBuffers = nullptr,
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores = nullptr,
+    };
+
+    std::scoped_lock submit_lock{scheduler.submit_mutex};
+    switch (const VkResult result =
+                device.GetGraphicsQueue().Submit(submit_info, *frame->present_done)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+}
+
+void PresentManager::UpdateFrameQueue(Frame* frame, bool starved) {
+    using namespace std::chrono_literals;
+
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::nanoseconds interval = now - last_present_time;
+    last_present_time = now;
+
+    // A present thread that had to wait for a frame and presented it well after the usual
+    // interval left the display without a new frame, which shows up as judder.
+    // Long pauses such as loading screens are not taken into account.
+    if (starved && interval > present_interval * 3 / 2 && interval < 250ms) {
+        ++window_stalls;
+    }
+
+    // Moving averages over roughly the last 16 presents
+    const auto update_average = [](std::chrono::nanoseconds& average,
+                                   std::chrono::nanoseconds sample) {
+        average += (sample - average) / 16;
+    };
+    if (interval < 250ms) {
+        update_average(present_interval, interval);
+    }
+    if (frame->composition_time != std::chrono::steady_clock::time_point{}) {
+        update_average(present_latency, now - frame->composition_time);
+
+        const std::chrono::nanoseconds guest_interval =
+            frame->composition_time - last_composition_time;
+        last_composition_time = frame->composition_time;
+        if (guest_interval < 250ms) {
+            update_average(composition_interval, guest_interval);
+        }
+    }
+
+    if (++window_presents < PRESENT_WINDOW) {
+        return;
+    }
+
+    // Queue another frame when the display keeps running out of frames, and queue one less when
+    // frames take longer than a present interval to go from the guest compositor to the display,
+    // as they are then waiting behind other queued frames. Low latency mode never waits for the
+    // display, it drops the frames it could not present instead.
+    const size_t min_pending_frames = std::min<size_t>(frames.size(), 2);
+    if (!low_latency) {
+        if (window_stalls >= STALL_THRESHOLD) {
+            max_pending_frames = std::min(max_pending_frames + 1, frames.size());
+        } else if (present_latency > present_interval * 3 / 2) {
+            max_pending_frames = std::max(max_pending_frames - 1, min_pending_frames);
+        }
+    }
+    LOG_DEBUG(Render_Vulkan, "Present latency {:.2f} ms, interval {:.2f} ms, {} frames queued",
+              std::chrono::duration<f64, std::milli>(present_latency).count(),
+              std::chrono::duration<f64, std::milli>(present_interval).count(),
+              max_pending_frames);
+
+    window_presents = 0;
+    window_stalls = 0;
+}
+
 void PresentManager::RecreateSwapchain(Frame* frame) {
     swapchain.Create(*surface, frame->width, frame->height);
     SetImageCount();
@@ -348,6 +497,12 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
 
     const VkImage image{swapchain.CurrentImage()};
     const VkExtent2D extent = swapchain.GetExtent();
+
+    // Guest images presented directly stay in the general layout the texture cache expects
+    const bool is_direct = frame->direct_image != VK_NULL_HANDLE;
+    const VkImage source_image = is_direct ? frame->direct_image : *frame->image;
+    const VkImageLayout source_layout =
+        is_direct ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
     const std::array pre_barriers{
         VkImageMemoryBarrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
@@ -370,13 +525,14 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
         VkImageMemoryBarrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
             .pNext = nullptr,
-            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
             .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
             .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
-            .newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            .newLayout = source_layout,
             .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
             .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-            .image = *frame->image,
+            .image = source_image,
             .subresourceRange{
                 .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
                 .baseMipLevel = 0,
@@ -410,11 +566,11 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
             .pNext = nullptr,
             .srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
             .dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
-            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            .oldLayout = source_layout,
             .newLayout = VK_IMAGE_LAYOUT_GENERAL,
             .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
             .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-            .image = *frame->image,
+            .image = source_image,
             .subresourceRange{
                 .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
                 .baseMipLevel = 0,
@@ -428,7 +584,11 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
     cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, {},
                            {}, {}, pre_barriers);
 
-    if (blit_supported) {
+    if (is_direct) {
+        cmdbuf.BlitImage(source_image, source_layout, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         MakeImageBlit(frame->direct_offsets, extent.width, extent.height),
+                         frame->direct_filter);
+    } else if (blit_supported) {
         cmdbuf.BlitImage(*frame->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image,
                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                          MakeImageBlit(frame->width, frame->height, extent.width, extent.height),
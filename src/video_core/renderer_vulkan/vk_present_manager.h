@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -31,6 +33,13 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    std::chrono::steady_clock::time_point composition_time;
+    /// Guest image presented in place of the frame image when composition was skipped
+    VkImage direct_image{};
+    std::array<VkOffset3D, 2> direct_offsets{};
+    VkFilter direct_filter{};
+    /// Whether the frame was generated between two guest frames instead of composited
+    bool generated{};
 };
 
 class PresentManager {
@@ -53,6 +62,20 @@ public:
     /// Waits for the present thread to finish presenting all queued frames.
     void WaitPresent();
 
+    /// Returns true when frames can be presented straight from a guest image. The image has to
+    /// be copied to the swapchain before the guest renders to it again, so this requires
+    /// presenting on the render thread.
+    [[nodiscard]] bool CanPresentDirectly() const {
+        return !use_present_thread && blit_supported;
+    }
+
+    /// Returns true when frames should be generated between guest frames. Generated frames are
+    /// paced by the present thread, so this requires asynchronous presentation, and low latency
+    /// presentation would drop them.
+    [[nodiscard]] bool IsFrameGenerationEnabled() const {
+        return frame_generation;
+    }
+
 private:
     void PresentThread(std::stop_token token);
 
@@ -60,6 +83,10 @@ private:
 
     void CopyToSwapchainImpl(Frame* frame);
 
+    void DiscardFrame(Frame* frame);
+
+    void UpdateFrameQueue(Frame* frame, bool starved);
+
     void RecreateSwapchain(Frame* frame);
 
     void SetImageCount();
@@ -84,7 +111,18 @@ private:
     std::jthread present_thread;
     bool blit_supported;
     bool use_present_thread;
+    bool low_latency;
+    bool frame_generation;
     std::size_t image_count{};
+    std::size_t max_pending_frames{};
+    std::chrono::steady_clock::time_point last_present_time;
+    std::chrono::nanoseconds present_latency{};
+    std::chrono::nanoseconds present_interval{};
+    std::chrono::steady_clock::time_point last_composition_time;
+    std::chrono::nanoseconds composition_interval{};
+    bool last_present_generated{};
+    u32 window_presents{};
+    u32 window_stalls{};
 };
 
 } // namespace Vulkan
@@ -229,14 +229,37 @@ public:
         resolve_buffers.push_back(resolve_buffer_index);
         size_t base_offset = 0;
 
+        struct QueryPoolCopy {
+            VkQueryPool query_pool;
+            size_t start;
+            size_t amount;
+            size_t offset;
+        };
+        std::vector<QueryPoolCopy> copies;
         ApplyBanksWideOp<true>(pending_sync, [&](SamplesQueryBank* bank, size_t start,
                                                  size_t amount) {
-            size_t bank_id = bank->GetIndex();
-            auto& resolve_buffer = buffers[resolve_buffer_index];
-            VkQueryPool query_pool = bank->GetInnerPool();
+            copies.push_back(QueryPoolCopy{
+                .query_pool = bank->GetInnerPool(),
+                .start = start,
+                .amount = amount,
+                .offset = base_offset,
+            });
+            offsets[bank->GetIndex()] = {start, base_offset};
+            base_offset += amount * SamplesQueryBank::QUERY_SIZE;
+        });
+
+        // Resolve every bank in one batch behind a single barrier
+        if (!copies.empty()) {
             scheduler.RequestOutsideRenderPassOperationContext();
-            scheduler.Record([start, amount, base_offset, query_pool,
-                              buffer = *resolve_buffer](vk::CommandBuffer cmdbuf) {
+            scheduler.Record([copies = std::move(copies), size = base_offset,
+                              buffer = *buffers[resolve_buffer_index]](vk::CommandBuffer cmdbuf) {
+                for (const QueryPoolCopy& copy : copies) {
+                    cmdbuf.CopyQueryPoolResults(
+                        copy.query_pool, static_cast<u32>(copy.start),
+                        static_cast<u32>(copy.amount), buffer, static_cast<u32>(copy.offset),
+                        SamplesQueryBank::QUERY_SIZE,
+                        VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
+                }
                 const VkBufferMemoryBarrier copy_query_pool_barrier{
                     .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
                     .pNext = nullptr,
@@ -245,20 +268,13 @@ public:
                     .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
                     .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
                     .buffer = buffer,
-                    .offset = base_offset,
-                    .size = amount * SamplesQueryBank::QUERY_SIZE,
+                    .offset = 0,
+                    .size = size,
                 };
-
-                cmdbuf.CopyQueryPoolResults(
-                    query_pool, static_cast<u32>(start), static_cast<u32>(amount), buffer,
-                    static_cast<u32>(base_offset), SamplesQueryBank::QUERY_SIZE,
-                    VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
                 cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
                                        VK_PIPELINE_STAGE_TRANSFER_BIT, 0, copy_query_pool_barrier);
             });
-            offsets[bank_id] = {start, base_offset};
-            base_offset += amount * SamplesQueryBank::QUERY_SIZE;
-        });
+        }
 
         // Convert queries
         bool has_multi_queries = false;
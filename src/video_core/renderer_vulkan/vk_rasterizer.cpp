@@ -173,6 +173,20 @@ DrawParams MakeDrawParams(const MaxwellDrawState& draw_state, u32 num_instances,
     }
     return params;
 }
+
+/// Load operations ignore conditional rendering, clears may only be moved into them when they
+/// always execute
+bool IsRenderingUnconditional(const Maxwell& regs) {
+    using Override = Maxwell::RenderEnable::Override;
+    switch (regs.render_enable_override) {
+    case Override::AlwaysRender:
+        return true;
+    case Override::UseRenderEnable:
+        return regs.render_enable.mode == Maxwell::RenderEnable::Mode::True;
+    default:
+        return false;
+    }
+}
 } // Anonymous namespace
 
 RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra::GPU& gpu_,
@@ -196,7 +210,8 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
       query_cache(gpu, *this, device_memory, query_cache_runtime),
       pipeline_cache(device_memory, device, scheduler, descriptor_pool, guest_descriptor_queue,
                      render_pass_cache, buffer_cache, texture_cache, gpu.ShaderNotify()),
-      accelerate_dma(buffer_cache, texture_cache, scheduler),
+      accelerate_dma(device, buffer_cache, texture_cache, scheduler, descriptor_pool,
+                     compute_pass_descriptor_queue),
       fence_manager(*this, gpu, texture_cache, buffer_cache, query_cache, device, scheduler),
       wfi_event(device.GetLogical().CreateEvent()) {
     scheduler.SetQueryCache(query_cache);
@@ -327,12 +342,12 @@ void RasterizerVulkan::DrawTexture() {
 
     const auto ScaleSrc = [&](auto dim_f) -> s32 {
         auto dim = static_cast<s32>(dim_f);
-        return src_rescaling ? Settings::values.resolution_info.ScaleUp(dim) : dim;
+        return src_rescaling ? Settings::GetHotValues().resolution_info.ScaleUp(dim) : dim;
     };
 
     const auto ScaleDst = [&](auto dim_f) -> s32 {
         auto dim = static_cast<s32>(dim_f);
-        return dst_rescaling ? Settings::values.resolution_info.ScaleUp(dim) : dim;
+        return dst_rescaling ? Settings::GetHotValues().resolution_info.ScaleUp(dim) : dim;
     };
 
     Region2D dst_region = {Offset2D{.x = ScaleDst(draw_texture_state.dst_x0),
@@ -372,13 +387,13 @@ void RasterizerVulkan::Clear(u32 layer_count) {
     texture_cache.UpdateRenderTargets(true);
     const Framebuffer* const framebuffer = texture_cache.GetFramebuffer();
     const VkExtent2D render_area = framebuffer->RenderArea();
-    scheduler.RequestRenderpass(framebuffer);
 
     u32 up_scale = 1;
     u32 down_shift = 0;
     if (texture_cache.IsRescaling()) {
-        up_scale = Settings::values.resolution_info.up_scale;
-        down_shift = Settings::values.resolution_info.down_shift;
+        const auto& resolution = Settings::GetHotValues().resolution_info;
+        up_scale = resolution.up_scale;
+        down_shift = resolution.down_shift;
     }
     UpdateViewportsState(regs);
 
@@ -395,6 +410,7 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         .layerCount = layer_count,
     };
     if (clear_rect.rect.extent.width == 0 || clear_rect.rect.extent.height == 0) {
+        scheduler.RequestRenderpass(framebuffer);
         return;
     }
     clear_rect.rect.extent = VkExtent2D{
@@ -403,13 +419,16 @@ void RasterizerVulkan::Clear(u32 layer_count) {
     };
 
     const u32 color_attachment = regs.clear_surface.RT;
-    if (use_color && framebuffer->HasAspectColorBit(color_attachment)) {
+    const bool clear_color = use_color && framebuffer->HasAspectColorBit(color_attachment);
+    const bool full_color_mask = regs.clear_surface.R && regs.clear_surface.G &&
+                                 regs.clear_surface.B && regs.clear_surface.A;
+    VkClearValue clear_value{};
+    if (clear_color) {
         const auto format =
             VideoCore::Surface::PixelFormatFromRenderTargetFormat(regs.rt[color_attachment].format);
         bool is_integer = IsPixelFormatInteger(format);
         bool is_signed = IsPixelFormatSignedInteger(format);
         size_t int_size = PixelComponentSizeBitsInteger(format);
-        VkClearValue clear_value{};
         if (!is_integer) {
             std::memcpy(clear_value.color.float32, regs.clear_color.data(),
                         regs.clear_color.size() * sizeof(f32));
@@ -425,9 +444,62 @@ void RasterizerVulkan::Clear(u32 layer_count) {
                                      (regs.clear_color[i] - 0.5f));
             }
         }
+    }
+    VkImageAspectFlags aspect_flags = 0;
+    if (use_depth && framebuffer->HasAspectDepthBit()) {
+        aspect_flags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+    }
+    if (use_stencil && framebuffer->HasAspectStencilBit()) {
+        aspect_flags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
+    const bool masked_stencil = use_stencil && framebuffer->HasAspectStencilBit() &&
+                                regs.stencil_front_mask != 0xFF && regs.stencil_front_mask != 0;
+
+    // Clears of the whole framebuffer starting a renderpass are done by its load operations,
+    // sparing tilers from loading the previous contents
+    u32 cleared_on_load = 0;
+    if (clear_rect.rect.offset.x == 0 && clear_rect.rect.offset.y == 0 &&
+        clear_rect.rect.extent.width == render_area.width &&
+        clear_rect.rect.extent.height == render_area.height && clear_rect.baseArrayLayer == 0 &&
+        clear_rect.layerCount == framebuffer->NumLayers() && IsRenderingUnconditional(regs)) {
+        if (clear_color && full_color_mask) {
+            cleared_on_load |= 1U << color_attachment;
+        }
+        if (!masked_stencil && (aspect_flags & VK_IMAGE_ASPECT_DEPTH_BIT) != 0) {
+            cleared_on_load |= RenderPassKey::CLEAR_DEPTH;
+        }
+        if (!masked_stencil && (aspect_flags & VK_IMAGE_ASPECT_STENCIL_BIT) != 0) {
+            cleared_on_load |= RenderPassKey::CLEAR_STENCIL;
+        }
+    }
+    if (cleared_on_load != 0) {
+        RenderPassKey key = framebuffer->GetRenderPassKey();
+        key.cleared_attachments = cleared_on_load;
+        std::array<VkClearValue, 9> clear_values{};
+        if ((cleared_on_load & (1U << color_attachment)) != 0) {
+            clear_values[framebuffer->ColorAttachmentIndex(color_attachment)] = clear_value;
+        }
+        clear_values[framebuffer->NumColorBuffers()].depthStencil = VkClearDepthStencilValue{
+            .depth = regs.clear_depth,
+            .stencil = regs.clear_stencil,
+        };
+        if (!scheduler.RequestClearingRenderpass(
+                framebuffer, render_pass_cache.Get(key),
+                std::span(clear_values.data(), framebuffer->NumImages()))) {
+            cleared_on_load = 0;
+        }
+    } else {
+        scheduler.RequestRenderpass(framebuffer);
+    }
+    if ((cleared_on_load & RenderPassKey::CLEAR_DEPTH) != 0) {
+        aspect_flags &= ~VK_IMAGE_ASPECT_DEPTH_BIT;
+    }
+    if ((cleared_on_load & RenderPassKey::CLEAR_STENCIL) != 0) {
+        aspect_flags &= ~VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
 
-        if (regs.clear_surface.R && regs.clear_surface.G && regs.clear_surface.B &&
-            regs.clear_surface.A) {
+    if (clear_color && (cleared_on_load & (1U << color_attachment)) == 0) {
+        if (full_color_mask) {
             scheduler.Record([color_attachment, clear_value, clear_rect](vk::CommandBuffer cmdbuf) {
                 const VkClearAttachment attachment{
                     .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
@@ -449,22 +521,11 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         }
     }
 
-    if (!use_depth && !use_stencil) {
-        return;
-    }
-    VkImageAspectFlags aspect_flags = 0;
-    if (use_depth && framebuffer->HasAspectDepthBit()) {
-        aspect_flags |= VK_IMAGE_ASPECT_DEPTH_BIT;
-    }
-    if (use_stencil && framebuffer->HasAspectStencilBit()) {
-        aspect_flags |= VK_IMAGE_ASPECT_STENCIL_BIT;
-    }
     if (aspect_flags == 0) {
         return;
     }
 
-    if (use_stencil && framebuffer->HasAspectStencilBit() && regs.stencil_front_mask != 0xFF &&
-        regs.stencil_front_mask != 0) {
+    if (masked_stencil) {
         Region2D dst_region = {
             Offset2D{.x = clear_rect.rect.offset.x, .y = clear_rect.rect.offset.y},
             Offset2D{.x = clear_rect.rect.offset.x + static_cast<s32>(clear_rect.rect.extent.width),
@@ -506,15 +567,19 @@ void RasterizerVulkan::DispatchCompute() {
         const auto [buffer, offset] =
             buffer_cache.ObtainBuffer(*indirect_address, 12, sync_info, post_op);
         scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.BeginProfileScope("Dispatch indirect", pipeline->ShaderHash());
         scheduler.Record([indirect_buffer = buffer->Handle(),
                           indirect_offset = offset](vk::CommandBuffer cmdbuf) {
             cmdbuf.DispatchIndirect(indirect_buffer, indirect_offset);
         });
+        scheduler.EndProfileScope();
         return;
     }
     const std::array<u32, 3> dim{qmd.grid_dim_x, qmd.grid_dim_y, qmd.grid_dim_z};
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope("Dispatch", pipeline->ShaderHash());
     scheduler.Record([dim](vk::CommandBuffer cmdbuf) { cmdbuf.Dispatch(dim[0], dim[1], dim[2]); });
+    scheduler.EndProfileScope();
 }
 
 void RasterizerVulkan::ResetCounter(VideoCommon::QueryType type) {
@@ -669,6 +734,31 @@ void RasterizerVulkan::OnCacheInvalidation(DAddr addr, u64 size) {
     pipeline_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerVulkan::InnerCacheInvalidation(
+    std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            if (addr != 0 && size != 0) {
+                texture_cache.WriteMemory(addr, size);
+            }
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            if (addr != 0 && size != 0) {
+                buffer_cache.WriteMemory(addr, size);
+            }
+        }
+    }
+    for (const auto& [addr, size] : sequences) {
+        if (addr != 0 && size != 0) {
+            pipeline_cache.InvalidateRegion(addr, size);
+        }
+    }
+}
+
 void RasterizerVulkan::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -762,6 +852,7 @@ void RasterizerVulkan::FlushCommands() {
 
 void RasterizerVulkan::TickFrame() {
     draw_counter = 0;
+    pipeline_cache.TickFrame();
     guest_descriptor_queue.TickFrame();
     compute_pass_descriptor_queue.TickFrame();
     fence_manager.TickFrame();
@@ -781,6 +872,10 @@ bool RasterizerVulkan::AccelerateConditionalRendering() {
     return query_cache.AccelerateHostConditionalRendering();
 }
 
+bool RasterizerVulkan::SpeculateConditionalRendering() {
+    return query_cache.SpeculateHostConditionalRendering();
+}
+
 bool RasterizerVulkan::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
                                              const Tegra::Engines::Fermi2D::Surface& dst,
                                              const Tegra::Engines::Fermi2D::Config& copy_config) {
@@ -827,7 +922,7 @@ std::optional<FramebufferTextureInfo> RasterizerVulkan::AccelerateDisplay(
     }
     query_cache.NotifySegment(false);
 
-    const auto& resolution = Settings::values.resolution_info;
+    const auto& resolution = Settings::GetHotValues().resolution_info;
 
     FramebufferTextureInfo info{};
     info.image = image_view->ImageHandle();
@@ -836,6 +931,8 @@ std::optional<FramebufferTextureInfo> RasterizerVulkan::AccelerateDisplay(
     info.height = image_view->size.height;
     info.scaled_width = scaled ? resolution.ScaleUp(info.width) : info.width;
     info.scaled_height = scaled ? resolution.ScaleUp(info.height) : info.height;
+    info.image_format = image_view->ImageFormat();
+    info.samples = image_view->Samples();
     return info;
 }
 
@@ -850,6 +947,8 @@ void RasterizerVulkan::FlushWork() {
 #else
     static constexpr u32 DRAWS_TO_DISPATCH = 4096;
 #endif // ANDROID
+    // Minimum number of draws in an execution context before it is split for parallel recording
+    static constexpr u32 DRAWS_TO_SPLIT = 512;
 
     // Only check multiples of 8 draws
     static_assert(DRAWS_TO_DISPATCH % 8 == 0);
@@ -857,6 +956,15 @@ void RasterizerVulkan::FlushWork() {
         return;
     }
     if (draw_counter < DRAWS_TO_DISPATCH) {
+        if (scheduler.IsParallelRecording() && draw_counter >= DRAWS_TO_SPLIT &&
+            (!scheduler.IsRenderPassActive() ||
+             maxwell3d->dirty.flags[VideoCommon::Dirty::RenderTargets])) {
+            // Start a new execution context at a render pass boundary so it can be recorded by
+            // another thread
+            scheduler.Flush();
+            draw_counter = 0;
+            return;
+        }
         // Send recorded tasks to the worker thread
         scheduler.DispatchWork();
         return;
@@ -867,9 +975,12 @@ void RasterizerVulkan::FlushWork() {
     draw_counter = 0;
 }
 
-AccelerateDMA::AccelerateDMA(BufferCache& buffer_cache_, TextureCache& texture_cache_,
-                             Scheduler& scheduler_)
-    : buffer_cache{buffer_cache_}, texture_cache{texture_cache_}, scheduler{scheduler_} {}
+AccelerateDMA::AccelerateDMA(const Device& device, BufferCache& buffer_cache_,
+                             TextureCache& texture_cache_, Scheduler& scheduler_,
+                             DescriptorPool& descriptor_pool,
+                             ComputePassDescriptorQueue& compute_pass_descriptor_queue)
+    : buffer_cache{buffer_cache_}, texture_cache{texture_cache_}, scheduler{scheduler_},
+      dma_swizzle_pass(device, scheduler_, descriptor_pool, compute_pass_descriptor_queue) {}
 
 bool AccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
     std::scoped_lock lock{buffer_cache.mutex};
@@ -926,6 +1037,43 @@ bool AccelerateDMA::BufferToImage(const Tegra::DMA::ImageCopy& copy_info,
     return DmaBufferImageCopy<true>(copy_info, buffer_operand, image_operand);
 }
 
+bool AccelerateDMA::BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) {
+    // The GPU copies words, smaller or unaligned elements are swizzled on the CPU
+    if (copy.bytes_per_pixel % 4 != 0 || copy.src.address % 4 != 0 || copy.dst.address % 4 != 0 ||
+        copy.src.pitch % 4 != 0 || copy.dst.pitch % 4 != 0) {
+        return false;
+    }
+    const DAddr src_end = copy.src.address + copy.src.size;
+    const DAddr dst_end = copy.dst.address + copy.dst.size;
+    if (copy.src.address < dst_end && copy.dst.address < src_end) {
+        return false;
+    }
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    // Memory the GPU does not use is cheaper to swizzle on the CPU than to upload
+    if (!buffer_cache.IsRegionRegistered(copy.src.address, copy.src.size) &&
+        !buffer_cache.IsRegionRegistered(copy.dst.address, copy.dst.size)) {
+        return false;
+    }
+    if (texture_cache.IsRegionGpuModified(copy.src.address, copy.src.size) ||
+        texture_cache.IsRegionGpuModified(copy.dst.address, copy.dst.size)) {
+        return false;
+    }
+    using VideoCommon::ObtainBufferOperation;
+    static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::FullSynchronize;
+    std::pair<Buffer*, u32> src_buffer;
+    std::pair<Buffer*, u32> dst_buffer;
+    buffer_cache.BufferOperations([&] {
+        src_buffer = buffer_cache.ObtainCPUBuffer(copy.src.address, copy.src.size, sync_info,
+                                                  ObtainBufferOperation::DoNothing);
+        dst_buffer = buffer_cache.ObtainCPUBuffer(copy.dst.address, copy.dst.size, sync_info,
+                                                  ObtainBufferOperation::MarkAsWritten);
+    });
+    dma_swizzle_pass.Copy(src_buffer.first->Handle(), src_buffer.second,
+                          dst_buffer.first->Handle(), dst_buffer.second, copy);
+    texture_cache.WriteMemory(copy.dst.address, copy.dst.size);
+    return true;
+}
+
 void RasterizerVulkan::UpdateDynamicStates() {
     auto& regs = maxwell3d->regs;
     UpdateViewportsState(regs);
@@ -959,6 +1107,11 @@ void RasterizerVulkan::UpdateDynamicStates() {
         if (device.IsExtExtendedDynamicState2ExtrasSupported()) {
             UpdateLogicOp(regs);
         }
+        if (device.IsExtExtendedDynamicState3RasterizationSupported()) {
+            UpdatePolygonMode(regs);
+            UpdateAlphaToCoverageEnable(regs);
+            UpdateAlphaToOneEnable(regs);
+        }
         if (device.IsExtExtendedDynamicState3Supported()) {
             UpdateBlending(regs);
         }
@@ -1007,7 +1160,7 @@ void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D::Regs& reg
         return;
     }
     const bool is_rescaling{texture_cache.IsRescaling()};
-    const float scale = is_rescaling ? Settings::values.resolution_info.up_factor : 1.0f;
+    const float scale = is_rescaling ? Settings::GetHotValues().resolution_info.up_factor : 1.0f;
     const std::array viewport_list{
         GetViewportState(device, regs, 0, scale),  GetViewportState(device, regs, 1, scale),
         GetViewportState(device, regs, 2, scale),  GetViewportState(device, regs, 3, scale),
@@ -1045,8 +1198,9 @@ void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D::Regs& regs
     u32 up_scale = 1;
     u32 down_shift = 0;
     if (texture_cache.IsRescaling()) {
-        up_scale = Settings::values.resolution_info.up_scale;
-        down_shift = Settings::values.resolution_info.down_shift;
+        const auto& resolution = Settings::GetHotValues().resolution_info;
+        up_scale = resolution.up_scale;
+        down_shift = resolution.down_shift;
     }
     const std::array scissor_list{
         GetScissorState(regs, 0, up_scale, down_shift),
@@ -1333,6 +1487,32 @@ void RasterizerVulkan::UpdateDepthClampEnable(Tegra::Engines::Maxwell3D::Regs& r
         [is_enabled](vk::CommandBuffer cmdbuf) { cmdbuf.SetDepthClampEnableEXT(is_enabled); });
 }
 
+void RasterizerVulkan::UpdatePolygonMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchPolygonMode()) {
+        return;
+    }
+    scheduler.Record([mode = regs.polygon_mode_front](vk::CommandBuffer cmdbuf) {
+        cmdbuf.SetPolygonModeEXT(MaxwellToVK::PolygonMode(mode));
+    });
+}
+
+void RasterizerVulkan::UpdateAlphaToCoverageEnable(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchAlphaToCoverageEnable()) {
+        return;
+    }
+    const bool enable = regs.anti_alias_alpha_control.alpha_to_coverage != 0;
+    scheduler.Record(
+        [enable](vk::CommandBuffer cmdbuf) { cmdbuf.SetAlphaToCoverageEnableEXT(enable); });
+}
+
+void RasterizerVulkan::UpdateAlphaToOneEnable(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchAlphaToOneEnable()) {
+        return;
+    }
+    const bool enable = regs.anti_alias_alpha_control.alpha_to_one != 0;
+    scheduler.Record([enable](vk::CommandBuffer cmdbuf) { cmdbuf.SetAlphaToOneEnableEXT(enable); });
+}
+
 void RasterizerVulkan::UpdateDepthCompareOp(Tegra::Engines::Maxwell3D::Regs& regs) {
     if (!state_tracker.TouchDepthCompareOp()) {
         return;
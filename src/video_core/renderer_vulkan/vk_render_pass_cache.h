@@ -12,11 +12,18 @@
 namespace Vulkan {
 
 struct RenderPassKey {
+    /// Bits of cleared_attachments, the color attachments use the bit of their index
+    static constexpr u32 CLEAR_DEPTH = 1U << 8;
+    static constexpr u32 CLEAR_STENCIL = 1U << 9;
+
     bool operator==(const RenderPassKey&) const noexcept = default;
 
     std::array<VideoCore::Surface::PixelFormat, 8> color_formats;
     VideoCore::Surface::PixelFormat depth_format;
     VkSampleCountFlagBits samples;
+    /// Attachments cleared on load instead of loading their contents. Render passes differing
+    /// only in it are compatible, so framebuffers and pipelines can be used with any of them.
+    u32 cleared_attachments{};
 };
 
 } // namespace Vulkan
@@ -27,6 +34,7 @@ struct hash<Vulkan::RenderPassKey> {
     [[nodiscard]] size_t operator()(const Vulkan::RenderPassKey& key) const noexcept {
         size_t value = static_cast<size_t>(key.depth_format) << 48;
         value ^= static_cast<size_t>(key.samples) << 52;
+        value ^= static_cast<size_t>(key.cleared_attachments) << 54;
         for (size_t i = 0; i < key.color_formats.size(); ++i) {
             value ^= static_cast<size_t>(key.color_formats[i]) << (i * 6);
         }
@@ -1,20 +1,31 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <utility>
 
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_gpu_profiler.h"
+#include "video_core/renderer_vulkan/vk_gpu_timer.h"
+#include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/texture_cache/formatter.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -22,6 +33,11 @@ namespace Vulkan {
 
 MICROPROFILE_DECLARE(Vulkan_WaitForWorker);
 
+namespace {
+constexpr size_t MIN_RECORDERS = 2;
+constexpr size_t MAX_RECORDERS = 4;
+} // Anonymous namespace
+
 void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
                                          vk::CommandBuffer upload_cmdbuf) {
     auto command = first;
@@ -42,11 +58,49 @@ Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
       master_semaphore{std::make_unique<MasterSemaphore>(device)},
       command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
     AcquireNewChunk();
-    AllocateWorkerCommandBuffer();
+    // Turbo mode measures the GPU load to only raise the clocks when the GPU limits the frame rate
+    if ((Settings::values.dynamic_resolution.GetValue() ||
+         Settings::values.renderer_force_max_clock.GetValue()) &&
+        device.HasGraphicsTimestamps()) {
+        gpu_timer = std::make_unique<GpuTimer>(device, *master_semaphore);
+        BeginGpuTimer();
+    }
+    if (Settings::values.gpu_profiling.GetValue() && device.HasGraphicsTimestamps()) {
+        gpu_profiler = std::make_unique<GpuProfiler>(device, *master_semaphore);
+    }
+    if (Settings::values.parallel_command_recording.GetValue()) {
+        // Leave room for the emulated CPU cores, the GPU thread and the driver's own threads
+        const size_t num_recorders = std::clamp<size_t>(std::thread::hardware_concurrency() / 4,
+                                                        MIN_RECORDERS, MAX_RECORDERS);
+        for (size_t index = 0; index < num_recorders; ++index) {
+            Recorder& recorder = *recorders.emplace_back(std::make_unique<Recorder>());
+            recorder.command_pool = std::make_unique<CommandPool>(*master_semaphore, device);
+            AllocateCommandBuffers(*recorder.command_pool, recorder.cmdbuf, recorder.upload_cmdbuf);
+            recorder.thread = std::jthread(
+                [this, &recorder](std::stop_token token) { RecorderThread(token, recorder); });
+        }
+        LOG_INFO(Render_Vulkan, "Recording command buffers on {} threads", num_recorders);
+    } else {
+        AllocateWorkerCommandBuffer();
+    }
     worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
 }
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler() {
+    if (recorders.empty()) {
+        return;
+    }
+    // Recorders can be blocked waiting for a submission from another recorder, release all of
+    // them before any recorder thread is joined.
+    {
+        std::scoped_lock lk{submission_mutex};
+        stop_submissions = true;
+    }
+    submission_cv.notify_all();
+    for (const auto& recorder : recorders) {
+        recorder->thread.request_stop();
+    }
+}
 
 u64 Scheduler::Flush(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     // When flushing, we only send data to the worker thread; no waiting is necessary.
@@ -65,6 +119,7 @@ void Scheduler::Finish(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore)
 
 void Scheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
+    TRACE_SCOPE(Vulkan, "WaitWorker");
     DispatchWork();
 
     // Ensure the queue is drained.
@@ -74,7 +129,12 @@ void Scheduler::WaitWorker() {
     }
 
     // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+    {
+        std::scoped_lock el{execution_mutex};
+    }
+
+    // Chunks handed to recorders are only done once the recorders are idle.
+    WaitRecorders();
 }
 
 void Scheduler::DispatchWork() {
@@ -90,20 +150,48 @@ void Scheduler::DispatchWork() {
 }
 
 void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
-    const VkRenderPass renderpass = framebuffer->RenderPass();
-    const VkFramebuffer framebuffer_handle = framebuffer->Handle();
-    const VkExtent2D render_area = framebuffer->RenderArea();
-    if (renderpass == state.renderpass && framebuffer_handle == state.framebuffer &&
-        render_area.width == state.render_area.width &&
-        render_area.height == state.render_area.height) {
+    if (IsRenderpassBound(framebuffer)) {
         return;
     }
+    BeginRenderpass(framebuffer, framebuffer->RenderPass(), {});
+}
+
+bool Scheduler::RequestClearingRenderpass(const Framebuffer* framebuffer,
+                                          VkRenderPass clearing_renderpass,
+                                          std::span<const VkClearValue> clear_values) {
+    if (IsRenderpassBound(framebuffer)) {
+        return false;
+    }
+    BeginRenderpass(framebuffer, clearing_renderpass, clear_values);
+    return true;
+}
+
+bool Scheduler::IsRenderpassBound(const Framebuffer* framebuffer) const noexcept {
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    return framebuffer->RenderPass() == state.renderpass &&
+           framebuffer->Handle() == state.framebuffer &&
+           render_area.width == state.render_area.width &&
+           render_area.height == state.render_area.height;
+}
+
+void Scheduler::BeginRenderpass(const Framebuffer* framebuffer, VkRenderPass renderpass,
+                                std::span<const VkClearValue> clear_values) {
+    const VkFramebuffer framebuffer_handle = framebuffer->Handle();
+    const VkExtent2D render_area = framebuffer->RenderArea();
     EndRenderPass();
-    state.renderpass = renderpass;
+    // Track the framebuffer's own renderpass, a clearing one is compatible with it and later
+    // requests for the framebuffer continue in the same renderpass
+    state.renderpass = framebuffer->RenderPass();
     state.framebuffer = framebuffer_handle;
     state.render_area = render_area;
+    if (gpu_profiler) {
+        BeginRenderPassScope(framebuffer);
+    }
 
-    Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
+    std::array<VkClearValue, 9> clear_value_array{};
+    std::ranges::copy(clear_values, clear_value_array.begin());
+    Record([renderpass, framebuffer_handle, render_area, clear_value_array,
+            num_clear_values = static_cast<u32>(clear_values.size())](vk::CommandBuffer cmdbuf) {
         const VkRenderPassBeginInfo renderpass_bi{
             .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
             .pNext = nullptr,
@@ -114,8 +202,8 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
                     .offset = {.x = 0, .y = 0},
                     .extent = render_area,
                 },
-            .clearValueCount = 0,
-            .pClearValues = nullptr,
+            .clearValueCount = num_clear_values,
+            .pClearValues = num_clear_values != 0 ? clear_value_array.data() : nullptr,
         };
         cmdbuf.BeginRenderPass(renderpass_bi, VK_SUBPASS_CONTENTS_INLINE);
     });
@@ -128,11 +216,60 @@ void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
 
+void Scheduler::RequestPreTransferBarrier() {
+    static constexpr VkMemoryBarrier READ_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+    };
+    RequestOutsideRenderPassOperationContext();
+    // Everything before the previous transfers is ordered with transfers by the barrier that
+    // preceded them, and the transfers themselves by the post-transfer barrier
+    if (post_transfer_barrier && chunk->LastCommand() == post_transfer_barrier) {
+        return;
+    }
+    Record([](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, READ_BARRIER);
+    });
+}
+
+void Scheduler::RecordPostTransferBarrier() {
+    static constexpr VkMemoryBarrier WRITE_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+    };
+    Record([](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, WRITE_BARRIER);
+    });
+    post_transfer_barrier = chunk->LastCommand();
+}
+
 bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline) {
     if (state.graphics_pipeline == pipeline) {
         return false;
     }
     state.graphics_pipeline = pipeline;
+    state.graphics_descriptors_defined = false;
+    if (renderpass_scope) {
+        gpu_profiler->AddShader(*renderpass_scope, pipeline->ShaderHash());
+    }
+    return true;
+}
+
+bool Scheduler::UpdateGraphicsDescriptors(std::span<const DescriptorUpdateEntry> descriptors) {
+    // The payload ring can be overwritten before the next draw, keep a copy to compare against
+    auto& bound = state.graphics_descriptors;
+    if (state.graphics_descriptors_defined && bound.size() == descriptors.size() &&
+        std::memcmp(bound.data(), descriptors.data(), descriptors.size_bytes()) == 0) {
+        return false;
+    }
+    bound.assign(descriptors.begin(), descriptors.end());
+    state.graphics_descriptors_defined = true;
     return true;
 }
 
@@ -147,6 +284,7 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
 
 void Scheduler::WorkerThread(std::stop_token stop_token) {
     Common::SetCurrentThreadName("VulkanWorker");
+    Common::Trace::SetThreadName("VulkanWorker");
 
     const auto TryPopQueue{[this](auto& work) -> bool {
         if (work_queue.empty()) {
@@ -178,10 +316,19 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // to complete in the next step.
             std::exchange(lk, std::unique_lock{execution_mutex});
 
+            if (!recorders.empty()) {
+                // Execution contexts are recorded by the recorder threads.
+                DispatchToRecorder(std::move(work));
+                continue;
+            }
+
             // Perform the work, tracking whether the chunk was a submission
             // before executing.
             const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            {
+                TRACE_SCOPE(Vulkan, "ExecuteChunk");
+                work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            }
 
             // If the chunk was a submission, reallocate the command buffer.
             if (has_submit) {
@@ -189,25 +336,100 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             }
         }
 
+        RecycleChunk(std::move(work));
+    }
+}
+
+void Scheduler::RecorderThread(std::stop_token stop_token, Recorder& recorder) {
+    Common::SetCurrentThreadName("VulkanRecorder");
+    Common::Trace::SetThreadName("VulkanRecorder");
+
+    while (!stop_token.stop_requested()) {
+        std::unique_ptr<CommandChunk> work;
+        {
+            std::unique_lock lk{recorder.mutex};
+            Common::CondvarWait(recorder.cv, lk, stop_token,
+                                [&recorder] { return !recorder.queue.empty(); });
+            if (stop_token.stop_requested()) {
+                return;
+            }
+            work = std::move(recorder.queue.front());
+            recorder.queue.pop();
+            recorder.is_executing = true;
+        }
+
+        const bool has_submit = work->HasSubmit();
         {
-            std::scoped_lock rl{reserve_mutex};
+            TRACE_SCOPE(Vulkan, "ExecuteChunk");
+            work->ExecuteAll(recorder.cmdbuf, recorder.upload_cmdbuf);
+        }
+        if (has_submit) {
+            AllocateCommandBuffers(*recorder.command_pool, recorder.cmdbuf,
+                                   recorder.upload_cmdbuf);
+        }
 
-            // Recycle the chunk back to the reserve.
-            chunk_reserve.emplace_back(std::move(work));
+        {
+            std::scoped_lock lk{recorder.mutex};
+            recorder.is_executing = false;
         }
+        recorder.cv.notify_all();
+
+        RecycleChunk(std::move(work));
+    }
+}
+
+void Scheduler::DispatchToRecorder(std::unique_ptr<CommandChunk> work) {
+    Recorder& recorder = *recorders[current_recorder];
+    const bool has_submit = work->HasSubmit();
+    {
+        std::scoped_lock lk{recorder.mutex};
+        recorder.queue.push(std::move(work));
+    }
+    recorder.cv.notify_all();
+
+    // Every execution context is recorded by a single thread, the next one goes to the next
+    // recorder so both can be recorded at the same time.
+    if (has_submit) {
+        current_recorder = (current_recorder + 1) % recorders.size();
+    }
+}
+
+void Scheduler::WaitRecorders() {
+    for (const auto& recorder : recorders) {
+        std::unique_lock lk{recorder->mutex};
+        recorder->cv.wait(lk, [&recorder] {
+            return recorder->queue.empty() && !recorder->is_executing;
+        });
     }
 }
 
+void Scheduler::RecycleChunk(std::unique_ptr<CommandChunk> work) {
+    std::scoped_lock rl{reserve_mutex};
+
+    // Recycle the chunk back to the reserve.
+    chunk_reserve.emplace_back(std::move(work));
+}
+
+void Scheduler::WaitSubmission(u64 tick) {
+    std::unique_lock lk{submission_mutex};
+    submission_cv.wait(lk, [this, tick] { return last_submitted_tick >= tick || stop_submissions; });
+}
+
 void Scheduler::AllocateWorkerCommandBuffer() {
-    current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_cmdbuf.Begin({
+    AllocateCommandBuffers(*command_pool, current_cmdbuf, current_upload_cmdbuf);
+}
+
+void Scheduler::AllocateCommandBuffers(CommandPool& pool, vk::CommandBuffer& cmdbuf,
+                                       vk::CommandBuffer& upload_cmdbuf) {
+    cmdbuf = vk::CommandBuffer(pool.Commit(), device.GetDispatchLoader());
+    cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_upload_cmdbuf.Begin({
+    upload_cmdbuf = vk::CommandBuffer(pool.Commit(), device.GetDispatchLoader());
+    upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
@@ -230,25 +452,45 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
         };
         upload_cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
+        if (gpu_timer) {
+            gpu_timer->End(cmdbuf, signal_value);
+        }
         upload_cmdbuf.End();
         cmdbuf.End();
 
+        // Execution contexts recorded on different threads still have to reach the queue in the
+        // order their ticks were handed out.
+        std::unique_lock submission_lock{submission_mutex};
+        submission_cv.wait(submission_lock, [this, signal_value] {
+            return last_submitted_tick + 1 == signal_value || stop_submissions;
+        });
+        if (stop_submissions) {
+            return;
+        }
+
         if (on_submit) {
             on_submit();
         }
 
-        std::scoped_lock lock{submit_mutex};
-        switch (const VkResult result = master_semaphore->SubmitQueue(
-                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
-        case VK_SUCCESS:
-            break;
-        case VK_ERROR_DEVICE_LOST:
-            device.ReportLoss();
-            [[fallthrough]];
-        default:
-            vk::Check(result);
-            break;
+        {
+            TRACE_SCOPE(Vulkan, "QueueSubmit");
+            std::scoped_lock lock{submit_mutex};
+            switch (const VkResult result = master_semaphore->SubmitQueue(
+                        cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
+            case VK_SUCCESS:
+                break;
+            case VK_ERROR_DEVICE_LOST:
+                device.ReportLoss();
+                [[fallthrough]];
+            default:
+                vk::Check(result);
+                break;
+            }
         }
+
+        last_submitted_tick = signal_value;
+        submission_lock.unlock();
+        submission_cv.notify_all();
     });
     chunk->MarkSubmit();
     DispatchWork();
@@ -256,6 +498,12 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
 }
 
 void Scheduler::AllocateNewContext() {
+    if (gpu_timer) {
+        BeginGpuTimer();
+    }
+    if (gpu_profiler) {
+        gpu_profiler->Collect();
+    }
     // Enable counters once again. These are disabled when a command buffer is finished.
     if (query_cache) {
 #if ANDROID
@@ -269,8 +517,62 @@ void Scheduler::AllocateNewContext() {
     }
 }
 
+void Scheduler::BeginGpuTimer() {
+    // Execution contexts are submitted in order, the one being opened gets the current tick
+    Record([this, tick = CurrentTick()](vk::CommandBuffer cmdbuf) {
+        gpu_timer->Begin(cmdbuf, tick);
+    });
+}
+
+void Scheduler::BeginProfileScope(std::string_view name, u64 shader_hash) {
+    if (!gpu_profiler) {
+        return;
+    }
+    RequestOutsideRenderPassOperationContext();
+    const u32 scope = gpu_profiler->Begin(std::string{name});
+    if (shader_hash != 0) {
+        gpu_profiler->AddShader(scope, shader_hash);
+    }
+    profile_scopes.push_back(scope);
+    Record([this, scope](vk::CommandBuffer cmdbuf) {
+        gpu_profiler->WriteTimestamp(cmdbuf, scope, false);
+    });
+}
+
+void Scheduler::EndProfileScope() {
+    if (!gpu_profiler || profile_scopes.empty()) {
+        return;
+    }
+    const u32 scope = profile_scopes.back();
+    profile_scopes.pop_back();
+    Record([this, scope](vk::CommandBuffer cmdbuf) {
+        gpu_profiler->WriteTimestamp(cmdbuf, scope, true);
+    });
+    gpu_profiler->End(scope, CurrentTick());
+}
+
+void Scheduler::BeginRenderPassScope(const Framebuffer* framebuffer) {
+    const RenderPassKey& key = framebuffer->GetRenderPassKey();
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    std::string name = fmt::format("Render pass {}x{}", render_area.width, render_area.height);
+    for (const auto format : key.color_formats) {
+        if (format != VideoCore::Surface::PixelFormat::Invalid) {
+            name += fmt::format(" {}", format);
+        }
+    }
+    if (key.depth_format != VideoCore::Surface::PixelFormat::Invalid) {
+        name += fmt::format(" {}", key.depth_format);
+    }
+    const u32 scope = gpu_profiler->Begin(std::move(name));
+    renderpass_scope = scope;
+    Record([this, scope](vk::CommandBuffer cmdbuf) {
+        gpu_profiler->WriteTimestamp(cmdbuf, scope, false);
+    });
+}
+
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
+    state.graphics_descriptors_defined = false;
     state.rescaling_defined = false;
     state_tracker.InvalidateCommandBufferState();
 }
@@ -323,10 +625,18 @@ void Scheduler::EndRenderPass() {
     });
     state.renderpass = nullptr;
     num_renderpass_images = 0;
+    if (renderpass_scope) {
+        const u32 scope = *std::exchange(renderpass_scope, std::nullopt);
+        Record([this, scope](vk::CommandBuffer cmdbuf) {
+            gpu_profiler->WriteTimestamp(cmdbuf, scope, true);
+        });
+        gpu_profiler->End(scope, CurrentTick());
+    }
 }
 
 void Scheduler::AcquireNewChunk() {
     std::scoped_lock rl{reserve_mutex};
+    post_transfer_barrier = nullptr;
 
     if (chunk_reserve.empty()) {
         // If we don't have anything reserved, we need to make a new chunk.
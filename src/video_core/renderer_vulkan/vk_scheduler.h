@@ -7,14 +7,21 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <queue>
+#include <span>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
+#include "common/trace.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
@@ -27,6 +34,8 @@ namespace Vulkan {
 class CommandPool;
 class Device;
 class Framebuffer;
+class GpuProfiler;
+class GpuTimer;
 class GraphicsPipeline;
 class StateTracker;
 
@@ -55,19 +64,49 @@ public:
     /// Requests to begin a renderpass.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Requests to begin a renderpass with a compatible renderpass clearing attachments on load.
+    /// Returns false when the framebuffer's renderpass is already active and nothing is cleared.
+    bool RequestClearingRenderpass(const Framebuffer* framebuffer, VkRenderPass clearing_renderpass,
+                                   std::span<const VkClearValue> clear_values);
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
 
+    /// Requests the transfers recorded next to be ordered after all previous commands. The barrier
+    /// is skipped right after a post-transfer barrier, which already orders them.
+    void RequestPreTransferBarrier();
+
+    /// Records a barrier ordering all following commands after the recorded transfers.
+    void RecordPostTransferBarrier();
+
     /// Update the pipeline to the current execution context.
     bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline);
 
+    /// Update the graphics descriptors bound for the current pipeline. Returns true if they differ
+    /// from the bound ones and have to be pushed again.
+    bool UpdateGraphicsDescriptors(std::span<const DescriptorUpdateEntry> descriptors);
+
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
+    /// Waits until the execution context signalling the given tick has been submitted to the
+    /// queue. Used by commands with host side effects that depend on a previous submission.
+    void WaitSubmission(u64 tick);
+
+    /// Returns true when a render pass is being recorded.
+    [[nodiscard]] bool IsRenderPassActive() const noexcept {
+        return state.renderpass != nullptr;
+    }
+
+    /// Returns true when execution contexts are recorded by several threads.
+    [[nodiscard]] bool IsParallelRecording() const noexcept {
+        return !recorders.empty();
+    }
+
     /// Assigns the query cache.
     void SetQueryCache(VideoCommon::QueryCacheBase<QueryCacheParams>& query_cache_) {
         query_cache = &query_cache_;
@@ -110,6 +149,7 @@ public:
 
     /// Waits for the given tick to trigger on the GPU.
     void Wait(u64 tick) {
+        TRACE_SCOPE(Vulkan, "WaitForTick");
         if (tick >= master_semaphore->CurrentTick()) {
             // Make sure we are not waiting for the current tick without signalling
             Flush();
@@ -122,6 +162,23 @@ public:
         return *master_semaphore;
     }
 
+    /// Returns the timer measuring the GPU time of submissions, null when nothing measures it.
+    [[nodiscard]] GpuTimer* GetGpuTimer() const noexcept {
+        return gpu_timer.get();
+    }
+
+    /// Returns true when the GPU time of the recorded work is profiled.
+    [[nodiscard]] bool IsProfilingGpu() const noexcept {
+        return gpu_profiler != nullptr;
+    }
+
+    /// Opens a GPU profiling scope around the work recorded until EndProfileScope is called,
+    /// ending the current render pass. Scopes can be nested.
+    void BeginProfileScope(std::string_view name, u64 shader_hash = 0);
+
+    /// Closes the innermost GPU profiling scope.
+    void EndProfileScope();
+
     std::mutex submit_mutex;
 
 private:
@@ -193,6 +250,10 @@ private:
             return command_offset == 0;
         }
 
+        const Command* LastCommand() const {
+            return last;
+        }
+
         bool HasSubmit() const {
             return submit;
         }
@@ -206,23 +267,59 @@ private:
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
 
+    /// Records whole execution contexts on its own thread and command pool.
+    struct Recorder {
+        std::unique_ptr<CommandPool> command_pool;
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+        std::queue<std::unique_ptr<CommandChunk>> queue;
+        bool is_executing = false;
+        std::mutex mutex;
+        std::condition_variable_any cv;
+        std::jthread thread;
+    };
+
     struct State {
         VkRenderPass renderpass = nullptr;
         VkFramebuffer framebuffer = nullptr;
         VkExtent2D render_area = {0, 0};
         GraphicsPipeline* graphics_pipeline = nullptr;
+        std::vector<DescriptorUpdateEntry> graphics_descriptors;
+        bool graphics_descriptors_defined = false;
         bool is_rescaling = false;
         bool rescaling_defined = false;
     };
 
     void WorkerThread(std::stop_token stop_token);
 
+    void RecorderThread(std::stop_token stop_token, Recorder& recorder);
+
+    /// Hands a chunk to the recorder of the current execution context.
+    void DispatchToRecorder(std::unique_ptr<CommandChunk> work);
+
+    /// Waits for all recorders to finish executing their chunks.
+    void WaitRecorders();
+
+    void RecycleChunk(std::unique_ptr<CommandChunk> work);
+
     void AllocateWorkerCommandBuffer();
 
+    void AllocateCommandBuffers(CommandPool& pool, vk::CommandBuffer& cmdbuf,
+                                vk::CommandBuffer& upload_cmdbuf);
+
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
     void AllocateNewContext();
 
+    void BeginGpuTimer();
+
+    void BeginRenderPassScope(const Framebuffer* framebuffer);
+
+    bool IsRenderpassBound(const Framebuffer* framebuffer) const noexcept;
+
+    void BeginRenderpass(const Framebuffer* framebuffer, VkRenderPass renderpass,
+                         std::span<const VkClearValue> clear_values);
+
     void EndPendingOperations();
 
     void EndRenderPass();
@@ -234,6 +331,11 @@ private:
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
     std::unique_ptr<CommandPool> command_pool;
+    std::unique_ptr<GpuTimer> gpu_timer;
+    std::unique_ptr<GpuProfiler> gpu_profiler;
+    std::vector<u32> profile_scopes;
+    /// Scope of the render pass being recorded, when it is profiled
+    std::optional<u32> renderpass_scope;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
 
@@ -242,6 +344,8 @@ private:
 
     std::unique_ptr<CommandChunk> chunk;
     std::function<void()> on_submit;
+    /// Last post-transfer barrier of the chunk, transfers right after it need no other barrier
+    const Command* post_transfer_barrier = nullptr;
 
     State state;
 
@@ -255,6 +359,15 @@ private:
     std::mutex reserve_mutex;
     std::mutex queue_mutex;
     std::condition_variable_any event_cv;
+
+    std::vector<std::unique_ptr<Recorder>> recorders;
+    size_t current_recorder = 0;
+
+    u64 last_submitted_tick = 0;
+    bool stop_submissions = false;
+    std::mutex submission_mutex;
+    std::condition_variable submission_cv;
+
     std::jthread worker_thread;
 };
 
@@ -12,6 +12,7 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -71,6 +72,7 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
     }
     stream_pointer = stream_buffer.Mapped();
     ASSERT_MSG(!stream_pointer.empty(), "Stream buffer must be host visible!");
+    memory_account.Add(stream_buffer_size);
 }
 
 StagingBufferPool::~StagingBufferPool() = default;
@@ -79,6 +81,9 @@ StagingBufferRef StagingBufferPool::Request(size_t size, MemoryUsage usage, bool
     if (!deferred && usage == MemoryUsage::Upload && size <= region_size) {
         return GetStreamBuffer(size);
     }
+    // Stream requests diverted by a ring stall are only counted as stalls
+    ++frame_stats.fallback_requests;
+    frame_stats.fallback_bytes += size;
     return GetStagingBuffer(size, usage, deferred);
 }
 
@@ -97,6 +102,19 @@ void StagingBufferPool::FreeDeferred(StagingBufferRef& ref) {
 void StagingBufferPool::TickFrame() {
     current_delete_level = (current_delete_level + 1) % NUM_LEVELS;
 
+    if (frame_stats.stream_bytes > stream_high_water_mark) {
+        stream_high_water_mark = frame_stats.stream_bytes;
+    }
+    if (frame_stats.ring_stalls != 0 || frame_stats.created_buffers != 0) {
+        LOG_DEBUG(Render_Vulkan,
+                  "Staging: {} stream bytes ({} peak), {} ring stalls, {} fallback bytes, "
+                  "{} buffers created ({} bytes)",
+                  frame_stats.stream_bytes, stream_high_water_mark, frame_stats.ring_stalls,
+                  frame_stats.fallback_bytes, frame_stats.created_buffers,
+                  frame_stats.created_buffer_bytes);
+    }
+    last_frame_stats = std::exchange(frame_stats, StagingBufferStats{});
+
     ReleaseCache(MemoryUsage::DeviceLocal);
     ReleaseCache(MemoryUsage::Upload);
     ReleaseCache(MemoryUsage::Download);
@@ -106,6 +124,7 @@ StagingBufferRef StagingBufferPool::GetStreamBuffer(size_t size) {
     if (AreRegionsActive(Region(free_iterator) + 1,
                          std::min(Region(iterator + size) + 1, NUM_SYNCS))) {
         // Avoid waiting for the previous usages to be free
+        ++frame_stats.ring_stalls;
         return GetStagingBuffer(size, MemoryUsage::Upload);
     }
     const u64 current_tick = scheduler.CurrentTick();
@@ -123,9 +142,12 @@ StagingBufferRef StagingBufferPool::GetStreamBuffer(size_t size) {
 
         if (AreRegionsActive(0, Region(size) + 1)) {
             // Avoid waiting for the previous usages to be free
+            ++frame_stats.ring_stalls;
             return GetStagingBuffer(size, MemoryUsage::Upload);
         }
     }
+    ++frame_stats.stream_requests;
+    frame_stats.stream_bytes += size;
     const size_t offset = iterator;
     iterator = Common::AlignUp(iterator + size, MAX_ALIGNMENT);
     return StagingBufferRef{
@@ -195,6 +217,9 @@ StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage
         buffer_ci.usage |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
     }
     vk::Buffer buffer = memory_allocator.CreateBuffer(buffer_ci, usage);
+    ++frame_stats.created_buffers;
+    frame_stats.created_buffer_bytes += buffer_ci.size;
+    memory_account.Add(buffer_ci.size);
     if (device.HasDebuggingToolAttached()) {
         ++buffer_index;
         buffer.SetObjectNameEXT(fmt::format("Staging Buffer {}", buffer_index).c_str());
@@ -246,6 +271,7 @@ void StagingBufferPool::ReleaseLevel(StagingBuffersCache& cache, size_t log2) {
     entries.erase(std::remove_if(begin, end, is_deletable), end);
 
     const size_t new_size = entries.size();
+    memory_account.Remove(static_cast<u64>(old_size - new_size) << log2);
     staging.delete_index += deletions_per_tick;
     if (staging.delete_index >= new_size) {
         staging.delete_index = 0;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -25,6 +26,17 @@ struct StagingBufferRef {
     u64 index;
 };
 
+/// Staging memory usage collected over a frame.
+struct StagingBufferStats {
+    u64 stream_requests = 0;      ///< Requests sub-allocated from the stream buffer ring.
+    u64 stream_bytes = 0;         ///< Bytes sub-allocated from the stream buffer ring.
+    u64 ring_stalls = 0;          ///< Requests that found the ring still in use by the GPU.
+    u64 fallback_requests = 0;    ///< Other requests served by dedicated staging buffers.
+    u64 fallback_bytes = 0;       ///< Bytes of the other requests.
+    u64 created_buffers = 0;      ///< Dedicated staging buffers allocated.
+    u64 created_buffer_bytes = 0; ///< Bytes of dedicated staging buffers allocated.
+};
+
 class StagingBufferPool {
 public:
     static constexpr size_t NUM_SYNCS = 16;
@@ -42,6 +54,16 @@ public:
 
     void TickFrame();
 
+    /// Returns the staging statistics of the last completed frame.
+    [[nodiscard]] const StagingBufferStats& LastFrameStats() const noexcept {
+        return last_frame_stats;
+    }
+
+    /// Returns the largest amount of stream buffer bytes used in a single frame.
+    [[nodiscard]] u64 StreamHighWaterMark() const noexcept {
+        return stream_high_water_mark;
+    }
+
 private:
     struct StreamBufferCommit {
         size_t upper_bound;
@@ -119,6 +141,12 @@ private:
     size_t current_delete_level = 0;
     u64 buffer_index = 0;
     u64 unique_ids{};
+
+    Common::MemoryAccount memory_account{Common::MemoryCategory::StagingBuffers};
+
+    StagingBufferStats frame_stats;
+    StagingBufferStats last_frame_stats;
+    u64 stream_high_water_mark = 0;
 };
 
 } // namespace Vulkan
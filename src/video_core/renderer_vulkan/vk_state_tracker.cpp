@@ -53,6 +53,9 @@ Flags MakeInvalidationFlags() {
         DepthBiasEnable,
         LogicOpEnable,
         DepthClampEnable,
+        PolygonMode,
+        AlphaToCoverageEnable,
+        AlphaToOneEnable,
         LogicOp,
         Blending,
         ColorMask,
@@ -144,6 +147,12 @@ void SetupDirtyStateEnable(Tables& tables) {
     setup(OFF(viewport_clip_control.geometry_clip), DepthClampEnable);
 }
 
+void SetupDirtyRasterizationModes(Tables& tables) {
+    tables[0][OFF(polygon_mode_front)] = PolygonMode;
+    tables[0][OFF(anti_alias_alpha_control)] = AlphaToCoverageEnable;
+    tables[1][OFF(anti_alias_alpha_control)] = AlphaToOneEnable;
+}
+
 void SetupDirtyDepthCompareOp(Tables& tables) {
     tables[0][OFF(depth_test_func)] = DepthCompareOp;
 }
@@ -228,6 +237,7 @@ void StateTracker::SetupTables(Tegra::Control::ChannelState& channel_state) {
     SetupDirtyLineWidth(tables);
     SetupDirtyCullMode(tables);
     SetupDirtyStateEnable(tables);
+    SetupDirtyRasterizationModes(tables);
     SetupDirtyDepthCompareOp(tables);
     SetupDirtyFrontFace(tables);
     SetupDirtyStencilOp(tables);
@@ -236,6 +246,7 @@ void StateTracker::SetupTables(Tegra::Control::ChannelState& channel_state) {
     SetupDirtyVertexAttributes(tables);
     SetupDirtyVertexBindings(tables);
     SetupDirtySpecialOps(tables);
+    channel_state.maxwell_3d->dirty.PackTables();
 }
 
 void StateTracker::ChangeChannel(Tegra::Control::ChannelState& channel_state) {
@@ -268,6 +268,19 @@ void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
         format_list.pNext = std::exchange(swapchain_ci.pNext, &format_list);
         swapchain_ci.flags |= VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR;
     }
+#ifdef _WIN32
+    // Let the driver flip the swapchain straight to the display, bypassing the desktop
+    // compositor, while the render window covers the whole screen in exclusive fullscreen mode.
+    VkSurfaceFullScreenExclusiveInfoEXT full_screen_exclusive{
+        .sType = VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT,
+        .pNext = nullptr,
+        .fullScreenExclusive = VK_FULL_SCREEN_EXCLUSIVE_ALLOWED_EXT,
+    };
+    if (device.IsExtFullScreenExclusiveEnabled() &&
+        Settings::values.fullscreen_mode.GetValue() == Settings::FullscreenMode::Exclusive) {
+        full_screen_exclusive.pNext = std::exchange(swapchain_ci.pNext, &full_screen_exclusive);
+    }
+#endif
     // Request the size again to reduce the possibility of a TOCTOU race condition.
     const auto updated_capabilities = physical_device.GetSurfaceCapabilitiesKHR(surface);
     swapchain_ci.imageExtent = ChooseSwapExtent(updated_capabilities, width, height);
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <mutex>
 #include <span>
 #include <vector>
 #include <boost/container/small_vector.hpp>
@@ -17,6 +18,7 @@
 #include "video_core/renderer_vulkan/blit_image.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_gpu_timer.h"
 #include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
@@ -155,12 +157,34 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     };
 }
 
+[[nodiscard]] bool IsSparseResidencyCompatible(const Device& device, const ImageInfo& info) {
+    if (!info.is_sparse || !device.IsSparseResidencySupported()) {
+        return false;
+    }
+    if (info.type != ImageType::e2D || info.num_samples != 1 || info.size.depth != 1) {
+        return false;
+    }
+    if (VideoCore::Surface::GetFormatType(info.format) != SurfaceType::ColorTexture) {
+        return false;
+    }
+    const VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info);
+    const auto properties = device.GetPhysical().GetSparseImageFormatProperties(
+        image_ci.format, image_ci.imageType, image_ci.samples, image_ci.usage, image_ci.tiling);
+    return std::ranges::any_of(properties, [](const VkSparseImageFormatProperties& property) {
+        return (property.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0;
+    });
+}
+
 [[nodiscard]] vk::Image MakeImage(const Device& device, const MemoryAllocator& allocator,
-                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
+                                  const ImageInfo& info, std::span<const VkFormat> view_formats,
+                                  bool sparse_residency = false) {
     if (info.type == ImageType::Buffer) {
         return vk::Image{};
     }
     VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info);
+    if (sparse_residency) {
+        image_ci.flags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    }
     const VkImageFormatListCreateInfo image_format_list = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO,
         .pNext = nullptr,
@@ -173,6 +197,9 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
             image_ci.pNext = &image_format_list;
         }
     }
+    if (sparse_residency) {
+        return allocator.CreateSparseImage(image_ci);
+    }
     return allocator.CreateImage(image_ci);
 }
 
@@ -1104,6 +1131,7 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
     const VkImageSubresourceLayers src_layers = MakeSubresourceLayers(&src);
     const bool is_resolve = is_src_msaa && !is_dst_msaa;
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.BeginProfileScope(is_resolve ? "Resolve image" : "Blit image");
     scheduler.Record([filter, dst_region, src_region, dst_image, src_image, dst_layers, src_layers,
                       aspect_mask, is_resolve](vk::CommandBuffer cmdbuf) {
         const std::array read_barriers{
@@ -1185,6 +1213,7 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                0, write_barrier);
     });
+    scheduler.EndProfileScope();
 }
 
 void TextureCacheRuntime::ConvertImage(Framebuffer* dst, ImageView& dst_view, ImageView& src_view) {
@@ -1359,24 +1388,36 @@ u64 TextureCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 TextureCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool TextureCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
 
+u64 TextureCacheRuntime::GetGpuTime() const {
+    GpuTimer* const gpu_timer = scheduler.GetGpuTimer();
+    return gpu_timer ? gpu_timer->GetGpuTime() : 0;
+}
+
 void TextureCacheRuntime::TickFrame() {}
 
 Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu_addr_,
              VAddr cpu_addr_)
     : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), scheduler{&runtime_.scheduler},
-      runtime{&runtime_}, original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
-                                                   runtime->ViewFormats(info.format))),
+      runtime{&runtime_}, sparse_residency{IsSparseResidencyCompatible(runtime_.device, info)},
+      original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
+                               runtime->ViewFormats(info.format), sparse_residency)),
       aspect_mask(ImageAspectMask(info.format)) {
     if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported()) {
         switch (Settings::values.accelerate_astc.GetValue()) {
         case Settings::AstcDecodeMode::Gpu:
-            if (Settings::values.astc_recompression.GetValue() ==
-                    Settings::AstcRecompression::Uncompressed &&
-                info.size.depth == 1) {
+            // Recompressed images are encoded to BCn by a compute pass after decoding
+            if (info.size.depth == 1 &&
+                (Settings::values.astc_recompression.GetValue() ==
+                     Settings::AstcRecompression::Uncompressed ||
+                 runtime->device.IsOptimalBcnSupported())) {
                 flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
             }
             break;
@@ -1411,6 +1452,147 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
 
 Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBase{params} {}
 
+void Image::CommitSparseMemory(std::span<const std::pair<u64, u64>> resident_ranges) {
+    if (!sparse_residency) {
+        return;
+    }
+    const auto& logical = runtime->device.GetLogical();
+    const VkMemoryRequirements requirements = logical.GetImageMemoryRequirements(*original_image);
+    const auto sparse_requirements = logical.GetImageSparseMemoryRequirements(*original_image);
+    const auto color_it = std::ranges::find_if(sparse_requirements, [](const auto& sparse) {
+        return (sparse.formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0;
+    });
+    ASSERT(color_it != sparse_requirements.end());
+
+    // The alignment of a sparse resource is the size of its memory blocks
+    const auto commit = [&](VkDeviceSize size) -> const MemoryCommit& {
+        const VkMemoryRequirements block_requirements{
+            .size = size,
+            .alignment = requirements.alignment,
+            .memoryTypeBits = requirements.memoryTypeBits,
+        };
+        return sparse_commits.emplace_back(
+            runtime->memory_allocator.Commit(block_requirements, MemoryUsage::DeviceLocal));
+    };
+    const auto is_resident = [&](u32 level, u32 layer, VideoCommon::Offset2D offset,
+                                 VideoCommon::Extent2D extent) {
+        const auto ranges =
+            VideoCommon::CalculateRegionGuestRanges(info, level, layer, offset, extent);
+        return std::ranges::any_of(ranges, [&](const std::pair<u32, u32>& range) {
+            return std::ranges::any_of(resident_ranges, [&](const std::pair<u64, u64>& resident) {
+                return range.first < resident.second && resident.first < range.second;
+            });
+        });
+    };
+
+    // Only the blocks of the levels that overlap guest mapped memory are committed
+    const VkSparseImageMemoryRequirements& color = *color_it;
+    const VkExtent3D granularity = color.formatProperties.imageGranularity;
+    const u32 num_layers = static_cast<u32>(info.resources.layers);
+    const u32 num_levels = static_cast<u32>(info.resources.levels);
+    const u32 num_block_levels = std::min(color.imageMipTailFirstLod, num_levels);
+    std::vector<VkSparseImageMemoryBind> image_binds;
+    for (u32 layer = 0; layer < num_layers; ++layer) {
+        for (u32 level = 0; level < num_block_levels; ++level) {
+            const VideoCommon::Extent3D size = VideoCommon::MipSize(info.size, level);
+            for (u32 y = 0; y < size.height; y += granularity.height) {
+                for (u32 x = 0; x < size.width; x += granularity.width) {
+                    const VideoCommon::Offset2D offset{
+                        .x = static_cast<s32>(x),
+                        .y = static_cast<s32>(y),
+                    };
+                    const VideoCommon::Extent2D extent{
+                        .width = std::min(granularity.width, size.width - x),
+                        .height = std::min(granularity.height, size.height - y),
+                    };
+                    if (!is_resident(level, layer, offset, extent)) {
+                        continue;
+                    }
+                    const MemoryCommit& block = commit(requirements.alignment);
+                    image_binds.push_back({
+                        .subresource{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .mipLevel = level,
+                            .arrayLayer = layer,
+                        },
+                        .offset{.x = offset.x, .y = offset.y, .z = 0},
+                        .extent{.width = extent.width, .height = extent.height, .depth = 1},
+                        .memory = block.Memory(),
+                        .memoryOffset = block.Offset(),
+                        .flags = 0,
+                    });
+                }
+            }
+        }
+    }
+
+    // Mip tails and metadata are small and always committed
+    std::vector<VkSparseMemoryBind> opaque_binds;
+    for (const VkSparseImageMemoryRequirements& sparse : sparse_requirements) {
+        const bool is_metadata =
+            (sparse.formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) != 0;
+        if (!is_metadata && sparse.imageMipTailFirstLod >= num_levels) {
+            continue;
+        }
+        const bool single_tail =
+            (sparse.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        const u32 num_tails = single_tail ? 1 : num_layers;
+        for (u32 tail = 0; tail < num_tails; ++tail) {
+            const MemoryCommit& block = commit(sparse.imageMipTailSize);
+            opaque_binds.push_back({
+                .resourceOffset = sparse.imageMipTailOffset + tail * sparse.imageMipTailStride,
+                .size = sparse.imageMipTailSize,
+                .memory = block.Memory(),
+                .memoryOffset = block.Offset(),
+                .flags = is_metadata ? VkSparseMemoryBindFlags{VK_SPARSE_MEMORY_BIND_METADATA_BIT}
+                                     : VkSparseMemoryBindFlags{},
+            });
+        }
+    }
+    if (image_binds.empty() && opaque_binds.empty()) {
+        return;
+    }
+    const VkSparseImageMemoryBindInfo image_bind_info{
+        .image = *original_image,
+        .bindCount = static_cast<u32>(image_binds.size()),
+        .pBinds = image_binds.data(),
+    };
+    const VkSparseImageOpaqueMemoryBindInfo opaque_bind_info{
+        .image = *original_image,
+        .bindCount = static_cast<u32>(opaque_binds.size()),
+        .pBinds = opaque_binds.data(),
+    };
+    const VkBindSparseInfo bind_info{
+        .sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .bufferBindCount = 0,
+        .pBufferBinds = nullptr,
+        .imageOpaqueBindCount = opaque_binds.empty() ? 0u : 1u,
+        .pImageOpaqueBinds = &opaque_bind_info,
+        .imageBindCount = image_binds.empty() ? 0u : 1u,
+        .pImageBinds = &image_bind_info,
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores = nullptr,
+    };
+
+    // Sparse binding is not ordered against command buffers, so wait for it on the host before
+    // the image is used by any submission
+    const vk::Fence fence = logical.CreateFence({
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+    });
+    {
+        std::scoped_lock lock{scheduler->submit_mutex};
+        vk::Check(runtime->device.GetGraphicsQueue().BindSparse(bind_info, *fence));
+    }
+    vk::Check(fence.Wait());
+    LOG_DEBUG(Render_Vulkan, "Committed {} of {} sparse blocks for image 0x{:x}",
+              image_binds.size(), requirements.size / requirements.alignment, gpu_addr);
+}
+
 Image::~Image() = default;
 
 void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
@@ -1870,6 +2052,13 @@ bool ImageView::IsRescaled() const noexcept {
     return src_image.IsRescaled();
 }
 
+PixelFormat ImageView::ImageFormat() const noexcept {
+    if (!slot_images) {
+        return format;
+    }
+    return (*slot_images)[image_id].info.format;
+}
+
 vk::ImageView ImageView::MakeView(VkFormat vk_format, VkImageAspectFlags aspect_mask) {
     return device->GetLogical().CreateImageView({
         .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
@@ -1974,8 +2163,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                     std::span<ImageView*, NUM_RT> color_buffers,
                                     ImageView* depth_buffer, bool is_rescaled_) {
     boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
-    RenderPassKey renderpass_key{};
-    s32 num_layers = 1;
+    s32 max_layers = 1;
 
     is_rescaled = is_rescaled_;
     const auto& resolution = runtime.resolution;
@@ -1994,7 +2182,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                               : color_buffer->size.height);
         attachments.push_back(color_buffer->RenderTarget());
         renderpass_key.color_formats[index] = color_buffer->format;
-        num_layers = std::max(num_layers, color_buffer->range.extent.layers);
+        max_layers = std::max(max_layers, color_buffer->range.extent.layers);
         images[num_images] = color_buffer->ImageHandle();
         image_ranges[num_images] = MakeSubresourceRange(color_buffer);
         rt_map[index] = num_images;
@@ -2009,7 +2197,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                               : depth_buffer->size.height);
         attachments.push_back(depth_buffer->RenderTarget());
         renderpass_key.depth_format = depth_buffer->format;
-        num_layers = std::max(num_layers, depth_buffer->range.extent.layers);
+        max_layers = std::max(max_layers, depth_buffer->range.extent.layers);
         images[num_images] = depth_buffer->ImageHandle();
         const VkImageSubresourceRange subresource_range = MakeSubresourceRange(depth_buffer);
         image_ranges[num_images] = subresource_range;
@@ -2027,6 +2215,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     render_area.height = std::min(render_area.height, height);
 
     num_color_buffers = static_cast<u32>(num_colors);
+    num_layers = static_cast<u32>(max_layers);
     framebuffer = runtime.device.GetLogical().CreateFramebuffer({
         .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -2036,7 +2225,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         .pAttachments = attachments.data(),
         .width = render_area.width,
         .height = render_area.height,
-        .layers = static_cast<u32>(std::max(num_layers, 1)),
+        .layers = num_layers,
     });
 }
 
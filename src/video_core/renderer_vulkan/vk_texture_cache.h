@@ -9,6 +9,7 @@
 
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
@@ -61,8 +62,12 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
+    u64 GetGpuTime() const;
+
     void BlitImage(Framebuffer* dst_framebuffer, ImageView& dst, ImageView& src,
                    const Region2D& dst_region, const Region2D& src_region,
                    Tegra::Engines::Fermi2D::Filter filter,
@@ -156,6 +161,10 @@ public:
     void DownloadMemory(const StagingBufferRef& map,
                         std::span<const VideoCommon::BufferImageCopy> copies);
 
+    /// Binds memory to the blocks of a sparse resident image that overlap the given guest byte
+    /// ranges, relative to the image base. Does nothing for fully backed images.
+    void CommitSparseMemory(std::span<const std::pair<u64, u64>> resident_ranges);
+
     [[nodiscard]] VkImage Handle() const noexcept {
         return current_image;
     }
@@ -185,6 +194,8 @@ private:
     Scheduler* scheduler{};
     TextureCacheRuntime* runtime{};
 
+    bool sparse_residency = false;
+    std::vector<MemoryCommit> sparse_commits;
     vk::Image original_image;
     std::vector<vk::ImageView> storage_image_views;
     VkImageAspectFlags aspect_mask = 0;
@@ -227,6 +238,9 @@ public:
 
     [[nodiscard]] bool IsRescaled() const noexcept;
 
+    /// Returns the format of the viewed image, which can differ from the format of the view
+    [[nodiscard]] PixelFormat ImageFormat() const noexcept;
+
     [[nodiscard]] VkImageView Handle(Shader::TextureType texture_type) const noexcept {
         return *image_views[static_cast<size_t>(texture_type)];
     }
@@ -341,6 +355,15 @@ public:
         return num_images;
     }
 
+    [[nodiscard]] u32 NumLayers() const noexcept {
+        return num_layers;
+    }
+
+    /// Returns the attachment index of a render target, the depth attachment follows the colors
+    [[nodiscard]] size_t ColorAttachmentIndex(size_t index) const noexcept {
+        return rt_map[index];
+    }
+
     [[nodiscard]] const std::array<VkImage, 9>& Images() const noexcept {
         return images;
     }
@@ -365,13 +388,19 @@ public:
         return is_rescaled;
     }
 
+    [[nodiscard]] const RenderPassKey& GetRenderPassKey() const noexcept {
+        return renderpass_key;
+    }
+
 private:
     vk::Framebuffer framebuffer;
     VkRenderPass renderpass{};
+    RenderPassKey renderpass_key{};
     VkExtent2D render_area{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
     u32 num_color_buffers = 0;
     u32 num_images = 0;
+    u32 num_layers = 1;
     std::array<VkImage, 9> images{};
     std::array<VkImageSubresourceRange, 9> image_ranges{};
     std::array<size_t, NUM_RT> rt_map{};
@@ -386,6 +415,8 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = false;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool IMPLEMENTS_SPARSE_RESIDENCY = true;
+    static constexpr bool HAS_GPU_TIME = true;
 
     using Runtime = Vulkan::TextureCacheRuntime;
     using Image = Vulkan::Image;
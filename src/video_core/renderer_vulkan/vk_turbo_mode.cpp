@@ -4,8 +4,13 @@
 #if defined(ANDROID) && defined(ARCHITECTURE_arm64)
 #include <adrenotools/driver.h>
 #endif
+#ifdef ANDROID
+#include <unistd.h>
+#endif
 
+#include "common/dynamic_library.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "video_core/host_shaders/vulkan_turbo_mode_comp_spv.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
@@ -16,6 +21,77 @@ namespace Vulkan {
 
 using namespace Common::Literals;
 
+namespace {
+/// Number of presented frames the GPU load is averaged over
+constexpr u32 WINDOW_FRAMES = 30;
+/// Minimum number of windows turbo mode stays engaged for, so it does not oscillate when the
+/// clocks it raises are what keeps the load low
+constexpr u32 MIN_HOLD_WINDOWS = 4;
+/// Fraction of the time between frames the GPU has to be busy for to engage turbo mode
+constexpr f64 ENGAGE_LOAD = 0.9;
+/// Fraction of the time between frames the GPU has to be busy for under to release turbo mode
+constexpr f64 RELEASE_LOAD = 0.7;
+} // Anonymous namespace
+
+#ifdef ANDROID
+/// Session of the Android performance hint API, reporting how long the GPU work of each frame
+/// takes compared to the time between frames so the system can raise the clocks of the thread
+/// presenting them. The API is only available since Android 13 and is loaded at runtime.
+class TurboMode::PerformanceHintSession {
+public:
+    explicit PerformanceHintSession(s64 target_ns) {
+        if (!library.Open("libandroid.so") ||
+            !library.GetSymbol("APerformanceHint_getManager", &get_manager) ||
+            !library.GetSymbol("APerformanceHint_createSession", &create_session) ||
+            !library.GetSymbol("APerformanceHint_updateTargetWorkDuration", &update_target) ||
+            !library.GetSymbol("APerformanceHint_reportActualWorkDuration", &report_actual) ||
+            !library.GetSymbol("APerformanceHint_closeSession", &close_session)) {
+            LOG_DEBUG(Render_Vulkan, "Performance hint API is not available");
+            return;
+        }
+        void* const manager = get_manager();
+        if (!manager) {
+            return;
+        }
+        const s32 tid = static_cast<s32>(gettid());
+        session = create_session(manager, &tid, 1, target_ns);
+    }
+
+    ~PerformanceHintSession() {
+        if (session) {
+            close_session(session);
+        }
+    }
+
+    void UpdateTarget(s64 target_ns) {
+        if (session && target_ns > 0) {
+            update_target(session, target_ns);
+        }
+    }
+
+    void Report(s64 actual_ns) {
+        if (session && actual_ns > 0) {
+            report_actual(session, actual_ns);
+        }
+    }
+
+private:
+    using GetManager = void* (*)();
+    using CreateSession = void* (*)(void*, const s32*, size_t, s64);
+    using UpdateTargetWorkDuration = int (*)(void*, s64);
+    using ReportActualWorkDuration = int (*)(void*, s64);
+    using CloseSession = void (*)(void*);
+
+    Common::DynamicLibrary library;
+    GetManager get_manager{};
+    CreateSession create_session{};
+    UpdateTargetWorkDuration update_target{};
+    ReportActualWorkDuration report_actual{};
+    CloseSession close_session{};
+    void* session{};
+};
+#endif
+
 TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld)
 #ifndef ANDROID
     : m_device{CreateDevice(instance, dld, VK_NULL_HANDLE)}, m_allocator{m_device}
@@ -25,6 +101,7 @@ TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& d
         std::scoped_lock lk{m_submission_lock};
         m_submission_time = std::chrono::steady_clock::now();
     }
+    m_window_start = std::chrono::steady_clock::now();
     m_thread = std::jthread([&](auto stop_token) { Run(stop_token); });
 }
 
@@ -36,6 +113,59 @@ void TurboMode::QueueSubmitted() {
     m_submission_cv.notify_one();
 }
 
+void TurboMode::FrameEnded(u64 gpu_time_ns) {
+    const u64 frame_gpu_ns = gpu_time_ns - m_last_gpu_time;
+    m_last_gpu_time = gpu_time_ns;
+#ifdef ANDROID
+    if (m_hint_session) {
+        m_hint_session->Report(static_cast<s64>(frame_gpu_ns));
+    }
+#endif
+    m_window_gpu_ns += frame_gpu_ns;
+    if (++m_window_frames < WINDOW_FRAMES) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto window_time = now - m_window_start;
+    const auto window_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(window_time);
+    UpdateLoad(m_window_gpu_ns, static_cast<u64>(window_ns.count()));
+    m_window_start = now;
+    m_window_gpu_ns = 0;
+    m_window_frames = 0;
+}
+
+void TurboMode::UpdateLoad(u64 window_gpu_ns, u64 window_ns) {
+    ++m_windows_since_change;
+    // The GPU time of the finished submissions lags behind by a few frames, windows even it out
+    const f64 load =
+        window_ns != 0 ? static_cast<f64>(window_gpu_ns) / static_cast<f64>(window_ns) : 0.0;
+    // Only this thread changes the state, it can be read without locking
+    bool should_engage = load >= ENGAGE_LOAD;
+    if (m_engaged) {
+        should_engage = m_windows_since_change < MIN_HOLD_WINDOWS || load > RELEASE_LOAD;
+    }
+    if (should_engage != m_engaged) {
+        {
+            std::scoped_lock lk{m_submission_lock};
+            m_engaged = should_engage;
+        }
+        m_submission_cv.notify_one();
+        m_windows_since_change = 0;
+        LOG_DEBUG(Render_Vulkan, "GPU load {:.0f}%, turbo mode {}", load * 100.0,
+                  should_engage ? "engaged" : "released");
+    }
+#ifdef ANDROID
+    const s64 target_ns = static_cast<s64>(window_ns / WINDOW_FRAMES);
+    if (!should_engage) {
+        m_hint_session.reset();
+    } else if (!m_hint_session) {
+        m_hint_session = std::make_unique<PerformanceHintSession>(target_ns);
+    } else {
+        m_hint_session->UpdateTarget(target_ns);
+    }
+#endif
+}
+
 void TurboMode::Run(std::stop_token stop_token) {
 #ifndef ANDROID
     auto& dld = m_device.GetLogical();
@@ -222,11 +352,17 @@ void TurboMode::Run(std::stop_token stop_token) {
         // Wait for completion.
         fence.Wait();
 #endif
-        // Wait for the next graphics queue submission if necessary.
+        // Wait for the next graphics queue submission if necessary, or until the GPU load calls for
+        // turbo mode again.
         std::unique_lock lk{m_submission_lock};
+#if defined(ANDROID) && defined(ARCHITECTURE_arm64)
+        if (!m_engaged) {
+            adrenotools_set_turbo(false);
+        }
+#endif
         Common::CondvarWait(m_submission_cv, lk, stop_token, [this] {
-            return (std::chrono::steady_clock::now() - m_submission_time) <=
-                   std::chrono::milliseconds{100};
+            return m_engaged && (std::chrono::steady_clock::now() - m_submission_time) <=
+                                    std::chrono::milliseconds{100};
         });
     }
 #if defined(ANDROID) && defined(ARCHITECTURE_arm64)
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 #include <mutex>
 
+#include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
@@ -20,9 +22,23 @@ public:
 
     void QueueSubmitted();
 
+    /**
+     * Measures the GPU load of the frame that was just presented, turbo mode is only engaged while
+     * the GPU time of frames is close to the time between them.
+     * @param gpu_time_ns Total time in nanoseconds the GPU has spent on submissions so far
+     */
+    void FrameEnded(u64 gpu_time_ns);
+
 private:
+#ifdef ANDROID
+    class PerformanceHintSession;
+#endif
+
     void Run(std::stop_token stop_token);
 
+    /// Engages or releases turbo mode from the load of the last window of frames
+    void UpdateLoad(u64 window_gpu_ns, u64 window_ns);
+
 #ifndef ANDROID
     Device m_device;
     MemoryAllocator m_allocator;
@@ -30,6 +46,17 @@ private:
     std::mutex m_submission_lock;
     std::condition_variable_any m_submission_cv;
     std::chrono::time_point<std::chrono::steady_clock> m_submission_time{};
+    bool m_engaged{true};
+
+    // Load of the current window of frames, only used by the thread presenting them
+    std::chrono::time_point<std::chrono::steady_clock> m_window_start{};
+    u64 m_last_gpu_time{};
+    u64 m_window_gpu_ns{};
+    u32 m_window_frames{};
+    u32 m_windows_since_change{};
+#ifdef ANDROID
+    std::unique_ptr<PerformanceHintSession> m_hint_session;
+#endif
 
     std::jthread m_thread;
 };
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -47,6 +48,11 @@ public:
         return upload_start;
     }
 
+    /// Returns the entries written since the last Acquire.
+    std::span<const DescriptorUpdateEntry> UpdateEntries() const noexcept {
+        return {upload_start, payload_cursor};
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
         *(payload_cursor++) = VkDescriptorImageInfo{
             .sampler = sampler,
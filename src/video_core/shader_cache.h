@@ -79,6 +79,7 @@ protected:
     };
 
     explicit ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory);
+    ~ShaderCache();
 
     /// @brief Update the hashes and information of shader stages
     /// @param unique_hashes Shader hashes to store into when a stage is enabled
@@ -4,18 +4,27 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <istream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "common/assert.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/fast_hash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
+#include "common/zstd_compression.h"
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/memory_manager.h"
@@ -26,9 +35,102 @@
 namespace VideoCommon {
 
 constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr std::array<char, 8> USAGE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'u', 's', 'g', 'e'};
+constexpr u32 USAGE_FORMAT_VERSION = 2;
+
+struct PipelineUsageEntry {
+    u64 hash;
+    u32 use_count;
+    u32 compile_time_us;
+    u64 first_use_frame;
+};
+static_assert(sizeof(PipelineUsageEntry) == 0x18);
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
+using Common::Compression::ZSTDCompressBuffer;
+using Common::Compression::ZSTDDecompressBuffer;
+using Common::Compression::ZSTDDictionary;
+
+/// Compression level of pipeline cache entries, cheap enough to append entries mid-session
+constexpr s32 CACHE_COMPRESSION_LEVEL = 3;
+/// Entries needed before a cache trains its compression dictionary
+constexpr size_t MIN_DICTIONARY_ENTRIES = 64;
+constexpr size_t MAX_DICTIONARY_SIZE = 64 * 1024;
+constexpr size_t MAX_DICTIONARY_SAMPLES_SIZE = 4 * 1024 * 1024;
+/// Dictionary size of caches whose entries failed to train a dictionary, they are not trained again
+constexpr u32 UNTRAINABLE_DICTIONARY_SIZE = 0xFFFFFFFF;
+
+namespace {
+/// Dictionaries of the pipeline cache files, so appending entries does not read them again
+struct DictionaryCache {
+    std::mutex mutex;
+    std::map<std::filesystem::path, std::shared_ptr<const ZSTDDictionary>> dictionaries;
+};
+
+DictionaryCache& GetDictionaryCache() {
+    static DictionaryCache cache;
+    return cache;
+}
+
+void SetCachedDictionary(const std::filesystem::path& filename,
+                         std::shared_ptr<const ZSTDDictionary> dictionary) {
+    DictionaryCache& cache{GetDictionaryCache()};
+    std::scoped_lock lock{cache.mutex};
+    cache.dictionaries.insert_or_assign(filename, std::move(dictionary));
+}
+
+void WriteHeader(std::ostream& file, u32 cache_version, const ZSTDDictionary* dictionary,
+                 bool is_untrainable = false) {
+    const std::span<const u8> dictionary_data{dictionary ? dictionary->Data()
+                                                         : std::span<const u8>{}};
+    const u32 dictionary_size{is_untrainable ? UNTRAINABLE_DICTIONARY_SIZE
+                                             : static_cast<u32>(dictionary_data.size())};
+    file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version))
+        .write(reinterpret_cast<const char*>(&dictionary_size), sizeof(dictionary_size))
+        .write(reinterpret_cast<const char*>(dictionary_data.data()),
+               static_cast<std::streamsize>(dictionary_data.size()));
+}
+
+/// Reads the dictionary following the magic number and the version, null when there is none
+std::shared_ptr<const ZSTDDictionary> ReadDictionary(std::istream& file,
+                                                     bool* is_untrainable = nullptr) {
+    u32 dictionary_size{};
+    file.read(reinterpret_cast<char*>(&dictionary_size), sizeof(dictionary_size));
+    if (is_untrainable) {
+        *is_untrainable = dictionary_size == UNTRAINABLE_DICTIONARY_SIZE;
+    }
+    if (dictionary_size == 0 || dictionary_size == UNTRAINABLE_DICTIONARY_SIZE) {
+        return nullptr;
+    }
+    if (dictionary_size > MAX_DICTIONARY_SIZE) {
+        throw std::ios_base::failure("Invalid pipeline cache dictionary");
+    }
+    std::vector<u8> data(dictionary_size);
+    file.read(reinterpret_cast<char*>(data.data()), dictionary_size);
+    return std::make_shared<const ZSTDDictionary>(std::move(data), CACHE_COMPRESSION_LEVEL);
+}
+
+/// Returns the dictionary of an existing cache file, read from its header when it is not cached
+std::shared_ptr<const ZSTDDictionary> FindDictionary(const std::filesystem::path& filename) {
+    DictionaryCache& cache{GetDictionaryCache()};
+    std::scoped_lock lock{cache.mutex};
+    if (const auto it{cache.dictionaries.find(filename)}; it != cache.dictionaries.end()) {
+        return it->second;
+    }
+    std::ifstream file(filename, std::ios::binary);
+    file.exceptions(std::ifstream::failbit);
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    auto dictionary{ReadDictionary(file)};
+    cache.dictionaries.emplace(filename, dictionary);
+    return dictionary;
+}
+} // Anonymous namespace
+
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 static u64 MakeCbufKey(u32 index, u32 offset) {
@@ -156,7 +258,7 @@ std::optional<u64> GenericEnvironment::Analyze() {
     }
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(*size);
-    return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
+    return Common::FastHash64(code.data(), *size);
 }
 
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
@@ -186,14 +288,14 @@ u64 GenericEnvironment::CalculateHash() const {
     const size_t size{ReadSizeBytes()};
     const auto data{std::make_unique<char[]>(size)};
     gpu_memory->ReadBlock(program_base + read_lowest, data.get(), size);
-    return Common::CityHash64(data.get(), size);
+    return Common::FastHash64(data.get(), size);
 }
 
 void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::ostream& file) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
@@ -448,7 +550,7 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+void FileEnvironment::Deserialize(std::istream& file) {
     u64 code_size{};
     u64 num_texture_types{};
     u64 num_texture_pixel_formats{};
@@ -591,40 +693,47 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
                   Common::FS::PathToUTF8String(filename));
         return;
     }
+    std::shared_ptr<const ZSTDDictionary> dictionary;
     if (file.tellp() == 0) {
-        // Write header
-        file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
-            .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+        // New caches start without a dictionary, compaction trains one once there are entries
+        WriteHeader(file, cache_version, nullptr);
+        SetCachedDictionary(filename, nullptr);
+    } else {
+        dictionary = FindDictionary(filename);
     }
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
+    // Each entry is its own frame, so appending never touches the previous ones
+    ZSTDCompressBuffer compress_buffer(file, CACHE_COMPRESSION_LEVEL, dictionary.get());
+    std::ostream stream(&compress_buffer);
+    stream.exceptions(std::ios::failbit | std::ios::badbit);
     const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    stream.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
+        env->Serialize(stream);
     }
-    file.write(key.data(), key.size_bytes());
+    stream.write(key.data(), key.size_bytes());
+    compress_buffer.EndFrame();
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
+    SetCachedDictionary(filename, nullptr);
     if (!Common::FS::RemoveFile(filename)) {
         LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
                   Common::FS::PathToUTF8String(filename));
     }
 }
 
-void LoadPipelines(
+bool LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    Common::UniqueFunction<void, std::istream&, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::istream&, std::vector<FileEnvironment>> load_graphics) try {
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
-        return;
+        return false;
     }
     file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
 
     std::array<char, 8> magic_number;
     u32 cache_version;
@@ -644,31 +753,264 @@ void LoadPipelines(
                       "Invalid pipeline cache file and failed to delete it in \"{}\"",
                       Common::FS::PathToUTF8String(filename));
         }
-        return;
+        return false;
     }
-    while (file.tellg() != end) {
+    bool is_untrainable{};
+    const std::shared_ptr<const ZSTDDictionary> dictionary{ReadDictionary(file, &is_untrainable)};
+    SetCachedDictionary(filename, dictionary);
+
+    ZSTDDecompressBuffer decompress_buffer(file, dictionary.get());
+    std::istream stream(&decompress_buffer);
+    stream.exceptions(std::ios::failbit | std::ios::badbit);
+    size_t num_entries{};
+    while (stream.peek() != std::istream::traits_type::eof()) {
         if (stop_loading.stop_requested()) {
-            return;
+            return false;
         }
         u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+        stream.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
         std::vector<FileEnvironment> envs(num_envs);
         for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
+            env.Deserialize(stream);
         }
         if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
+            load_compute(stream, std::move(envs.front()));
         } else {
-            load_graphics(file, std::move(envs));
+            load_graphics(stream, std::move(envs));
         }
+        ++num_entries;
     }
+    return !dictionary && !is_untrainable && num_entries >= MIN_DICTIONARY_ENTRIES;
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
+    SetCachedDictionary(filename, nullptr);
     if (!Common::FS::RemoveFile(filename)) {
         LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
                   Common::FS::PathToUTF8String(filename));
     }
+    return false;
+}
+
+void CompactPipelineCache(const std::filesystem::path& filename, u32 expected_cache_version,
+                          size_t compute_key_size, size_t graphics_key_size,
+                          Common::UniqueFunction<bool, bool, std::span<const char>> is_live) try {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
+        // Outdated caches are deleted by LoadPipelines
+        return;
+    }
+    bool is_untrainable{};
+    std::shared_ptr<const ZSTDDictionary> dictionary{ReadDictionary(file, &is_untrainable)};
+    const std::streamoff entries_begin{file.tellg()};
+
+    // Entry ranges are offsets in the decompressed stream of entries
+    struct EntryRange {
+        std::streamoff begin;
+        std::streamoff end;
+    };
+    std::vector<EntryRange> entries;
+    std::unordered_map<std::string, size_t> key_entries;
+    size_t num_total{};
+    size_t num_live{};
+    {
+        ZSTDDecompressBuffer decompress_buffer(file, dictionary.get());
+        std::istream stream(&decompress_buffer);
+        stream.exceptions(std::ios::failbit | std::ios::badbit);
+        while (stream.peek() != std::istream::traits_type::eof()) {
+            const std::streamoff entry_begin{stream.tellg()};
+            u32 num_envs{};
+            stream.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+            bool is_compute{};
+            for (u32 index = 0; index < num_envs; ++index) {
+                FileEnvironment env;
+                env.Deserialize(stream);
+                if (index == 0) {
+                    is_compute = env.ShaderStage() == Shader::Stage::Compute;
+                }
+            }
+            std::string key(is_compute ? compute_key_size : graphics_key_size, '\0');
+            stream.read(key.data(), static_cast<std::streamsize>(key.size()));
+            ++num_total;
+            if (num_envs == 0 || !is_live(bool{is_compute}, std::span<const char>(key))) {
+                continue;
+            }
+            const size_t entry_index{entries.size()};
+            entries.push_back(EntryRange{
+                .begin = entry_begin,
+                .end = stream.tellg(),
+            });
+            const auto [it, is_new]{key_entries.try_emplace(std::move(key), entry_index)};
+            if (is_new) {
+                ++num_live;
+            } else {
+                // Later entries of the same key replace the earlier ones
+                entries[it->second] = EntryRange{};
+                it->second = entry_index;
+            }
+        }
+    }
+    const bool train_dictionary{!dictionary && !is_untrainable &&
+                                num_live >= MIN_DICTIONARY_ENTRIES};
+    if (num_live == num_total && !train_dictionary) {
+        return;
+    }
+    // Streams the live entries again, the decompressed stream can only be read forwards
+    const auto for_each_live_entry{[&](auto&& func) {
+        file.clear();
+        file.seekg(entries_begin, std::ios::beg);
+        ZSTDDecompressBuffer decompress_buffer(file, dictionary.get());
+        std::istream stream(&decompress_buffer);
+        stream.exceptions(std::ios::failbit | std::ios::badbit);
+        std::streamoff position{};
+        std::vector<char> buffer;
+        for (const EntryRange& entry : entries) {
+            if (entry.begin == entry.end) {
+                continue;
+            }
+            stream.ignore(entry.begin - position);
+            buffer.resize(static_cast<size_t>(entry.end - entry.begin));
+            stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            position = entry.end;
+            if (!func(std::span<const char>(buffer))) {
+                return;
+            }
+        }
+    }};
+    if (train_dictionary) {
+        std::vector<u8> samples;
+        std::vector<size_t> sample_sizes;
+        for_each_live_entry([&](std::span<const char> entry) {
+            if (samples.size() + entry.size() > MAX_DICTIONARY_SAMPLES_SIZE) {
+                return false;
+            }
+            samples.insert(samples.end(), entry.begin(), entry.end());
+            sample_sizes.push_back(entry.size());
+            return true;
+        });
+        std::vector<u8> dictionary_data{
+            Common::Compression::TrainDictionaryZSTD(samples, sample_sizes, MAX_DICTIONARY_SIZE)};
+        if (!dictionary_data.empty()) {
+            dictionary = std::make_shared<const ZSTDDictionary>(std::move(dictionary_data),
+                                                                CACHE_COMPRESSION_LEVEL);
+        } else {
+            // Marks the cache so later boots do not compact it to train it again
+            LOG_WARNING(Common_Filesystem, "Failed to train a pipeline cache dictionary");
+            is_untrainable = true;
+        }
+    }
+    auto compact_filename{filename};
+    compact_filename += ".compact";
+    {
+        std::ofstream compact_file(compact_filename, std::ios::binary | std::ios::trunc);
+        compact_file.exceptions(std::ifstream::failbit);
+        WriteHeader(compact_file, cache_version, dictionary.get(), is_untrainable);
+        ZSTDCompressBuffer compress_buffer(compact_file, CACHE_COMPRESSION_LEVEL,
+                                           dictionary.get());
+        std::ostream stream(&compress_buffer);
+        stream.exceptions(std::ios::failbit | std::ios::badbit);
+        for_each_live_entry([&](std::span<const char> entry) {
+            stream.write(entry.data(), static_cast<std::streamsize>(entry.size()));
+            compress_buffer.EndFrame();
+            return true;
+        });
+    }
+    file.close();
+    // Renaming over the original replaces it atomically, a crash leaves either of the two files
+    std::error_code ec;
+    std::filesystem::rename(compact_filename, filename, ec);
+    if (ec) {
+        LOG_ERROR(Common_Filesystem, "Failed to replace pipeline cache file {}, ec_message={}",
+                  Common::FS::PathToUTF8String(filename), ec.message());
+        Common::FS::RemoveFile(compact_filename);
+        return;
+    }
+    SetCachedDictionary(filename, dictionary);
+    LOG_INFO(Common_Filesystem, "Compacted pipeline cache from {} to {} entries{}", num_total,
+             num_live, train_dictionary && dictionary ? ", trained a compression dictionary" : "");
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+}
+
+void SerializePipelineUsage(const std::filesystem::path& filename, u32 cache_version,
+                            const PipelineUsageMap& usage) try {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.exceptions(std::ifstream::failbit);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open pipeline usage file {}",
+                  Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    const u32 num_entries{static_cast<u32>(usage.size())};
+    file.write(USAGE_MAGIC_NUMBER.data(), USAGE_MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&USAGE_FORMAT_VERSION), sizeof(USAGE_FORMAT_VERSION))
+        .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version))
+        .write(reinterpret_cast<const char*>(&num_entries), sizeof(num_entries));
+    for (const auto& [hash, entry] : usage) {
+        const PipelineUsageEntry usage_entry{
+            .hash = hash,
+            .use_count = entry.use_count,
+            .compile_time_us = entry.compile_time_us,
+            .first_use_frame = entry.first_use_frame,
+        };
+        file.write(reinterpret_cast<const char*>(&usage_entry), sizeof(usage_entry));
+    }
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    if (!Common::FS::RemoveFile(filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline usage file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
+PipelineUsageMap LoadPipelineUsage(const std::filesystem::path& filename,
+                                   u32 expected_cache_version) try {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return {};
+    }
+    file.exceptions(std::ifstream::failbit);
+
+    std::array<char, 8> magic_number;
+    u32 format_version;
+    u32 cache_version;
+    u32 num_entries;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&format_version), sizeof(format_version))
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version))
+        .read(reinterpret_cast<char*>(&num_entries), sizeof(num_entries));
+    if (magic_number != USAGE_MAGIC_NUMBER || format_version != USAGE_FORMAT_VERSION ||
+        cache_version != expected_cache_version) {
+        LOG_INFO(Common_Filesystem, "Discarding old pipeline usage file");
+        return {};
+    }
+    std::vector<PipelineUsageEntry> entries(num_entries);
+    file.read(reinterpret_cast<char*>(entries.data()),
+              static_cast<std::streamsize>(entries.size() * sizeof(PipelineUsageEntry)));
+
+    PipelineUsageMap usage;
+    usage.reserve(entries.size());
+    for (const PipelineUsageEntry& entry : entries) {
+        usage.emplace(entry.hash, PipelineUsage{.use_count = entry.use_count,
+                                                .compile_time_us = entry.compile_time_us,
+                                                .first_use_frame = entry.first_use_frame});
+    }
+    return usage;
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    return {};
 }
 
 } // namespace VideoCommon
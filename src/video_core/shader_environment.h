@@ -60,7 +60,7 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    void Serialize(std::ostream& file) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -165,7 +165,7 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    void Deserialize(std::istream& file);
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
@@ -224,9 +224,48 @@ void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::
                       std::span(envs.data(), envs.size()), filename, cache_version);
 }
 
-void LoadPipelines(
+/**
+ * Reads the entries of a pipeline cache file, deleting it when it is outdated or corrupted.
+ * Entries are stored as Zstandard frames sharing the dictionary in the header of the file.
+ *
+ * @param load_compute  Receives the environment of a compute entry, reads its key from the stream
+ * @param load_graphics Receives the environments of a graphics entry, reads its key from the stream
+ *
+ * @return true when the cache has grown enough to compact it with a trained dictionary
+ */
+[[nodiscard]] bool LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
+    Common::UniqueFunction<void, std::istream&, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::istream&, std::vector<FileEnvironment>> load_graphics);
+
+/**
+ * Rewrites a pipeline cache file without dead entries.
+ * Entries rejected by is_live and all but the last entry of each key are dropped. Caches without
+ * a compression dictionary train one from their entries once they have enough of them, caches
+ * whose entries fail to train one are not trained again.
+ * Must not run concurrently with SerializePipeline on the same file.
+ *
+ * @param is_live Returns false for entries that should be removed, receives whether the entry is
+ *                a compute pipeline and the raw bytes of its key
+ */
+void CompactPipelineCache(const std::filesystem::path& filename, u32 expected_cache_version,
+                          size_t compute_key_size, size_t graphics_key_size,
+                          Common::UniqueFunction<bool, bool, std::span<const char>> is_live);
+
+/// Usage of a pipeline during previous sessions, used to order and prune the disk cache
+struct PipelineUsage {
+    u32 use_count{};
+    u32 compile_time_us{};
+    u64 first_use_frame{};
+};
+
+/// Pipeline usage keyed by the hash of the pipeline cache key
+using PipelineUsageMap = std::unordered_map<u64, PipelineUsage>;
+
+void SerializePipelineUsage(const std::filesystem::path& filename, u32 cache_version,
+                            const PipelineUsageMap& usage);
+
+[[nodiscard]] PipelineUsageMap LoadPipelineUsage(const std::filesystem::path& filename,
+                                                 u32 expected_cache_version);
 
 } // namespace VideoCommon
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "video_core/texture_cache/dynamic_resolution.h"
+
+namespace VideoCommon {
+namespace {
+/// Number of frames GPU times are averaged over
+constexpr u32 WINDOW_FRAMES = 30;
+/// Minimum number of frames between two changes
+constexpr u32 MIN_HOLD_FRAMES = 120;
+/// Fraction of the target GPU time the configured scale has to fit in to go back to it
+constexpr f64 SCALE_UP_HEADROOM = 0.8;
+} // Anonymous namespace
+
+DynamicResolution::DynamicResolution() {
+    const auto& resolution = Settings::values.resolution_info;
+    enabled = Settings::values.dynamic_resolution.GetValue() && resolution.active &&
+              !resolution.downscale;
+    target_ns = 1'000'000'000.0 / Settings::values.dynamic_resolution_fps.GetValue();
+    // Until it is measured, assume the GPU time grows with the number of pixels
+    max_scale_cost = static_cast<f64>(resolution.up_factor) * resolution.up_factor;
+    scale_cost = max_scale_cost;
+}
+
+void DynamicResolution::AddFrame(u64 gpu_ns) {
+    if (!enabled) {
+        return;
+    }
+    window_ns += gpu_ns;
+    ++window_frames;
+    ++frames_since_change;
+    if (window_frames < WINDOW_FRAMES) {
+        return;
+    }
+    const f64 average_ns = static_cast<f64>(window_ns) / window_frames;
+    window_ns = 0;
+    window_frames = 0;
+    if (skip_window) {
+        skip_window = false;
+        return;
+    }
+    if (native) {
+        if (measure_cost && average_ns > 0.0) {
+            measure_cost = false;
+            scale_cost = std::clamp(scaled_average_ns / average_ns, 1.0, max_scale_cost);
+        }
+        if (frames_since_change < MIN_HOLD_FRAMES ||
+            average_ns * scale_cost > target_ns * SCALE_UP_HEADROOM) {
+            return;
+        }
+    } else {
+        if (frames_since_change < MIN_HOLD_FRAMES || average_ns <= target_ns) {
+            return;
+        }
+        scaled_average_ns = average_ns;
+        measure_cost = true;
+    }
+    native = !native;
+    frames_since_change = 0;
+    skip_window = true;
+    LOG_DEBUG(HW_GPU, "GPU frame time {:.2f} ms, rendering at {} resolution", average_ns / 1e6,
+              native ? "native" : "the configured");
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Decides when render targets are kept at native resolution instead of the configured resolution
+ * scale, so the GPU time of a frame stays within what the target frame rate allows.
+ *
+ * GPU times are averaged over windows of frames. Every change waits for a minimum number of
+ * frames since the previous one, and going back to the configured scale waits until the GPU time
+ * it is estimated to take leaves some headroom, so the resolution does not oscillate.
+ */
+class DynamicResolution {
+public:
+    explicit DynamicResolution();
+
+    /// Adds the GPU time of a frame in nanoseconds
+    void AddFrame(u64 gpu_ns);
+
+    /// Returns true when the resolution is being adjusted
+    [[nodiscard]] bool IsEnabled() const noexcept {
+        return enabled;
+    }
+
+    /// Returns true when render targets have to be kept at native resolution
+    [[nodiscard]] bool IsNative() const noexcept {
+        return native;
+    }
+
+private:
+    bool enabled{};
+    bool native{};
+    /// GPU time a frame can take at the target frame rate
+    f64 target_ns{};
+    /// Highest ratio between the GPU time at the configured scale and at native resolution
+    f64 max_scale_cost{};
+    /// Estimated ratio between the GPU time at the configured scale and at native resolution
+    f64 scale_cost{};
+    /// Average GPU time of the last window before dropping to native resolution
+    f64 scaled_average_ns{};
+    u64 window_ns{};
+    u32 window_frames{};
+    u32 frames_since_change{};
+    /// The current window has frames rendered before the last change
+    bool skip_window{};
+    /// The scale cost has to be measured on the next window at native resolution
+    bool measure_cost{};
+};
+
+} // namespace VideoCommon
@@ -255,6 +255,26 @@ struct fmt::formatter<VideoCommon::ImageType> : fmt::formatter<fmt::string_view>
     }
 };
 
+template <>
+struct fmt::formatter<VideoCommon::ReinterpretPath> : fmt::formatter<fmt::string_view> {
+    template <typename FormatContext>
+    auto format(VideoCommon::ReinterpretPath path, FormatContext& ctx) {
+        const string_view name = [path] {
+            using VideoCommon::ReinterpretPath;
+            switch (path) {
+            case ReinterpretPath::Copy:
+                return "copy";
+            case ReinterpretPath::Reinterpret:
+                return "reinterpret";
+            case ReinterpretPath::Convert:
+                return "convert";
+            }
+            return "invalid";
+        }();
+        return formatter<string_view>::format(name, ctx);
+    }
+};
+
 template <>
 struct fmt::formatter<VideoCommon::Extent3D> {
     constexpr auto parse(fmt::format_parse_context& ctx) {
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "video_core/texture_cache/readback_predictor.h"
+
+namespace VideoCommon {
+namespace {
+/// Number of frames a region is remembered for after its last read back
+constexpr u64 FORGET_FRAMES = 1800;
+/// Number of regions remembered at most, the oldest ones are forgotten first
+constexpr size_t MAX_REGIONS = 256;
+} // Anonymous namespace
+
+void ReadbackPredictor::RecordReadback(GPUVAddr gpu_addr, size_t size, u64 frame) {
+    if (regions.size() >= MAX_REGIONS && !regions.contains(gpu_addr)) {
+        auto oldest = regions.begin();
+        for (auto it = regions.begin(); it != regions.end(); ++it) {
+            if (it->second.last_frame < oldest->second.last_frame) {
+                oldest = it;
+            }
+        }
+        regions.erase(oldest);
+    }
+    regions.insert_or_assign(gpu_addr, Region{.size = size, .last_frame = frame});
+}
+
+bool ReadbackPredictor::IsPredicted(GPUVAddr gpu_addr, size_t size) const {
+    const auto it = regions.find(gpu_addr);
+    return it != regions.end() && it->second.size == size;
+}
+
+void ReadbackPredictor::Tick(u64 frame) {
+    std::erase_if(regions, [frame](const auto& pair) {
+        return pair.second.last_frame + FORGET_FRAMES < frame;
+    });
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Learns which GPU written regions the CPU reads back with reactive flushing, so images created
+ * again at them are downloaded asynchronously after being rendered to instead of stalling the
+ * CPU access that faults on them.
+ *
+ * Regions are keyed by GPU address and guest size. A region is forgotten when it has not been
+ * read back for a while, so targets that are no longer read back stop being downloaded.
+ */
+class ReadbackPredictor {
+public:
+    /// Records a CPU read of a region written by the GPU
+    void RecordReadback(GPUVAddr gpu_addr, size_t size, u64 frame);
+
+    /// Returns true when images created at the region are expected to be read back
+    [[nodiscard]] bool IsPredicted(GPUVAddr gpu_addr, size_t size) const;
+
+    /// Forgets the regions that have not been read back recently
+    void Tick(u64 frame);
+
+private:
+    struct Region {
+        size_t size;
+        u64 last_frame;
+    };
+
+    std::unordered_map<GPUVAddr, Region> regions;
+};
+
+} // namespace VideoCommon
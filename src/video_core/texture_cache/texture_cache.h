@@ -13,6 +13,7 @@
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/texture_cache/formatter.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/texture_cache/samples_helper.h"
 #include "video_core/texture_cache/texture_cache_base.h"
@@ -50,19 +51,8 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     void(slot_samplers.insert(runtime, sampler_descriptor));
 
     if constexpr (HAS_DEVICE_MEMORY_INFO) {
-        const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
-        const s64 min_spacing_expected = device_local_memory - 1_GiB;
-        const s64 min_spacing_critical = device_local_memory - 512_MiB;
-        const s64 mem_threshold = std::min(device_local_memory, TARGET_THRESHOLD);
-        const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
-        const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-        expected_memory = static_cast<u64>(
-            std::max(std::min(device_local_memory - min_vacancy_expected, min_spacing_expected),
-                     DEFAULT_EXPECTED_MEMORY));
-        critical_memory = static_cast<u64>(
-            std::max(std::min(device_local_memory - min_vacancy_critical, min_spacing_critical),
-                     DEFAULT_CRITICAL_MEMORY));
-        minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        device_local_memory = runtime.GetDeviceLocalMemory();
+        ConfigureMemoryThresholds(device_local_memory);
     } else {
         expected_memory = DEFAULT_EXPECTED_MEMORY + 512_MiB;
         critical_memory = DEFAULT_CRITICAL_MEMORY + 1_GiB;
@@ -70,6 +60,21 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     }
 }
 
+template <class P>
+void TextureCache<P>::ConfigureMemoryThresholds(u64 available_memory) {
+    const s64 memory = static_cast<s64>(available_memory);
+    const s64 min_spacing_expected = memory - 1_GiB;
+    const s64 min_spacing_critical = memory - 512_MiB;
+    const s64 mem_threshold = std::min(memory, TARGET_THRESHOLD);
+    const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
+    const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
+    expected_memory = static_cast<u64>(std::max(
+        std::min(memory - min_vacancy_expected, min_spacing_expected), DEFAULT_EXPECTED_MEMORY));
+    critical_memory = static_cast<u64>(std::max(
+        std::min(memory - min_vacancy_critical, min_spacing_critical), DEFAULT_CRITICAL_MEMORY));
+    minimum_memory = static_cast<u64>((memory - mem_threshold) / 2);
+}
+
 template <class P>
 void TextureCache<P>::RunGarbageCollector() {
     bool high_priority_mode = false;
@@ -84,7 +89,7 @@ void TextureCache<P>::RunGarbageCollector() {
         num_iterations = aggressive_mode ? 40 : (high_priority_mode ? 20 : 10);
     };
     const auto Cleanup = [this, &num_iterations, &high_priority_mode,
-                          &aggressive_mode](ImageId image_id) {
+                          &aggressive_mode](ImageId image_id, EvictionTier tier) {
         if (num_iterations == 0) {
             return true;
         }
@@ -95,12 +100,13 @@ void TextureCache<P>::RunGarbageCollector() {
             // used by the async decoder thread.
             return false;
         }
-        if (!aggressive_mode && True(image.flags & ImageFlagBits::CostlyLoad)) {
-            return false;
-        }
         const bool must_download =
             image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
-        if (!high_priority_mode && must_download) {
+        const EvictionTier image_tier = must_download ? EvictionTier::Modified
+                                        : True(image.flags & ImageFlagBits::CostlyLoad)
+                                            ? EvictionTier::Costly
+                                            : EvictionTier::Clean;
+        if (image_tier != tier) {
             return false;
         }
         if (must_download) {
@@ -131,14 +137,26 @@ void TextureCache<P>::RunGarbageCollector() {
         return false;
     };
 
-    // Try to remove anything old enough and not high priority.
-    Configure(false);
-    lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
+    // Evict the images that are cheapest to bring back first. Images that are costly to load
+    // or have to be downloaded are only touched when memory pressure is high.
+    const auto RunTiers = [&](bool allow_aggressive) {
+        for (const EvictionTier tier :
+             {EvictionTier::Clean, EvictionTier::Costly, EvictionTier::Modified}) {
+            Configure(allow_aggressive);
+            if (tier != EvictionTier::Clean && !high_priority_mode) {
+                return;
+            }
+            lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy,
+                                       [&](ImageId image_id) { return Cleanup(image_id, tier); });
+        }
+    };
+
+    // Try to remove anything old enough.
+    RunTiers(false);
 
     // If pressure is still too high, prune aggressively.
     if (total_used_memory >= critical_memory) {
-        Configure(true);
-        lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
+        RunTiers(true);
     }
 }
 
@@ -147,6 +165,14 @@ void TextureCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        if constexpr (HAS_DEVICE_MEMORY_INFO) {
+            // The budget shrinks when other processes claim device memory, follow it down
+            const u64 budget = std::min(device_local_memory, runtime.GetDeviceMemoryBudget());
+            if (budget != memory_budget) {
+                memory_budget = budget;
+                ConfigureMemoryThresholds(budget);
+            }
+        }
     }
     if (total_used_memory > minimum_memory) {
         RunGarbageCollector();
@@ -156,6 +182,22 @@ void TextureCache<P>::TickFrame() {
     sentenced_image_view.Tick();
     TickAsyncDecode();
 
+    for (const auto& [key, count] : frame_reinterpretations) {
+        const auto [src_format, dst_format, path] = key;
+        LOG_DEBUG(HW_GPU, "Reinterpreted {} as {} {} times ({})", src_format, dst_format, count,
+                  path);
+    }
+    last_frame_reinterpretations = std::exchange(frame_reinterpretations, ReinterpretStats{});
+
+    if constexpr (HAS_GPU_TIME) {
+        if (dynamic_resolution.IsEnabled()) {
+            const u64 gpu_time = runtime.GetGpuTime();
+            dynamic_resolution.AddFrame(gpu_time - last_gpu_time);
+            last_gpu_time = gpu_time;
+        }
+    }
+
+    readback_predictor.Tick(frame_tick);
     runtime.TickFrame();
     ++frame_tick;
 
@@ -204,7 +246,7 @@ void TextureCache<P>::FillComputeImageViews(std::span<ImageViewInOut> views) {
 
 template <class P>
 void TextureCache<P>::CheckFeedbackLoop(std::span<const ImageViewInOut> views) {
-    if (!Settings::values.barrier_feedback_loops.GetValue()) {
+    if (!Settings::GetHotValues().barrier_feedback_loops) {
         return;
     }
 
@@ -421,6 +463,10 @@ template <class P>
 void TextureCache<P>::UpdateRenderTargets(bool is_clear) {
     using namespace VideoCommon::Dirty;
     auto& flags = maxwell3d->dirty.flags;
+    if (is_rescaling && dynamic_resolution.IsNative()) {
+        // Dynamic resolution dropped to native, scale down the bound render targets
+        flags[Dirty::RenderTargets] = true;
+    }
     if (!flags[Dirty::RenderTargets]) {
         for (size_t index = 0; index < NUM_RT; ++index) {
             ImageViewId& color_buffer_id = render_targets.color_buffer_ids[index];
@@ -452,8 +498,9 @@ void TextureCache<P>::UpdateRenderTargets(bool is_clear) {
     u32 up_scale = 1;
     u32 down_shift = 0;
     if (is_rescaling) {
-        up_scale = Settings::values.resolution_info.up_scale;
-        down_shift = Settings::values.resolution_info.down_shift;
+        const auto& resolution = Settings::GetHotValues().resolution_info;
+        up_scale = resolution.up_scale;
+        down_shift = resolution.down_shift;
     }
     render_targets.size = Extent2D{
         (maxwell3d->regs.surface_clip.width * up_scale) >> down_shift,
@@ -558,14 +605,28 @@ void TextureCache<P>::DownloadMemory(DAddr cpu_addr, size_t size) {
     std::ranges::sort(images, [this](ImageId lhs, ImageId rhs) {
         return slot_images[lhs].modification_tick < slot_images[rhs].modification_tick;
     });
+    // Record every download into a single staging buffer and wait for the GPU once, instead of
+    // stalling on each image
+    size_t total_size_bytes = 0;
+    for (const ImageId image_id : images) {
+        total_size_bytes += Common::AlignUp(slot_images[image_id].unswizzled_size_bytes, 64);
+    }
+    auto map = runtime.DownloadStagingBuffer(total_size_bytes);
     for (const ImageId image_id : images) {
         Image& image = slot_images[image_id];
-        auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
         const auto copies = FullDownloadCopies(image.info);
         image.DownloadMemory(map, copies);
-        runtime.Finish();
-        SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
+        map.offset += Common::AlignUp(image.unswizzled_size_bytes, 64);
+    }
+    runtime.Finish();
+    std::span<u8> download_span = map.mapped_span;
+    for (const ImageId image_id : images) {
+        const ImageBase& image = slot_images[image_id];
+        const auto copies = FullDownloadCopies(image.info);
+        SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, download_span,
                      swizzle_data_buffer);
+        const size_t aligned_size = Common::AlignUp(image.unswizzled_size_bytes, 64);
+        download_span = download_span.subspan(std::min(aligned_size, download_span.size()));
     }
 }
 
@@ -591,6 +652,7 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
         }
         area->preemtive &= image.info.forced_flushed;
         image.info.forced_flushed = true;
+        readback_predictor.RecordReadback(image.gpu_addr, image.guest_size_bytes, frame_tick);
     });
     return area;
 }
@@ -675,7 +737,7 @@ bool TextureCache<P>::BlitImage(const Tegra::Engines::Fermi2D::Surface& dst,
         is_src_rescaled = True(src_image.flags & ImageFlagBits::Rescaled);
         is_dst_rescaled = True(dst_image.flags & ImageFlagBits::Rescaled);
     }
-    const auto& resolution = Settings::values.resolution_info;
+    const auto& resolution = Settings::GetHotValues().resolution_info;
     const auto scale_region = [&](Region2D& region) {
         region.start.x = resolution.ScaleUp(region.start.x);
         region.start.y = resolution.ScaleUp(region.start.y);
@@ -732,22 +794,20 @@ template <class P>
 std::pair<typename P::ImageView*, bool> TextureCache<P>::TryFindFramebufferImageView(
     const Tegra::FramebufferConfig& config, DAddr cpu_addr) {
     // TODO: Properly implement this
-    const auto it = page_table.find(cpu_addr >> YUZU_PAGEBITS);
-    if (it == page_table.end()) {
-        return {};
-    }
-    const auto& image_map_ids = it->second;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
-    for (const ImageMapId map_id : image_map_ids) {
+    page_table.ForEachOverlapping(cpu_addr, cpu_addr + 1, [&](DAddr, DAddr, ImageMapId map_id) {
         const ImageMapView& map = slot_map_views[map_id];
         const ImageBase& image = slot_images[map.image_id];
         if (image.cpu_addr != cpu_addr) {
-            continue;
+            return;
         }
         if (image.image_view_ids.empty()) {
-            continue;
+            return;
         }
         valid_image_ids.push_back(map.image_id);
+    });
+    if (valid_image_ids.empty()) {
+        return {};
     }
 
     const auto view_format = [&]() {
@@ -1090,7 +1150,7 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
         auto copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer);
-        ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        transcode_cache.ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
         image.UploadMemory(staging, copies);
     } else {
         const auto copies =
@@ -1200,10 +1260,10 @@ ImageId TextureCache<P>::FindImage(const ImageInfo& info, GPUVAddr gpu_addr,
 
 template <class P>
 bool TextureCache<P>::ImageCanRescale(ImageBase& image) {
-    if (!image.info.rescaleable) {
+    if (!image.info.rescaleable || dynamic_resolution.IsNative()) {
         return false;
     }
-    if (Settings::values.resolution_info.downscale && !image.info.downscaleable) {
+    if (Settings::GetHotValues().resolution_info.downscale && !image.info.downscaleable) {
         return false;
     }
     if (True(image.flags & (ImageFlagBits::Rescaled | ImageFlagBits::CheckingRescalable))) {
@@ -1265,10 +1325,9 @@ void TextureCache<P>::InvalidateScale(Image& image) {
 
 template <class P>
 u64 TextureCache<P>::GetScaledImageSizeBytes(const ImageBase& image) {
-    const u64 scale_up = static_cast<u64>(Settings::values.resolution_info.up_scale *
-                                          Settings::values.resolution_info.up_scale);
-    const u64 down_shift = static_cast<u64>(Settings::values.resolution_info.down_shift +
-                                            Settings::values.resolution_info.down_shift);
+    const auto& resolution = Settings::GetHotValues().resolution_info;
+    const u64 scale_up = static_cast<u64>(resolution.up_scale * resolution.up_scale);
+    const u64 down_shift = static_cast<u64>(resolution.down_shift + resolution.down_shift);
     const u64 image_size_bytes =
         static_cast<u64>(std::max(image.guest_size_bytes, image.unswizzled_size_bytes));
     const u64 tentative_size = (image_size_bytes * scale_up) >> down_shift;
@@ -1298,10 +1357,10 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
 
     auto func = [out_size, copies, info = image.info,
                  input = std::move(local_unswizzle_data_buffer),
-                 async_decode = decode_ptr]() mutable {
+                 async_decode = decode_ptr, transcode = &transcode_cache]() mutable {
         async_decode->decoded_data.resize_destructive(out_size);
         std::span copies_span{copies.data(), copies.size()};
-        ConvertImage(input, info, async_decode->decoded_data, copies_span);
+        transcode->ConvertImage(input, info, async_decode->decoded_data, copies_span);
 
         // TODO: Do we need this lock?
         std::unique_lock lock{async_decode->mutex};
@@ -1344,7 +1403,9 @@ bool TextureCache<P>::ScaleUp(Image& image) {
         return false;
     }
     if (!has_copy) {
-        total_used_memory += GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory += scaled_size;
+        memory_account.Add(scaled_size);
     }
     InvalidateScale(image);
     return true;
@@ -1482,6 +1543,10 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
         }
     }
 
+    if (readback_predictor.IsPredicted(gpu_addr, CalculateGuestSizeInBytes(new_info))) {
+        // The CPU read back images at this region before, download it after rendering to it
+        new_info.forced_flushed = true;
+    }
     const ImageId new_image_id = slot_images.insert(runtime, new_info, gpu_addr, cpu_addr);
     Image& new_image = slot_images[new_image_id];
 
@@ -1489,6 +1554,20 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
         new_info.is_sparse) {
         new_image.flags |= ImageFlagBits::Sparse;
     }
+    if constexpr (IMPLEMENTS_SPARSE_RESIDENCY) {
+        if (new_info.is_sparse) {
+            boost::container::small_vector<std::pair<u64, u64>, 32> resident_ranges;
+            if (True(new_image.flags & ImageFlagBits::Sparse)) {
+                ForEachSparseSegment(new_image, [&](GPUVAddr segment_addr, DAddr, size_t size) {
+                    const u64 offset = segment_addr - new_image.gpu_addr;
+                    resident_ranges.emplace_back(offset, offset + size);
+                });
+            } else {
+                resident_ranges.emplace_back(0, new_image.guest_size_bytes);
+            }
+            new_image.CommitSparseMemory(resident_ranges);
+        }
+    }
 
     for (const ImageId overlap_id : join_ignore_textures) {
         Image& overlap = slot_images[overlap_id];
@@ -1567,7 +1646,7 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
         }
         if (True(overlap.flags & ImageFlagBits::GpuModified)) {
             new_image.flags |= ImageFlagBits::GpuModified;
-            const auto& resolution = Settings::values.resolution_info;
+            const auto& resolution = Settings::GetHotValues().resolution_info;
             const SubresourceBase base = new_image.TryFindBase(overlap.gpu_addr).value();
             const u32 up_scale = can_rescale ? resolution.up_scale : 1;
             const u32 down_shift = can_rescale ? resolution.down_shift : 0;
@@ -1809,50 +1888,38 @@ template <typename Func>
 void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& func) {
     using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+    // Map views are resolved before any callback runs, callbacks may unregister their images
+    boost::container::small_vector<std::pair<DAddr, ImageId>, 32> maps;
+    page_table.ForEachOverlapping(cpu_addr, cpu_addr + size,
+                                  [this, &maps](DAddr map_addr, DAddr, ImageMapId map_id) {
+                                      maps.emplace_back(map_addr, slot_map_views[map_id].image_id);
+                                  });
+    std::ranges::sort(maps, {}, &std::pair<DAddr, ImageId>::first);
+
+    // Sparse images register one map per segment, visit them only once
     boost::container::small_vector<ImageId, 32> images;
-    boost::container::small_vector<ImageMapId, 32> maps;
-    ForEachCPUPage(cpu_addr, size, [this, &images, &maps, cpu_addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
-            if constexpr (BOOL_BREAK) {
-                return false;
-            } else {
-                return;
-            }
-        }
-        for (const ImageMapId map_id : it->second) {
-            ImageMapView& map = slot_map_views[map_id];
-            if (map.picked) {
-                continue;
-            }
-            if (!map.Overlaps(cpu_addr, size)) {
-                continue;
-            }
-            map.picked = true;
-            maps.push_back(map_id);
-            Image& image = slot_images[map.image_id];
-            if (True(image.flags & ImageFlagBits::Picked)) {
-                continue;
-            }
+    for (const auto& [map_addr, image_id] : maps) {
+        Image& image = slot_images[image_id];
+        if (False(image.flags & ImageFlagBits::Picked)) {
             image.flags |= ImageFlagBits::Picked;
-            images.push_back(map.image_id);
-            if constexpr (BOOL_BREAK) {
-                if (func(map.image_id, image)) {
-                    return true;
-                }
-            } else {
-                func(map.image_id, image);
-            }
-        }
-        if constexpr (BOOL_BREAK) {
-            return false;
+            images.push_back(image_id);
         }
-    });
+    }
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
-    for (const ImageMapId map_id : maps) {
-        slot_map_views[map_id].picked = false;
+    for (const ImageId image_id : images) {
+        Image& image = slot_images[image_id];
+        if (False(image.flags & ImageFlagBits::Registered)) {
+            continue;
+        }
+        if constexpr (BOOL_BREAK) {
+            if (func(image_id, image)) {
+                break;
+            }
+        } else {
+            func(image_id, image);
+        }
     }
 }
 
@@ -1860,97 +1927,51 @@ template <class P>
 template <typename Func>
 void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, size_t size,
                                               Func&& func) {
-    using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
-    static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-    boost::container::small_vector<ImageId, 8> images;
-    auto storage_id = getStorageID(as_id);
+    const auto storage_id = getStorageID(as_id);
     if (!storage_id) {
         return;
     }
-    auto& gpu_page_table = gpu_page_table_storage[*storage_id * 2];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &gpu_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = gpu_page_table.find(page);
-                       if (it == gpu_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
-    for (const ImageId image_id : images) {
-        slot_images[image_id].flags &= ~ImageFlagBits::Picked;
-    }
+    ForEachImageInGPUIndex(gpu_page_table_storage[*storage_id * 2], gpu_addr, size,
+                           std::forward<Func>(func));
 }
 
 template <class P>
 template <typename Func>
 void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr, size_t size,
                                                  Func&& func) {
-    using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
-    static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-    boost::container::small_vector<ImageId, 8> images;
-    auto storage_id = getStorageID(as_id);
+    const auto storage_id = getStorageID(as_id);
     if (!storage_id) {
         return;
     }
-    auto& sparse_page_table = gpu_page_table_storage[*storage_id * 2 + 1];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &sparse_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = sparse_page_table.find(page);
-                       if (it == sparse_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
-    for (const ImageId image_id : images) {
-        slot_images[image_id].flags &= ~ImageFlagBits::Picked;
+    ForEachImageInGPUIndex(gpu_page_table_storage[*storage_id * 2 + 1], gpu_addr, size,
+                           std::forward<Func>(func));
+}
+
+template <class P>
+template <typename Func>
+void TextureCache<P>::ForEachImageInGPUIndex(const TextureCacheGPUMap& index, GPUVAddr gpu_addr,
+                                             size_t size, Func&& func) {
+    using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
+    static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+    boost::container::small_vector<std::pair<GPUVAddr, ImageId>, 8> images;
+    index.ForEachOverlapping(gpu_addr, gpu_addr + size,
+                             [&images](GPUVAddr image_addr, GPUVAddr, ImageId image_id) {
+                                 images.emplace_back(image_addr, image_id);
+                             });
+    std::ranges::sort(images, {}, &std::pair<GPUVAddr, ImageId>::first);
+    for (const auto& [image_addr, image_id] : images) {
+        Image& image = slot_images[image_id];
+        // Skip the images unregistered by a previous callback
+        if (False(image.flags & ImageFlagBits::Registered)) {
+            continue;
+        }
+        if constexpr (BOOL_BREAK) {
+            if (func(image_id, image)) {
+                return;
+            }
+        } else {
+            func(image_id, image);
+        }
     }
 }
 
@@ -1998,16 +2019,15 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
+    memory_account.Add(Common::AlignUp(tentative_size, 1024));
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
-        (*channel_state->gpu_page_table)[page].push_back(image_id);
-    });
+    const GPUVAddr gpu_addr_end = image.gpu_addr + image.guest_size_bytes;
+    channel_state->gpu_page_table->Insert(image.gpu_addr, gpu_addr_end, image_id);
     if (False(image.flags & ImageFlagBits::Sparse)) {
         auto map_id =
             slot_map_views.insert(image.gpu_addr, image.cpu_addr, image.guest_size_bytes, image_id);
-        ForEachCPUPage(image.cpu_addr, image.guest_size_bytes,
-                       [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+        page_table.Insert(image.cpu_addr, image.cpu_addr + image.guest_size_bytes, map_id);
         image.map_view_id = map_id;
         return;
     }
@@ -2015,14 +2035,11 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     ForEachSparseSegment(
         image, [this, image_id, &sparse_maps](GPUVAddr gpu_addr, DAddr cpu_addr, size_t size) {
             auto map_id = slot_map_views.insert(gpu_addr, cpu_addr, size, image_id);
-            ForEachCPUPage(cpu_addr, size,
-                           [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+            page_table.Insert(cpu_addr, cpu_addr + size, map_id);
             sparse_maps.push_back(map_id);
         });
     sparse_views.emplace(image_id, std::move(sparse_maps));
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
-        (*channel_state->sparse_page_table)[page].push_back(image_id);
-    });
+    channel_state->sparse_page_table->Insert(image.gpu_addr, gpu_addr_end, image_id);
 }
 
 template <class P>
@@ -2033,77 +2050,21 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     image.flags &= ~ImageFlagBits::Registered;
     image.flags &= ~ImageFlagBits::BadOverlap;
     lru_cache.Free(image.lru_index);
-    const auto& clear_page_table =
-        [image_id](u64 page,
-                   std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>&
-                       selected_page_table) {
-            const auto page_it = selected_page_table.find(page);
-            if (page_it == selected_page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageId>& image_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_ids, image_id);
-            if (vector_it == image_ids.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
-                           page << YUZU_PAGEBITS);
-                return;
-            }
-            image_ids.erase(vector_it);
-        };
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, &clear_page_table](u64 page) {
-        clear_page_table(page, (*channel_state->gpu_page_table));
-    });
+    const GPUVAddr gpu_addr_end = image.gpu_addr + image.guest_size_bytes;
+    channel_state->gpu_page_table->Erase(image.gpu_addr, gpu_addr_end, image_id);
     if (False(image.flags & ImageFlagBits::Sparse)) {
         const auto map_id = image.map_view_id;
-        ForEachCPUPage(image.cpu_addr, image.guest_size_bytes, [this, map_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_map_ids, map_id);
-            if (vector_it == image_map_ids.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
-                           page << YUZU_PAGEBITS);
-                return;
-            }
-            image_map_ids.erase(vector_it);
-        });
+        page_table.Erase(image.cpu_addr, image.cpu_addr + image.guest_size_bytes, map_id);
         slot_map_views.erase(map_id);
         return;
     }
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, &clear_page_table](u64 page) {
-        clear_page_table(page, (*channel_state->sparse_page_table));
-    });
+    channel_state->sparse_page_table->Erase(image.gpu_addr, gpu_addr_end, image_id);
     auto it = sparse_views.find(image_id);
     ASSERT(it != sparse_views.end());
     auto& sparse_maps = it->second;
     for (auto& map_view_id : sparse_maps) {
         const auto& map_range = slot_map_views[map_view_id];
-        const DAddr cpu_addr = map_range.cpu_addr;
-        const std::size_t size = map_range.size;
-        ForEachCPUPage(cpu_addr, size, [this, image_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            auto vector_it = image_map_ids.begin();
-            while (vector_it != image_map_ids.end()) {
-                ImageMapView& map = slot_map_views[*vector_it];
-                if (map.image_id != image_id) {
-                    vector_it++;
-                    continue;
-                }
-                if (!map.picked) {
-                    map.picked = true;
-                }
-                vector_it = image_map_ids.erase(vector_it);
-            }
-        });
+        page_table.Erase(map_range.cpu_addr, map_range.cpu_addr + map_range.size, map_view_id);
         slot_map_views.erase(map_view_id);
     }
     sparse_views.erase(it);
@@ -2163,7 +2124,9 @@ template <class P>
 void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
     if (image.HasScaled()) {
-        total_used_memory -= GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory -= scaled_size;
+        memory_account.Remove(scaled_size);
     }
     u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
     if ((IsPixelFormatASTC(image.info.format) &&
@@ -2172,6 +2135,7 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    memory_account.Remove(Common::AlignUp(tentative_size, 1024));
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2325,7 +2289,7 @@ void TextureCache<P>::SynchronizeAliases(ImageId image_id) {
         const ImageBase& rhs_image = slot_images[rhs->id];
         return lhs_image.modification_tick < rhs_image.modification_tick;
     });
-    const auto& resolution = Settings::values.resolution_info;
+    const auto& resolution = Settings::GetHotValues().resolution_info;
     for (const AliasedImage* const aliased : aliased_images) {
         if (!resolution.active || !any_rescaled) {
             CopyImage(image_id, aliased->id, aliased->copies);
@@ -2381,7 +2345,7 @@ void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<Imag
     if (is_rescaled) {
         ASSERT(True(dst.flags & ImageFlagBits::Rescaled));
         const bool both_2d{src.info.type == ImageType::e2D && dst.info.type == ImageType::e2D};
-        const auto& resolution = Settings::values.resolution_info;
+        const auto& resolution = Settings::GetHotValues().resolution_info;
         for (auto& copy : copies) {
             copy.src_offset.x = resolution.ScaleUp(copy.src_offset.x);
             copy.dst_offset.x = resolution.ScaleUp(copy.dst_offset.x);
@@ -2393,9 +2357,15 @@ void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<Imag
             }
         }
     }
+    const auto count_reinterpretation = [&](ReinterpretPath path) {
+        if (src.info.format != dst.info.format) {
+            ++frame_reinterpretations[{src.info.format, dst.info.format, path}];
+        }
+    };
     const auto dst_format_type = GetFormatType(dst.info.format);
     const auto src_format_type = GetFormatType(src.info.format);
     if (src_format_type == dst_format_type) {
+        count_reinterpretation(ReinterpretPath::Copy);
         if constexpr (HAS_EMULATED_COPIES) {
             if (!runtime.CanImageBeCopied(dst, src)) {
                 return runtime.EmulateCopyImage(dst, src, copies);
@@ -2406,8 +2376,10 @@ void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<Imag
     UNIMPLEMENTED_IF(dst.info.type != ImageType::e2D);
     UNIMPLEMENTED_IF(src.info.type != ImageType::e2D);
     if (runtime.ShouldReinterpret(dst, src)) {
+        count_reinterpretation(ReinterpretPath::Reinterpret);
         return runtime.ReinterpretImage(dst, src, copies);
     }
+    count_reinterpretation(ReinterpretPath::Convert);
     for (const ImageCopy& copy : copies) {
         UNIMPLEMENTED_IF(copy.dst_subresource.num_layers != 1);
         UNIMPLEMENTED_IF(copy.src_subresource.num_layers != 1);
@@ -2448,7 +2420,7 @@ void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<Imag
             if (!is_rescaled) {
                 return expected_size;
             }
-            const auto& resolution = Settings::values.resolution_info;
+            const auto& resolution = Settings::GetHotValues().resolution_info;
             return Extent3D{
                 .width = resolution.ScaleUp(expected_size.width),
                 .height = resolution.ScaleUp(expected_size.height),
@@ -2487,7 +2459,7 @@ std::pair<FramebufferId, ImageViewId> TextureCache<P>::RenderTargetFromImage(
     const ImageViewId depth_view_id = is_color ? ImageViewId{} : view_id;
     Extent3D extent = MipSize(image.info.size, view_info.range.base.level);
     if (is_rescaled) {
-        const auto& resolution = Settings::values.resolution_info;
+        const auto& resolution = Settings::GetHotValues().resolution_info;
         extent.width = resolution.ScaleUp(extent.width);
         if (image.info.type == ImageType::e2D) {
             extent.height = resolution.ScaleUp(extent.height);
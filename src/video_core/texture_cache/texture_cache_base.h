@@ -6,8 +6,10 @@
 #include <atomic>
 #include <deque>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <span>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -17,8 +19,10 @@
 
 #include "common/common_types.h"
 #include "common/hash.h"
+#include "common/interval_index.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include "common/polyfill_ranges.h"
 #include "common/scratch_buffer.h"
 #include "common/slot_vector.h"
@@ -29,10 +33,13 @@
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/descriptor_table.h"
+#include "video_core/texture_cache/dynamic_resolution.h"
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/readback_predictor.h"
 #include "video_core/texture_cache/render_targets.h"
+#include "video_core/texture_cache/transcode_cache.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
 
@@ -63,7 +70,11 @@ struct AsyncDecodeContext {
     std::atomic_bool complete;
 };
 
-using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
+using TextureCacheGPUMap = Common::IntervalIndex<GPUVAddr, ImageId>;
+
+/// Number of copies between images of different formats in a frame, keyed by source format,
+/// destination format and copy path.
+using ReinterpretStats = std::map<std::tuple<PixelFormat, PixelFormat, ReinterpretPath>, u32>;
 
 class TextureCacheChannelInfo : public ChannelInfo {
 public:
@@ -91,9 +102,6 @@ public:
 
 template <class P>
 class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelInfo> {
-    /// Address shift for caching images into a hash table
-    static constexpr u64 YUZU_PAGEBITS = 20;
-
     /// Enables debugging features to the texture cache
     static constexpr bool ENABLE_VALIDATION = P::ENABLE_VALIDATION;
     /// Implement blits as copies between framebuffers
@@ -104,6 +112,10 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr bool HAS_DEVICE_MEMORY_INFO = P::HAS_DEVICE_MEMORY_INFO;
     /// True when the API can do asynchronous texture downloads.
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = P::IMPLEMENTS_ASYNC_DOWNLOADS;
+    /// True when the API can back sparse images only where the guest has mapped memory.
+    static constexpr bool IMPLEMENTS_SPARSE_RESIDENCY = P::IMPLEMENTS_SPARSE_RESIDENCY;
+    /// True when the API can measure the time the GPU spends rendering.
+    static constexpr bool HAS_GPU_TIME = P::HAS_GPU_TIME;
 
     static constexpr size_t UNSET_CHANNEL{std::numeric_limits<size_t>::max()};
 
@@ -134,6 +146,11 @@ public:
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Returns the format reinterpretation copies of the last completed frame
+    [[nodiscard]] const ReinterpretStats& LastFrameReinterpretations() const noexcept {
+        return last_frame_reinterpretations;
+    }
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -253,38 +270,17 @@ public:
     std::recursive_mutex mutex;
 
 private:
-    /// Iterate over all page indices in a range
-    template <typename Func>
-    static void ForEachCPUPage(DAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
-        const u64 page_end = (addr + size - 1) >> YUZU_PAGEBITS;
-        for (u64 page = addr >> YUZU_PAGEBITS; page <= page_end; ++page) {
-            if constexpr (RETURNS_BOOL) {
-                if (func(page)) {
-                    break;
-                }
-            } else {
-                func(page);
-            }
-        }
-    }
+    void OnGPUASRegister(size_t map_id) final override;
 
-    template <typename Func>
-    static void ForEachGPUPage(GPUVAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
-        const u64 page_end = (addr + size - 1) >> YUZU_PAGEBITS;
-        for (u64 page = addr >> YUZU_PAGEBITS; page <= page_end; ++page) {
-            if constexpr (RETURNS_BOOL) {
-                if (func(page)) {
-                    break;
-                }
-            } else {
-                func(page);
-            }
-        }
-    }
+    /// Order in which the garbage collector evicts images, cheapest to bring back first
+    enum class EvictionTier {
+        Clean,    ///< Contents can be uploaded again from guest memory
+        Costly,   ///< Contents can be uploaded again but are expensive to load
+        Modified, ///< Contents only exist on the GPU and have to be downloaded
+    };
 
-    void OnGPUASRegister(size_t map_id) final override;
+    /// Derives the garbage collector thresholds from the available device memory.
+    void ConfigureMemoryThresholds(u64 available_memory);
 
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
@@ -360,6 +356,11 @@ private:
     template <typename Func>
     void ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr, size_t size, Func&& func);
 
+    /// Iterates over the images of a GPU index overlapping a region, in address order
+    template <typename Func>
+    void ForEachImageInGPUIndex(const TextureCacheGPUMap& index, GPUVAddr gpu_addr, size_t size,
+                                Func&& func);
+
     /// Iterates over all the images in a region calling func
     template <typename Func>
     void ForEachSparseSegment(ImageBase& image, Func&& func);
@@ -431,7 +432,7 @@ private:
 
     std::unordered_map<RenderTargets, FramebufferId> framebuffers;
 
-    std::unordered_map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
+    Common::IntervalIndex<DAddr, ImageMapId> page_table;
     std::unordered_map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
 
     DAddr virtual_invalid_space{};
@@ -439,6 +440,10 @@ private:
     bool has_deleted_images = false;
     bool is_rescaling = false;
     u64 total_used_memory = 0;
+    /// Estimated size of the images, total_used_memory follows the driver report when there is one
+    Common::MemoryAccount memory_account{Common::MemoryCategory::TextureCache};
+    u64 device_local_memory = 0;
+    u64 memory_budget = 0;
     u64 minimum_memory;
     u64 expected_memory;
     u64 critical_memory;
@@ -489,6 +494,13 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
+    ReinterpretStats frame_reinterpretations;
+    ReinterpretStats last_frame_reinterpretations;
+
+    TranscodeCache transcode_cache;
+    DynamicResolution dynamic_resolution;
+    u64 last_gpu_time = 0;
+    ReadbackPredictor readback_predictor;
     Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/literals.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/zstd_compression.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/transcode_cache.h"
+#include "video_core/texture_cache/util.h"
+
+namespace VideoCommon {
+namespace {
+using namespace Common::Literals;
+using VideoCore::Surface::IsPixelFormatASTC;
+
+constexpr u32 CACHE_MAGIC = 0x43545A59; // "YZTC"
+constexpr u32 CACHE_VERSION = 1;
+
+/// Payloads compress well, a low level keeps stores cheap for large images
+constexpr s32 COMPRESSION_LEVEL = 1;
+
+/// Bytes of transcoded images kept in memory, larger images are not kept at all
+constexpr size_t MEMORY_BUDGET = 64_MiB;
+constexpr size_t MAX_MEMORY_ENTRY_SIZE = MEMORY_BUDGET / 4;
+
+struct EntryHeader {
+    u32 magic;
+    u32 version;
+    u32 num_copies;
+    u32 reserved;
+    u64 output_size;
+};
+static_assert(std::is_trivially_copyable_v<EntryHeader>);
+
+u128 ComputeKey(std::span<const u8> input, const ImageInfo& info) {
+    const std::array<u32, 11> layout{
+        CACHE_VERSION,
+        static_cast<u32>(info.format),
+        static_cast<u32>(info.type),
+        static_cast<u32>(info.resources.levels),
+        static_cast<u32>(info.resources.layers),
+        info.size.width,
+        info.size.height,
+        info.size.depth,
+        info.num_samples,
+        static_cast<u32>(Settings::values.astc_recompression.GetValue()),
+        static_cast<u32>(input.size()),
+    };
+    const u64 layout_hash =
+        Common::CityHash64(reinterpret_cast<const char*>(layout.data()), sizeof(layout));
+    return Common::CityHash128WithSeed(reinterpret_cast<const char*>(input.data()), input.size(),
+                                       u128{layout_hash, input.size()});
+}
+} // Anonymous namespace
+
+TranscodeCache::TranscodeCache() : store_worker{1, "TranscodeCacheStore"} {
+    const auto shader_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir);
+    const auto base_dir = shader_dir / "transcoded_textures";
+    if (!Common::FS::CreateDirs(base_dir)) {
+        LOG_ERROR(HW_GPU, "Failed to create transcoded texture cache directory");
+        return;
+    }
+    cache_dir = base_dir;
+}
+
+TranscodeCache::~TranscodeCache() = default;
+
+void TranscodeCache::ConvertImage(std::span<const u8> input, const ImageInfo& info,
+                                  std::span<u8> output, std::span<BufferImageCopy> copies) {
+    if (!IsPixelFormatASTC(info.format)) {
+        VideoCommon::ConvertImage(input, info, output, copies);
+        return;
+    }
+    const u128 key = ComputeKey(input, info);
+    if (LoadFromMemory(key, output, copies)) {
+        return;
+    }
+    if (!Settings::values.use_disk_texture_cache.GetValue() || cache_dir.empty()) {
+        VideoCommon::ConvertImage(input, info, output, copies);
+        StoreInMemory(key, output, copies);
+        return;
+    }
+    auto path = cache_dir / fmt::format("{:016x}{:016x}.bin", key[1], key[0]);
+    if (!Load(path, output, copies)) {
+        VideoCommon::ConvertImage(input, info, output, copies);
+        Store(std::move(path), output, copies);
+    }
+    StoreInMemory(key, output, copies);
+}
+
+bool TranscodeCache::LoadFromMemory(const u128& key, std::span<u8> output,
+                                    std::span<BufferImageCopy> copies) {
+    std::scoped_lock lk{memory_mutex};
+    const auto it = memory_lookup.find(key);
+    if (it == memory_lookup.end()) {
+        return false;
+    }
+    const MemoryEntry& entry = *it->second;
+    if (entry.output.size() != output.size() || entry.copies.size() != copies.size()) {
+        return false;
+    }
+    std::ranges::copy(entry.output, output.begin());
+    std::ranges::copy(entry.copies, copies.begin());
+    memory_entries.splice(memory_entries.begin(), memory_entries, it->second);
+    return true;
+}
+
+void TranscodeCache::StoreInMemory(const u128& key, std::span<const u8> output,
+                                   std::span<const BufferImageCopy> copies) {
+    if (output.size() > MAX_MEMORY_ENTRY_SIZE) {
+        return;
+    }
+    std::scoped_lock lk{memory_mutex};
+    if (memory_lookup.contains(key)) {
+        return;
+    }
+    while (!memory_entries.empty() && memory_size + output.size() > MEMORY_BUDGET) {
+        const MemoryEntry& oldest = memory_entries.back();
+        memory_size -= oldest.output.size();
+        memory_lookup.erase(oldest.key);
+        memory_entries.pop_back();
+    }
+    memory_entries.push_front(MemoryEntry{
+        .key = key,
+        .output{output.begin(), output.end()},
+        .copies{copies.begin(), copies.end()},
+    });
+    memory_lookup.emplace(key, memory_entries.begin());
+    memory_size += output.size();
+}
+
+bool TranscodeCache::Load(const std::filesystem::path& path, std::span<u8> output,
+                          std::span<BufferImageCopy> copies) const {
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen()) {
+        return false;
+    }
+    EntryHeader header{};
+    if (!file.ReadObject(header) || header.magic != CACHE_MAGIC ||
+        header.version != CACHE_VERSION || header.num_copies != copies.size() ||
+        header.output_size != output.size()) {
+        return false;
+    }
+    std::vector<BufferImageCopy> stored_copies(header.num_copies);
+    if (file.ReadSpan<BufferImageCopy>(stored_copies) != stored_copies.size()) {
+        return false;
+    }
+    const s64 payload_offset = file.Tell();
+    if (payload_offset < 0 || static_cast<u64>(payload_offset) > file.GetSize()) {
+        return false;
+    }
+    std::vector<u8> compressed(file.GetSize() - static_cast<u64>(payload_offset));
+    if (file.ReadSpan<u8>(compressed) != compressed.size()) {
+        return false;
+    }
+    const std::vector<u8> payload = Common::Compression::DecompressDataZSTD(compressed);
+    if (payload.size() != output.size()) {
+        LOG_WARNING(HW_GPU, "Corrupted transcoded texture cache entry {}", path.string());
+        return false;
+    }
+    std::ranges::copy(payload, output.begin());
+    std::ranges::copy(stored_copies, copies.begin());
+    return true;
+}
+
+void TranscodeCache::Store(std::filesystem::path path, std::span<const u8> output,
+                           std::span<const BufferImageCopy> copies) {
+    std::vector<u8> payload(output.begin(), output.end());
+    std::vector<BufferImageCopy> stored_copies(copies.begin(), copies.end());
+    store_worker.QueueWork([path = std::move(path), payload = std::move(payload),
+                            stored_copies = std::move(stored_copies)] {
+        const std::vector<u8> compressed = Common::Compression::CompressDataZSTD(
+            payload.data(), payload.size(), COMPRESSION_LEVEL);
+        if (compressed.empty()) {
+            return;
+        }
+        const EntryHeader header{
+            .magic = CACHE_MAGIC,
+            .version = CACHE_VERSION,
+            .num_copies = static_cast<u32>(stored_copies.size()),
+            .reserved = 0,
+            .output_size = payload.size(),
+        };
+        // Write to a temporary file first, concurrent loads must never see a partial entry
+        auto temp_path = path;
+        temp_path += ".tmp";
+        {
+            Common::FS::IOFile file(temp_path, Common::FS::FileAccessMode::Write,
+                                    Common::FS::FileType::BinaryFile);
+            if (!file.IsOpen() || !file.WriteObject(header) ||
+                file.WriteSpan<BufferImageCopy>(stored_copies) != stored_copies.size() ||
+                file.WriteSpan<u8>(compressed) != compressed.size()) {
+                LOG_ERROR(HW_GPU, "Failed to write transcoded texture cache entry");
+                file.Close();
+                Common::FS::RemoveFile(temp_path);
+                return;
+            }
+        }
+        if (!Common::FS::RenameFile(temp_path, path)) {
+            Common::FS::RemoveFile(temp_path);
+        }
+    });
+}
+
+} // namespace VideoCommon
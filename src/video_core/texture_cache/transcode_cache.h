@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/thread_worker.h"
+#include "video_core/texture_cache/types.h"
+
+namespace VideoCommon {
+
+struct ImageInfo;
+
+/**
+ * Cache of CPU transcoded ASTC images.
+ *
+ * Entries are keyed by a hash of the unswizzled guest data and the image layout, so they can be
+ * shared between titles and sessions. Payloads are stored zstd compressed, and writing them is
+ * done on a background thread.
+ *
+ * The most recent results are also kept in memory regardless of the disk cache setting, so copies
+ * of the same texture at other addresses are not transcoded again.
+ */
+class TranscodeCache {
+public:
+    explicit TranscodeCache();
+    ~TranscodeCache();
+
+    TranscodeCache(const TranscodeCache&) = delete;
+    TranscodeCache& operator=(const TranscodeCache&) = delete;
+
+    /// Same as ConvertImage, reusing the result of a previous session when possible.
+    /// May be called from multiple threads.
+    void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
+                      std::span<BufferImageCopy> copies);
+
+private:
+    struct MemoryEntry {
+        u128 key;
+        std::vector<u8> output;
+        std::vector<BufferImageCopy> copies;
+    };
+
+    struct KeyHash {
+        size_t operator()(const u128& key) const noexcept {
+            return static_cast<size_t>(key[0] ^ key[1]);
+        }
+    };
+
+    [[nodiscard]] bool LoadFromMemory(const u128& key, std::span<u8> output,
+                                      std::span<BufferImageCopy> copies);
+
+    void StoreInMemory(const u128& key, std::span<const u8> output,
+                       std::span<const BufferImageCopy> copies);
+
+    [[nodiscard]] bool Load(const std::filesystem::path& path, std::span<u8> output,
+                            std::span<BufferImageCopy> copies) const;
+
+    void Store(std::filesystem::path path, std::span<const u8> output,
+               std::span<const BufferImageCopy> copies);
+
+    std::filesystem::path cache_dir;
+    Common::ThreadWorker store_worker;
+
+    std::mutex memory_mutex;
+    std::list<MemoryEntry> memory_entries; ///< Most recently used first
+    std::unordered_map<u128, std::list<MemoryEntry>::iterator, KeyHash> memory_lookup;
+    size_t memory_size = 0;
+};
+
+} // namespace VideoCommon
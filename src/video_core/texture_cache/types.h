@@ -57,6 +57,13 @@ enum class RelaxedOptions : u32 {
 };
 DECLARE_ENUM_FLAG_OPERATORS(RelaxedOptions)
 
+/// Path taken to copy between images of different guest formats.
+enum class ReinterpretPath : u32 {
+    Copy,        ///< Transfer copy between formats of the same surface type.
+    Reinterpret, ///< Copy through a buffer between color and depth formats.
+    Convert,     ///< Conversion draw between color and depth formats.
+};
+
 struct Offset2D {
     constexpr auto operator<=>(const Offset2D&) const noexcept = default;
 
@@ -708,6 +708,40 @@ u32 CalculateLevelStrideAlignment(const ImageInfo& info, u32 level) {
     return StrideAlignment(num_tiles, block, bpp_log2, info.tile_width_spacing);
 }
 
+boost::container::small_vector<std::pair<u32, u32>, 16> CalculateRegionGuestRanges(
+    const ImageInfo& info, u32 level, u32 layer, Offset2D offset, Extent2D extent) {
+    ASSERT(info.type != ImageType::Linear && info.type != ImageType::Buffer);
+    const LevelInfo level_info = MakeLevelInfo(info);
+    const Extent3D tile_shift = TileShift(level_info, level);
+    const Extent3D tiles = LevelTiles(level_info, level);
+    const u32 block_shift =
+        GOB_SIZE_SHIFT + tile_shift.width + tile_shift.height + tile_shift.depth;
+    const u32 base = CalculateMipLevelOffsets(info)[level] + layer * info.layer_stride;
+
+    // Horizontal coordinates are expressed in bytes and vertical coordinates in rows of blocks
+    const Extent2D tile_size = level_info.tile_size;
+    const u32 x_begin = (static_cast<u32>(offset.x) / tile_size.width) << level_info.bpp_log2;
+    const u32 x_end = Common::DivCeil(static_cast<u32>(offset.x) + extent.width, tile_size.width)
+                      << level_info.bpp_log2;
+    const u32 y_begin = static_cast<u32>(offset.y) / tile_size.height;
+    const u32 y_end = Common::DivCeil(static_cast<u32>(offset.y) + extent.height, tile_size.height);
+
+    const u32 block_width_shift = GOB_SIZE_X_SHIFT + tile_shift.width;
+    const u32 block_height_shift = GOB_SIZE_Y_SHIFT + tile_shift.height;
+    const u32 column_begin = x_begin >> block_width_shift;
+    const u32 column_end = std::min(Common::DivCeilLog2(x_end, block_width_shift), tiles.width);
+    const u32 row_begin = y_begin >> block_height_shift;
+    const u32 row_end = std::min(Common::DivCeilLog2(y_end, block_height_shift), tiles.height);
+
+    boost::container::small_vector<std::pair<u32, u32>, 16> ranges;
+    for (u32 row = row_begin; row < row_end; ++row) {
+        const u32 row_offset = row * tiles.width;
+        ranges.emplace_back(base + ((row_offset + column_begin) << block_shift),
+                            base + ((row_offset + column_end) << block_shift));
+    }
+    return ranges;
+}
+
 PixelFormat PixelFormatFromTIC(const TICEntry& config) noexcept {
     return PixelFormatFromTextureInfo(config.format, config.r_type, config.g_type, config.b_type,
                                       config.a_type, config.srgb_conversion);
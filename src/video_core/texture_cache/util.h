@@ -5,6 +5,7 @@
 
 #include <optional>
 #include <span>
+#include <utility>
 #include <boost/container/small_vector.hpp>
 
 #include "common/common_types.h"
@@ -48,6 +49,11 @@ struct OverlapResult {
 
 [[nodiscard]] u32 CalculateLevelStrideAlignment(const ImageInfo& info, u32 level);
 
+/// Returns the guest byte ranges, relative to the image base, of the GOB blocks that hold a 2D
+/// region of a block linear image. One range is returned per row of GOB blocks.
+[[nodiscard]] boost::container::small_vector<std::pair<u32, u32>, 16> CalculateRegionGuestRanges(
+    const ImageInfo& info, u32 level, u32 layer, Offset2D offset, Extent2D extent);
+
 [[nodiscard]] VideoCore::Surface::PixelFormat PixelFormatFromTIC(
     const Tegra::Texture::TICEntry& config) noexcept;
 
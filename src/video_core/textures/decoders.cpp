@@ -12,9 +12,13 @@
 #include "common/div_ceil.h"
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
+#include "video_core/textures/workers.h"
 
 namespace Tegra::Texture {
 namespace {
+/// Images with fewer linear bytes than this are swizzled on the calling thread
+constexpr u64 PARALLEL_SWIZZLE_THRESHOLD = 1ULL << 20;
+
 template <u32 mask>
 constexpr u32 pdep(u32 value) {
     u32 result = 0;
@@ -33,9 +37,40 @@ void incrpdep(u32& value) {
     value = ((value | ~mask) + swizzled_incr) & mask;
 }
 
+/// Copies the whole GOBs of a row of a 16 bytes per pixel image and returns the number of columns
+/// processed. Each 16 byte column of a GOB row is contiguous in both layouts and sits at a fixed
+/// offset within the GOB, so no per pixel address generation is needed.
+template <bool TO_LINEAR>
+u32 SwizzleGobRow(std::span<u8> output, std::span<const u8> input, u32 width, u32 swizzled_base,
+                  u32 unswizzled_base, u32 x_shift) {
+    static constexpr u32 COLUMN_SIZE = 16;
+    static constexpr u32 COLUMNS_PER_GOB = GOB_SIZE_X / COLUMN_SIZE;
+    static constexpr std::array<u32, COLUMNS_PER_GOB> column_offsets{
+        pdep<SWIZZLE_X_BITS>(0 * COLUMN_SIZE),
+        pdep<SWIZZLE_X_BITS>(1 * COLUMN_SIZE),
+        pdep<SWIZZLE_X_BITS>(2 * COLUMN_SIZE),
+        pdep<SWIZZLE_X_BITS>(3 * COLUMN_SIZE),
+    };
+    const u32 num_gobs = width / COLUMNS_PER_GOB;
+    for (u32 gob = 0; gob < num_gobs; ++gob) {
+        const u32 swizzled_gob = swizzled_base + (gob << x_shift);
+        const u32 unswizzled_gob = unswizzled_base + gob * GOB_SIZE_X;
+        for (u32 column = 0; column < COLUMNS_PER_GOB; ++column) {
+            const u32 swizzled_offset = swizzled_gob + column_offsets[column];
+            const u32 unswizzled_offset = unswizzled_gob + column * COLUMN_SIZE;
+
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            std::memcpy(dst, src, COLUMN_SIZE);
+        }
+    }
+    return num_gobs * COLUMNS_PER_GOB;
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
-void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
-                 u32 block_height, u32 block_depth, u32 stride) {
+void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height,
+                 u32 block_height, u32 block_depth, u32 stride, u32 first_row, u32 last_row) {
     // The origin of the transformation can be configured here, leave it as zero as the current API
     // doesn't expose it.
     static constexpr u32 origin_x = 0;
@@ -55,39 +90,73 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
     const u32 block_depth_mask = (1U << block_depth) - 1;
     const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
 
-    for (u32 slice = 0; slice < depth; ++slice) {
+    // Rows are numbered across slices, every row maps to a disjoint set of bytes so ranges of
+    // rows can be processed independently
+    for (u32 row = first_row; row < last_row; ++row) {
+        const u32 slice = row / height;
+        const u32 line = row % height;
+
         const u32 z = slice + origin_z;
         const u32 offset_z = (z >> block_depth) * slice_size +
                              ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
-        for (u32 line = 0; line < height; ++line) {
-            const u32 y = line + origin_y;
-            const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
 
-            const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
-            const u32 offset_y = (block_y >> block_height) * block_size +
-                                 ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
+        const u32 y = line + origin_y;
+        const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < width;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+        const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
+        const u32 offset_y = (block_y >> block_height) * block_size +
+                             ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
+        u32 column = 0;
+        if constexpr (BYTES_PER_PIXEL == 16 && origin_x == 0) {
+            column = SwizzleGobRow<TO_LINEAR>(output, input, width, offset_z + offset_y + swizzled_y,
+                                              slice * pitch * height + line * pitch, x_shift);
+        }
+        u32 swizzled_x = pdep<SWIZZLE_X_BITS>((column + origin_x) * BYTES_PER_PIXEL);
+        for (; column < width; ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
+            const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
+            const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
 
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
+            const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
+            const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
 
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+            const u32 unswizzled_offset =
+                slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
 
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            std::memcpy(dst, src, BYTES_PER_PIXEL);
         }
     }
 }
 
+template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
+void SwizzleRows(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
+                 u32 block_height, u32 block_depth, u32 stride) {
+    const u32 num_rows = height * depth;
+    const u64 linear_size = static_cast<u64>(width) * BYTES_PER_PIXEL * num_rows;
+    const u32 num_jobs = std::min(NumThreadWorkers() + 1, num_rows);
+    if (linear_size < PARALLEL_SWIZZLE_THRESHOLD || num_jobs < 2) {
+        SwizzleImpl<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, block_height,
+                                                block_depth, stride, 0, num_rows);
+        return;
+    }
+    // Split large images in row ranges, the calling thread processes the first one
+    Common::TaskGroup& workers{GetThreadWorkers()};
+    const u32 rows_per_job = Common::DivCeil(num_rows, num_jobs);
+    for (u32 first_row = rows_per_job; first_row < num_rows; first_row += rows_per_job) {
+        const u32 last_row = std::min(first_row + rows_per_job, num_rows);
+        workers.QueueWork([=] {
+            SwizzleImpl<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, block_height,
+                                                    block_depth, stride, first_row, last_row);
+        });
+    }
+    SwizzleImpl<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, block_height,
+                                            block_depth, stride, 0, rows_per_job);
+    workers.WaitForRequests();
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
 void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height,
                         u32 depth, u32 origin_x, u32 origin_y, u32 extent_x, u32 num_lines,
@@ -157,7 +226,7 @@ void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixe
     switch (bytes_per_pixel) {
 #define BPP_CASE(x)                                                                                \
     case x:                                                                                        \
-        return SwizzleImpl<TO_LINEAR, x>(output, input, width, height, depth, block_height,        \
+        return SwizzleRows<TO_LINEAR, x>(output, input, width, height, depth, block_height,        \
                                          block_depth, stride_alignment);
         BPP_CASE(1)
         BPP_CASE(2)
@@ -3,7 +3,7 @@
 
 #include <array>
 
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "common/settings.h"
 #include "video_core/textures/texture.h"
 
@@ -85,9 +85,9 @@ float TSCEntry::MaxAnisotropy() const noexcept {
 } // namespace Tegra::Texture
 
 size_t std::hash<TICEntry>::operator()(const TICEntry& tic) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tic), sizeof tic);
+    return Common::FastHash64(tic);
 }
 
 size_t std::hash<TSCEntry>::operator()(const TSCEntry& tsc) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tsc), sizeof tsc);
+    return Common::FastHash64(tsc);
 }
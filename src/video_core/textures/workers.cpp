@@ -1,15 +1,21 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <thread>
+
 #include "video_core/textures/workers.h"
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers() {
-    static Common::ThreadWorker workers{std::max(std::thread::hardware_concurrency(), 2U) / 2,
-                                        "ImageTranscode"};
+Common::TaskGroup& GetThreadWorkers() {
+    static Common::TaskGroup workers{Common::TaskPriority::FrameCritical, NumThreadWorkers()};
 
     return workers;
 }
 
+u32 NumThreadWorkers() {
+    return std::max(std::thread::hardware_concurrency(), 2U) / 2;
+}
+
 } // namespace Tegra::Texture
@@ -3,10 +3,14 @@
 
 #pragma once
 
-#include "common/thread_worker.h"
+#include "common/task_scheduler.h"
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers();
+/// Returns the image transcoding tasks, run on the shared task scheduler
+Common::TaskGroup& GetThreadWorkers();
+
+/// Returns the number of tasks of GetThreadWorkers that run at once
+u32 NumThreadWorkers();
 
 }
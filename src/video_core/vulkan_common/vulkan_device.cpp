@@ -714,6 +714,7 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
                                VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
         dynamic_state3_blending = false;
         dynamic_state3_enables = false;
+        dynamic_state3_rasterization = false;
     }
 
     logical = vk::Device::Create(physical, queue_cis, ExtensionListForVulkan(loaded_extensions),
@@ -721,13 +722,24 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
 
     graphics_queue = logical.GetQueue(graphics_family);
     present_queue = logical.GetQueue(present_family);
+    if (graphics_queue_count > 1 && HasTimelineSemaphore()) {
+        // Work on the second queue is synchronized with the main one through timeline semaphores
+        async_compute_queue = logical.GetQueue(graphics_family, 1);
+        has_async_compute_queue = true;
+    }
 
     VmaVulkanFunctions functions{};
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
     functions.vkGetDeviceProcAddr = dld.vkGetDeviceProcAddr;
 
+    // With the memory budget extension allocations are limited by the budget reported by the
+    // driver instead of an estimate from the heap sizes
+    VmaAllocatorCreateFlags allocator_flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT;
+    if (extensions.memory_budget) {
+        allocator_flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
     const VmaAllocatorCreateInfo allocator_info = {
-        .flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT,
+        .flags = allocator_flags,
         .physicalDevice = physical,
         .device = *logical,
         .preferredLargeHeapBlockSize = 0,
@@ -977,6 +989,9 @@ bool Device::GetSuitability(bool requires_swapchain) {
 
     FOR_EACH_VK_FEATURE_EXT(FEATURE_EXTENSION);
     FOR_EACH_VK_EXTENSION(EXTENSION);
+#ifdef _WIN32
+    EXTENSION(EXT, FULL_SCREEN_EXCLUSIVE, full_screen_exclusive);
+#endif
 
 #undef FEATURE_EXTENSION
 #undef EXTENSION
@@ -1096,6 +1111,16 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
         SetNext(next, properties.transform_feedback);
     }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
+    if (extensions.external_memory_host) {
+        properties.external_memory_host.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+        SetNext(next, properties.external_memory_host);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1169,14 +1194,30 @@ void Device::RemoveUnsuitableExtensions() {
     dynamic_state3_enables =
         features.extended_dynamic_state3.extendedDynamicState3DepthClampEnable &&
         features.extended_dynamic_state3.extendedDynamicState3LogicOpEnable;
+    dynamic_state3_rasterization =
+        features.extended_dynamic_state3.extendedDynamicState3PolygonMode &&
+        features.extended_dynamic_state3.extendedDynamicState3AlphaToCoverageEnable &&
+        features.extended_dynamic_state3.extendedDynamicState3AlphaToOneEnable;
 
-    extensions.extended_dynamic_state3 = dynamic_state3_blending || dynamic_state3_enables;
+    extensions.extended_dynamic_state3 =
+        dynamic_state3_blending || dynamic_state3_enables || dynamic_state3_rasterization;
     dynamic_state3_blending = dynamic_state3_blending && extensions.extended_dynamic_state3;
     dynamic_state3_enables = dynamic_state3_enables && extensions.extended_dynamic_state3;
+    dynamic_state3_rasterization =
+        dynamic_state3_rasterization && extensions.extended_dynamic_state3;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state3,
                                        features.extended_dynamic_state3,
                                        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
 
+    // VK_EXT_graphics_pipeline_library
+    extensions.graphics_pipeline_library =
+        features.graphics_pipeline_library.graphicsPipelineLibrary &&
+        properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking &&
+        extensions.pipeline_library;
+    RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                       features.graphics_pipeline_library,
+                                       VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
     // VK_EXT_provoking_vertex
     extensions.provoking_vertex =
         features.provoking_vertex.provokingVertexLast &&
@@ -1282,6 +1323,15 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     if (present) {
         present_family = *present;
     }
+    has_sparse_binding_queue =
+        (queue_family_properties[graphics_family].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0;
+    graphics_timestamp_bits = queue_family_properties[graphics_family].timestampValidBits;
+    // Only queues from the graphics family are used for asynchronous compute, so resources don't
+    // need queue family ownership transfers
+    if (Settings::values.use_async_compute_queue.GetValue() &&
+        queue_family_properties[graphics_family].queueCount > 1) {
+        graphics_queue_count = 2;
+    }
 }
 
 u64 Device::GetDeviceMemoryUsage() const {
@@ -1296,6 +1346,22 @@ u64 Device::GetDeviceMemoryUsage() const {
     return result;
 }
 
+u64 Device::GetDeviceMemoryBudget() const {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget;
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    budget.pNext = nullptr;
+    physical.GetMemoryProperties(&budget);
+    u64 result{};
+    for (const size_t heap : valid_heap_memory) {
+        result += budget.heapBudget[heap];
+    }
+    if (!is_integrated) {
+        // Keep the same reserve CollectPhysicalMemoryInfo applies to the initial budget
+        result -= std::min<u64>(result / 8, 1_GiB);
+    }
+    return result;
+}
+
 void Device::CollectPhysicalMemoryInfo() {
     // Calculate limits using memory budget
     VkPhysicalDeviceMemoryBudgetPropertiesEXT budget{};
@@ -1357,7 +1423,7 @@ void Device::CollectToolingInfo() {
 }
 
 std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
-    static constexpr float QUEUE_PRIORITY = 1.0f;
+    static constexpr std::array QUEUE_PRIORITIES{1.0f, 1.0f};
 
     std::unordered_set<u32> unique_queue_families{graphics_family, present_family};
     std::vector<VkDeviceQueueCreateInfo> queue_cis;
@@ -1369,10 +1435,10 @@ std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
             .pNext = nullptr,
             .flags = 0,
             .queueFamilyIndex = queue_family,
-            .queueCount = 1,
+            .queueCount = queue_family == graphics_family ? graphics_queue_count : 1,
             .pQueuePriorities = nullptr,
         });
-        ci.pQueuePriorities = &QUEUE_PRIORITY;
+        ci.pQueuePriorities = QUEUE_PRIORITIES.data();
     }
 
     return queue_cis;
@@ -47,6 +47,7 @@ VK_DEFINE_HANDLE(VmaAllocator)
     FEATURE(EXT, ExtendedDynamicState2, EXTENDED_DYNAMIC_STATE_2, extended_dynamic_state2)         \
     FEATURE(EXT, ExtendedDynamicState3, EXTENDED_DYNAMIC_STATE_3, extended_dynamic_state3)         \
     FEATURE(EXT, 4444Formats, 4444_FORMATS, format_a4b4g4r4)                                       \
+    FEATURE(EXT, GraphicsPipelineLibrary, GRAPHICS_PIPELINE_LIBRARY, graphics_pipeline_library)    \
     FEATURE(EXT, IndexTypeUint8, INDEX_TYPE_UINT8, index_type_uint8)                               \
     FEATURE(EXT, LineRasterization, LINE_RASTERIZATION, line_rasterization)                        \
     FEATURE(EXT, PrimitiveTopologyListRestart, PRIMITIVE_TOPOLOGY_LIST_RESTART,                    \
@@ -65,6 +66,7 @@ VK_DEFINE_HANDLE(VmaAllocator)
     EXTENSION(EXT, CONDITIONAL_RENDERING, conditional_rendering)                                   \
     EXTENSION(EXT, CONSERVATIVE_RASTERIZATION, conservative_rasterization)                         \
     EXTENSION(EXT, DEPTH_RANGE_UNRESTRICTED, depth_range_unrestricted)                             \
+    EXTENSION(EXT, EXTERNAL_MEMORY_HOST, external_memory_host)                                     \
     EXTENSION(EXT, MEMORY_BUDGET, memory_budget)                                                   \
     EXTENSION(EXT, ROBUSTNESS_2, robustness_2)                                                     \
     EXTENSION(EXT, SAMPLER_FILTER_MINMAX, sampler_filter_minmax)                                   \
@@ -74,6 +76,7 @@ VK_DEFINE_HANDLE(VmaAllocator)
     EXTENSION(EXT, VERTEX_ATTRIBUTE_DIVISOR, vertex_attribute_divisor)                             \
     EXTENSION(KHR, DRAW_INDIRECT_COUNT, draw_indirect_count)                                       \
     EXTENSION(KHR, DRIVER_PROPERTIES, driver_properties)                                           \
+    EXTENSION(KHR, PIPELINE_LIBRARY, pipeline_library)                                             \
     EXTENSION(KHR, PUSH_DESCRIPTOR, push_descriptor)                                               \
     EXTENSION(KHR, SAMPLER_MIRROR_CLAMP_TO_EDGE, sampler_mirror_clamp_to_edge)                     \
     EXTENSION(KHR, SHADER_FLOAT_CONTROLS, shader_float_controls)                                   \
@@ -247,6 +250,16 @@ public:
         return present_queue;
     }
 
+    /// Returns the secondary queue of the graphics family used for asynchronous compute work.
+    vk::Queue GetAsyncComputeQueue() const {
+        return async_compute_queue;
+    }
+
+    /// Returns true when a secondary queue is available for asynchronous compute work.
+    bool HasAsyncComputeQueue() const {
+        return has_async_compute_queue;
+    }
+
     /// Returns main graphics queue family index.
     u32 GetGraphicsFamily() const {
         return graphics_family;
@@ -257,6 +270,21 @@ public:
         return present_family;
     }
 
+    /// Returns true when the main graphics queue can write timestamps.
+    bool HasGraphicsTimestamps() const {
+        return graphics_timestamp_bits != 0 && properties.properties.limits.timestampPeriod > 0.0f;
+    }
+
+    /// Returns the number of valid bits in timestamps written on the main graphics queue.
+    u32 GetGraphicsTimestampBits() const {
+        return graphics_timestamp_bits;
+    }
+
+    /// Returns the number of nanoseconds a timestamp increments by.
+    float GetTimestampPeriod() const {
+        return properties.properties.limits.timestampPeriod;
+    }
+
     /// Returns the current Vulkan API version provided in Vulkan-formatted version numbers.
     u32 ApiVersion() const {
         return properties.properties.apiVersion;
@@ -267,6 +295,21 @@ public:
         return properties.properties.driverVersion;
     }
 
+    /// Returns the PCI vendor ID of the device.
+    u32 GetVendorID() const {
+        return properties.properties.vendorID;
+    }
+
+    /// Returns the vendor specific ID of the device.
+    u32 GetDeviceID() const {
+        return properties.properties.deviceID;
+    }
+
+    /// Returns the UUID identifying pipeline caches compatible with the driver.
+    std::span<const u8, VK_UUID_SIZE> GetPipelineCacheUUID() const {
+        return properties.properties.pipelineCacheUUID;
+    }
+
     /// Returns the device name.
     std::string_view GetModelName() const {
         return properties.properties.deviceName;
@@ -319,6 +362,12 @@ public:
         return features.features.textureCompressionBC;
     }
 
+    /// Returns true if 2D images can be partially backed by memory through the graphics queue.
+    bool IsSparseResidencySupported() const {
+        return has_sparse_binding_queue && features.features.sparseBinding &&
+               features.features.sparseResidencyImage2D;
+    }
+
     /// Returns true if descriptor aliasing is natively supported.
     bool IsDescriptorAliasingSupported() const {
         return GetDriverID() != VK_DRIVER_ID_QUALCOMM_PROPRIETARY;
@@ -429,6 +478,11 @@ public:
         return extensions.swapchain_mutable_format;
     }
 
+    /// Returns true if VK_EXT_full_screen_exclusive is enabled.
+    bool IsExtFullScreenExclusiveEnabled() const {
+        return extensions.full_screen_exclusive;
+    }
+
     /// Returns true if VK_KHR_shader_float_controls is enabled.
     bool IsKhrShaderFloatControlsSupported() const {
         return extensions.shader_float_controls;
@@ -543,6 +597,12 @@ public:
         return dynamic_state3_enables;
     }
 
+    /// Returns true if the device supports the polygon mode and alpha to coverage and alpha to
+    /// one enable dynamic states of VK_EXT_extended_dynamic_state3.
+    bool IsExtExtendedDynamicState3RasterizationSupported() const {
+        return dynamic_state3_rasterization;
+    }
+
     /// Returns true if the device supports VK_EXT_line_rasterization.
     bool IsExtLineRasterizationSupported() const {
         return extensions.line_rasterization;
@@ -563,6 +623,11 @@ public:
         return extensions.conservative_rasterization;
     }
 
+    /// Returns true if the device supports VK_EXT_graphics_pipeline_library with fast linking.
+    bool IsExtGraphicsPipelineLibrarySupported() const {
+        return extensions.graphics_pipeline_library;
+    }
+
     /// Returns true if the device supports VK_EXT_provoking_vertex.
     bool IsExtProvokingVertexSupported() const {
         return extensions.provoking_vertex;
@@ -577,6 +642,17 @@ public:
         return extensions.conditional_rendering;
     }
 
+    /// Returns true if the device supports VK_EXT_external_memory_host.
+    bool IsExtExternalMemoryHostSupported() const {
+        return extensions.external_memory_host;
+    }
+
+    /// Returns the required alignment for host pointers imported through
+    /// VK_EXT_external_memory_host.
+    u64 GetMinImportedHostPointerAlignment() const {
+        return properties.external_memory_host.minImportedHostPointerAlignment;
+    }
+
     bool HasTimelineSemaphore() const;
 
     /// Returns the minimum supported version of SPIR-V.
@@ -630,6 +706,9 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    /// Returns the current memory budget of the used heaps as reported by VK_EXT_memory_budget.
+    u64 GetDeviceMemoryBudget() const;
+
     u32 GetSetsPerPool() const {
         return sets_per_pool;
     }
@@ -743,16 +822,21 @@ private:
     bool TestDepthStencilBlits(VkFormat format) const;
 
 private:
-    VkInstance instance;         ///< Vulkan instance.
-    VmaAllocator allocator;      ///< VMA allocator.
-    vk::DeviceDispatch dld;      ///< Device function pointers.
-    vk::PhysicalDevice physical; ///< Physical device.
-    vk::Device logical;          ///< Logical device.
-    vk::Queue graphics_queue;    ///< Main graphics queue.
-    vk::Queue present_queue;     ///< Main present queue.
-    u32 instance_version{};      ///< Vulkan instance version.
-    u32 graphics_family{};       ///< Main graphics queue family index.
-    u32 present_family{};        ///< Main present queue family index.
+    VkInstance instance;             ///< Vulkan instance.
+    VmaAllocator allocator;          ///< VMA allocator.
+    vk::DeviceDispatch dld;          ///< Device function pointers.
+    vk::PhysicalDevice physical;     ///< Physical device.
+    vk::Device logical;              ///< Logical device.
+    vk::Queue graphics_queue;        ///< Main graphics queue.
+    vk::Queue present_queue;         ///< Main present queue.
+    vk::Queue async_compute_queue;   ///< Secondary graphics family queue for compute work.
+    u32 instance_version{};          ///< Vulkan instance version.
+    u32 graphics_family{};           ///< Main graphics queue family index.
+    u32 present_family{};            ///< Main present queue family index.
+    u32 graphics_queue_count{1};     ///< Number of queues created from the graphics family.
+    u32 graphics_timestamp_bits{};   ///< Valid timestamp bits on the graphics family.
+    bool has_async_compute_queue{};  ///< Secondary graphics family queue is usable.
+    bool has_sparse_binding_queue{}; ///< Graphics family queue accepts sparse binding.
 
     struct Extensions {
 #define EXTENSION(prefix, macro_name, var_name) bool var_name{};
@@ -763,6 +847,7 @@ private:
         FOR_EACH_VK_FEATURE_1_3(FEATURE);
         FOR_EACH_VK_FEATURE_EXT(FEATURE);
         FOR_EACH_VK_EXTENSION(EXTENSION);
+        bool full_screen_exclusive{}; ///< Only loaded on Windows.
 
 #undef EXTENSION
 #undef FEATURE
@@ -792,6 +877,8 @@ private:
         VkPhysicalDevicePushDescriptorPropertiesKHR push_descriptor{};
         VkPhysicalDeviceSubgroupSizeControlProperties subgroup_size_control{};
         VkPhysicalDeviceTransformFeedbackPropertiesEXT transform_feedback{};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT graphics_pipeline_library{};
+        VkPhysicalDeviceExternalMemoryHostPropertiesEXT external_memory_host{};
 
         VkPhysicalDeviceProperties properties{};
     };
@@ -822,6 +909,7 @@ private:
     bool must_emulate_bgr565{};                ///< Emulates BGR565 by swizzling RGB565 format.
     bool dynamic_state3_blending{};            ///< Has all blending features of dynamic_state3.
     bool dynamic_state3_enables{};             ///< Has all enables features of dynamic_state3.
+    bool dynamic_state3_rasterization{};       ///< Has all raster features of dynamic_state3.
     bool supports_conditional_barriers{};      ///< Allows barriers in conditional control flow.
     u64 device_access_memory{};                ///< Total size of device local memory in bytes.
     u32 sets_per_pool{};                       ///< Sets per Description Pool
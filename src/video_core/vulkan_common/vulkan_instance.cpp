@@ -40,13 +40,18 @@ namespace {
     const vk::InstanceDispatch& dld, Core::Frontend::WindowSystemType window_type,
     bool enable_validation) {
     std::vector<const char*> extensions;
-    extensions.reserve(6);
+    extensions.reserve(7);
     switch (window_type) {
     case Core::Frontend::WindowSystemType::Headless:
         break;
 #ifdef _WIN32
     case Core::Frontend::WindowSystemType::Windows:
         extensions.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
+        // Required by VK_EXT_full_screen_exclusive, which every driver exposing it supports.
+        if (AreExtensionsSupported(dld,
+                                   std::array{VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME})) {
+            extensions.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+        }
         break;
 #elif defined(__APPLE__)
     case Core::Frontend::WindowSystemType::Cocoa:
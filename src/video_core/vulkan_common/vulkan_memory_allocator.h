@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 #include "common/common_types.h"
@@ -11,12 +12,12 @@
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 VK_DEFINE_HANDLE(VmaAllocator)
+VK_DEFINE_HANDLE(VmaAllocation)
 
 namespace Vulkan {
 
 class Device;
 class MemoryMap;
-class MemoryAllocation;
 
 /// Hints and requirements for the backing memory type of a commit
 enum class MemoryUsage {
@@ -39,13 +40,20 @@ void ForEachDeviceLocalHostVisibleHeap(const Device& device, F&& f) {
     }
 }
 
+/// Buffer aliasing host memory imported through VK_EXT_external_memory_host.
+/// The buffer is declared last so it is destroyed before the memory it is bound to.
+struct ImportedHostBuffer {
+    vk::DeviceMemory memory;
+    vk::Buffer buffer;
+};
+
 /// Ownership handle of a memory commitment.
-/// Points to a subregion of a memory allocation.
+/// Points to a subregion of a memory block managed by VMA.
 class MemoryCommit {
 public:
     explicit MemoryCommit() noexcept = default;
-    explicit MemoryCommit(MemoryAllocation* allocation_, VkDeviceMemory memory_, u64 begin_,
-                          u64 end_) noexcept;
+    explicit MemoryCommit(VmaAllocator allocator_, VmaAllocation allocation_,
+                          VkDeviceMemory memory_, u64 begin_, u64 end_) noexcept;
     ~MemoryCommit();
 
     MemoryCommit& operator=(MemoryCommit&&) noexcept;
@@ -55,7 +63,7 @@ public:
     MemoryCommit(const MemoryCommit&) = delete;
 
     /// Returns a host visible memory map.
-    /// It will map the backing allocation if it hasn't been mapped before.
+    /// It will map the commit if it hasn't been mapped before.
     std::span<u8> Map();
 
     /// Returns the Vulkan memory handler.
@@ -71,18 +79,17 @@ public:
 private:
     void Release();
 
-    MemoryAllocation* allocation{}; ///< Pointer to the large memory allocation.
-    VkDeviceMemory memory{};        ///< Vulkan device memory handler.
-    u64 begin{};                    ///< Beginning offset in bytes to where the commit exists.
-    u64 end{};                      ///< Offset in bytes where the commit ends.
-    std::span<u8> span;             ///< Host visible memory span. Empty if not queried before.
+    VmaAllocator allocator{};   ///< Vma allocator the commit was allocated from.
+    VmaAllocation allocation{}; ///< Vma allocation of the commit.
+    VkDeviceMemory memory{};    ///< Vulkan device memory handler.
+    u64 begin{};                ///< Beginning offset in bytes to where the commit exists.
+    u64 end{};                  ///< Offset in bytes where the commit ends.
+    std::span<u8> span;         ///< Host visible memory span. Empty if not queried before.
 };
 
 /// Memory allocator container.
 /// Allocates and releases memory allocations on demand.
 class MemoryAllocator {
-    friend MemoryAllocation;
-
 public:
     /**
      * Construct memory allocator
@@ -99,8 +106,22 @@ public:
 
     vk::Image CreateImage(const VkImageCreateInfo& ci) const;
 
+    /// Creates an image without backing memory, memory is bound later through sparse binding.
+    vk::Image CreateSparseImage(const VkImageCreateInfo& ci) const;
+
     vk::Buffer CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const;
 
+    /**
+     * Creates a buffer backed by the given host allocation instead of device memory.
+     *
+     * @param ci           Buffer create info, its size is the size of the imported range.
+     * @param host_pointer Host pointer aligned to the minimum imported host pointer alignment.
+     *
+     * @returns The imported buffer, or nullopt when the driver refuses the import.
+     */
+    std::optional<ImportedHostBuffer> ImportHostBuffer(const VkBufferCreateInfo& ci,
+                                                       void* host_pointer) const;
+
     /**
      * Commits a memory with the specified requirements.
      *
@@ -108,35 +129,18 @@ public:
      * @param usage        Indicates how the memory will be used.
      *
      * @returns A memory commit.
+     *
+     * @throw vk::Exception when no memory is available within the budget
      */
     MemoryCommit Commit(const VkMemoryRequirements& requirements, MemoryUsage usage);
 
-    /// Commits memory required by the buffer and binds it.
-    MemoryCommit Commit(const vk::Buffer& buffer, MemoryUsage usage);
-
 private:
-    /// Tries to allocate a chunk of memory.
-    bool TryAllocMemory(VkMemoryPropertyFlags flags, u32 type_mask, u64 size);
-
-    /// Releases a chunk of memory.
-    void ReleaseMemory(MemoryAllocation* alloc);
-
-    /// Tries to allocate a memory commit.
-    std::optional<MemoryCommit> TryCommit(const VkMemoryRequirements& requirements,
-                                          VkMemoryPropertyFlags flags);
-
-    /// Returns the fastest compatible memory property flags from the wanted flags.
-    VkMemoryPropertyFlags MemoryPropertyFlags(u32 type_mask, VkMemoryPropertyFlags flags) const;
-
     /// Returns index to the fastest memory type compatible with the passed requirements.
     std::optional<u32> FindType(VkMemoryPropertyFlags flags, u32 type_mask) const;
 
-    const Device& device;                                       ///< Device handle.
-    VmaAllocator allocator;                                     ///< Vma allocator.
-    const VkPhysicalDeviceMemoryProperties properties;          ///< Physical device properties.
-    std::vector<std::unique_ptr<MemoryAllocation>> allocations; ///< Current allocations.
-    VkDeviceSize buffer_image_granularity; // The granularity for adjacent offsets between buffers
-                                           // and optimal images
+    const Device& device;                              ///< Device handle.
+    VmaAllocator allocator;                            ///< Vma allocator.
+    const VkPhysicalDeviceMemoryProperties properties; ///< Physical device properties.
     u32 valid_memory_types{~0u};
 };
 
@@ -133,6 +133,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetStencilWriteMask);
     X(vkCmdSetViewport);
     X(vkCmdWaitEvents);
+    X(vkCmdWriteTimestamp);
     X(vkCmdBindVertexBuffers2EXT);
     X(vkCmdSetCullModeEXT);
     X(vkCmdSetDepthBoundsTestEnableEXT);
@@ -144,6 +145,9 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetDepthBiasEnableEXT);
     X(vkCmdSetLogicOpEnableEXT);
     X(vkCmdSetDepthClampEnableEXT);
+    X(vkCmdSetPolygonModeEXT);
+    X(vkCmdSetAlphaToCoverageEnableEXT);
+    X(vkCmdSetAlphaToOneEnableEXT);
     X(vkCmdSetFrontFaceEXT);
     X(vkCmdSetLogicOpEXT);
     X(vkCmdSetPatchControlPointsEXT);
@@ -207,8 +211,10 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkGetEventStatus);
     X(vkGetFenceStatus);
     X(vkGetImageMemoryRequirements);
+    X(vkGetImageSparseMemoryRequirements);
     X(vkGetPipelineCacheData);
     X(vkGetMemoryFdKHR);
+    X(vkGetMemoryHostPointerPropertiesEXT);
 #ifdef _WIN32
     X(vkGetMemoryWin32HandleKHR);
 #endif
@@ -217,6 +223,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkGetPipelineExecutableStatisticsKHR);
     X(vkGetSemaphoreCounterValue);
     X(vkMapMemory);
+    X(vkQueueBindSparse);
     X(vkQueueSubmit);
     X(vkResetFences);
     X(vkResetQueryPool);
@@ -282,6 +289,7 @@ bool Load(VkInstance instance, InstanceDispatch& dld) noexcept {
     X(vkDestroySurfaceKHR);
     X(vkGetPhysicalDeviceFeatures2);
     X(vkGetPhysicalDeviceProperties2);
+    X(vkGetPhysicalDeviceSparseImageFormatProperties);
     X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR);
     X(vkGetPhysicalDeviceSurfaceFormatsKHR);
     X(vkGetPhysicalDeviceSurfacePresentModesKHR);
@@ -644,9 +652,9 @@ Device Device::Create(VkPhysicalDevice physical_device, Span<VkDeviceQueueCreate
     return Device(device, dispatch);
 }
 
-Queue Device::GetQueue(u32 family_index) const noexcept {
+Queue Device::GetQueue(u32 family_index, u32 queue_index) const noexcept {
     VkQueue queue;
-    dld->vkGetDeviceQueue(handle, family_index, 0, &queue);
+    dld->vkGetDeviceQueue(handle, family_index, queue_index, &queue);
     return Queue(queue, *dld);
 }
 
@@ -819,6 +827,26 @@ VkMemoryRequirements Device::GetImageMemoryRequirements(VkImage image) const noe
     return requirements;
 }
 
+std::vector<VkSparseImageMemoryRequirements> Device::GetImageSparseMemoryRequirements(
+    VkImage image) const {
+    u32 num{};
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, nullptr);
+    std::vector<VkSparseImageMemoryRequirements> requirements(num);
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, requirements.data());
+    return requirements;
+}
+
+VkResult Device::GetMemoryHostPointerPropertiesEXT(
+    const void* host_pointer, VkMemoryHostPointerPropertiesEXT& properties) const noexcept {
+    properties = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT,
+        .pNext = nullptr,
+        .memoryTypeBits = 0,
+    };
+    return dld->vkGetMemoryHostPointerPropertiesEXT(
+        handle, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, host_pointer, &properties);
+}
+
 std::vector<VkPipelineExecutablePropertiesKHR> Device::GetPipelineExecutablePropertiesKHR(
     VkPipeline pipeline) const {
     const VkPipelineInfoKHR info{
@@ -888,6 +916,21 @@ VkFormatProperties PhysicalDevice::GetFormatProperties(VkFormat format) const no
     return properties;
 }
 
+std::vector<VkSparseImageFormatProperties> PhysicalDevice::GetSparseImageFormatProperties(
+    VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+    VkImageTiling tiling) const {
+    if (!dld->vkGetPhysicalDeviceSparseImageFormatProperties) {
+        return {};
+    }
+    u32 num{};
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, nullptr);
+    std::vector<VkSparseImageFormatProperties> properties(num);
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, properties.data());
+    return properties;
+}
+
 std::vector<VkExtensionProperties> PhysicalDevice::EnumerateDeviceExtensionProperties() const {
     u32 num;
     dld->vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &num, nullptr);
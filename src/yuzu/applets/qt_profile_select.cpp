@@ -30,7 +30,7 @@ QString FormatUserEntryText(const QString& username, Common::UUID uuid) {
 
 QString GetImagePath(Common::UUID uuid) {
     const auto path =
-        Common::FS::GetYuzuPath(Common::FS::YuzuPath::NANDDir) /
+        Common::FS::GetYuzuPath(Common::FS::YuzuPath::SaveDir) /
         fmt::format("system/save/8000000000000010/su/avators/{}.jpg", uuid.FormattedString());
     return QString::fromStdString(Common::FS::PathToUTF8String(path));
 }
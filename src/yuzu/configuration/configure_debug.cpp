@@ -53,6 +53,8 @@ void ConfigureDebug::SetConfiguration() {
     ui->enable_renderdoc_hotkey->setChecked(Settings::values.enable_renderdoc_hotkey.GetValue());
     ui->disable_buffer_reorder->setEnabled(runtime_lock);
     ui->disable_buffer_reorder->setChecked(Settings::values.disable_buffer_reorder.GetValue());
+    ui->enable_gpu_profiling->setEnabled(runtime_lock);
+    ui->enable_gpu_profiling->setChecked(Settings::values.gpu_profiling.GetValue());
     ui->enable_graphics_debugging->setEnabled(runtime_lock);
     ui->enable_graphics_debugging->setChecked(Settings::values.renderer_debug.GetValue());
     ui->enable_shader_feedback->setEnabled(runtime_lock);
@@ -74,6 +76,8 @@ void ConfigureDebug::SetConfiguration() {
         Settings::values.disable_shader_loop_safety_checks.GetValue());
     ui->extended_logging->setChecked(Settings::values.extended_logging.GetValue());
     ui->perform_vulkan_check->setChecked(Settings::values.perform_vulkan_check.GetValue());
+    ui->enable_tracing->setEnabled(runtime_lock);
+    ui->enable_tracing->setChecked(Settings::values.enable_tracing.GetValue());
 
 #ifdef YUZU_USE_QT_WEB_ENGINE
     ui->disable_web_applet->setChecked(UISettings::values.disable_web_applet.GetValue());
@@ -99,6 +103,7 @@ void ConfigureDebug::ApplyConfiguration() {
     Settings::values.renderer_debug = ui->enable_graphics_debugging->isChecked();
     Settings::values.enable_renderdoc_hotkey = ui->enable_renderdoc_hotkey->isChecked();
     Settings::values.disable_buffer_reorder = ui->disable_buffer_reorder->isChecked();
+    Settings::values.gpu_profiling = ui->enable_gpu_profiling->isChecked();
     Settings::values.renderer_shader_feedback = ui->enable_shader_feedback->isChecked();
     Settings::values.cpu_debug_mode = ui->enable_cpu_debugging->isChecked();
     Settings::values.enable_nsight_aftermath = ui->enable_nsight_aftermath->isChecked();
@@ -110,6 +115,7 @@ void ConfigureDebug::ApplyConfiguration() {
     Settings::values.disable_macro_hle = ui->disable_macro_hle->isChecked();
     Settings::values.extended_logging = ui->extended_logging->isChecked();
     Settings::values.perform_vulkan_check = ui->perform_vulkan_check->isChecked();
+    Settings::values.enable_tracing = ui->enable_tracing->isChecked();
     UISettings::values.disable_web_applet = ui->disable_web_applet->isChecked();
     Debugger::ToggleConsole();
     Common::Log::Filter filter;
@@ -50,6 +50,16 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, audio_muted, tr("Mute audio"), QStringLiteral());
     INSERT(Settings, volume, tr("Volume:"), QStringLiteral());
     INSERT(Settings, dump_audio_commands, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, audio_low_latency, tr("Low latency audio"),
+           tr("Plays audio with the smallest device buffer and queue that avoid crackling.\n"
+              "The queue grows again when the device runs out of samples."));
+    INSERT(Settings, audio_time_stretch, tr("Adapt playback speed instead of stalling"),
+           tr("With low latency audio, plays up to 5% faster or slower to keep the queue at its "
+              "target\ninstead of pausing emulation. This slightly changes the pitch."));
+    INSERT(Settings, audio_render_on_demand, tr("Render audio on demand"),
+           tr("Only renders audio when the output device has room for it, instead of on a fixed "
+              "timer.\nWith the null output, audio is rendered in real time, which stops it from "
+              "using a full core\nwhen running at unlocked speed."));
     INSERT(UISettings, mute_when_in_background, tr("Mute audio when in background"),
            QStringLiteral());
 
@@ -71,12 +81,24 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
               "faster or not.\n200% for a 30 FPS game is 60 FPS, and for a "
               "60 FPS game it will be 120 FPS.\nDisabling it means unlocking the framerate to the "
               "maximum your PC can reach."));
+    INSERT(Settings, fast_forward_frame_skip, tr("Fast Forward Frame Skip"),
+           tr("Number of frames left unpresented after each presented one while the speed limit "
+              "is disabled.\nThe skipped frames are still emulated and rendered, only drawing "
+              "them to the screen is skipped."));
+    INSERT(Settings, use_huge_pages, tr("Use huge pages for emulated RAM"),
+           tr("Backs emulated RAM with 2 MiB pages where the host allows it, reducing TLB "
+              "misses in games with large working sets.\nOnly available on Linux with "
+              "transparent huge pages enabled for shared memory."));
 
     // Cpu
     INSERT(Settings, cpu_accuracy, tr("Accuracy:"),
            tr("This setting controls the accuracy of the emulated CPU.\nDon't change this unless "
               "you know what you are doing."));
     INSERT(Settings, cpu_backend, tr("Backend:"), QStringLiteral());
+    INSERT(Settings, pin_host_threads, tr("Pin emulation threads to host cores"),
+           tr("Keeps each emulated CPU core on its own fast physical core and moves background "
+              "workers such as shader builders to efficiency cores.\nUseful on hybrid and "
+              "big.LITTLE CPUs where the OS scheduler moves threads around."));
 
     // Cpu Debug
 
@@ -123,6 +145,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Forces the game to render at a different resolution.\nHigher resolutions require "
               "much more VRAM and bandwidth.\n"
               "Options lower than 1X can cause rendering issues."));
+    INSERT(Settings, dynamic_resolution_fps, tr("Dynamic Resolution Target FPS (Vulkan only):"),
+           tr("Renders at native resolution while the GPU takes longer to render a frame than "
+              "this frame rate allows, and goes back to the selected resolution once it can hold "
+              "it.\nOnly applies to resolutions above 1X."));
+    INSERT(Settings, dynamic_resolution, QStringLiteral(), QStringLiteral());
     INSERT(Settings, scaling_filter, tr("Window Adapting Filter:"), QStringLiteral());
     INSERT(Settings, fsr_sharpening_slider, tr("FSR Sharpness:"),
            tr("Determines how sharpened the image will look while using FSR’s dynamic contrast."));
@@ -183,6 +210,25 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     // Renderer (Advanced Graphics)
     INSERT(Settings, async_presentation, tr("Enable asynchronous presentation (Vulkan only)"),
            tr("Slightly improves performance by moving presentation to a separate CPU thread."));
+    INSERT(Settings, low_latency_presentation,
+           tr("Low latency presentation (Vulkan only)"),
+           tr("Presents only the newest rendered frame when several are waiting for the display, "
+              "dropping the others.\nReduces input latency at the cost of smoothness. Requires "
+              "asynchronous presentation."));
+    INSERT(Settings, frame_generation, tr("Frame generation (Vulkan only, experimental)"),
+           tr("Presents a frame estimated from the motion between two frames in between them "
+              "in games running at 30 FPS or lower.\nMakes motion smoother on high refresh rate "
+              "displays, at the cost of half a frame of latency and artifacts around moving "
+              "objects. Requires asynchronous presentation and does nothing with low latency "
+              "presentation."));
+    INSERT(Settings, parallel_command_recording,
+           tr("Record command buffers in parallel (Vulkan only, experimental)"),
+           tr("Splits rendering work at render pass boundaries and records it on several CPU "
+              "threads.\nMay improve performance in CPU-bound games on hosts with many cores."));
+    INSERT(Settings, use_async_compute_queue,
+           tr("Use asynchronous compute queue (Vulkan only, experimental)"),
+           tr("Decodes ASTC textures on a second GPU queue so decoding can overlap with "
+              "rendering.\nOnly available on GPUs exposing several graphics queues."));
     INSERT(
         Settings, renderer_force_max_clock, tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
@@ -207,6 +253,20 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Enables GPU vendor-specific pipeline cache.\nThis option can improve shader loading "
               "time significantly in cases where the Vulkan driver does not store pipeline cache "
               "files internally."));
+    INSERT(Settings, use_pipeline_library,
+           tr("Use graphics pipeline libraries (Vulkan only, experimental)"),
+           tr("Builds new pipelines from separately compiled parts that are linked quickly, then "
+              "replaces them with fully optimized pipelines in the background.\nReduces "
+              "stuttering when new shaders are encountered. Requires "
+              "VK_EXT_graphics_pipeline_library with fast linking."));
+    INSERT(Settings, optimize_spirv, tr("Optimize SPIR-V output (Vulkan only, experimental)"),
+           tr("Removes unused variables and repeated reads of shader inputs and uniforms from the "
+              "generated SPIR-V before it is handed to the driver.\nCan speed up shaders on "
+              "drivers with weak shader compilers."));
+    INSERT(Settings, use_disk_texture_cache, tr("Cache decoded ASTC textures on disk"),
+           tr("Stores ASTC textures decoded on the CPU, after recompression if enabled, in the "
+              "shader cache directory.\nReduces stuttering when the same textures are loaded "
+              "again in later sessions, at the cost of disk space."));
     INSERT(
         Settings, enable_compute_pipelines, tr("Enable Compute Pipelines (Intel Vulkan Only)"),
         tr("Enable compute pipelines, required by some games.\nThis setting only exists for Intel "
@@ -221,6 +281,18 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
               "unlocked."));
     INSERT(Settings, barrier_feedback_loops, tr("Barrier feedback loops"),
            tr("Improves rendering of transparency effects in specific games."));
+    INSERT(Settings, use_host_memory_import, tr("Read geometry from guest memory (Vulkan only)"),
+           tr("Lets the GPU read vertex and index data in place from emulated memory instead of "
+              "copying it.\nRequires VK_EXT_external_memory_host. Can reduce upload costs on "
+              "integrated GPUs, but may cause graphical issues when games rewrite geometry in "
+              "use."));
+    INSERT(Settings, conditional_rendering_speculation,
+           tr("Speculative conditional rendering (Vulkan only):"),
+           tr("Decides conditional draws from the previous occlusion query results instead of "
+              "waiting for the GPU to resolve the current ones.\nSets how many decisions in a row "
+              "may be speculated before waiting once for the real results, lower values are more "
+              "accurate. 0 always waits.\nReduces stalls in occlusion heavy games, but objects "
+              "may pop in a frame late."));
 
     // Renderer (Debug)
 
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "yuzu/game_list_index.h"
+
+namespace {
+
+constexpr int IndexVersion = 1;
+
+QString GetIndexPath() {
+    return QString::fromStdString(
+        Common::FS::PathToUTF8String(Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) /
+                                     "game_list" / "index.json"));
+}
+
+QString ToHexString(u64 value) {
+    return QStringLiteral("%1").arg(value, 16, 16, QLatin1Char{'0'});
+}
+
+u64 FromHexString(const QJsonValue& value) {
+    return value.toString().toULongLong(nullptr, 16);
+}
+
+} // Anonymous namespace
+
+void GameListIndex::Load() {
+    std::scoped_lock lk{mutex};
+    previous_entries.clear();
+    current_entries.clear();
+
+    QFile file{GetIndexPath()};
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    if (root[QStringLiteral("version")].toInt() != IndexVersion) {
+        return;
+    }
+
+    const QJsonObject files = root[QStringLiteral("files")].toObject();
+    for (auto it = files.begin(); it != files.end(); ++it) {
+        const QJsonObject object = it.value().toObject();
+
+        Entry entry{
+            .size = FromHexString(object[QStringLiteral("size")]),
+            .last_modified =
+                static_cast<s64>(FromHexString(object[QStringLiteral("last_modified")])),
+            .file_type = static_cast<Loader::FileType>(object[QStringLiteral("type")].toInt()),
+            .program_id = FromHexString(object[QStringLiteral("program_id")]),
+            .program_ids = {},
+        };
+        for (const auto& id : object[QStringLiteral("program_ids")].toArray()) {
+            entry.program_ids.push_back(FromHexString(id));
+        }
+
+        previous_entries.emplace(it.key().toStdString(), std::move(entry));
+    }
+}
+
+void GameListIndex::Save() const {
+    std::scoped_lock lk{mutex};
+
+    QJsonObject files;
+    for (const auto& [path, entry] : current_entries) {
+        QJsonArray program_ids;
+        for (const auto id : entry.program_ids) {
+            program_ids.append(ToHexString(id));
+        }
+
+        files.insert(QString::fromStdString(path),
+                     QJsonObject{
+                         {QStringLiteral("size"), ToHexString(entry.size)},
+                         {QStringLiteral("last_modified"),
+                          ToHexString(static_cast<u64>(entry.last_modified))},
+                         {QStringLiteral("type"), static_cast<int>(entry.file_type)},
+                         {QStringLiteral("program_id"), ToHexString(entry.program_id)},
+                         {QStringLiteral("program_ids"), program_ids},
+                     });
+    }
+
+    const QJsonObject root{
+        {QStringLiteral("version"), IndexVersion},
+        {QStringLiteral("files"), files},
+    };
+
+    const auto path = GetIndexPath();
+    void(Common::FS::CreateParentDirs(path.toStdString()));
+
+    QFile file{path};
+    if (!file.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open game list index for writing.");
+        return;
+    }
+    file.write(QJsonDocument{root}.toJson(QJsonDocument::Compact));
+}
+
+std::optional<GameListIndex::Entry> GameListIndex::Find(const std::string& path, u64 size,
+                                                        s64 last_modified) const {
+    std::scoped_lock lk{mutex};
+
+    const auto it = previous_entries.find(path);
+    if (it == previous_entries.end() || it->second.size != size ||
+        it->second.last_modified != last_modified) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void GameListIndex::Record(const std::string& path, Entry entry) {
+    std::scoped_lock lk{mutex};
+    current_entries.insert_or_assign(path, std::move(entry));
+}
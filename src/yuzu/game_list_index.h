@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/loader/loader.h"
+
+/**
+ * Persistent record of the files found while populating the game list, keyed by path, size and
+ * modification time. Files that have not changed since the previous scan can be listed from the
+ * game list metadata cache without being parsed again.
+ */
+class GameListIndex {
+public:
+    struct Entry {
+        u64 size;
+        s64 last_modified;
+        Loader::FileType file_type;
+        u64 program_id;
+        std::vector<u64> program_ids;
+    };
+
+    /// Loads the entries recorded by the previous scan, if any.
+    void Load();
+
+    /// Stores the entries recorded during this scan, dropping files that were not seen.
+    void Save() const;
+
+    /// Returns the entry recorded by the previous scan, if the file has not changed since.
+    std::optional<Entry> Find(const std::string& path, u64 size, s64 last_modified) const;
+
+    /// Records the entry for a file seen during this scan.
+    void Record(const std::string& path, Entry entry);
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> previous_entries;
+    std::unordered_map<std::string, Entry> current_entries;
+};
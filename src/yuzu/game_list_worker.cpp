@@ -1,11 +1,17 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <filesystem>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -13,6 +19,7 @@
 
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -31,103 +38,129 @@
 
 namespace {
 
-QString GetGameListCachedObject(const std::string& filename, const std::string& ext,
-                                const std::function<QString()>& generator) {
-    if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
-        return generator();
-    }
+bool IsGameListCacheEnabled(const std::string& filename) {
+    return UISettings::values.cache_game_list && filename != "0000000000000000";
+}
 
+std::filesystem::path GetGameListCachePath(const std::string& name) {
+    return Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "game_list" / name;
+}
+
+std::optional<QString> LoadGameListCachedObject(const std::string& filename,
+                                                const std::string& ext) {
     const auto path =
-        Common::FS::PathToUTF8String(Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) /
-                                     "game_list" / fmt::format("{}.{}", filename, ext));
+        Common::FS::PathToUTF8String(GetGameListCachePath(fmt::format("{}.{}", filename, ext)));
 
-    void(Common::FS::CreateParentDirs(path));
+    QFile file{QString::fromStdString(path)};
+    if (!file.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
 
-    if (!Common::FS::Exists(path)) {
-        const auto str = generator();
+    return QString::fromUtf8(file.readAll());
+}
 
-        QFile file{QString::fromStdString(path)};
-        if (file.open(QFile::WriteOnly)) {
-            file.write(str.toUtf8());
-        }
+void StoreGameListCachedObject(const std::string& filename, const std::string& ext,
+                               const QString& str) {
+    const auto path =
+        Common::FS::PathToUTF8String(GetGameListCachePath(fmt::format("{}.{}", filename, ext)));
 
-        return str;
-    }
+    void(Common::FS::CreateParentDirs(path));
 
     QFile file{QString::fromStdString(path)};
-    if (file.open(QFile::ReadOnly)) {
-        return QString::fromUtf8(file.readAll());
+    if (file.open(QFile::WriteOnly)) {
+        file.write(str.toUtf8());
     }
-
-    return generator();
 }
 
-std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
-    const std::string& filename, const std::string& ext,
-    const std::function<std::pair<std::vector<u8>, std::string>()>& generator) {
-    if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
+QString GetGameListCachedObject(const std::string& filename, const std::string& ext,
+                                const std::function<QString()>& generator) {
+    if (!IsGameListCacheEnabled(filename)) {
         return generator();
     }
 
-    const auto game_list_dir =
-        Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "game_list";
-    const auto jpeg_name = fmt::format("{}.jpeg", filename);
-    const auto app_name = fmt::format("{}.appname.txt", filename);
+    if (auto str = LoadGameListCachedObject(filename, ext)) {
+        return *str;
+    }
 
-    const auto path1 = Common::FS::PathToUTF8String(game_list_dir / jpeg_name);
-    const auto path2 = Common::FS::PathToUTF8String(game_list_dir / app_name);
+    const auto str = generator();
+    StoreGameListCachedObject(filename, ext, str);
+    return str;
+}
 
-    void(Common::FS::CreateParentDirs(path1));
+std::optional<std::pair<std::vector<u8>, std::string>> LoadGameListCachedObject(
+    const std::string& filename) {
+    const auto path1 =
+        Common::FS::PathToUTF8String(GetGameListCachePath(fmt::format("{}.jpeg", filename)));
+    const auto path2 = Common::FS::PathToUTF8String(
+        GetGameListCachePath(fmt::format("{}.appname.txt", filename)));
 
-    if (!Common::FS::Exists(path1) || !Common::FS::Exists(path2)) {
-        const auto [icon, nacp] = generator();
+    QFile file1(QString::fromStdString(path1));
+    QFile file2(QString::fromStdString(path2));
 
-        QFile file1{QString::fromStdString(path1)};
-        if (!file1.open(QFile::WriteOnly)) {
-            LOG_ERROR(Frontend, "Failed to open cache file.");
-            return generator();
-        }
+    if (!file1.open(QFile::ReadOnly) || !file2.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
 
-        if (!file1.resize(icon.size())) {
-            LOG_ERROR(Frontend, "Failed to resize cache file to necessary size.");
-            return generator();
-        }
+    std::vector<u8> vec(file1.size());
+    if (file1.read(reinterpret_cast<char*>(vec.data()), vec.size()) !=
+        static_cast<s64>(vec.size())) {
+        return std::nullopt;
+    }
 
-        if (file1.write(reinterpret_cast<const char*>(icon.data()), icon.size()) !=
-            s64(icon.size())) {
-            LOG_ERROR(Frontend, "Failed to write data to cache file.");
-            return generator();
-        }
+    const auto data = file2.readAll();
+    return std::make_pair(vec, data.toStdString());
+}
 
-        QFile file2{QString::fromStdString(path2)};
-        if (file2.open(QFile::WriteOnly)) {
-            file2.write(nacp.data(), nacp.size());
-        }
+void StoreGameListCachedObject(const std::string& filename, const std::vector<u8>& icon,
+                               const std::string& name) {
+    const auto path1 =
+        Common::FS::PathToUTF8String(GetGameListCachePath(fmt::format("{}.jpeg", filename)));
+    const auto path2 = Common::FS::PathToUTF8String(
+        GetGameListCachePath(fmt::format("{}.appname.txt", filename)));
+
+    void(Common::FS::CreateParentDirs(path1));
 
-        return std::make_pair(icon, nacp);
+    QFile file1{QString::fromStdString(path1)};
+    if (!file1.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open cache file.");
+        return;
     }
 
-    QFile file1(QString::fromStdString(path1));
-    QFile file2(QString::fromStdString(path2));
+    if (!file1.resize(icon.size())) {
+        LOG_ERROR(Frontend, "Failed to resize cache file to necessary size.");
+        return;
+    }
 
-    if (!file1.open(QFile::ReadOnly)) {
-        LOG_ERROR(Frontend, "Failed to open cache file for reading.");
-        return generator();
+    if (file1.write(reinterpret_cast<const char*>(icon.data()), icon.size()) !=
+        s64(icon.size())) {
+        LOG_ERROR(Frontend, "Failed to write data to cache file.");
+        return;
     }
 
-    if (!file2.open(QFile::ReadOnly)) {
-        LOG_ERROR(Frontend, "Failed to open cache file for reading.");
-        return generator();
+    QFile file2{QString::fromStdString(path2)};
+    if (file2.open(QFile::WriteOnly)) {
+        file2.write(name.data(), name.size());
     }
+}
 
-    std::vector<u8> vec(file1.size());
-    if (file1.read(reinterpret_cast<char*>(vec.data()), vec.size()) !=
-        static_cast<s64>(vec.size())) {
+std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
+    const std::string& filename, const std::string& ext,
+    const std::function<std::pair<std::vector<u8>, std::string>()>& generator) {
+    if (!IsGameListCacheEnabled(filename)) {
         return generator();
     }
 
-    const auto data = file2.readAll();
-    return std::make_pair(vec, data.toStdString());
+    if (auto cached = LoadGameListCachedObject(filename)) {
+        return std::move(*cached);
+    }
+
+    auto [icon, name] = generator();
+    StoreGameListCachedObject(filename, icon, name);
+    return std::make_pair(std::move(icon), std::move(name));
+}
+
+s64 GetLastModified(const std::string& physical_name) {
+    return QFileInfo(QString::fromStdString(physical_name)).lastModified().toMSecsSinceEpoch();
 }
 
 void GetMetadataFromControlNCA(const FileSys::PatchManager& patch_manager, const FileSys::NCA& nca,
@@ -191,12 +224,35 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
     return out;
 }
 
+QString GetPatchVersions(const FileSys::PatchManager& patch, Loader::AppLoader& loader) {
+    return GetGameListCachedObject(
+        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
+            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
+        });
+}
+
+QString UpdatePatchVersions(const FileSys::PatchManager& patch, Loader::AppLoader& loader) {
+    const auto filename = fmt::format("{:016X}", patch.GetTitleID());
+    const auto patch_versions = FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
+    if (IsGameListCacheEnabled(filename)) {
+        StoreGameListCachedObject(filename, "pv.txt", patch_versions);
+    }
+    return patch_versions;
+}
+
+void UpdateMetadata(u64 program_id, const std::vector<u8>& icon, const std::string& name) {
+    const auto filename = fmt::format("{:016X}", program_id);
+    if (IsGameListCacheEnabled(filename)) {
+        StoreGameListCachedObject(filename, icon, name);
+    }
+}
+
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
                                         const std::size_t size, const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader, u64 program_id,
+                                        Loader::FileType file_type, u64 program_id,
                                         const CompatibilityList& compatibility_list,
                                         const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch) {
+                                        const QString& patch_versions) {
     const auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
 
     // The game list uses this as compatibility number for untested games
@@ -205,7 +261,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         compatibility = it->second.first;
     }
 
-    const auto file_type = loader.GetFileType();
     const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
     QList<QStandardItem*> list{
@@ -217,10 +272,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         new GameListItemPlayTime(play_time_manager.GetPlayTime(program_id)),
     };
 
-    const auto patch_versions = GetGameListCachedObject(
-        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-        });
     list.insert(2, new GameListItem(patch_versions));
 
     return list;
@@ -328,15 +379,18 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
             GetMetadataFromControlNCA(patch, *control, icon, name);
         }
 
-        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon, *loader,
-                                       program_id, compatibility_list, play_time_manager, patch);
+        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon,
+                                       loader->GetFileType(), program_id, compatibility_list,
+                                       play_time_manager, GetPatchVersions(patch, *loader));
         RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
     }
 }
 
-void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
-                                    GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+std::vector<std::string> GameListWorker::ScanDirectory(const std::string& dir_path,
+                                                       bool deep_scan) {
+    std::vector<std::string> files;
+
+    const auto callback = [this, &files](const std::filesystem::path& path) -> bool {
         if (stop_requested) {
             // Breaks the callback loop.
             return false;
@@ -347,107 +401,264 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
 
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
-            const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
-            if (!file) {
-                return true;
+            files.push_back(physical_name);
+        } else if (is_dir) {
+            watch_list.append(QString::fromStdString(physical_name));
+        }
+
+        return true;
+    };
+
+    if (deep_scan) {
+        Common::FS::IterateDirEntriesRecursively(dir_path, callback,
+                                                 Common::FS::DirEntryFilter::All);
+    } else {
+        Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
+    }
+
+    return files;
+}
+
+void GameListWorker::ScanFiles(ScanTarget target, const std::vector<std::string>& files,
+                               GameListDir* parent_dir) {
+    // Parsing is mostly spent decrypting and reading, so spread the files across a few threads.
+    Common::ThreadWorker workers{
+        std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 8), "GameListWorker"};
+
+    // Publishing in the order of the files keeps the list, and which file wins when several
+    // provide the same content, from depending on the thread timing.
+    std::mutex results_lock;
+    std::vector<std::optional<ScanResult>> results(files.size());
+    size_t next_result = 0;
+
+    const auto publish = [&](const ScanResult& result) {
+        for (const auto& entry : result.provider_entries) {
+            provider->AddEntry(entry.title_type, entry.content_type, entry.title_id, entry.file);
+        }
+        for (const auto& entry : result.list_entries) {
+            RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
+        }
+    };
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        workers.QueueWork([&, i] {
+            ScanResult result;
+            if (!stop_requested) {
+                if (target == ScanTarget::FillManualContentProvider) {
+                    AddFileToContentProvider(files[i], result);
+                } else {
+                    AddFileToGameList(files[i], result);
+                }
             }
 
-            auto loader = Loader::GetLoader(system, file);
-            if (!loader) {
-                return true;
+            std::scoped_lock lk{results_lock};
+            results[i] = std::move(result);
+            for (; next_result < results.size() && results[next_result]; ++next_result) {
+                publish(*results[next_result]);
+                results[next_result] = ScanResult{};
             }
+        });
+    }
+
+    workers.WaitForRequests();
+}
+
+void GameListWorker::AddFileToContentProvider(const std::string& physical_name,
+                                              ScanResult& result) {
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return;
+    }
 
-            const auto file_type = loader->GetFileType();
-            if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
-                return true;
+    // Files that have not changed since the last scan don't need a loader to be identified.
+    if (index != nullptr) {
+        const auto size = static_cast<u64>(Common::FS::GetSize(physical_name));
+        if (const auto entry = index->Find(physical_name, size, GetLastModified(physical_name))) {
+            AddToContentProvider(file, entry->file_type, entry->program_id, result);
+            return;
+        }
+    }
+
+    const auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
+
+    u64 program_id = 0;
+    if (loader->ReadProgramId(program_id) == Loader::ResultStatus::Success) {
+        AddToContentProvider(file, file_type, program_id, result);
+    }
+}
+
+void GameListWorker::AddToContentProvider(const FileSys::VirtualFile& file,
+                                          Loader::FileType file_type, u64 program_id,
+                                          ScanResult& result) {
+    if (file_type == Loader::FileType::NCA) {
+        const auto type = FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType());
+        result.provider_entries.push_back(
+            {FileSys::TitleType::Application, type, program_id, file});
+    } else if (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP) {
+        const auto nsp = file_type == Loader::FileType::NSP
+                             ? std::make_shared<FileSys::NSP>(file)
+                             : FileSys::XCI{file}.GetSecurePartitionNSP();
+
+        for (const auto& title : nsp->GetNCAs()) {
+            for (const auto& entry : title.second) {
+                result.provider_entries.push_back({entry.first.first, entry.first.second,
+                                                   title.first, entry.second->GetBaseFile()});
             }
+        }
+    }
+}
 
-            u64 program_id = 0;
-            const auto res2 = loader->ReadProgramId(program_id);
-
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
-                    }
-                }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
-
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
-
-                        std::vector<u8> icon;
-                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                        std::string name = " ";
-                        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                          system.GetContentProvider()};
-
-                        auto entry = MakeGameListEntry(
-                            physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                            id, compatibility_list, play_time_manager, patch);
-
-                        RecordEvent(
-                            [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                    }
-                } else {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+void GameListWorker::AddFileToGameList(const std::string& physical_name, ScanResult& result) {
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return;
+    }
+
+    const auto size = static_cast<u64>(Common::FS::GetSize(physical_name));
+    const auto last_modified = GetLastModified(physical_name);
 
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+    // List files that have not changed since the last scan from the metadata cache.
+    if (index != nullptr) {
+        if (const auto entry = index->Find(physical_name, size, last_modified);
+            entry && AddIndexedFileToGameList(physical_name, *entry, result)) {
+            index->Record(physical_name, *entry);
+            return;
+        }
+    }
 
-                    const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
+    auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
 
-                    auto entry = MakeGameListEntry(
-                        physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                        program_id, compatibility_list, play_time_manager, patch);
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
 
-                    RecordEvent(
-                        [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                }
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+
+    std::vector<u64> program_ids;
+    loader->ReadProgramIds(program_ids);
+
+    if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+        (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        for (const auto id : program_ids) {
+            loader = Loader::GetLoader(system, file, id);
+            if (!loader) {
+                continue;
             }
-        } else if (is_dir) {
-            watch_list.append(QString::fromStdString(physical_name));
+
+            std::vector<u8> icon;
+            [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+
+            std::string name = " ";
+            [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+
+            const FileSys::PatchManager patch{id, system.GetFileSystemController(),
+                                              system.GetContentProvider()};
+
+            UpdateMetadata(id, icon, name);
+            auto entry = MakeGameListEntry(physical_name, name, size, icon, file_type, id,
+                                           compatibility_list, play_time_manager,
+                                           UpdatePatchVersions(patch, *loader));
+            result.list_entries.push_back(std::move(entry));
         }
+    } else {
+        std::vector<u8> icon;
+        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
 
-        return true;
+        std::string name = " ";
+        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+
+        const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+
+        UpdateMetadata(program_id, icon, name);
+        auto entry = MakeGameListEntry(physical_name, name, size, icon, file_type, program_id,
+                                       compatibility_list, play_time_manager,
+                                       UpdatePatchVersions(patch, *loader));
+        result.list_entries.push_back(std::move(entry));
+    }
+
+    // Remember the file, so that it isn't parsed again until it changes.
+    if (index != nullptr && res2 == Loader::ResultStatus::Success) {
+        index->Record(physical_name, {
+                                         .size = size,
+                                         .last_modified = last_modified,
+                                         .file_type = file_type,
+                                         .program_id = program_id,
+                                         .program_ids = std::move(program_ids),
+                                     });
+    }
+}
+
+bool GameListWorker::AddIndexedFileToGameList(const std::string& physical_name,
+                                              const GameListIndex::Entry& entry,
+                                              ScanResult& result) {
+    std::vector<u64> program_ids{entry.program_id};
+    if (entry.program_ids.size() > 1 &&
+        (entry.file_type == Loader::FileType::XCI || entry.file_type == Loader::FileType::NSP)) {
+        program_ids = entry.program_ids;
+    }
+
+    // Only list the file if all of its programs are cached, otherwise it is parsed again.
+    struct CachedProgram {
+        u64 program_id;
+        std::vector<u8> icon;
+        std::string name;
+        QString patch_versions;
     };
+    std::vector<CachedProgram> programs;
+    for (const auto id : program_ids) {
+        const auto filename = fmt::format("{:016X}", id);
+        if (!IsGameListCacheEnabled(filename)) {
+            return false;
+        }
 
-    if (deep_scan) {
-        Common::FS::IterateDirEntriesRecursively(dir_path, callback,
-                                                 Common::FS::DirEntryFilter::All);
-    } else {
-        Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
+        auto metadata = LoadGameListCachedObject(filename);
+        auto patch_versions = LoadGameListCachedObject(filename, "pv.txt");
+        if (!metadata || !patch_versions) {
+            return false;
+        }
+
+        programs.push_back({
+            .program_id = id,
+            .icon = std::move(metadata->first),
+            .name = std::move(metadata->second),
+            .patch_versions = std::move(*patch_versions),
+        });
+    }
+
+    for (const auto& program : programs) {
+        result.list_entries.push_back(MakeGameListEntry(
+            physical_name, program.name, entry.size, program.icon, entry.file_type,
+            program.program_id, compatibility_list, play_time_manager, program.patch_versions));
     }
+
+    return true;
 }
 
 void GameListWorker::run() {
     watch_list.clear();
     provider->ClearAllEntries();
 
+    // Files are only parsed again if they changed since the last scan, when caching metadata.
+    index.reset();
+    if (UISettings::values.cache_game_list) {
+        index = std::make_unique<GameListIndex>();
+        index->Load();
+    }
+
     const auto DirEntryReady = [&](GameListDir* game_list_dir) {
         RecordEvent([=](GameList* game_list) { game_list->AddDirEntry(game_list_dir); });
     };
@@ -473,13 +684,17 @@ void GameListWorker::run() {
             watch_list.append(QString::fromStdString(game_dir.path));
             auto* const game_list_dir = new GameListDir(game_dir);
             DirEntryReady(game_list_dir);
-            ScanFileSystem(ScanTarget::FillManualContentProvider, game_dir.path, game_dir.deep_scan,
-                           game_list_dir);
-            ScanFileSystem(ScanTarget::PopulateGameList, game_dir.path, game_dir.deep_scan,
-                           game_list_dir);
+            const auto files = ScanDirectory(game_dir.path, game_dir.deep_scan);
+            ScanFiles(ScanTarget::FillManualContentProvider, files, game_list_dir);
+            ScanFiles(ScanTarget::PopulateGameList, files, game_list_dir);
         }
     }
 
+    // Only keep the index if the scan completed, as it drops the files that weren't seen.
+    if (index != nullptr && !stop_requested) {
+        index->Save();
+    }
+
     RecordEvent([this](GameList* game_list) { game_list->DonePopulating(watch_list); });
     processing_completed.Set();
 }
@@ -6,7 +6,9 @@
 #include <atomic>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <QList>
 #include <QObject>
@@ -14,7 +16,9 @@
 #include <QString>
 
 #include "common/thread.h"
+#include "core/file_sys/vfs/vfs_types.h"
 #include "yuzu/compatibility_list.h"
+#include "yuzu/game_list_index.h"
 #include "yuzu/play_time_manager.h"
 
 namespace Core {
@@ -27,6 +31,8 @@ class QStandardItem;
 namespace FileSys {
 class NCA;
 class VfsFilesystem;
+enum class ContentRecordType : u8;
+enum class TitleType : u8;
 } // namespace FileSys
 
 /**
@@ -73,8 +79,36 @@ private:
         PopulateGameList,
     };
 
-    void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
-                        GameListDir* parent_dir);
+    /// Lists the supported files in the directory and adds its subdirectories to the watch list.
+    std::vector<std::string> ScanDirectory(const std::string& dir_path, bool deep_scan);
+
+    struct ProviderEntry {
+        FileSys::TitleType title_type;
+        FileSys::ContentRecordType content_type;
+        u64 title_id;
+        FileSys::VirtualFile file;
+    };
+
+    /// Everything found in a single file, published once the files before it are done.
+    struct ScanResult {
+        std::vector<ProviderEntry> provider_entries;
+        std::vector<QList<QStandardItem*>> list_entries;
+    };
+
+    /**
+     * Processes the files in parallel, returning once all of them have been processed.
+     * Results are published in the order of the files, regardless of which finishes first.
+     */
+    void ScanFiles(ScanTarget target, const std::vector<std::string>& files,
+                   GameListDir* parent_dir);
+
+    void AddFileToContentProvider(const std::string& physical_name, ScanResult& result);
+    void AddToContentProvider(const FileSys::VirtualFile& file, Loader::FileType file_type,
+                              u64 program_id, ScanResult& result);
+
+    void AddFileToGameList(const std::string& physical_name, ScanResult& result);
+    bool AddIndexedFileToGameList(const std::string& physical_name,
+                                  const GameListIndex::Entry& entry, ScanResult& result);
 
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
@@ -83,6 +117,7 @@ private:
     const PlayTime::PlayTimeManager& play_time_manager;
 
     QStringList watch_list;
+    std::unique_ptr<GameListIndex> index;
 
     std::mutex lock;
     std::condition_variable cv;
@@ -98,6 +98,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #include "common/literals.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
+#include "common/memory_accounting.h"
 #include "common/memory_detect.h"
 #include "common/microprofile.h"
 #include "common/scm_rev.h"
@@ -111,6 +112,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #endif
 #include "common/settings.h"
 #include "common/telemetry.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/crypto/key_manager.h"
@@ -1049,9 +1051,10 @@ void GMainWindow::InitializeWidgets() {
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
            "full-speed emulation this should be at most 16.67 ms."));
+    memory_usage_label = new QLabel();
 
     for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+                        emu_frametime_label, memory_usage_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -1391,6 +1394,11 @@ void GMainWindow::InitializeHotkeys() {
             system->GetRenderdocAPI().ToggleCapture();
         }
     });
+    connect_shortcut(QStringLiteral("Export Trace"), [] {
+        if (Common::Trace::IsEnabled()) {
+            Common::Trace::Export();
+        }
+    });
     connect_shortcut(QStringLiteral("Toggle Mouse Panning"), [&] {
         Settings::values.mouse_panning = !Settings::values.mouse_panning;
         if (Settings::values.mouse_panning) {
@@ -2192,6 +2200,7 @@ void GMainWindow::OnEmulationStopped() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    memory_usage_label->setVisible(false);
     renderer_status_button->setEnabled(!UISettings::values.has_broken_vulkan);
 
     if (!firmware_label->text().isEmpty()) {
@@ -2290,9 +2299,9 @@ void GMainWindow::OnGameListOpenFolder(u64 program_id, GameListOpenTarget target
     switch (target) {
     case GameListOpenTarget::SaveData: {
         open_target = tr("Save Data");
-        const auto nand_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::NANDDir);
-        auto vfs_nand_dir =
-            vfs->OpenDirectory(Common::FS::PathToUTF8String(nand_dir), FileSys::OpenMode::Read);
+        const auto save_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::SaveDir);
+        auto vfs_save_dir =
+            vfs->OpenDirectory(Common::FS::PathToUTF8String(save_dir), FileSys::OpenMode::Read);
 
         if (has_user_save) {
             // User save data
@@ -2325,17 +2334,17 @@ void GMainWindow::OnGameListOpenFolder(u64 program_id, GameListOpenTarget target
             ASSERT(user_id);
 
             const auto user_save_data_path = FileSys::SaveDataFactory::GetFullPath(
-                {}, vfs_nand_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account,
+                {}, vfs_save_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account,
                 program_id, user_id->AsU128(), 0);
 
-            path = Common::FS::ConcatPathSafe(nand_dir, user_save_data_path);
+            path = Common::FS::ConcatPathSafe(save_dir, user_save_data_path);
         } else {
             // Device save data
             const auto device_save_data_path = FileSys::SaveDataFactory::GetFullPath(
-                {}, vfs_nand_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account,
+                {}, vfs_save_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Account,
                 program_id, {}, 0);
 
-            path = Common::FS::ConcatPathSafe(nand_dir, device_save_data_path);
+            path = Common::FS::ConcatPathSafe(save_dir, device_save_data_path);
         }
 
         if (!Common::FS::CreateDirs(path)) {
@@ -2669,15 +2678,15 @@ void GMainWindow::RemoveCustomConfiguration(u64 program_id, const std::string& g
 }
 
 void GMainWindow::RemoveCacheStorage(u64 program_id) {
-    const auto nand_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::NANDDir);
-    auto vfs_nand_dir =
-        vfs->OpenDirectory(Common::FS::PathToUTF8String(nand_dir), FileSys::OpenMode::Read);
+    const auto save_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::SaveDir);
+    auto vfs_save_dir =
+        vfs->OpenDirectory(Common::FS::PathToUTF8String(save_dir), FileSys::OpenMode::Read);
 
     const auto cache_storage_path = FileSys::SaveDataFactory::GetFullPath(
-        {}, vfs_nand_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Cache,
+        {}, vfs_save_dir, FileSys::SaveDataSpaceId::User, FileSys::SaveDataType::Cache,
         0 /* program_id */, {}, 0);
 
-    const auto path = Common::FS::ConcatPathSafe(nand_dir, cache_storage_path);
+    const auto path = Common::FS::ConcatPathSafe(save_dir, cache_storage_path);
 
     // Not an error if it wasn't cleared.
     Common::FS::RemoveDirRecursively(path);
@@ -4667,10 +4676,28 @@ void GMainWindow::UpdateStatusBar() {
     }
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
 
+    constexpr double MiB = 1024.0 * 1024.0;
+    u64 total_memory_usage = 0;
+    QString memory_usage_tooltip =
+        tr("Host memory used by the emulated console and the caches of each subsystem:");
+    for (size_t category = 0; category < Common::NUM_MEMORY_CATEGORIES; ++category) {
+        const u64 bytes = results.memory_usage[category];
+        const auto name =
+            Common::GetMemoryCategoryName(static_cast<Common::MemoryCategory>(category));
+        total_memory_usage += bytes;
+        memory_usage_tooltip += QStringLiteral("\n%1: %2 MiB")
+                                    .arg(QString::fromUtf8(name.data(), name.size()))
+                                    .arg(static_cast<double>(bytes) / MiB, 0, 'f', 1);
+    }
+    memory_usage_label->setText(
+        tr("Memory: %1 MiB").arg(static_cast<double>(total_memory_usage) / MiB, 0, 'f', 0));
+    memory_usage_label->setToolTip(memory_usage_tooltip);
+
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    memory_usage_label->setVisible(true);
     firmware_label->setVisible(false);
 }
 
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "core/frontend/framebuffer_layout.h"
+#include "core/frontend/graphics_context.h"
+#include "input_common/drivers/tas_input.h"
+#include "input_common/main.h"
+#include "yuzu_bench/emu_window_headless.h"
+
+namespace {
+class DummyContext : public Core::Frontend::GraphicsContext {};
+} // Anonymous namespace
+
+EmuWindow_Headless::EmuWindow_Headless(InputCommon::InputSubsystem* input_subsystem_)
+    : input_subsystem{input_subsystem_} {
+    window_info.type = Core::Frontend::WindowSystemType::Headless;
+    UpdateCurrentFramebufferLayout(Layout::ScreenUndocked::Width, Layout::ScreenUndocked::Height);
+}
+
+EmuWindow_Headless::~EmuWindow_Headless() = default;
+
+std::unique_ptr<Core::Frontend::GraphicsContext> EmuWindow_Headless::CreateSharedContext() const {
+    return std::make_unique<DummyContext>();
+}
+
+bool EmuWindow_Headless::IsShown() const {
+    return true;
+}
+
+void EmuWindow_Headless::OnFrameDisplayed() {
+    // Advance the input script in lockstep with presentation, as the Qt frontend does
+    input_subsystem->GetTas()->UpdateThread();
+
+    {
+        std::scoped_lock lock{frame_mutex};
+        ++frames_displayed;
+    }
+    frame_cv.notify_all();
+}
+
+u64 EmuWindow_Headless::GetFramesDisplayed() const {
+    std::scoped_lock lock{frame_mutex};
+    return frames_displayed;
+}
+
+bool EmuWindow_Headless::WaitForFrames(u64 frame_count, std::chrono::seconds timeout) {
+    std::unique_lock lock{frame_mutex};
+    return frame_cv.wait_for(lock, timeout, [&] { return frames_displayed >= frame_count; });
+}
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "common/common_types.h"
+#include "core/frontend/emu_window.h"
+
+namespace InputCommon {
+class InputSubsystem;
+}
+
+/**
+ * Window without any host surface. Used by the benchmark runner to drive the emulated system
+ * without a display server, and to count the frames presented by the renderer.
+ */
+class EmuWindow_Headless final : public Core::Frontend::EmuWindow {
+public:
+    explicit EmuWindow_Headless(InputCommon::InputSubsystem* input_subsystem_);
+    ~EmuWindow_Headless() override;
+
+    std::unique_ptr<Core::Frontend::GraphicsContext> CreateSharedContext() const override;
+
+    bool IsShown() const override;
+
+    void OnFrameDisplayed() override;
+
+    /// Returns the number of frames presented by the renderer so far
+    u64 GetFramesDisplayed() const;
+
+    /**
+     * Blocks until the renderer has presented at least the given number of frames or the timeout
+     * expires.
+     * @returns true if the requested number of frames was reached
+     */
+    bool WaitForFrames(u64 frame_count, std::chrono::seconds timeout);
+
+private:
+    InputCommon::InputSubsystem* input_subsystem;
+
+    mutable std::mutex frame_mutex;
+    std::condition_variable frame_cv;
+    u64 frames_displayed{};
+};
@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "audio_core/adsp/adsp.h"
+#include "audio_core/audio_core.h"
+#include "audio_core/sink/file_sink.h"
+#include "common/detached_tasks.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/cpu_manager.h"
+#include "core/file_sys/registered_cache.h"
+#include "core/file_sys/vfs/vfs_real.h"
+#include "core/hle/service/am/applet_manager.h"
+#include "core/hle/service/filesystem/filesystem.h"
+#include "core/loader/loader.h"
+#include "core/perf_stats.h"
+#include "hid_core/hid_core.h"
+#include "input_common/drivers/tas_input.h"
+#include "input_common/main.h"
+#include "video_core/gpu.h"
+#include "yuzu_bench/emu_window_headless.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr u64 DefaultFrames = 3600;
+constexpr u64 DefaultWarmupFrames = 300;
+constexpr s64 DefaultTimeoutSeconds = 600;
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <filename>\n"
+                 "-f, --frames          Number of measured guest frames (default 3600)\n"
+                 "-w, --warmup          Number of frames skipped before measuring (default 300)\n"
+                 "-t, --tas             Directory holding the TAS input scripts to replay\n"
+                 "-o, --output          Write the JSON report to this file instead of stdout\n"
+                 "-a, --audio           Directory to write the rendered audio to, as raw PCM\n"
+                 "-s, --seed            RNG seed used for the emulated system (default 0)\n"
+                 "-T, --timeout         Abort if the run takes longer than this many seconds\n"
+                 "-i, --instance        Directory for the data this run writes, so several runs\n"
+                 "                      can share the same user directory\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-v, --version         Output version information and exit\n";
+}
+
+void PrintVersion() {
+    std::cout << "yuzu-bench " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
+}
+
+/// Returns the peak resident set size of the process in bytes
+u64 GetPeakResidentSetSize() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return static_cast<u64>(counters.PeakWorkingSetSize);
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // macOS reports ru_maxrss in bytes
+    return static_cast<u64>(usage.ru_maxrss);
+#else
+    return static_cast<u64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/// Nearest-rank percentile of an already sorted list of samples
+double Percentile(const std::vector<double>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/// Host time the audio renderer spent processing command lists, in nanoseconds
+u64 GetRenderTime(const AudioCore::ADSP::AudioRenderer::RenderStats& stats) {
+    u64 total{};
+    for (const auto& command : stats.commands) {
+        total += command.total_ns;
+    }
+    return total;
+}
+
+/// Forces the settings that would make two runs of the same title diverge
+void ApplyDeterministicSettings(u32 seed) {
+    Settings::values.renderer_backend.SetValue(Settings::RendererBackend::Null);
+    Settings::values.use_speed_limit.SetValue(false);
+    Settings::values.use_disk_shader_cache.SetValue(false);
+    // The file sink doesn't pace the renderer, and its checksums catch audio regressions
+    Settings::values.sink_id.SetValue(Settings::AudioEngine::File);
+    Settings::values.audio_output_device_id.SetValue(AudioCore::Sink::checksum_device_name);
+    Settings::values.rng_seed_enabled.SetValue(true);
+    Settings::values.rng_seed.SetValue(seed);
+    Settings::values.custom_rtc_enabled.SetValue(true);
+    Settings::values.custom_rtc.SetValue(0);
+}
+
+} // Anonymous namespace
+
+/// Application entry point
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+    Common::DetachedTasks detached_tasks;
+
+    std::string filepath;
+    std::optional<std::string> tas_path;
+    std::optional<std::string> output_path;
+    std::optional<std::string> audio_path;
+    std::optional<std::string> instance_path;
+    u64 measured_frames = DefaultFrames;
+    u64 warmup_frames = DefaultWarmupFrames;
+    s64 timeout_seconds = DefaultTimeoutSeconds;
+    u32 seed = 0;
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"frames", required_argument, 0, 'f'},
+        {"warmup", required_argument, 0, 'w'},
+        {"tas", required_argument, 0, 't'},
+        {"output", required_argument, 0, 'o'},
+        {"audio", required_argument, 0, 'a'},
+        {"seed", required_argument, 0, 's'},
+        {"timeout", required_argument, 0, 'T'},
+        {"instance", required_argument, 0, 'i'},
+        {"help", no_argument, 0, 'h'},
+        {"version", no_argument, 0, 'v'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+
+    int option_index = 0;
+    while (optind < argc) {
+        int arg = getopt_long(argc, argv, "f:w:t:o:a:s:T:i:hv", long_options, &option_index);
+        if (arg != -1) {
+            switch (static_cast<char>(arg)) {
+            case 'f':
+                measured_frames = std::strtoull(optarg, nullptr, 0);
+                break;
+            case 'w':
+                warmup_frames = std::strtoull(optarg, nullptr, 0);
+                break;
+            case 't':
+                tas_path = optarg;
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            case 'a':
+                audio_path = optarg;
+                break;
+            case 's':
+                seed = static_cast<u32>(std::strtoul(optarg, nullptr, 0));
+                break;
+            case 'T':
+                timeout_seconds = std::strtoll(optarg, nullptr, 0);
+                break;
+            case 'i':
+                instance_path = optarg;
+                break;
+            case 'h':
+                PrintHelp(argv[0]);
+                return 0;
+            case 'v':
+                PrintVersion();
+                return 0;
+            default:
+                PrintHelp(argv[0]);
+                return -1;
+            }
+        } else {
+            filepath = argv[optind];
+            optind++;
+        }
+    }
+
+    if (filepath.empty()) {
+        LOG_CRITICAL(Frontend, "Failed to load ROM: No ROM specified");
+        return -1;
+    }
+    if (measured_frames == 0) {
+        LOG_CRITICAL(Frontend, "At least one frame has to be measured");
+        return -1;
+    }
+
+    ApplyDeterministicSettings(seed);
+    if (audio_path) {
+        Settings::values.audio_output_device_id.SetValue(*audio_path);
+    }
+    if (instance_path) {
+        // Games, keys and the installed contents of the NAND are only read and stay shared, but
+        // concurrent runs must not write the same save data
+        const std::filesystem::path instance_dir{*instance_path};
+        for (const auto& [yuzu_path, subdir] : {
+                 std::pair{Common::FS::YuzuPath::SaveDir, "save"},
+                 std::pair{Common::FS::YuzuPath::DumpDir, "dump"},
+                 std::pair{Common::FS::YuzuPath::CrashDumpsDir, "crash_dumps"},
+             }) {
+            const auto dir = instance_dir / subdir;
+            if (!Common::FS::CreateDirs(dir)) {
+                LOG_CRITICAL(Frontend, "Failed to create the instance directory {}",
+                             Common::FS::PathToUTF8String(dir));
+                return -1;
+            }
+            Common::FS::SetYuzuPath(yuzu_path, dir);
+        }
+    }
+    if (tas_path) {
+        Common::FS::SetYuzuPath(Common::FS::YuzuPath::TASDir, *tas_path);
+        Settings::values.tas_enable = true;
+        Settings::values.pause_tas_on_load = false;
+    }
+
+    Core::System system{};
+    system.Initialize();
+
+    InputCommon::InputSubsystem input_subsystem{};
+    input_subsystem.Initialize();
+
+    system.ApplySettings();
+
+    EmuWindow_Headless emu_window{&input_subsystem};
+
+    system.SetContentProvider(std::make_unique<FileSys::ContentProviderUnion>());
+    system.SetFilesystem(std::make_shared<FileSys::RealVfsFilesystem>());
+    system.GetFileSystemController().CreateFactories(*system.GetFilesystem());
+    system.GetUserChannel().clear();
+
+    Service::AM::FrontendAppletParameters load_parameters{
+        .applet_id = Service::AM::AppletId::Application,
+    };
+    const Core::SystemResultStatus load_result{system.Load(emu_window, filepath, load_parameters)};
+    if (load_result != Core::SystemResultStatus::Success) {
+        LOG_CRITICAL(Frontend, "Failed to load {} (error {})", filepath,
+                     static_cast<u32>(load_result));
+        return -1;
+    }
+
+    system.GPU().Start();
+    system.GetCpuManager().OnGpuReady();
+
+    if (tas_path) {
+        // The scripts were loaded on construction, playback advances with every presented frame
+        input_subsystem.GetTas()->StartStop();
+    }
+
+    const auto timeout = std::chrono::seconds{timeout_seconds};
+    const auto boot_begin = std::chrono::steady_clock::now();
+    void(system.Run());
+
+    bool timed_out = !emu_window.WaitForFrames(warmup_frames, timeout);
+
+    const auto measure_begin = std::chrono::steady_clock::now();
+    const u64 first_frame = emu_window.GetFramesDisplayed();
+    const std::size_t first_system_frame = system.GetPerfStats().GetRecordedFrameCount();
+    void(system.GetAndResetPerfStats());
+    auto& audio_renderer = system.AudioCore().ADSP().AudioRenderer();
+    const auto first_render_stats = audio_renderer.GetRenderStats();
+
+    if (!timed_out) {
+        timed_out = !emu_window.WaitForFrames(first_frame + measured_frames, timeout);
+    }
+
+    const auto measure_end = std::chrono::steady_clock::now();
+    const u64 last_frame = emu_window.GetFramesDisplayed();
+    const Core::PerfStatsResults perf_results = system.GetAndResetPerfStats();
+    const auto last_render_stats = audio_renderer.GetRenderStats();
+
+    // GetFrametimeHistory skips the boot frames, realign the measuring window with it
+    std::vector<double> frametimes = system.GetPerfStats().GetFrametimeHistory();
+    const std::size_t history_skip =
+        system.GetPerfStats().GetRecordedFrameCount() - frametimes.size();
+    const std::size_t window_begin =
+        std::min(first_system_frame - std::min(first_system_frame, history_skip),
+                 frametimes.size());
+    frametimes.erase(frametimes.begin(),
+                     frametimes.begin() + static_cast<std::ptrdiff_t>(window_begin));
+    std::ranges::sort(frametimes);
+
+    void(system.Pause());
+
+    const double elapsed_seconds =
+        std::chrono::duration<double>(measure_end - measure_begin).count();
+    const u64 frames = last_frame - first_frame;
+
+    nlohmann::json report;
+    report["version"] = fmt::format("{} {}", Common::g_scm_branch, Common::g_scm_desc);
+    report["title_id"] = fmt::format("{:016X}", system.GetApplicationProcessProgramID());
+    report["timed_out"] = timed_out;
+    report["warmup_frames"] = warmup_frames;
+    report["frames"] = frames;
+    report["boot_seconds"] =
+        std::chrono::duration<double>(measure_begin - boot_begin).count();
+    report["elapsed_seconds"] = elapsed_seconds;
+    report["fps"] = elapsed_seconds > 0.0 ? static_cast<double>(frames) / elapsed_seconds : 0.0;
+    report["emulation_speed"] = perf_results.emulation_speed;
+    report["frametime_ms"] = {
+        {"p50", Percentile(frametimes, 50.0)},  {"p90", Percentile(frametimes, 90.0)},
+        {"p99", Percentile(frametimes, 99.0)},  {"p999", Percentile(frametimes, 99.9)},
+        {"max", frametimes.empty() ? 0.0 : frametimes.back()},
+    };
+    report["pacing_error_ms"] = {
+        {"mean", perf_results.pacing_error * 1000.0},
+        {"max", perf_results.max_pacing_error * 1000.0},
+    };
+    report["peak_rss_bytes"] = GetPeakResidentSetSize();
+
+    const u64 command_lists = last_render_stats.command_lists - first_render_stats.command_lists;
+    const u64 render_ns = GetRenderTime(last_render_stats) - GetRenderTime(first_render_stats);
+    auto& audio = report["audio"];
+    audio["command_lists"] = command_lists;
+    audio["command_lists_per_second"] =
+        elapsed_seconds > 0.0 ? static_cast<double>(command_lists) / elapsed_seconds : 0.0;
+    audio["mean_list_us"] = command_lists > 0 ? static_cast<double>(render_ns) / 1000.0 /
+                                                    static_cast<double>(command_lists)
+                                              : 0.0;
+    audio["max_list_us"] = static_cast<double>(last_render_stats.max_list_ns) / 1000.0;
+    audio["voices_dropped"] = last_render_stats.voices_dropped - first_render_stats.voices_dropped;
+    audio["streams"] = nlohmann::json::array();
+    if (const auto* file_sink =
+            dynamic_cast<AudioCore::Sink::FileSink*>(&system.AudioCore().GetOutputSink())) {
+        // Unlike the timings, the captures cover the whole run and not just the measured frames
+        for (const auto& capture : file_sink->GetCaptures()) {
+            audio["streams"].push_back({
+                {"name", capture.name},
+                {"frames", capture.frames},
+                {"checksum", fmt::format("{:016X}", capture.checksum)},
+            });
+        }
+    }
+
+    const std::string report_string = report.dump(4);
+    if (output_path) {
+        Common::FS::IOFile file{*output_path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::TextFile};
+        if (file.WriteString(report_string) != report_string.size()) {
+            LOG_ERROR(Frontend, "Failed to write the report to {}", *output_path);
+        }
+    } else {
+        std::cout << report_string << std::endl;
+    }
+
+    system.ShutdownMainProcess();
+    system.HIDCore().UnloadInputDevices();
+    input_subsystem.Shutdown();
+
+    detached_tasks.WaitForAllTasks();
+    return timed_out ? 1 : 0;
+}